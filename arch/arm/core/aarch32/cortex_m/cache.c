@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief d-cache maintenance for Cortex-M CPUs with a data cache
+ *
+ * Implements the range-based d-cache operations on top of the SCB
+ * cache maintenance registers (Cortex-M7 and ARMv8-M Mainline cores
+ * with a d-cache).
+ */
+
+#include <kernel.h>
+#include <cache.h>
+#include <arch/arm/aarch32/cortex_m/cmsis.h>
+
+void arch_dcache_flush(void *addr, size_t size)
+{
+	SCB_CleanDCache_by_Addr((uint32_t *)addr, size);
+}
+
+void arch_dcache_invd(void *addr, size_t size)
+{
+	SCB_InvalidateDCache_by_Addr((uint32_t *)addr, size);
+}
+
+void arch_dcache_range(void *addr, size_t size, int op)
+{
+	if (op == SYS_CACHE_OP_CLEAN_INVD) {
+		/* Single pass, one DCCIMVAC per line */
+		SCB_CleanInvalidateDCache_by_Addr((uint32_t *)addr, size);
+	} else if ((op & SYS_CACHE_OP_CLEAN) != 0) {
+		SCB_CleanDCache_by_Addr((uint32_t *)addr, size);
+	} else if ((op & SYS_CACHE_OP_INVD) != 0) {
+		SCB_InvalidateDCache_by_Addr((uint32_t *)addr, size);
+	}
+}
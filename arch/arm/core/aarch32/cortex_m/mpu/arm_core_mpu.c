@@ -50,6 +50,18 @@ LOG_MODULE_REGISTER(mpu);
 extern K_THREAD_STACK_DEFINE(z_main_stack, CONFIG_MAIN_STACK_SIZE);
 #endif
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF) && defined(CONFIG_USERSPACE)
+/* Identity of the memory domain whose partitions are currently
+ * programmed in the MPU, together with the domain generation observed
+ * at programming time and the number of MPU region slots the
+ * partitions occupy. A context switch to a thread of the same,
+ * unmodified domain may leave those regions untouched.
+ */
+static struct k_mem_domain *current_mpu_domain;
+static uint32_t current_mpu_domain_generation;
+static uint8_t current_mpu_domain_region_num;
+#endif
+
 /**
  * @brief Use the HW-specific MPU driver to program
  *        the static MPU regions.
@@ -190,6 +202,9 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 	struct k_mem_partition *dynamic_regions[_MAX_DYNAMIC_MPU_REGIONS_NUM];
 
 	uint8_t region_num = 0U;
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF)
+	uint8_t unchanged_num = 0U;
+#endif
 
 #if defined(CONFIG_USERSPACE)
 	struct k_mem_partition thread_stack;
@@ -200,33 +215,55 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 
 	if (mem_domain) {
 		LOG_DBG("configure domain: %p", mem_domain);
-		uint32_t num_partitions = mem_domain->num_partitions;
-		struct k_mem_partition partition;
-		int i;
 
-		LOG_DBG("configure domain: %p", mem_domain);
-
-		for (i = 0; i < CONFIG_MAX_DOMAIN_PARTITIONS; i++) {
-			partition = mem_domain->partitions[i];
-			if (partition.size == 0) {
-				/* Zero size indicates a non-existing
-				 * memory partition.
-				 */
-				continue;
-			}
-			LOG_DBG("set region 0x%lx 0x%x",
-				partition.start, partition.size);
-			__ASSERT(region_num < _MAX_DYNAMIC_MPU_REGIONS_NUM,
-				"Out-of-bounds error for dynamic region map.");
-			dynamic_regions[region_num] =
-				&mem_domain->partitions[i];
-
-			region_num++;
-			num_partitions--;
-			if (num_partitions == 0U) {
-				break;
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF)
+		if ((mem_domain == current_mpu_domain) &&
+		    (mem_domain->generation ==
+		     current_mpu_domain_generation)) {
+			/* The partition set has not changed since it was
+			 * last programmed; leave those MPU regions as they
+			 * are and only supply the thread-specific regions
+			 * to the driver.
+			 */
+			unchanged_num = current_mpu_domain_region_num;
+		} else
+#endif
+		{
+			uint32_t num_partitions = mem_domain->num_partitions;
+			struct k_mem_partition partition;
+			int i;
+
+			for (i = 0; i < CONFIG_MAX_DOMAIN_PARTITIONS; i++) {
+				partition = mem_domain->partitions[i];
+				if (partition.size == 0) {
+					/* Zero size indicates a non-existing
+					 * memory partition.
+					 */
+					continue;
+				}
+				LOG_DBG("set region 0x%lx 0x%x",
+					partition.start, partition.size);
+				__ASSERT(region_num <
+						_MAX_DYNAMIC_MPU_REGIONS_NUM,
+					"Out-of-bounds error for dynamic region map.");
+				dynamic_regions[region_num] =
+					&mem_domain->partitions[i];
+
+				region_num++;
+				num_partitions--;
+				if (num_partitions == 0U) {
+					break;
+				}
 			}
 		}
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF)
+		current_mpu_domain = mem_domain;
+		current_mpu_domain_generation = mem_domain->generation;
+		current_mpu_domain_region_num = unchanged_num + region_num;
+	} else {
+		current_mpu_domain = NULL;
+		current_mpu_domain_region_num = 0U;
+#endif
 	}
 	/* Thread user stack */
 	LOG_DBG("configure user thread %p's context", thread);
@@ -302,9 +339,15 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 #endif /* CONFIG_MPU_STACK_GUARD */
 
 	/* Configure the dynamic MPU regions */
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF)
+	arm_core_mpu_configure_dynamic_mpu_regions_diff(
+		(const struct k_mem_partition **)dynamic_regions,
+		region_num, unchanged_num);
+#else
 	arm_core_mpu_configure_dynamic_mpu_regions(
 		(const struct k_mem_partition **)dynamic_regions,
 		region_num);
+#endif
 }
 
 #if defined(CONFIG_USERSPACE)
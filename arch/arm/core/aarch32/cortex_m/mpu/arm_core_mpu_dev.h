@@ -187,6 +187,33 @@ void arm_core_mpu_mark_areas_for_dynamic_regions(
 void arm_core_mpu_configure_dynamic_mpu_regions(
 	const struct k_mem_partition *dynamic_regions[], uint8_t regions_num);
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF)
+/**
+ * @brief configure a set of dynamic MPU regions, rewriting only those
+ *        that differ from the currently programmed configuration
+ *
+ * Variant of arm_core_mpu_configure_dynamic_mpu_regions() for MPU
+ * architectures where dynamic regions occupy a fixed, sequential range
+ * of MPU indices. The driver diffs the supplied regions against a
+ * shadow copy of the last programmed configuration and skips the MPU
+ * register writes for unchanged regions.
+ *
+ * @param dynamic_regions[] an array of pointers to memory partitions
+ *                          to be programmed
+ * @param regions_num the number of regions to be programmed
+ * @param unchanged_num the number of leading dynamic region slots known
+ *                      by the caller to hold an up-to-date
+ *                      configuration; these are left untouched and
+ *                      regions are programmed after them
+ *
+ * The function shall assert if the operation cannot be not performed
+ * successfully.
+ */
+void arm_core_mpu_configure_dynamic_mpu_regions_diff(
+	const struct k_mem_partition *dynamic_regions[], uint8_t regions_num,
+	uint8_t unchanged_num);
+#endif /* CONFIG_MPU_DYNAMIC_REGION_DIFF */
+
 #if defined(CONFIG_USERSPACE)
 /**
  * @brief update configuration of an active memory partition
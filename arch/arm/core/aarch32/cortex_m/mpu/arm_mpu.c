@@ -8,6 +8,7 @@
 #include <init.h>
 #include <kernel.h>
 #include <soc.h>
+#include <string.h>
 #include "arm_core_mpu_dev.h"
 #include <linker/linker-defs.h>
 
@@ -154,6 +155,40 @@ static int mpu_configure_regions(const struct k_mem_partition
 }
 #endif
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF)
+/* Upper bound for the number of dynamic MPU regions; mirrors the
+ * _MAX_DYNAMIC_MPU_REGIONS_NUM sizing in arm_core_mpu.c.
+ */
+#if defined(CONFIG_USERSPACE)
+#define DYN_REGION_SHADOW_NUM (CONFIG_MAX_DOMAIN_PARTITIONS + 2)
+#else
+#define DYN_REGION_SHADOW_NUM 1
+#endif
+
+/* Shadow copy of the dynamic MPU region configuration most recently
+ * written to hardware, indexed by dynamic region slot (i.e. HW region
+ * index minus static_regions_num). Used to skip the MPU register
+ * writes for regions that a re-configuration leaves unchanged.
+ */
+static struct {
+	uint32_t base;
+	arm_mpu_region_attr_t attr;
+} dyn_region_shadow[DYN_REGION_SHADOW_NUM];
+static uint8_t dyn_region_shadow_num;
+
+/* Mark the shadow contents as unknown, forcing the next configuration
+ * to rewrite every region it supplies. The number of occupied region
+ * slots is kept, so leftover regions are still disabled correctly.
+ */
+static void dyn_region_shadow_invalidate(void)
+{
+	/* 0xff bytes can never match a real configuration: MPU region
+	 * base addresses have at least 32-byte alignment.
+	 */
+	(void)memset(dyn_region_shadow, 0xff, sizeof(dyn_region_shadow));
+}
+#endif /* CONFIG_MPU_DYNAMIC_REGION_DIFF */
+
 /* ARM Core MPU Driver API Implementation for ARM MPU */
 
 /**
@@ -223,6 +258,13 @@ void arm_core_mpu_mem_partition_config_update(
 	/* Modify the permissions */
 	partition->attr = *new_attr;
 	mpu_configure_region(reg_index, partition);
+
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF)
+	/* The region was modified behind the back of the diff-based
+	 * re-configuration path; do not trust the shadow any more.
+	 */
+	dyn_region_shadow_invalidate();
+#endif
 }
 
 /**
@@ -292,6 +334,66 @@ void arm_core_mpu_configure_dynamic_mpu_regions(const struct k_mem_partition
 	}
 }
 
+#if defined(CONFIG_MPU_DYNAMIC_REGION_DIFF)
+/**
+ * @brief configure dynamic MPU regions, rewriting only changed ones
+ */
+void arm_core_mpu_configure_dynamic_mpu_regions_diff(const struct k_mem_partition
+	*dynamic_regions[], uint8_t regions_num, uint8_t unchanged_num)
+{
+	int reg_index = static_regions_num + unchanged_num;
+	uint8_t slot;
+	int i;
+
+	__ASSERT(unchanged_num <= dyn_region_shadow_num,
+		"Caller claims %u unchanged regions, only %u programmed\n",
+		unchanged_num, dyn_region_shadow_num);
+	__ASSERT(unchanged_num + regions_num <= DYN_REGION_SHADOW_NUM,
+		"Out-of-bounds error for dynamic region shadow.\n");
+
+	for (i = 0; i < regions_num; i++) {
+		struct arm_mpu_region region_conf;
+
+		if (dynamic_regions[i]->size == 0U) {
+			continue;
+		}
+
+		region_conf.base = dynamic_regions[i]->start;
+		get_region_attr_from_k_mem_partition_info(&region_conf.attr,
+			&dynamic_regions[i]->attr, dynamic_regions[i]->start,
+			dynamic_regions[i]->size);
+
+		slot = reg_index - static_regions_num;
+		if ((slot >= dyn_region_shadow_num) ||
+		    (dyn_region_shadow[slot].base != region_conf.base) ||
+		    (dyn_region_shadow[slot].attr.rasr !=
+		     region_conf.attr.rasr)) {
+			if (region_allocate_and_init(reg_index,
+					&region_conf) == -EINVAL) {
+
+				__ASSERT(0,
+					"Configuring %u dynamic MPU regions failed\n",
+					regions_num);
+				return;
+			}
+			dyn_region_shadow[slot].base = region_conf.base;
+			dyn_region_shadow[slot].attr = region_conf.attr;
+		}
+		reg_index++;
+	}
+
+	/* Disable region slots the previous configuration occupied
+	 * beyond this one.
+	 */
+	for (i = reg_index;
+	     i < static_regions_num + dyn_region_shadow_num; i++) {
+		ARM_MPU_ClrRegion(i);
+	}
+
+	dyn_region_shadow_num = reg_index - static_regions_num;
+}
+#endif /* CONFIG_MPU_DYNAMIC_REGION_DIFF */
+
 /* ARM MPU Driver Initial Setup */
 
 /*
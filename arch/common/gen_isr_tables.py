@@ -120,6 +120,9 @@ def parse_args():
             help="Generate SW ISR table")
     parser.add_argument("-V", "--vector-table", action="store_true",
             help="Generate vector table")
+    parser.add_argument("-S", "--direct-stubs", action="store_true",
+            help="Generate direct dispatch stubs for regular interrupts "
+                 "and install them in the vector table")
     parser.add_argument("-i", "--intlist", required=True,
             help="Zephyr intlist binary for intList extraction")
 
@@ -141,11 +144,38 @@ source_header = """
 
 """
 
-def write_source_file(fp, vt, swt, intlist, syms):
+stub_header = """#include <irq.h>
+
+/* Direct dispatch stubs for regular interrupts.  The handler address
+ * and argument come from the first link pass and are embedded as
+ * immediates, so dispatching skips the _sw_isr_table loads entirely.
+ * The stubs live in their own section at the end of the ROM region so
+ * that adding them does not move any first-pass address.
+ */
+
+"""
+
+stub_template = """Z_GENERIC_SECTION(.isr_direct_stubs)
+void {0}(void)
+{{
+\tISR_DIRECT_HEADER();
+\tISR_DIRECT_PM();
+\t((void (*)(const void *)){1:#x})((const void *){2:#x});
+\tISR_DIRECT_FOOTER(1);
+}}
+
+"""
+
+def write_source_file(fp, vt, swt, intlist, syms, stubs):
     fp.write(source_header)
 
     nv = intlist["num_vectors"]
 
+    if stubs:
+        fp.write(stub_header)
+        for name, func, param in stubs:
+            fp.write(stub_template.format(name, func, param))
+
     if vt:
         fp.write("uint32_t __irq_vector_table _irq_vector_table[%d] = {\n" % nv)
         for i in range(nv):
@@ -232,6 +262,11 @@ def main():
     spurious_handler = "&z_irq_spurious"
     sw_irq_handler   = "ISR_WRAPPER"
 
+    if args.direct_stubs and not (args.vector_table and args.sw_isr_table):
+        error("--direct-stubs requires both -s and -V")
+
+    stubs = []
+
     debug('offset is ' + str(offset))
     debug('num_vectors is ' + str(nvec))
 
@@ -309,8 +344,17 @@ def main():
 
             swt[table_index] = (param, func)
 
+            if args.direct_stubs:
+                # Vector straight to a generated stub instead of the
+                # common table-indexing wrapper.  Multi-level setups
+                # are rejected by Kconfig: only first level interrupts
+                # have a vector of their own.
+                name = "z_isr_direct_stub_%d" % table_index
+                stubs.append((name, func, param))
+                vt[table_index] = "((uint32_t)&%s)" % name
+
     with open(args.output_source, "w") as fp:
-        write_source_file(fp, vt, swt, intlist, syms)
+        write_source_file(fp, vt, swt, intlist, syms, stubs)
 
 if __name__ == "__main__":
     main()
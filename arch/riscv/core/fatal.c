@@ -52,13 +52,27 @@ static char *cause_str(ulong_t cause)
 	}
 }
 
-FUNC_NORETURN void _Fault(const z_arch_esf_t *esf)
+void _Fault(z_arch_esf_t *esf)
 {
 	ulong_t mcause;
 
 	__asm__ volatile("csrr %0, mcause" : "=r" (mcause));
 
 	mcause &= SOC_MCAUSE_EXP_MASK;
+
+#ifdef CONFIG_RISCV_LAZY_FPU_SHARING
+	if ((mcause == 2) && ((esf->mstatus & MSTATUS_FS_MASK) == 0)) {
+		/* Illegal instruction with the FPU disabled: almost
+		 * certainly the thread's first floating-point
+		 * instruction. Hand the FPU over and retry it; a
+		 * genuinely illegal instruction traps again with the
+		 * FPU enabled and falls through to the fatal path.
+		 */
+		z_riscv_fpu_trap(esf);
+		return;
+	}
+#endif
+
 	LOG_ERR("Exception cause %s (%ld)", cause_str(mcause), mcause);
 
 	z_riscv_fatal_error(K_ERR_CPU_EXCEPTION, esf);
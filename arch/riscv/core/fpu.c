@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <kernel_structs.h>
+#include <kernel_arch_func.h>
+
+/*
+ * Lazy floating-point context management.
+ *
+ * Every thread starts with the FPU disabled (mstatus.FS == Off), and
+ * the context switch code never touches the FP register file. The
+ * first floating-point instruction a thread executes traps as an
+ * illegal instruction and lands here: the register file of the
+ * previous FPU user is spilled to its thread struct, the trapping
+ * thread's context is loaded, and the FPU is re-enabled for it alone.
+ * Threads that never touch floating point never pay for it.
+ *
+ * The FP registers are thus owned by at most one thread at a time,
+ * and a thread that lost the FPU has the FS bits cleared in its saved
+ * mstatus so that its next FP instruction traps and reclaims it.
+ */
+
+static struct k_thread *fpu_owner;
+
+#ifdef CONFIG_CPU_HAS_FPU_DOUBLE_PRECISION
+#define FPU_SAVE(n, fpu) \
+	__asm__ volatile("fsd f" #n ", %0" : "=m" ((fpu)->f[n]))
+#define FPU_LOAD(n, fpu) \
+	__asm__ volatile("fld f" #n ", %0" : : "m" ((fpu)->f[n]))
+#else
+#define FPU_SAVE(n, fpu) \
+	__asm__ volatile("fsw f" #n ", %0" : "=m" ((fpu)->f[n]))
+#define FPU_LOAD(n, fpu) \
+	__asm__ volatile("flw f" #n ", %0" : : "m" ((fpu)->f[n]))
+#endif
+
+static void fpu_save(struct z_riscv_fpu *fpu)
+{
+	uint32_t fcsr;
+
+	__asm__ volatile("frcsr %0" : "=r" (fcsr));
+	fpu->fcsr = fcsr;
+
+	FPU_SAVE(0, fpu);  FPU_SAVE(1, fpu);  FPU_SAVE(2, fpu);
+	FPU_SAVE(3, fpu);  FPU_SAVE(4, fpu);  FPU_SAVE(5, fpu);
+	FPU_SAVE(6, fpu);  FPU_SAVE(7, fpu);  FPU_SAVE(8, fpu);
+	FPU_SAVE(9, fpu);  FPU_SAVE(10, fpu); FPU_SAVE(11, fpu);
+	FPU_SAVE(12, fpu); FPU_SAVE(13, fpu); FPU_SAVE(14, fpu);
+	FPU_SAVE(15, fpu); FPU_SAVE(16, fpu); FPU_SAVE(17, fpu);
+	FPU_SAVE(18, fpu); FPU_SAVE(19, fpu); FPU_SAVE(20, fpu);
+	FPU_SAVE(21, fpu); FPU_SAVE(22, fpu); FPU_SAVE(23, fpu);
+	FPU_SAVE(24, fpu); FPU_SAVE(25, fpu); FPU_SAVE(26, fpu);
+	FPU_SAVE(27, fpu); FPU_SAVE(28, fpu); FPU_SAVE(29, fpu);
+	FPU_SAVE(30, fpu); FPU_SAVE(31, fpu);
+}
+
+static void fpu_load(struct z_riscv_fpu *fpu)
+{
+	FPU_LOAD(0, fpu);  FPU_LOAD(1, fpu);  FPU_LOAD(2, fpu);
+	FPU_LOAD(3, fpu);  FPU_LOAD(4, fpu);  FPU_LOAD(5, fpu);
+	FPU_LOAD(6, fpu);  FPU_LOAD(7, fpu);  FPU_LOAD(8, fpu);
+	FPU_LOAD(9, fpu);  FPU_LOAD(10, fpu); FPU_LOAD(11, fpu);
+	FPU_LOAD(12, fpu); FPU_LOAD(13, fpu); FPU_LOAD(14, fpu);
+	FPU_LOAD(15, fpu); FPU_LOAD(16, fpu); FPU_LOAD(17, fpu);
+	FPU_LOAD(18, fpu); FPU_LOAD(19, fpu); FPU_LOAD(20, fpu);
+	FPU_LOAD(21, fpu); FPU_LOAD(22, fpu); FPU_LOAD(23, fpu);
+	FPU_LOAD(24, fpu); FPU_LOAD(25, fpu); FPU_LOAD(26, fpu);
+	FPU_LOAD(27, fpu); FPU_LOAD(28, fpu); FPU_LOAD(29, fpu);
+	FPU_LOAD(30, fpu); FPU_LOAD(31, fpu);
+
+	__asm__ volatile("fscsr x0, %0" : : "r" (fpu->fcsr));
+}
+
+void z_riscv_fpu_trap(z_arch_esf_t *esf)
+{
+	/* ISRs run with the FPU disabled and must not use it. */
+	if (_current_cpu->nested != 0U) {
+		z_riscv_fatal_error(K_ERR_CPU_EXCEPTION, esf);
+	}
+
+	/* Enable the FPU so the old context can be spilled and the new
+	 * one loaded. Machine interrupts are masked in trap context,
+	 * so the hand-over is atomic.
+	 */
+	__asm__ volatile("csrrs x0, mstatus, %0"
+			 : : "r" (MSTATUS_FS_INIT));
+
+	if ((fpu_owner != NULL) && (fpu_owner != _current) &&
+	    (fpu_owner->base.thread_state & _THREAD_DEAD) == 0U) {
+		fpu_save(&fpu_owner->arch.fpu);
+
+		/* The previous owner is switched out (a running owner
+		 * has FS enabled and never traps), so its saved
+		 * mstatus is in the exception frame its stack pointer
+		 * points at. Clear the FS bits there: its next FP
+		 * instruction must trap and reclaim the FPU.
+		 */
+		((z_arch_esf_t *)fpu_owner->callee_saved.sp)->mstatus &=
+			~MSTATUS_FS_MASK;
+	}
+
+	fpu_owner = _current;
+	fpu_load(&_current->arch.fpu);
+
+	/* Re-run the trapping instruction with the FPU enabled */
+	esf->mstatus = (esf->mstatus & ~MSTATUS_FS_MASK) | MSTATUS_FS_INIT;
+}
+
+void z_riscv_fpu_disown(struct k_thread *thread)
+{
+	if (thread == fpu_owner) {
+		fpu_owner = NULL;
+	}
+}
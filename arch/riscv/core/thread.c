@@ -6,6 +6,7 @@
 
 #include <kernel.h>
 #include <ksched.h>
+#include <string.h>
 
 void z_thread_entry_wrapper(k_thread_entry_t thread,
 			    void *arg1,
@@ -55,9 +56,16 @@ void arch_new_thread(struct k_thread *thread, k_thread_stack_t *stack,
 	 */
 	stack_init->mstatus = MSTATUS_DEF_RESTORE;
 #if defined(CONFIG_FPU) && defined(CONFIG_FPU_SHARING)
+#ifdef CONFIG_RISCV_LAZY_FPU_SHARING
+	/* The FPU stays disabled until the thread's first FP
+	 * instruction traps and loads this context.
+	 */
+	(void)memset(&thread->arch.fpu, 0, sizeof(thread->arch.fpu));
+#else
 	if ((thread->base.user_options & K_FP_REGS) != 0) {
 		stack_init->mstatus |= MSTATUS_FS_INIT;
 	}
+#endif
 	stack_init->fp_state = 0;
 #endif
 	stack_init->mepc = (ulong_t)z_thread_entry_wrapper;
@@ -88,6 +96,11 @@ int arch_float_disable(struct k_thread *thread)
 	/* Disable all floating point capabilities for the thread */
 	thread->base.user_options &= ~K_FP_REGS;
 
+#ifdef CONFIG_RISCV_LAZY_FPU_SHARING
+	/* Release FPU ownership; the stale context is discarded. */
+	z_riscv_fpu_disown(thread);
+#endif
+
 	/* Clear the FS bits to disable the FPU. */
 	__asm__ volatile (
 		"mv t0, %0\n"
@@ -120,13 +133,18 @@ int arch_float_enable(struct k_thread *thread)
 	/* Enable all floating point capabilities for the thread. */
 	thread->base.user_options |= K_FP_REGS;
 
-	/* Set the FS bits to Initial to enable the FPU. */
+#ifndef CONFIG_RISCV_LAZY_FPU_SHARING
+	/* Set the FS bits to Initial to enable the FPU. With lazy FPU
+	 * sharing the FPU must stay disabled until the first FP
+	 * instruction traps and performs the context hand-over.
+	 */
 	__asm__ volatile (
 		"mv t0, %0\n"
 		"csrrs x0, mstatus, t0\n"
 		:
 		: "r" (MSTATUS_FS_INIT)
 		);
+#endif
 
 	irq_unlock(key);
 
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief d-cache maintenance for Xtensa CPUs
+ *
+ * Implements the range-based d-cache operations on top of the Xtensa
+ * HAL region primitives; cores configured without a d-cache get
+ * no-ops from the HAL.
+ */
+
+#include <kernel.h>
+#include <cache.h>
+#include <xtensa/hal.h>
+
+void arch_dcache_flush(void *addr, size_t size)
+{
+	xthal_dcache_region_writeback(addr, size);
+}
+
+void arch_dcache_invd(void *addr, size_t size)
+{
+	xthal_dcache_region_invalidate(addr, size);
+}
+
+void arch_dcache_range(void *addr, size_t size, int op)
+{
+	if (op == SYS_CACHE_OP_CLEAN_INVD) {
+		xthal_dcache_region_writeback_inv(addr, size);
+	} else if ((op & SYS_CACHE_OP_CLEAN) != 0) {
+		xthal_dcache_region_writeback(addr, size);
+	} else if ((op & SYS_CACHE_OP_INVD) != 0) {
+		xthal_dcache_region_invalidate(addr, size);
+	}
+}
@@ -212,6 +212,14 @@ struct adc_stm32_data {
 #if defined(CONFIG_SOC_SERIES_STM32F0X) || defined(CONFIG_SOC_SERIES_STM32L0X)
 	int8_t acq_time_index;
 #endif
+
+#ifdef CONFIG_ADC_STREAM
+	/* Non-NULL while a continuous sampling stream is active. */
+	const struct adc_stream *stream;
+	uint16_t *stream_buffer;
+	size_t stream_count;
+	size_t stream_half;
+#endif
 };
 
 struct adc_stm32_cfg {
@@ -263,48 +271,41 @@ static void adc_stm32_start_conversion(const struct device *dev)
 #endif
 }
 
-static int start_read(const struct device *dev,
-		      const struct adc_sequence *sequence)
+static int adc_stm32_res_to_ll(uint8_t resolution, uint32_t *ll_resolution)
 {
-	const struct adc_stm32_cfg *config = dev->config;
-	struct adc_stm32_data *data = dev->data;
-	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
-	uint8_t resolution;
-	int err;
-
-	switch (sequence->resolution) {
+	switch (resolution) {
 #if defined(CONFIG_SOC_SERIES_STM32F1X)
 	case 12:
-		resolution = table_resolution[0];
+		*ll_resolution = table_resolution[0];
 		break;
 #elif !defined(CONFIG_SOC_SERIES_STM32H7X)
 	case 6:
-		resolution = table_resolution[0];
+		*ll_resolution = table_resolution[0];
 		break;
 	case 8:
-		resolution = table_resolution[1];
+		*ll_resolution = table_resolution[1];
 		break;
 	case 10:
-		resolution = table_resolution[2];
+		*ll_resolution = table_resolution[2];
 		break;
 	case 12:
-		resolution = table_resolution[3];
+		*ll_resolution = table_resolution[3];
 		break;
 #else
 	case 8:
-		resolution = table_resolution[0];
+		*ll_resolution = table_resolution[0];
 		break;
 	case 10:
-		resolution = table_resolution[1];
+		*ll_resolution = table_resolution[1];
 		break;
 	case 12:
-		resolution = table_resolution[2];
+		*ll_resolution = table_resolution[2];
 		break;
 	case 14:
-		resolution = table_resolution[3];
+		*ll_resolution = table_resolution[3];
 		break;
 	case 16:
-		resolution = table_resolution[4];
+		*ll_resolution = table_resolution[4];
 		break;
 #endif
 	default:
@@ -312,9 +313,50 @@ static int start_read(const struct device *dev,
 		return -EINVAL;
 	}
 
-	uint32_t channels = sequence->channels;
+	return 0;
+}
 
-	data->buffer = sequence->buffer;
+static void adc_stm32_enable_eoc_it(ADC_TypeDef *adc)
+{
+#if defined(CONFIG_SOC_SERIES_STM32F0X) || \
+	defined(CONFIG_SOC_SERIES_STM32F3X) || \
+	defined(CONFIG_SOC_SERIES_STM32L0X) || \
+	defined(CONFIG_SOC_SERIES_STM32L4X) || \
+	defined(CONFIG_SOC_SERIES_STM32WBX) || \
+	defined(CONFIG_SOC_SERIES_STM32G4X) || \
+	defined(CONFIG_SOC_SERIES_STM32H7X)
+	LL_ADC_EnableIT_EOC(adc);
+#elif defined(CONFIG_SOC_SERIES_STM32F1X)
+	LL_ADC_EnableIT_EOS(adc);
+#else
+	LL_ADC_EnableIT_EOCS(adc);
+#endif
+}
+
+#ifdef CONFIG_ADC_STREAM
+static void adc_stm32_disable_eoc_it(ADC_TypeDef *adc)
+{
+#if defined(CONFIG_SOC_SERIES_STM32F0X) || \
+	defined(CONFIG_SOC_SERIES_STM32F3X) || \
+	defined(CONFIG_SOC_SERIES_STM32L0X) || \
+	defined(CONFIG_SOC_SERIES_STM32L4X) || \
+	defined(CONFIG_SOC_SERIES_STM32WBX) || \
+	defined(CONFIG_SOC_SERIES_STM32G4X) || \
+	defined(CONFIG_SOC_SERIES_STM32H7X)
+	LL_ADC_DisableIT_EOC(adc);
+#elif defined(CONFIG_SOC_SERIES_STM32F1X)
+	LL_ADC_DisableIT_EOS(adc);
+#else
+	LL_ADC_DisableIT_EOCS(adc);
+#endif
+}
+#endif /* CONFIG_ADC_STREAM */
+
+static void adc_stm32_setup_sequencer(const struct device *dev,
+				      uint32_t channels)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
 	uint8_t index;
 
 	index = find_lsb_set(channels) - 1;
@@ -335,6 +377,25 @@ static int start_read(const struct device *dev,
 	LL_ADC_REG_SetSequencerRanks(adc, table_rank[0], channel);
 	LL_ADC_REG_SetSequencerLength(adc, table_seq_len[0]);
 #endif
+}
+
+static int start_read(const struct device *dev,
+		      const struct adc_sequence *sequence)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+	uint32_t resolution;
+	int err;
+
+	err = adc_stm32_res_to_ll(sequence->resolution, &resolution);
+	if (err) {
+		return err;
+	}
+
+	data->buffer = sequence->buffer;
+
+	adc_stm32_setup_sequencer(dev, channels);
 	data->channel_count = 1;
 
 	err = check_buffer_size(sequence, data->channel_count);
@@ -346,19 +407,7 @@ static int start_read(const struct device *dev,
 	LL_ADC_SetResolution(adc, resolution);
 #endif
 
-#if defined(CONFIG_SOC_SERIES_STM32F0X) || \
-	defined(CONFIG_SOC_SERIES_STM32F3X) || \
-	defined(CONFIG_SOC_SERIES_STM32L0X) || \
-	defined(CONFIG_SOC_SERIES_STM32L4X) || \
-	defined(CONFIG_SOC_SERIES_STM32WBX) || \
-	defined(CONFIG_SOC_SERIES_STM32G4X) || \
-	defined(CONFIG_SOC_SERIES_STM32H7X)
-	LL_ADC_EnableIT_EOC(adc);
-#elif defined(CONFIG_SOC_SERIES_STM32F1X)
-	LL_ADC_EnableIT_EOS(adc);
-#else
-	LL_ADC_EnableIT_EOCS(adc);
-#endif
+	adc_stm32_enable_eoc_it(adc);
 
 	adc_context_start_read(&data->ctx, sequence);
 
@@ -393,6 +442,35 @@ static void adc_stm32_isr(const struct device *dev)
 		(const struct adc_stm32_cfg *)dev->config;
 	ADC_TypeDef *adc = config->base;
 
+#ifdef CONFIG_ADC_STREAM
+	if (data->stream != NULL) {
+		data->stream_buffer[data->stream_count++] =
+			LL_ADC_REG_ReadConversionData32(adc);
+
+		if (data->stream_count == data->stream_half) {
+			uint16_t *filled = data->stream_buffer;
+
+			/*
+			 * Hand the filled half to the application and let
+			 * the hardware continue in the other one. The
+			 * conversions keep running on their own; only the
+			 * write pointer needs to be swapped here.
+			 */
+			if (filled == (uint16_t *)data->stream->buffer) {
+				data->stream_buffer = filled +
+						      data->stream_half;
+			} else {
+				data->stream_buffer = data->stream->buffer;
+			}
+			data->stream_count = 0;
+
+			data->stream->callback(dev, data->stream, filled);
+		}
+
+		return;
+	}
+#endif /* CONFIG_ADC_STREAM */
+
 	*data->buffer++ = LL_ADC_REG_ReadConversionData32(adc);
 
 	adc_context_on_sampling_done(&data->ctx, dev);
@@ -429,6 +507,88 @@ static int adc_stm32_read_async(const struct device *dev,
 }
 #endif
 
+#ifdef CONFIG_ADC_STREAM
+static int adc_stm32_stream_start(const struct device *dev,
+				  const struct adc_stream *stream)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+	size_t half_samples;
+	uint32_t resolution;
+	int err;
+
+	if (stream->callback == NULL) {
+		return -EINVAL;
+	}
+
+	/* The buffer is used as two ping-pong halves. */
+	half_samples = stream->buffer_size / (2 * sizeof(uint16_t));
+	if (half_samples == 0) {
+		LOG_ERR("Provided buffer cannot hold two samplings");
+		return -ENOMEM;
+	}
+
+	err = adc_stm32_res_to_ll(stream->resolution, &resolution);
+	if (err) {
+		return err;
+	}
+
+	/* Hold off one-shot reads until the stream is stopped. */
+	adc_context_lock(&data->ctx, false, NULL);
+
+	adc_stm32_setup_sequencer(dev, stream->channels);
+
+#if !defined(CONFIG_SOC_SERIES_STM32F1X)
+	LL_ADC_SetResolution(adc, resolution);
+#endif
+
+	data->stream = stream;
+	data->stream_buffer = stream->buffer;
+	data->stream_count = 0;
+	data->stream_half = half_samples;
+
+	/*
+	 * In continuous mode the hardware retriggers itself after each
+	 * conversion, so apart from swapping the buffer halves in the ISR
+	 * no software intervention is needed to keep the stream running.
+	 */
+	LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_CONTINUOUS);
+
+	adc_stm32_enable_eoc_it(adc);
+
+	adc_stm32_start_conversion(dev);
+
+	return 0;
+}
+
+static int adc_stm32_stream_stop(const struct device *dev)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+
+	if (data->stream == NULL) {
+		return -EINVAL;
+	}
+
+	adc_stm32_disable_eoc_it(adc);
+
+	/*
+	 * Leaving continuous mode stops the hardware after the conversion
+	 * currently in progress; its result is discarded, as the
+	 * end-of-conversion interrupt is already masked at that point.
+	 */
+	LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_SINGLE);
+
+	data->stream = NULL;
+
+	adc_context_release(&data->ctx, 0);
+
+	return 0;
+}
+#endif /* CONFIG_ADC_STREAM */
+
 static int adc_stm32_check_acq_time(uint16_t acq_time)
 {
 	for (int i = 0; i < 8; i++) {
@@ -704,6 +864,10 @@ static const struct adc_driver_api api_stm32_driver_api = {
 #ifdef CONFIG_ADC_ASYNC
 	.read_async = adc_stm32_read_async,
 #endif
+#ifdef CONFIG_ADC_STREAM
+	.stream_start = adc_stm32_stream_start,
+	.stream_stop = adc_stm32_stream_stop,
+#endif
 };
 
 #define STM32_ADC_INIT(index)						\
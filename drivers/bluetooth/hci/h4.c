@@ -18,6 +18,10 @@
 #include <sys/byteorder.h>
 #include <string.h>
 
+#ifdef CONFIG_BT_H4_ASYNC
+#include <sys/ring_buffer.h>
+#endif
+
 #include <bluetooth/bluetooth.h>
 #include <bluetooth/hci.h>
 #include <drivers/bluetooth/hci_driver.h>
@@ -71,6 +75,7 @@ static struct {
 
 static const struct device *h4_dev;
 
+#ifndef CONFIG_BT_H4_ASYNC
 static inline void h4_get_type(void)
 {
 	/* Get packet type */
@@ -164,6 +169,7 @@ static inline void get_evt_hdr(void)
 		rx.have_hdr = true;
 	}
 }
+#endif /* !CONFIG_BT_H4_ASYNC */
 
 
 static inline void copy_hdr(struct net_buf *buf)
@@ -198,6 +204,7 @@ static struct net_buf *get_rx(k_timeout_t timeout)
 	return NULL;
 }
 
+#ifndef CONFIG_BT_H4_ASYNC
 static void rx_thread(void *p1, void *p2, void *p3)
 {
 	struct net_buf *buf;
@@ -459,6 +466,377 @@ static int h4_send(struct net_buf *buf)
 	return 0;
 }
 
+#else /* CONFIG_BT_H4_ASYNC */
+
+/* The UART asynchronous (DMA) transport: received data is delivered in
+ * chunks into two rotating DMA buffers, the event handler feeds a ring
+ * buffer and wakes the RX thread, which parses packet boundaries in
+ * batches instead of per byte in interrupt context.
+ */
+
+static uint8_t rx_dma_buf[2][CONFIG_BT_H4_ASYNC_RX_BUF_SIZE];
+static uint8_t rx_ring_data[CONFIG_BT_H4_ASYNC_RX_RING_SIZE];
+static struct ring_buf rx_ring;
+static struct k_sem rx_ring_sem;
+static uint8_t rx_dma_next;
+static bool rx_paused;
+
+static int h4_async_rx_enable(void)
+{
+	rx_dma_next = 1U;
+
+	return uart_rx_enable(h4_dev, rx_dma_buf[0], sizeof(rx_dma_buf[0]),
+			      CONFIG_BT_H4_ASYNC_RX_TIMEOUT);
+}
+
+static void h4_async_tx_start(void)
+{
+	int err;
+
+	if (!tx.buf) {
+		tx.buf = net_buf_get(&tx.fifo, K_NO_WAIT);
+		if (!tx.buf) {
+			return;
+		}
+
+		switch (bt_buf_get_type(tx.buf)) {
+		case BT_BUF_ACL_OUT:
+			tx.type = H4_ACL;
+			break;
+		case BT_BUF_CMD:
+			tx.type = H4_CMD;
+			break;
+		case BT_BUF_ISO_OUT:
+			if (IS_ENABLED(CONFIG_BT_ISO)) {
+				tx.type = H4_ISO;
+				break;
+			}
+			__fallthrough;
+		default:
+			BT_ERR("Unknown buffer type");
+			net_buf_unref(tx.buf);
+			tx.buf = NULL;
+			return;
+		}
+
+		if (net_buf_headroom(tx.buf) >= 1) {
+			/* Prepend the H:4 type so the whole packet goes
+			 * out in a single transfer.
+			 */
+			net_buf_push_u8(tx.buf, tx.type);
+			tx.type = H4_NONE;
+		}
+	}
+
+	if (tx.type != H4_NONE) {
+		/* No headroom for the type byte: send it separately */
+		err = uart_tx(h4_dev, &tx.type, 1, SYS_FOREVER_MS);
+	} else {
+		err = uart_tx(h4_dev, tx.buf->data, tx.buf->len,
+			      SYS_FOREVER_MS);
+	}
+
+	if (err) {
+		BT_ERR("Unable to start TX (err %d)", err);
+		tx.type = H4_NONE;
+		net_buf_unref(tx.buf);
+		tx.buf = NULL;
+	}
+}
+
+static void h4_async_tx_done(void)
+{
+	if (!tx.buf) {
+		return;
+	}
+
+	if (tx.type != H4_NONE) {
+		/* Type byte went out, the payload is next */
+		tx.type = H4_NONE;
+	} else {
+		net_buf_unref(tx.buf);
+		tx.buf = NULL;
+	}
+
+	h4_async_tx_start();
+}
+
+static void h4_async_rx_rdy(struct uart_event_rx *rx_evt)
+{
+	uint32_t put;
+
+	put = ring_buf_put(&rx_ring, rx_evt->buf + rx_evt->offset,
+			   rx_evt->len);
+	if (put < rx_evt->len) {
+		BT_ERR("RX ring buffer overflow (%u bytes lost)",
+		       rx_evt->len - put);
+	}
+
+	/* Pause reception before the ring can overflow; the RX thread
+	 * resumes it once the ring has been drained.
+	 */
+	if (!rx_paused &&
+	    (ring_buf_space_get(&rx_ring) < 2 * sizeof(rx_dma_buf[0]))) {
+		rx_paused = true;
+		uart_rx_disable(h4_dev);
+	}
+
+	k_sem_give(&rx_ring_sem);
+}
+
+static void h4_async_uart_cb(const struct device *dev, struct uart_event *evt,
+			     void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		h4_async_tx_done();
+		break;
+	case UART_TX_ABORTED:
+		BT_ERR("TX aborted");
+		h4_async_tx_done();
+		break;
+	case UART_RX_RDY:
+		h4_async_rx_rdy(&evt->data.rx);
+		break;
+	case UART_RX_BUF_REQUEST:
+		uart_rx_buf_rsp(dev, rx_dma_buf[rx_dma_next],
+				sizeof(rx_dma_buf[0]));
+		rx_dma_next ^= 1U;
+		break;
+	case UART_RX_DISABLED:
+		if (!rx_paused) {
+			/* Not paused by us: restart reception */
+			h4_async_rx_enable();
+		}
+		break;
+	case UART_RX_STOPPED:
+		BT_ERR("RX stopped (reason %d)", evt->data.rx_stop.reason);
+		break;
+	default:
+		break;
+	}
+}
+
+/* Parse as many complete packets as the ring buffer holds. Returns when
+ * more data is needed.
+ */
+static void h4_async_process(void)
+{
+	struct net_buf *buf;
+	uint8_t evt_flags;
+	uint8_t *data;
+	uint32_t got;
+
+	for (;;) {
+		if (rx.discard) {
+			got = ring_buf_get_claim(&rx_ring, &data, rx.discard);
+			if (!got) {
+				break;
+			}
+
+			ring_buf_get_finish(&rx_ring, got);
+			rx.discard -= got;
+			continue;
+		}
+
+		if (rx.type == H4_NONE) {
+			if (ring_buf_get(&rx_ring, &rx.type, 1) != 1) {
+				break;
+			}
+
+			switch (rx.type) {
+			case H4_EVT:
+				rx.remaining = sizeof(rx.evt);
+				rx.hdr_len = rx.remaining;
+				break;
+			case H4_ACL:
+				rx.remaining = sizeof(rx.acl);
+				rx.hdr_len = rx.remaining;
+				break;
+			case H4_ISO:
+				if (IS_ENABLED(CONFIG_BT_ISO)) {
+					rx.remaining = sizeof(rx.iso);
+					rx.hdr_len = rx.remaining;
+					break;
+				}
+				__fallthrough;
+			default:
+				BT_ERR("Unknown H:4 type 0x%02x", rx.type);
+				rx.type = H4_NONE;
+			}
+
+			continue;
+		}
+
+		if (!rx.have_hdr) {
+			got = ring_buf_get(&rx_ring,
+					   &rx.hdr[rx.hdr_len - rx.remaining],
+					   rx.remaining);
+			rx.remaining -= got;
+			if (rx.remaining) {
+				break;
+			}
+
+			if (rx.type == H4_EVT &&
+			    rx.hdr_len == sizeof(rx.evt)) {
+				if (rx.evt.evt == BT_HCI_EVT_LE_META_EVENT) {
+					/* The subevent code decides
+					 * discardability
+					 */
+					rx.remaining = 1U;
+					rx.hdr_len++;
+					continue;
+				}
+#if defined(CONFIG_BT_BREDR)
+				if (rx.evt.evt ==
+					BT_HCI_EVT_INQUIRY_RESULT_WITH_RSSI ||
+				    rx.evt.evt ==
+					BT_HCI_EVT_EXTENDED_INQUIRY_RESULT) {
+					rx.discardable = true;
+				}
+#endif
+			}
+
+			switch (rx.type) {
+			case H4_EVT:
+				if (rx.evt.evt == BT_HCI_EVT_LE_META_EVENT &&
+				    rx.hdr[sizeof(rx.evt)] ==
+					BT_HCI_EVT_LE_ADVERTISING_REPORT) {
+					BT_DBG("Marking adv report as discardable");
+					rx.discardable = true;
+				}
+
+				rx.remaining = rx.evt.len -
+					       (rx.hdr_len - sizeof(rx.evt));
+				break;
+			case H4_ACL:
+				rx.remaining = sys_le16_to_cpu(rx.acl.len);
+				break;
+			case H4_ISO:
+				rx.remaining = sys_le16_to_cpu(rx.iso.len);
+				break;
+			}
+
+			BT_DBG("Got header. Payload %u bytes", rx.remaining);
+			rx.have_hdr = true;
+
+			rx.buf = get_rx(rx.discardable ? K_NO_WAIT : K_FOREVER);
+			if (!rx.buf) {
+				BT_WARN("Discarding event 0x%02x", rx.evt.evt);
+				rx.discard = rx.remaining;
+				reset_rx();
+				continue;
+			}
+
+			if (rx.remaining > net_buf_tailroom(rx.buf)) {
+				BT_ERR("Not enough space in buffer");
+				net_buf_unref(rx.buf);
+				rx.buf = NULL;
+				rx.discard = rx.remaining;
+				reset_rx();
+				continue;
+			}
+
+			copy_hdr(rx.buf);
+			continue;
+		}
+
+		if (rx.remaining) {
+			got = ring_buf_get(&rx_ring, net_buf_tail(rx.buf),
+					   rx.remaining);
+			if (!got) {
+				break;
+			}
+
+			net_buf_add(rx.buf, got);
+			rx.remaining -= got;
+			if (rx.remaining) {
+				break;
+			}
+		}
+
+		buf = rx.buf;
+		rx.buf = NULL;
+
+		if (rx.type == H4_EVT) {
+			evt_flags = bt_hci_evt_get_flags(rx.evt.evt);
+			bt_buf_set_type(buf, BT_BUF_EVT);
+		} else {
+			evt_flags = BT_HCI_EVT_FLAG_RECV;
+			bt_buf_set_type(buf, BT_BUF_ACL_IN);
+		}
+
+		reset_rx();
+
+		if (evt_flags & BT_HCI_EVT_FLAG_RECV_PRIO) {
+			BT_DBG("Calling bt_recv_prio(%p)", buf);
+			bt_recv_prio(buf);
+		}
+
+		if (evt_flags & BT_HCI_EVT_FLAG_RECV) {
+			BT_DBG("Calling bt_recv(%p)", buf);
+			bt_recv(buf);
+
+			/* Give other threads a chance to run between
+			 * packets under sustained traffic.
+			 */
+			k_yield();
+		}
+	}
+}
+
+static void rx_thread(void *p1, void *p2, void *p3)
+{
+	bool resume;
+	unsigned int key;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	BT_DBG("started");
+
+	while (1) {
+		k_sem_take(&rx_ring_sem, K_FOREVER);
+
+		h4_async_process();
+
+		resume = false;
+		key = irq_lock();
+		if (rx_paused && (ring_buf_space_get(&rx_ring) >
+				  sizeof(rx_ring_data) / 2)) {
+			rx_paused = false;
+			resume = true;
+		}
+		irq_unlock(key);
+
+		if (resume) {
+			h4_async_rx_enable();
+		}
+	}
+}
+
+static int h4_send(struct net_buf *buf)
+{
+	unsigned int key;
+
+	BT_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
+
+	net_buf_put(&tx.fifo, buf);
+
+	key = irq_lock();
+	if (!tx.buf) {
+		h4_async_tx_start();
+	}
+	irq_unlock(key);
+
+	return 0;
+}
+
+#endif /* CONFIG_BT_H4_ASYNC */
+
 /** Setup the HCI transport, which usually means to reset the Bluetooth IC
   *
   * @param dev The device structure for the bus connecting to the IC
@@ -467,7 +845,9 @@ static int h4_send(struct net_buf *buf)
   */
 int __weak bt_hci_transport_setup(const struct device *dev)
 {
+#ifndef CONFIG_BT_H4_ASYNC
 	h4_discard(h4_dev, 32);
+#endif
 	return 0;
 }
 
@@ -477,15 +857,32 @@ static int h4_open(void)
 
 	BT_DBG("");
 
+#ifndef CONFIG_BT_H4_ASYNC
 	uart_irq_rx_disable(h4_dev);
 	uart_irq_tx_disable(h4_dev);
+#endif
 
 	ret = bt_hci_transport_setup(h4_dev);
 	if (ret < 0) {
 		return -EIO;
 	}
 
+#ifdef CONFIG_BT_H4_ASYNC
+	ring_buf_init(&rx_ring, sizeof(rx_ring_data), rx_ring_data);
+	k_sem_init(&rx_ring_sem, 0, 1);
+
+	ret = uart_callback_set(h4_dev, h4_async_uart_cb, NULL);
+	if (ret < 0) {
+		return -EIO;
+	}
+
+	ret = h4_async_rx_enable();
+	if (ret < 0) {
+		return -EIO;
+	}
+#else
 	uart_irq_callback_set(h4_dev, bt_uart_isr);
+#endif
 
 	k_thread_create(&rx_thread_data, rx_thread_stack,
 			K_KERNEL_STACK_SIZEOF(rx_thread_stack),
@@ -486,6 +486,15 @@ static int mcp2515_send(const struct device *dev,
 	return 0;
 }
 
+static void mcp2515_filter_cache_flush(struct mcp2515_data *dev_data)
+{
+	int i;
+
+	for (i = 0; i < MCP2515_FILTER_CACHE_CNT; i++) {
+		dev_data->filter_cache[i].valid = 0U;
+	}
+}
+
 static int mcp2515_attach_isr(const struct device *dev,
 			      can_rx_callback_t rx_cb,
 			      void *cb_arg,
@@ -512,6 +521,7 @@ static int mcp2515_attach_isr(const struct device *dev,
 		dev_data->rx_cb[filter_idx] = rx_cb;
 		dev_data->cb_arg[filter_idx] = cb_arg;
 
+		mcp2515_filter_cache_flush(dev_data);
 	} else {
 		filter_idx = CAN_NO_FREE_FILTER;
 	}
@@ -527,6 +537,7 @@ static void mcp2515_detach(const struct device *dev, int filter_nr)
 
 	k_mutex_lock(&dev_data->mutex, K_FOREVER);
 	dev_data->filter_usage &= ~BIT(filter_nr);
+	mcp2515_filter_cache_flush(dev_data);
 	k_mutex_unlock(&dev_data->mutex);
 }
 
@@ -566,20 +577,52 @@ static void mcp2515_rx_filter(const struct device *dev,
 			      struct zcan_frame *msg)
 {
 	struct mcp2515_data *dev_data = DEV_DATA(dev);
+	struct mcp2515_filter_cache *cache;
 	uint8_t filter_idx = 0U;
 	can_rx_callback_t callback;
 	struct zcan_frame tmp_msg;
+	uint32_t match_map;
+	uint32_t id;
+
+	id = msg->id_type == CAN_STANDARD_IDENTIFIER ? msg->std_id :
+						       msg->ext_id;
 
 	k_mutex_lock(&dev_data->mutex, K_FOREVER);
 
-	for (; filter_idx < CONFIG_CAN_MCP2515_MAX_FILTER; filter_idx++) {
-		if (!(BIT(filter_idx) & dev_data->filter_usage)) {
-			continue; /* filter slot empty */
+	cache = &dev_data->filter_cache[(id ^ (id >> 8)) %
+					MCP2515_FILTER_CACHE_CNT];
+
+	if (cache->valid && cache->id == id &&
+	    cache->id_type == msg->id_type && cache->rtr == msg->rtr) {
+		match_map = cache->match_map;
+	} else {
+		match_map = 0U;
+
+		for (; filter_idx < CONFIG_CAN_MCP2515_MAX_FILTER;
+		     filter_idx++) {
+			if (!(BIT(filter_idx) & dev_data->filter_usage)) {
+				continue; /* filter slot empty */
+			}
+
+			if (!mcp2515_filter_match(
+					msg, &dev_data->filter[filter_idx])) {
+				continue; /* filter did not match */
+			}
+
+			match_map |= BIT(filter_idx);
 		}
 
-		if (!mcp2515_filter_match(msg,
-					  &dev_data->filter[filter_idx])) {
-			continue; /* filter did not match */
+		cache->id = id;
+		cache->id_type = msg->id_type;
+		cache->rtr = msg->rtr;
+		cache->match_map = match_map;
+		cache->valid = 1U;
+	}
+
+	for (filter_idx = 0U; match_map != 0U;
+	     filter_idx++, match_map >>= 1) {
+		if (!(match_map & 1U)) {
+			continue;
 		}
 
 		callback = dev_data->rx_cb[filter_idx];
@@ -13,6 +13,7 @@
 #define MCP2515_RX_CNT                   2
 #define MCP2515_TX_CNT                   3
 #define MCP2515_FRAME_LEN               13
+#define MCP2515_FILTER_CACHE_CNT         8
 
 #define DEV_CFG(dev) \
 	((const struct mcp2515_config *const)(dev)->config)
@@ -51,6 +52,19 @@ struct mcp2515_data {
 	struct zcan_filter filter[CONFIG_CAN_MCP2515_MAX_FILTER];
 	can_state_change_isr_t state_change_isr;
 
+	/* Direct mapped cache of recent filter match results, keyed on
+	 * the received CAN ID, so that repeating IDs are dispatched
+	 * without a linear scan over the attached filters. Entries are
+	 * invalidated whenever a filter is attached or detached.
+	 */
+	struct mcp2515_filter_cache {
+		uint32_t id;
+		uint32_t match_map;
+		uint8_t id_type;
+		uint8_t rtr;
+		uint8_t valid;
+	} filter_cache[MCP2515_FILTER_CACHE_CNT];
+
 	/* general data */
 	struct k_mutex mutex;
 	enum can_state old_state;
@@ -62,37 +62,51 @@ static void can_stm32_get_msg_fifo(CAN_FIFOMailBox_TypeDef *mbox,
 #endif
 }
 
-static inline
-void can_stm32_rx_isr_handler(CAN_TypeDef *can, struct can_stm32_data *data)
+static inline void can_stm32_rx_fifo_pop(CAN_FIFOMailBox_TypeDef *mbox,
+					 struct can_stm32_data *data)
 {
-	CAN_FIFOMailBox_TypeDef *mbox;
 	int filter_match_index;
 	struct zcan_frame msg;
 	can_rx_callback_t callback;
 
-	while (can->RF0R & CAN_RF0R_FMP0) {
-		mbox = &can->sFIFOMailBox[0];
-		filter_match_index = ((mbox->RDTR & CAN_RDT0R_FMI)
-					   >> CAN_RDT0R_FMI_Pos);
+	filter_match_index = ((mbox->RDTR & CAN_RDT0R_FMI)
+				   >> CAN_RDT0R_FMI_Pos);
 
-		if (filter_match_index >= CONFIG_CAN_MAX_FILTER) {
-			break;
-		}
+	if (filter_match_index >= CONFIG_CAN_MAX_FILTER) {
+		return;
+	}
 
-		LOG_DBG("Message on filter index %d", filter_match_index);
-		can_stm32_get_msg_fifo(mbox, &msg);
+	LOG_DBG("Message on filter index %d", filter_match_index);
+	can_stm32_get_msg_fifo(mbox, &msg);
 
-		callback = data->rx_cb[filter_match_index];
+	callback = data->rx_cb[filter_match_index];
 
-		if (callback) {
-			callback(&msg, data->cb_arg[filter_match_index]);
-		}
+	if (callback) {
+		callback(&msg, data->cb_arg[filter_match_index]);
+	}
+}
+
+static inline
+void can_stm32_rx_isr_handler(CAN_TypeDef *can, struct can_stm32_data *data)
+{
+	/* Drain everything pending in both FIFOs so that a burst of
+	 * frames is handled within a single interrupt.
+	 */
+	while (can->RF0R & CAN_RF0R_FMP0) {
+		can_stm32_rx_fifo_pop(&can->sFIFOMailBox[0], data);
 
 		/* Release message */
 		can->RF0R |= CAN_RF0R_RFOM0;
 	}
 
-	if (can->RF0R & CAN_RF0R_FOVR0) {
+	while (can->RF1R & CAN_RF1R_FMP1) {
+		can_stm32_rx_fifo_pop(&can->sFIFOMailBox[1], data);
+
+		/* Release message */
+		can->RF1R |= CAN_RF1R_RFOM1;
+	}
+
+	if ((can->RF0R & CAN_RF0R_FOVR0) || (can->RF1R & CAN_RF1R_FOVR1)) {
 		LOG_ERR("RX FIFO Overflow");
 	}
 }
@@ -630,6 +630,15 @@ static int clk_init(const struct device *dev)
 		subdata->flags = CLOCK_CONTROL_STATUS_OFF;
 	}
 
+	if (CONFIG_CLOCK_CONTROL_NRF_HFCLK_LINGER_MS > 0) {
+		err = onoff_manager_set_linger(
+			get_onoff_manager(dev, CLOCK_CONTROL_NRF_TYPE_HFCLK),
+			K_MSEC(CONFIG_CLOCK_CONTROL_NRF_HFCLK_LINGER_MS));
+		if (err < 0) {
+			return err;
+		}
+	}
+
 	return 0;
 }
 
@@ -104,6 +104,11 @@ struct gsm_mux {
 	uint8_t received_fcs; /* packet fcs */
 	uint8_t retries;      /* N2 counter */
 
+	/* Scratch area used to send a complete mux frame (hdr + data + FCS)
+	 * in one UART write instead of three.
+	 */
+	uint8_t tx_frame[CONFIG_GSM_MUX_MRU_MAX_LEN + 7];
+
 	bool in_use : 1;
 	bool is_initiator : 1;   /* Did we initiate the connection attempt */
 	bool refuse_service : 1; /* Do not try to talk to this modem */
@@ -376,6 +381,7 @@ static int gsm_mux_send_data_msg(struct gsm_mux *mux, bool cmd,
 				 const uint8_t *buf, size_t size)
 {
 	uint8_t hdr[7];
+	uint8_t fcs;
 	int pos;
 	int ret;
 
@@ -392,27 +398,39 @@ static int gsm_mux_send_data_msg(struct gsm_mux *mux, bool cmd,
 		pos = 5;
 	}
 
-	/* Write the header and data in smaller chunks in order to avoid
-	 * allocating a big buffer.
-	 */
-	(void)gsm_mux_modem_send(mux, &hdr[0], pos);
-
-	if (size > 0) {
-		(void)gsm_mux_modem_send(mux, buf, size);
-	}
-
 	/* FSC is calculated only for address, type and length fields
 	 * for UIH frames
 	 */
-	hdr[pos] = 0xFF - gsm_mux_fcs_add_buf(FCS_INIT_VALUE, &hdr[1],
-					      pos - 1);
+	fcs = 0xFF - gsm_mux_fcs_add_buf(FCS_INIT_VALUE, &hdr[1], pos - 1);
 	if ((frame_type & ~PF) != FT_UIH) {
-		hdr[pos] = gsm_mux_fcs_add_buf(hdr[pos], buf, size);
+		fcs = gsm_mux_fcs_add_buf(fcs, buf, size);
 	}
 
-	hdr[pos + 1] = SOF_MARKER;
+	if (pos + size + 2 <= sizeof(mux->tx_frame)) {
+		/* Coalesce header, data and FCS into one UART write so that
+		 * the frame goes out as a single transfer.
+		 */
+		memcpy(mux->tx_frame, hdr, pos);
+		memcpy(&mux->tx_frame[pos], buf, size);
+		mux->tx_frame[pos + size] = fcs;
+		mux->tx_frame[pos + size + 1] = SOF_MARKER;
 
-	ret = gsm_mux_modem_send(mux, &hdr[pos], 2);
+		ret = gsm_mux_modem_send(mux, mux->tx_frame, pos + size + 2);
+	} else {
+		/* Frame does not fit so write the header and data in smaller
+		 * chunks in order to avoid allocating a big buffer.
+		 */
+		(void)gsm_mux_modem_send(mux, &hdr[0], pos);
+
+		if (size > 0) {
+			(void)gsm_mux_modem_send(mux, buf, size);
+		}
+
+		hdr[pos] = fcs;
+		hdr[pos + 1] = SOF_MARKER;
+
+		ret = gsm_mux_modem_send(mux, &hdr[pos], 2);
+	}
 
 	hexdump_packet("Sending", dlci->num, cmd, frame_type,
 		       buf, size);
@@ -1376,6 +1394,38 @@ static void gsm_mux_process_data(struct gsm_mux *mux, uint8_t recv_byte)
 	}
 }
 
+/* Append a whole chunk of payload data instead of taking it byte by byte */
+static int gsm_mux_process_data_chunk(struct gsm_mux *mux, uint8_t *buf,
+				      size_t len)
+{
+	size_t chunk = MIN(len, (size_t)(mux->msg_len - mux->received));
+	size_t bytes_added;
+
+	if (mux->buf == NULL) {
+		mux->buf = net_buf_alloc(&gsm_mux_pool, BUF_ALLOC_TIMEOUT);
+		if (mux->buf == NULL) {
+			LOG_ERR("[%p] Can't allocate RX data! "
+				"Skipping data!", mux);
+			gsm_mux_change_state(mux, GSM_MUX_SOF);
+			return chunk;
+		}
+	}
+
+	bytes_added = net_buf_append_bytes(mux->buf, chunk, buf,
+					   BUF_ALLOC_TIMEOUT,
+					   gsm_mux_alloc_buf,
+					   &gsm_mux_pool);
+	mux->received += bytes_added;
+
+	if (bytes_added != chunk) {
+		gsm_mux_change_state(mux, GSM_MUX_SOF);
+	} else if (mux->received == mux->msg_len) {
+		gsm_mux_change_state(mux, GSM_MUX_FCS);
+	}
+
+	return bytes_added;
+}
+
 void gsm_mux_recv_buf(struct gsm_mux *mux, uint8_t *buf, int len)
 {
 	int i = 0;
@@ -1383,6 +1433,20 @@ void gsm_mux_recv_buf(struct gsm_mux *mux, uint8_t *buf, int len)
 	LOG_DBG("Received %d bytes", len);
 
 	while (i < len) {
+		if (mux->state == GSM_MUX_SOF) {
+			/* Jump to the next SOF marker in one go */
+			uint8_t *sof = memchr(&buf[i], SOF_MARKER, len - i);
+
+			if (sof == NULL) {
+				return;
+			}
+
+			i = sof - buf;
+		} else if (mux->state == GSM_MUX_DATA) {
+			i += gsm_mux_process_data_chunk(mux, &buf[i], len - i);
+			continue;
+		}
+
 		gsm_mux_process_data(mux, buf[i++]);
 	}
 }
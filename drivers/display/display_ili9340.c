@@ -29,6 +29,10 @@ struct ili9340_data {
 #if DT_INST_SPI_DEV_HAS_CS_GPIOS(0)
 	struct spi_cs_control cs_ctrl;
 #endif
+#ifdef CONFIG_ILI9340_WRITE_ASYNC
+	struct k_poll_signal async_sig;
+	bool async_pending;
+#endif
 };
 
 #define ILI9340_CMD_DATA_PIN_COMMAND 1
@@ -41,6 +45,24 @@ struct ili9340_data {
 #define ILI9340_RGB_SIZE 3U
 #endif
 
+#ifdef CONFIG_ILI9340_WRITE_ASYNC
+static void ili9340_wait_transfer(struct ili9340_data *data)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+		&data->async_sig);
+
+	if (!data->async_pending) {
+		return;
+	}
+
+	k_poll(&event, 1, K_FOREVER);
+	data->async_pending = false;
+}
+#else
+#define ili9340_wait_transfer(data)
+#endif
+
 static void ili9340_exit_sleep(struct ili9340_data *data)
 {
 	ili9340_transmit(data, ILI9340_CMD_EXIT_SLEEP, NULL, 0);
@@ -63,6 +85,11 @@ static int ili9340_init(const struct device *dev)
 	data->spi_config.operation = SPI_OP_MODE_MASTER | SPI_WORD_SET(8);
 	data->spi_config.slave = DT_INST_REG_ADDR(0);
 
+#ifdef CONFIG_ILI9340_WRITE_ASYNC
+	k_poll_signal_init(&data->async_sig);
+	data->async_pending = false;
+#endif
+
 #if DT_INST_SPI_DEV_HAS_CS_GPIOS(0)
 	data->cs_ctrl.gpio_dev =
 		device_get_binding(DT_INST_SPI_DEV_CS_GPIOS_LABEL(0));
@@ -161,6 +188,40 @@ static int ili9340_write(const struct device *dev, const uint16_t x,
 		nbr_of_writes = 1U;
 	}
 
+#ifdef CONFIG_ILI9340_WRITE_ASYNC
+	if (nbr_of_writes == 1U) {
+		int err;
+
+		/*
+		 * One contiguous blit: send the command synchronously and
+		 * hand the pixel payload to the SPI driver without waiting
+		 * for completion. The next transmission waits for the
+		 * transfer before touching the bus, so the caller must not
+		 * reuse the buffer until a subsequent display operation.
+		 */
+		ili9340_transmit(data, ILI9340_CMD_MEM_WRITE, NULL, 0);
+
+		gpio_pin_set(data->command_data_gpio,
+			     DT_INST_GPIO_PIN(0, cmd_data_gpios),
+			     ILI9340_CMD_DATA_PIN_DATA);
+
+		tx_buf.buf = (void *)write_data_start;
+		tx_buf.len = desc->width * ILI9340_RGB_SIZE * write_h;
+		tx_bufs.buffers = &tx_buf;
+		tx_bufs.count = 1;
+
+		k_poll_signal_reset(&data->async_sig);
+		data->async_pending = true;
+		err = spi_write_async(data->spi_dev, &data->spi_config,
+				      &tx_bufs, &data->async_sig);
+		if (err < 0) {
+			data->async_pending = false;
+		}
+
+		return err;
+	}
+#endif /* CONFIG_ILI9340_WRITE_ASYNC */
+
 	ili9340_transmit(data, ILI9340_CMD_MEM_WRITE,
 			 (void *) write_data_start,
 			 desc->width * ILI9340_RGB_SIZE * write_h);
@@ -272,6 +333,8 @@ void ili9340_transmit(struct ili9340_data *data, uint8_t cmd, void *tx_data,
 	struct spi_buf tx_buf = { .buf = &cmd, .len = 1 };
 	struct spi_buf_set tx_bufs = { .buffers = &tx_buf, .count = 1 };
 
+	ili9340_wait_transfer(data);
+
 	gpio_pin_set(data->command_data_gpio,
 		     DT_INST_GPIO_PIN(0, cmd_data_gpios),
 		     ILI9340_CMD_DATA_PIN_COMMAND);
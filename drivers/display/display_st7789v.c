@@ -48,6 +48,11 @@ struct st7789v_data {
 #endif
 	const struct device *cmd_data_gpio;
 
+#ifdef CONFIG_ST7789V_WRITE_ASYNC
+	struct k_poll_signal async_sig;
+	bool async_pending;
+#endif
+
 	uint16_t height;
 	uint16_t width;
 	uint16_t x_offset;
@@ -75,12 +80,32 @@ static void st7789v_set_cmd(struct st7789v_data *data, int is_cmd)
 	gpio_pin_set(data->cmd_data_gpio, ST7789V_CMD_DATA_PIN, is_cmd);
 }
 
+#ifdef CONFIG_ST7789V_WRITE_ASYNC
+static void st7789v_wait_transfer(struct st7789v_data *data)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+		&data->async_sig);
+
+	if (!data->async_pending) {
+		return;
+	}
+
+	k_poll(&event, 1, K_FOREVER);
+	data->async_pending = false;
+}
+#else
+#define st7789v_wait_transfer(data)
+#endif
+
 static void st7789v_transmit(struct st7789v_data *data, uint8_t cmd,
 		uint8_t *tx_data, size_t tx_count)
 {
 	struct spi_buf tx_buf = { .buf = &cmd, .len = 1 };
 	struct spi_buf_set tx_bufs = { .buffers = &tx_buf, .count = 1 };
 
+	st7789v_wait_transfer(data);
+
 	st7789v_set_cmd(data, 1);
 	spi_write(data->spi_dev, &data->spi_config, &tx_bufs);
 
@@ -185,6 +210,38 @@ static int st7789v_write(const struct device *dev,
 		nbr_of_writes = 1U;
 	}
 
+#ifdef CONFIG_ST7789V_WRITE_ASYNC
+	if (nbr_of_writes == 1U) {
+		int err;
+
+		/*
+		 * One contiguous blit: send the command synchronously and
+		 * hand the pixel payload to the SPI driver without waiting
+		 * for completion. The next transmission waits for the
+		 * transfer before touching the bus, so the caller must not
+		 * reuse the buffer until a subsequent display operation.
+		 */
+		st7789v_transmit(data, ST7789V_CMD_RAMWR, NULL, 0);
+
+		st7789v_set_cmd(data, 0);
+
+		tx_buf.buf = (void *)write_data_start;
+		tx_buf.len = desc->width * ST7789V_PIXEL_SIZE * write_h;
+		tx_bufs.buffers = &tx_buf;
+		tx_bufs.count = 1;
+
+		k_poll_signal_reset(&data->async_sig);
+		data->async_pending = true;
+		err = spi_write_async(data->spi_dev, &data->spi_config,
+				      &tx_bufs, &data->async_sig);
+		if (err < 0) {
+			data->async_pending = false;
+		}
+
+		return err;
+	}
+#endif /* CONFIG_ST7789V_WRITE_ASYNC */
+
 	st7789v_transmit(data, ST7789V_CMD_RAMWR,
 			 (void *) write_data_start,
 			 desc->width * ST7789V_PIXEL_SIZE * write_h);
@@ -349,6 +406,11 @@ static int st7789v_init(const struct device *dev)
 	data->spi_config.operation = SPI_OP_MODE_MASTER | SPI_WORD_SET(8);
 	data->spi_config.slave = DT_INST_REG_ADDR(0);
 
+#ifdef CONFIG_ST7789V_WRITE_ASYNC
+	k_poll_signal_init(&data->async_sig);
+	data->async_pending = false;
+#endif
+
 #if DT_INST_SPI_DEV_HAS_CS_GPIOS(0)
 	data->cs_ctrl.gpio_dev = device_get_binding(
 			DT_INST_SPI_DEV_CS_GPIOS_LABEL(0));
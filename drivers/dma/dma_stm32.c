@@ -339,6 +339,7 @@ DMA_STM32_EXPORT_API int dma_stm32_configure(const struct device *dev,
 	}
 
 	stream->busy		= true;
+	stream->sg_config	= NULL;
 	stream->dma_callback	= config->dma_callback;
 	stream->direction	= config->channel_direction;
 	stream->user_data       = config->user_data;
@@ -408,7 +409,7 @@ DMA_STM32_EXPORT_API int dma_stm32_configure(const struct device *dev,
 		return ret;
 	}
 
-	if (config->head_block->source_reload_en) {
+	if (config->head_block->source_reload_en || config->cyclic) {
 		DMA_InitStruct.Mode = LL_DMA_MODE_CIRCULAR;
 	} else {
 		DMA_InitStruct.Mode = LL_DMA_MODE_NORMAL;
@@ -530,6 +531,70 @@ DMA_STM32_EXPORT_API int dma_stm32_reload(const struct device *dev, uint32_t id,
 	return 0;
 }
 
+DMA_STM32_EXPORT_API int dma_stm32_configure_sg(const struct device *dev,
+						uint32_t id,
+						struct dma_config *config)
+{
+	const struct dma_stm32_config *dev_config = dev->config;
+	struct dma_stm32_stream *stream;
+	int ret;
+
+	if (id - STREAM_OFFSET >= dev_config->max_streams) {
+		return -EINVAL;
+	}
+
+	stream = &dev_config->streams[id - STREAM_OFFSET];
+
+	/*
+	 * This controller has no hardware descriptor lists, so a reusable
+	 * list is restricted to a single block, optionally cyclic; longer
+	 * chains would need per-block reconfiguration anyway.
+	 */
+	if (config->block_count != 1U ||
+	    config->head_block->next_block != NULL) {
+		LOG_ERR("block chaining not supported.");
+		return -ENOTSUP;
+	}
+
+	ret = dma_stm32_configure(dev, id, config);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The client keeps ownership and must keep the list valid. */
+	stream->sg_config = config;
+
+	return 0;
+}
+
+DMA_STM32_EXPORT_API int dma_stm32_resubmit(const struct device *dev,
+					    uint32_t id)
+{
+	const struct dma_stm32_config *dev_config = dev->config;
+	struct dma_stm32_stream *stream;
+	struct dma_block_config *block;
+
+	if (id - STREAM_OFFSET >= dev_config->max_streams) {
+		return -EINVAL;
+	}
+
+	stream = &dev_config->streams[id - STREAM_OFFSET];
+
+	if (stream->sg_config == NULL) {
+		return -EINVAL;
+	}
+
+	/*
+	 * The channel still holds the configuration made in
+	 * dma_stm32_configure_sg(), only the addresses and the data
+	 * length need to be rewritten before re-enabling the stream.
+	 */
+	block = stream->sg_config->head_block;
+
+	return dma_stm32_reload(dev, id, block->source_address,
+				block->dest_address, block->block_size);
+}
+
 DMA_STM32_EXPORT_API int dma_stm32_start(const struct device *dev, uint32_t id)
 {
 	const struct dma_stm32_config *config = dev->config;
@@ -633,6 +698,8 @@ static int dma_stm32_get_status(const struct device *dev, uint32_t id,
 static const struct dma_driver_api dma_funcs = {
 	.reload		 = dma_stm32_reload,
 	.config		 = dma_stm32_configure,
+	.config_sg	 = dma_stm32_configure_sg,
+	.resubmit	 = dma_stm32_resubmit,
 	.start		 = dma_stm32_start,
 	.stop		 = dma_stm32_stop,
 	.get_status	 = dma_stm32_get_status,
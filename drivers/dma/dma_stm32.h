@@ -25,6 +25,8 @@ struct dma_stm32_stream {
 	uint32_t dst_size;
 	void *user_data; /* holds the client data */
 	dma_callback_t dma_callback;
+	/* descriptor list kept for dma_resubmit(), owned by the client */
+	struct dma_config *sg_config;
 };
 
 struct dma_stm32_data {
@@ -98,6 +100,9 @@ uint32_t stm32_dma_get_pburst(struct dma_config *config, bool source_periph);
 #define DMA_STM32_EXPORT_API
 int dma_stm32_configure(const struct device *dev, uint32_t id,
 				struct dma_config *config);
+int dma_stm32_configure_sg(const struct device *dev, uint32_t id,
+				struct dma_config *config);
+int dma_stm32_resubmit(const struct device *dev, uint32_t id);
 int dma_stm32_reload(const struct device *dev, uint32_t id,
 			uint32_t src, uint32_t dst, size_t size);
 int dma_stm32_start(const struct device *dev, uint32_t id);
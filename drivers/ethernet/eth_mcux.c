@@ -135,6 +135,9 @@ struct eth_context {
 	void (*generate_mac)(uint8_t *);
 	struct k_work phy_work;
 	struct k_delayed_work delayed_phy_work;
+#if defined(CONFIG_ETH_MCUX_RX_POLLING)
+	struct k_work rx_work;
+#endif
 	/* TODO: FIXME. This Ethernet frame sized buffer is used for
 	 * interfacing with MCUX. How it works is that hardware uses
 	 * DMA scatter buffers to receive a frame, and then public
@@ -887,6 +890,39 @@ error:
 	eth_stats_update_errors_rx(get_iface(context, vlan_tag));
 }
 
+#if defined(CONFIG_ETH_MCUX_RX_POLLING)
+static void eth_rx_poll(struct k_work *item)
+{
+	struct eth_context *context =
+		CONTAINER_OF(item, struct eth_context, rx_work);
+	uint32_t frame_length = 0U;
+	int budget = CONFIG_ETH_MCUX_RX_BUDGET;
+
+	while (budget > 0 &&
+	       ENET_GetRxFrameSize(&context->enet_handle, &frame_length) !=
+	       kStatus_ENET_RxFrameEmpty) {
+		eth_rx(context);
+		budget--;
+	}
+
+	if (budget == 0) {
+		/* Budget exhausted with frames still pending; yield the
+		 * work queue and continue in the next invocation.
+		 */
+		k_work_submit(&context->rx_work);
+		return;
+	}
+
+	/* Ring drained.  A frame received after the emptiness check
+	 * leaves its flag pending in EIR, so unmasking below raises
+	 * the interrupt immediately and no wakeup is lost.
+	 */
+	ENET_EnableInterrupts(context->base,
+			      kENET_RxFrameInterrupt |
+			      kENET_RxBufferInterrupt);
+}
+#endif /* CONFIG_ETH_MCUX_RX_POLLING */
+
 #if defined(CONFIG_PTP_CLOCK_MCUX)
 static inline void ts_register_tx_event(struct eth_context *context)
 {
@@ -933,7 +969,17 @@ static void eth_callback(ENET_Type *base, enet_handle_t *handle,
 
 	switch (event) {
 	case kENET_RxEvent:
+#if defined(CONFIG_ETH_MCUX_RX_POLLING)
+		/* Mask RX interrupts until the poll work item has
+		 * drained the receive ring.
+		 */
+		ENET_DisableInterrupts(context->base,
+				       kENET_RxFrameInterrupt |
+				       kENET_RxBufferInterrupt);
+		k_work_submit(&context->rx_work);
+#else
 		eth_rx(context);
+#endif
 		break;
 	case kENET_TxEvent:
 #if defined(CONFIG_PTP_CLOCK_MCUX)
@@ -1109,6 +1155,9 @@ static int eth_init(const struct device *dev)
 	k_work_init(&context->phy_work, eth_mcux_phy_work);
 	k_delayed_work_init(&context->delayed_phy_work,
 			    eth_mcux_delayed_phy_work);
+#if defined(CONFIG_ETH_MCUX_RX_POLLING)
+	k_work_init(&context->rx_work, eth_rx_poll);
+#endif
 
 
 	/* Initialize/override OUI which may not be correct in
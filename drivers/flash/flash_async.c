@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <drivers/flash.h>
+
+/* Fallback implementation of the asynchronous flash API.
+ *
+ * Drivers that provide the write_async/erase_async entry points are
+ * called directly. For all other drivers the blocking operation is run
+ * from a dedicated work queue and the completion signal is raised with
+ * its result. The work queue runs at a configurable low priority since
+ * a single erase can block it for tens of milliseconds.
+ */
+
+struct flash_async_op {
+	struct k_work work;
+	const struct device *dev;
+	off_t offset;
+	const void *data;
+	size_t size;
+	struct k_poll_signal *async;
+	bool erase;
+};
+
+K_MEM_SLAB_DEFINE(flash_async_op_slab, sizeof(struct flash_async_op),
+		  CONFIG_FLASH_ASYNC_MAX_OPS, 4);
+
+static struct k_work_q flash_async_q;
+static K_KERNEL_STACK_DEFINE(flash_async_stack, CONFIG_FLASH_ASYNC_STACK_SIZE);
+
+static void flash_async_work_handler(struct k_work *work)
+{
+	struct flash_async_op *op =
+		CONTAINER_OF(work, struct flash_async_op, work);
+	struct k_poll_signal *async = op->async;
+	int result;
+
+	if (op->erase) {
+		result = flash_erase(op->dev, op->offset, op->size);
+	} else {
+		result = flash_write(op->dev, op->offset, op->data, op->size);
+	}
+
+	k_mem_slab_free(&flash_async_op_slab, (void **)&op);
+
+	if (async != NULL) {
+		k_poll_signal_raise(async, result);
+	}
+}
+
+static int flash_async_submit(const struct device *dev, off_t offset,
+			      const void *data, size_t size, bool erase,
+			      struct k_poll_signal *async)
+{
+	struct flash_async_op *op;
+
+	if (k_mem_slab_alloc(&flash_async_op_slab, (void **)&op,
+			     K_NO_WAIT) != 0) {
+		return -EBUSY;
+	}
+
+	k_work_init(&op->work, flash_async_work_handler);
+	op->dev = dev;
+	op->offset = offset;
+	op->data = data;
+	op->size = size;
+	op->async = async;
+	op->erase = erase;
+
+	k_work_submit_to_queue(&flash_async_q, &op->work);
+
+	return 0;
+}
+
+int flash_write_async(const struct device *dev, off_t offset,
+		      const void *data, size_t len,
+		      struct k_poll_signal *async)
+{
+	const struct flash_driver_api *api =
+		(const struct flash_driver_api *)dev->api;
+
+	if (api->write_async != NULL) {
+		return api->write_async(dev, offset, data, len, async);
+	}
+
+	return flash_async_submit(dev, offset, data, len, false, async);
+}
+
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct k_poll_signal *async)
+{
+	const struct flash_driver_api *api =
+		(const struct flash_driver_api *)dev->api;
+
+	if (api->erase_async != NULL) {
+		return api->erase_async(dev, offset, size, async);
+	}
+
+	return flash_async_submit(dev, offset, NULL, size, true, async);
+}
+
+static int flash_async_init(const struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_work_q_start(&flash_async_q, flash_async_stack,
+		       K_KERNEL_STACK_SIZEOF(flash_async_stack),
+		       CONFIG_FLASH_ASYNC_PRIORITY);
+	k_thread_name_set(&flash_async_q.thread, "flash_async");
+
+	return 0;
+}
+
+SYS_INIT(flash_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -842,6 +842,23 @@ static void qspi_nor_pages_layout(const struct device *dev,
 }
 #endif /* CONFIG_FLASH_PAGE_LAYOUT */
 
+/* The QSPI peripheral makes the external flash readable through the
+ * XIP region of the memory map (nRF52840 memory map, fixed base).
+ */
+#define QSPI_NOR_XIP_BASE 0x12000000UL
+
+static const void *qspi_nor_get_mapped_address(const struct device *dev,
+					       off_t offset)
+{
+	ARG_UNUSED(dev);
+
+	if ((offset < 0) || (offset >= INST_0_BYTES)) {
+		return NULL;
+	}
+
+	return (const uint8_t *)QSPI_NOR_XIP_BASE + offset;
+}
+
 static const struct flash_driver_api qspi_nor_api = {
 	.read = qspi_nor_read,
 	.write = qspi_nor_write,
@@ -851,6 +868,7 @@ static const struct flash_driver_api qspi_nor_api = {
 #if defined(CONFIG_FLASH_PAGE_LAYOUT)
 	.page_layout = qspi_nor_pages_layout,
 #endif
+	.get_mapped_address = qspi_nor_get_mapped_address,
 };
 
 
@@ -238,6 +238,19 @@ flash_nrf_get_parameters(const struct device *dev)
 	return &flash_nrf_parameters;
 }
 
+static const void *flash_nrf_get_mapped_address(const struct device *dev,
+						off_t addr)
+{
+	ARG_UNUSED(dev);
+
+	/* The flash is readable through the address space. */
+	if (!is_regular_addr_valid(addr, 0)) {
+		return NULL;
+	}
+
+	return (const void *)(addr + DT_REG_ADDR(SOC_NV_FLASH_NODE));
+}
+
 static const struct flash_driver_api flash_nrf_api = {
 	.read = flash_nrf_read,
 	.write = flash_nrf_write,
@@ -247,6 +260,7 @@ static const struct flash_driver_api flash_nrf_api = {
 #if defined(CONFIG_FLASH_PAGE_LAYOUT)
 	.page_layout = flash_nrf_pages_layout,
 #endif
+	.get_mapped_address = flash_nrf_get_mapped_address,
 };
 
 static int nrf_flash_init(const struct device *dev)
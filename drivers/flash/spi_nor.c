@@ -295,6 +295,48 @@ static int spi_nor_access(const struct device *const dev,
 		&driver_data->spi_cfg, &tx_set, &rx_set);
 }
 
+#if defined(CONFIG_SPI_NOR_FAST_READ)
+/* Fast Read needs a dummy byte between the address and the data phase,
+ * which spi_nor_access() cannot express; inline the transfer here.
+ */
+static int spi_nor_fread(const struct device *const dev, off_t addr,
+			 void *dest, size_t length)
+{
+	struct spi_nor_data *const driver_data = dev->data;
+
+	uint8_t buf[5] = {
+		SPI_NOR_CMD_FREAD,
+		(addr & 0xFF0000) >> 16,
+		(addr & 0xFF00) >> 8,
+		(addr & 0xFF),
+		0,
+	};
+
+	struct spi_buf spi_buf[2] = {
+		{
+			.buf = buf,
+			.len = sizeof(buf),
+		},
+		{
+			.buf = dest,
+			.len = length
+		}
+	};
+	const struct spi_buf_set tx_set = {
+		.buffers = spi_buf,
+		.count = 2
+	};
+
+	const struct spi_buf_set rx_set = {
+		.buffers = spi_buf,
+		.count = 2
+	};
+
+	return spi_transceive(driver_data->spi,
+		&driver_data->spi_cfg, &tx_set, &rx_set);
+}
+#endif /* CONFIG_SPI_NOR_FAST_READ */
+
 #define spi_nor_cmd_read(dev, opcode, dest, length) \
 	spi_nor_access(dev, opcode, false, 0, dest, length, false)
 #define spi_nor_cmd_addr_read(dev, opcode, addr, dest, length) \
@@ -460,7 +502,11 @@ static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 
 	spi_nor_wait_until_ready(dev);
 
+#if defined(CONFIG_SPI_NOR_FAST_READ)
+	ret = spi_nor_fread(dev, addr, dest, size);
+#else
 	ret = spi_nor_cmd_addr_read(dev, SPI_NOR_CMD_READ, addr, dest, size);
+#endif
 
 	release_device(dev);
 	return ret;
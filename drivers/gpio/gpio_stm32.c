@@ -33,7 +33,7 @@ static void gpio_stm32_isr(int line, void *arg)
 {
 	struct gpio_stm32_data *data = arg;
 
-	gpio_fire_callbacks(&data->cb, data->dev, BIT(line));
+	gpio_fire_callbacks_indexed(&data->cb, data->dev, BIT(line));
 }
 
 /**
@@ -483,7 +483,7 @@ static int gpio_stm32_manage_callback(const struct device *dev,
 {
 	struct gpio_stm32_data *data = dev->data;
 
-	return gpio_manage_callback(&data->cb, callback, set);
+	return gpio_manage_callback_indexed(&data->cb, callback, set);
 }
 
 static const struct gpio_driver_api gpio_stm32_driver = {
@@ -15,6 +15,8 @@
 #include <pinmux/stm32/pinmux_stm32.h>
 #include <drivers/gpio.h>
 
+#include "gpio_utils.h"
+
 /* GPIO buses definitions */
 
 #define STM32_PORT_NOT_AVAILABLE 0xFFFFFFFF
@@ -221,7 +223,7 @@ struct gpio_stm32_data {
 	/* device's owner of this data */
 	const struct device *dev;
 	/* user ISR cb */
-	sys_slist_t cb;
+	struct gpio_callback_index cb;
 };
 
 /**
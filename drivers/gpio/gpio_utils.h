@@ -72,4 +72,115 @@ static inline void gpio_fire_callbacks(sys_slist_t *list,
 	}
 }
 
+/** Number of pins covered by one indexed callback table */
+#define GPIO_CALLBACK_INDEX_NPINS	32
+
+/**
+ * @brief Callback container with O(1) dispatch for single-pin callbacks
+ *
+ * Single-pin callbacks, which are the common case, are stored in a
+ * table indexed by pin number so that firing them does not require
+ * walking the whole callback list in interrupt context. Callbacks
+ * covering several pins, or added to a pin that already has an
+ * indexed callback, stay on the regular list.
+ */
+struct gpio_callback_index {
+	/** Callbacks that could not be placed in the per pin table */
+	sys_slist_t list;
+	/** Single-pin callbacks, indexed by pin number */
+	struct gpio_callback *per_pin[GPIO_CALLBACK_INDEX_NPINS];
+};
+
+/**
+ * @brief Generic function to insert or remove an indexed callback
+ *
+ * @param index A pointer to the indexed callback container
+ * @param callback A pointer of the callback to insert or remove
+ * @param set A boolean indicating insertion or removal of the callback
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+static inline int gpio_manage_callback_indexed(
+					struct gpio_callback_index *index,
+					struct gpio_callback *callback,
+					bool set)
+{
+	gpio_port_pins_t mask;
+
+	__ASSERT(callback, "No callback!");
+	__ASSERT(callback->handler, "No callback handler!");
+
+	mask = callback->pin_mask;
+
+	if (is_power_of_two(mask)) {
+		gpio_pin_t pin = find_lsb_set(mask) - 1;
+
+		if (index->per_pin[pin] == callback) {
+			if (!set) {
+				index->per_pin[pin] = NULL;
+			}
+
+			return 0;
+		}
+
+		if (set && (index->per_pin[pin] == NULL)) {
+			/* The callback might be re-added with a changed
+			 * pin mask, make sure it is not on the list too.
+			 */
+			(void)gpio_manage_callback(&index->list, callback,
+						   false);
+			index->per_pin[pin] = callback;
+
+			return 0;
+		}
+	} else if (!set) {
+		gpio_pin_t pin;
+
+		/* The pin mask may have grown since the callback was
+		 * added, so it can still sit in the per pin table.
+		 */
+		for (pin = 0; pin < GPIO_CALLBACK_INDEX_NPINS; pin++) {
+			if (index->per_pin[pin] == callback) {
+				index->per_pin[pin] = NULL;
+
+				return 0;
+			}
+		}
+	}
+
+	/* Multi-pin callback, or the pin slot is taken by another
+	 * callback; fall back to the list.
+	 */
+	return gpio_manage_callback(&index->list, callback, set);
+}
+
+/**
+ * @brief Generic function to fire the callbacks of an indexed container
+ *
+ * @param index A pointer to the indexed callback container
+ * @param port A pointer on the gpio driver instance
+ * @param pins The actual pin mask that triggered the interrupt
+ */
+static inline void gpio_fire_callbacks_indexed(
+					struct gpio_callback_index *index,
+					const struct device *port,
+					uint32_t pins)
+{
+	uint32_t remaining = pins;
+
+	while (remaining != 0U) {
+		gpio_pin_t pin = find_lsb_set(remaining) - 1;
+		struct gpio_callback *cb = index->per_pin[pin];
+
+		if (cb != NULL) {
+			__ASSERT(cb->handler, "No callback handler!");
+			cb->handler(port, cb, BIT(pin));
+		}
+
+		remaining &= remaining - 1;
+	}
+
+	gpio_fire_callbacks(&index->list, port, pins);
+}
+
 #endif /* ZEPHYR_DRIVERS_GPIO_GPIO_UTILS_H_ */
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <drivers/i2c_mngr.h>
+
+/* Queued transaction manager for I2C controllers.
+ *
+ * All managers share one dedicated work queue. A manager's work item
+ * drains its transaction queue in one go, so queued transfers run
+ * back-to-back while the calling threads go on with other work.
+ * Completion is reported per transaction through a callback and/or a
+ * k_poll_signal.
+ */
+
+static struct k_work_q i2c_mngr_q;
+static K_KERNEL_STACK_DEFINE(i2c_mngr_stack, CONFIG_I2C_MNGR_STACK_SIZE);
+
+static void i2c_mngr_work_handler(struct k_work *work)
+{
+	struct i2c_mngr *mngr = CONTAINER_OF(work, struct i2c_mngr, work);
+	struct i2c_mngr_transaction *trans;
+
+	while ((trans = k_fifo_get(&mngr->fifo, K_NO_WAIT)) != NULL) {
+		int result = i2c_transfer(mngr->dev, trans->msgs,
+					  trans->num_msgs, trans->addr);
+
+		if (trans->callback != NULL) {
+			trans->callback(trans, result);
+		}
+
+		if (trans->async != NULL) {
+			k_poll_signal_raise(trans->async, result);
+		}
+	}
+}
+
+void i2c_mngr_init(struct i2c_mngr *mngr, const struct device *dev)
+{
+	mngr->dev = dev;
+	k_fifo_init(&mngr->fifo);
+	k_work_init(&mngr->work, i2c_mngr_work_handler);
+}
+
+int i2c_mngr_submit(struct i2c_mngr *mngr, struct i2c_mngr_transaction *trans)
+{
+	if ((trans->msgs == NULL) || (trans->num_msgs == 0U)) {
+		return -EINVAL;
+	}
+
+	k_fifo_put(&mngr->fifo, trans);
+	k_work_submit_to_queue(&i2c_mngr_q, &mngr->work);
+
+	return 0;
+}
+
+static int i2c_mngr_q_init(const struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_work_q_start(&i2c_mngr_q, i2c_mngr_stack,
+		       K_KERNEL_STACK_SIZEOF(i2c_mngr_stack),
+		       CONFIG_I2C_MNGR_PRIORITY);
+	k_thread_name_set(&i2c_mngr_q.thread, "i2c_mngr");
+
+	return 0;
+}
+
+SYS_INIT(i2c_mngr_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -53,6 +53,13 @@ static struct nrf5_802154_data nrf5_data;
 #define FRAME_PENDING_BYTE 1
 #define FRAME_PENDING_BIT (1 << 4)
 
+#if defined(CONFIG_IEEE802154_NRF5_DELAYED_TX)
+/* Lead time subtracted from the requested TX timestamp so that the
+ * radio driver has time to schedule the delayed transmission.
+ */
+#define TXTIME_OFFSET_US (5 * USEC_PER_MSEC)
+#endif
+
 /* Convenience defines for RADIO */
 #define NRF5_802154_DATA(dev) \
 	((struct nrf5_802154_data * const)(dev)->data)
@@ -82,101 +89,120 @@ static void nrf5_get_eui64(uint8_t *mac)
 	memcpy(mac + index, &factoryAddress, sizeof(factoryAddress) - index);
 }
 
-static void nrf5_rx_thread(void *arg1, void *arg2, void *arg3)
+static int nrf5_rx_frame_process(struct nrf5_802154_data *nrf5_radio,
+				 struct nrf5_802154_rx_frame *rx_frame)
 {
-	struct nrf5_802154_data *nrf5_radio = (struct nrf5_802154_data *)arg1;
-	struct net_pkt *pkt;
-	struct nrf5_802154_rx_frame *rx_frame;
+	struct net_pkt *pkt = NULL;
 	uint8_t pkt_len;
+	int err = 0;
 
-	ARG_UNUSED(arg2);
-	ARG_UNUSED(arg3);
+	__ASSERT_NO_MSG(rx_frame->psdu);
 
-	while (1) {
-		pkt = NULL;
-		rx_frame = NULL;
+	/* rx_mpdu contains length, psdu, fcs|lqi
+	 * The last 2 bytes contain LQI or FCS, depending if
+	 * automatic CRC handling is enabled or not, respectively.
+	 */
+	if (IS_ENABLED(CONFIG_IEEE802154_RAW_MODE) ||
+	    IS_ENABLED(CONFIG_NET_L2_OPENTHREAD)) {
+		pkt_len = rx_frame->psdu[0];
+	} else {
+		pkt_len = rx_frame->psdu[0] -  NRF5_FCS_LENGTH;
+	}
 
-		LOG_DBG("Waiting for frame");
+	__ASSERT_NO_MSG(pkt_len <= CONFIG_NET_BUF_DATA_SIZE);
 
-		rx_frame = k_fifo_get(&nrf5_radio->rx_fifo, K_FOREVER);
+	LOG_DBG("Frame received");
 
-		__ASSERT_NO_MSG(rx_frame->psdu);
+	pkt = net_pkt_alloc_with_buffer(nrf5_radio->iface, pkt_len,
+					AF_UNSPEC, 0, K_NO_WAIT);
+	if (!pkt) {
+		LOG_ERR("No pkt available");
+		err = -ENOMEM;
+		goto drop;
+	}
 
-		/* rx_mpdu contains length, psdu, fcs|lqi
-		 * The last 2 bytes contain LQI or FCS, depending if
-		 * automatic CRC handling is enabled or not, respectively.
-		 */
-		if (IS_ENABLED(CONFIG_IEEE802154_RAW_MODE) ||
-		    IS_ENABLED(CONFIG_NET_L2_OPENTHREAD)) {
-			pkt_len = rx_frame->psdu[0];
-		} else {
-			pkt_len = rx_frame->psdu[0] -  NRF5_FCS_LENGTH;
-		}
+	if (net_pkt_write(pkt, rx_frame->psdu + 1, pkt_len)) {
+		err = -ENOMEM;
+		goto drop;
+	}
 
-		__ASSERT_NO_MSG(pkt_len <= CONFIG_NET_BUF_DATA_SIZE);
+	net_pkt_set_ieee802154_lqi(pkt, rx_frame->lqi);
+	net_pkt_set_ieee802154_rssi(pkt, rx_frame->rssi);
+	net_pkt_set_ieee802154_ack_fpb(pkt, rx_frame->ack_fpb);
 
-		LOG_DBG("Frame received");
+#if defined(CONFIG_NET_PKT_TIMESTAMP)
+	struct net_ptp_time timestamp = {
+		.second = rx_frame->time / USEC_PER_SEC,
+		.nanosecond =
+			(rx_frame->time % USEC_PER_SEC) * NSEC_PER_USEC
+	};
 
-		pkt = net_pkt_alloc_with_buffer(nrf5_radio->iface, pkt_len,
-						AF_UNSPEC, 0, K_NO_WAIT);
-		if (!pkt) {
-			LOG_ERR("No pkt available");
-			goto drop;
-		}
+	net_pkt_set_timestamp(pkt, &timestamp);
+#endif
 
-		if (net_pkt_write(pkt, rx_frame->psdu + 1, pkt_len)) {
-			goto drop;
-		}
+	LOG_DBG("Caught a packet (%u) (LQI: %u)",
+		 pkt_len, rx_frame->lqi);
 
-		net_pkt_set_ieee802154_lqi(pkt, rx_frame->lqi);
-		net_pkt_set_ieee802154_rssi(pkt, rx_frame->rssi);
-		net_pkt_set_ieee802154_ack_fpb(pkt, rx_frame->ack_fpb);
+	if (net_recv_data(nrf5_radio->iface, pkt) < 0) {
+		LOG_ERR("Packet dropped by NET stack");
+		err = -EIO;
+		goto drop;
+	}
 
-#if defined(CONFIG_NET_PKT_TIMESTAMP)
-		struct net_ptp_time timestamp = {
-			.second = rx_frame->time / USEC_PER_SEC,
-			.nanosecond =
-				(rx_frame->time % USEC_PER_SEC) * NSEC_PER_USEC
-		};
+	nrf_802154_buffer_free_raw(rx_frame->psdu);
+	rx_frame->psdu = NULL;
 
-		net_pkt_set_timestamp(pkt, &timestamp);
-#endif
+	return 0;
 
-		LOG_DBG("Caught a packet (%u) (LQI: %u)",
-			 pkt_len, rx_frame->lqi);
+drop:
+	nrf_802154_buffer_free_raw(rx_frame->psdu);
+	rx_frame->psdu = NULL;
 
-		if (net_recv_data(nrf5_radio->iface, pkt) < 0) {
-			LOG_ERR("Packet dropped by NET stack");
-			goto drop;
-		}
+	if (pkt) {
+		net_pkt_unref(pkt);
+	}
 
-		nrf_802154_buffer_free_raw(rx_frame->psdu);
-		rx_frame->psdu = NULL;
+	return err;
+}
 
-		if (LOG_LEVEL >= LOG_LEVEL_DBG) {
-			log_stack_usage(&nrf5_radio->rx_thread);
-		}
+#if !defined(CONFIG_IEEE802154_NRF5_ISR_FAST_PATH)
+static void nrf5_rx_thread(void *arg1, void *arg2, void *arg3)
+{
+	struct nrf5_802154_data *nrf5_radio = (struct nrf5_802154_data *)arg1;
+	struct nrf5_802154_rx_frame *rx_frame;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
 
-		continue;
+	while (1) {
+		LOG_DBG("Waiting for frame");
 
-drop:
-		nrf_802154_buffer_free_raw(rx_frame->psdu);
-		rx_frame->psdu = NULL;
+		rx_frame = k_fifo_get(&nrf5_radio->rx_fifo, K_FOREVER);
+
+		nrf5_rx_frame_process(nrf5_radio, rx_frame);
 
-		if (pkt) {
-			net_pkt_unref(pkt);
+		if (LOG_LEVEL >= LOG_LEVEL_DBG) {
+			log_stack_usage(&nrf5_radio->rx_thread);
 		}
 	}
 }
+#endif /* !CONFIG_IEEE802154_NRF5_ISR_FAST_PATH */
 
 /* Radio device API */
 
 static enum ieee802154_hw_caps nrf5_get_capabilities(const struct device *dev)
 {
-	return IEEE802154_HW_FCS | IEEE802154_HW_FILTER |
-	       IEEE802154_HW_CSMA | IEEE802154_HW_2_4_GHZ |
-	       IEEE802154_HW_TX_RX_ACK | IEEE802154_HW_ENERGY_SCAN |
-	       IEEE802154_HW_SLEEP_TO_TX;
+	enum ieee802154_hw_caps caps =
+		IEEE802154_HW_FCS | IEEE802154_HW_FILTER |
+		IEEE802154_HW_CSMA | IEEE802154_HW_2_4_GHZ |
+		IEEE802154_HW_TX_RX_ACK | IEEE802154_HW_ENERGY_SCAN |
+		IEEE802154_HW_SLEEP_TO_TX;
+
+#if defined(CONFIG_IEEE802154_NRF5_DELAYED_TX)
+	caps |= IEEE802154_HW_TXTIME;
+#endif
+
+	return caps;
 }
 
 static int nrf5_cca(const struct device *dev)
@@ -392,8 +418,19 @@ static int nrf5_tx(const struct device *dev,
 	case IEEE802154_TX_MODE_CSMA_CA:
 		nrf_802154_transmit_csma_ca_raw(nrf5_radio->tx_psdu);
 		break;
+#if defined(CONFIG_IEEE802154_NRF5_DELAYED_TX)
 	case IEEE802154_TX_MODE_TXTIME:
-	case IEEE802154_TX_MODE_TXTIME_CCA:
+	case IEEE802154_TX_MODE_TXTIME_CCA: {
+		uint32_t tx_at = net_pkt_txtime(pkt) / NSEC_PER_USEC;
+
+		ret = nrf_802154_transmit_raw_at(nrf5_radio->tx_psdu,
+					mode == IEEE802154_TX_MODE_TXTIME_CCA,
+					tx_at - TXTIME_OFFSET_US,
+					TXTIME_OFFSET_US,
+					nrf_802154_channel_get());
+		break;
+	}
+#endif
 	default:
 		NET_ERR("TX mode %d not supported", mode);
 		return -ENOTSUP;
@@ -481,7 +518,6 @@ static int nrf5_init(const struct device *dev)
 	const struct nrf5_802154_config *nrf5_radio_cfg = NRF5_802154_CFG(dev);
 	struct nrf5_802154_data *nrf5_radio = NRF5_802154_DATA(dev);
 
-	k_fifo_init(&nrf5_radio->rx_fifo);
 	k_sem_init(&nrf5_radio->tx_wait, 0, 1);
 	k_sem_init(&nrf5_radio->cca_wait, 0, 1);
 
@@ -489,12 +525,16 @@ static int nrf5_init(const struct device *dev)
 
 	nrf5_radio_cfg->irq_config_func(dev);
 
+#if !defined(CONFIG_IEEE802154_NRF5_ISR_FAST_PATH)
+	k_fifo_init(&nrf5_radio->rx_fifo);
+
 	k_thread_create(&nrf5_radio->rx_thread, nrf5_radio->rx_stack,
 			CONFIG_IEEE802154_NRF5_RX_STACK_SIZE,
 			nrf5_rx_thread, nrf5_radio, NULL, NULL,
 			K_PRIO_COOP(2), 0, K_NO_WAIT);
 
 	k_thread_name_set(&nrf5_radio->rx_thread, "nrf5_rx");
+#endif
 
 	LOG_INF("nRF5 802154 radio initialized");
 
@@ -609,7 +649,16 @@ void nrf_802154_received_timestamp_raw(uint8_t *data, int8_t power, uint8_t lqi,
 
 		nrf5_data.last_frame_ack_fpb = false;
 
+#if defined(CONFIG_IEEE802154_NRF5_ISR_FAST_PATH)
+		/* Hand the frame to the stack right away; the traffic
+		 * class queues inside net_recv_data() take over from
+		 * here, saving one thread hop.  Filtering and ACK
+		 * pending bit resolution already happened in hardware.
+		 */
+		nrf5_rx_frame_process(&nrf5_data, &nrf5_data.rx_frames[i]);
+#else
 		k_fifo_put(&nrf5_data.rx_fifo, &nrf5_data.rx_frames[i]);
+#endif
 
 		return;
 	}
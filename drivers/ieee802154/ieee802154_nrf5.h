@@ -30,6 +30,7 @@ struct nrf5_802154_data {
 	/* 802.15.4 HW address. */
 	uint8_t mac[8];
 
+#if !defined(CONFIG_IEEE802154_NRF5_ISR_FAST_PATH)
 	/* RX thread stack. */
 	K_KERNEL_STACK_MEMBER(rx_stack, CONFIG_IEEE802154_NRF5_RX_STACK_SIZE);
 
@@ -38,6 +39,7 @@ struct nrf5_802154_data {
 
 	/* RX fifo queue. */
 	struct k_fifo rx_fifo;
+#endif
 
 	/* Buffers for passing received frame pointers and data to the
 	 * RX thread via rx_fifo object.
@@ -205,6 +205,35 @@ static int process_cmd(struct modem_cmd *cmd, size_t match_len,
 	return ret;
 }
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_INDEX)
+/* (re)build the first-byte dispatch index of one command set */
+static void build_cmd_index(struct modem_cmd_handler_data *data, int set)
+{
+	int i;
+
+	memset(data->cmds_index[set], 0, sizeof(data->cmds_index[set]));
+	data->cmds_match_any[set] = false;
+
+	for (i = 0; i < data->cmds_len[set]; i++) {
+		uint8_t c = (uint8_t)data->cmds[set][i].cmd[0];
+
+		if (c == '\0') {
+			data->cmds_match_any[set] = true;
+		} else {
+			data->cmds_index[set][c / 32] |= BIT(c % 32);
+		}
+	}
+}
+
+/* can any command in the set match a line starting with this byte? */
+static bool cmd_index_hit(struct modem_cmd_handler_data *data, int set,
+			  uint8_t c)
+{
+	return data->cmds_match_any[set] ||
+	       (data->cmds_index[set][c / 32] & BIT(c % 32));
+}
+#endif /* CONFIG_MODEM_CMD_HANDLER_INDEX */
+
 /*
  * check 3 arrays of commands for a match in match_buf:
  * - response handlers[0]
@@ -220,7 +249,19 @@ static struct modem_cmd *find_cmd_match(struct modem_cmd_handler_data *data)
 			continue;
 		}
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_INDEX)
+		if (!cmd_index_hit(data, j, (uint8_t)data->match_buf[0])) {
+			continue;
+		}
+#endif
+
 		for (i = 0; i < data->cmds_len[j]; i++) {
+			/* cheap first-byte check before the full compare */
+			if (data->cmds[j][i].cmd_len &&
+			    data->cmds[j][i].cmd[0] != data->match_buf[0]) {
+				continue;
+			}
+
 			/* match on "empty" cmd */
 			if (strlen(data->cmds[j][i].cmd) == 0 ||
 			    strncmp(data->match_buf, data->cmds[j][i].cmd,
@@ -243,6 +284,12 @@ static struct modem_cmd *find_cmd_direct_match(
 			continue;
 		}
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_INDEX)
+		if (!cmd_index_hit(data, j, *data->rx_buf->data)) {
+			continue;
+		}
+#endif
+
 		for (i = 0; i < data->cmds_len[j]; i++) {
 			/* match start of cmd */
 			if (data->cmds[j][i].direct &&
@@ -433,6 +480,10 @@ int modem_cmd_handler_update_cmds(struct modem_cmd_handler_data *data,
 		data->last_error = 0;
 	}
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_INDEX)
+	build_cmd_index(data, CMD_HANDLER);
+#endif
+
 	return 0;
 }
 
@@ -580,6 +631,12 @@ int modem_cmd_handler_init(struct modem_cmd_handler *handler,
 	handler->cmd_handler_data = data;
 	handler->process = cmd_handler_process;
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_INDEX)
+	for (int i = 0; i < CMD_MAX; i++) {
+		build_cmd_index(data, i);
+	}
+#endif
+
 	k_sem_init(&data->sem_tx_lock, 1, 1);
 	k_sem_init(&data->sem_parse_lock, 1, 1);
 
@@ -80,6 +80,15 @@ struct modem_cmd_handler_data {
 	struct modem_cmd *cmds[CMD_MAX];
 	size_t cmds_len[CMD_MAX];
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_INDEX)
+	/* first-byte dispatch index: bit N is set when a command in the
+	 * set starts with byte N; match_any is set when the set contains
+	 * an empty (match-all) command
+	 */
+	uint32_t cmds_index[CMD_MAX][256 / 32];
+	bool cmds_match_any[CMD_MAX];
+#endif
+
 	char *read_buf;
 	size_t read_buf_len;
 
@@ -66,22 +66,27 @@ static void modem_iface_uart_isr(const struct device *uart_dev,
 	/* get all of the data off UART as fast as we can */
 	while (uart_irq_update(ctx->iface.dev) &&
 	       uart_irq_rx_ready(ctx->iface.dev)) {
-		rx = uart_fifo_read(ctx->iface.dev,
-				    data->isr_buf, data->isr_buf_len);
-		if (rx <= 0) {
-			continue;
-		}
-
-		ret = ring_buf_put(&data->rx_rb, data->isr_buf, rx);
-		if (ret != rx) {
-			LOG_ERR("Rx buffer doesn't have enough space. "
-				"Bytes pending: %d, written: %d",
-				rx, ret);
+		uint8_t *rb_buf;
+		uint32_t rb_len;
+
+		/* read directly into the ring buffer to avoid the copy
+		 * through isr_buf
+		 */
+		rb_len = ring_buf_put_claim(&data->rx_rb, &rb_buf,
+					    data->isr_buf_len);
+		if (rb_len == 0U) {
+			LOG_ERR("Rx buffer doesn't have enough space");
 			modem_iface_uart_flush(&ctx->iface);
 			k_sem_give(&data->rx_sem);
 			break;
 		}
 
+		rx = uart_fifo_read(ctx->iface.dev, rb_buf, rb_len);
+		ret = ring_buf_put_finish(&data->rx_rb, (rx > 0) ? rx : 0);
+		if (ret != 0 || rx <= 0) {
+			continue;
+		}
+
 		k_sem_give(&data->rx_sem);
 	}
 }
@@ -70,6 +70,26 @@ static int loopback_send(const struct device *dev, struct net_pkt *pkt)
 		net_ipaddr_copy(&NET_IPV4_HDR(pkt)->dst, &addr);
 	}
 
+#ifdef CONFIG_NET_LOOPBACK_ZERO_COPY
+	if (atomic_get(&pkt->atomic_ref) == 1) {
+		/* We are the sole owner, so nobody can look at the data
+		 * after delivery: re-submit the same packet instead of
+		 * cloning it.  The extra reference taken here is consumed
+		 * by the receive path; the TX path drops the original one
+		 * once we return.
+		 */
+		net_pkt_ref(pkt);
+
+		res = net_recv_data(net_pkt_iface(pkt), pkt);
+		if (res < 0) {
+			LOG_ERR("Data receive failed.");
+			net_pkt_unref(pkt);
+		}
+
+		goto out;
+	}
+#endif
+
 	/* We should simulate normal driver meaning that if the packet is
 	 * properly sent (which is always in this driver), then the packet
 	 * must be dropped. This is very much needed for TCP packets where
@@ -28,7 +28,6 @@ LOG_MODULE_REGISTER(net_ppp, LOG_LEVEL);
 #include <net/net_if.h>
 #include <net/net_core.h>
 #include <sys/ring_buffer.h>
-#include <sys/crc.h>
 #include <drivers/uart.h>
 #include <drivers/console/uart_mux.h>
 #include <random/rand32.h>
@@ -75,6 +74,15 @@ struct ppp_driver_context {
 	struct ring_buf rx_ringbuf;
 	uint8_t rx_buf[CONFIG_NET_PPP_RINGBUF_SIZE];
 
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+	/* Double buffering for the async UART reception */
+	uint8_t rx_dma_buf[2][CONFIG_NET_PPP_ASYNC_UART_RX_BUF_LEN];
+	uint8_t rx_dma_idx;
+
+	/* Signals the completion of an async transmission */
+	struct k_sem tx_done_sem;
+#endif
+
 	/* ISR function callback worker */
 	struct k_work cb_work;
 	struct k_work_q cb_workq;
@@ -95,7 +103,53 @@ struct ppp_driver_context {
 
 static struct ppp_driver_context ppp_driver_context_data;
 
-static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
+/* FCS-16 lookup table, see RFC 1662 ch. C.2 */
+static const uint16_t ppp_fcstab[256] = {
+	0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+	0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+	0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
+	0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
+	0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
+	0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
+	0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
+	0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
+	0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
+	0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
+	0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
+	0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
+	0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
+	0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
+	0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
+	0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
+	0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
+	0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
+	0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
+	0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
+	0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
+	0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
+	0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
+	0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
+	0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
+	0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
+	0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
+	0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
+	0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
+	0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
+	0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
+	0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78,
+};
+
+static uint16_t ppp_fcs16(uint16_t fcs, const uint8_t *data, size_t len)
+{
+	while (len > 0) {
+		fcs = (fcs >> 8) ^ ppp_fcstab[(fcs ^ *data++) & 0xff];
+		len--;
+	}
+
+	return fcs;
+}
+
+static int ppp_alloc_space(struct ppp_driver_context *ppp)
 {
 	int ret;
 
@@ -114,28 +168,40 @@ static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
 		ppp->available = net_pkt_available_buffer(ppp->pkt);
 	}
 
-	/* Extra debugging can be enabled separately if really
-	 * needed. Normally it would just print too much data.
-	 */
-	if (0) {
-		LOG_DBG("Saving byte %02x", byte);
-	}
-
 	/* This is not very intuitive but we must allocate new buffer
 	 * before we write a byte to last available cursor position.
 	 */
-	if (ppp->available == 1) {
+	if (ppp->available <= 1) {
 		ret = net_pkt_alloc_buffer(ppp->pkt,
 					   CONFIG_NET_BUF_DATA_SIZE,
 					   AF_UNSPEC, K_NO_WAIT);
 		if (ret < 0) {
 			LOG_ERR("[%p] cannot allocate new data buffer", ppp);
-			goto out_of_mem;
+			return -ENOMEM;
 		}
 
 		ppp->available = net_pkt_available_buffer(ppp->pkt);
 	}
 
+	return 0;
+}
+
+static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
+{
+	int ret;
+
+	ret = ppp_alloc_space(ppp);
+	if (ret < 0) {
+		goto out_of_mem;
+	}
+
+	/* Extra debugging can be enabled separately if really
+	 * needed. Normally it would just print too much data.
+	 */
+	if (0) {
+		LOG_DBG("Saving byte %02x", byte);
+	}
+
 	if (ppp->available) {
 		ret = net_pkt_write_u8(ppp->pkt, byte);
 		if (ret < 0) {
@@ -155,6 +221,44 @@ out_of_mem:
 	return -ENOMEM;
 }
 
+/* Save a span of bytes that contains no flag or escape characters */
+static int ppp_save_bytes(struct ppp_driver_context *ppp,
+			  const uint8_t *data, size_t len)
+{
+	size_t chunk;
+	int ret;
+
+	while (len > 0) {
+		ret = ppp_alloc_space(ppp);
+		if (ret < 0) {
+			goto out_of_mem;
+		}
+
+		/* Never fill the last available byte, a new buffer is
+		 * allocated for it first on the next round.
+		 */
+		chunk = MIN(len, ppp->available - 1);
+
+		ret = net_pkt_write(ppp->pkt, data, chunk);
+		if (ret < 0) {
+			LOG_ERR("[%p] Cannot write to pkt %p (%d)",
+				ppp, ppp->pkt, ret);
+			goto out_of_mem;
+		}
+
+		ppp->available -= chunk;
+		data += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+
+out_of_mem:
+	net_pkt_unref(ppp->pkt);
+	ppp->pkt = NULL;
+	return -ENOMEM;
+}
+
 static const char *ppp_driver_state_str(enum ppp_driver_state state)
 {
 #if (CONFIG_NET_PPP_LOG_LEVEL >= LOG_LEVEL_DBG)
@@ -194,13 +298,24 @@ static void ppp_change_state(struct ppp_driver_context *ctx,
 
 static int ppp_send_flush(struct ppp_driver_context *ppp, int off)
 {
-	if (!IS_ENABLED(CONFIG_NET_TEST)) {
-		uint8_t *buf = ppp->send_buf;
+	if (IS_ENABLED(CONFIG_NET_TEST)) {
+		return 0;
+	}
 
-		while (off--) {
-			uart_poll_out(ppp->dev, *buf++);
-		}
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+	if (uart_tx(ppp->dev, ppp->send_buf, off, SYS_FOREVER_MS) == 0) {
+		/* The send_buf is reused as soon as we return, so wait
+		 * until the transfer has completed.
+		 */
+		k_sem_take(&ppp->tx_done_sem, K_FOREVER);
+	}
+#else
+	uint8_t *buf = ppp->send_buf;
+
+	while (off--) {
+		uart_poll_out(ppp->dev, *buf++);
 	}
+#endif
 
 	return 0;
 }
@@ -357,12 +472,12 @@ static bool ppp_check_fcs(struct ppp_driver_context *ppp)
 		return false;
 	}
 
-	crc = crc16_ccitt(0xffff, buf->data, buf->len);
+	crc = ppp_fcs16(0xffff, buf->data, buf->len);
 
 	buf = buf->frags;
 
 	while (buf) {
-		crc = crc16_ccitt(crc, buf->data, buf->len);
+		crc = ppp_fcs16(crc, buf->data, buf->len);
 		buf = buf->frags;
 	}
 
@@ -507,15 +622,15 @@ static bool calc_fcs(struct net_pkt *pkt, uint16_t *fcs, uint16_t protocol)
 	/* HDLC Address and Control fields */
 	c = sys_cpu_to_be16(0xff << 8 | 0x03);
 
-	crc = crc16_ccitt(0xffff, (const uint8_t *)&c, sizeof(c));
+	crc = ppp_fcs16(0xffff, (const uint8_t *)&c, sizeof(c));
 
 	if (protocol > 0) {
-		crc = crc16_ccitt(crc, (const uint8_t *)&protocol,
-				  sizeof(protocol));
+		crc = ppp_fcs16(crc, (const uint8_t *)&protocol,
+				sizeof(protocol));
 	}
 
 	while (buf) {
-		crc = crc16_ccitt(crc, buf->data, buf->len);
+		crc = ppp_fcs16(crc, buf->data, buf->len);
 		buf = buf->frags;
 	}
 
@@ -525,6 +640,11 @@ static bool calc_fcs(struct net_pkt *pkt, uint16_t *fcs, uint16_t protocol)
 	return true;
 }
 
+static inline bool ppp_escape_needed(uint8_t byte)
+{
+	return byte == 0x7e || byte == 0x7d || byte < 0x20;
+}
+
 static uint16_t ppp_escape_byte(uint8_t byte, int *offset)
 {
 	if (byte == 0x7e || byte == 0x7d || byte < 0x20) {
@@ -602,13 +722,37 @@ static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 	}
 
 	while (buf) {
-		for (i = 0; i < buf->len; i++) {
-			/* Escape illegal bytes */
-			escaped = htons(ppp_escape_byte(buf->data[i], &offset));
-			send_off = ppp_send_bytes(ppp,
-						  (uint8_t *)&escaped + offset,
-						  offset ? 1 : 2,
-						  send_off);
+		i = 0;
+
+		while (i < buf->len) {
+			int span = i;
+
+			/* Pass a span of bytes that needs no escaping
+			 * in one go.
+			 */
+			while (i < buf->len &&
+			       !ppp_escape_needed(buf->data[i])) {
+				i++;
+			}
+
+			if (i > span) {
+				send_off = ppp_send_bytes(ppp,
+							  &buf->data[span],
+							  i - span,
+							  send_off);
+			}
+
+			if (i < buf->len) {
+				/* Escape illegal bytes */
+				escaped = htons(ppp_escape_byte(buf->data[i],
+								&offset));
+				send_off = ppp_send_bytes(ppp,
+							  (uint8_t *)&escaped +
+							  offset,
+							  offset ? 1 : 2,
+							  send_off);
+				i++;
+			}
 		}
 
 		buf = buf->frags;
@@ -653,14 +797,40 @@ static int ppp_consume_ringbuf(struct ppp_driver_context *ppp)
 
 	tmp = len;
 
-	do {
+	while (tmp > 0) {
+		if (ppp->state == STATE_HDLC_FRAME_DATA &&
+		    !ppp->next_escaped) {
+			/* Save a whole span of bytes without flag or
+			 * escape characters in one go.
+			 */
+			size_t span = 0;
+
+			while (span < tmp && data[span] != 0x7e &&
+			       data[span] != 0x7d) {
+				span++;
+			}
+
+			if (span > 0) {
+				if (ppp_save_bytes(ppp, data, span) < 0) {
+					ppp_change_state(
+						ppp, STATE_HDLC_FRAME_START);
+				}
+
+				data += span;
+				tmp -= span;
+				continue;
+			}
+		}
+
 		if (ppp_input_byte(ppp, *data++) == 0) {
 			/* Ignore empty or too short frames */
 			if (ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
 				ppp_process_msg(ppp);
 			}
 		}
-	} while (--tmp);
+
+		tmp--;
+	}
 
 	ret = ring_buf_get_finish(&ppp->rx_ringbuf, len);
 	if (ret < 0) {
@@ -692,6 +862,10 @@ static int ppp_driver_init(const struct device *dev)
 	ring_buf_init(&ppp->rx_ringbuf, sizeof(ppp->rx_buf), ppp->rx_buf);
 	k_work_init(&ppp->cb_work, ppp_isr_cb_work);
 
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+	k_sem_init(&ppp->tx_done_sem, 0, 1);
+#endif
+
 	k_work_q_start(&ppp->cb_workq, ppp_workq,
 		       K_KERNEL_STACK_SIZEOF(ppp_workq),
 		       K_PRIO_COOP(PPP_WORKQ_PRIORITY));
@@ -775,6 +949,52 @@ static struct net_stats_ppp *ppp_get_stats(const struct device *dev)
 #endif
 
 #if !defined(CONFIG_NET_TEST)
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+static void ppp_uart_async_cb(const struct device *uart,
+			      struct uart_event *evt, void *user_data)
+{
+	struct ppp_driver_context *context = user_data;
+	uint32_t written;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		k_sem_give(&context->tx_done_sem);
+		break;
+
+	case UART_RX_RDY:
+		written = ring_buf_put(&context->rx_ringbuf,
+				       evt->data.rx.buf + evt->data.rx.offset,
+				       evt->data.rx.len);
+		if (written < evt->data.rx.len) {
+			LOG_ERR("Rx buffer doesn't have enough space. "
+				"Bytes pending: %d, written: %d",
+				(int)evt->data.rx.len, (int)written);
+		}
+
+		k_work_submit_to_queue(&context->cb_workq, &context->cb_work);
+		break;
+
+	case UART_RX_BUF_REQUEST:
+		context->rx_dma_idx ^= 1;
+		(void)uart_rx_buf_rsp(uart,
+				      context->rx_dma_buf[context->rx_dma_idx],
+				      sizeof(context->rx_dma_buf[0]));
+		break;
+
+	case UART_RX_DISABLED:
+		/* Restart the reception, e.g. after an RX error */
+		context->rx_dma_idx = 0U;
+		(void)uart_rx_enable(uart, context->rx_dma_buf[0],
+				     sizeof(context->rx_dma_buf[0]),
+				     CONFIG_NET_PPP_ASYNC_UART_RX_TIMEOUT);
+		break;
+
+	default:
+		break;
+	}
+}
+#else /* CONFIG_NET_PPP_ASYNC_UART */
 static void ppp_uart_flush(const struct device *dev)
 {
 	uint8_t c;
@@ -807,6 +1027,7 @@ static void ppp_uart_isr(const struct device *uart, void *user_data)
 		k_work_submit_to_queue(&context->cb_workq, &context->cb_work);
 	}
 }
+#endif /* CONFIG_NET_PPP_ASYNC_UART */
 #endif /* !CONFIG_NET_TEST */
 
 static int ppp_start(const struct device *dev)
@@ -855,12 +1076,33 @@ static int ppp_start(const struct device *dev)
 			return -ENODEV;
 		}
 
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+		int ret;
+
+		ret = uart_callback_set(context->dev, ppp_uart_async_cb,
+					context);
+		if (ret < 0) {
+			LOG_ERR("Cannot set async UART callback (%d)", ret);
+			return ret;
+		}
+
+		context->rx_dma_idx = 0U;
+
+		ret = uart_rx_enable(context->dev, context->rx_dma_buf[0],
+				     sizeof(context->rx_dma_buf[0]),
+				     CONFIG_NET_PPP_ASYNC_UART_RX_TIMEOUT);
+		if (ret < 0) {
+			LOG_ERR("Cannot enable async reception (%d)", ret);
+			return ret;
+		}
+#else
 		uart_irq_rx_disable(context->dev);
 		uart_irq_tx_disable(context->dev);
 		ppp_uart_flush(context->dev);
 		uart_irq_callback_user_data_set(context->dev, ppp_uart_isr,
 						context);
 		uart_irq_rx_enable(context->dev);
+#endif
 	}
 #endif /* !CONFIG_NET_TEST */
 
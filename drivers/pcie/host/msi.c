@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <kernel.h>
 #include <stdbool.h>
+#include <sys/sys_io.h>
 #include <drivers/pcie/pcie.h>
 #include <drivers/pcie/msi.h>
 
@@ -66,3 +68,110 @@ bool pcie_set_msi(pcie_bdf_t bdf, unsigned int irq)
 
 	return success;
 }
+
+#ifdef CONFIG_PCIE_MSIX
+
+/*
+ * Locate the MSI-X vector table in one of the endpoint's BARs. The
+ * BAR indicator is a raw BAR register number, so the BAR is read
+ * directly instead of going through pcie_get_mbar(), which counts
+ * memory regions.
+ */
+static mem_addr_t pcie_msix_table(pcie_bdf_t bdf, uint32_t base)
+{
+	uint32_t offset_bir;
+	uint64_t bar;
+	uint32_t reg;
+
+	offset_bir = pcie_conf_read(bdf, base + PCIE_MSIX_TR);
+	reg = PCIE_CONF_BAR0 + PCIE_MSIX_TR_BIR(offset_bir);
+	if (reg > PCIE_CONF_BAR5) {
+		return 0U;
+	}
+
+	bar = pcie_conf_read(bdf, reg);
+	if (!PCIE_CONF_BAR_MEM(bar)) {
+		return 0U;
+	}
+
+	if (PCIE_CONF_BAR_64(bar)) {
+		bar = PCIE_CONF_BAR_ADDR(bar) |
+		      (((uint64_t)pcie_conf_read(bdf, reg + 1U)) << 32);
+	} else {
+		bar = PCIE_CONF_BAR_ADDR(bar);
+	}
+
+	return (mem_addr_t)(bar + PCIE_MSIX_TR_OFFSET(offset_bir));
+}
+
+uint32_t pcie_msix_vectors(pcie_bdf_t bdf)
+{
+	uint32_t base;
+
+	base = pcie_get_cap(bdf, PCIE_MSIX_CAP_ID);
+	if (base == 0U) {
+		return 0U;
+	}
+
+	return PCIE_MSIX_MCR_TBL_SIZE(pcie_conf_read(bdf,
+						     base + PCIE_MSIX_MCR));
+}
+
+bool pcie_set_msix(pcie_bdf_t bdf, struct pcie_msix_vector *vectors,
+		   uint32_t n_vector)
+{
+	mem_addr_t table;
+	uint32_t base;
+	uint32_t mcr;
+	uint32_t i;
+
+	base = pcie_get_cap(bdf, PCIE_MSIX_CAP_ID);
+	if (base == 0U) {
+		return false;
+	}
+
+	mcr = pcie_conf_read(bdf, base + PCIE_MSIX_MCR);
+	if (n_vector > PCIE_MSIX_MCR_TBL_SIZE(mcr)) {
+		return false;
+	}
+
+	table = pcie_msix_table(bdf, base);
+	if (table == 0U) {
+		return false;
+	}
+
+	/* Mask the whole function while the table is being programmed */
+	pcie_conf_write(bdf, base + PCIE_MSIX_MCR,
+			mcr | PCIE_MSIX_MCR_EN | PCIE_MSIX_MCR_FMASK);
+
+	for (i = 0U; i < n_vector; i++) {
+		mem_addr_t entry = table + i * PCIE_MSIX_VECTOR_SIZE;
+		struct pcie_msix_vector *vector = &vectors[i];
+
+		sys_write32(pcie_msi_map(vector->irq),
+			    entry + PCIE_MSIX_VECTOR_MAP0);
+		sys_write32(0U, entry + PCIE_MSIX_VECTOR_MAP1);
+		sys_write32(pcie_msi_mdr(vector->irq),
+			    entry + PCIE_MSIX_VECTOR_MDR);
+
+#ifdef CONFIG_DYNAMIC_INTERRUPTS
+		if (vector->handler != NULL) {
+			irq_connect_dynamic(vector->irq, vector->priority,
+					    vector->handler,
+					    vector->parameter, 0U);
+		}
+#endif
+		irq_enable(vector->irq);
+
+		sys_write32(0U, entry + PCIE_MSIX_VECTOR_CTRL);
+	}
+
+	mcr |= PCIE_MSIX_MCR_EN;
+	mcr &= ~PCIE_MSIX_MCR_FMASK;
+	pcie_conf_write(bdf, base + PCIE_MSIX_MCR, mcr);
+	pcie_set_cmd(bdf, PCIE_CONF_CMDSTAT_MASTER, true);
+
+	return true;
+}
+
+#endif /* CONFIG_PCIE_MSIX */
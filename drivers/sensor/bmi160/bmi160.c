@@ -416,6 +416,27 @@ static int  bmi160_acc_calibrate(const struct device *dev,
 				       BIT(BMI160_ACC_OFS_EN_POS), 1);
 }
 
+#if defined(CONFIG_BMI160_FIFO)
+static int bmi160_acc_wm_set(const struct device *dev, int32_t level)
+{
+	uint32_t wm_bytes = level * BMI160_FIFO_ACC_FRAME_SIZE;
+
+	if (level < 1 || wm_bytes > BMI160_FIFO_SIZE) {
+		return -EINVAL;
+	}
+
+	/* the watermark register counts in units of 4 bytes */
+	if (bmi160_byte_write(dev, BMI160_REG_FIFO_CONFIG0,
+			      wm_bytes / BMI160_FIFO_WM_UNIT) < 0) {
+		return -EIO;
+	}
+
+	/* headerless accel-only frames */
+	return bmi160_byte_write(dev, BMI160_REG_FIFO_CONFIG1,
+				 BMI160_FIFO_ACC_EN);
+}
+#endif /* CONFIG_BMI160_FIFO */
+
 static int bmi160_acc_config(const struct device *dev,
 			     enum sensor_channel chan,
 			     enum sensor_attribute attr,
@@ -438,6 +459,10 @@ static int bmi160_acc_config(const struct device *dev,
 	case SENSOR_ATTR_SLOPE_TH:
 	case SENSOR_ATTR_SLOPE_DUR:
 		return bmi160_acc_slope_config(dev, attr, val);
+#endif
+#if defined(CONFIG_BMI160_FIFO)
+	case SENSOR_ATTR_FIFO_WATERMARK:
+		return bmi160_acc_wm_set(dev, val->val1);
 #endif
 	default:
 		LOG_DBG("Accel attribute not supported.");
@@ -742,6 +767,68 @@ static inline void bmi160_acc_channel_get(const struct device *dev,
 }
 #endif
 
+#if defined(CONFIG_BMI160_FIFO)
+static int bmi160_batch_read(const struct device *dev,
+			     enum sensor_channel chan,
+			     struct sensor_batch *batch)
+{
+	uint16_t fifo_bytes = 0U;
+	uint16_t count;
+
+	if (chan != SENSOR_CHAN_ACCEL_XYZ) {
+		return -ENOTSUP;
+	}
+
+	if (bmi160_word_read(dev, BMI160_REG_FIFO_LENGTH0, &fifo_bytes) < 0) {
+		return -EIO;
+	}
+
+	count = MIN((fifo_bytes & BIT_MASK(11)) / BMI160_FIFO_ACC_FRAME_SIZE,
+		    batch->count);
+
+	/* the bus helpers take the transfer length as a byte */
+	count = MIN(count, UINT8_MAX / BMI160_FIFO_ACC_FRAME_SIZE);
+
+	if (count == 0U) {
+		batch->count = 0U;
+		return 0;
+	}
+
+	if (bmi160_read(dev, BMI160_REG_FIFO_DATA, batch->samples,
+			count * BMI160_FIFO_ACC_FRAME_SIZE) < 0) {
+		return -EIO;
+	}
+
+	batch->sample_size = BMI160_FIFO_ACC_FRAME_SIZE;
+	batch->count = count;
+
+	return 0;
+}
+
+static int bmi160_batch_decode(const struct device *dev,
+			       enum sensor_channel chan,
+			       const struct sensor_batch *batch,
+			       uint16_t index, struct sensor_value *val)
+{
+	struct bmi160_device_data *bmi160 = dev->data;
+	const uint8_t *frame;
+	int i;
+
+	if (chan != SENSOR_CHAN_ACCEL_XYZ || index >= batch->count) {
+		return -EINVAL;
+	}
+
+	frame = &batch->samples[index * batch->sample_size];
+
+	for (i = 0; i < 3; i++, val++) {
+		bmi160_to_fixed_point((int16_t)sys_get_le16(&frame[i * 2]),
+				      bmi160->scale.acc, val);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BMI160_FIFO */
+
 static int bmi160_temp_channel_get(const struct device *dev,
 				   struct sensor_value *val)
 {
@@ -804,6 +891,10 @@ static const struct sensor_driver_api bmi160_api = {
 #endif
 	.sample_fetch = bmi160_sample_fetch,
 	.channel_get = bmi160_channel_get,
+#if defined(CONFIG_BMI160_FIFO)
+	.batch_read = bmi160_batch_read,
+	.batch_decode = bmi160_batch_decode,
+#endif
 };
 
 int bmi160_init(const struct device *dev)
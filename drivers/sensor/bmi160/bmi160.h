@@ -178,6 +178,18 @@
 #define BMI160_GYR_CONF_BWP_POS	4
 #define BMI160_GYR_CONF_BWP_MASK	(0x3 << 4)
 
+/* BMI160_REG_FIFO_CONFIG0 */
+#define BMI160_FIFO_WM_UNIT		4
+
+/* BMI160_REG_FIFO_CONFIG1 */
+#define BMI160_FIFO_GYR_EN		BIT(7)
+#define BMI160_FIFO_ACC_EN		BIT(6)
+#define BMI160_FIFO_MAG_EN		BIT(5)
+#define BMI160_FIFO_HEADER_EN		BIT(4)
+
+#define BMI160_FIFO_ACC_FRAME_SIZE	(3 * sizeof(uint16_t))
+#define BMI160_FIFO_SIZE		1024
+
 /* BMI160_REG_OFFSET_EN */
 #define BMI160_GYR_OFS_EN_POS		7
 #define BMI160_ACC_OFS_EN_POS		6
@@ -451,6 +463,9 @@ struct bmi160_device_data {
 #if !defined(CONFIG_BMI160_ACCEL_PMU_SUSPEND)
 	sensor_trigger_handler_t handler_drdy_acc;
 	sensor_trigger_handler_t handler_anymotion;
+#if defined(CONFIG_BMI160_FIFO)
+	sensor_trigger_handler_t handler_fwm;
+#endif
 #endif
 #if !defined(CONFIG_BMI160_GYRO_PMU_SUSPEND)
 	sensor_trigger_handler_t handler_drdy_gyr;
@@ -49,6 +49,21 @@ static void bmi160_handle_drdy(const struct device *dev, uint8_t status)
 #endif
 }
 
+#if defined(CONFIG_BMI160_FIFO)
+static void bmi160_handle_fwm(const struct device *dev)
+{
+	struct bmi160_device_data *bmi160 = dev->data;
+	struct sensor_trigger fwm_trigger = {
+		.type = SENSOR_TRIG_FIFO_WATERMARK,
+		.chan = SENSOR_CHAN_ACCEL_XYZ,
+	};
+
+	if (bmi160->handler_fwm) {
+		bmi160->handler_fwm(dev, &fwm_trigger);
+	}
+}
+#endif
+
 static void bmi160_handle_interrupts(const struct device *dev)
 {
 	union {
@@ -75,6 +90,11 @@ static void bmi160_handle_interrupts(const struct device *dev)
 		bmi160_handle_drdy(dev, buf.status);
 	}
 
+#if defined(CONFIG_BMI160_FIFO)
+	if (buf.int_status[1] & BMI160_INT_STATUS1_FWM) {
+		bmi160_handle_fwm(dev);
+	}
+#endif
 }
 
 #ifdef CONFIG_BMI160_TRIGGER_OWN_THREAD
@@ -176,6 +196,28 @@ static int bmi160_trigger_anym_set(const struct device *dev,
 	return 0;
 }
 
+#if defined(CONFIG_BMI160_FIFO)
+static int bmi160_trigger_fwm_set(const struct device *dev,
+				  sensor_trigger_handler_t handler)
+{
+	struct bmi160_device_data *bmi160 = dev->data;
+	uint8_t fwm_en = 0U;
+
+	bmi160->handler_fwm = handler;
+
+	if (handler) {
+		fwm_en = BMI160_INT_FWM_EN;
+	}
+
+	if (bmi160_reg_update(dev, BMI160_REG_INT_EN1,
+			      BMI160_INT_FWM_EN, fwm_en) < 0) {
+		return -EIO;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BMI160_FIFO */
+
 static int bmi160_trigger_set_acc(const struct device *dev,
 				  const struct sensor_trigger *trig,
 				  sensor_trigger_handler_t handler)
@@ -184,6 +226,10 @@ static int bmi160_trigger_set_acc(const struct device *dev,
 		return bmi160_trigger_drdy_set(dev, trig->chan, handler);
 	} else if (trig->type == SENSOR_TRIG_DELTA) {
 		return bmi160_trigger_anym_set(dev, handler);
+#if defined(CONFIG_BMI160_FIFO)
+	} else if (trig->type == SENSOR_TRIG_FIFO_WATERMARK) {
+		return bmi160_trigger_fwm_set(dev, handler);
+#endif
 	}
 
 	return -ENOTSUP;
@@ -121,6 +121,95 @@ static int lis2dh_sample_fetch(const struct device *dev,
 	return -ENODATA;
 }
 
+#ifdef CONFIG_LIS2DH_FIFO
+static int lis2dh_batch_read(const struct device *dev,
+			     enum sensor_channel chan,
+			     struct sensor_batch *batch)
+{
+	struct lis2dh_data *lis2dh = dev->data;
+	uint8_t fifo_src;
+	uint16_t count;
+	int status;
+
+	if (chan != SENSOR_CHAN_ACCEL_XYZ) {
+		return -ENOTSUP;
+	}
+
+	status = lis2dh->hw_tf->read_reg(dev, LIS2DH_REG_FIFO_SRC, &fifo_src);
+	if (status < 0) {
+		return status;
+	}
+
+	count = MIN(fifo_src & LIS2DH_FIFO_SRC_FSS_MASK, batch->count);
+	if (count == 0U) {
+		batch->count = 0U;
+		return 0;
+	}
+
+	/*
+	 * in FIFO mode the output register address wraps from OUT_Z_H
+	 * back to OUT_X_L, so the whole batch is one burst read
+	 */
+	status = lis2dh->hw_tf->read_data(dev, LIS2DH_REG_ACCEL_X_LSB,
+					  batch->samples,
+					  count * LIS2DH_FIFO_SAMPLE_SIZE);
+	if (status < 0) {
+		LOG_WRN("Could not read FIFO data");
+		return status;
+	}
+
+	batch->sample_size = LIS2DH_FIFO_SAMPLE_SIZE;
+	batch->count = count;
+
+	return 0;
+}
+
+static int lis2dh_batch_decode(const struct device *dev,
+			       enum sensor_channel chan,
+			       const struct sensor_batch *batch,
+			       uint16_t index, struct sensor_value *val)
+{
+	struct lis2dh_data *lis2dh = dev->data;
+	const uint8_t *frame;
+	int i;
+
+	if (chan != SENSOR_CHAN_ACCEL_XYZ || index >= batch->count) {
+		return -EINVAL;
+	}
+
+	frame = &batch->samples[index * batch->sample_size];
+
+	for (i = 0; i < 3; i++, val++) {
+		lis2dh_convert((int16_t)sys_get_le16(&frame[i * 2]),
+			       lis2dh->scale, val);
+	}
+
+	return 0;
+}
+
+static int lis2dh_acc_wm_set(const struct device *dev, int32_t level)
+{
+	struct lis2dh_data *lis2dh = dev->data;
+	int status;
+
+	if (level < 1 || level > LIS2DH_FIFO_MAX_LEVEL) {
+		return -EINVAL;
+	}
+
+	/* the watermark flag is set when more than FTH samples are stored */
+	status = lis2dh->hw_tf->write_reg(dev, LIS2DH_REG_FIFO_CTRL,
+					  LIS2DH_FIFO_MODE_STREAM |
+					  ((level - 1) &
+					   LIS2DH_FIFO_FTH_MASK));
+	if (status < 0) {
+		return status;
+	}
+
+	return lis2dh->hw_tf->update_reg(dev, LIS2DH_REG_CTRL5,
+					 LIS2DH_EN_FIFO, LIS2DH_EN_FIFO);
+}
+#endif /* CONFIG_LIS2DH_FIFO */
+
 #ifdef CONFIG_LIS2DH_ODR_RUNTIME
 /* 1620 & 5376 are low power only */
 static const uint16_t lis2dh_odr_map[] = {0, 1, 10, 25, 50, 100, 200, 400, 1620,
@@ -232,6 +321,10 @@ static int lis2dh_acc_config(const struct device *dev,
 	case SENSOR_ATTR_SLOPE_TH:
 	case SENSOR_ATTR_SLOPE_DUR:
 		return lis2dh_acc_slope_config(dev, attr, val);
+#endif
+#ifdef CONFIG_LIS2DH_FIFO
+	case SENSOR_ATTR_FIFO_WATERMARK:
+		return lis2dh_acc_wm_set(dev, val->val1);
 #endif
 	default:
 		LOG_DBG("Accel attribute not supported.");
@@ -266,6 +359,10 @@ static const struct sensor_driver_api lis2dh_driver_api = {
 #endif
 	.sample_fetch = lis2dh_sample_fetch,
 	.channel_get = lis2dh_channel_get,
+#ifdef CONFIG_LIS2DH_FIFO
+	.batch_read = lis2dh_batch_read,
+	.batch_decode = lis2dh_batch_decode,
+#endif
 };
 
 int lis2dh_init(const struct device *dev)
@@ -106,6 +106,34 @@ static int lis2dh_start_trigger_int1(const struct device *dev)
 					 LIS2DH_EN_DRDY1_INT1);
 }
 
+#ifdef CONFIG_LIS2DH_FIFO
+static int lis2dh_trigger_wtm_set(const struct device *dev,
+				  sensor_trigger_handler_t handler)
+{
+	struct lis2dh_data *lis2dh = dev->data;
+	int status;
+
+	setup_int1(dev, false);
+
+	/* cancel potentially pending trigger */
+	atomic_clear_bit(&lis2dh->trig_flags, TRIGGED_INT1);
+
+	status = lis2dh->hw_tf->update_reg(dev, LIS2DH_REG_CTRL3,
+					   LIS2DH_EN_WTM_INT1, 0);
+
+	lis2dh->handler_wtm = handler;
+	if ((handler == NULL) || (status < 0)) {
+		return status;
+	}
+
+	setup_int1(dev, true);
+
+	return lis2dh->hw_tf->update_reg(dev, LIS2DH_REG_CTRL3,
+					 LIS2DH_EN_WTM_INT1,
+					 LIS2DH_EN_WTM_INT1);
+}
+#endif /* CONFIG_LIS2DH_FIFO */
+
 #if DT_INST_PROP_HAS_IDX(0, irq_gpios, 1)
 #define LIS2DH_ANYM_CFG (LIS2DH_INT_CFG_ZHIE_ZUPE | LIS2DH_INT_CFG_YHIE_YUPE |\
 			 LIS2DH_INT_CFG_XHIE_XUPE)
@@ -175,6 +203,11 @@ int lis2dh_trigger_set(const struct device *dev,
 	if (trig->type == SENSOR_TRIG_DATA_READY &&
 	    trig->chan == SENSOR_CHAN_ACCEL_XYZ) {
 		return lis2dh_trigger_drdy_set(dev, trig->chan, handler);
+#ifdef CONFIG_LIS2DH_FIFO
+	} else if (trig->type == SENSOR_TRIG_FIFO_WATERMARK &&
+		   trig->chan == SENSOR_CHAN_ACCEL_XYZ) {
+		return lis2dh_trigger_wtm_set(dev, handler);
+#endif
 #if DT_INST_PROP_HAS_IDX(0, irq_gpios, 1)
 	} else if (trig->type == SENSOR_TRIG_DELTA) {
 		return lis2dh_trigger_anym_set(dev, handler);
@@ -308,6 +341,18 @@ static void lis2dh_thread_cb(const struct device *dev)
 			.chan = lis2dh->chan_drdy,
 		};
 
+#ifdef CONFIG_LIS2DH_FIFO
+		if (lis2dh->handler_wtm != NULL) {
+			struct sensor_trigger wtm_trigger = {
+				.type = SENSOR_TRIG_FIFO_WATERMARK,
+				.chan = SENSOR_CHAN_ACCEL_XYZ,
+			};
+
+			lis2dh->handler_wtm(dev, &wtm_trigger);
+
+			return;
+		}
+#endif
 		if (likely(lis2dh->handler_drdy != NULL)) {
 			lis2dh->handler_drdy(dev, &drdy_trigger);
 		}
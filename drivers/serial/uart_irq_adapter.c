@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <drivers/uart_irq_adapter.h>
+#include <sys/util.h>
+
+static inline uint32_t rx_used_get(struct uart_irq_adapter *adapter)
+{
+	return ring_buf_capacity_get(adapter->rx_rb) -
+	       ring_buf_space_get(adapter->rx_rb);
+}
+
+static void uart_irq_adapter_rx(const struct device *dev,
+				struct uart_irq_adapter *adapter)
+{
+	uint8_t *data;
+	uint32_t size;
+	int rd;
+
+	/* Drain the hardware FIFO completely on each interrupt instead of
+	 * reading it byte by byte.
+	 */
+	for (;;) {
+		size = ring_buf_put_claim(adapter->rx_rb, &data,
+					  ring_buf_capacity_get(adapter->rx_rb));
+		if (size == 0) {
+			/* Ring buffer is full. Throttle reception until the
+			 * consumer has read data out.
+			 */
+			uart_irq_rx_disable(dev);
+			adapter->rx_stopped = true;
+			break;
+		}
+
+		rd = uart_fifo_read(dev, data, size);
+		if (rd < 0) {
+			rd = 0;
+		}
+
+		ring_buf_put_finish(adapter->rx_rb, rd);
+
+		if (rd < size) {
+			/* FIFO is empty */
+			break;
+		}
+	}
+
+	if (adapter->rx_cb &&
+	    (adapter->rx_stopped || rx_used_get(adapter) >= adapter->rx_watermark)) {
+		adapter->rx_cb(dev, adapter, adapter->user_data);
+	}
+}
+
+static void uart_irq_adapter_tx(const struct device *dev,
+				struct uart_irq_adapter *adapter)
+{
+	uint8_t *data;
+	uint32_t size;
+	int wr;
+
+	size = ring_buf_get_claim(adapter->tx_rb, &data,
+				  ring_buf_capacity_get(adapter->tx_rb));
+	if (size == 0) {
+		uart_irq_tx_disable(dev);
+
+		if (adapter->tx_cb) {
+			adapter->tx_cb(dev, adapter, adapter->user_data);
+		}
+
+		return;
+	}
+
+	wr = uart_fifo_fill(dev, data, size);
+	if (wr < 0) {
+		wr = 0;
+	}
+
+	ring_buf_get_finish(adapter->tx_rb, wr);
+}
+
+static void uart_irq_adapter_isr(const struct device *dev, void *user_data)
+{
+	struct uart_irq_adapter *adapter = user_data;
+
+	while (uart_irq_update(dev) && uart_irq_is_pending(dev)) {
+		if (uart_irq_rx_ready(dev)) {
+			uart_irq_adapter_rx(dev, adapter);
+		}
+
+		if (uart_irq_tx_ready(dev)) {
+			uart_irq_adapter_tx(dev, adapter);
+		}
+	}
+}
+
+int uart_irq_adapter_init(struct uart_irq_adapter *adapter,
+			  const struct device *dev,
+			  struct ring_buf *rx_rb, struct ring_buf *tx_rb,
+			  uint32_t rx_watermark,
+			  uart_irq_adapter_cb_t rx_cb,
+			  uart_irq_adapter_cb_t tx_cb,
+			  void *user_data)
+{
+	if (adapter == NULL || dev == NULL || rx_rb == NULL || tx_rb == NULL) {
+		return -EINVAL;
+	}
+
+	adapter->dev = dev;
+	adapter->rx_rb = rx_rb;
+	adapter->tx_rb = tx_rb;
+	adapter->rx_cb = rx_cb;
+	adapter->tx_cb = tx_cb;
+	adapter->user_data = user_data;
+	adapter->rx_watermark = rx_watermark;
+	adapter->rx_stopped = false;
+
+	uart_irq_rx_disable(dev);
+	uart_irq_tx_disable(dev);
+
+	uart_irq_callback_user_data_set(dev, uart_irq_adapter_isr, adapter);
+
+	uart_irq_rx_enable(dev);
+
+	return 0;
+}
+
+size_t uart_irq_adapter_read(struct uart_irq_adapter *adapter,
+			     uint8_t *data, size_t len)
+{
+	uint32_t read;
+
+	read = ring_buf_get(adapter->rx_rb, data, len);
+
+	if (adapter->rx_stopped &&
+	    ring_buf_space_get(adapter->rx_rb) > 0) {
+		adapter->rx_stopped = false;
+		uart_irq_rx_enable(adapter->dev);
+	}
+
+	return read;
+}
+
+size_t uart_irq_adapter_write(struct uart_irq_adapter *adapter,
+			      const uint8_t *data, size_t len)
+{
+	uint32_t written;
+
+	written = ring_buf_put(adapter->tx_rb, data, len);
+	if (written > 0) {
+		uart_irq_tx_enable(adapter->dev);
+	}
+
+	return written;
+}
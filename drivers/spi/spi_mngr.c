@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <drivers/spi_mngr.h>
+
+/* Queued transaction manager for SPI devices.
+ *
+ * All managers share one dedicated work queue. A manager's work item
+ * drains its transaction queue in one go, so pending transactions run
+ * back-to-back while the manager owns the bus; drivers keep the last
+ * applied configuration, so same-config transactions skip controller
+ * setup entirely. Completion is reported per transaction through a
+ * callback and/or a k_poll_signal.
+ */
+
+static struct k_work_q spi_mngr_q;
+static K_KERNEL_STACK_DEFINE(spi_mngr_stack, CONFIG_SPI_MNGR_STACK_SIZE);
+
+static void spi_mngr_work_handler(struct k_work *work)
+{
+	struct spi_mngr *mngr = CONTAINER_OF(work, struct spi_mngr, work);
+	struct spi_mngr_transaction *trans;
+
+	while ((trans = k_fifo_get(&mngr->fifo, K_NO_WAIT)) != NULL) {
+		int result = spi_transceive(mngr->dev, trans->config,
+					    trans->tx_bufs, trans->rx_bufs);
+
+		if (trans->callback != NULL) {
+			trans->callback(trans, result);
+		}
+
+		if (trans->async != NULL) {
+			k_poll_signal_raise(trans->async, result);
+		}
+	}
+}
+
+void spi_mngr_init(struct spi_mngr *mngr, const struct device *dev)
+{
+	mngr->dev = dev;
+	k_fifo_init(&mngr->fifo);
+	k_work_init(&mngr->work, spi_mngr_work_handler);
+}
+
+int spi_mngr_submit(struct spi_mngr *mngr, struct spi_mngr_transaction *trans)
+{
+	if ((trans->config == NULL) ||
+	    ((trans->tx_bufs == NULL) && (trans->rx_bufs == NULL))) {
+		return -EINVAL;
+	}
+
+	k_fifo_put(&mngr->fifo, trans);
+	k_work_submit_to_queue(&spi_mngr_q, &mngr->work);
+
+	return 0;
+}
+
+static int spi_mngr_q_init(const struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_work_q_start(&spi_mngr_q, spi_mngr_stack,
+		       K_KERNEL_STACK_SIZEOF(spi_mngr_stack),
+		       CONFIG_SPI_MNGR_PRIORITY);
+	k_thread_name_set(&spi_mngr_q.thread, "spi_mngr");
+
+	return 0;
+}
+
+SYS_INIT(spi_mngr_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -62,6 +62,16 @@ static uint32_t announced_cycles;
  */
 static volatile uint32_t overflow_cyc;
 
+#ifdef CONFIG_HR_TIMER
+/* Absolute cycle count of the pending high-resolution alarm.  SysTick
+ * has a single comparator, so sub-tick deadlines are met by clamping
+ * whatever interval gets programmed into SysTick.LOAD; the ISR then
+ * reports expiration once 'cycle_count' has reached the target.
+ */
+static uint32_t hr_target;
+static bool hr_armed;
+#endif
+
 /* This internal function calculates the amount of HW cycles that have
  * elapsed since the last time the absolute HW cycles counter has been
  * updated. 'cycle_count' may be updated either by the ISR, or when we
@@ -127,6 +137,13 @@ void z_clock_isr(void *arg)
 	cycle_count += overflow_cyc;
 	overflow_cyc = 0;
 
+#ifdef CONFIG_HR_TIMER
+	if (hr_armed && (int32_t)(hr_target - cycle_count) <= 0) {
+		hr_armed = false;
+		z_clock_hr_expired();
+	}
+#endif
+
 	if (TICKLESS) {
 		/* In TICKLESS mode, the SysTick.LOAD is re-programmed
 		 * in z_clock_set_timeout(), followed by resetting of
@@ -218,6 +235,19 @@ void z_clock_set_timeout(int32_t ticks, bool idle)
 			last_load = delay;
 		}
 	}
+
+#ifdef CONFIG_HR_TIMER
+	/* Never program past a pending high-resolution deadline */
+	if (hr_armed) {
+		uint32_t hr_delay = hr_target - cycle_count;
+
+		if ((int32_t)hr_delay < (int32_t)MIN_DELAY) {
+			hr_delay = MIN_DELAY;
+		}
+		last_load = MIN(last_load, hr_delay);
+	}
+#endif
+
 	SysTick->LOAD = last_load - 1;
 	SysTick->VAL = 0; /* resets timer to last_load */
 
@@ -225,6 +255,45 @@ void z_clock_set_timeout(int32_t ticks, bool idle)
 #endif
 }
 
+#ifdef CONFIG_HR_TIMER
+void z_clock_hr_set(uint32_t cycles)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t delta;
+
+	hr_target = cycles;
+	hr_armed = true;
+
+	cycle_count += elapsed();
+	overflow_cyc = 0U;
+
+	delta = cycles - cycle_count;
+	if ((int32_t)delta < (int32_t)MIN_DELAY) {
+		delta = MIN_DELAY;
+	}
+
+	/* Shorten the running interval if the new deadline lands
+	 * before the next programmed interrupt; extending it is left
+	 * to the regular z_clock_set_timeout() clamping.
+	 */
+	if (last_load != TIMER_STOPPED && delta < SysTick->VAL) {
+		last_load = delta;
+		SysTick->LOAD = last_load - 1;
+		SysTick->VAL = 0; /* resets timer to last_load */
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void z_clock_hr_cancel(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	hr_armed = false;
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_HR_TIMER */
+
 uint32_t z_clock_elapsed(void)
 {
 	if (!TICKLESS) {
@@ -166,9 +166,59 @@ static void set_protected_absolute_alarm(uint32_t cycles)
  * it by pointer at runtime, maybe?) so we don't have this leaky
  * symbol.
  */
+#ifdef CONFIG_HR_TIMER
+/* Cycle-granularity alarm on CC[1]; CC[0] stays dedicated to ticks.
+ * Deadlines beyond the comparator's safe span are clipped, firing
+ * early: the kernel's high-resolution timer core re-arms until the
+ * requested cycle is reached.
+ */
+void z_clock_hr_set(uint32_t cycles)
+{
+	uint32_t diff;
+
+	nrf_rtc_int_disable(RTC, NRF_RTC_INT_COMPARE1_MASK);
+	nrf_rtc_event_clear(RTC, NRF_RTC_EVENT_COMPARE_1);
+
+	diff = cycles - z_timer_cycle_get_32();
+
+	/* A comparator match needs at least 2 cycles of margin, and
+	 * anything at or beyond half the counter span would be taken
+	 * as already in the past.
+	 */
+	if ((int32_t)diff < 2) {
+		diff = 2U;
+	} else if (diff > COUNTER_HALF_SPAN) {
+		diff = COUNTER_HALF_SPAN;
+	}
+
+	nrf_rtc_cc_set(RTC, 1, (counter() + diff) & COUNTER_MAX);
+	nrf_rtc_event_enable(RTC, NRF_RTC_INT_COMPARE1_MASK);
+	nrf_rtc_int_enable(RTC, NRF_RTC_INT_COMPARE1_MASK);
+}
+
+void z_clock_hr_cancel(void)
+{
+	nrf_rtc_int_disable(RTC, NRF_RTC_INT_COMPARE1_MASK);
+	nrf_rtc_event_clear(RTC, NRF_RTC_EVENT_COMPARE_1);
+}
+#endif /* CONFIG_HR_TIMER */
+
 void rtc_nrf_isr(const void *arg)
 {
 	ARG_UNUSED(arg);
+
+#ifdef CONFIG_HR_TIMER
+	if (nrf_rtc_event_check(RTC, NRF_RTC_EVENT_COMPARE_1)) {
+		nrf_rtc_int_disable(RTC, NRF_RTC_INT_COMPARE1_MASK);
+		nrf_rtc_event_clear(RTC, NRF_RTC_EVENT_COMPARE_1);
+		z_clock_hr_expired();
+	}
+
+	if (!nrf_rtc_event_check(RTC, NRF_RTC_EVENT_COMPARE_0)) {
+		return;
+	}
+#endif
+
 	event_clear();
 
 	uint32_t t = get_comparator();
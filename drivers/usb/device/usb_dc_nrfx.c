@@ -207,14 +207,17 @@ K_MEM_POOL_DEFINE(fifo_elem_pool, FIFO_ELEM_MIN_SZ, FIFO_ELEM_MAX_SZ,
 #define EP_BUF_MAX_SZ		64UL
 #define ISO_EP_BUF_MAX_SZ	1024UL
 
+/** IN endpoint buffer size, may span multiple packets */
+#define EP_IN_BUF_MAX_SZ	((unsigned long)CONFIG_USB_NRFX_IN_EP_BUF_SIZE)
+
 /** Minimum endpoint buffer size (minimum block size) */
 #define EP_BUF_POOL_BLOCK_MIN_SZ EP_BUF_MAX_SZ
 
 /** Maximum endpoint buffer size (maximum block size) */
 #if (CFG_EP_ISOIN_CNT || CFG_EP_ISOOUT_CNT)
-#define EP_BUF_POOL_BLOCK_MAX_SZ ISO_EP_BUF_MAX_SZ
+#define EP_BUF_POOL_BLOCK_MAX_SZ MAX(ISO_EP_BUF_MAX_SZ, EP_IN_BUF_MAX_SZ)
 #else
-#define EP_BUF_POOL_BLOCK_MAX_SZ EP_BUF_MAX_SZ
+#define EP_BUF_POOL_BLOCK_MAX_SZ MAX(EP_BUF_MAX_SZ, EP_IN_BUF_MAX_SZ)
 #endif
 
 /** Total endpoints configured */
@@ -222,7 +225,7 @@ K_MEM_POOL_DEFINE(fifo_elem_pool, FIFO_ELEM_MIN_SZ, FIFO_ELEM_MAX_SZ,
 		    CFG_EPOUT_CNT + CFG_EP_ISOOUT_CNT)
 
 /** Total buffer size for all endpoints */
-#define EP_BUF_TOTAL ((CFG_EPIN_CNT * EP_BUF_MAX_SZ) +	       \
+#define EP_BUF_TOTAL ((CFG_EPIN_CNT * EP_IN_BUF_MAX_SZ) +      \
 		      (CFG_EPOUT_CNT * EP_BUF_MAX_SZ) +	       \
 		      (CFG_EP_ISOIN_CNT * ISO_EP_BUF_MAX_SZ) + \
 		      (CFG_EP_ISOOUT_CNT * ISO_EP_BUF_MAX_SZ))
@@ -636,7 +639,7 @@ static int eps_ctx_init(void)
 
 		if (!ep_ctx->buf.block.data) {
 			err = k_mem_pool_alloc(&ep_buf_pool, &ep_ctx->buf.block,
-					       EP_BUF_MAX_SZ, K_NO_WAIT);
+					       EP_IN_BUF_MAX_SZ, K_NO_WAIT);
 			if (err < 0) {
 				LOG_ERR("Buffer alloc failed for EP 0x%02x", i);
 				return -ENOMEM;
@@ -1724,19 +1727,24 @@ int usb_dc_ep_write(const uint8_t ep, const uint8_t *const data,
 	}
 
 	/* NRFX driver performs the fragmentation if buffer length exceeds
-	 * maximum packet size, however in current implementation, data is
-	 * copied to the internal buffer and must me fragmented here.
-	 * In case of fragmentation, a flag is set to prevent triggering
-	 * status stage which is handled by hardware, because there will be
-	 * another write coming.
+	 * maximum packet size, so bulk and interrupt endpoints can be armed
+	 * with as much data as their internal buffer holds and the hardware
+	 * segments it into max-packet-size chunks. Control endpoints keep
+	 * single packet writes because the status stage is triggered from
+	 * the write complete handler, and isochronous endpoints are limited
+	 * by their packet size anyway.
+	 * Data is copied to the internal buffer and what does not fit must
+	 * still be fragmented here. In that case a flag is set to prevent
+	 * triggering status stage which is handled by hardware, because
+	 * there will be another write coming.
 	 */
-	if (data_len > ep_ctx->cfg.max_sz) {
-		bytes_to_copy = ep_ctx->cfg.max_sz;
-		ep_ctx->write_fragmented = true;
+	if (ep_ctx->cfg.type == USB_DC_EP_BULK ||
+	    ep_ctx->cfg.type == USB_DC_EP_INTERRUPT) {
+		bytes_to_copy = MIN(data_len, EP_IN_BUF_MAX_SZ);
 	} else {
-		bytes_to_copy = data_len;
-		ep_ctx->write_fragmented = false;
+		bytes_to_copy = MIN(data_len, ep_ctx->cfg.max_sz);
 	}
+	ep_ctx->write_fragmented = (bytes_to_copy < data_len);
 	memcpy(ep_ctx->buf.data, data, bytes_to_copy);
 	ep_ctx->buf.len = bytes_to_copy;
 
@@ -605,14 +605,34 @@ int usb_dc_ep_configure(const struct usb_dc_ep_cfg_data * const ep_cfg)
 
 #ifdef USB
 	if (ep_cfg->ep_mps > ep_state->ep_pma_buf_len) {
-		if (USB_RAM_SIZE <=
-		    (usb_dc_stm32_state.pma_offset + ep_cfg->ep_mps)) {
-			return -EINVAL;
+		if (IS_ENABLED(CONFIG_USB_DC_STM32_DBLBUF) &&
+		    ep_cfg->ep_type == USB_DC_EP_BULK) {
+			/* Allocate two packet buffers so the controller can
+			 * transfer one packet while the other buffer is
+			 * accessed by software.
+			 */
+			if (USB_RAM_SIZE <= (usb_dc_stm32_state.pma_offset +
+					     2 * ep_cfg->ep_mps)) {
+				return -EINVAL;
+			}
+			HAL_PCDEx_PMAConfig(&usb_dc_stm32_state.pcd, ep,
+					    PCD_DBL_BUF,
+					    usb_dc_stm32_state.pma_offset |
+					    ((usb_dc_stm32_state.pma_offset +
+					      ep_cfg->ep_mps) << 16));
+			ep_state->ep_pma_buf_len = ep_cfg->ep_mps;
+			usb_dc_stm32_state.pma_offset += 2 * ep_cfg->ep_mps;
+		} else {
+			if (USB_RAM_SIZE <= (usb_dc_stm32_state.pma_offset +
+					     ep_cfg->ep_mps)) {
+				return -EINVAL;
+			}
+			HAL_PCDEx_PMAConfig(&usb_dc_stm32_state.pcd, ep,
+					    PCD_SNG_BUF,
+					    usb_dc_stm32_state.pma_offset);
+			ep_state->ep_pma_buf_len = ep_cfg->ep_mps;
+			usb_dc_stm32_state.pma_offset += ep_cfg->ep_mps;
 		}
-		HAL_PCDEx_PMAConfig(&usb_dc_stm32_state.pcd, ep, PCD_SNG_BUF,
-				    usb_dc_stm32_state.pma_offset);
-		ep_state->ep_pma_buf_len = ep_cfg->ep_mps;
-		usb_dc_stm32_state.pma_offset += ep_cfg->ep_mps;
 	}
 #endif
 	ep_state->ep_mps = ep_cfg->ep_mps;
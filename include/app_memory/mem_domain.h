@@ -88,6 +88,12 @@ struct k_mem_domain {
 	sys_dlist_t mem_domain_q;
 	/** number of active partitions in the domain */
 	uint8_t num_partitions;
+#ifdef CONFIG_ARCH_MEM_DOMAIN_GENERATION
+	/** updated on any partition set change, for cheap change detection
+	 * by the arch context switch code
+	 */
+	uint32_t generation;
+#endif /* CONFIG_ARCH_MEM_DOMAIN_GENERATION */
 #ifdef CONFIG_ARCH_MEM_DOMAIN_DATA
 	struct arch_mem_domain arch;
 #endif /* CONFIG_ARCH_MEM_DOMAIN_DATA */
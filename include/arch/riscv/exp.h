@@ -108,6 +108,14 @@ typedef struct __esf z_arch_esf_t;
 typedef struct soc_esf soc_esf_t;
 #endif
 
+#ifdef CONFIG_RISCV_LAZY_FPU_SHARING
+struct k_thread;
+
+/* Lazy FPU trap handling, see arch/riscv/core/fpu.c */
+void z_riscv_fpu_trap(z_arch_esf_t *esf);
+void z_riscv_fpu_disown(struct k_thread *thread);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,8 +68,24 @@ struct _callee_saved {
 };
 typedef struct _callee_saved _callee_saved_t;
 
+#ifdef CONFIG_RISCV_LAZY_FPU_SHARING
+/*
+ * Full floating-point register file, spilled/reloaded by the lazy FPU
+ * trap handler only. The assembly context switch code never touches
+ * this, so no generated offsets are needed.
+ */
+struct z_riscv_fpu {
+	RV_FP_TYPE f[32];
+	uint32_t fcsr;
+};
+#endif
+
 struct _thread_arch {
 	uint32_t swap_return_value; /* Return value of z_swap() */
+
+#ifdef CONFIG_RISCV_LAZY_FPU_SHARING
+	struct z_riscv_fpu fpu;
+#endif
 };
 
 typedef struct _thread_arch _thread_arch_t;
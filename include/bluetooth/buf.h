@@ -134,6 +134,30 @@ static inline enum bt_buf_type bt_buf_get_type(struct net_buf *buf)
 	return (enum bt_buf_type)(*(uint8_t *)net_buf_user_data(buf));
 }
 
+#if defined(CONFIG_BT_RX_STAGE_STATS)
+/** RX pipeline stage residency statistics */
+struct bt_rx_stage_stats {
+	/** Successful RX buffer allocations */
+	uint32_t alloc;
+	/** Failed RX buffer allocations (pool starved) */
+	uint32_t alloc_failed;
+	/** Buffers currently waiting in the RX queue */
+	uint32_t queued;
+	/** High watermark of the RX queue */
+	uint32_t queued_max;
+	/** Buffers currently held for ACL reassembly */
+	uint32_t reassembly;
+	/** High watermark of buffers held for ACL reassembly */
+	uint32_t reassembly_max;
+};
+
+/** Get a snapshot of the RX pipeline stage statistics
+ *
+ *  @param stats Statistics storage to fill in.
+ */
+void bt_rx_stage_stats_get(struct bt_rx_stage_stats *stats);
+#endif /* CONFIG_BT_RX_STAGE_STATS */
+
 /**
  * @}
  */
@@ -15,6 +15,14 @@ extern "C" {
 
 void arch_dcache_flush(void *addr, size_t size);
 void arch_dcache_invd(void *addr, size_t size);
+#ifdef CONFIG_ARCH_HAS_DCACHE_RANGE_OP
+void arch_dcache_range(void *addr, size_t size, int op);
+#endif
+
+/* Operations for sys_cache_data_range() */
+#define SYS_CACHE_OP_CLEAN	BIT(0)
+#define SYS_CACHE_OP_INVD	BIT(1)
+#define SYS_CACHE_OP_CLEAN_INVD	(SYS_CACHE_OP_CLEAN | SYS_CACHE_OP_INVD)
 
 /**
  *
@@ -66,6 +74,82 @@ static inline void z_impl_sys_cache_invd(void *addr, size_t size)
 	}
 }
 
+/**
+ *
+ * @brief Perform a d-cache maintenance operation on an address range
+ *
+ * Cleans (writes back), invalidates, or cleans and invalidates the
+ * d-cache lines covering the given range, depending on op
+ * (SYS_CACHE_OP_CLEAN, SYS_CACHE_OP_INVD or SYS_CACHE_OP_CLEAN_INVD).
+ * Architectures with a combined clean+invalidate operation perform it
+ * in a single pass.
+ *
+ * This is the operation DMA-using drivers need to keep buffers in
+ * cached RAM coherent: clean the range before handing a buffer (or
+ * descriptor) to the device, invalidate it before reading data the
+ * device has written.  As with the other range operations, addr and
+ * size need not be cache-line aligned, but unaligned ranges touch the
+ * partially covered lines in full.
+ *
+ * @param addr the pointer to the start of the range
+ * @param size the number of bytes to operate on
+ * @param op the maintenance operation to perform
+ *
+ * @return N/A
+ */
+__syscall void sys_cache_data_range(void *addr, size_t size, int op);
+
+static inline void z_impl_sys_cache_data_range(void *addr, size_t size, int op)
+{
+	if (!IS_ENABLED(CONFIG_CACHE_FLUSHING)) {
+		return;
+	}
+#ifdef CONFIG_ARCH_HAS_DCACHE_RANGE_OP
+	arch_dcache_range(addr, size, op);
+#else
+	if ((op & SYS_CACHE_OP_CLEAN) != 0) {
+		arch_dcache_flush(addr, size);
+	}
+	if ((op & SYS_CACHE_OP_INVD) != 0) {
+		arch_dcache_invd(addr, size);
+	}
+#endif
+}
+
+/**
+ *
+ * @brief Make a buffer about to be read by a DMA device observable
+ *
+ * Helper for DMA-using drivers: cleans the range so data the CPU wrote
+ * through the cache reaches main memory before the device reads it.
+ *
+ * @param addr the pointer to the start of the buffer
+ * @param size the number of bytes the device will read
+ *
+ * @return N/A
+ */
+static inline void sys_cache_dma_to_dev(void *addr, size_t size)
+{
+	sys_cache_data_range(addr, size, SYS_CACHE_OP_CLEAN);
+}
+
+/**
+ *
+ * @brief Make data written by a DMA device visible to the CPU
+ *
+ * Helper for DMA-using drivers: invalidates the range so subsequent
+ * CPU reads fetch what the device wrote instead of stale cached lines.
+ *
+ * @param addr the pointer to the start of the buffer
+ * @param size the number of bytes the device has written
+ *
+ * @return N/A
+ */
+static inline void sys_cache_dma_from_dev(void *addr, size_t size)
+{
+	sys_cache_data_range(addr, size, SYS_CACHE_OP_INVD);
+}
+
 /**
  *
  * @brief Get the d-cache line size.
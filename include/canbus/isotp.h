@@ -214,6 +214,32 @@ int isotp_recv(struct isotp_recv_ctx *ctx, uint8_t *data, size_t len,
 int isotp_recv_net(struct isotp_recv_ctx *ctx, struct net_buf **buffer,
 		   k_timeout_t timeout);
 
+/**
+ * @brief Receive a message directly into a caller provided buffer
+ *
+ * This function works like isotp_recv, but the payload of incoming frames is
+ * written directly into the given buffer instead of internal net-buffers.
+ * Nothing is allocated from the RX buffer pool and no intermediate copy is
+ * made, so long multi-frame transfers are not CPU-bound in buffer management.
+ * The buffer must stay valid and must not be read until this function returns.
+ * If the announced message is larger than the buffer, the transfer is aborted
+ * with an overflow FC frame.
+ * Messages that arrived before this call are buffered internally and have to
+ * be read with isotp_recv or isotp_recv_net. Do not mix both reception styles
+ * while a transfer is ongoing.
+ *
+ * @param ctx     Context that is already bound.
+ * @param data    Pointer to a buffer where the data is written to.
+ * @param len     Size of the buffer.
+ * @param timeout Timeout for incoming data.
+ *
+ * @retval Length of the received message on success
+ * @retval ISOTP_RECV_TIMEOUT when "timeout" timed out
+ * @retval ISOTP_N_* on error
+ */
+int isotp_recv_into(struct isotp_recv_ctx *ctx, uint8_t *data, size_t len,
+		    k_timeout_t timeout);
+
 /**
  * @brief Send data
  *
@@ -371,6 +397,10 @@ struct isotp_recv_ctx {
 	struct k_work work;
 	struct _timeout timeout;
 	struct k_fifo fifo;
+	struct k_sem recv_sem;
+	uint8_t *recv_buf;
+	size_t recv_buf_size;
+	size_t recv_buf_len;
 	struct isotp_msg_id rx_addr;
 	struct isotp_msg_id tx_addr;
 	struct isotp_fc_opts opts;
@@ -711,6 +711,125 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode(const struct json_obj_descr *descr, const void *val,
 		    json_append_bytes_t append_bytes, void *data);
 
+/**
+ * @brief Function pointer type for streaming parser field callbacks.
+ *
+ * Invoked once per decoded top-level field whose key matches an entry
+ * in the descriptor array.  @a value points either into the chunk
+ * passed to json_stream_feed() (zero-copy, the common case) or into
+ * the parser's scratch buffer when the token was split across chunks,
+ * and is only valid for the duration of the callback.  String values
+ * are reported raw, without surrounding quotes and with escape
+ * sequences left in place, matching json_obj_parse() behavior.
+ *
+ * @param descr Descriptor entry the field key matched
+ * @param value Pointer to the value bytes (not NUL terminated)
+ * @param value_len Number of bytes in @a value
+ * @param type Actual token type: JSON_TOK_STRING, JSON_TOK_NUMBER,
+ * JSON_TOK_TRUE or JSON_TOK_FALSE
+ * @param user_data User-provided pointer
+ *
+ * @return 0 to continue parsing, any other value to abort; that value
+ * is then returned from json_stream_feed().
+ */
+typedef int (*json_stream_field_cb_t)(const struct json_obj_descr *descr,
+				      const char *value, size_t value_len,
+				      enum json_tokens type, void *user_data);
+
+/**
+ * @brief Incremental push-style JSON parser state.
+ *
+ * All members are internal; initialize with json_stream_init().
+ */
+struct json_stream {
+	const struct json_obj_descr *descr;
+	size_t descr_len;
+	json_stream_field_cb_t on_field;
+	void *user_data;
+
+	/* Carries the current token across chunk boundaries */
+	char *scratch;
+	size_t scratch_size;
+	size_t scratch_len;
+
+	/* Descriptor matched by the key being parsed, if any */
+	const struct json_obj_descr *field;
+
+	uint8_t state;
+	uint8_t depth;
+	uint8_t nested_in_string;
+	uint8_t escape;
+};
+
+/**
+ * @brief Initialize an incremental JSON parser.
+ *
+ * The streaming parser decodes a single top-level JSON object fed to
+ * it in arbitrary chunks (e.g. as TCP segments arrive), invoking @a
+ * on_field for every matched top-level field instead of filling in a
+ * struct, and yielding pointers into the fed chunks rather than
+ * copying values.  Fields of nested object or array type and unknown
+ * keys are skipped.  Only tokens that straddle a chunk boundary are
+ * staged in @a scratch, so it needs to hold just the largest single
+ * key or primitive value that may be split, not the document.
+ *
+ * @param js Parser state to initialize
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array
+ * @param scratch Buffer used to carry split tokens between chunks
+ * @param scratch_size Size of @a scratch in bytes
+ * @param on_field Callback invoked per decoded field
+ * @param user_data Pointer passed through to @a on_field
+ */
+void json_stream_init(struct json_stream *js,
+		      const struct json_obj_descr *descr, size_t descr_len,
+		      char *scratch, size_t scratch_size,
+		      json_stream_field_cb_t on_field, void *user_data);
+
+/**
+ * @brief Feed a chunk of JSON text to an incremental parser.
+ *
+ * May be called repeatedly as data arrives; the chunk does not need
+ * to align with any token boundary.
+ *
+ * @param js Parser state initialized with json_stream_init()
+ * @param data Chunk contents; only read during this call
+ * @param len Number of bytes in @a data
+ *
+ * @retval 1 The top-level object is complete
+ * @retval 0 The chunk was consumed, more data is needed
+ * @retval -ENOMEM A split token did not fit in the scratch buffer
+ * @retval -EINVAL Malformed document or field/descriptor type mismatch
+ *
+ * A nonzero return from the field callback is passed through.
+ */
+int json_stream_feed(struct json_stream *js, const char *data, size_t len);
+
+#ifdef CONFIG_RING_BUFFER
+struct ring_buf;
+
+/**
+ * @brief Encodes an object into a byte-mode ring buffer
+ *
+ * Useful for streaming encoded output towards a transport without
+ * first materializing it in a contiguous buffer.
+ *
+ * @param descr Pointer to the descriptor array
+ *
+ * @param descr_len Number of elements in the descriptor array
+ *
+ * @param val Struct holding the values
+ *
+ * @param ringbuf Byte-mode ring buffer the output is appended to
+ *
+ * @return 0 if object has been successfully encoded. -ENOMEM if the
+ * ring buffer filled up; partial output is left in the buffer.
+ */
+int json_obj_encode_ring_buf(const struct json_obj_descr *descr,
+			     size_t descr_len, const void *val,
+			     struct ring_buf *ringbuf);
+#endif /* CONFIG_RING_BUFFER */
+
 #ifdef __cplusplus
 }
 #endif
@@ -87,6 +87,43 @@ int jwt_sign(struct jwt_builder *builder,
 	     const char *der_key,
 	     size_t der_key_len);
 
+/**
+ * @typedef jwt_sign_cb_t
+ * @brief Completion callback for jwt_sign_async().
+ *
+ * @param builder The builder the token was signed into.
+ * @param res Result of the signing, as returned by jwt_sign().
+ * @param user_data User data given to jwt_sign_async().
+ */
+typedef void (*jwt_sign_cb_t)(struct jwt_builder *builder, int res,
+			      void *user_data);
+
+/**
+ * @brief Sign the JWT token without blocking the calling thread.
+ *
+ * The signature computation is performed on the system work queue and
+ * the result is delivered through the callback. The builder, buffer
+ * and key must stay valid until the callback has been called. Only
+ * one asynchronous signing request can be active at a time.
+ *
+ * Only available with CONFIG_JWT_ASYNC.
+ *
+ * @param builder The builder with the token to sign.
+ * @param der_key The key to sign with, in DER format.
+ * @param der_key_len Length of the key.
+ * @param cb Callback called on completion.
+ * @param user_data User data passed to the callback.
+ *
+ * @retval 0 Request was queued
+ * @retval -EINVAL No callback was given
+ * @retval -EBUSY Another request is still in flight
+ */
+int jwt_sign_async(struct jwt_builder *builder,
+		   const char *der_key,
+		   size_t der_key_len,
+		   jwt_sign_cb_t cb,
+		   void *user_data);
+
 
 static inline size_t jwt_payload_len(struct jwt_builder *builder)
 {
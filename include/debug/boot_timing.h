@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_BOOT_TIMING_H_
+#define ZEPHYR_INCLUDE_DEBUG_BOOT_TIMING_H_
+
+#include <zephyr/types.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Boot timing record of one init entry
+ *
+ * One record is captured for every SYS_INIT/device init entry that is
+ * executed during boot, in execution order.
+ */
+struct boot_timing_entry {
+	/** Device name, or the init function symbol for services */
+	const char *name;
+
+	/** Init level the entry ran at (_SYS_INIT_LEVEL_...) */
+	uint8_t level;
+
+	/** k_cycle_get_32() when the init function was entered */
+	uint32_t start_cycles;
+
+	/** Cycles spent in the init function */
+	uint32_t duration_cycles;
+};
+
+/**
+ * @brief Get the number of captured boot timing records
+ *
+ * @return Number of valid records, at most
+ *         CONFIG_BOOT_TIMING_MAX_ENTRIES.
+ */
+size_t boot_timing_count(void);
+
+/**
+ * @brief Get one boot timing record
+ *
+ * @param index Record index, in execution order.
+ * @return The record, or NULL if index is out of range.
+ */
+const struct boot_timing_entry *boot_timing_get(size_t index);
+
+/**
+ * @brief Serialize the boot timing table into a binary record
+ *
+ * Layout, all integers little endian:
+ *
+ *   0: magic 0x42 0x54 ('B' 'T')
+ *   2: format version (1)
+ *   3: reserved (0)
+ *   4: u32 hardware cycles per second
+ *   8: u32 record count
+ *  12: records: u8 level, u32 start cycles, u32 duration cycles,
+ *      NUL-terminated name
+ *
+ * Records that do not fit in the buffer are dropped; the count field
+ * reflects the records actually written.
+ *
+ * @param buf Buffer to write the record to.
+ * @param buf_size Size of the buffer.
+ * @return Number of bytes written, 0 if the buffer cannot even hold
+ *         the header.
+ */
+size_t boot_timing_dump(uint8_t *buf, size_t buf_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_BOOT_TIMING_H_ */
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_SPIN_PROFILE_H_
+#define ZEPHYR_INCLUDE_DEBUG_SPIN_PROFILE_H_
+
+#include <zephyr/types.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Spinlock profile of one lock site
+ *
+ * One record accumulates all k_spin_lock() calls expanded at the same
+ * code address.  Counters are updated without cross-CPU
+ * synchronization, so under SMP they are statistically accurate
+ * rather than exact.
+ */
+struct spin_profile_entry {
+	/** Code address of the k_spin_lock() expansion, NULL if the
+	 * slot is unused
+	 */
+	void *site;
+
+	/** Number of profiled acquisitions */
+	uint32_t count;
+
+	/** Total cycles spent spinning for the lock */
+	uint64_t wait_cycles;
+
+	/** Total cycles the lock was held */
+	uint64_t hold_cycles;
+
+	/** Longest single hold, in cycles */
+	uint32_t max_hold_cycles;
+};
+
+/**
+ * @brief Get the size of the lock site table
+ *
+ * @return Number of table slots (CONFIG_SPIN_PROFILE_MAX_SITES).
+ */
+size_t spin_profile_max_sites(void);
+
+/**
+ * @brief Get one lock site record
+ *
+ * The table is a hash table: slots are not ordered and unused slots
+ * have a NULL site.
+ *
+ * @param index Slot index.
+ * @return The record, or NULL if index is out of range.
+ */
+const struct spin_profile_entry *spin_profile_get(size_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_SPIN_PROFILE_H_ */
@@ -7,6 +7,7 @@
 #ifndef __STACK_SIZE_ANALYZER_H
 #define __STACK_SIZE_ANALYZER_H
 #include <stddef.h>
+#include <zephyr/types.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,6 +30,12 @@ struct thread_analyzer_info {
 	size_t stack_size;
 	/** Stack size in used */
 	size_t stack_used;
+#ifdef CONFIG_TRACING_THREAD_STATS
+	/** Cycles consumed while the thread was scheduled in */
+	uint64_t run_cycles;
+	/** Number of times the thread was switched in */
+	uint32_t run_switches;
+#endif
 };
 
 /** @brief Thread analyzer stack size callback function
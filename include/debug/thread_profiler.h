@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __THREAD_PROFILER_H
+#define __THREAD_PROFILER_H
+#include <stddef.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup thread_profiler Thread profiler
+ *  @brief Module for sampling based CPU attribution
+ *
+ *  This module periodically samples which thread owns the CPU and
+ *  aggregates the samples into per-thread histograms. The sampling
+ *  cost is a table update in the timer interrupt, making it cheap
+ *  enough to stay enabled in production builds.
+ *  @{
+ */
+
+struct thread_profiler_info {
+	/** The name of the thread or stringified address of the thread handle
+	 * if name is not set.
+	 */
+	const char *name;
+	/** Number of samples taken while this thread owned the CPU */
+	uint32_t samples;
+	/** Total number of samples taken since the last reset */
+	uint32_t total_samples;
+};
+
+/** @brief Thread profiler callback function
+ *
+ *  Callback function with thread sampling information.
+ *
+ *  @param info Thread sampling information.
+ */
+typedef void (*thread_profiler_cb)(struct thread_profiler_info *info);
+
+/** @brief Run the thread profiler and provide information to the callback
+ *
+ *  This function walks the sample histogram and calls a given callback
+ *  for every thread that has been sampled since the last reset.
+ *
+ *  @param cb The callback function handler
+ */
+void thread_profiler_run(thread_profiler_cb cb);
+
+/** @brief Run the thread profiler and print the sample histogram
+ *
+ *  This function prints the percentage of samples attributed to every
+ *  sampled thread using the printing method selected in kconfig.
+ */
+void thread_profiler_print(void);
+
+/** @brief Start the periodic sampling timer */
+void thread_profiler_start(void);
+
+/** @brief Stop the periodic sampling timer */
+void thread_profiler_stop(void);
+
+/** @brief Discard all samples collected so far */
+void thread_profiler_reset(void);
+
+/** @brief Export the sample histogram in binary form
+ *
+ *  Fills the buffer with little endian records for host side
+ *  processing: a header of total and unattributed sample counts
+ *  followed by one (thread handle, sample count) pair per sampled
+ *  thread, all 32-bit.
+ *
+ *  @param buf Buffer to fill.
+ *  @param len Buffer size in bytes.
+ *
+ *  @return Number of bytes written, or -ENOMEM if the histogram does
+ *          not fit into the buffer.
+ */
+int thread_profiler_export(uint8_t *buf, size_t len);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __THREAD_PROFILER_H */
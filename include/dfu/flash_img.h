@@ -8,16 +8,64 @@
 #ifndef ZEPHYR_INCLUDE_DFU_FLASH_IMG_H_
 #define ZEPHYR_INCLUDE_DFU_FLASH_IMG_H_
 
+#include <kernel.h>
 #include <storage/stream_flash.h>
 
+#ifdef CONFIG_IMG_STREAM_HASH
+#include <tinycrypt/constants.h>
+#include <tinycrypt/sha256.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+/**
+ * @brief Progress data passed to the progress callback
+ *
+ * The erase and stall members are only updated when
+ * CONFIG_IMG_ERASE_AHEAD is enabled; without it page erases happen
+ * inside the write path and are accounted as write time.
+ */
+struct flash_img_progress {
+	size_t bytes_written;	/** Image bytes handed to flash */
+	uint32_t write_ms;	/** Time spent in the write path */
+	uint32_t erase_ms;	/** Time spent erasing pages */
+	uint32_t stall_ms;	/** Time the write path waited for erases */
+};
+
+/**
+ * @typedef flash_img_progress_cb
+ *
+ * @brief Signature for callback invoked after each processed data block.
+ *
+ * @param progress Accumulated progress data, valid during the call only.
+ */
+typedef void (*flash_img_progress_cb)(
+				const struct flash_img_progress *progress);
+#endif
+
 struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
+#ifdef CONFIG_IMG_ERASE_AHEAD
+	struct k_work ea_work; /* Work item erasing pages ahead */
+	struct k_sem ea_idle; /* Given when no background erase is running */
+	off_t ea_next; /* Start of the first page not yet erased */
+	off_t ea_limit; /* End of the flash area */
+#endif
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	flash_img_progress_cb progress_cb;
+	struct flash_img_progress progress;
+#endif
+#ifdef CONFIG_IMG_STREAM_HASH
+	struct tc_sha256_state_struct hash_ctx; /* Digest of written data */
+	size_t hash_bytes; /* Number of bytes hashed so far */
+	uint8_t hash_area_id; /* Flash area the hashed data was written to */
+	bool hash_valid; /* The digest covers all written data */
+#endif
 };
 
 #if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK)
@@ -61,6 +109,22 @@ int flash_img_init(struct flash_img_context *ctx);
  */
 size_t flash_img_bytes_written(struct flash_img_context *ctx);
 
+/**
+ * @brief Set the write position of an initialized context to resume an
+ * interrupted download.
+ *
+ * The image data up to the given offset must already be in flash from a
+ * previous session; subsequent writes append after it. Pages beyond the
+ * offset are not touched until they are written to.
+ *
+ * @param ctx initialized context
+ * @param offset image offset to resume writing at. Must be a multiple of
+ *               CONFIG_IMG_BLOCK_BUF_SIZE.
+ *
+ * @return  0 on success, negative errno code on fail
+ */
+int flash_img_resume(struct flash_img_context *ctx, size_t offset);
+
 /**
  * @brief  Process input buffers to be written to the image slot 1. flash
  * memory in single blocks. Will store remainder between calls.
@@ -81,11 +145,30 @@ size_t flash_img_bytes_written(struct flash_img_context *ctx);
 int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 		    size_t len, bool flush);
 
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+/**
+ * @brief Register a progress callback for an initialized context.
+ *
+ * The callback is invoked at the end of each flash_img_buffered_write()
+ * call with the accumulated byte count and time breakdown, from the
+ * caller's thread.
+ *
+ * @param ctx context
+ * @param cb callback to invoke, NULL to unregister
+ */
+void flash_img_set_progress_cb(struct flash_img_context *ctx,
+			       flash_img_progress_cb cb);
+#endif
+
 #if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK)
 /**
  * @brief  Verify flash memory length bytes integrity from a flash area. The
  * start point is indicated by an offset value.
  *
+ * When CONFIG_IMG_STREAM_HASH is enabled and the context holds a running
+ * digest covering exactly the checked length of the checked area, the
+ * digests are compared directly and the flash is not read back.
+ *
  * @param[in] ctx context.
  * @param[in] fic flash img check data.
  * @param[in] area_id flash area id of partition where the image should be
@@ -322,6 +322,66 @@ struct adc_sequence {
 };
 
 
+#ifdef CONFIG_ADC_STREAM
+/* Forward declaration of the adc_stream structure. */
+struct adc_stream;
+
+/**
+ * @brief Type definition of the callback function delivering filled buffer
+ *        halves of a continuous sampling stream.
+ *
+ * The callback is invoked from interrupt context, each time one half of the
+ * stream buffer has been filled, while the hardware keeps filling the other
+ * half. The handed-out half must be consumed (or copied away) before the
+ * hardware wraps around to it again, i.e. within the time it takes to
+ * acquire buffer_size / 2 bytes of samples.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param stream  Pointer to the stream structure that was started.
+ * @param buffer  Pointer to the filled half of the stream buffer,
+ *                stream->buffer_size / 2 bytes long.
+ */
+typedef void (*adc_stream_callback)(const struct device *dev,
+				    const struct adc_stream *stream,
+				    void *buffer);
+
+/**
+ * @brief Structure defining a continuous ADC sampling stream.
+ */
+struct adc_stream {
+	/**
+	 * Bit-mask indicating the channels to be included in each sampling
+	 * of this stream.
+	 * All selected channels must be configured with adc_channel_setup()
+	 * before they are used in a stream.
+	 */
+	uint32_t channels;
+
+	/**
+	 * Pointer to the buffer where the samples are to be written.
+	 * The buffer is used as two ping-pong halves: while the hardware
+	 * fills one half, the other one is handed to the application via
+	 * the callback. It must hold an even number of samples.
+	 */
+	void *buffer;
+
+	/** Specifies the size of the buffer pointed by "buffer" (in bytes). */
+	size_t buffer_size;
+
+	/**
+	 * ADC resolution.
+	 * For single-ended channels the sample values are from range:
+	 *   0 .. 2^resolution - 1,
+	 * for differential ones:
+	 *   - 2^(resolution-1) .. 2^(resolution-1) - 1.
+	 */
+	uint8_t resolution;
+
+	/** Callback function to be called with each filled buffer half. */
+	adc_stream_callback callback;
+};
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief Type definition of ADC API function for configuring a channel.
  * See adc_channel_setup() for argument descriptions.
@@ -347,6 +407,23 @@ typedef int (*adc_api_read_async)(const struct device *dev,
 				  struct k_poll_signal *async);
 #endif
 
+#ifdef CONFIG_ADC_STREAM
+/**
+ * @brief Type definition of ADC API function for starting a continuous
+ *        sampling stream.
+ * See adc_stream_start() for argument descriptions.
+ */
+typedef int (*adc_api_stream_start)(const struct device *dev,
+				    const struct adc_stream *stream);
+
+/**
+ * @brief Type definition of ADC API function for stopping a continuous
+ *        sampling stream.
+ * See adc_stream_stop() for argument descriptions.
+ */
+typedef int (*adc_api_stream_stop)(const struct device *dev);
+#endif
+
 /**
  * @brief ADC driver API
  *
@@ -357,6 +434,10 @@ __subsystem struct adc_driver_api {
 	adc_api_read          read;
 #ifdef CONFIG_ADC_ASYNC
 	adc_api_read_async    read_async;
+#endif
+#ifdef CONFIG_ADC_STREAM
+	adc_api_stream_start  stream_start;
+	adc_api_stream_stop   stream_stop;
 #endif
 	uint16_t ref_internal;	/* mV */
 };
@@ -451,6 +532,69 @@ static inline int z_impl_adc_read_async(const struct device *dev,
 }
 #endif /* CONFIG_ADC_ASYNC */
 
+#ifdef CONFIG_ADC_STREAM
+/**
+ * @brief Start a continuous sampling stream.
+ *
+ * Conversions are triggered by the hardware itself and keep filling the
+ * stream buffer in a ping-pong fashion: each time one half of the buffer
+ * is filled, it is handed to the application via the stream callback while
+ * the hardware fills the other half. The stream runs until it is stopped
+ * with adc_stream_stop(). One-shot reads with adc_read() are held off
+ * while a stream is active and proceed once it is stopped.
+ *
+ * This API is not permitted for user threads, as the callback is invoked
+ * directly from interrupt context.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param stream  Structure specifying the requested stream. It must remain
+ *                valid (and the buffer must not be reused) until the stream
+ *                is stopped.
+ *
+ * @retval 0        On success.
+ * @retval -ENOTSUP If the driver does not support continuous streams.
+ * @retval -EINVAL  If a parameter with an invalid value has been provided.
+ * @retval -ENOMEM  If the provided buffer cannot hold two samplings of the
+ *                  selected channels.
+ */
+static inline int adc_stream_start(const struct device *dev,
+				   const struct adc_stream *stream)
+{
+	const struct adc_driver_api *api =
+				(const struct adc_driver_api *)dev->api;
+
+	if (api->stream_start == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->stream_start(dev, stream);
+}
+
+/**
+ * @brief Stop a continuous sampling stream.
+ *
+ * After this function returns, the stream callback is no longer invoked
+ * and the stream buffer may be reused.
+ *
+ * @param dev  Pointer to the device structure for the driver instance.
+ *
+ * @retval 0        On success.
+ * @retval -ENOTSUP If the driver does not support continuous streams.
+ * @retval -EINVAL  If no stream is currently active.
+ */
+static inline int adc_stream_stop(const struct device *dev)
+{
+	const struct adc_driver_api *api =
+				(const struct adc_driver_api *)dev->api;
+
+	if (api->stream_stop == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->stream_stop(dev);
+}
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief Get the internal reference voltage.
  *
@@ -142,7 +142,12 @@ typedef void (*dma_callback_t)(const struct device *dev, void *user_data,
  *     linked_channel       [ 20 : 26 ] - after channel count exhaust will
  *                                        initiate a channel service request
  *                                        at this channel
- *     reserved             [ 27 : 31 ]
+ *     cyclic               [ 27 ]      - the block chain loops back to the
+ *                                        head block when the tail block
+ *                                        completes, forming a ring that runs
+ *                                        until the channel is stopped
+ *                                        0-disable, 1-enable
+ *     reserved             [ 28 : 31 ]
  *
  *     source_data_size    [ 0 : 15 ]   - width of source data (in bytes)
  *     dest_data_size      [ 16 : 31 ]  - width of dest data (in bytes)
@@ -167,7 +172,8 @@ struct dma_config {
 	uint32_t  source_chaining_en :   1;
 	uint32_t  dest_chaining_en :     1;
 	uint32_t  linked_channel   :     7;
-	uint32_t  reserved :             5;
+	uint32_t  cyclic :               1;
+	uint32_t  reserved :             4;
 	uint32_t  source_data_size :    16;
 	uint32_t  dest_data_size :      16;
 	uint32_t  source_burst_length : 16;
@@ -211,6 +217,11 @@ typedef int (*dma_api_reload)(const struct device *dev, uint32_t channel,
 			      uint32_t src, uint32_t dst, size_t size);
 #endif
 
+typedef int (*dma_api_config_sg)(const struct device *dev, uint32_t channel,
+				 struct dma_config *config);
+
+typedef int (*dma_api_resubmit)(const struct device *dev, uint32_t channel);
+
 typedef int (*dma_api_start)(const struct device *dev, uint32_t channel);
 
 typedef int (*dma_api_stop)(const struct device *dev, uint32_t channel);
@@ -220,6 +231,8 @@ typedef int (*dma_api_get_status)(const struct device *dev, uint32_t channel,
 
 __subsystem struct dma_driver_api {
 	dma_api_config config;
+	dma_api_config_sg config_sg;
+	dma_api_resubmit resubmit;
 	dma_api_reload reload;
 	dma_api_start start;
 	dma_api_stop stop;
@@ -249,6 +262,71 @@ static inline int dma_config(const struct device *dev, uint32_t channel,
 	return api->config(dev, channel, config);
 }
 
+/**
+ * @brief Configure a channel with a preallocated, reusable descriptor list.
+ *
+ * Unlike dma_config(), the driver keeps a reference to @a config and its
+ * block chain instead of consuming them: the caller retains ownership and
+ * must keep them valid (and unmodified while the channel is running) until
+ * the channel is reconfigured or stopped for good. In return, the list can
+ * be re-armed cheaply with dma_resubmit() without going through the full
+ * configuration and validation again, and drivers backed by hardware
+ * linked-list descriptors can map the chain onto them directly.
+ *
+ * Together with the "cyclic" configuration flag this also covers ring
+ * transfers, where the chain loops back to the head block until the
+ * channel is stopped.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param channel Numeric identification of the channel to configure
+ * @param config  Data structure containing the intended configuration for
+ *                the selected channel, kept referenced by the driver
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if the driver does not support reusable descriptor lists.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_config_sg(const struct device *dev, uint32_t channel,
+				struct dma_config *config)
+{
+	const struct dma_driver_api *api =
+		(const struct dma_driver_api *)dev->api;
+
+	if (api->config_sg) {
+		return api->config_sg(dev, channel, config);
+	}
+
+	return -ENOSYS;
+}
+
+/**
+ * @brief Re-arm the descriptor list previously set with dma_config_sg()
+ *
+ * Restarts the transfer from the head block of the configured list. The
+ * channel keeps the configuration from dma_config_sg(), so only the
+ * per-transfer hardware state is rewritten, making this considerably
+ * cheaper than a full dma_config() for small recurring transfers.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param channel Numeric identification of the channel to re-arm
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if no descriptor list is configured on the channel.
+ * @retval -ENOSYS if the driver does not support reusable descriptor lists.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_resubmit(const struct device *dev, uint32_t channel)
+{
+	const struct dma_driver_api *api =
+		(const struct dma_driver_api *)dev->api;
+
+	if (api->resubmit) {
+		return api->resubmit(dev, channel);
+	}
+
+	return -ENOSYS;
+}
+
 /**
  * @brief Reload buffer(s) for a DMA channel
  *
@@ -57,6 +57,22 @@ typedef int (*flash_api_write_protection)(const struct device *dev,
 					  bool enable);
 typedef const struct flash_parameters* (*flash_api_get_parameters)(const struct device *dev);
 
+/**
+ * @brief Get a pointer to memory-mapped flash content.
+ *
+ * Optional API. Drivers for flash that is readable through the address
+ * space (internal flash, QSPI in XIP mode) can provide it so content
+ * can be accessed in place instead of being copied out.
+ *
+ * @param dev    Flash device.
+ * @param offset Offset within the device.
+ *
+ * @return Directly readable address of the content at @p offset, or
+ * NULL when the offset cannot be mapped.
+ */
+typedef const void *(*flash_api_get_mapped_address)(const struct device *dev,
+						    off_t offset);
+
 #if defined(CONFIG_FLASH_PAGE_LAYOUT)
 /**
  * @brief Retrieve a flash device's layout.
@@ -88,6 +104,24 @@ typedef int (*flash_api_sfdp_read)(const struct device *dev, off_t offset,
 				   void *data, size_t len);
 typedef int (*flash_api_read_jedec_id)(const struct device *dev, uint8_t *id);
 
+#if defined(CONFIG_FLASH_ASYNC)
+/**
+ * @brief Asynchronous write and erase entry points.
+ *
+ * Optional API. Drivers that can run the operation in the background
+ * (e.g. by polling a status register from a timer instead of busy
+ * waiting) can provide these; the operation result is delivered by
+ * raising @p async. Drivers that do not provide them are served by a
+ * generic work queue based fallback.
+ */
+typedef int (*flash_api_write_async)(const struct device *dev, off_t offset,
+				     const void *data, size_t len,
+				     struct k_poll_signal *async);
+typedef int (*flash_api_erase_async)(const struct device *dev, off_t offset,
+				     size_t size,
+				     struct k_poll_signal *async);
+#endif /* CONFIG_FLASH_ASYNC */
+
 __subsystem struct flash_driver_api {
 	flash_api_read read;
 	flash_api_write write;
@@ -101,6 +135,11 @@ __subsystem struct flash_driver_api {
 	flash_api_sfdp_read sfdp_read;
 	flash_api_read_jedec_id read_jedec_id;
 #endif /* CONFIG_FLASH_JESD216_API */
+	flash_api_get_mapped_address get_mapped_address;
+#if defined(CONFIG_FLASH_ASYNC)
+	flash_api_write_async write_async;
+	flash_api_erase_async erase_async;
+#endif /* CONFIG_FLASH_ASYNC */
 };
 
 /**
@@ -129,6 +168,33 @@ static inline int z_impl_flash_read(const struct device *dev, off_t offset,
 	return api->read(dev, offset, data, len);
 }
 
+/**
+ *  @brief  Get a directly readable address of flash content
+ *
+ *  Returns an address through which the flash content at the given
+ *  offset can be read in place, avoiding the copy done by flash_read().
+ *  Support is optional; a NULL return means the content has to be read
+ *  through flash_read() instead.
+ *
+ *  @param  dev             : flash dev
+ *  @param  offset          : Offset (byte aligned) to map
+ *
+ *  @return  Directly readable address, or NULL when the driver does not
+ *  support memory-mapped reads or the offset cannot be mapped.
+ */
+static inline const void *flash_get_mapped_address(const struct device *dev,
+						   off_t offset)
+{
+	const struct flash_driver_api *api =
+		(const struct flash_driver_api *)dev->api;
+
+	if (api->get_mapped_address == NULL) {
+		return NULL;
+	}
+
+	return api->get_mapped_address(dev, offset);
+}
+
 /**
  *  @brief  Write buffer into flash memory.
  *
@@ -237,6 +303,51 @@ static inline int z_impl_flash_write_protection_set(const struct device *dev,
 	return api->write_protection(dev, enable);
 }
 
+#if defined(CONFIG_FLASH_ASYNC)
+/**
+ *  @brief  Write buffer into flash memory without waiting for completion.
+ *
+ *  Starts the same operation as flash_write() and returns once it has
+ *  been submitted. Completion is reported by raising @p async with the
+ *  operation result; the buffer behind @p data and the disabled write
+ *  protection must stay valid until then.
+ *
+ *  @param  dev             : flash device
+ *  @param  offset          : starting offset for the write
+ *  @param  data            : data to write
+ *  @param  len             : Number of bytes to write
+ *  @param  async           : signal raised on completion, with the result
+ *                            of the operation
+ *
+ *  @return  0 when the operation was submitted, -EBUSY when no operation
+ *  context is available, otherwise a negative errno code.
+ */
+int flash_write_async(const struct device *dev, off_t offset,
+		      const void *data, size_t len,
+		      struct k_poll_signal *async);
+
+/**
+ *  @brief  Erase part or all of a flash memory without waiting for
+ *  completion.
+ *
+ *  Starts the same operation as flash_erase() and returns once it has
+ *  been submitted. Completion is reported by raising @p async with the
+ *  operation result; the disabled write protection must stay valid
+ *  until then.
+ *
+ *  @param  dev             : flash device
+ *  @param  offset          : erase area starting offset
+ *  @param  size            : size of area to be erased
+ *  @param  async           : signal raised on completion, with the result
+ *                            of the operation
+ *
+ *  @return  0 when the operation was submitted, -EBUSY when no operation
+ *  context is available, otherwise a negative errno code.
+ */
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct k_poll_signal *async);
+#endif /* CONFIG_FLASH_ASYNC */
+
 struct flash_pages_info {
 	off_t start_offset; /* offset from the base of flash address */
 	size_t size;
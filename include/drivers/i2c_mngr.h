@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Queued transaction manager for I2C controllers
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_I2C_MNGR_H_
+#define ZEPHYR_INCLUDE_DRIVERS_I2C_MNGR_H_
+
+/**
+ * @brief I2C Transaction Manager Interface
+ * @defgroup i2c_mngr_interface I2C Transaction Manager Interface
+ * @ingroup io_interfaces
+ * @{
+ */
+
+#include <kernel.h>
+#include <drivers/i2c.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct i2c_mngr_transaction;
+
+/**
+ * @typedef i2c_mngr_callback_t
+ * @brief Callback invoked when a queued transaction has completed.
+ *
+ * Invoked from the manager work queue context with the completed
+ * transaction and the result of the underlying i2c_transfer() call.
+ */
+typedef void (*i2c_mngr_callback_t)(struct i2c_mngr_transaction *trans,
+				    int result);
+
+/**
+ * @brief A single queued I2C transaction.
+ *
+ * The structure and the messages it points to must stay valid until the
+ * completion callback has been invoked or the completion signal has
+ * been raised.
+ */
+struct i2c_mngr_transaction {
+	/** Internal, used for queuing; do not modify. */
+	void *fifo_reserved;
+
+	/** Messages making up the transaction. */
+	struct i2c_msg *msgs;
+
+	/** Number of messages. */
+	uint8_t num_msgs;
+
+	/** Address of the target device. */
+	uint16_t addr;
+
+	/** Completion callback, or NULL. */
+	i2c_mngr_callback_t callback;
+
+	/** Signal raised with the transaction result on completion,
+	 * or NULL.
+	 */
+	struct k_poll_signal *async;
+};
+
+/**
+ * @brief Transaction queue for one I2C controller.
+ */
+struct i2c_mngr {
+	const struct device *dev;
+	struct k_fifo fifo;
+	struct k_work work;
+};
+
+/**
+ * @brief Initialize a transaction manager for the given I2C controller.
+ *
+ * @param mngr Manager to initialize.
+ * @param dev I2C controller the queued transactions are executed on.
+ */
+void i2c_mngr_init(struct i2c_mngr *mngr, const struct device *dev);
+
+/**
+ * @brief Queue a transaction for execution.
+ *
+ * Transactions are executed in submission order from a dedicated work
+ * queue, so submitters never block on the bus; a sensor read burst can
+ * be queued from a high-priority thread or an ISR and picked up through
+ * the completion callback.
+ *
+ * Can be called from ISR context.
+ *
+ * @param mngr Manager to submit to.
+ * @param trans Transaction descriptor; owned by the manager until
+ * completion is reported.
+ *
+ * @return 0 when the transaction was queued, negative errno otherwise.
+ */
+int i2c_mngr_submit(struct i2c_mngr *mngr,
+		    struct i2c_mngr_transaction *trans);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_I2C_MNGR_H_ */
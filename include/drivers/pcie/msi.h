@@ -72,6 +72,53 @@ extern uint16_t pcie_msi_mdr(unsigned int irq);
  */
 extern bool pcie_set_msi(pcie_bdf_t bdf, unsigned int irq);
 
+/**
+ * @brief Per-vector binding used when configuring MSI-X.
+ *
+ * Each entry maps one MSI-X table vector to an IRQ and, optionally,
+ * to a handler that is connected at runtime.
+ */
+struct pcie_msix_vector {
+	/** IRQ generated by this vector */
+	unsigned int irq;
+	/** Interrupt priority used when connecting the handler */
+	unsigned int priority;
+	/** Handler to connect at runtime, or NULL if the IRQ is
+	 * connected statically by the driver.
+	 */
+	void (*handler)(const void *parameter);
+	/** Parameter passed to the handler */
+	const void *parameter;
+};
+
+/**
+ * @brief Get the number of MSI-X vectors an endpoint supports.
+ *
+ * @param bdf the target PCI endpoint
+ * @return the MSI-X table size, or 0 if the endpoint has no MSI-X
+ * capability.
+ */
+extern uint32_t pcie_msix_vectors(pcie_bdf_t bdf);
+
+/**
+ * @brief Configure the given PCI endpoint to generate MSI-X interrupts.
+ *
+ * The first n_vector entries of the endpoint's MSI-X table are
+ * programmed and unmasked, one IRQ per vector, which allows drivers
+ * for multi-queue devices to spread their queue interrupts over
+ * multiple IRQs/cores. Handlers given in the bindings are connected
+ * with irq_connect_dynamic() when CONFIG_DYNAMIC_INTERRUPTS is
+ * enabled; otherwise they must be connected statically beforehand.
+ *
+ * @param bdf the target PCI endpoint
+ * @param vectors array of vector bindings
+ * @param n_vector number of entries in the array
+ * @return true if the endpoint was configured, false if it has no
+ * MSI-X capability or the table is too small.
+ */
+extern bool pcie_set_msix(pcie_bdf_t bdf, struct pcie_msix_vector *vectors,
+			  uint32_t n_vector);
+
 /*
  * MSI capability IDs in the PCI configuration capability list.
  */
@@ -100,6 +147,40 @@ extern bool pcie_set_msi(pcie_bdf_t bdf, unsigned int irq);
 #define PCIE_MSI_MDR_32		2U
 #define PCIE_MSI_MDR_64		3U
 
+/*
+ * As for MSI, the first word of the MSI-X capability carries the
+ * message control register in its high 16 bits. The following two
+ * words locate the vector table and the pending bit array: each
+ * holds a BAR indicator in the low three bits and an offset into
+ * that BAR in the remaining bits.
+ */
+
+#define PCIE_MSIX_MCR		0U
+
+#define PCIE_MSIX_MCR_EN	0x80000000U  /* enable MSI-X */
+#define PCIE_MSIX_MCR_FMASK	0x40000000U  /* function mask */
+#define PCIE_MSIX_MCR_TBL_SIZE(w) ((((w) >> 16) & 0x7FFU) + 1U)
+
+#define PCIE_MSIX_TR		1U
+#define PCIE_MSIX_TR_BIR(w)	((w) & 0x7U)
+#define PCIE_MSIX_TR_OFFSET(w)	((w) & ~0x7U)
+
+#define PCIE_MSIX_PBA		2U
+
+/*
+ * Each MSI-X table entry is 16 bytes: message address low/high,
+ * message data and vector control. Bit 0 of the vector control
+ * masks the vector.
+ */
+
+#define PCIE_MSIX_VECTOR_SIZE	16U
+#define PCIE_MSIX_VECTOR_MAP0	0U
+#define PCIE_MSIX_VECTOR_MAP1	4U
+#define PCIE_MSIX_VECTOR_MDR	8U
+#define PCIE_MSIX_VECTOR_CTRL	12U
+
+#define PCIE_MSIX_VECTOR_CTRL_MASK 0x1U
+
 #ifdef __cplusplus
 }
 #endif
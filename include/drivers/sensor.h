@@ -233,6 +233,14 @@ enum sensor_trigger_type {
 	/** Trigger fires when a free fall is detected. */
 	SENSOR_TRIG_FREEFALL,
 
+	/**
+	 * Trigger fires when the hardware FIFO fill level crosses the
+	 * watermark configured via the @ref SENSOR_ATTR_FIFO_WATERMARK
+	 * attribute.  The accumulated samples can then be drained in one
+	 * burst bus transaction with @ref sensor_batch_read.
+	 */
+	SENSOR_TRIG_FIFO_WATERMARK,
+
 	/**
 	 * Number of all common sensor triggers.
 	 */
@@ -294,6 +302,11 @@ enum sensor_attribute {
 	 * algorithms to calibrate itself on a certain axis, or all of them.
 	 */
 	SENSOR_ATTR_CALIB_TARGET,
+	/**
+	 * Hardware FIFO watermark level, in samples.  Crossing the
+	 * watermark fires the @ref SENSOR_TRIG_FIFO_WATERMARK trigger.
+	 */
+	SENSOR_ATTR_FIFO_WATERMARK,
 
 	/**
 	 * Number of all common sensor attributes.
@@ -371,12 +384,52 @@ typedef int (*sensor_channel_get_t)(const struct device *dev,
 				    enum sensor_channel chan,
 				    struct sensor_value *val);
 
+/**
+ * @brief Batch of raw samples read from a sensor's hardware FIFO.
+ *
+ * The caller provides the sample buffer and sets count to its capacity
+ * in samples; @ref sensor_batch_read updates count and sample_size to
+ * describe the data actually read.
+ */
+struct sensor_batch {
+	/** Buffer for raw sample frames, as read from the FIFO. */
+	uint8_t *samples;
+	/** Size of one raw sample frame in bytes, set by the driver. */
+	uint8_t sample_size;
+	/** In: buffer capacity in samples.  Out: samples read. */
+	uint16_t count;
+};
+
+/**
+ * @typedef sensor_batch_read_t
+ * @brief Callback API for draining a sensor's hardware FIFO
+ *
+ * See sensor_batch_read() for argument description
+ */
+typedef int (*sensor_batch_read_t)(const struct device *dev,
+				   enum sensor_channel chan,
+				   struct sensor_batch *batch);
+
+/**
+ * @typedef sensor_batch_decode_t
+ * @brief Callback API for decoding one raw sample out of a batch
+ *
+ * See sensor_batch_decode() for argument description
+ */
+typedef int (*sensor_batch_decode_t)(const struct device *dev,
+				     enum sensor_channel chan,
+				     const struct sensor_batch *batch,
+				     uint16_t index,
+				     struct sensor_value *val);
+
 __subsystem struct sensor_driver_api {
 	sensor_attr_set_t attr_set;
 	sensor_attr_get_t attr_get;
 	sensor_trigger_set_t trigger_set;
 	sensor_sample_fetch_t sample_fetch;
 	sensor_channel_get_t channel_get;
+	sensor_batch_read_t batch_read;
+	sensor_batch_decode_t batch_decode;
 };
 
 /**
@@ -566,6 +619,68 @@ static inline int z_impl_sensor_channel_get(const struct device *dev,
 	return api->channel_get(dev, chan, val);
 }
 
+/**
+ * @brief Read a batch of raw samples from a sensor's hardware FIFO
+ *
+ * Drain up to batch->count samples from the FIFO in a single burst bus
+ * transaction.  The FIFO watermark is configured via the @ref
+ * SENSOR_ATTR_FIFO_WATERMARK attribute and crossing it is signalled by
+ * the @ref SENSOR_TRIG_FIFO_WATERMARK trigger, so this is typically
+ * called from that trigger's handler.  Use @ref sensor_batch_decode to
+ * convert the raw samples.
+ *
+ * This API is not permitted for user threads.
+ *
+ * @param dev Pointer to the sensor device
+ * @param chan The channel to read
+ * @param batch The batch descriptor to fill
+ *
+ * @return 0 if successful, negative errno code if failure.
+ */
+static inline int sensor_batch_read(const struct device *dev,
+				    enum sensor_channel chan,
+				    struct sensor_batch *batch)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->batch_read == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->batch_read(dev, chan, batch);
+}
+
+/**
+ * @brief Decode one raw sample out of a batch
+ *
+ * For vectorial channels the decoded axes are returned at val[0],
+ * val[1] and val[2], as with @ref sensor_channel_get.
+ *
+ * @param dev Pointer to the sensor device the batch was read from
+ * @param chan The channel the batch was read for
+ * @param batch Batch previously filled by @ref sensor_batch_read
+ * @param index Index of the sample to decode, below batch->count
+ * @param val Where to store the decoded value(s)
+ *
+ * @return 0 if successful, negative errno code if failure.
+ */
+static inline int sensor_batch_decode(const struct device *dev,
+				      enum sensor_channel chan,
+				      const struct sensor_batch *batch,
+				      uint16_t index,
+				      struct sensor_value *val)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->batch_decode == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->batch_decode(dev, chan, batch, index, val);
+}
+
 /**
  * @brief The value of gravitational constant in micro m/s^2.
  */
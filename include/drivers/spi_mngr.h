@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Queued transaction manager for SPI devices
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_SPI_MNGR_H_
+#define ZEPHYR_INCLUDE_DRIVERS_SPI_MNGR_H_
+
+/**
+ * @brief SPI Transaction Manager Interface
+ * @defgroup spi_mngr_interface SPI Transaction Manager Interface
+ * @ingroup io_interfaces
+ * @{
+ */
+
+#include <kernel.h>
+#include <drivers/spi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct spi_mngr_transaction;
+
+/**
+ * @typedef spi_mngr_callback_t
+ * @brief Callback invoked when a queued transaction has completed.
+ *
+ * Invoked from the manager work queue context with the completed
+ * transaction and the result of the underlying spi_transceive() call.
+ */
+typedef void (*spi_mngr_callback_t)(struct spi_mngr_transaction *trans,
+				    int result);
+
+/**
+ * @brief A single queued SPI transaction.
+ *
+ * The structure and the buffer sets it points to must stay valid until
+ * the completion callback has been invoked or the completion signal has
+ * been raised.
+ */
+struct spi_mngr_transaction {
+	/** Internal, used for queuing; do not modify. */
+	void *fifo_reserved;
+
+	/** Configuration to apply for this transaction. Consecutive
+	 * transactions submitted with the same configuration are driven
+	 * back-to-back without controller reconfiguration.
+	 */
+	const struct spi_config *config;
+
+	/** Buffers to transmit, or NULL. */
+	const struct spi_buf_set *tx_bufs;
+
+	/** Buffers to receive into, or NULL. */
+	const struct spi_buf_set *rx_bufs;
+
+	/** Completion callback, or NULL. */
+	spi_mngr_callback_t callback;
+
+	/** Signal raised with the transaction result on completion,
+	 * or NULL.
+	 */
+	struct k_poll_signal *async;
+};
+
+/**
+ * @brief Transaction queue for one SPI bus.
+ */
+struct spi_mngr {
+	const struct device *dev;
+	struct k_fifo fifo;
+	struct k_work work;
+};
+
+/**
+ * @brief Initialize a transaction manager for the given SPI device.
+ *
+ * @param mngr Manager to initialize.
+ * @param dev SPI device the queued transactions are executed on.
+ */
+void spi_mngr_init(struct spi_mngr *mngr, const struct device *dev);
+
+/**
+ * @brief Queue a transaction for execution.
+ *
+ * Transactions are executed in submission order from a dedicated work
+ * queue, so submitters never block on the bus. A queue drain executes
+ * all pending transactions back-to-back; transactions sharing a
+ * configuration skip the controller setup the driver would otherwise
+ * re-run for interleaved users of the bus.
+ *
+ * Can be called from ISR context.
+ *
+ * @param mngr Manager to submit to.
+ * @param trans Transaction descriptor; owned by the manager until
+ * completion is reported.
+ *
+ * @return 0 when the transaction was queued, negative errno otherwise.
+ */
+int spi_mngr_submit(struct spi_mngr *mngr,
+		    struct spi_mngr_transaction *trans);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_SPI_MNGR_H_ */
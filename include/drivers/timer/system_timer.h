@@ -127,6 +127,36 @@ extern void z_clock_announce(int32_t ticks);
  */
 extern uint32_t z_clock_elapsed(void);
 
+#ifdef CONFIG_HR_TIMER
+/**
+ * @brief Program a cycle-granularity alarm
+ *
+ * Requests an interrupt when the hardware cycle counter (as reported
+ * by z_timer_cycle_get_32()) reaches the given absolute value, with
+ * no rounding to tick boundaries.  Only one alarm is pending at a
+ * time; a new call replaces the previous alarm.  The driver may fire
+ * early (e.g. when the deadline exceeds the comparator span), in
+ * which case the kernel re-arms as needed.
+ *
+ * @param cycles Absolute 32-bit cycle count of the deadline
+ */
+extern void z_clock_hr_set(uint32_t cycles);
+
+/**
+ * @brief Cancel the pending cycle-granularity alarm, if any
+ */
+extern void z_clock_hr_cancel(void);
+
+/**
+ * @brief Cycle-granularity alarm expiration, called by the driver
+ *
+ * Implemented by the kernel's high-resolution timer core; invoked
+ * from the timer interrupt when the alarm set with z_clock_hr_set()
+ * has expired.
+ */
+extern void z_clock_hr_expired(void);
+#endif /* CONFIG_HR_TIMER */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Ring buffer backed adapter for interrupt driven UART drivers
+ *
+ * The adapter provides a generic ISR that moves data between the UART
+ * hardware FIFOs and per-direction ring buffers in maximal chunks, so
+ * that consumers do not have to implement their own per-byte interrupt
+ * handling.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_UART_IRQ_ADAPTER_H_
+#define ZEPHYR_INCLUDE_DRIVERS_UART_IRQ_ADAPTER_H_
+
+#include <drivers/uart.h>
+#include <sys/ring_buffer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct uart_irq_adapter;
+
+/**
+ * @typedef uart_irq_adapter_cb_t
+ * @brief Callback called from the adapter ISR.
+ *
+ * The RX callback is called when the fill level of the RX ring buffer
+ * reaches the watermark, or when the ring buffer runs full and reception
+ * is throttled. The TX callback is called when the TX ring buffer has
+ * been completely drained into the hardware FIFO.
+ *
+ * @param dev       UART device instance.
+ * @param adapter   Adapter the callback was registered on.
+ * @param user_data User data given to uart_irq_adapter_init().
+ */
+typedef void (*uart_irq_adapter_cb_t)(const struct device *dev,
+				      struct uart_irq_adapter *adapter,
+				      void *user_data);
+
+/** @cond INTERNAL_HIDDEN */
+
+struct uart_irq_adapter {
+	const struct device *dev;
+	struct ring_buf *rx_rb;
+	struct ring_buf *tx_rb;
+	uart_irq_adapter_cb_t rx_cb;
+	uart_irq_adapter_cb_t tx_cb;
+	void *user_data;
+	uint32_t rx_watermark;
+	bool rx_stopped;
+};
+
+/** @endcond */
+
+/**
+ * @brief Initialize the adapter and attach it to a UART device.
+ *
+ * The adapter installs its ISR with uart_irq_callback_user_data_set()
+ * and enables the RX interrupt. The ring buffers must be initialized by
+ * the caller and stay valid as long as the adapter is in use.
+ *
+ * @param adapter      Adapter to initialize.
+ * @param dev          Interrupt driven UART device to attach to.
+ * @param rx_rb        Ring buffer filled with received data.
+ * @param tx_rb        Ring buffer drained into the TX FIFO.
+ * @param rx_watermark RX fill level (in bytes) that triggers the RX
+ *                     callback. Use 1 to get a callback for any data.
+ * @param rx_cb        Callback for received data or NULL.
+ * @param tx_cb        Callback called when TX is drained or NULL.
+ * @param user_data    User data passed to the callbacks.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if a required parameter is NULL
+ */
+int uart_irq_adapter_init(struct uart_irq_adapter *adapter,
+			  const struct device *dev,
+			  struct ring_buf *rx_rb, struct ring_buf *tx_rb,
+			  uint32_t rx_watermark,
+			  uart_irq_adapter_cb_t rx_cb,
+			  uart_irq_adapter_cb_t tx_cb,
+			  void *user_data);
+
+/**
+ * @brief Read received data from the RX ring buffer.
+ *
+ * If reception was throttled because the ring buffer ran full, the RX
+ * interrupt is re-enabled once data has been read out.
+ *
+ * @param adapter Adapter to read from.
+ * @param data    Buffer the data is copied to.
+ * @param len     Size of the buffer.
+ *
+ * @return Number of bytes copied.
+ */
+size_t uart_irq_adapter_read(struct uart_irq_adapter *adapter,
+			     uint8_t *data, size_t len);
+
+/**
+ * @brief Queue data for transmission.
+ *
+ * The data is copied into the TX ring buffer and the TX interrupt is
+ * enabled. The ISR drains the ring buffer into the hardware FIFO in
+ * maximal chunks.
+ *
+ * @param adapter Adapter to write to.
+ * @param data    Data to send.
+ * @param len     Length of the data.
+ *
+ * @return Number of bytes queued. Can be smaller than len if the ring
+ *         buffer is full.
+ */
+size_t uart_irq_adapter_write(struct uart_irq_adapter *adapter,
+			      const uint8_t *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_UART_IRQ_ADAPTER_H_ */
@@ -121,6 +121,14 @@ struct fcb {
 	/**< Flash area used by the fcb instance, , internal state.
 	 * This can be transfer to FCB user
 	 */
+
+#ifdef CONFIG_FCB_WALK_CACHE
+	uint32_t f_valid_off[CONFIG_FCB_WALK_CACHE_SECTORS];
+	/**< Per-sector offset up to which element crc's have already been
+	 * verified, internal state. Elements below this offset are served
+	 * from a header read only when walked again.
+	 */
+#endif
 };
 
 /**
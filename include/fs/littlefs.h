@@ -99,6 +99,29 @@ struct fs_littlefs {
 					  CONFIG_FS_LITTLEFS_CACHE_SIZE, \
 					  CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE)
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+/** @brief Counters kept by the littlefs block cache.
+ *
+ * The cache is shared by all littlefs mounts; the counters cover all
+ * of them.
+ */
+struct fs_littlefs_cache_stats {
+	uint32_t hits;		/**< reads served from a cached block */
+	uint32_t misses;	/**< reads that had to load a block */
+	uint32_t readaheads;	/**< blocks loaded by sequential read-ahead */
+	uint32_t flushes;	/**< deferred write-back flash programs */
+	uint32_t evictions;	/**< cache lines reclaimed for other blocks */
+};
+
+/** @brief Read the littlefs block cache counters.
+ *
+ * @param stats destination for the counter snapshot
+ * @param clear when true the counters are reset after the snapshot
+ */
+void fs_littlefs_cache_stats_get(struct fs_littlefs_cache_stats *stats,
+				 bool clear);
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 #ifdef __cplusplus
 }
 #endif
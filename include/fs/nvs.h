@@ -57,6 +57,18 @@ struct nvs_fs {
 	struct k_mutex nvs_lock;
 	const struct device *flash_device;
 	const struct flash_parameters *flash_parameters;
+#if CONFIG_NVS_LOOKUP_CACHE
+	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#endif
+#if CONFIG_NVS_TRANSACTION
+	bool tx_active;		/* write transaction in progress */
+	struct k_thread *tx_owner;	/* thread owning the transaction */
+	uint16_t tx_cnt;		/* number of staged entries */
+	uint16_t tx_data_len;	/* bytes staged in tx_data */
+	uint16_t tx_id[CONFIG_NVS_TRANSACTION_MAX_ENTRIES];
+	uint16_t tx_len[CONFIG_NVS_TRANSACTION_MAX_ENTRIES];
+	uint8_t tx_data[CONFIG_NVS_TRANSACTION_BUFFER_SIZE];
+#endif
 };
 
 /**
@@ -108,6 +120,40 @@ int nvs_clear(struct nvs_fs *fs);
 
 ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len);
 
+/**
+ * @brief nvs_write_begin
+ *
+ * Start a write transaction. Subsequent nvs_write() calls from the same
+ * thread are staged in RAM instead of being written to flash, until the
+ * transaction is committed with nvs_write_commit(). Other threads block
+ * on the file system until the commit. Staged entries are not visible
+ * to reads and are not compared against already stored data.
+ *
+ * @param fs Pointer to file system
+ * @retval 0 Success
+ * @retval -EALREADY A transaction is already in progress
+ * @retval -ERRNO errno code if error
+ */
+int nvs_write_begin(struct nvs_fs *fs);
+
+/**
+ * @brief nvs_write_commit
+ *
+ * Commit a write transaction. All staged entries are written with one
+ * contiguous data program followed by block-packed allocation table
+ * writes, reducing the flash program count compared to individual
+ * writes. The data is programmed before any allocation table entry, so
+ * a power failure before the table write discards the transaction
+ * completely; a failure during it retains a valid prefix of the staged
+ * entries.
+ *
+ * @param fs Pointer to file system
+ * @retval 0 Success
+ * @retval -EINVAL No transaction in progress
+ * @retval -ERRNO errno code if error, the transaction is discarded
+ */
+int nvs_write_commit(struct nvs_fs *fs);
+
 /**
  * @brief nvs_delete
  *
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief High-resolution timer API
+ *
+ * Timers programmed directly in hardware cycles against the system
+ * timer's comparator, bypassing the kernel tick rounding.  Intended
+ * for workloads such as motor commutation or sensor synchronization
+ * that need sub-tick precision without a dedicated hardware counter.
+ */
+
+#ifndef ZEPHYR_INCLUDE_HR_TIMER_H_
+#define ZEPHYR_INCLUDE_HR_TIMER_H_
+
+#include <zephyr/types.h>
+#include <sys/dlist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct k_hr_timer;
+
+/**
+ * @typedef k_hr_timer_expiry_t
+ * @brief High-resolution timer expiry function type.
+ *
+ * Expiry functions run in interrupt context.
+ *
+ * @param timer Address of the expired timer.
+ */
+typedef void (*k_hr_timer_expiry_t)(struct k_hr_timer *timer);
+
+struct k_hr_timer {
+	sys_dnode_t node;
+	k_hr_timer_expiry_t expiry_fn;
+	/* Absolute expiration, in hardware cycles (k_cycle_get_32()
+	 * time base).
+	 */
+	uint32_t expiry;
+	void *user_data;
+};
+
+/**
+ * @brief Initialize a high-resolution timer.
+ *
+ * @param timer Address of the timer.
+ * @param expiry_fn Function to invoke when the timer expires, from
+ *                  interrupt context.
+ */
+void k_hr_timer_init(struct k_hr_timer *timer, k_hr_timer_expiry_t expiry_fn);
+
+/**
+ * @brief Start a high-resolution timer.
+ *
+ * The expiry function is invoked once the hardware cycle counter has
+ * advanced by @a delay_cycles.  Restarting a running timer replaces
+ * its deadline.
+ *
+ * Delays must be shorter than half the 32-bit cycle counter wrap
+ * interval.  The achievable precision is one cycle of the system
+ * timer's counter; very short delays are rounded up to the minimum
+ * the driver can reliably program.
+ *
+ * @param timer Address of the timer.
+ * @param delay_cycles Delay before expiration, in hardware cycles.
+ */
+void k_hr_timer_start(struct k_hr_timer *timer, uint32_t delay_cycles);
+
+/**
+ * @brief Stop a high-resolution timer.
+ *
+ * @param timer Address of the timer.
+ *
+ * @retval true The timer was pending and has been removed.
+ * @retval false The timer was not running.
+ */
+bool k_hr_timer_stop(struct k_hr_timer *timer);
+
+/**
+ * @brief Get the cycles remaining before a timer expires.
+ *
+ * @param timer Address of the timer.
+ *
+ * @return Remaining hardware cycles, or 0 if the timer is not running
+ *         or has already expired.
+ */
+uint32_t k_hr_timer_remaining_get(struct k_hr_timer *timer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_HR_TIMER_H_ */
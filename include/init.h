@@ -49,6 +49,16 @@ struct init_entry {
 	 * if the init entry is not used for a device driver but a services.
 	 */
 	const struct device *dev;
+#ifdef CONFIG_PARALLEL_INIT
+	/** Initialization priority within the level; entries sharing a
+	 * priority may be run concurrently.
+	 */
+	uint8_t prio;
+#endif
+#ifdef CONFIG_BOOT_TIMING
+	/** Init function symbol name, for boot timing records. */
+	const char *name;
+#endif
 };
 
 void z_sys_init_run_level(int32_t _level);
@@ -82,12 +92,26 @@ void z_sys_init_run_level(int32_t _level);
  * @param prio The initialization priority of the object, relative to
  * other objects of the same initialization level. See SYS_INIT().
  */
+#ifdef CONFIG_PARALLEL_INIT
+#define Z_INIT_ENTRY_PRIO(_prio) .prio = (_prio),
+#else
+#define Z_INIT_ENTRY_PRIO(_prio)
+#endif
+
+#ifdef CONFIG_BOOT_TIMING
+#define Z_INIT_ENTRY_NAME(_init_fn) .name = STRINGIFY(_init_fn),
+#else
+#define Z_INIT_ENTRY_NAME(_init_fn)
+#endif
+
 #define Z_INIT_ENTRY_DEFINE(_entry_name, _init_fn, _device, _level, _prio)	\
 	static const Z_DECL_ALIGN(struct init_entry)			\
 		_CONCAT(__init_, _entry_name) __used			\
 	__attribute__((__section__(".init_" #_level STRINGIFY(_prio)))) = { \
 		.init = (_init_fn),					\
 		.dev = (_device),					\
+		Z_INIT_ENTRY_PRIO(_prio)				\
+		Z_INIT_ENTRY_NAME(_init_fn)				\
 	}
 
 /**
@@ -217,6 +217,8 @@ struct z_object_assignment {
 #define K_OBJ_FLAG_ALLOC	BIT(2)
 /** Driver Object */
 #define K_OBJ_FLAG_DRIVER	BIT(3)
+/** Unreferenced dynamic object parked in a reuse cache */
+#define K_OBJ_FLAG_CACHED	BIT(4)
 
 /**
  * Lookup a kernel object and init its metadata if it exists
@@ -502,6 +504,14 @@ struct _thread_base {
 
 #endif
 
+#ifdef CONFIG_SCHED_SOFT_AFFINITY
+	/* Cycle count captured when the thread last stopped running,
+	 * used to judge whether its working set is still warm in the
+	 * cache of the CPU recorded above.
+	 */
+	uint32_t run_end_cycle;
+#endif
+
 #ifdef CONFIG_SCHED_CPU_MASK
 	/* "May run on" bits for each CPU */
 	uint8_t cpu_mask;
@@ -616,6 +626,14 @@ struct k_thread {
 	struct _thread_stack_info stack_info;
 #endif /* CONFIG_THREAD_STACK_INFO */
 
+#if defined(CONFIG_TRACING_THREAD_STATS)
+	/** cycles consumed while this thread was scheduled in */
+	uint64_t run_cycles;
+
+	/** number of times this thread was switched in */
+	uint32_t run_switches;
+#endif /* CONFIG_TRACING_THREAD_STATS */
+
 #if defined(CONFIG_USERSPACE)
 	/** memory domain info of the thread */
 	struct _mem_domain_info mem_domain_info;
@@ -623,6 +641,17 @@ struct k_thread {
 	k_thread_stack_t *stack_obj;
 	/** current syscall frame pointer */
 	void *syscall_frame;
+#ifdef CONFIG_KOBJECT_VALIDATION_CACHE
+	/** MRU cache of objects this thread passed permission checks
+	 * on, dropped wholesale when the global permission generation
+	 * moves on
+	 */
+	struct {
+		uintptr_t generation;
+		const void *obj[CONFIG_KOBJECT_VALIDATION_CACHE_SIZE];
+		struct z_object *ko[CONFIG_KOBJECT_VALIDATION_CACHE_SIZE];
+	} perm_cache;
+#endif
 #endif /* CONFIG_USERSPACE */
 
 
@@ -2187,6 +2216,15 @@ struct k_queue {
 	struct k_spinlock lock;
 	_wait_q_t wait_q;
 
+#ifdef CONFIG_QUEUE_MPSC
+	/* Lock-free producer inbox and waiting-consumer flag, only used
+	 * when the queue operates in MPSC mode.
+	 */
+	atomic_ptr_t mpsc_inbox;
+	atomic_t mpsc_waiter;
+	bool mpsc_mode;
+#endif
+
 	_POLL_EVENT;
 	_OBJECT_TRACING_NEXT_PTR(k_queue)
 	_OBJECT_TRACING_LINKED_FLAG
@@ -2226,6 +2264,30 @@ extern void *z_queue_node_peek(sys_sfnode_t *node, bool needs_free);
  */
 __syscall void k_queue_init(struct k_queue *queue);
 
+#ifdef CONFIG_QUEUE_MPSC
+/**
+ * @brief Initialize a queue in lock-free MPSC mode.
+ *
+ * This routine initializes a queue object for a multiple-producer,
+ * single-consumer usage pattern: any number of threads or ISRs may
+ * append items concurrently, but only one thread may consume them.
+ * Items are appended with a single atomic push instead of taking the
+ * queue spinlock, which reduces lock contention and interrupt latency
+ * on hot ISR-to-thread data paths.
+ *
+ * k_queue_append() and k_queue_get() keep their normal semantics.
+ * The remaining queue APIs (prepend, insert, append_list, peek,
+ * cancel_wait) fall back to the locked path and may only be invoked
+ * from the consumer's context. MPSC queues are not accessible from
+ * user mode.
+ *
+ * @param queue Address of the queue.
+ *
+ * @return N/A
+ */
+extern void k_queue_mpsc_init(struct k_queue *queue);
+#endif /* CONFIG_QUEUE_MPSC */
+
 /**
  * @brief Cancel waiting on a queue.
  *
@@ -2447,6 +2509,11 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_MPSC
+	if (atomic_ptr_get(&queue->mpsc_inbox) != NULL) {
+		return 0;
+	}
+#endif
 	return (int)sys_sflist_is_empty(&queue->data_q);
 }
 
@@ -2572,9 +2639,90 @@ __syscall int k_futex_wait(struct k_futex *futex, int expected,
  */
 __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 
+/**
+ * @brief Wake some waiters and requeue the rest onto another futex
+ *
+ * Atomically wake up to wake_count threads pending on the supplied futex
+ * and move all remaining waiters to the wait queue of target, without
+ * waking them. A requeued thread keeps any timeout it was pended with and
+ * is subsequently woken by k_futex_wake() on target (or by that timeout
+ * expiring), so waiters can be drained one by one instead of all racing
+ * for the same resource at once (e.g. a condition variable broadcast
+ * requeueing onto the mutex futex).
+ *
+ * @param futex Futex whose waiters are woken or requeued.
+ * @param expected Expected value of the futex, prior to requeueing.
+ * @param target Futex the remaining waiters are moved to.
+ * @param wake_count Maximum number of threads to wake before requeueing,
+ *                   may be zero to requeue all waiters.
+ * @retval -EACCES Caller does not have access to one of the futex
+ *         addresses.
+ * @retval -EINVAL One of the futex parameter addresses not recognized by
+ *         the kernel, or futex and target are the same object.
+ * @retval -EAGAIN The futex value did not match the expected parameter.
+ * @retval Number of threads that were woken plus the number requeued.
+ */
+__syscall int k_futex_requeue(struct k_futex *futex, int expected,
+			      struct k_futex *target,
+			      unsigned int wake_count);
+
 /** @} */
+
 #endif
 
+/**
+ * @defgroup syscall_batch_apis Vectored System Call APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief One entry of a vectored system call batch
+ *
+ * Describes a single system call to perform: the call ID from
+ * syscall_list.h and up to six arguments, cast to uintptr_t exactly
+ * as for a regular system call. The result of the call is written to
+ * the ret member.
+ */
+struct k_syscall_batch_entry {
+	/** System call ID (K_SYSCALL_...) */
+	uint32_t id;
+
+	/** Arguments, unused ones may be left uninitialized */
+	uintptr_t arg[6];
+
+	/** Return value of the call, written by k_syscall_batch() */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Perform a batch of system calls with a single kernel entry
+ *
+ * Executes count system calls described by the batch array in order,
+ * storing each call's return value in the corresponding entry. Each
+ * entry is validated and executed exactly as if it had been invoked
+ * individually, but the trap in and out of the kernel is paid only
+ * once for the whole batch.
+ *
+ * If an entry carries an invalid system call ID the batch stops at
+ * that entry; results of the preceding entries remain valid. Bad
+ * arguments within an entry terminate the caller just as they would
+ * for a directly invoked system call.
+ *
+ * Only meaningful when called from user mode; kernel mode callers can
+ * invoke the APIs directly and pay no trap overhead to amortize.
+ *
+ * @param batch Array of system calls to perform.
+ * @param count Number of entries in batch.
+ * @retval 0 All entries were executed.
+ * @retval -EINVAL An entry carried an invalid system call ID.
+ * @retval -ENOTSUP Called from supervisor mode.
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *batch,
+			      size_t count);
+
+/** @} */
+
 struct k_fifo {
 	struct k_queue _queue;
 };
@@ -2889,6 +3037,7 @@ struct k_lifo {
  * @cond INTERNAL_HIDDEN
  */
 #define K_STACK_FLAG_ALLOC	((uint8_t)1)	/* Buffer was allocated */
+#define K_STACK_FLAG_LOCKFREE	((uint8_t)2)	/* Lock-free LIFO mode */
 
 typedef uintptr_t stack_data_t;
 
@@ -2897,6 +3046,14 @@ struct k_stack {
 	struct k_spinlock lock;
 	stack_data_t *base, *next, *top;
 
+#ifdef CONFIG_STACK_LOCKFREE
+	/* Number of occupied slots and number of blocked consumers,
+	 * only used in lock-free mode.
+	 */
+	atomic_t lf_count;
+	atomic_t lf_waiters;
+#endif
+
 	_OBJECT_TRACING_NEXT_PTR(k_stack)
 	_OBJECT_TRACING_LINKED_FLAG
 	uint8_t flags;
@@ -2937,6 +3094,29 @@ struct k_stack {
 void k_stack_init(struct k_stack *stack,
 		  stack_data_t *buffer, uint32_t num_entries);
 
+#ifdef CONFIG_STACK_LOCKFREE
+/**
+ * @brief Initialize a stack in lock-free mode.
+ *
+ * This routine initializes a stack object whose push and pop fast
+ * paths use atomic operations on the top index instead of taking the
+ * stack spinlock, which reduces lock contention between ISR producers
+ * and consumer threads. The spinlock is only taken when a consumer
+ * blocks on an empty stack and when a producer wakes it.
+ *
+ * The value (stack_data_t)-1 is reserved to mark empty slots and must
+ * not be pushed. Lock-free stacks are kernel-mode only.
+ *
+ * @param stack Address of the stack.
+ * @param buffer Address of array used to hold stacked values.
+ * @param num_entries Maximum number of values that can be stacked.
+ *
+ * @return N/A
+ */
+void k_stack_lockfree_init(struct k_stack *stack,
+			   stack_data_t *buffer, uint32_t num_entries);
+#endif /* CONFIG_STACK_LOCKFREE */
+
 
 /**
  * @brief Initialize a stack.
@@ -3063,6 +3243,7 @@ struct k_work_q {
 
 enum {
 	K_WORK_STATE_PENDING,	/* Work item pending state */
+	K_WORK_STATE_RUNNING,	/* Handler live on a pool worker */
 };
 
 struct k_work {
@@ -3259,6 +3440,37 @@ extern void k_work_q_start(struct k_work_q *work_q,
 			   k_thread_stack_t *stack,
 			   size_t stack_size, int prio);
 
+/**
+ * @brief Attach an additional worker thread to a workqueue.
+ *
+ * This routine adds one more worker thread to an already started
+ * workqueue @a work_q, turning it into a worker pool: all workers
+ * drain the same queue concurrently, so a slow handler no longer
+ * blocks the items behind it and, under SMP, handlers run in
+ * parallel on idle CPUs.
+ *
+ * Submission APIs are unchanged.  A given work item is never
+ * processed by two workers at the same time; if it is resubmitted
+ * while its handler is still running on another worker, it is
+ * deferred until that handler returns.  Distinct work items may run
+ * concurrently, so handlers sharing data must provide their own
+ * synchronization.
+ *
+ * @param work_q Address of workqueue, already started with
+ *		k_work_q_start().
+ * @param worker Address of the additional worker thread object.
+ * @param stack Pointer to the worker thread's stack space, as defined
+ *		by K_THREAD_STACK_DEFINE()
+ * @param stack_size Size of the worker thread's stack (in bytes).
+ * @param prio Priority of the worker thread.
+ *
+ * @return N/A
+ */
+extern void k_work_q_worker_start(struct k_work_q *work_q,
+				  struct k_thread *worker,
+				  k_thread_stack_t *stack,
+				  size_t stack_size, int prio);
+
 /**
  * @brief Start a workqueue in user mode
  *
@@ -3693,6 +3905,124 @@ __syscall int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
  */
 __syscall int k_mutex_unlock(struct k_mutex *mutex);
 
+/**
+ * @}
+ */
+
+/**
+ * @defgroup condvar_apis Condition Variables APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * Condition variable structure
+ * @ingroup condvar_apis
+ */
+struct k_condvar {
+	/** Condition variable wait queue */
+	_wait_q_t wait_q;
+
+	/** Mutex the waiters are paired with */
+	struct k_mutex *mutex;
+
+	_OBJECT_TRACING_NEXT_PTR(k_condvar)
+	_OBJECT_TRACING_LINKED_FLAG
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_CONDVAR_INITIALIZER(obj) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.mutex = NULL, \
+	_OBJECT_TRACING_INIT \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a condition variable.
+ *
+ * The condition variable can be accessed outside the module where it is
+ * defined using:
+ *
+ * @code extern struct k_condvar <name>; @endcode
+ *
+ * @param name Name of the condition variable.
+ */
+#define K_CONDVAR_DEFINE(name) \
+	Z_STRUCT_SECTION_ITERABLE(k_condvar, name) = \
+		Z_CONDVAR_INITIALIZER(name)
+
+/**
+ * @brief Initialize a condition variable.
+ *
+ * This routine initializes a condition variable object, prior to its
+ * first use.
+ *
+ * @param condvar Address of the condition variable.
+ *
+ * @retval 0 Condition variable created successfully
+ */
+__syscall int k_condvar_init(struct k_condvar *condvar);
+
+/**
+ * @brief Signal a condition variable.
+ *
+ * This routine wakes the highest priority thread waiting on @a condvar,
+ * if any.
+ *
+ * @param condvar Address of the condition variable.
+ *
+ * @retval 0
+ */
+__syscall int k_condvar_signal(struct k_condvar *condvar);
+
+/**
+ * @brief Unblock all threads waiting on a condition variable.
+ *
+ * When the calling thread holds the mutex the waiters are paired with,
+ * the waiters are moved onto the mutex wait queue instead of being made
+ * runnable (wait morphing): each waiter wakes only once the mutex is
+ * handed to it, so a broadcast does not make every waiter contend for
+ * the mutex at the same time.  Otherwise all waiters are woken
+ * immediately.
+ *
+ * @param condvar Address of the condition variable.
+ *
+ * @return The number of threads unblocked.
+ */
+__syscall int k_condvar_broadcast(struct k_condvar *condvar);
+
+/**
+ * @brief Wait on a condition variable.
+ *
+ * This routine atomically releases @a mutex and blocks the calling
+ * thread on @a condvar; the mutex is locked again before the routine
+ * returns.  The mutex must be locked exactly once by the caller, and
+ * all concurrent waiters on one condition variable must use the same
+ * mutex.
+ *
+ * As with all condition variables, spurious wakeups are possible; the
+ * awaited condition must be re-checked upon return.
+ *
+ * @param condvar Address of the condition variable.
+ * @param mutex Address of the mutex held by the calling thread.
+ * @param timeout Waiting period for the condition variable to be
+ *                signalled, or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Awakened by @a condvar being signalled.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EPERM The current thread does not hold @a mutex exactly once.
+ */
+__syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
+			     k_timeout_t timeout);
+
 /**
  * @}
  */
@@ -3836,6 +4166,127 @@ static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 
 /** @} */
 
+/**
+ * @defgroup event_apis Event APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * Event structure
+ * @ingroup event_apis
+ */
+struct k_event {
+	/** Event wait queue */
+	_wait_q_t wait_q;
+	/** Currently posted events */
+	uint32_t events;
+
+	_OBJECT_TRACING_NEXT_PTR(k_event)
+	_OBJECT_TRACING_LINKED_FLAG
+};
+
+/** Wake when any event of the mask is posted (default) */
+#define K_EVENT_WAIT_ANY	0U
+
+/** Wake only when all events of the mask are posted */
+#define K_EVENT_WAIT_ALL	BIT(0)
+
+/** Clear the matching events from the event object on wakeup */
+#define K_EVENT_WAIT_CONSUME	BIT(1)
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_EVENT_INITIALIZER(obj) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.events = 0U, \
+	_OBJECT_TRACING_INIT \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize an event object.
+ *
+ * The event object can be accessed outside the module where it is
+ * defined using:
+ *
+ * @code extern struct k_event <name>; @endcode
+ *
+ * @param name Name of the event object.
+ */
+#define K_EVENT_DEFINE(name) \
+	Z_STRUCT_SECTION_ITERABLE(k_event, name) = \
+		Z_EVENT_INITIALIZER(name)
+
+/**
+ * @brief Initialize an event object.
+ *
+ * This routine initializes an event object, prior to its first use.  No
+ * events are posted.
+ *
+ * @param event Address of the event object.
+ */
+__syscall void k_event_init(struct k_event *event);
+
+/**
+ * @brief Post events to an event object.
+ *
+ * This routine ORs @a events into the event object and wakes the
+ * waiting threads whose wait condition the resulting event word
+ * satisfies.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param event Address of the event object.
+ * @param events Set of events to post.
+ */
+__syscall void k_event_post(struct k_event *event, uint32_t events);
+
+/**
+ * @brief Set the events of an event object.
+ *
+ * This routine overwrites the event word of the event object with
+ * @a events and wakes the waiting threads whose wait condition the new
+ * event word satisfies.  Posted events that nobody waited for are
+ * discarded.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param event Address of the event object.
+ * @param events Set of events to replace the current ones with.
+ */
+__syscall void k_event_set(struct k_event *event, uint32_t events);
+
+/**
+ * @brief Wait for events to be posted to an event object.
+ *
+ * This routine blocks until any event of @a events is posted, or all of
+ * them when K_EVENT_WAIT_ALL is given.  If the condition is already
+ * satisfied the routine returns immediately.  With K_EVENT_WAIT_CONSUME
+ * the matching events are cleared from the event object when the waiter
+ * is released, so each consumed event wakes one waiter.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param event Address of the event object.
+ * @param events Set of events to wait for.
+ * @param options K_EVENT_WAIT_ANY or K_EVENT_WAIT_ALL, optionally ORed
+ *                with K_EVENT_WAIT_CONSUME.
+ * @param timeout Waiting period for the events to be posted, or one of
+ *                the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return The matching events, or 0 if the waiting period timed out.
+ */
+__syscall uint32_t k_event_wait(struct k_event *event, uint32_t events,
+				uint32_t options, k_timeout_t timeout);
+
+/** @} */
+
 /**
  * @defgroup msgq_apis Message Queue APIs
  * @ingroup kernel_apis
@@ -3864,6 +4315,10 @@ struct k_msgq {
 	char *write_ptr;
 	/** Number of used messages */
 	uint32_t used_msgs;
+	/** Slots claimed for in-place write, not yet published */
+	uint32_t put_claims;
+	/** Slots claimed for in-place read, not yet released */
+	uint32_t get_claims;
 
 	_OBJECT_TRACING_NEXT_PTR(k_msgq)
 	_OBJECT_TRACING_LINKED_FLAG
@@ -4046,6 +4501,83 @@ __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
  */
 __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
 
+/**
+ * @brief Claim a message slot for in-place writing.
+ *
+ * This routine reserves the next free slot in the message queue's ring
+ * buffer and returns its address, so that the message can be built (or
+ * DMA'd) directly inside the queue without an intermediate copy.  The
+ * message is not visible to readers until k_msgq_put_finish() is
+ * called.  Several slots may be claimed ahead, but they must be
+ * finished in the order they were claimed.
+ *
+ * On queues using the claim/finish API, producers must not block in
+ * k_msgq_put() (i.e. must pass K_NO_WAIT): the queue cannot tell a
+ * blocked producer from a blocked consumer once slots are claimed.
+ * Blocking consumers are fully supported.
+ *
+ * @note Can be called by ISRs.  Not callable from user mode, as it
+ * exposes the queue's internal buffer.
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold the slot pointer.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -ENOMSG No free slot in the ring buffer.
+ */
+int k_msgq_put_claim(struct k_msgq *msgq, void **data);
+
+/**
+ * @brief Publish a message slot claimed with k_msgq_put_claim().
+ *
+ * This routine makes the oldest claimed slot visible to readers and
+ * wakes a waiting reader, if any.  The slot contents must be fully
+ * written before calling this routine.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message published.
+ * @retval -EINVAL No outstanding claimed slot.
+ */
+int k_msgq_put_finish(struct k_msgq *msgq);
+
+/**
+ * @brief Claim the oldest message for in-place reading.
+ *
+ * This routine returns the address of the oldest message inside the
+ * queue's ring buffer without copying it out.  The slot stays owned by
+ * the caller, and is not reused for new messages, until
+ * k_msgq_get_finish() releases it.  Several messages may be claimed
+ * ahead, and must be released in the order they were claimed.
+ *
+ * @note Can be called by ISRs.  Not callable from user mode, as it
+ * exposes the queue's internal buffer.
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold the message pointer.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned when the queue has no message.
+ */
+int k_msgq_get_claim(struct k_msgq *msgq, void **data);
+
+/**
+ * @brief Release a message slot claimed with k_msgq_get_claim().
+ *
+ * This routine recycles the oldest claimed slot, making room for a
+ * new message.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Slot released.
+ * @retval -EINVAL No outstanding claimed message.
+ */
+int k_msgq_get_finish(struct k_msgq *msgq);
+
 /**
  * @brief Purge a message queue.
  *
@@ -4087,7 +4619,8 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	return msgq->max_msgs - msgq->used_msgs - msgq->put_claims -
+	       msgq->get_claims;
 }
 
 /**
@@ -4324,6 +4857,10 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         write_claim_index;  /**< Next write claim position */
+	size_t         write_claim_bytes;  /**< Claimed, unpublished bytes */
+	size_t         read_claim_index;   /**< Next read claim position */
+	size_t         read_claim_bytes;   /**< Claimed, unreleased bytes */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -4509,6 +5046,88 @@ __syscall size_t k_pipe_read_avail(struct k_pipe *pipe);
  */
 __syscall size_t k_pipe_write_avail(struct k_pipe *pipe);
 
+/**
+ * @brief Claim a contiguous region of the pipe buffer for writing.
+ *
+ * This routine reserves up to @a size bytes of free, contiguous pipe
+ * buffer and returns its address, so that data can be produced in
+ * place (e.g. by a DMA transfer) without staging through a caller
+ * buffer.  Because the region never wraps, covering the whole free
+ * space may take two claims; together the claims form a scatter-gather
+ * descriptor list for the transfer.  Claimed bytes become readable
+ * only after k_pipe_write_finish().
+ *
+ * A pipe accessed through the claim API must have a single producer;
+ * concurrent k_pipe_put() calls on the same pipe are not supported
+ * while a write claim is outstanding.
+ *
+ * @note Not callable from user mode, as it exposes the pipe's
+ * internal buffer.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the region pointer.
+ * @param size Number of bytes desired.
+ *
+ * @return Number of bytes claimed, possibly zero.
+ */
+size_t k_pipe_write_claim(struct k_pipe *pipe, void **data, size_t size);
+
+/**
+ * @brief Publish bytes claimed with k_pipe_write_claim().
+ *
+ * This routine makes the first @a size claimed bytes available to
+ * readers and discards the remainder of the outstanding claim.
+ * Blocked readers are fed directly from the buffer, as with
+ * k_pipe_put().
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes actually produced.
+ *
+ * @retval 0 Data published.
+ * @retval -EINVAL @a size exceeds the outstanding claim.
+ */
+int k_pipe_write_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim a contiguous region of pipe data for reading.
+ *
+ * This routine returns the address of up to @a size bytes of
+ * readable, contiguous pipe data so it can be consumed in place or
+ * handed to a DMA channel.  Covering all buffered data may take two
+ * claims when it wraps.  The region is not recycled for writers until
+ * k_pipe_read_finish() releases it.
+ *
+ * A pipe accessed through the claim API must have a single consumer;
+ * concurrent k_pipe_get() calls on the same pipe are not supported
+ * while a read claim is outstanding.
+ *
+ * @note Not callable from user mode, as it exposes the pipe's
+ * internal buffer.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the region pointer.
+ * @param size Number of bytes desired.
+ *
+ * @return Number of bytes claimed, possibly zero.
+ */
+size_t k_pipe_read_claim(struct k_pipe *pipe, void **data, size_t size);
+
+/**
+ * @brief Release bytes claimed with k_pipe_read_claim().
+ *
+ * This routine frees the first @a size claimed bytes for reuse by
+ * writers and discards the remainder of the outstanding claim.
+ * Blocked writers are drained into the freed space, as with
+ * k_pipe_get().
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes actually consumed.
+ *
+ * @retval 0 Space released.
+ * @retval -EINVAL @a size exceeds the outstanding claim.
+ */
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
@@ -4523,10 +5142,46 @@ struct k_mem_slab {
 	char *free_list;
 	uint32_t num_used;
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	/* Per-CPU caches of free blocks, only ever touched by the
+	 * owning CPU.  Cached blocks are accounted as in use.
+	 */
+	struct {
+		char *blocks[CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE];
+		uint32_t count;
+	} cache[CONFIG_MP_NUM_CPUS];
+#endif
+
+#ifdef CONFIG_MEM_SLAB_STATS
+	/* lifetime high-water mark of num_used */
+	uint32_t max_used;
+	/* successful allocations, including handoffs to waiters */
+	uint32_t alloc_count;
+	uint32_t free_count;
+	/* failed allocations (immediate and timed out) */
+	uint32_t fail_count;
+	/* return address of the most recent failed allocation */
+	void *last_fail_caller;
+	/* per-block owner threads, indexed by block number; NULL for
+	 * slabs initialized at runtime, which are not owner-tracked
+	 */
+	struct k_thread **owners;
+#endif
+
 	_OBJECT_TRACING_NEXT_PTR(k_mem_slab)
 	_OBJECT_TRACING_LINKED_FLAG
 };
 
+#ifdef CONFIG_MEM_SLAB_STATS
+#define Z_MEM_SLAB_OWNERS_DEFINE(name, slab_num_blocks) \
+	static struct k_thread *_k_mem_slab_owners_##name[slab_num_blocks];
+#define Z_MEM_SLAB_STATS_INIT(obj) \
+	.owners = _k_mem_slab_owners_##obj,
+#else
+#define Z_MEM_SLAB_OWNERS_DEFINE(name, slab_num_blocks)
+#define Z_MEM_SLAB_STATS_INIT(obj)
+#endif
+
 #define Z_MEM_SLAB_INITIALIZER(obj, slab_buffer, slab_block_size, \
 			       slab_num_blocks) \
 	{ \
@@ -4536,6 +5191,7 @@ struct k_mem_slab {
 	.buffer = slab_buffer, \
 	.free_list = NULL, \
 	.num_used = 0, \
+	Z_MEM_SLAB_STATS_INIT(obj) \
 	_OBJECT_TRACING_INIT \
 	}
 
@@ -4574,6 +5230,7 @@ struct k_mem_slab {
 #define K_MEM_SLAB_DEFINE(name, slab_block_size, slab_num_blocks, slab_align) \
 	char __noinit __aligned(WB_UP(slab_align)) \
 	   _k_mem_slab_buf_##name[(slab_num_blocks) * WB_UP(slab_block_size)]; \
+	Z_MEM_SLAB_OWNERS_DEFINE(name, slab_num_blocks) \
 	Z_STRUCT_SECTION_ITERABLE(k_mem_slab, name) = \
 		Z_MEM_SLAB_INITIALIZER(name, _k_mem_slab_buf_##name, \
 					WB_UP(slab_block_size), slab_num_blocks)
@@ -4667,6 +5324,27 @@ static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 	return slab->num_blocks - slab->num_used;
 }
 
+/**
+ * @brief Get the lifetime maximum number of used blocks in a memory slab.
+ *
+ * This routine gets the highest number of memory blocks that were ever
+ * allocated from @a slab at the same time.  Requires
+ * CONFIG_MEM_SLAB_STATS; returns 0 otherwise.
+ *
+ * @param slab Address of the memory slab.
+ *
+ * @return High-water mark of allocated memory blocks.
+ */
+static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_STATS
+	return slab->max_used;
+#else
+	ARG_UNUSED(slab);
+	return 0;
+#endif
+}
+
 /** @} */
 
 /**
@@ -5181,6 +5859,101 @@ __syscall int k_poll_signal_raise(struct k_poll_signal *signal, int result);
  */
 extern void z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state);
 
+/**
+ * @brief Persistent poll set
+ *
+ * A poll set holds a group of poll events whose registrations on the
+ * polled objects persist across waits, unlike k_poll() which registers
+ * and unregisters the full event array on every call. Events that have
+ * triggered are parked on a ready list and harvested by
+ * k_poll_set_wait(), so the cost of a wait is proportional to the
+ * number of ready events, not to the number of registered ones.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready_events;
+
+	/** PRIVATE - DO NOT TOUCH */
+	struct _poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set A poll set.
+ *
+ * @return N/A
+ */
+extern void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Register a poll event with a poll set.
+ *
+ * The event must have been initialized with k_poll_event_init() and must
+ * not be in use by k_poll() or another poll set. The registration persists
+ * until k_poll_set_unregister() is called: there is no need to re-register
+ * after the event has been reported by k_poll_set_wait().
+ *
+ * If the event condition is already met at registration time, the event is
+ * immediately made ready and the next k_poll_set_wait() will report it.
+ *
+ * This routine is not available from user mode.
+ *
+ * @param set A poll set.
+ * @param event The event to register.
+ *
+ * @retval 0 Event registered.
+ */
+extern int k_poll_set_register(struct k_poll_set *set,
+			       struct k_poll_event *event);
+
+/**
+ * @brief Unregister a poll event from a poll set.
+ *
+ * Removes the event from the poll set, whether it is currently watching
+ * its object or sitting on the ready list.
+ *
+ * @param set A poll set.
+ * @param event The event to unregister.
+ *
+ * @return N/A
+ */
+extern void k_poll_set_unregister(struct k_poll_set *set,
+				  struct k_poll_event *event);
+
+/**
+ * @brief Wait for events registered with a poll set to become ready.
+ *
+ * This routine harvests up to @a num_events ready events from the poll
+ * set, blocking if none is ready yet. Pointers to the ready events are
+ * stored in @a events and the state field of each tells which condition
+ * triggered.
+ *
+ * As with k_poll(), a reported event merely signals that the object was
+ * available: the object itself is not "given" to the caller, and the
+ * condition may have been consumed by another thread by the time the
+ * caller acts on it. The caller should reset the state field of a
+ * handled event to K_POLL_STATE_NOT_READY; events whose condition is
+ * still met when they are harvested are reported again by the next call.
+ *
+ * This routine is not available from user mode.
+ *
+ * @param set A poll set.
+ * @param events Output array receiving pointers to ready events.
+ * @param num_events Capacity of the output array.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval n Number of ready events stored in @a events (n > 0).
+ * @retval -EAGAIN Waiting period timed out.
+ */
+extern int k_poll_set_wait(struct k_poll_set *set,
+			   struct k_poll_event **events, int num_events,
+			   k_timeout_t timeout);
+
 /** @} */
 
 /**
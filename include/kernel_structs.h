@@ -128,6 +128,11 @@ struct _cpu {
 	/* True when _current is allowed to context switch */
 	uint8_t swap_ok;
 #endif
+
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	/* Per CPU run queue */
+	struct _ready_q ready_q;
+#endif
 };
 
 typedef struct _cpu _cpu_t;
@@ -144,6 +149,13 @@ struct z_kernel {
 	int32_t idle; /* Number of ticks for kernel idling */
 #endif
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	/* Bitmask of CPUs that owe a reschedule IPI, flushed by
+	 * z_signal_pending_ipi() once the scheduler lock is dropped.
+	 */
+	atomic_t pending_ipi;
+#endif
+
 	/*
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
@@ -243,8 +255,18 @@ struct k_spinlock {
 	uintptr_t thread_cpu;
 #endif
 
+#ifdef CONFIG_SPIN_PROFILE
+	/* Code address of the site the lock was last taken from, and
+	 * the cycle count at acquisition, used for hold-time
+	 * accounting.  NULL when the lock is not held or the
+	 * acquisition was not profiled.
+	 */
+	void *profile_site;
+	uint32_t profile_start;
+#endif
+
 #if defined(CONFIG_CPLUSPLUS) && !defined(CONFIG_SMP) && \
-	!defined(CONFIG_SPIN_VALIDATE)
+	!defined(CONFIG_SPIN_VALIDATE) && !defined(CONFIG_SPIN_PROFILE)
 	/* If CONFIG_SMP and CONFIG_SPIN_VALIDATE are both not defined
 	 * the k_spinlock struct will have no members. The result
 	 * is that in C sizeof(k_spinlock) is 0 and in C++ it is 1.
@@ -264,10 +286,30 @@ struct k_spinlock {
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_KHEAP_PERCPU_CACHE
+/* Size classes of the k_heap per-CPU caches: class i holds blocks of
+ * K_HEAP_CACHE_MIN_BYTES << i bytes.
+ */
+#define K_HEAP_CACHE_NUM_CLASSES 3
+#define K_HEAP_CACHE_MIN_BYTES 16
+#define K_HEAP_CACHE_MAX_BYTES \
+	(K_HEAP_CACHE_MIN_BYTES << (K_HEAP_CACHE_NUM_CLASSES - 1))
+#endif
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+
+#ifdef CONFIG_KHEAP_PERCPU_CACHE
+	/* Per-CPU size-class bins of small free blocks, linked through
+	 * their own memory and only ever touched by the owning CPU.
+	 */
+	struct {
+		void *head[K_HEAP_CACHE_NUM_CLASSES];
+		uint8_t count[K_HEAP_CACHE_NUM_CLASSES];
+	} cache[CONFIG_MP_NUM_CPUS];
+#endif
 };
 
 #endif /* _ASMLANGUAGE */
@@ -197,6 +197,41 @@ extern "C" {
 #define _LOG_INTERNAL_0(_src_level, _str) \
 	log_0(_str, _src_level)
 
+#if defined(CONFIG_LOG_COMPILE_TIME_SMASK) && !defined(__cplusplus)
+
+/**@brief Compile time classification of a single log argument.
+ *
+ * Resolves to 1 when the argument is a string (char pointer of any
+ * qualification), 0 otherwise. Matching is done on the argument type so
+ * the whole expression folds to a constant and the argument itself is
+ * never evaluated (_Generic does not evaluate its controlling
+ * expression).
+ */
+#define Z_LOG_IS_STR_ARG(_arg) _Generic((_arg), \
+	char * : 1U, \
+	const char * : 1U, \
+	volatile char * : 1U, \
+	const volatile char * : 1U, \
+	default : 0U)
+
+#define _LOG_INTERNAL_1(_src_level, _str, _arg0) \
+	log_sm_1(_str, (log_arg_t)(_arg0), \
+		 Z_LOG_IS_STR_ARG(_arg0), _src_level)
+
+#define _LOG_INTERNAL_2(_src_level, _str, _arg0, _arg1)	\
+	log_sm_2(_str, (log_arg_t)(_arg0), (log_arg_t)(_arg1), \
+		 Z_LOG_IS_STR_ARG(_arg0) | (Z_LOG_IS_STR_ARG(_arg1) << 1), \
+		 _src_level)
+
+#define _LOG_INTERNAL_3(_src_level, _str, _arg0, _arg1, _arg2) \
+	log_sm_3(_str, (log_arg_t)(_arg0), (log_arg_t)(_arg1), \
+		 (log_arg_t)(_arg2), \
+		 Z_LOG_IS_STR_ARG(_arg0) | (Z_LOG_IS_STR_ARG(_arg1) << 1) | \
+		 (Z_LOG_IS_STR_ARG(_arg2) << 2), \
+		 _src_level)
+
+#else /* CONFIG_LOG_COMPILE_TIME_SMASK */
+
 #define _LOG_INTERNAL_1(_src_level, _str, _arg0) \
 	log_1(_str, (log_arg_t)(_arg0), _src_level)
 
@@ -206,6 +241,8 @@ extern "C" {
 #define _LOG_INTERNAL_3(_src_level, _str, _arg0, _arg1, _arg2) \
 	log_3(_str, (log_arg_t)(_arg0), (log_arg_t)(_arg1), (log_arg_t)(_arg2), _src_level)
 
+#endif /* CONFIG_LOG_COMPILE_TIME_SMASK */
+
 #define __LOG_ARG_CAST(_x) (log_arg_t)(_x)
 
 #define __LOG_ARGUMENTS(...) FOR_EACH(__LOG_ARG_CAST, (,), __VA_ARGS__)
@@ -549,6 +586,50 @@ void log_3(const char *str,
 	   log_arg_t arg3,
 	   struct log_msg_ids src_level);
 
+#ifdef CONFIG_LOG_COMPILE_TIME_SMASK
+/** @brief Standard log with one argument and compile time string mask.
+ *
+ * @param str           String.
+ * @param arg1	        First argument.
+ * @param smask		Bitmask marking string arguments.
+ * @param src_level	Log identification.
+ */
+void log_sm_1(const char *str,
+	      log_arg_t arg1,
+	      uint32_t smask,
+	      struct log_msg_ids src_level);
+
+/** @brief Standard log with two arguments and compile time string mask.
+ *
+ * @param str           String.
+ * @param arg1	        First argument.
+ * @param arg2	        Second argument.
+ * @param smask		Bitmask marking string arguments.
+ * @param src_level	Log identification.
+ */
+void log_sm_2(const char *str,
+	      log_arg_t arg1,
+	      log_arg_t arg2,
+	      uint32_t smask,
+	      struct log_msg_ids src_level);
+
+/** @brief Standard log with three arguments and compile time string mask.
+ *
+ * @param str           String.
+ * @param arg1	        First argument.
+ * @param arg2	        Second argument.
+ * @param arg3	        Third argument.
+ * @param smask		Bitmask marking string arguments.
+ * @param src_level	Log identification.
+ */
+void log_sm_3(const char *str,
+	      log_arg_t arg1,
+	      log_arg_t arg2,
+	      log_arg_t arg3,
+	      uint32_t smask,
+	      struct log_msg_ids src_level);
+#endif /* CONFIG_LOG_COMPILE_TIME_SMASK */
+
 /** @brief Standard log with arguments list.
  *
  * @param str		String.
@@ -96,7 +96,12 @@ struct log_msg_generic_hdr {
 /** Part of log message header specific to standard log message. */
 struct log_msg_std_hdr {
 	COMMON_PARAM_HDR();
+#ifdef CONFIG_LOG_COMPILE_TIME_SMASK
+	uint16_t smask_valid : 1;
+	uint16_t smask       : 9;
+#else
 	uint16_t reserved : 10;
+#endif
 	uint16_t nargs    : 4;
 };
 
@@ -237,6 +242,46 @@ static inline bool log_msg_is_std(struct log_msg *msg)
 	return  (msg->hdr.params.generic.type == LOG_MSG_TYPE_STD);
 }
 
+#ifdef CONFIG_LOG_COMPILE_TIME_SMASK
+/** @brief Store string argument mask computed at compile time.
+ *
+ * @param msg	Standard log message.
+ * @param smask	Bitmask with a bit set for every string argument.
+ */
+static inline void log_msg_smask_set(struct log_msg *msg, uint32_t smask)
+{
+	msg->hdr.params.std.smask = smask;
+	msg->hdr.params.std.smask_valid = 1U;
+}
+#endif
+
+/** @brief Get string argument mask stored in a standard log message.
+ *
+ * Mask is present only when the call site classified its arguments at
+ * compile time. Messages created through the generic paths (e.g.
+ * log_generic() or more than three arguments) carry no mask and must
+ * fall back to scanning the format string at processing time.
+ *
+ * @param msg	Standard log message.
+ * @param smask	Location where mask is stored.
+ *
+ * @retval true  Mask was stored in the message.
+ * @retval false Mask is not available.
+ */
+static inline bool log_msg_smask_get(struct log_msg *msg, uint32_t *smask)
+{
+#ifdef CONFIG_LOG_COMPILE_TIME_SMASK
+	if (msg->hdr.params.std.smask_valid) {
+		*smask = msg->hdr.params.std.smask;
+		return true;
+	}
+#else
+	ARG_UNUSED(msg);
+	ARG_UNUSED(smask);
+#endif
+	return false;
+}
+
 /** @brief Returns number of arguments in standard log message.
  *
  * @param msg Standard log message.
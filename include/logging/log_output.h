@@ -50,6 +50,12 @@ extern "C" {
  */
 #define LOG_OUTPUT_FLAG_FORMAT_SYST		BIT(7)
 
+/** @brief Flag forcing dictionary mode binary output, where messages
+ *	   are emitted as format string IDs with raw arguments and
+ *	   decoded offline (see CONFIG_LOG_DICTIONARY).
+ */
+#define LOG_OUTPUT_FLAG_FORMAT_DICT		BIT(8)
+
 /**
  * @brief Prototype of the function processing output data.
  *
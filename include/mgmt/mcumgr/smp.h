@@ -29,6 +29,27 @@ struct net_buf;
 typedef int zephyr_smp_transport_out_fn(struct zephyr_smp_transport *zst,
 					struct net_buf *nb);
 
+/** @typedef zephyr_smp_transport_out_frag_fn
+ * @brief SMP fragment transmit function for Zephyr.
+ *
+ * Transmits the first @p len bytes of the supplied net_buf synchronously
+ * and does not consume the buffer.  Transports whose output path copies
+ * the data onwards on its own (e.g. a GATT notification or a datagram
+ * send) can provide this function so that responses larger than the MTU
+ * are transmitted as slices of the response buffer, instead of each
+ * fragment being copied into a newly allocated buffer first.
+ *
+ * @param zst                   The transport to send via.
+ * @param nb                    The net_buf holding the remaining response.
+ * @param len                   Number of bytes to transmit from the front
+ *                                  of the net_buf.
+ *
+ * @return                      0 on success, MGMT_ERR_[...] code on failure.
+ */
+typedef int zephyr_smp_transport_out_frag_fn(struct zephyr_smp_transport *zst,
+					     struct net_buf *nb,
+					     uint16_t len);
+
 /** @typedef zephyr_smp_transport_get_mtu_fn
  * @brief SMP MTU query function for Zephyr.
  *
@@ -82,6 +103,7 @@ struct zephyr_smp_transport {
 	struct k_fifo zst_fifo;
 
 	zephyr_smp_transport_out_fn *zst_output;
+	zephyr_smp_transport_out_frag_fn *zst_output_frag;
 	zephyr_smp_transport_get_mtu_fn *zst_get_mtu;
 	zephyr_smp_transport_ud_copy_fn *zst_ud_copy;
 	zephyr_smp_transport_ud_free_fn *zst_ud_free;
@@ -104,6 +126,20 @@ void zephyr_smp_transport_init(struct zephyr_smp_transport *zst,
 			       zephyr_smp_transport_ud_copy_fn *ud_copy_func,
 			       zephyr_smp_transport_ud_free_fn *ud_free_func);
 
+/**
+ * @brief Sets the fragment transmit function of a transport.
+ *
+ * Optional; when set, responses exceeding the transport MTU are sent
+ * directly out of the response buffer instead of being copied into
+ * per-fragment buffers.
+ *
+ * @param zst                   The transport to modify.
+ * @param output_frag_func      The transport's fragment send function.
+ */
+void zephyr_smp_transport_set_output_frag(
+	struct zephyr_smp_transport *zst,
+	zephyr_smp_transport_out_frag_fn *output_frag_func);
+
 /**
  * @brief Enqueues an incoming SMP request packet for processing.
  *
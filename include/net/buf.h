@@ -820,6 +820,9 @@ struct net_buf_pool {
 	/** Amount of available buffers in the pool. */
 	int16_t avail_count;
 
+	/** Highest number of buffers ever in use at the same time. */
+	int16_t max_used;
+
 	/** Total size of the pool. */
 	const uint16_t pool_size;
 
@@ -243,6 +243,7 @@ struct coap_pending {
 	uint16_t id;
 	uint8_t *data;
 	uint16_t len;
+	uint8_t retries;
 };
 
 /**
@@ -607,6 +608,22 @@ int coap_update_from_block(const struct coap_packet *cpkt,
 size_t coap_next_block(const struct coap_packet *cpkt,
 		       struct coap_block_context *ctx);
 
+/**
+ * @brief Advances @a ctx to the next block without waiting for a
+ * response.
+ *
+ * This can be used to issue several block-wise requests back to back
+ * (NSTART > 1) instead of requesting one block per round trip: copy
+ * the base context, advance the copy for every request in flight and
+ * append the block option from it.
+ *
+ * @param ctx Block context to be updated
+ *
+ * @return The offset in the block-wise transfer, 0 if the last block
+ * has already been reached.
+ */
+size_t coap_block_advance(struct coap_block_context *ctx);
+
 /**
  * @brief Indicates that the remote device referenced by @a addr, with
  * @a request, wants to observe a resource.
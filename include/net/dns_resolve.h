@@ -330,6 +330,68 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 		     void *user_data,
 		     int32_t timeout);
 
+/**
+ * @brief Resolve DNS name, bypassing the response cache.
+ *
+ * @details This is the same as dns_resolve_name() except that the
+ * response cache is not consulted, so a query is always sent to the
+ * DNS server. Use this when a cached answer is not acceptable, e.g.,
+ * after a connection to the previously resolved address has failed.
+ * The received answer still refreshes the cache. If the cache is
+ * disabled, this behaves exactly like dns_resolve_name().
+ *
+ * @param ctx DNS context
+ * @param query What the caller wants to resolve.
+ * @param type What kind of data the caller wants to get.
+ * @param dns_id DNS id is returned to the caller. This is needed if one
+ * wishes to cancel the query. This can be set to NULL if there is no need
+ * to cancel the query.
+ * @param cb Callback to call after the resolving has finished or timeout
+ * has happened.
+ * @param user_data The user data.
+ * @param timeout The timeout value for the query. Possible values:
+ * SYS_FOREVER_MS: the query is tried forever, user needs to cancel it
+ *            manually if it takes too long time to finish
+ * >0: start the query and let the system timeout it after specified ms
+ *
+ * @return 0 if resolving was started ok, < 0 otherwise
+ */
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+int dns_resolve_name_nocache(struct dns_resolve_context *ctx,
+			     const char *query,
+			     enum dns_query_type type,
+			     uint16_t *dns_id,
+			     dns_resolve_cb_t cb,
+			     void *user_data,
+			     int32_t timeout);
+#else
+static inline int dns_resolve_name_nocache(struct dns_resolve_context *ctx,
+					   const char *query,
+					   enum dns_query_type type,
+					   uint16_t *dns_id,
+					   dns_resolve_cb_t cb,
+					   void *user_data,
+					   int32_t timeout)
+{
+	return dns_resolve_name(ctx, query, type, dns_id, cb, user_data,
+				timeout);
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
+/**
+ * @brief Remove all entries from the DNS response cache.
+ *
+ * @details This can be used e.g., when the network attachment changes
+ * and previously resolved addresses might no longer be reachable.
+ */
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+void dns_resolve_cache_flush(void);
+#else
+static inline void dns_resolve_cache_flush(void)
+{
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 /**
  * @brief Get default DNS context.
  *
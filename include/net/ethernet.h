@@ -267,6 +267,16 @@ struct ethernet_api {
 
 	/** Send a network packet */
 	int (*send)(const struct device *dev, struct net_pkt *pkt);
+
+#if defined(CONFIG_NET_TX_BATCH)
+	/** Send a burst of network packets in one call. Optional; if set,
+	 * the driver can chain the DMA descriptors of the whole burst and
+	 * ring the Tx doorbell only once per burst. Either all packets are
+	 * accepted (return 0) or none are (return a negative errno).
+	 */
+	int (*send_batch)(const struct device *dev, struct net_pkt **pkts,
+			  int count);
+#endif
 };
 
 /* Make sure that the network interface API is properly setup inside
@@ -675,6 +685,57 @@ void net_eth_carrier_off(struct net_if *iface);
  */
 int net_eth_promisc_mode(struct net_if *iface, bool enable);
 
+#if defined(CONFIG_NET_L2_ETHERNET_RX_ZEROCOPY)
+/**
+ * @brief Hand a driver owned, already filled RX buffer to the IP stack.
+ *
+ * This is the receive half of the zero-copy RX buffer loaning scheme.
+ * The driver defines a buffer pool with NET_BUF_POOL_FIXED_DEFINE(),
+ * sized so that a full frame fits in one buffer, claims buffers from
+ * it with net_buf_alloc() and programs their data pointers straight
+ * into the RX DMA descriptors. When the hardware has filled a buffer,
+ * the driver calls this function instead of copying the frame into
+ * separately allocated fragments, and the stack consumes the DMA
+ * memory in place. The buffer returns to the pool when the packet is
+ * processed; a destroy callback given to NET_BUF_POOL_FIXED_DEFINE()
+ * can be used to trigger descriptor replenishment at that point.
+ *
+ * Ownership of the buffer is transferred in all cases: on error the
+ * buffer is unreferenced and thus returned to its pool.
+ *
+ * On cores where the driver manages data cache coherency manually,
+ * the buffer size should be a multiple of the cache line size and the
+ * driver must invalidate the buffer range before calling this.
+ *
+ * @param iface Network interface the frame was received on
+ * @param buf Buffer holding the received frame, data pointer at the
+ * start of the ethernet header
+ * @param len Length of the received frame in bytes
+ *
+ * @return 0 if the packet was accepted by the stack, <0 otherwise.
+ */
+int net_eth_recv_buf(struct net_if *iface, struct net_buf *buf, size_t len);
+#endif /* CONFIG_NET_L2_ETHERNET_RX_ZEROCOPY */
+
+#if defined(CONFIG_NET_TX_BATCH)
+/**
+ * @brief Send a burst of network packets through the ethernet driver.
+ *
+ * Each packet gets its L2 header filled as in the normal send path and
+ * the whole burst is then handed to the driver with one send_batch()
+ * call. Ownership of all packets is transferred: they are unreferenced
+ * whether the burst is sent or not.
+ *
+ * @param iface Network interface
+ * @param pkts Array of packets to send
+ * @param count Number of packets in the array
+ *
+ * @return Total number of bytes sent, or a negative errno if the burst
+ * was rejected by the driver.
+ */
+int net_eth_tx_batch(struct net_if *iface, struct net_pkt **pkts, int count);
+#endif /* CONFIG_NET_TX_BATCH */
+
 /**
  * @brief Return PTP clock that is tied to this ethernet network interface.
  *
@@ -109,6 +109,16 @@ struct http_response {
 	/** Where the body starts */
 	uint8_t *body_start;
 
+	/** Where the body fragment that is passed to the current
+	 * response callback invocation starts in recv_buf. Unlike
+	 * data_len, this only covers the body bytes so the callback
+	 * can process them in place without copying.
+	 */
+	uint8_t *body_frag_start;
+
+	/** Length of the body fragment */
+	size_t body_frag_len;
+
 	/** Where the response is stored, this is to be
 	 * provided by the user.
 	 */
@@ -149,6 +159,12 @@ struct http_response {
 	uint8_t cl_present : 1;
 	uint8_t body_found : 1;
 	uint8_t message_complete : 1;
+
+	/** Set when the server will keep the connection open after
+	 * this response, so the same socket can be reused for the
+	 * next request without a new TCP (and TLS) handshake.
+	 */
+	uint8_t keep_alive : 1;
 };
 
 /** HTTP client internal data that the application should not touch
@@ -285,6 +301,31 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+/**
+ * @brief Do several HTTP requests over one connection. All the requests
+ * are sent back to back before any of the responses is read, which
+ * avoids a round trip per request compared to calling http_client_req()
+ * in a loop. The responses are parsed in request order and delivered
+ * through each request's own callbacks. The server must keep the
+ * connection alive for the whole exchange; if it closes the connection
+ * early, the requests after that point need to be sent again on a new
+ * connection. All the requests must use the same recv_buf as a received
+ * data chunk can contain the end of one response and the start of the
+ * next one.
+ *
+ * @param sock Socket id of the connection.
+ * @param reqs Array of HTTP request information pointers
+ * @param num_reqs Number of requests in the array
+ * @param timeout Max timeout to wait for the data of one response.
+ *        The timeout value cannot be 0 as there would be no time to
+ *        receive the data. The timeout value is in milliseconds.
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pipeline(int sock, struct http_request **reqs, size_t num_reqs,
+			 int32_t timeout, void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,7 +38,9 @@ struct ieee802154_security_ctx {
 	uint8_t key_len;
 	uint8_t level	: 3;
 	uint8_t key_mode	: 2;
-	uint8_t _unused	: 3;
+	/** Outgoing frames are secured by the radio itself */
+	uint8_t radio_offload	: 1;
+	uint8_t _unused	: 2;
 };
 
 /* This not meant to be used by any code but 802.15.4 L2 stack */
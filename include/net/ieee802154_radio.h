@@ -37,6 +37,9 @@ enum ieee802154_hw_caps {
 	IEEE802154_HW_ENERGY_SCAN = BIT(7), /* Energy scan supported */
 	IEEE802154_HW_TXTIME	  = BIT(8), /* TX at specified time supported */
 	IEEE802154_HW_SLEEP_TO_TX = BIT(9), /* TX directly from sleep supported */
+	IEEE802154_HW_TX_SECURITY = BIT(10), /* Secures outgoing frames (CCM*)
+					      * in the radio itself
+					      */
 };
 
 enum ieee802154_filter_type {
@@ -124,7 +127,13 @@ enum ieee802154_config_type {
 	/** Specifies new radio event handler. Specifying NULL as a handler
 	 *  will disable radio events notification.
 	 */
-	IEEE802154_CONFIG_EVENT_HANDLER
+	IEEE802154_CONFIG_EVENT_HANDLER,
+
+	/** Configures the link-layer key, security level and frame counter
+	 *  for radios that secure outgoing frames themselves
+	 *  (``IEEE802154_HW_TX_SECURITY`` capability).
+	 */
+	IEEE802154_CONFIG_FRAME_SECURITY
 };
 
 /** IEEE802.15.4 driver configuration data. */
@@ -152,6 +161,15 @@ struct ieee802154_config {
 
 		/** ``IEEE802154_CONFIG_EVENT_HANDLER`` */
 		ieee802154_event_cb_t event_handler;
+
+		/** ``IEEE802154_CONFIG_FRAME_SECURITY`` */
+		struct {
+			uint8_t *key;
+			uint8_t key_len;
+			uint8_t key_mode;
+			uint8_t level;
+			uint32_t frame_counter;
+		} frame_security;
 	};
 };
 
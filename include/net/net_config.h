@@ -79,6 +79,26 @@ int net_config_init(const char *app_info, uint32_t flags, int32_t timeout);
 int net_config_init_by_iface(struct net_if *iface, const char *app_info,
 			     uint32_t flags, int32_t timeout);
 
+/**
+ * @brief Initialize this network application using all the network
+ * interfaces.
+ *
+ * @details Unlike net_config_init_by_iface(), every network interface
+ *          is configured concurrently as soon as it comes up, instead
+ *          of waiting for one interface at a time. The function
+ *          returns once the services given in the flags are available
+ *          on any of the interfaces, or when the timeout expires.
+ *
+ * @param app_info String describing this application.
+ * @param flags Flags related to services needed by the client.
+ * @param timeout How long to wait the network setup before continuing
+ * the startup.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int net_config_init_all(const char *app_info, uint32_t flags,
+			int32_t timeout);
+
 /**
  * @brief Initialize this network application.
  *
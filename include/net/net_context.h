@@ -188,6 +188,42 @@ struct net_tcp;
 
 struct net_conn_handle;
 
+#if defined(CONFIG_NET_RAW_FILTER)
+#define NET_RAW_FILTER_MAX_RULES CONFIG_NET_RAW_FILTER_MAX_RULES
+#else
+#define NET_RAW_FILTER_MAX_RULES 1
+#endif
+
+/**
+ * One rule of a raw frame filter. The rule matches if the received
+ * frame byte at the given offset, ANDed with the mask, equals the
+ * value. A frame shorter than offset + 1 bytes never matches.
+ */
+struct net_raw_filter_rule {
+	/** Byte offset from the start of the frame */
+	uint16_t offset;
+
+	/** Mask to apply to the frame byte */
+	uint8_t mask;
+
+	/** Value to compare the masked byte against */
+	uint8_t value;
+};
+
+/**
+ * Filter program for received raw frames, set for a packet socket
+ * with the NET_OPT_RAW_FILTER option. The frame is delivered only if
+ * all the rules match, so the rules form one AND expression. A filter
+ * with zero rules accepts every frame.
+ */
+struct net_raw_filter {
+	/** Number of rules in the filter */
+	uint8_t count;
+
+	/** The filter rules */
+	struct net_raw_filter_rule rules[NET_RAW_FILTER_MAX_RULES];
+};
+
 /**
  * Note that we do not store the actual source IP address in the context
  * because the address is already be set in the network interface struct.
@@ -275,6 +311,12 @@ __net_socket struct net_context {
 		struct k_fifo accept_q;
 	};
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	/** The epoll registration of this socket, NULL if the socket
+	 * is not registered to any epoll instance.
+	 */
+	void *epoll_item;
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
 #endif /* CONFIG_NET_SOCKETS */
 
 #if defined(CONFIG_NET_OFFLOAD)
@@ -298,11 +340,19 @@ __net_socket struct net_context {
 #if defined(CONFIG_NET_CONTEXT_TXTIME)
 		bool txtime;
 #endif
+#if defined(CONFIG_NET_CONTEXT_REUSEPORT)
+		/** Allow binding multiple sockets to the same local port */
+		bool reuseport;
+#endif
 #if defined(CONFIG_SOCKS)
 		struct {
 			struct sockaddr addr;
 			socklen_t addrlen;
 		} proxy;
+#endif
+#if defined(CONFIG_NET_RAW_FILTER)
+		/** Receive filter for AF_PACKET sockets */
+		struct net_raw_filter raw_filter;
 #endif
 	} options;
 
@@ -974,6 +1024,106 @@ int net_context_sendmsg(struct net_context *context,
 			k_timeout_t timeout,
 			void *user_data);
 
+/**
+ * @typedef net_context_fill_cb_t
+ * @brief Callback used by net_context_sendfill() to produce the data
+ *        to send directly into the packet buffer.
+ *
+ * @param dst Where to write the data.
+ * @param length Amount of data to produce.
+ * @param offset Offset of this chunk from the start of the send call.
+ * @param user_data The user data given to net_context_sendfill().
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+typedef int (*net_context_fill_cb_t)(void *dst, size_t length, size_t offset,
+				     void *user_data);
+
+/**
+ * @brief Send data produced by a fill callback to a connected peer.
+ *
+ * @details This works like net_context_send() except that the payload
+ * is written by the given callback directly into the TX packet buffer,
+ * fragment by fragment. This avoids the intermediate application
+ * buffer when streaming data from a slow or indirect source such as
+ * external flash. The amount of data sent may be less than len if it
+ * does not fit into one packet; the return value tells how much was
+ * consumed.
+ *
+ * @param context The network context to use.
+ * @param fill_cb Callback producing the data to send.
+ * @param fill_data User data given to the fill callback.
+ * @param len Length of the data to send.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Currently this value is not used.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise
+ */
+int net_context_sendfill(struct net_context *context,
+			 net_context_fill_cb_t fill_cb,
+			 void *fill_data,
+			 size_t len,
+			 net_context_send_cb_t cb,
+			 k_timeout_t timeout,
+			 void *user_data);
+
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+/**
+ * @brief Send data to a connected peer without copying it.
+ *
+ * @details Same as net_context_send() but the caller's buffer is
+ * pinned into the TX packet as an external data fragment instead of
+ * being copied. The call blocks until the network stack has released
+ * the buffer, so the buffer can be reused safely once this returns.
+ * Only datagram contexts (UDP, packet and CAN sockets) are supported.
+ *
+ * @param context The network context to use.
+ * @param buf The data buffer to send
+ * @param len Length of the buffer
+ * @param cb Caller-supplied callback function.
+ * @param timeout Currently this value is not used.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return 0 if ok, < 0 if error
+ */
+int net_context_send_zerocopy(struct net_context *context,
+			      const void *buf,
+			      size_t len,
+			      net_context_send_cb_t cb,
+			      k_timeout_t timeout,
+			      void *user_data);
+
+/**
+ * @brief Send data to a peer specified by address without copying it.
+ *
+ * @details Same as net_context_sendto() but the caller's buffer is
+ * pinned into the TX packet as an external data fragment instead of
+ * being copied. The call blocks until the network stack has released
+ * the buffer, so the buffer can be reused safely once this returns.
+ * Only datagram contexts (UDP, packet and CAN sockets) are supported.
+ *
+ * @param context The network context to use.
+ * @param buf The data buffer to send
+ * @param len Length of the buffer
+ * @param dst_addr Destination address.
+ * @param addrlen Length of the address.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Currently this value is not used.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise
+ */
+int net_context_sendto_zerocopy(struct net_context *context,
+				const void *buf,
+				size_t len,
+				const struct sockaddr *dst_addr,
+				socklen_t addrlen,
+				net_context_send_cb_t cb,
+				k_timeout_t timeout,
+				void *user_data);
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 /**
  * @brief Receive network data from a peer specified by context.
  *
@@ -1043,6 +1193,8 @@ enum net_context_option {
 	NET_OPT_TIMESTAMP	= 2,
 	NET_OPT_TXTIME		= 3,
 	NET_OPT_SOCKS5		= 4,
+	NET_OPT_RAW_FILTER	= 5,
+	NET_OPT_REUSEPORT	= 6,
 };
 
 /**
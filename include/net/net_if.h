@@ -397,6 +397,8 @@ struct net_traffic_class {
 	int tc;
 };
 
+struct net_buf_pool;
+
 /**
  * @brief Network Interface Device structure
  *
@@ -438,6 +440,14 @@ struct net_if_dev {
 	/** The hardware MTU */
 	uint16_t mtu;
 
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+	/** Functions returning the data buffer pools used for packets
+	 * on this interface, see net_if_set_pkt_data_pools()
+	 */
+	struct net_buf_pool *(*data_pool)(void);
+	struct net_buf_pool *(*data_pool_small)(void);
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_OFFLOAD)
 	/** Indicate whether interface is offloaded at socket level. */
 	bool offloaded;
@@ -764,6 +774,34 @@ static inline void net_if_set_mtu(struct net_if *iface,
 	iface->if_dev->mtu = mtu;
 }
 
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+/**
+ * @brief Set interface specific data buffer pools
+ *
+ * Packet data for this interface is then allocated from the given
+ * pools instead of the global data pools.  Both pools must be defined
+ * with NET_BUF_POOL_FIXED_DEFINE().  The main pool is typically sized
+ * so that a full interface MTU frame fits in a single buffer, making
+ * packets a single contiguous fragment.  The optional small pool
+ * serves allocations that fit its buffer size (TCP ACKs and other
+ * short control traffic) so they do not consume the full size
+ * buffers.  Either function may be NULL, in which case the global
+ * pools are used for that case.
+ *
+ * @param iface Pointer to a network interface structure
+ * @param data_pool Function returning the full size buffer pool
+ * @param data_pool_small Function returning the small buffer pool
+ */
+static inline void net_if_set_pkt_data_pools(
+	struct net_if *iface,
+	struct net_buf_pool *(*data_pool)(void),
+	struct net_buf_pool *(*data_pool_small)(void))
+{
+	iface->if_dev->data_pool = data_pool;
+	iface->if_dev->data_pool_small = data_pool_small;
+}
+#endif /* CONFIG_NET_IFACE_NET_PKT_POOL */
+
 /**
  * @brief Set the infinite status of the network interface address
  *
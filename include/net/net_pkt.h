@@ -1795,6 +1795,41 @@ int net_pkt_read_be32(struct net_pkt *pkt, uint32_t *data);
  */
 int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length);
 
+/**
+ * @typedef net_pkt_fill_cb_t
+ * @brief Callback used by net_pkt_write_cb() to produce packet data
+ *        in place.
+ *
+ * @param dst    Where to write the data, inside the packet buffer
+ * @param length Amount of data to produce
+ * @param offset Offset of this chunk from the start of the operation
+ * @param cb_arg A valid pointer given to net_pkt_write_cb()
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+typedef int (*net_pkt_fill_cb_t)(void *dst, size_t length, size_t offset,
+				 void *cb_arg);
+
+/**
+ * @brief Write data into a net_pkt through a fill callback
+ *
+ * @details Same as net_pkt_write() but the data is produced by the
+ *          given callback directly into the packet buffer, fragment
+ *          by fragment, so no intermediate linear buffer is needed.
+ *          net_pkt's cursor should be properly initialized and,
+ *          if needed, positioned using net_pkt_skip.
+ *          Cursor position will be updated after the operation.
+ *
+ * @param pkt    The network packet where to write
+ * @param cb     Callback producing the data
+ * @param cb_arg A valid pointer which will be given to the callback
+ * @param length Length of the data to be written
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+int net_pkt_write_cb(struct net_pkt *pkt, net_pkt_fill_cb_t cb,
+		     void *cb_arg, size_t length);
+
 /* Write uint8_t data into a net_pkt. */
 static inline int net_pkt_write_u8(struct net_pkt *pkt, uint8_t data)
 {
@@ -1893,6 +1928,24 @@ uint16_t net_pkt_get_current_offset(struct net_pkt *pkt);
  */
 bool net_pkt_is_contiguous(struct net_pkt *pkt, size_t size);
 
+/**
+ * @brief Get a direct pointer to contiguous data at the cursor
+ *
+ * @details net_pkt's cursor should be properly initialized and,
+ *          if needed, positioned using net_pkt_skip. The cursor is
+ *          not advanced, so the pointer can be used together with
+ *          net_pkt_skip when the data has been handled. This avoids
+ *          copying via net_pkt_read for parsers doing many small
+ *          accesses to data that lives in one fragment.
+ *
+ * @param pkt  Network packet.
+ * @param size Amount of data that must be contiguous
+ *
+ * @return Pointer to the data, NULL if the data continues in the next
+ *         fragment or the packet is too short.
+ */
+void *net_pkt_get_contiguous(struct net_pkt *pkt, size_t size);
+
 struct net_pkt_data_access {
 #if !defined(CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS)
 	void *data;
@@ -82,6 +82,33 @@ static inline int net_promisc_mode_off(struct net_if *iface)
 }
 #endif /* CONFIG_NET_PROMISCUOUS_MODE */
 
+struct net_raw_filter;
+
+/**
+ * @brief Set a receive filter for the promiscuous mode packets.
+ *
+ * @details Only the frames that match the given filter program are
+ * queued for net_promisc_mode_wait_data(). The rest are dropped
+ * already in the RX path, before they are cloned. See struct
+ * net_raw_filter in net/net_context.h for the program format.
+ *
+ * @param filter Filter to use, NULL to remove the current filter.
+ * The filter is copied so it can live e.g. in stack.
+ *
+ * @return 0 if ok, <0 if error
+ */
+#if defined(CONFIG_NET_PROMISCUOUS_MODE) && defined(CONFIG_NET_RAW_FILTER)
+int net_promisc_mode_set_filter(const struct net_raw_filter *filter);
+#else
+static inline int net_promisc_mode_set_filter(
+	const struct net_raw_filter *filter)
+{
+	ARG_UNUSED(filter);
+
+	return -ENOTSUP;
+}
+#endif /* CONFIG_NET_PROMISCUOUS_MODE && CONFIG_NET_RAW_FILTER */
+
 #ifdef __cplusplus
 }
 #endif
@@ -56,6 +56,12 @@ struct zsock_pollfd {
 #define ZSOCK_MSG_PEEK 0x02
 /** zsock_recv/zsock_send: Override operation to non-blocking */
 #define ZSOCK_MSG_DONTWAIT 0x40
+/** zsock_send: Pin the caller's buffer into the TX packet instead of
+ *  copying it. The call returns once the stack has released the buffer.
+ *  Only supported for datagram sockets and only if
+ *  CONFIG_NET_CONTEXT_ZEROCOPY is enabled. Value compatible with Linux.
+ */
+#define ZSOCK_MSG_ZEROCOPY 0x4000000
 
 /* Well-known values, e.g. from Linux man 2 shutdown:
  * "The constants SHUT_RD, SHUT_WR, SHUT_RDWR have the value 0, 1, 2,
@@ -385,6 +391,39 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+/** @brief One message of a zsock_recvmmsg() batch */
+struct zsock_mmsghdr {
+	struct msghdr msg_hdr;  /**< Message header for this datagram */
+	unsigned int msg_len;   /**< Number of bytes received */
+};
+
+/**
+ * @brief Receive multiple datagrams with a single call
+ *
+ * @details
+ * @rst
+ * Drains up to ``vlen`` already queued datagrams from the socket in
+ * one go instead of waking up the application once per packet. Only
+ * the first datagram may block (subject to ``ZSOCK_MSG_DONTWAIT`` and
+ * the socket blocking mode), the remaining slots are filled from
+ * whatever is queued at that point. Only native (non offloaded,
+ * non TLS) datagram sockets are supported.
+ * This function is also exposed as ``recvmmsg()``
+ * if :option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ *
+ * @param sock Socket to receive from
+ * @param msgvec Array of message headers, one per datagram. The
+ *        ``msg_len`` field of each filled entry is set to the number
+ *        of bytes received for that datagram.
+ * @param vlen Number of entries in msgvec
+ * @param flags Flags to apply to the receive, see zsock_recvfrom()
+ *
+ * @return Number of datagrams received, or -1 with errno set on error.
+ */
+int zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgvec, unsigned int vlen,
+		   int flags);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -415,6 +454,128 @@ __syscall int zsock_fcntl(int sock, int cmd, int flags);
  */
 __syscall int zsock_poll(struct zsock_pollfd *fds, int nfds, int timeout);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+
+/** zsock_epoll_ctl: Register a socket with an epoll instance */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** zsock_epoll_ctl: Update the registration of a socket */
+#define ZSOCK_EPOLL_CTL_MOD 2
+/** zsock_epoll_ctl: Remove a socket from an epoll instance */
+#define ZSOCK_EPOLL_CTL_DEL 3
+
+/**
+ * @brief Event description used by the zsock_epoll API
+ */
+struct zsock_epoll_event {
+	/** Requested events (input), or returned events (output) */
+	uint32_t events;
+	/** Opaque user data returned verbatim by zsock_epoll_wait() */
+	void *data;
+};
+
+/**
+ * @brief Create an epoll instance
+ *
+ * @details
+ * @rst
+ * Creates a readiness notification object to which sockets can be
+ * registered once with :c:func:`zsock_epoll_ctl`. Unlike
+ * :c:func:`zsock_poll`, which scans all polled sockets on every call,
+ * a registered socket queues itself when it becomes readable, so the
+ * cost of :c:func:`zsock_epoll_wait` scales with the number of ready
+ * sockets rather than the number of registered ones.
+ * @endrst
+ *
+ * @return Epoll instance identifier, or negative errno code on error.
+ */
+int zsock_epoll_create(void);
+
+/**
+ * @brief Add, modify or remove a socket registration
+ *
+ * @details
+ * @rst
+ * Only ``ZSOCK_POLLIN`` can be requested; Zephyr sockets are considered
+ * always writable by :c:func:`zsock_poll` so ``ZSOCK_POLLOUT``
+ * registrations are rejected with ``-ENOTSUP``. Only native (non
+ * offloaded, non TLS) sockets can be registered.
+ * @endrst
+ *
+ * @param ep Epoll instance returned by zsock_epoll_create()
+ * @param op One of ZSOCK_EPOLL_CTL_ADD, ZSOCK_EPOLL_CTL_MOD,
+ *           ZSOCK_EPOLL_CTL_DEL
+ * @param sock Socket to operate on
+ * @param event Requested events and user data (ignored for DEL)
+ *
+ * @return 0 on success, negative errno code on error.
+ */
+int zsock_epoll_ctl(int ep, int op, int sock,
+		    struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for registered sockets to become ready
+ *
+ * @details
+ * @rst
+ * Returns events for up to ``maxevents`` ready sockets. Readiness is
+ * level triggered: a socket that still has queued data after its event
+ * has been reported is reported again by the next call.
+ * @endrst
+ *
+ * @param ep Epoll instance returned by zsock_epoll_create()
+ * @param events Array to store the returned events in
+ * @param maxevents Size of the events array
+ * @param timeout Timeout in milliseconds, or a negative value to wait
+ *                forever
+ *
+ * @return Number of ready sockets (0 on timeout), or negative errno
+ *         code on error.
+ */
+int zsock_epoll_wait(int ep, struct zsock_epoll_event *events,
+		     int maxevents, int timeout);
+
+/**
+ * @brief Close an epoll instance
+ *
+ * @details
+ * @rst
+ * Removes all registered sockets and releases the instance. The
+ * sockets themselves are left open.
+ * @endrst
+ *
+ * @param ep Epoll instance returned by zsock_epoll_create()
+ *
+ * @return 0 on success, negative errno code on error.
+ */
+int zsock_epoll_close(int ep);
+
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
+#if defined(CONFIG_NET_SOCKETS_SENDFILE)
+/**
+ * @brief Send data from a flash area over a socket
+ *
+ * @details
+ * @rst
+ * Streams ``count`` bytes starting at ``offset`` of the flash area
+ * identified by ``area_id`` (see :ref:`flash_map_api`) over the given
+ * socket. The data is read by the network stack directly into the TX
+ * packet buffers, so no intermediate application buffer is needed.
+ * Only native (non offloaded, non TLS) sockets are supported.
+ * @endrst
+ *
+ * @param sock Socket to send on
+ * @param area_id Flash area ID, e.g. FLASH_AREA_ID(image_1)
+ * @param offset Offset inside the flash area to start from
+ * @param count Number of bytes to send
+ *
+ * @return Number of bytes sent, or -1 with errno set on error. Like
+ *         with send(), less than count bytes may be sent on a
+ *         non-blocking socket.
+ */
+ssize_t zsock_sendfile(int sock, uint8_t area_id, off_t offset, size_t count);
+#endif /* CONFIG_NET_SOCKETS_SENDFILE */
+
 /**
  * @brief Get various socket options
  *
@@ -691,6 +852,14 @@ static inline ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags,
 	return zsock_recvfrom(sock, buf, max_len, flags, src_addr, addrlen);
 }
 
+#define mmsghdr zsock_mmsghdr
+
+static inline int recvmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_recvmmsg(sock, msgvec, vlen, flags);
+}
+
 static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 {
 	return zsock_poll(fds, nfds, timeout);
@@ -765,6 +934,7 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 
 #define MSG_PEEK ZSOCK_MSG_PEEK
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
+#define MSG_ZEROCOPY ZSOCK_MSG_ZEROCOPY
 
 #define SHUT_RD ZSOCK_SHUT_RD
 #define SHUT_WR ZSOCK_SHUT_WR
@@ -788,13 +958,19 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 #define SO_REUSEADDR 2
 /** sockopt: Async error (ignored, for compatibility) */
 #define SO_ERROR 4
+/** sockopt: Allow several sockets to bind to the same port */
+#define SO_REUSEPORT 15
 
 /** sockopt: Timestamp TX packets */
 #define SO_TIMESTAMPING 37
 
 /* Socket options for IPPROTO_TCP level */
-/** sockopt: Disable TCP buffering (ignored, for compatibility) */
+/** sockopt: Send queued data right away, disabling the Nagle algorithm */
 #define TCP_NODELAY 1
+/** sockopt: Hold sub-MSS data back until the option is cleared */
+#define TCP_CORK 3
+/** sockopt: Acknowledge received data immediately, disabling delayed ACK */
+#define TCP_QUICKACK 12
 
 /* Socket options for IPPROTO_IPV6 level */
 /** sockopt: Don't support IPv4 access (ignored, for compatibility) */
@@ -811,6 +987,9 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 /** sockopt: Enable SOCKS5 for Socket */
 #define SO_SOCKS5 60
 
+/** sockopt: Receive filter for a packet socket (struct net_raw_filter) */
+#define SO_RAW_FILTER 62
+
 /** @cond INTERNAL_HIDDEN */
 /**
  * @brief Registration information for a given BSD socket family.
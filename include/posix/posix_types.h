@@ -54,7 +54,11 @@ typedef struct pthread_mutex {
 	pthread_t owner;
 	uint16_t lock_count;
 	int type;
+#ifdef CONFIG_PTHREAD_FUTEX_SYNC
+	struct k_futex futex;
+#else
 	_wait_q_t wait_q;
+#endif
 } pthread_mutex_t;
 
 typedef struct pthread_mutexattr {
@@ -63,7 +67,12 @@ typedef struct pthread_mutexattr {
 
 /* Condition variables */
 typedef struct pthread_cond {
+#ifdef CONFIG_PTHREAD_FUTEX_SYNC
+	struct k_futex futex;
+	struct pthread_mutex *mut;
+#else
 	_wait_q_t wait_q;
+#endif
 } pthread_cond_t;
 
 typedef struct pthread_condattr {
@@ -214,6 +214,61 @@ bool sys_pm_ctrl_is_state_enabled(enum power_states state);
 
 #endif /* CONFIG_SYS_PM_STATE_LOCK */
 
+#ifdef CONFIG_SYS_PM_POLICY_LATENCY
+
+/** Value representing no wakeup latency constraint. */
+#define SYS_PM_NO_LATENCY_CONSTRAINT UINT32_MAX
+
+/**
+ * @brief Set the application wakeup latency constraint
+ *
+ * @details The power management policy will not select power states
+ *	    whose exit latency, together with the registered device
+ *	    resume latencies, exceeds this constraint. Pass
+ *	    @ref SYS_PM_NO_LATENCY_CONSTRAINT to remove the constraint.
+ *
+ * @param [in] latency_us Maximum tolerated wakeup latency in microseconds.
+ */
+void sys_pm_ctrl_set_max_latency(uint32_t latency_us);
+
+/**
+ * @brief Get the application wakeup latency constraint
+ *
+ * This function returns the current wakeup latency constraint in
+ * microseconds, or @ref SYS_PM_NO_LATENCY_CONSTRAINT if none is set.
+ */
+uint32_t sys_pm_ctrl_get_max_latency(void);
+
+/**
+ * @brief Register additional resume latency
+ *
+ * @details Device drivers use this function to declare the worst case
+ *	    time they need to become operational again after wakeup.
+ *	    The registered latencies are accounted by the power
+ *	    management policy on top of the power state exit latency.
+ *
+ * @param [in] latency_us Resume latency to register in microseconds.
+ */
+void sys_pm_ctrl_add_resume_latency(uint32_t latency_us);
+
+/**
+ * @brief Remove previously registered resume latency
+ *
+ * @param [in] latency_us Resume latency in microseconds, must match a
+ *	       value passed to @ref sys_pm_ctrl_add_resume_latency before.
+ */
+void sys_pm_ctrl_remove_resume_latency(uint32_t latency_us);
+
+/**
+ * @brief Get the sum of all registered resume latencies
+ *
+ * This function returns the total registered resume latency in
+ * microseconds.
+ */
+uint32_t sys_pm_ctrl_get_resume_latency(void);
+
+#endif /* CONFIG_SYS_PM_POLICY_LATENCY */
+
 /**
  * @}
  */
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_POWER_POWER_STATS_H_
+#define ZEPHYR_INCLUDE_POWER_POWER_STATS_H_
+
+#include <zephyr/types.h>
+#include <power/power.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Power Management Statistics
+ *
+ * Records how often and for how long each power state is entered, how
+ * long leaving it took and which sources woke the SoC up, so battery
+ * life engineering does not need an external power analyzer for data
+ * the kernel already has.
+ *
+ * @defgroup power_management_stats Power Management Statistics
+ * @ingroup power_management_api
+ * @{
+ */
+
+#ifdef CONFIG_SYS_PM_STATS
+
+/** Number of log2 residency histogram buckets, bucket n counts
+ *  residencies in the range [2^n, 2^(n+1)) microseconds.
+ */
+#define SYS_PM_STATS_HIST_BUCKETS 16
+
+/** Statistics kept for one power state. */
+struct sys_pm_state_stats {
+	/** Number of times the state was entered */
+	uint32_t count;
+	/** Residency of the most recent entry in microseconds */
+	uint32_t last_residency_us;
+	/** Sum of all residencies in microseconds */
+	uint64_t total_residency_us;
+	/** Exit latency of the most recent wakeup in microseconds */
+	uint32_t last_exit_latency_us;
+	/** Largest observed exit latency in microseconds */
+	uint32_t max_exit_latency_us;
+	/** Log2 histogram of residencies in microseconds */
+	uint32_t residency_hist[SYS_PM_STATS_HIST_BUCKETS];
+};
+
+/** Wakeup counter for one wakeup source. */
+struct sys_pm_wakeup_source {
+	/** Source identifier, typically the IRQ line */
+	uint32_t id;
+	/** Number of wakeups attributed to the source */
+	uint32_t count;
+};
+
+/** Binary snapshot of all power management statistics. */
+struct sys_pm_stats_snapshot {
+	struct sys_pm_state_stats state[SYS_POWER_STATE_MAX];
+	struct sys_pm_wakeup_source wakeup[CONFIG_SYS_PM_STATS_WAKEUP_SOURCES];
+};
+
+/**
+ * @brief Mark entry into a power state
+ *
+ * Called by the power subsystem right before the state is entered.
+ *
+ * @param [in] state Power state being entered.
+ */
+void sys_pm_stats_enter(enum power_states state);
+
+/**
+ * @brief Mark exit from a power state
+ *
+ * Called by the power subsystem right after control returned from the
+ * state. Updates the entry counter and the residency histogram.
+ *
+ * @param [in] state Power state that was left.
+ */
+void sys_pm_stats_exit(enum power_states state);
+
+/**
+ * @brief Start the exit latency measurement
+ *
+ * Called before the power state exit post operations run.
+ */
+void sys_pm_stats_exit_latency_start(void);
+
+/**
+ * @brief Finish the exit latency measurement
+ *
+ * Called after the power state exit post operations completed.
+ *
+ * @param [in] state Power state that was left.
+ */
+void sys_pm_stats_exit_latency_end(enum power_states state);
+
+/**
+ * @brief Attribute the most recent wakeup to a source
+ *
+ * Called from the ISR of the event that woke the SoC, typically with
+ * the IRQ line as identifier. Only the first
+ * CONFIG_SYS_PM_STATS_WAKEUP_SOURCES distinct identifiers are tracked.
+ *
+ * @param [in] id Wakeup source identifier.
+ */
+void sys_pm_stats_wakeup_source(uint32_t id);
+
+/**
+ * @brief Copy a consistent snapshot of all statistics
+ *
+ * @param [out] snapshot Destination the statistics are copied to.
+ */
+void sys_pm_stats_get(struct sys_pm_stats_snapshot *snapshot);
+
+/**
+ * @brief Reset all statistics to zero
+ */
+void sys_pm_stats_reset(void);
+
+#else
+
+static inline void sys_pm_stats_enter(enum power_states state) { }
+static inline void sys_pm_stats_exit(enum power_states state) { }
+static inline void sys_pm_stats_exit_latency_start(void) { }
+static inline void sys_pm_stats_exit_latency_end(enum power_states state) { }
+static inline void sys_pm_stats_wakeup_source(uint32_t id) { }
+
+#endif /* CONFIG_SYS_PM_STATS */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_POWER_POWER_STATS_H_ */
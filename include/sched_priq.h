@@ -38,6 +38,14 @@ void z_priq_dumb_add(sys_dlist_t *pq, struct k_thread *thread);
 struct _priq_rb {
 	struct rbtree tree;
 	int next_order_key;
+
+	/* Leftmost tree node, maintained across add/remove so the
+	 * best thread can be read in O(1) instead of walking the
+	 * tree.  With SCHED_DEADLINE this is what makes the earliest
+	 * deadline cheap to query even when deadline threads requeue
+	 * frequently.
+	 */
+	struct k_thread *cached_best;
 };
 
 void z_priq_rb_add(struct _priq_rb *pq, struct k_thread *thread);
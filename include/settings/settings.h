@@ -588,6 +588,32 @@ int settings_runtime_get(const char *name, void *data, size_t len);
  * @return 0 on success, non-zero on failure.
  */
 int settings_runtime_commit(const char *name);
+
+#ifdef CONFIG_SETTINGS_VALUE_CACHE
+/**
+ * Pin a key in the runtime value cache.
+ *
+ * The current value of a pinned key is kept in RAM, updated on every
+ * settings_save_one() and settings_runtime_set(), and served by
+ * settings_runtime_get() without invoking the handler.
+ *
+ * @param name Key in string format.
+ *
+ * @return 0 on success, -EINVAL when the name does not fit the cache,
+ * -ENOMEM when all cache entries are pinned already.
+ */
+int settings_cache_pin(const char *name);
+
+/**
+ * Remove a key from the runtime value cache.
+ *
+ * @param name Key in string format.
+ *
+ * @return 0 on success, -ENOENT when the key is not pinned.
+ */
+int settings_cache_unpin(const char *name);
+#endif /* CONFIG_SETTINGS_VALUE_CACHE */
+
 /**
  * @}
  */
@@ -25,12 +25,17 @@ struct shell_uart_ctrl_blk {
 	void *context;
 	atomic_t tx_busy;
 	bool blocking_tx;
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+	/* Index of the DMA buffer handed over on next buffer request. */
+	uint8_t rx_dma_idx;
+#endif /* CONFIG_SHELL_BACKEND_SERIAL_ASYNC */
 #ifdef CONFIG_MCUMGR_SMP_SHELL
 	struct smp_shell_data smp;
 #endif /* CONFIG_MCUMGR_SMP_SHELL */
 };
 
-#ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
+#if defined(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) || \
+	defined(CONFIG_SHELL_BACKEND_SERIAL_ASYNC)
 #define UART_SHELL_TX_RINGBUF_DECLARE(_name, _size) \
 	RING_BUF_DECLARE(_name##_tx_ringbuf, _size)
 
@@ -51,12 +56,23 @@ struct shell_uart_ctrl_blk {
 #define UART_SHELL_RX_TIMER_PTR(_name) (&_name##_timer)
 #endif /* CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN */
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+#define UART_SHELL_RX_DMA_BUF_DECLARE(_name) \
+	static uint8_t _name##_rx_dma_buf[2] \
+		[CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE]
+#define UART_SHELL_RX_DMA_BUF_PTR(_name) (&_name##_rx_dma_buf[0][0])
+#else /* CONFIG_SHELL_BACKEND_SERIAL_ASYNC */
+#define UART_SHELL_RX_DMA_BUF_DECLARE(_name) /* Empty */
+#define UART_SHELL_RX_DMA_BUF_PTR(_name) NULL
+#endif /* CONFIG_SHELL_BACKEND_SERIAL_ASYNC */
+
 /** @brief Shell UART transport instance structure. */
 struct shell_uart {
 	struct shell_uart_ctrl_blk *ctrl_blk;
 	struct k_timer *timer;
 	struct ring_buf *tx_ringbuf;
 	struct ring_buf *rx_ringbuf;
+	uint8_t *rx_dma_buf;
 };
 
 /** @brief Macro for creating shell UART transport instance. */
@@ -64,12 +80,14 @@ struct shell_uart {
 	static struct shell_uart_ctrl_blk _name##_ctrl_blk;		\
 	UART_SHELL_RX_TIMER_DECLARE(_name);				\
 	UART_SHELL_TX_RINGBUF_DECLARE(_name, _tx_ringbuf_size);		\
+	UART_SHELL_RX_DMA_BUF_DECLARE(_name);				\
 	RING_BUF_DECLARE(_name##_rx_ringbuf, _rx_ringbuf_size);		\
 	static const struct shell_uart _name##_shell_uart = {		\
 		.ctrl_blk = &_name##_ctrl_blk,				\
 		.timer = UART_SHELL_RX_TIMER_PTR(_name),		\
 		.tx_ringbuf = UART_SHELL_TX_RINGBUF_PTR(_name),		\
 		.rx_ringbuf = &_name##_rx_ringbuf,			\
+		.rx_dma_buf = UART_SHELL_RX_DMA_BUF_PTR(_name),		\
 	};								\
 	struct shell_transport _name = {				\
 		.api = &shell_uart_transport_api,			\
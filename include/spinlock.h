@@ -23,6 +23,24 @@ void z_spin_lock_set_owner(struct k_spinlock *l);
 BUILD_ASSERT(CONFIG_MP_NUM_CPUS < 4, "Too many CPUs for mask");
 #endif /* CONFIG_SPIN_VALIDATE */
 
+/* Spinlock profiling framework: accumulates spin-wait cycles, hold
+ * times and acquisition counts per lock site, see
+ * include/debug/spin_profile.h.  Compiles out to nothing when
+ * CONFIG_SPIN_PROFILE is disabled.
+ */
+#ifdef CONFIG_SPIN_PROFILE
+struct k_spinlock;
+bool z_spin_profile_enter(uint32_t *t0);
+void z_spin_profile_lock(struct k_spinlock *l, void *site, uint32_t t0);
+void z_spin_profile_unlock(struct k_spinlock *l);
+
+/* Code address of the expansion site.  k_spin_lock() is always
+ * inlined, so this identifies the caller's lock site.
+ */
+#define Z_SPIN_PROFILE_SITE() \
+	({ __label__ _spin_site; _spin_site: &&_spin_site; })
+#endif /* CONFIG_SPIN_PROFILE */
+
 struct k_spinlock_key {
 	int key;
 };
@@ -92,11 +110,23 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	__ASSERT(z_spin_lock_valid(l), "Recursive spinlock %p", l);
 #endif
 
+#ifdef CONFIG_SPIN_PROFILE
+	void *site = Z_SPIN_PROFILE_SITE();
+	uint32_t t0 = 0U;
+	bool profiled = z_spin_profile_enter(&t0);
+#endif
+
 #ifdef CONFIG_SMP
 	while (!atomic_cas(&l->locked, 0, 1)) {
 	}
 #endif
 
+#ifdef CONFIG_SPIN_PROFILE
+	if (profiled) {
+		z_spin_profile_lock(l, site, t0);
+	}
+#endif
+
 #ifdef CONFIG_SPIN_VALIDATE
 	z_spin_lock_set_owner(l);
 #endif
@@ -132,6 +162,10 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
 
+#ifdef CONFIG_SPIN_PROFILE
+	z_spin_profile_unlock(l);
+#endif
+
 #ifdef CONFIG_SMP
 	/* Strictly we don't need atomic_clear() here (which is an
 	 * exchange operation that returns the old value).  We are always
@@ -154,6 +188,9 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+#ifdef CONFIG_SPIN_PROFILE
+	z_spin_profile_unlock(l);
+#endif
 #ifdef CONFIG_SMP
 	atomic_clear(&l->locked);
 #endif
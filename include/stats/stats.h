@@ -71,6 +71,9 @@ struct stats_hdr {
 #ifdef CONFIG_STATS_NAMES
 	const struct stats_name_map *s_map;
 	int s_map_cnt;
+#endif
+#ifdef CONFIG_STATS_PERCPU
+	uint16_t s_percpu_off;
 #endif
 	struct stats_hdr *s_next;
 };
@@ -140,8 +143,15 @@ struct stats_hdr {
  * @param var__                 The statistic entry to increase.
  * @param n__                   The amount to increase the statistic entry by.
  */
+#ifdef CONFIG_STATS_PERCPU
+#define STATS_INCN(group__, var__, n__)				\
+	(*(__typeof__((group__).var__) *)stats_percpu_addr(	\
+		&(group__).s_hdr,				\
+		(void *)&(group__).var__) += (n__))
+#else
 #define STATS_INCN(group__, var__, n__)	\
 	((group__).var__ += (n__))
+#endif
 
 /**
  * @brief Increments a statistic entry.
@@ -336,6 +346,41 @@ struct stats_hdr *stats_group_get_next(const struct stats_hdr *cur);
  */
 struct stats_hdr *stats_group_find(const char *name);
 
+/**
+ * @brief Copies a consistent snapshot of a statistics group.
+ *
+ * Copies the entry area of the group into the supplied buffer with
+ * interrupts locked, so readers never observe a group in the middle of
+ * an update and 64-bit entries are not torn by preemption.  When
+ * CONFIG_STATS_PERCPU is enabled, the per-CPU shadow counters are
+ * folded into the copy.
+ *
+ * @param hdr                   The statistics group to snapshot.
+ * @param buf                   Buffer receiving the entry area.  Entries
+ *                                  are laid out exactly as in the group
+ *                                  struct, without the header.
+ * @param len                   Size of the buffer, in bytes.
+ *
+ * @return                      The number of bytes copied on success;
+ *                              -EINVAL if the buffer is too small.
+ */
+int stats_snapshot(struct stats_hdr *hdr, void *buf, size_t len);
+
+#ifdef CONFIG_STATS_PERCPU
+/**
+ * @brief Translates a stat entry address to this CPU's shadow counter.
+ *
+ * For internal use by the STATS_INCN() macro.
+ *
+ * @param hdr                   The group containing the entry.
+ * @param addr                  Address of the entry within the group.
+ *
+ * @return                      Address of the corresponding shadow
+ *                              counter of the executing CPU.
+ */
+void *stats_percpu_addr(struct stats_hdr *hdr, void *addr);
+#endif
+
 #else /* CONFIG_STATS */
 
 #define STATS_SECT_START(group__) \
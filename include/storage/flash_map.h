@@ -141,6 +141,26 @@ void flash_area_close(const struct flash_area *fa);
 int flash_area_read(const struct flash_area *fa, off_t off, void *dst,
 		    size_t len);
 
+/**
+ * @brief Get a direct read pointer into flash area content
+ *
+ * When the backing device is memory-mapped (internal flash, QSPI in XIP
+ * mode) this returns a pointer through which the area content can be
+ * read in place, avoiding the copy done by flash_area_read(). Area
+ * readout boundaries are asserted before the pointer is handed out.
+ * The pointer stays valid as long as the range is not rewritten or
+ * erased.
+ *
+ * @param[in] fa  Flash area
+ * @param[in] off Offset relative from beginning of flash area
+ * @param[in] len Number of bytes that will be read via the pointer
+ *
+ * @return Directly readable pointer, or NULL when the backing device
+ * does not support memory-mapped reads or the range is out of bounds.
+ */
+const void *flash_area_get_pointer(const struct flash_area *fa, off_t off,
+				   size_t len);
+
 /**
  * @brief Write data to flash area
  *
@@ -21,6 +21,7 @@
  */
 
 #include <stdbool.h>
+#include <kernel.h>
 #include <drivers/flash.h>
 
 #ifdef __cplusplus
@@ -62,6 +63,16 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	uint8_t *wb_buf; /* Buffer being written back, spare buffer when
+			  * idle, NULL when double buffering is not used
+			  */
+	size_t wb_bytes; /* Number of bytes to write from wb_buf */
+	size_t wb_addr; /* Flash address wb_buf is written to */
+	int wb_rc; /* Result of the last background write */
+	struct k_work wb_work; /* Work item performing background writes */
+	struct k_sem wb_done; /* Given when no background write is running */
+#endif
 };
 
 /**
@@ -83,6 +94,30 @@ struct stream_flash_ctx {
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		      uint8_t *buf, size_t buf_len, size_t offset, size_t size,
 		      stream_flash_callback_t cb);
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+/**
+ * @brief Enable double buffered writes for an initialized context.
+ *
+ * With a second buffer attached, a full write buffer is programmed to
+ * flash from the system workqueue while the caller keeps filling the
+ * other buffer, overlapping flash programming with data reception.
+ * Must be called after stream_flash_init() and before the first write.
+ *
+ * @note With double buffering, stream_flash_bytes_written() counts
+ * bytes handed over for programming; flush to make it reflect the
+ * bytes actually in flash.
+ *
+ * @param ctx context to attach the second buffer to
+ * @param buf Second write buffer, at least as large as the buffer
+ *            given to stream_flash_init()
+ * @param buf_len Length of the second write buffer
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_double_buffer_init(struct stream_flash_ctx *ctx, uint8_t *buf,
+				    size_t buf_len);
+#endif
+
 /**
  * @brief Read number of bytes written to the flash.
  *
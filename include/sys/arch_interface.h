@@ -372,6 +372,20 @@ static inline struct _cpu *arch_curr_cpu(void);
  * This will invoke z_sched_ipi() on other CPUs in the system.
  */
 void arch_sched_ipi(void);
+
+#ifdef CONFIG_SCHED_IPI_TARGETED
+/**
+ * Interrupt a specific set of CPUs
+ *
+ * This will invoke z_sched_ipi() on the CPUs whose id bit is set in
+ * @a cpu_bitmap.  Architectures that can address individual CPUs in
+ * their interrupt controller select CONFIG_SCHED_IPI_TARGETED and
+ * provide this call; others fall back to arch_sched_ipi().
+ *
+ * @param cpu_bitmap Bitmap of CPU ids to interrupt
+ */
+void arch_sched_directed_ipi(uint32_t cpu_bitmap);
+#endif /* CONFIG_SCHED_IPI_TARGETED */
 #endif /* CONFIG_SMP */
 
 /** @} */
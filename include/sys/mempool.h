@@ -64,6 +64,51 @@ struct sys_mem_pool_block {
 	};								\
 	BUILD_ASSERT(WB_UP(maxsz) >= _MPOOL_MINBLK)
 
+/**
+ * @brief Statically define system memory pool with a segregated backend
+ *
+ * Takes the same parameters as SYS_MEM_POOL_DEFINE() and produces a
+ * pool with the same block sizes (@a max_size split into quarters down
+ * to @a min_size), but managed with segregated per-size-class free
+ * lists instead of the buddy scheme: a block split down to some size
+ * class stays in that class forever and is never recombined with its
+ * partners.  Once the free lists are populated for the object sizes the
+ * application actually uses, allocation and free are O(1) with no
+ * split/merge loops, at the cost of the pool fragmenting permanently
+ * into the classes it was used with (e.g. a pool fully split into
+ * minimum sized blocks will never again satisfy a maximum sized
+ * request).  Intended for pools serving a known, small set of object
+ * sizes where deterministic latency matters more than space reuse.
+ * Note that without the buddy allocation bitmaps double frees are not
+ * detected.
+ *
+ * @param name Name of the memory pool.
+ * @param ignored ignored, any value
+ * @param minsz Size of the smallest blocks in the pool (in bytes).
+ * @param maxsz Size of the largest blocks in the pool (in bytes).
+ * @param nmax Number of maximum sized blocks in the pool.
+ * @param align Alignment of the pool's buffer (power of 2).
+ * @param section Destination binary section for pool data
+ */
+#define SYS_MEM_POOL_SEGREGATED_DEFINE(name, ignored, minsz, maxsz, nmax, \
+				       align, section)			\
+	char __aligned(WB_UP(align)) Z_GENERIC_SECTION(section)		\
+		_mpool_buf_##name[WB_UP(maxsz) * nmax];			\
+	struct sys_mem_pool_lvl Z_GENERIC_SECTION(section)		\
+		_mpool_lvls_##name[Z_MPOOL_LVLS(maxsz, minsz)];		\
+	Z_GENERIC_SECTION(section) struct sys_mem_pool name = {		\
+		.base = {						\
+			.buf = _mpool_buf_##name,			\
+			.max_sz = WB_UP(maxsz),				\
+			.n_max = nmax,					\
+			.n_levels = Z_MPOOL_LVLS(maxsz, minsz),		\
+			.levels = _mpool_lvls_##name,			\
+			.flags = SYS_MEM_POOL_USER |			\
+				 SYS_MEM_POOL_SEGREGATED		\
+		}							\
+	};								\
+	BUILD_ASSERT(WB_UP(maxsz) >= _MPOOL_MINBLK)
+
 /**
  * @brief Initialize a memory pool
  *
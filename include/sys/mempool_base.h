@@ -25,6 +25,11 @@ struct sys_mem_pool_lvl {
 
 #define SYS_MEM_POOL_KERNEL	BIT(0)
 #define SYS_MEM_POOL_USER	BIT(1)
+/* Segregated free list backend: blocks split to a size class stay in
+ * that class forever (no recombining), making alloc/free O(1) once the
+ * class free lists are populated.  Needs no allocation bitmaps.
+ */
+#define SYS_MEM_POOL_SEGREGATED	BIT(2)
 
 struct sys_mem_pool_base {
 	void *buf;
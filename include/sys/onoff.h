@@ -176,6 +176,14 @@ struct onoff_manager {
 
 	/* Number of active clients for the service. */
 	uint16_t refs;
+
+	/* Period to remain on after the last client releases before
+	 * the stop transition is initiated.
+	 */
+	k_timeout_t linger;
+
+	/* Timer used to defer the stop transition while lingering. */
+	struct k_timer linger_timer;
 };
 
 /** @brief Initializer for a onoff_transitions object.
@@ -220,6 +228,33 @@ struct onoff_manager {
 int onoff_manager_init(struct onoff_manager *mgr,
 		       const struct onoff_transitions *transitions);
 
+/**
+ * @brief Set the period the service remains on after its last release.
+ *
+ * By default a service is stopped as soon as its last client releases
+ * it.  Services with expensive start transitions may instead be
+ * configured to linger in the on state for a hold-off period, so that
+ * a request arriving shortly after the last release is satisfied
+ * without another stop/start cycle.  A request received while
+ * lingering cancels the pending stop; the stop transition is
+ * initiated only if the service is still unused when the period
+ * expires.
+ *
+ * This function is intended for use by the infrastructure that
+ * provides the service, after the manager has been initialized.
+ *
+ * @param mgr the manager for which the linger period is configured.
+ *
+ * @param linger the period to remain on after the last release.  Pass
+ * K_NO_WAIT to restore the default immediate stop.  K_FOREVER is not
+ * supported.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if mgr is null or linger is K_FOREVER
+ */
+int onoff_manager_set_linger(struct onoff_manager *mgr,
+			     k_timeout_t linger);
+
 /* Forward declaration */
 struct onoff_client;
 
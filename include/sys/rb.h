@@ -44,9 +44,17 @@
 #define ZEPHYR_INCLUDE_SYS_RB_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 
 struct rbnode {
 	struct rbnode *children[2];
+#ifdef CONFIG_RBTREE_SUBTREE_SIZES
+	/* Count of nodes in the subtree rooted here (including this
+	 * node), maintained by the tree operations to support
+	 * order-statistic queries, c.f. rb_nth()
+	 */
+	size_t size;
+#endif
 };
 
 /* Theoretical maximum depth of tree based on pointer size. If memory
@@ -102,6 +110,42 @@ void rb_insert(struct rbtree *tree, struct rbnode *node);
  */
 void rb_remove(struct rbtree *tree, struct rbnode *node);
 
+#ifndef CONFIG_MISRA_SANE
+/**
+ * @brief Bulk-load a tree from a sorted array
+ *
+ * Replaces the contents of the tree (the comparison callback is
+ * preserved, any previously inserted nodes are discarded) with the
+ * count nodes pointed to by the nodes array, which must already be
+ * sorted in ascending order per the tree's lessthan_fn.  This runs in
+ * O(count) with no rebalancing work and produces a perfectly balanced
+ * tree: the node counts of any node's two subtrees differ by at most
+ * one.  Rebuilding a tree this way is significantly cheaper than
+ * count repetitions of rb_insert(), which costs O(N*log2(N)) and
+ * leaves the tree only loosely balanced.
+ */
+void rb_build(struct rbtree *tree, struct rbnode **nodes, size_t count);
+#endif
+
+#ifdef CONFIG_RBTREE_SUBTREE_SIZES
+/**
+ * @brief Returns the number of nodes in the tree
+ *
+ * Constant time, read out of the root's subtree size count.
+ */
+size_t rb_size(struct rbtree *tree);
+
+/**
+ * @brief Returns the idx'th-lowest node in the tree
+ *
+ * Order-statistic query: returns the node that an in-order walk of
+ * the tree would visit at (zero-based) position idx, or NULL if idx
+ * is out of range.  Runs in O(log2(N)) using the subtree size counts,
+ * where finding the same node by walking would be O(N).
+ */
+struct rbnode *rb_nth(struct rbtree *tree, size_t idx);
+#endif
+
 /**
  * @brief Returns the lowest-sorted member of the tree
  */
@@ -24,6 +24,45 @@ extern "C" {
 /**
  * @brief A structure to represent a ring buffer
  */
+#ifdef CONFIG_RING_BUFFER_SPSC
+struct ring_buf {
+	/* Consumer-owned state.  The aligned groups keep the indices
+	 * written by the consumer and the producer in different cache
+	 * lines, so a single-producer/single-consumer pair on
+	 * different CPUs does not false-share on every operation.
+	 */
+	struct {
+		uint32_t head;	 /**< Index in buf for the head element */
+		uint32_t tmp_head;
+	} get __aligned(CONFIG_RING_BUFFER_SPSC_ALIGN);
+
+	/* Producer-owned state */
+	struct {
+		uint32_t tail;	 /**< Index in buf for the tail element */
+		uint32_t tmp_tail;
+		uint32_t dropped_put_count; /**< Running tally of the
+					   * number of failed put
+					   * attempts.
+					   */
+	} put __aligned(CONFIG_RING_BUFFER_SPSC_ALIGN);
+
+	/* Read-only after init */
+	uint32_t size;   /**< Size of buf in 32-bit chunks */
+
+	union ring_buf_buffer {
+		uint32_t *buf32;	 /**< Memory region for stored entries */
+		uint8_t *buf8;
+	} buf;
+	uint32_t mask;   /**< Modulo mask if size is a power of 2 */
+};
+
+/** @internal Accessors hiding the layout difference from the code */
+#define Z_RING_BUF_HEAD(buf)	 ((buf)->get.head)
+#define Z_RING_BUF_TAIL(buf)	 ((buf)->put.tail)
+#define Z_RING_BUF_TMP_HEAD(buf) ((buf)->get.tmp_head)
+#define Z_RING_BUF_TMP_TAIL(buf) ((buf)->put.tmp_tail)
+#define Z_RING_BUF_DROPPED(buf)	 ((buf)->put.dropped_put_count)
+#else
 struct ring_buf {
 	uint32_t head;	 /**< Index in buf for the head element */
 	uint32_t tail;	 /**< Index in buf for the tail element */
@@ -48,6 +87,14 @@ struct ring_buf {
 	uint32_t mask;   /**< Modulo mask if size is a power of 2 */
 };
 
+/** @internal Accessors hiding the layout difference from the code */
+#define Z_RING_BUF_HEAD(buf)	 ((buf)->head)
+#define Z_RING_BUF_TAIL(buf)	 ((buf)->tail)
+#define Z_RING_BUF_TMP_HEAD(buf) ((buf)->misc.byte_mode.tmp_head)
+#define Z_RING_BUF_TMP_TAIL(buf) ((buf)->misc.byte_mode.tmp_tail)
+#define Z_RING_BUF_DROPPED(buf)	 ((buf)->misc.item_mode.dropped_put_count)
+#endif /* CONFIG_RING_BUFFER_SPSC */
+
 /**
  * @defgroup ring_buffer_apis Ring Buffer APIs
  * @ingroup kernel_apis
@@ -186,7 +233,7 @@ static inline uint32_t z_ring_buf_custom_space_get(uint32_t size, uint32_t head,
  */
 static inline int ring_buf_is_empty(struct ring_buf *buf)
 {
-	return (buf->head == buf->tail);
+	return (Z_RING_BUF_HEAD(buf) == Z_RING_BUF_TAIL(buf));
 }
 
 /**
@@ -196,9 +243,11 @@ static inline int ring_buf_is_empty(struct ring_buf *buf)
  */
 static inline void ring_buf_reset(struct ring_buf *buf)
 {
-	buf->head = 0;
-	buf->tail = 0;
-	memset(&buf->misc, 0, sizeof(buf->misc));
+	Z_RING_BUF_HEAD(buf) = 0;
+	Z_RING_BUF_TAIL(buf) = 0;
+	Z_RING_BUF_TMP_HEAD(buf) = 0;
+	Z_RING_BUF_TMP_TAIL(buf) = 0;
+	Z_RING_BUF_DROPPED(buf) = 0;
 }
 
 /**
@@ -210,7 +259,8 @@ static inline void ring_buf_reset(struct ring_buf *buf)
  */
 static inline uint32_t ring_buf_space_get(struct ring_buf *buf)
 {
-	return z_ring_buf_custom_space_get(buf->size, buf->head, buf->tail);
+	return z_ring_buf_custom_space_get(buf->size, Z_RING_BUF_HEAD(buf),
+					   Z_RING_BUF_TAIL(buf));
 }
 
 /**
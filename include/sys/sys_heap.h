@@ -103,6 +103,28 @@ void *sys_heap_alloc(struct sys_heap *h, size_t bytes);
  */
 void *sys_heap_aligned_alloc(struct sys_heap *h, size_t align, size_t bytes);
 
+/** @brief Resize an allocated block from a sys_heap
+ *
+ * Changes the size of the block at @a ptr to @a bytes, preserving its
+ * contents up to the smaller of the old and new sizes.  The block is
+ * grown or shrunk in place when the chunk metadata allows it (e.g. the
+ * following chunk is free), otherwise a new block is allocated and the
+ * data copied, like realloc().  A NULL @a ptr behaves like
+ * sys_heap_alloc(), and a zero @a bytes frees the block and returns
+ * NULL.
+ *
+ * @note The sys_heap implementation is not internally synchronized.
+ * No two sys_heap functions should operate on the same heap at the
+ * same time.  All locking must be provided by the user.
+ *
+ * @param h Heap from which the block was allocated
+ * @param ptr A pointer previously returned from sys_heap_alloc(), or NULL
+ * @param bytes New size requested for the block
+ * @return Pointer to the resized memory, or NULL if the request
+ *         cannot be satisfied (the original block is then untouched)
+ */
+void *sys_heap_realloc(struct sys_heap *h, void *ptr, size_t bytes);
+
 /** @brief Free memory into a sys_heap
  *
  * De-allocates a pointer to memory previously returned from
@@ -118,6 +140,18 @@ void *sys_heap_aligned_alloc(struct sys_heap *h, size_t align, size_t bytes);
  */
 void sys_heap_free(struct sys_heap *h, void *mem);
 
+/** @brief Get the usable size of an allocated block
+ *
+ * Returns the number of bytes actually available in a block returned
+ * from sys_heap_alloc() or sys_heap_aligned_alloc(), which due to
+ * chunk granularity may be larger than the number requested.
+ *
+ * @param h Heap from which the block was allocated
+ * @param mem A pointer previously returned from sys_heap_alloc()
+ * @return Usable size of the block in bytes
+ */
+size_t sys_heap_usable_size(struct sys_heap *h, void *mem);
+
 /** @brief Validate heap integrity
  *
  * Validates the internal integrity of a sys_heap.  Intended for unit
@@ -179,4 +213,58 @@ void sys_heap_stress(void *(*alloc)(void *arg, size_t bytes),
  */
 void sys_heap_dump(struct sys_heap *h);
 
+/* Number of power-of-two allocation size buckets in a profile entry.
+ * Bucket 0 counts allocations of up to 16 bytes, each further bucket
+ * doubles the limit and the last one is open ended.
+ */
+#define SYS_HEAP_PROFILE_HIST_BUCKETS 8
+
+/** @brief Per-call-site allocation statistics
+ *
+ * Snapshot of the statistics recorded for one sys_heap allocation call
+ * site when CONFIG_SYS_HEAP_PROFILE is enabled.  With a sampling rate
+ * of 1-in-N only every Nth allocation is recorded, so all numbers are
+ * estimates to be scaled by the rate.
+ */
+struct sys_heap_profile_site {
+	/** Return address of the recorded sys_heap API call */
+	void *site;
+	/** Number of sampled allocations from this site */
+	uint32_t alloc_count;
+	/** Bytes from sampled allocations currently live */
+	uint32_t live_bytes;
+	/** High-water mark of live_bytes */
+	uint32_t peak_bytes;
+	/** Sampled allocation counts by power-of-two size bucket */
+	uint32_t size_hist[SYS_HEAP_PROFILE_HIST_BUCKETS];
+};
+
+/** @brief Read one entry of the allocation profile table
+ *
+ * @param idx Table index, 0 up to CONFIG_SYS_HEAP_PROFILE_NUM_SITES - 1
+ * @param site Location where the entry is copied to
+ *
+ * @retval true The entry is in use and was copied
+ * @retval false The index is out of range or the entry is unused
+ */
+bool sys_heap_profile_site_get(int idx, struct sys_heap_profile_site *site);
+
+/** @brief Reset all recorded allocation profile statistics */
+void sys_heap_profile_reset(void);
+
+/** @brief Serialize the allocation profile for host analysis
+ *
+ * Writes a self-describing little-endian binary blob: a 16 byte header
+ * ("HPRF" magic, format version, pointer size, record count, sampling
+ * rate) followed by one fixed-size record per used table entry with
+ * the fields of struct sys_heap_profile_site.  Records which do not
+ * fit into the buffer are dropped and reflected in the header count.
+ *
+ * @param buf Output buffer
+ * @param buf_size Size of the output buffer in bytes
+ *
+ * @return Number of bytes written, 0 if even the header does not fit
+ */
+size_t sys_heap_profile_dump(uint8_t *buf, size_t buf_size);
+
 #endif /* ZEPHYR_INCLUDE_SYS_SYS_HEAP_H_ */
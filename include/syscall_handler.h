@@ -445,11 +445,25 @@ static inline int z_obj_validation_check(struct z_object *ko,
 	return ret;
 }
 
+#ifdef CONFIG_KOBJECT_VALIDATION_CACHE
+/* Variant of z_obj_validation_check() that consults the calling
+ * thread's cache of already-validated objects before falling back to
+ * the full z_object_find() lookup and permission test.
+ */
+int z_obj_validation_check_cached(const void *obj, enum k_objects otype,
+				  enum _obj_init_check init);
+
+#define Z_SYSCALL_IS_OBJ(ptr, type, init) \
+	Z_SYSCALL_VERIFY_MSG(z_obj_validation_check_cached(		\
+				     (const void *)ptr,			\
+				     type, init) == 0, "access denied")
+#else
 #define Z_SYSCALL_IS_OBJ(ptr, type, init) \
 	Z_SYSCALL_VERIFY_MSG(z_obj_validation_check(			\
 				     z_object_find((const void *)ptr),	\
 				     (const void *)ptr,			\
 				     type, init) == 0, "access denied")
+#endif /* CONFIG_KOBJECT_VALIDATION_CACHE */
 
 /**
  * @brief Runtime check driver object pointer for presence of operation
@@ -35,7 +35,7 @@ static inline void z_waitq_init(_wait_q_t *w)
 
 static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 {
-	return (struct k_thread *)rb_get_min(&w->waitq.tree);
+	return w->waitq.cached_best;
 }
 
 #else /* !CONFIG_WAITQ_SCALABLE: */
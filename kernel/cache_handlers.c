@@ -20,3 +20,10 @@ static inline void z_vrfy_sys_cache_invd(void *addr, size_t size)
 	z_impl_sys_cache_invd(addr, size);
 }
 #include <syscalls/sys_cache_invd_mrsh.c>
+
+static inline void z_vrfy_sys_cache_data_range(void *addr, size_t size, int op)
+{
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(addr, size));
+	z_impl_sys_cache_data_range(addr, size, op);
+}
+#include <syscalls/sys_cache_data_range_mrsh.c>
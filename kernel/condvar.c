@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief condition variable kernel services
+ *
+ * A condition variable pairs with a mutex: k_condvar_wait() atomically
+ * releases the mutex and blocks, and the mutex is reacquired before the
+ * call returns.
+ *
+ * Broadcasts perform wait morphing.  When the broadcaster holds the
+ * paired mutex, the waiters are moved onto the mutex wait queue instead
+ * of all being made runnable: each waiter then wakes exactly once, when
+ * the mutex is handed over to it, instead of every waiter waking only
+ * to pend again on the mutex.
+ */
+
+#include <kernel.h>
+#include <kernel_structs.h>
+#include <toolchain.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <errno.h>
+#include <init.h>
+#include <syscall_handler.h>
+#include <debug/object_tracing_common.h>
+#include <tracing/tracing.h>
+#include <sys/check.h>
+
+static struct k_spinlock lock;
+
+#ifdef CONFIG_OBJECT_TRACING
+
+struct k_condvar *_trace_list_k_condvar;
+
+/*
+ * Complete initialization of statically defined condition variables.
+ */
+static int init_condvar_module(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	Z_STRUCT_SECTION_FOREACH(k_condvar, condvar) {
+		SYS_TRACING_OBJ_INIT(k_condvar, condvar);
+	}
+	return 0;
+}
+
+SYS_INIT(init_condvar_module, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+#endif /* CONFIG_OBJECT_TRACING */
+
+int z_impl_k_condvar_init(struct k_condvar *condvar)
+{
+	z_waitq_init(&condvar->wait_q);
+	condvar->mutex = NULL;
+
+	SYS_TRACING_OBJ_INIT(k_condvar, condvar);
+	z_object_init(condvar);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_condvar_init(struct k_condvar *condvar)
+{
+	Z_OOPS(Z_SYSCALL_OBJ_INIT(condvar, K_OBJ_CONDVAR));
+	return z_impl_k_condvar_init(condvar);
+}
+#include <syscalls/k_condvar_init_mrsh.c>
+#endif
+
+int z_impl_k_condvar_signal(struct k_condvar *condvar)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	struct k_thread *thread = z_unpend_first_thread(&condvar->wait_q);
+
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_condvar_signal(struct k_condvar *condvar)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(condvar, K_OBJ_CONDVAR));
+	return z_impl_k_condvar_signal(condvar);
+}
+#include <syscalls/k_condvar_signal_mrsh.c>
+#endif
+
+int z_impl_k_condvar_broadcast(struct k_condvar *condvar)
+{
+	struct k_mutex *mutex;
+	struct k_thread *thread;
+	int woken = 0;
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	mutex = condvar->mutex;
+
+	if ((mutex != NULL) && (mutex->owner == _current)) {
+		/* Wait morphing: the waiters cannot run before the
+		 * broadcaster releases the mutex anyway, so move them
+		 * onto the mutex wait queue without waking them.  Each
+		 * is then handed the mutex in turn by k_mutex_unlock()
+		 * rather than all of them stampeding for it at once.
+		 * Any armed wait timeout stays active and removes the
+		 * thread from whichever queue it sits on when it fires.
+		 */
+		while ((thread = z_waitq_head(&condvar->wait_q)) != NULL) {
+			z_requeue_thread(thread, &mutex->wait_q);
+			woken++;
+		}
+		k_spin_unlock(&lock, key);
+	} else {
+		/* Without the mutex held there is no handover to
+		 * serialize on; wake everyone.
+		 */
+		while ((thread =
+			z_unpend_first_thread(&condvar->wait_q)) != NULL) {
+			arch_thread_return_value_set(thread, 0);
+			z_ready_thread(thread);
+			woken++;
+		}
+		z_reschedule(&lock, key);
+	}
+
+	return woken;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_condvar_broadcast(struct k_condvar *condvar)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(condvar, K_OBJ_CONDVAR));
+	return z_impl_k_condvar_broadcast(condvar);
+}
+#include <syscalls/k_condvar_broadcast_mrsh.c>
+#endif
+
+int z_impl_k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
+			  k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(),
+		 "condition variables cannot be used inside ISRs");
+
+	CHECKIF((mutex->owner != _current) || (mutex->lock_count != 1U)) {
+		return -EPERM;
+	}
+
+	key = k_spin_lock(&lock);
+
+	/* Remember the paired mutex so a broadcaster can requeue the
+	 * waiters onto it.  All concurrent waiters on one condition
+	 * variable must use the same mutex.
+	 */
+	condvar->mutex = mutex;
+
+	(void)k_mutex_unlock(mutex);
+
+	ret = z_pend_curr(&lock, key, &condvar->wait_q, timeout);
+
+	/* A waiter requeued by a broadcast is handed the mutex directly
+	 * by k_mutex_unlock(); only threads woken any other way need to
+	 * acquire it here.
+	 */
+	if (mutex->owner != _current) {
+		(void)k_mutex_lock(mutex, K_FOREVER);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_condvar_wait(struct k_condvar *condvar,
+					struct k_mutex *mutex,
+					k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(condvar, K_OBJ_CONDVAR));
+	Z_OOPS(Z_SYSCALL_OBJ(mutex, K_OBJ_MUTEX));
+	return z_impl_k_condvar_wait(condvar, mutex, timeout);
+}
+#include <syscalls/k_condvar_wait_mrsh.c>
+#endif
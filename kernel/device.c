@@ -8,6 +8,10 @@
 #include <device.h>
 #include <sys/atomic.h>
 #include <syscall_handler.h>
+#ifdef CONFIG_BOOT_TIMING
+#include <debug/boot_timing.h>
+#include <sys/byteorder.h>
+#endif
 
 extern const struct init_entry __init_start[];
 extern const struct init_entry __init_PRE_KERNEL_1_start[];
@@ -31,6 +35,88 @@ extern uint32_t __device_busy_end[];
 #define DEVICE_BUSY_SIZE (__device_busy_end - __device_busy_start)
 #endif
 
+#ifdef CONFIG_DEVICE_NAME_LOOKUP_INDEX
+
+BUILD_ASSERT((CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE &
+	      (CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE - 1)) == 0,
+	     "Device name index size must be a power of 2");
+
+/* Hash table over the device names, built once before the init entries
+ * run. The device list is fixed at link time, so the index never needs
+ * rebuilding; readiness is checked at lookup time.
+ */
+static const struct device
+	*device_name_index[CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE];
+static bool device_name_index_ready;
+static bool device_name_index_overflow;
+
+static uint32_t device_name_index_hash(const char *name)
+{
+	uint32_t hash = 5381U;
+
+	while (*name != '\0') {
+		hash = (hash * 33U) + (uint8_t)*name++;
+	}
+
+	return hash;
+}
+
+static void device_name_index_build(void)
+{
+	const struct device *dev;
+
+	if (device_name_index_ready) {
+		return;
+	}
+
+	for (dev = __device_start; dev != __device_end; dev++) {
+		uint32_t pos = device_name_index_hash(dev->name) &
+			       (CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE - 1);
+		int i;
+
+		for (i = 0; i < CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE; i++) {
+			if (device_name_index[pos] == NULL) {
+				device_name_index[pos] = dev;
+				break;
+			}
+			pos = (pos + 1) &
+			      (CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE - 1);
+		}
+
+		if (i == CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE) {
+			/* more devices than slots: fall back to scanning */
+			device_name_index_overflow = true;
+			break;
+		}
+	}
+
+	device_name_index_ready = true;
+}
+
+static const struct device *device_name_index_lookup(const char *name)
+{
+	uint32_t pos = device_name_index_hash(name) &
+		       (CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE - 1);
+
+	for (int i = 0; i < CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE; i++) {
+		const struct device *dev = device_name_index[pos];
+
+		if (dev == NULL) {
+			break;
+		}
+
+		if ((dev->name == name) || (strcmp(name, dev->name) == 0)) {
+			return z_device_ready(dev) ? dev : NULL;
+		}
+
+		pos = (pos + 1) & (CONFIG_DEVICE_NAME_LOOKUP_INDEX_SIZE - 1);
+	}
+
+	return NULL;
+}
+
+#endif /* CONFIG_DEVICE_NAME_LOOKUP_INDEX */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -42,6 +128,164 @@ extern uint32_t __device_busy_end[];
  *
  * @param level init level to run.
  */
+#ifdef CONFIG_BOOT_TIMING
+
+static struct boot_timing_entry boot_timings[CONFIG_BOOT_TIMING_MAX_ENTRIES];
+static atomic_t boot_timing_num;
+static uint8_t boot_timing_level;
+
+size_t boot_timing_count(void)
+{
+	return MIN((size_t)atomic_get(&boot_timing_num),
+		   ARRAY_SIZE(boot_timings));
+}
+
+const struct boot_timing_entry *boot_timing_get(size_t index)
+{
+	if (index >= boot_timing_count()) {
+		return NULL;
+	}
+
+	return &boot_timings[index];
+}
+
+size_t boot_timing_dump(uint8_t *buf, size_t buf_size)
+{
+	size_t count = boot_timing_count();
+	size_t off = 12;
+	uint32_t written = 0;
+
+	if (buf_size < off) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const struct boot_timing_entry *rec = &boot_timings[i];
+		size_t name_len = strlen(rec->name) + 1;
+
+		if ((buf_size - off) < (9 + name_len)) {
+			break;
+		}
+
+		buf[off] = rec->level;
+		sys_put_le32(rec->start_cycles, &buf[off + 1]);
+		sys_put_le32(rec->duration_cycles, &buf[off + 5]);
+		memcpy(&buf[off + 9], rec->name, name_len);
+		off += 9 + name_len;
+		written++;
+	}
+
+	buf[0] = 0x42; /* 'B' */
+	buf[1] = 0x54; /* 'T' */
+	buf[2] = 1;    /* format version */
+	buf[3] = 0;
+	sys_put_le32(sys_clock_hw_cycles_per_sec(), &buf[4]);
+	sys_put_le32(written, &buf[8]);
+
+	return off;
+}
+
+#endif /* CONFIG_BOOT_TIMING */
+
+static void run_init_entry(const struct init_entry *entry)
+{
+	const struct device *dev = entry->dev;
+#ifdef CONFIG_BOOT_TIMING
+	struct boot_timing_entry *rec = NULL;
+	atomic_val_t slot = atomic_inc(&boot_timing_num);
+	uint32_t start = 0;
+
+	if (slot < (atomic_val_t)ARRAY_SIZE(boot_timings)) {
+		rec = &boot_timings[slot];
+		rec->name = (dev != NULL) ? dev->name : entry->name;
+		rec->level = boot_timing_level;
+		start = k_cycle_get_32();
+		rec->start_cycles = start;
+	}
+#endif
+
+	if (dev != NULL) {
+		z_object_init(dev);
+	}
+
+	if ((entry->init(dev) != 0) && (dev != NULL)) {
+		/* Initialization failed.
+		 * Set the init status bit so device is not declared ready.
+		 */
+		sys_bitfield_set_bit(
+			(mem_addr_t) __device_init_status_start,
+			(dev - __device_start));
+	}
+
+#ifdef CONFIG_BOOT_TIMING
+	if (rec != NULL) {
+		rec->duration_cycles = k_cycle_get_32() - start;
+	}
+#endif
+}
+
+#ifdef CONFIG_PARALLEL_INIT
+
+static K_THREAD_STACK_ARRAY_DEFINE(parallel_init_stacks,
+				   CONFIG_PARALLEL_INIT_NUM_THREADS - 1,
+				   CONFIG_PARALLEL_INIT_STACK_SIZE);
+static struct k_thread parallel_init_threads[
+				   CONFIG_PARALLEL_INIT_NUM_THREADS - 1];
+static atomic_t parallel_init_next;
+static K_SEM_DEFINE(parallel_init_done, 0,
+		    CONFIG_PARALLEL_INIT_NUM_THREADS - 1);
+
+static void parallel_init_worker(void *group, void *count, void *unused)
+{
+	const struct init_entry *entries = group;
+	atomic_val_t idx;
+
+	ARG_UNUSED(unused);
+
+	while ((idx = atomic_inc(&parallel_init_next)) <
+	       (atomic_val_t)(uintptr_t)count) {
+		run_init_entry(&entries[idx]);
+	}
+
+	k_sem_give(&parallel_init_done);
+}
+
+/* Run one group of init entries sharing a priority. The main thread
+ * takes part itself and spins up extra init threads at its own
+ * priority, so whenever one init function blocks in an internal delay
+ * another entry of the group makes progress.
+ */
+static void parallel_init_run_group(const struct init_entry *group,
+				    size_t count)
+{
+	int workers = MIN(count, CONFIG_PARALLEL_INIT_NUM_THREADS) - 1;
+	atomic_val_t idx;
+	int i;
+
+	atomic_clear(&parallel_init_next);
+
+	for (i = 0; i < workers; i++) {
+		k_thread_create(&parallel_init_threads[i],
+				parallel_init_stacks[i],
+				CONFIG_PARALLEL_INIT_STACK_SIZE,
+				parallel_init_worker,
+				(void *)group, (void *)count, NULL,
+				k_thread_priority_get(k_current_get()),
+				0, K_NO_WAIT);
+	}
+
+	while ((idx = atomic_inc(&parallel_init_next)) <
+	       (atomic_val_t)count) {
+		run_init_entry(&group[idx]);
+	}
+
+	for (i = 0; i < workers; i++) {
+		k_sem_take(&parallel_init_done, K_FOREVER);
+	}
+}
+
+#endif /* CONFIG_PARALLEL_INIT */
+
 void z_sys_init_run_level(int32_t level)
 {
 	static const struct init_entry *levels[] = {
@@ -57,21 +301,38 @@ void z_sys_init_run_level(int32_t level)
 	};
 	const struct init_entry *entry;
 
-	for (entry = levels[level]; entry < levels[level+1]; entry++) {
-		const struct device *dev = entry->dev;
+#ifdef CONFIG_DEVICE_NAME_LOOKUP_INDEX
+	device_name_index_build();
+#endif
 
-		if (dev != NULL) {
-			z_object_init(dev);
-		}
+#ifdef CONFIG_BOOT_TIMING
+	boot_timing_level = (uint8_t)level;
+#endif
+
+#ifdef CONFIG_PARALLEL_INIT
+	/* From POST_KERNEL on the scheduler is available: hand out the
+	 * entries of each priority to the init thread pool, with the
+	 * priority boundaries acting as barriers.
+	 */
+	if (level >= _SYS_INIT_LEVEL_POST_KERNEL) {
+		entry = levels[level];
+		while (entry < levels[level+1]) {
+			const struct init_entry *group = entry;
 
-		if ((entry->init(dev) != 0) && (dev != NULL)) {
-			/* Initialization failed.
-			 * Set the init status bit so device is not declared ready.
-			 */
-			sys_bitfield_set_bit(
-				(mem_addr_t) __device_init_status_start,
-				(dev - __device_start));
+			while (entry < levels[level+1] &&
+			       entry->prio == group->prio) {
+				entry++;
+			}
+
+			parallel_init_run_group(group, entry - group);
 		}
+
+		return;
+	}
+#endif
+
+	for (entry = levels[level]; entry < levels[level+1]; entry++) {
+		run_init_entry(entry);
 	}
 }
 
@@ -79,6 +340,12 @@ const struct device *z_impl_device_get_binding(const char *name)
 {
 	const struct device *dev;
 
+#ifdef CONFIG_DEVICE_NAME_LOOKUP_INDEX
+	if (device_name_index_ready && !device_name_index_overflow) {
+		return device_name_index_lookup(name);
+	}
+#endif
+
 	/* Split the search into two loops: in the common scenario, where
 	 * device names are stored in ROM (and are referenced by the user
 	 * with CONFIG_* macros), only cheap pointer comparisons will be
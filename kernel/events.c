@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief event kernel services
+ *
+ * An event object holds a 32-bit word of event bits.  Posters OR bits
+ * into the word (ISR-safe); waiters block until any or all bits of a
+ * mask are set, optionally consuming the matching bits on wakeup.
+ *
+ * Unlike k_poll, waiting on several sources costs no per-call
+ * registration and no per-source tracking structure: one word carries
+ * all of them.
+ */
+
+#include <kernel.h>
+#include <kernel_structs.h>
+#include <toolchain.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <syscall_handler.h>
+#include <debug/object_tracing_common.h>
+#include <tracing/tracing.h>
+
+static struct k_spinlock lock;
+
+/* Per-waiter wait descriptor, lives on the waiting thread's stack and
+ * is reached through the thread's swap_data while it is pended.
+ */
+struct event_waiter {
+	uint32_t mask;	/* Events the thread is waiting for */
+	uint32_t options; /* K_EVENT_WAIT_* flags */
+	uint32_t matched; /* Events that released the thread */
+};
+
+#ifdef CONFIG_OBJECT_TRACING
+
+struct k_event *_trace_list_k_event;
+
+/*
+ * Complete initialization of statically defined event objects.
+ */
+static int init_event_module(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	Z_STRUCT_SECTION_FOREACH(k_event, event) {
+		SYS_TRACING_OBJ_INIT(k_event, event);
+	}
+	return 0;
+}
+
+SYS_INIT(init_event_module, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+#endif /* CONFIG_OBJECT_TRACING */
+
+void z_impl_k_event_init(struct k_event *event)
+{
+	event->events = 0U;
+	z_waitq_init(&event->wait_q);
+
+	SYS_TRACING_OBJ_INIT(k_event, event);
+	z_object_init(event);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_event_init(struct k_event *event)
+{
+	Z_OOPS(Z_SYSCALL_OBJ_INIT(event, K_OBJ_EVENT));
+	z_impl_k_event_init(event);
+}
+#include <syscalls/k_event_init_mrsh.c>
+#endif
+
+static bool waiter_satisfied(uint32_t events, const struct event_waiter *w)
+{
+	uint32_t match = events & w->mask;
+
+	if ((w->options & K_EVENT_WAIT_ALL) != 0U) {
+		return match == w->mask;
+	}
+
+	return match != 0U;
+}
+
+static void event_post_internal(struct k_event *event, uint32_t events,
+				bool accumulate)
+{
+	struct k_thread *thread;
+	bool resched = false;
+	bool woke;
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	event->events = accumulate ? (event->events | events) : events;
+
+	/* Release satisfied waiters in wait queue (priority) order.  The
+	 * scan restarts after every wakeup, since both the queue and,
+	 * for consuming waiters, the event word have changed.
+	 */
+	do {
+		woke = false;
+		_WAIT_Q_FOR_EACH(&event->wait_q, thread) {
+			struct event_waiter *w =
+				(struct event_waiter *)thread->base.swap_data;
+
+			if (!waiter_satisfied(event->events, w)) {
+				continue;
+			}
+
+			w->matched = event->events & w->mask;
+			if ((w->options & K_EVENT_WAIT_CONSUME) != 0U) {
+				event->events &= ~w->matched;
+			}
+
+			z_unpend_thread(thread);
+			arch_thread_return_value_set(thread, 0);
+			z_ready_thread(thread);
+			resched = true;
+			woke = true;
+			break;
+		}
+	} while (woke);
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+}
+
+void z_impl_k_event_post(struct k_event *event, uint32_t events)
+{
+	event_post_internal(event, events, true);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_event_post(struct k_event *event, uint32_t events)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(event, K_OBJ_EVENT));
+	z_impl_k_event_post(event, events);
+}
+#include <syscalls/k_event_post_mrsh.c>
+#endif
+
+void z_impl_k_event_set(struct k_event *event, uint32_t events)
+{
+	event_post_internal(event, events, false);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_event_set(struct k_event *event, uint32_t events)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(event, K_OBJ_EVENT));
+	z_impl_k_event_set(event, events);
+}
+#include <syscalls/k_event_set_mrsh.c>
+#endif
+
+uint32_t z_impl_k_event_wait(struct k_event *event, uint32_t events,
+			     uint32_t options, k_timeout_t timeout)
+{
+	struct event_waiter w;
+	uint32_t matched;
+	k_spinlock_key_t key;
+
+	__ASSERT(((options &
+		   ~(K_EVENT_WAIT_ALL | K_EVENT_WAIT_CONSUME)) == 0U),
+		 "invalid wait options");
+
+	w.mask = events;
+	w.options = options;
+
+	key = k_spin_lock(&lock);
+
+	if (waiter_satisfied(event->events, &w)) {
+		matched = event->events & events;
+		if ((options & K_EVENT_WAIT_CONSUME) != 0U) {
+			event->events &= ~matched;
+		}
+		k_spin_unlock(&lock, key);
+
+		return matched;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&lock, key);
+
+		return 0U;
+	}
+
+	__ASSERT(!arch_is_in_isr(),
+		 "ISRs may only wait on events with K_NO_WAIT");
+
+	w.matched = 0U;
+	_current->base.swap_data = &w;
+
+	if (z_pend_curr(&lock, key, &event->wait_q, timeout) == 0) {
+		return w.matched;
+	}
+
+	/* timed out */
+	return 0U;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline uint32_t z_vrfy_k_event_wait(struct k_event *event,
+					   uint32_t events, uint32_t options,
+					   k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(event, K_OBJ_EVENT));
+	return z_impl_k_event_wait(event, events, options, timeout);
+}
+#include <syscalls/k_event_wait_mrsh.c>
+#endif
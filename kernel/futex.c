@@ -11,6 +11,7 @@
 #include <syscall_handler.h>
 #include <init.h>
 #include <ksched.h>
+#include <wait_q.h>
 
 static struct z_futex_data *k_futex_find_data(struct k_futex *futex)
 {
@@ -62,6 +63,83 @@ static inline int z_vrfy_k_futex_wake(struct k_futex *futex, bool wake_all)
 }
 #include <syscalls/k_futex_wake_mrsh.c>
 
+int z_impl_k_futex_requeue(struct k_futex *futex, int expected,
+			   struct k_futex *target, unsigned int wake_count)
+{
+	k_spinlock_key_t key, target_key;
+	unsigned int woken = 0;
+	unsigned int requeued = 0;
+	struct k_thread *thread;
+	struct z_futex_data *futex_data;
+	struct z_futex_data *target_data;
+	struct k_spinlock *first_lock, *second_lock;
+
+	futex_data = k_futex_find_data(futex);
+	target_data = k_futex_find_data(target);
+	if (futex_data == NULL || target_data == NULL ||
+	    futex_data == target_data) {
+		return -EINVAL;
+	}
+
+	/* Both wait queues are manipulated while holding both futex locks.
+	 * Take them in address order so that two concurrent requeues in
+	 * opposite directions cannot deadlock.
+	 */
+	if (futex_data < target_data) {
+		first_lock = &futex_data->lock;
+		second_lock = &target_data->lock;
+	} else {
+		first_lock = &target_data->lock;
+		second_lock = &futex_data->lock;
+	}
+
+	key = k_spin_lock(first_lock);
+	target_key = k_spin_lock(second_lock);
+
+	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		k_spin_unlock(second_lock, target_key);
+		k_spin_unlock(first_lock, key);
+		return -EAGAIN;
+	}
+
+	while (woken < wake_count) {
+		thread = z_unpend_first_thread(&futex_data->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+		z_ready_thread(thread);
+		arch_thread_return_value_set(thread, 0);
+		woken++;
+	}
+
+	/* Move the remaining waiters without waking them. A requeued
+	 * thread keeps any armed timeout; if it expires the thread is
+	 * removed from the target wait queue like any other waiter.
+	 */
+	while ((thread = z_waitq_head(&futex_data->wait_q)) != NULL) {
+		z_requeue_thread(thread, &target_data->wait_q);
+		requeued++;
+	}
+
+	k_spin_unlock(second_lock, target_key);
+	z_reschedule(first_lock, key);
+
+	return woken + requeued;
+}
+
+static inline int z_vrfy_k_futex_requeue(struct k_futex *futex, int expected,
+					 struct k_futex *target,
+					 unsigned int wake_count)
+{
+	if (Z_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0 ||
+	    Z_SYSCALL_MEMORY_WRITE(target, sizeof(struct k_futex)) != 0) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_requeue(futex, expected, target, wake_count);
+}
+#include <syscalls/k_futex_requeue_mrsh.c>
+
 int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 			k_timeout_t timeout)
 {
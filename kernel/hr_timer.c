@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <spinlock.h>
+#include <hr_timer.h>
+#include <drivers/timer/system_timer.h>
+
+/*
+ * High-resolution timer core.  Pending timers are kept in a dlist
+ * sorted by absolute expiration cycle; the head deadline is handed to
+ * the timer driver's comparator via z_clock_hr_set().  All cycle
+ * comparisons are done with signed 32-bit differences so counter
+ * wraparound is handled as long as deadlines stay within half the
+ * wrap interval, mirroring the tick-based timeout code.
+ */
+
+static struct k_spinlock lock;
+static sys_dlist_t pending = SYS_DLIST_STATIC_INIT(&pending);
+
+static inline struct k_hr_timer *hrt(sys_dnode_t *node)
+{
+	return CONTAINER_OF(node, struct k_hr_timer, node);
+}
+
+/* Program the driver for the current head timer; lock must be held */
+static void program_head(void)
+{
+	sys_dnode_t *node = sys_dlist_peek_head(&pending);
+
+	if (node == NULL) {
+		z_clock_hr_cancel();
+	} else {
+		z_clock_hr_set(hrt(node)->expiry);
+	}
+}
+
+void z_clock_hr_expired(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (;;) {
+		sys_dnode_t *node = sys_dlist_peek_head(&pending);
+		struct k_hr_timer *timer;
+
+		if (node == NULL) {
+			break;
+		}
+
+		timer = hrt(node);
+		if ((int32_t)(timer->expiry - k_cycle_get_32()) > 0) {
+			/* The driver fired early (e.g. comparator span
+			 * exceeded); re-arming below covers the rest.
+			 */
+			break;
+		}
+
+		sys_dlist_remove(node);
+
+		/* Expiry functions may restart or stop timers */
+		k_spin_unlock(&lock, key);
+		timer->expiry_fn(timer);
+		key = k_spin_lock(&lock);
+	}
+
+	program_head();
+	k_spin_unlock(&lock, key);
+}
+
+void k_hr_timer_init(struct k_hr_timer *timer, k_hr_timer_expiry_t expiry_fn)
+{
+	timer->expiry_fn = expiry_fn;
+	timer->user_data = NULL;
+	sys_dnode_init(&timer->node);
+}
+
+void k_hr_timer_start(struct k_hr_timer *timer, uint32_t delay_cycles)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	sys_dnode_t *pos = NULL, *node;
+
+	if (sys_dnode_is_linked(&timer->node)) {
+		sys_dlist_remove(&timer->node);
+	}
+
+	timer->expiry = k_cycle_get_32() + delay_cycles;
+
+	SYS_DLIST_FOR_EACH_NODE(&pending, node) {
+		if ((int32_t)(hrt(node)->expiry - timer->expiry) > 0) {
+			pos = node;
+			break;
+		}
+	}
+
+	if (pos != NULL) {
+		sys_dlist_insert(pos, &timer->node);
+	} else {
+		sys_dlist_append(&pending, &timer->node);
+	}
+
+	if (sys_dlist_peek_head(&pending) == &timer->node) {
+		program_head();
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+bool k_hr_timer_stop(struct k_hr_timer *timer)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	bool was_pending = sys_dnode_is_linked(&timer->node);
+
+	if (was_pending) {
+		bool was_head =
+			(sys_dlist_peek_head(&pending) == &timer->node);
+
+		sys_dlist_remove(&timer->node);
+		if (was_head) {
+			program_head();
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+	return was_pending;
+}
+
+uint32_t k_hr_timer_remaining_get(struct k_hr_timer *timer)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t remaining = 0U;
+
+	if (sys_dnode_is_linked(&timer->node)) {
+		int32_t diff = (int32_t)(timer->expiry - k_cycle_get_32());
+
+		remaining = (diff > 0) ? (uint32_t)diff : 0U;
+	}
+
+	k_spin_unlock(&lock, key);
+	return remaining;
+}
@@ -72,6 +72,12 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 		k_spin_release(lock);
 	}
 
+	/* Flush reschedule IPIs flagged while the caller's lock was
+	 * held, so a burst of wakeups costs each destination CPU at
+	 * most one interrupt.
+	 */
+	z_signal_pending_ipi();
+
 #ifdef CONFIG_SMP
 	/* Null out the switch handle, see wait_for_switch() above.
 	 * Note that we set it back to a non-null value if we are not
@@ -103,6 +109,10 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 		new_thread->base.cpu = arch_curr_cpu()->id;
 
+#ifdef CONFIG_SCHED_SOFT_AFFINITY
+		old_thread->base.run_end_cycle = k_cycle_get_32();
+#endif
+
 		if (!is_spinlock) {
 			z_smp_release_global_lock(new_thread);
 		}
@@ -9,10 +9,132 @@
 #include <wait_q.h>
 #include <init.h>
 
+#ifdef CONFIG_KHEAP_PERCPU_CACHE
+#define CACHE_CLASS_BYTES(cls) ((size_t)(K_HEAP_CACHE_MIN_BYTES << (cls)))
+#define CACHE_BATCH (CONFIG_KHEAP_PERCPU_CACHE_DEPTH / 2)
+
+/* Smallest size class able to satisfy a request, or -1 when the
+ * request is too big (or zero) and must go to the shared heap.
+ */
+static inline int alloc_class(size_t bytes)
+{
+	if (bytes == 0U) {
+		return -1;
+	}
+
+	for (int i = 0; i < K_HEAP_CACHE_NUM_CLASSES; i++) {
+		if (bytes <= CACHE_CLASS_BYTES(i)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/* Size class a freed block may be cached under, based on its usable
+ * size, or -1 when it should go back to the shared heap.  Oversized
+ * blocks are excluded so no class hoards more than twice the memory
+ * its size implies.
+ */
+static inline int free_class(size_t usable)
+{
+	for (int i = K_HEAP_CACHE_NUM_CLASSES - 1; i >= 0; i--) {
+		if ((usable >= CACHE_CLASS_BYTES(i)) &&
+		    (usable < 2U * CACHE_CLASS_BYTES(i))) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/* Pop a block from the current CPU's bin.  Interrupts are locked only
+ * locally: each bin is private to its CPU, so the heap lock is not
+ * needed.
+ */
+static void *cache_alloc(struct k_heap *h, int cls)
+{
+	unsigned int key = arch_irq_lock();
+	int cpu = _current_cpu->id;
+	void *mem = h->cache[cpu].head[cls];
+
+	if (mem != NULL) {
+		h->cache[cpu].head[cls] = *(void **)mem;
+		h->cache[cpu].count[cls]--;
+	}
+	arch_irq_unlock(key);
+
+	return mem;
+}
+
+/* Push a block onto the current CPU's bin, failing when it is full. */
+static bool cache_free(struct k_heap *h, int cls, void *mem)
+{
+	unsigned int key = arch_irq_lock();
+	int cpu = _current_cpu->id;
+	bool hit = false;
+
+	if (h->cache[cpu].count[cls] < CONFIG_KHEAP_PERCPU_CACHE_DEPTH) {
+		*(void **)mem = h->cache[cpu].head[cls];
+		h->cache[cpu].head[cls] = mem;
+		h->cache[cpu].count[cls]++;
+		hit = true;
+	}
+	arch_irq_unlock(key);
+
+	return hit;
+}
+
+/* Pull a batch of blocks from the shared heap into the current CPU's
+ * bin.  Must be called with the heap lock held; interrupts are then
+ * locked, so the bin can be accessed directly.
+ */
+static void cache_refill(struct k_heap *h, int cls)
+{
+	int cpu = _current_cpu->id;
+
+	while (h->cache[cpu].count[cls] < CACHE_BATCH) {
+		void *mem = sys_heap_alloc(&h->heap, CACHE_CLASS_BYTES(cls));
+
+		if (mem == NULL) {
+			break;
+		}
+		*(void **)mem = h->cache[cpu].head[cls];
+		h->cache[cpu].head[cls] = mem;
+		h->cache[cpu].count[cls]++;
+	}
+}
+
+/* Return the current CPU's bin surplus to the shared heap.  Must be
+ * called with the heap lock held.
+ */
+static void cache_drain(struct k_heap *h, int cls)
+{
+	int cpu = _current_cpu->id;
+
+	while (h->cache[cpu].count[cls] > CACHE_BATCH) {
+		void *mem = h->cache[cpu].head[cls];
+
+		h->cache[cpu].head[cls] = *(void **)mem;
+		h->cache[cpu].count[cls]--;
+		sys_heap_free(&h->heap, mem);
+	}
+}
+#endif /* CONFIG_KHEAP_PERCPU_CACHE */
+
 void k_heap_init(struct k_heap *h, void *mem, size_t bytes)
 {
 	z_waitq_init(&h->wait_q);
 	sys_heap_init(&h->heap, mem, bytes);
+
+#ifdef CONFIG_KHEAP_PERCPU_CACHE
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		for (int j = 0; j < K_HEAP_CACHE_NUM_CLASSES; j++) {
+			h->cache[i].head[j] = NULL;
+			h->cache[i].count[j] = 0U;
+		}
+	}
+#endif
 }
 
 static int statics_init(const struct device *unused)
@@ -30,13 +152,37 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 {
 	int64_t now, end = z_timeout_end_calc(timeout);
 	void *ret = NULL;
-	k_spinlock_key_t key = k_spin_lock(&h->lock);
+	k_spinlock_key_t key;
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+#ifdef CONFIG_KHEAP_PERCPU_CACHE
+	int cls = alloc_class(bytes);
+
+	if (cls >= 0) {
+		ret = cache_alloc(h, cls);
+		if (ret != NULL) {
+			return ret;
+		}
+
+		/* Round up so the block lands back in the same class
+		 * when freed.
+		 */
+		bytes = CACHE_CLASS_BYTES(cls);
+	}
+#endif
+
+	key = k_spin_lock(&h->lock);
+
 	while (ret == NULL) {
 		ret = sys_heap_alloc(&h->heap, bytes);
 
+#ifdef CONFIG_KHEAP_PERCPU_CACHE
+		if ((ret != NULL) && (cls >= 0)) {
+			cache_refill(h, cls);
+		}
+#endif
+
 		now = z_tick_get();
 		if ((ret != NULL) || ((end - now) <= 0)) {
 			break;
@@ -53,10 +199,37 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 
 void k_heap_free(struct k_heap *h, void *mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&h->lock);
+	k_spinlock_key_t key;
+
+#ifdef CONFIG_KHEAP_PERCPU_CACHE
+	int cls = -1;
+
+	if (mem != NULL) {
+		cls = free_class(sys_heap_usable_size(&h->heap, mem));
+
+		/* Fast path: stash the block in the local bin when
+		 * nobody is waiting.  The unlocked wait queue peek can
+		 * race with a thread starting to pend on another CPU;
+		 * such a thread is served by the next free instead
+		 * (see the Kconfig help).
+		 */
+		if ((cls >= 0) && (z_waitq_head(&h->wait_q) == NULL) &&
+		    cache_free(h, cls, mem)) {
+			return;
+		}
+	}
+#endif
+
+	key = k_spin_lock(&h->lock);
 
 	sys_heap_free(&h->heap, mem);
 
+#ifdef CONFIG_KHEAP_PERCPU_CACHE
+	if (cls >= 0) {
+		cache_drain(h, cls);
+	}
+#endif
+
 	if (z_unpend_all(&h->wait_q) != 0) {
 		z_reschedule(&h->lock, key);
 	} else {
@@ -20,6 +20,22 @@ LOG_MODULE_DECLARE(os);
 static struct k_spinlock lock;
 static uint8_t max_partitions;
 
+#ifdef CONFIG_ARCH_MEM_DOMAIN_GENERATION
+/* Monotonic source for domain generation values. Drawing from a global
+ * counter guarantees a (domain, generation) pair is never reused, even
+ * if a domain object is destroyed and another created at the same
+ * address. Must be called with the lock held.
+ */
+static uint32_t domain_generation;
+
+static void update_generation(struct k_mem_domain *domain)
+{
+	domain->generation = ++domain_generation;
+}
+#else
+#define update_generation(domain) do { } while (false)
+#endif /* CONFIG_ARCH_MEM_DOMAIN_GENERATION */
+
 struct k_mem_domain k_mem_domain_default;
 
 #if __ASSERT_ON
@@ -118,6 +134,8 @@ void k_mem_domain_init(struct k_mem_domain *domain, uint8_t num_parts,
 		}
 	}
 
+	update_generation(domain);
+
 	sys_dlist_init(&domain->mem_domain_q);
 
 #ifdef CONFIG_ARCH_MEM_DOMAIN_DATA
@@ -191,6 +209,7 @@ void k_mem_domain_add_partition(struct k_mem_domain *domain,
 	domain->partitions[p_idx].attr = part->attr;
 
 	domain->num_partitions++;
+	update_generation(domain);
 
 #ifdef CONFIG_ARCH_MEM_DOMAIN_SYNCHRONOUS_API
 	arch_mem_domain_partition_add(domain, p_idx);
@@ -230,6 +249,7 @@ void k_mem_domain_remove_partition(struct k_mem_domain *domain,
 	domain->partitions[p_idx].size = 0U;
 
 	domain->num_partitions--;
+	update_generation(domain);
 
 	k_spin_unlock(&lock, key);
 }
@@ -21,6 +21,121 @@ static struct k_spinlock lock;
 struct k_mem_slab *_trace_list_k_mem_slab;
 #endif	/* CONFIG_OBJECT_TRACING */
 
+#ifdef CONFIG_MEM_SLAB_STATS
+/* Record a successful allocation.  Must be called with the slab lock
+ * held; @a owner is the thread the block is attributed to.
+ */
+static void slab_stats_alloc(struct k_mem_slab *slab, void *mem,
+			     struct k_thread *owner)
+{
+	slab->alloc_count++;
+	if (slab->num_used > slab->max_used) {
+		slab->max_used = slab->num_used;
+	}
+	if (slab->owners != NULL) {
+		uint32_t idx = ((char *)mem - slab->buffer) / slab->block_size;
+
+		slab->owners[idx] = owner;
+	}
+}
+
+/* Record a free.  Must be called with the slab lock held. */
+static void slab_stats_free(struct k_mem_slab *slab, void *mem)
+{
+	slab->free_count++;
+	if (slab->owners != NULL) {
+		uint32_t idx = ((char *)mem - slab->buffer) / slab->block_size;
+
+		slab->owners[idx] = NULL;
+	}
+}
+
+/* Record a failed allocation and where it came from. */
+static void slab_stats_fail(struct k_mem_slab *slab, void *caller)
+{
+	slab->fail_count++;
+	slab->last_fail_caller = caller;
+}
+#endif /* CONFIG_MEM_SLAB_STATS */
+
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+/* Number of blocks moved between a per-CPU cache and the shared free
+ * list at a time.
+ */
+#define CACHE_BATCH (CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE / 2)
+
+/* Try to pop a block from the current CPU's cache.  Interrupts are
+ * locked only locally: each cache is private to its CPU, so the shared
+ * slab lock is not needed.
+ */
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	unsigned int key = arch_irq_lock();
+	int cpu = _current_cpu->id;
+	bool hit = false;
+
+	if (slab->cache[cpu].count > 0U) {
+		*mem = slab->cache[cpu].blocks[--slab->cache[cpu].count];
+		hit = true;
+	}
+	arch_irq_unlock(key);
+
+	return hit;
+}
+
+/* Try to push a block onto the current CPU's cache, failing when the
+ * cache is full.
+ */
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int key = arch_irq_lock();
+	int cpu = _current_cpu->id;
+	bool hit = false;
+
+	if (slab->cache[cpu].count < CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE) {
+		slab->cache[cpu].blocks[slab->cache[cpu].count++] = mem;
+		hit = true;
+	}
+	arch_irq_unlock(key);
+
+	return hit;
+}
+
+/* Move a batch of blocks from the shared free list into the current
+ * CPU's cache.  Must be called with the slab lock held; interrupts are
+ * then locked, so the cache can be accessed directly.  Cached blocks
+ * are accounted as in use.
+ */
+static void cache_refill(struct k_mem_slab *slab)
+{
+	int cpu = _current_cpu->id;
+
+	while ((slab->cache[cpu].count < CACHE_BATCH) &&
+	       (slab->free_list != NULL)) {
+		slab->cache[cpu].blocks[slab->cache[cpu].count++] =
+			slab->free_list;
+		slab->free_list = *(char **)slab->free_list;
+		slab->num_used++;
+	}
+}
+
+/* Return the current CPU's cache surplus to the shared free list.
+ * Must be called with the slab lock held.
+ */
+static void cache_drain(struct k_mem_slab *slab)
+{
+	int cpu = _current_cpu->id;
+
+	while (slab->cache[cpu].count > CACHE_BATCH) {
+		char *block = slab->cache[cpu].blocks[--slab->cache[cpu].count];
+
+		*(char **)block = slab->free_list;
+		slab->free_list = block;
+		slab->num_used--;
+	}
+}
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -43,6 +158,12 @@ static int create_free_list(struct k_mem_slab *slab)
 	slab->free_list = NULL;
 	p = slab->buffer;
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	for (j = 0U; j < CONFIG_MP_NUM_CPUS; j++) {
+		slab->cache[j].count = 0U;
+	}
+#endif
+
 	for (j = 0U; j < slab->num_blocks; j++) {
 		*(char **)p = slab->free_list;
 		slab->free_list = p;
@@ -88,6 +209,15 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->block_size = block_size;
 	slab->buffer = buffer;
 	slab->num_used = 0U;
+#ifdef CONFIG_MEM_SLAB_STATS
+	slab->max_used = 0U;
+	slab->alloc_count = 0U;
+	slab->free_count = 0U;
+	slab->fail_count = 0U;
+	slab->last_fail_caller = NULL;
+	/* no space for owner tracking on runtime-initialized slabs */
+	slab->owners = NULL;
+#endif
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -103,18 +233,35 @@ out:
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		return 0;
+	}
+#endif
+
+	key = k_spin_lock(&lock);
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
 		slab->num_used++;
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+		cache_refill(slab);
+#endif
+#ifdef CONFIG_MEM_SLAB_STATS
+		slab_stats_alloc(slab, *mem, _current);
+#endif
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		/* don't wait for a free block to become available */
 		*mem = NULL;
+#ifdef CONFIG_MEM_SLAB_STATS
+		slab_stats_fail(slab, __builtin_return_address(0));
+#endif
 		result = -ENOMEM;
 	} else {
 		/* wait for a free block or timeout */
@@ -122,6 +269,13 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 		if (result == 0) {
 			*mem = _current->base.swap_data;
 		}
+#ifdef CONFIG_MEM_SLAB_STATS
+		key = k_spin_lock(&lock);
+		if (result != 0) {
+			slab_stats_fail(slab, __builtin_return_address(0));
+		}
+		k_spin_unlock(&lock, key);
+#endif
 		return result;
 	}
 
@@ -132,10 +286,29 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
-	struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+	k_spinlock_key_t key;
+	struct k_thread *pending_thread;
+
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	/* Fast path: stash the block in the local cache when nobody is
+	 * waiting.  The unlocked wait queue peek can race with a thread
+	 * starting to pend on another CPU; such a thread is served by
+	 * the next free instead (see the Kconfig help).
+	 */
+	if ((z_waitq_head(&slab->wait_q) == NULL) && cache_free(slab, *mem)) {
+		return;
+	}
+#endif
+
+	key = k_spin_lock(&lock);
+	pending_thread = z_unpend_first_thread(&slab->wait_q);
 
 	if (pending_thread != NULL) {
+#ifdef CONFIG_MEM_SLAB_STATS
+		/* the block changes hands without touching the free list */
+		slab_stats_free(slab, *mem);
+		slab_stats_alloc(slab, *mem, pending_thread);
+#endif
 		z_thread_return_value_set_with_data(pending_thread, 0, *mem);
 		z_ready_thread(pending_thread);
 		z_reschedule(&lock, key);
@@ -143,6 +316,12 @@ void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 		**(char ***)mem = slab->free_list;
 		slab->free_list = *(char **)mem;
 		slab->num_used--;
+#ifdef CONFIG_MEM_SLAB_STATS
+		slab_stats_free(slab, *mem);
+#endif
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+		cache_drain(slab);
+#endif
 		k_spin_unlock(&lock, key);
 	}
 }
@@ -56,6 +56,8 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->read_ptr = buffer;
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
+	msgq->put_claims = 0;
+	msgq->get_claims = 0;
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
@@ -113,6 +115,13 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 }
 
 
+/* Ring slots held by unfinished claims still count against capacity */
+static inline bool msgq_full(struct k_msgq *msgq)
+{
+	return (msgq->used_msgs + msgq->put_claims + msgq->get_claims) >=
+	       msgq->max_msgs;
+}
+
 int z_impl_k_msgq_put(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 {
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
@@ -123,7 +132,7 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	key = k_spin_lock(&msgq->lock);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+	if (!msgq_full(msgq)) {
 		/* message queue isn't full */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
 		if (pending_thread != NULL) {
@@ -285,6 +294,113 @@ static inline int z_vrfy_k_msgq_peek(struct k_msgq *q, void *data)
 #include <syscalls/k_msgq_peek_mrsh.c>
 #endif
 
+int k_msgq_put_claim(struct k_msgq *msgq, void **data)
+{
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (!msgq_full(msgq)) {
+		*data = msgq->write_ptr;
+		msgq->write_ptr += msgq->msg_size;
+		if (msgq->write_ptr == msgq->buffer_end) {
+			msgq->write_ptr = msgq->buffer_start;
+		}
+		msgq->put_claims++;
+		result = 0;
+	} else {
+		result = -ENOMSG;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_put_finish(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq->put_claims == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->put_claims--;
+	msgq->used_msgs++;
+
+	/* Claim-mode producers never pend (see k_msgq_put_claim()
+	 * docs), so anybody on the wait queue is a reader: hand it
+	 * the freshly published message.
+	 */
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (pending_thread != NULL) {
+		(void)memcpy(pending_thread->base.swap_data, msgq->read_ptr,
+			     msgq->msg_size);
+		msgq->read_ptr += msgq->msg_size;
+		if (msgq->read_ptr == msgq->buffer_end) {
+			msgq->read_ptr = msgq->buffer_start;
+		}
+		msgq->used_msgs--;
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		z_reschedule(&msgq->lock, key);
+		return 0;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
+int k_msgq_get_claim(struct k_msgq *msgq, void **data)
+{
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq->used_msgs > 0U) {
+		*data = msgq->read_ptr;
+		msgq->read_ptr += msgq->msg_size;
+		if (msgq->read_ptr == msgq->buffer_end) {
+			msgq->read_ptr = msgq->buffer_start;
+		}
+		msgq->used_msgs--;
+		msgq->get_claims++;
+		result = 0;
+	} else {
+		result = -ENOMSG;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_get_finish(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq->get_claims > 0U) {
+		msgq->get_claims--;
+		result = 0;
+	} else {
+		result = -EINVAL;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
 void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
@@ -299,6 +415,8 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	}
 
 	msgq->used_msgs = 0;
+	msgq->put_claims = 0;
+	msgq->get_claims = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
 	z_reschedule(&msgq->lock, key);
@@ -116,6 +116,28 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* True when the mutex owner is executing right now on some other CPU,
+ * i.e. when there is a good chance the mutex gets released in less
+ * time than the two context switches a pend/unpend cycle costs.
+ */
+static bool owner_running(struct k_mutex *mutex)
+{
+	struct k_thread *owner = mutex->owner;
+
+	if (owner == NULL) {
+		return false;
+	}
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (_kernel.cpus[i].current == owner) {
+			return i != _current_cpu->id;
+		}
+	}
+	return false;
+}
+#endif
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -127,6 +149,24 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 	sys_trace_mutex_lock(mutex);
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	/* Contended, but the owner is live on another CPU: spin a
+	 * bounded number of iterations waiting for it to release the
+	 * mutex, dropping the spinlock on each pass so the owner's
+	 * k_mutex_unlock() can get in.  On success we fall into the
+	 * uncontended fast path below.
+	 */
+	for (uint32_t spins = CONFIG_MUTEX_ADAPTIVE_SPIN_MAX_ITER;
+	     spins > 0 && mutex->lock_count != 0U &&
+	     mutex->owner != _current &&
+	     !K_TIMEOUT_EQ(timeout, K_NO_WAIT) && owner_running(mutex);
+	     spins--) {
+		k_spin_unlock(&lock, key);
+		arch_nop();
+		key = k_spin_lock(&lock);
+	}
+#endif
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
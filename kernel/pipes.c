@@ -133,6 +133,10 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0;
 	pipe->read_index = 0;
 	pipe->write_index = 0;
+	pipe->write_claim_index = 0;
+	pipe->write_claim_bytes = 0;
+	pipe->read_claim_index = 0;
+	pipe->read_claim_bytes = 0;
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
@@ -877,3 +881,180 @@ size_t z_vrfy_k_pipe_write_avail(struct k_pipe *pipe)
 }
 #include <syscalls/k_pipe_write_avail_mrsh.c>
 #endif
+
+size_t k_pipe_write_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	k_spinlock_key_t key;
+	size_t free_bytes;
+	size_t run_length;
+	size_t num_bytes;
+
+	if (pipe->buffer == NULL || pipe->size == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	/* A fresh claim sequence starts at the current write position */
+	if (pipe->write_claim_bytes == 0U) {
+		pipe->write_claim_index = pipe->write_index;
+	}
+
+	free_bytes = pipe->size - pipe->bytes_used - pipe->write_claim_bytes;
+	run_length = MIN(free_bytes, pipe->size - pipe->write_claim_index);
+	num_bytes = MIN(size, run_length);
+
+	if (num_bytes > 0U) {
+		*data = pipe->buffer + pipe->write_claim_index;
+		pipe->write_claim_index += num_bytes;
+		if (pipe->write_claim_index == pipe->size) {
+			pipe->write_claim_index = 0;
+		}
+		pipe->write_claim_bytes += num_bytes;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return num_bytes;
+}
+
+int k_pipe_write_finish(struct k_pipe *pipe, size_t size)
+{
+	struct k_thread *reader;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (size > pipe->write_claim_bytes) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	/* Publish @a size bytes; the rest of the claim is dropped */
+	pipe->write_claim_bytes = 0;
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	/* Feed pended readers from the buffer (they drained it before
+	 * pending, so desc reflects what they still need) and ready
+	 * those whose request is now complete.
+	 */
+	while (pipe->bytes_used > 0U &&
+	       (reader = z_waitq_head(&pipe->wait_q.readers)) != NULL) {
+		struct k_pipe_desc *desc =
+			(struct k_pipe_desc *)reader->base.swap_data;
+		size_t num_bytes = pipe_buffer_get(pipe, desc->buffer,
+						   desc->bytes_to_xfer);
+
+		desc->buffer += num_bytes;
+		desc->bytes_to_xfer -= num_bytes;
+
+		if (desc->bytes_to_xfer != 0U) {
+			break;
+		}
+
+		z_unpend_thread(reader);
+		pipe_thread_ready(reader);
+		resched = true;
+	}
+
+	if (resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+size_t k_pipe_read_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	k_spinlock_key_t key;
+	size_t avail_bytes;
+	size_t run_length;
+	size_t num_bytes;
+
+	if (pipe->buffer == NULL || pipe->size == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	/* A fresh claim sequence starts at the current read position */
+	if (pipe->read_claim_bytes == 0U) {
+		pipe->read_claim_index = pipe->read_index;
+	}
+
+	avail_bytes = pipe->bytes_used - pipe->read_claim_bytes;
+	run_length = MIN(avail_bytes, pipe->size - pipe->read_claim_index);
+	num_bytes = MIN(size, run_length);
+
+	if (num_bytes > 0U) {
+		*data = pipe->buffer + pipe->read_claim_index;
+		pipe->read_claim_index += num_bytes;
+		if (pipe->read_claim_index == pipe->size) {
+			pipe->read_claim_index = 0;
+		}
+		pipe->read_claim_bytes += num_bytes;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return num_bytes;
+}
+
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size)
+{
+	struct k_thread *writer;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (size > pipe->read_claim_bytes) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	/* Consume @a size bytes; the rest of the claim is dropped */
+	pipe->read_claim_bytes = 0;
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+
+	/* Drain pended writers into the freed space and ready those
+	 * whose request is now complete.
+	 */
+	while (pipe->bytes_used < pipe->size &&
+	       (writer = z_waitq_head(&pipe->wait_q.writers)) != NULL) {
+		struct k_pipe_desc *desc =
+			(struct k_pipe_desc *)writer->base.swap_data;
+		size_t num_bytes = pipe_buffer_put(pipe, desc->buffer,
+						   desc->bytes_to_xfer);
+
+		desc->buffer += num_bytes;
+		desc->bytes_to_xfer -= num_bytes;
+
+		if (desc->bytes_to_xfer != 0U) {
+			break;
+		}
+
+		z_unpend_thread(writer);
+		pipe_thread_ready(writer);
+		resched = true;
+	}
+
+	if (resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
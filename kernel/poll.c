@@ -482,6 +482,131 @@ static inline void z_vrfy_k_poll_signal_reset(struct k_poll_signal *signal)
 
 #endif
 
+static int poll_set_poller_cb(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set,
+					      poller);
+	struct k_thread *thread;
+
+	ARG_UNUSED(state);
+
+	/* The event has already been removed from the object's wait list
+	 * by the signaling side; park it on the ready list until it is
+	 * harvested by k_poll_set_wait().
+	 */
+	sys_dlist_append(&set->ready_events, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	return 0;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	sys_dlist_init(&set->ready_events);
+	set->poller.is_polling = true;
+	set->poller.thread = NULL;
+	set->poller.cb = poll_set_poller_cb;
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_register(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key;
+	uint32_t state;
+
+	__ASSERT(event->poller == NULL, "event already in use\n");
+
+	key = k_spin_lock(&lock);
+	if (is_condition_met(event, &state)) {
+		event->state |= state;
+		sys_dlist_append(&set->ready_events, &event->_node);
+	} else {
+		(void)register_event(event, &set->poller);
+	}
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+void k_poll_set_unregister(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+	if (event->poller == &set->poller) {
+		clear_event_registration(event);
+	} else if (sys_dnode_is_linked(&event->_node)) {
+		/* Parked on the ready list */
+		sys_dlist_remove(&event->_node);
+	}
+	k_spin_unlock(&lock, key);
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int num_events, k_timeout_t timeout)
+{
+	struct k_poll_event *event;
+	k_spinlock_key_t key;
+	uint32_t state;
+	int n = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(events != NULL, "NULL events\n");
+	__ASSERT(num_events > 0, "no room for events\n");
+
+	key = k_spin_lock(&lock);
+
+	while (sys_dlist_is_empty(&set->ready_events)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		if (z_pend_curr(&lock, key, &set->wait_q, timeout) != 0) {
+			return -EAGAIN;
+		}
+
+		/* Another waiter may have harvested the event that woke
+		 * us, so recheck the ready list.
+		 */
+		key = k_spin_lock(&lock);
+	}
+
+	while (n < num_events) {
+		event = (struct k_poll_event *)
+			sys_dlist_get(&set->ready_events);
+		if (event == NULL) {
+			break;
+		}
+		events[n++] = event;
+	}
+
+	/* Re-arm the harvested events. An event whose condition is still
+	 * met (e.g. a semaphore given more than once while the event sat
+	 * on the ready list) goes straight back to the ready list so the
+	 * next wait reports it again; the others resume watching their
+	 * object.
+	 */
+	for (int i = 0; i < n; i++) {
+		event = events[i];
+		if (is_condition_met(event, &state)) {
+			event->state |= state;
+			sys_dlist_append(&set->ready_events, &event->_node);
+		} else {
+			(void)register_event(event, &set->poller);
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return n;
+}
+
 static void triggered_work_handler(struct k_work *work)
 {
 	k_work_handler_t handler;
@@ -81,6 +81,11 @@ void z_impl_k_queue_init(struct k_queue *queue)
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
 	z_waitq_init(&queue->wait_q);
+#ifdef CONFIG_QUEUE_MPSC
+	(void)atomic_ptr_set(&queue->mpsc_inbox, NULL);
+	(void)atomic_set(&queue->mpsc_waiter, 0);
+	queue->mpsc_mode = false;
+#endif
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
@@ -111,6 +116,143 @@ static inline void handle_poll_events(struct k_queue *queue, uint32_t state)
 #endif
 }
 
+#ifdef CONFIG_QUEUE_MPSC
+void k_queue_mpsc_init(struct k_queue *queue)
+{
+	z_impl_k_queue_init(queue);
+	queue->mpsc_mode = true;
+}
+
+/* Move all items producers have pushed to the inbox over to the
+ * consumer-local data_q, restoring push order. Only the (single)
+ * consumer calls this, so data_q needs no locking here.
+ */
+static void mpsc_drain(struct k_queue *queue)
+{
+	void *node = atomic_ptr_set(&queue->mpsc_inbox, NULL);
+	void *prev = NULL;
+
+	/* The inbox is a push-only stack, so the grabbed chain is in
+	 * reverse arrival order; reverse it in place.
+	 */
+	while (node != NULL) {
+		void *next = *(void **)node;
+
+		*(void **)node = prev;
+		prev = node;
+		node = next;
+	}
+
+	while (prev != NULL) {
+		void *next = *(void **)prev;
+
+		sys_sfnode_init(prev, 0x0);
+		sys_sflist_append(&queue->data_q, prev);
+		prev = next;
+	}
+}
+
+static void queue_append_mpsc(struct k_queue *queue, void *data)
+{
+	void *head;
+
+	/* Push onto the inbox. Producers only ever push, so there is
+	 * no ABA hazard in the retry loop.
+	 */
+	do {
+		head = atomic_ptr_get(&queue->mpsc_inbox);
+		*(void **)data = head;
+	} while (!atomic_ptr_cas(&queue->mpsc_inbox, head, data));
+
+	/* The consumer raises mpsc_waiter before its final inbox check
+	 * and we read it after the push above, so either that check sees
+	 * our item or we see the flag; the spinlock below then cannot be
+	 * acquired before the consumer is actually pended.
+	 */
+	if (atomic_get(&queue->mpsc_waiter) != 0) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+		struct k_thread *thread =
+			z_unpend_first_thread(&queue->wait_q);
+
+		if (thread != NULL) {
+			/* Wake the consumer to drain the inbox; the
+			 * item itself was already pushed there.
+			 */
+			prepare_thread_to_run(thread, NULL);
+			z_reschedule(&queue->lock, key);
+			return;
+		}
+		k_spin_unlock(&queue->lock, key);
+	}
+
+#ifdef CONFIG_POLL
+	/* Unlocked emptiness peek: a poller registering concurrently
+	 * with the push may miss this event and is then signalled by
+	 * the next append.
+	 */
+	if (!sys_dlist_is_empty(&queue->poll_events)) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+		z_reschedule(&queue->lock, key);
+	}
+#endif
+}
+
+static void *queue_get_mpsc(struct k_queue *queue, k_timeout_t timeout)
+{
+	while (true) {
+		mpsc_drain(queue);
+
+		if (likely(!sys_sflist_is_empty(&queue->data_q))) {
+			sys_sfnode_t *node;
+
+			node = sys_sflist_get_not_empty(&queue->data_q);
+			return z_queue_node_peek(node, true);
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return NULL;
+		}
+
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		(void)atomic_set(&queue->mpsc_waiter, 1);
+
+		if (atomic_ptr_get(&queue->mpsc_inbox) != NULL) {
+			/* A producer raced with the drain above */
+			(void)atomic_set(&queue->mpsc_waiter, 0);
+			k_spin_unlock(&queue->lock, key);
+			continue;
+		}
+
+		int ret = z_pend_curr(&queue->lock, key, &queue->wait_q,
+				      timeout);
+
+		(void)atomic_set(&queue->mpsc_waiter, 0);
+
+		if (ret != 0) {
+			/* Timed out */
+			return NULL;
+		}
+
+		/* The locked producer paths (prepend, insert, ...) hand
+		 * the item over directly.
+		 */
+		if (_current->base.swap_data != NULL) {
+			return _current->base.swap_data;
+		}
+
+		/* Woken with no data and an empty inbox: this was
+		 * k_queue_cancel_wait().
+		 */
+		if (atomic_ptr_get(&queue->mpsc_inbox) == NULL) {
+			return NULL;
+		}
+	}
+}
+#endif /* CONFIG_QUEUE_MPSC */
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
@@ -178,6 +320,12 @@ void k_queue_insert(struct k_queue *queue, void *prev, void *data)
 
 void k_queue_append(struct k_queue *queue, void *data)
 {
+#ifdef CONFIG_QUEUE_MPSC
+	if (queue->mpsc_mode) {
+		queue_append_mpsc(queue, data);
+		return;
+	}
+#endif
 	(void)queue_insert(queue, sys_sflist_peek_tail(&queue->data_q),
 			   data, false);
 }
@@ -276,6 +424,11 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list)
 
 void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 {
+#ifdef CONFIG_QUEUE_MPSC
+	if (queue->mpsc_mode) {
+		return queue_get_mpsc(queue, timeout);
+	}
+#endif
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	void *data;
 
@@ -14,6 +14,7 @@
 #include <drivers/timer/system_timer.h>
 #include <stdbool.h>
 #include <kernel_internal.h>
+#include <sys/math_extras.h>
 #include <logging/log.h>
 LOG_MODULE_DECLARE(os);
 
@@ -27,7 +28,9 @@ LOG_MODULE_DECLARE(os);
 #if defined(CONFIG_SCHED_DUMB)
 #define _priq_run_add		z_priq_dumb_add
 #define _priq_run_remove	z_priq_dumb_remove
-# if defined(CONFIG_SCHED_CPU_MASK)
+# if defined(CONFIG_SCHED_SOFT_AFFINITY)
+#  define _priq_run_best	_priq_dumb_affinity_best
+# elif defined(CONFIG_SCHED_CPU_MASK)
 #  define _priq_run_best	_priq_dumb_mask_best
 # else
 #  define _priq_run_best	z_priq_dumb_best
@@ -64,6 +67,56 @@ static void update_cache(int);
 			!__i.key;					\
 			k_spin_unlock(lck, __key), __i.key = 1)
 
+/* Returns the run queue a given thread should live on.  Normally
+ * there is just the single global queue, but when
+ * CONFIG_SCHED_CPU_MASK_PIN_ONLY is enabled every CPU owns its own
+ * queue and threads are enqueued on the one CPU their mask allows, so
+ * scheduling decisions on the hot path touch only CPU-local state.
+ */
+static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	int cpu, m = thread->base.cpu_mask;
+
+	/* Edge case: it's legal per the API to "make runnable" a
+	 * thread with all CPUs masked off (i.e. one that isn't
+	 * actually runnable!).  Sort of a wart in the API and maybe
+	 * we should address this in docs/assertions instead to avoid
+	 * the extra test.
+	 */
+	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
+
+	return &_kernel.cpus[cpu].ready_q.runq;
+#else
+	ARG_UNUSED(thread);
+	return &_kernel.ready_q.runq;
+#endif
+}
+
+static ALWAYS_INLINE void *curr_cpu_runq(void)
+{
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	return &arch_curr_cpu()->ready_q.runq;
+#else
+	return &_kernel.ready_q.runq;
+#endif
+}
+
+static ALWAYS_INLINE void runq_add(struct k_thread *thread)
+{
+	_priq_run_add(thread_runq(thread), thread);
+}
+
+static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
+{
+	_priq_run_remove(thread_runq(thread), thread);
+}
+
+static ALWAYS_INLINE struct k_thread *runq_best(void)
+{
+	return _priq_run_best(curr_cpu_runq());
+}
+
 static inline int is_preempt(struct k_thread *thread)
 {
 #ifdef CONFIG_PREEMPT_ENABLED
@@ -180,9 +233,60 @@ static ALWAYS_INLINE struct k_thread *_priq_dumb_mask_best(sys_dlist_t *pq)
 }
 #endif
 
+#ifdef CONFIG_SCHED_SOFT_AFFINITY
+static ALWAYS_INLINE bool affinity_runnable(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(_current_cpu->id)) != 0;
+#else
+	ARG_UNUSED(thread);
+	return true;
+#endif
+}
+
+static ALWAYS_INLINE struct k_thread *_priq_dumb_affinity_best(sys_dlist_t *pq)
+{
+	struct k_thread *thread, *best = NULL;
+
+	/* Walk past the nominal head looking for an equivalent-
+	 * priority thread that last ran on this CPU and stopped
+	 * running recently enough that its working set is likely
+	 * still in cache.  Such a thread is taken in preference to
+	 * the head, which stays queued and will be picked up by the
+	 * next CPU to schedule (or by us on the next pass).  Threads
+	 * that ran too long ago gain nothing from an affine pick, so
+	 * FIFO fairness wins for them.
+	 */
+	SYS_DLIST_FOR_EACH_CONTAINER(pq, thread, base.qnode_dlist) {
+		if (!affinity_runnable(thread)) {
+			continue;
+		}
+
+		if (best == NULL) {
+			best = thread;
+			if (best->base.cpu == _current_cpu->id) {
+				return best;
+			}
+			continue;
+		}
+
+		if (z_is_t1_higher_prio_than_t2(best, thread)) {
+			break;
+		}
+
+		if (thread->base.cpu == _current_cpu->id &&
+		    (k_cycle_get_32() - thread->base.run_end_cycle) <=
+		    (uint32_t)CONFIG_SCHED_SOFT_AFFINITY_WARM_CYCLES) {
+			return thread;
+		}
+	}
+	return best;
+}
+#endif
+
 static ALWAYS_INLINE struct k_thread *next_up(void)
 {
-	struct k_thread *thread = _priq_run_best(&_kernel.ready_q.runq);
+	struct k_thread *thread = runq_best();
 
 #if (CONFIG_NUM_METAIRQ_PRIORITIES > 0) && (CONFIG_NUM_COOP_PRIORITIES > 0)
 	/* MetaIRQs must always attempt to return back to a
@@ -252,13 +356,13 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 	/* Put _current back into the queue */
 	if (thread != _current && active &&
 		!z_is_idle_thread_object(_current) && !queued) {
-		_priq_run_add(&_kernel.ready_q.runq, _current);
+		runq_add(_current);
 		z_mark_thread_as_queued(_current);
 	}
 
 	/* Take the new _current out of the queue */
 	if (z_is_thread_queued(thread)) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
 	}
 	z_mark_thread_as_not_queued(thread);
 
@@ -269,9 +373,9 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 static void move_thread_to_end_of_prio_q(struct k_thread *thread)
 {
 	if (z_is_thread_queued(thread)) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
 	}
-	_priq_run_add(&_kernel.ready_q.runq, thread);
+	runq_add(thread);
 	z_mark_thread_as_queued(thread);
 	update_cache(thread == _current);
 }
@@ -401,15 +505,77 @@ static void update_cache(int preempt_ok)
 #endif
 }
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+/* Returns the set of CPUs that would need to reschedule to run the
+ * newly readied thread: those whose executing thread is preemptible
+ * (or idle) and lower priority.  Must be called with the scheduler
+ * lock held; the local CPU is excluded because it reschedules on its
+ * own at the next z_reschedule()/interrupt exit.
+ */
+static uint32_t ipi_mask_create(struct k_thread *thread)
+{
+	uint32_t mask = 0U;
+	int id = _current_cpu->id;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct k_thread *curr = _kernel.cpus[i].current;
+
+		if ((i == id) || (curr == NULL)) {
+			continue;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((thread->base.cpu_mask & BIT(i)) == 0) {
+			continue;
+		}
+#endif
+
+		if (!is_preempt(curr) && !z_is_idle_thread_object(curr)) {
+			continue;
+		}
+
+		if (z_is_t1_higher_prio_than_t2(thread, curr)) {
+			mask |= BIT(i);
+		}
+	}
+
+	return mask;
+}
+
+static void flag_ipi(uint32_t ipi_mask)
+{
+	if (ipi_mask != 0U) {
+		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
+	}
+}
+
+/* Flush flagged reschedule IPIs.  Called outside the scheduler lock so
+ * a burst of wakeups within one lock hold coalesces into at most one
+ * IPI per destination CPU.
+ */
+void z_signal_pending_ipi(void)
+{
+	uint32_t ipi_mask = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+
+	if (ipi_mask != 0U) {
+#ifdef CONFIG_SCHED_IPI_TARGETED
+		arch_sched_directed_ipi(ipi_mask);
+#else
+		arch_sched_ipi();
+#endif
+	}
+}
+#endif
+
 static void ready_thread(struct k_thread *thread)
 {
 	if (z_is_thread_ready(thread)) {
 		sys_trace_thread_ready(thread);
-		_priq_run_add(&_kernel.ready_q.runq, thread);
+		runq_add(thread);
 		z_mark_thread_as_queued(thread);
 		update_cache(0);
 #if defined(CONFIG_SMP) &&  defined(CONFIG_SCHED_IPI_SUPPORTED)
-		arch_sched_ipi();
+		flag_ipi(ipi_mask_create(thread));
 #endif
 	}
 }
@@ -419,6 +585,7 @@ void z_ready_thread(struct k_thread *thread)
 	LOCKED(&sched_spinlock) {
 		ready_thread(thread);
 	}
+	z_signal_pending_ipi();
 }
 
 void z_move_thread_to_end_of_prio_q(struct k_thread *thread)
@@ -448,7 +615,7 @@ void z_impl_k_thread_suspend(struct k_thread *thread)
 
 	LOCKED(&sched_spinlock) {
 		if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			z_mark_thread_as_not_queued(thread);
 		}
 		z_mark_thread_as_suspended(thread);
@@ -515,8 +682,7 @@ void z_thread_single_abort(struct k_thread *thread)
 
 		if (z_is_thread_ready(thread)) {
 			if (z_is_thread_queued(thread)) {
-				_priq_run_remove(&_kernel.ready_q.runq,
-						 thread);
+				runq_remove(thread);
 				z_mark_thread_as_not_queued(thread);
 			}
 			update_cache(thread == _current);
@@ -580,7 +746,7 @@ void z_thread_single_abort(struct k_thread *thread)
 static void unready_thread(struct k_thread *thread)
 {
 	if (z_is_thread_queued(thread)) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
 		z_mark_thread_as_not_queued(thread);
 	}
 	update_cache(thread == _current);
@@ -661,6 +827,21 @@ ALWAYS_INLINE void z_unpend_thread_no_timeout(struct k_thread *thread)
 	}
 }
 
+/* Move a pended thread from the wait queue it is blocked on to another one,
+ * without waking it and without touching an armed timeout. If the timeout
+ * expires while the thread sits on the new queue, z_thread_timeout() removes
+ * it from there as usual. The caller is responsible for serializing against
+ * other users of both wait queues.
+ */
+void z_requeue_thread(struct k_thread *thread, _wait_q_t *wait_q)
+{
+	LOCKED(&sched_spinlock) {
+		__ASSERT_NO_MSG(thread->base.pended_on != NULL);
+		unpend_thread_no_timeout(thread);
+		add_to_waitq_locked(thread, wait_q);
+	}
+}
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 /* Timeout handler for *_thread_timeout() APIs */
 void z_thread_timeout(struct _timeout *timeout)
@@ -676,6 +857,7 @@ void z_thread_timeout(struct _timeout *timeout)
 		z_mark_thread_as_not_suspended(thread);
 		ready_thread(thread);
 	}
+	z_signal_pending_ipi();
 }
 #endif
 
@@ -738,11 +920,22 @@ bool z_set_prio(struct k_thread *thread, int prio)
 		if (need_sched) {
 			/* Don't requeue on SMP if it's the running thread */
 			if (!IS_ENABLED(CONFIG_SMP) || z_is_thread_queued(thread)) {
-				_priq_run_remove(&_kernel.ready_q.runq, thread);
+				runq_remove(thread);
 				thread->base.prio = prio;
-				_priq_run_add(&_kernel.ready_q.runq, thread);
+				runq_add(thread);
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+				flag_ipi(ipi_mask_create(thread));
+#endif
 			} else {
 				thread->base.prio = prio;
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+				/* Running on another CPU, which must
+				 * re-evaluate its scheduling decision
+				 */
+				if (thread != _current) {
+					flag_ipi(BIT(thread->base.cpu));
+				}
+#endif
 			}
 			update_cache(1);
 		} else {
@@ -758,9 +951,7 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 {
 	bool need_sched = z_set_prio(thread, prio);
 
-#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	arch_sched_ipi();
-#endif
+	z_signal_pending_ipi();
 
 	if (need_sched && _current->base.sched_locked == 0) {
 		z_reschedule_unlocked();
@@ -800,6 +991,7 @@ void z_reschedule(struct k_spinlock *lock, k_spinlock_key_t key)
 		z_swap(lock, key);
 	} else {
 		k_spin_unlock(lock, key);
+		z_signal_pending_ipi();
 	}
 }
 
@@ -809,6 +1001,7 @@ void z_reschedule_irqlock(uint32_t key)
 		z_swap_irqlock(key);
 	} else {
 		irq_unlock(key);
+		z_signal_pending_ipi();
 	}
 }
 
@@ -978,6 +1171,18 @@ void z_priq_rb_add(struct _priq_rb *pq, struct k_thread *thread)
 	}
 
 	rb_insert(&pq->tree, &thread->base.qnode_rb);
+
+	/* Note that with SCHED_DEADLINE the ordering of two queued
+	 * threads can drift as the cycle counter advances, but only
+	 * across a deadline wraparound, which the comparison above
+	 * already disclaims.  The cache is exactly as stale as the
+	 * tree itself.
+	 */
+	if (pq->cached_best == NULL ||
+	    z_priq_rb_lessthan(&thread->base.qnode_rb,
+			       &pq->cached_best->base.qnode_rb)) {
+		pq->cached_best = thread;
+	}
 }
 
 void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread)
@@ -992,6 +1197,13 @@ void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread)
 
 	rb_remove(&pq->tree, &thread->base.qnode_rb);
 
+	if (pq->cached_best == thread) {
+		struct rbnode *n = rb_get_min(&pq->tree);
+
+		pq->cached_best = n == NULL ? NULL
+			: CONTAINER_OF(n, struct k_thread, base.qnode_rb);
+	}
+
 	if (!pq->tree.root) {
 		pq->next_order_key = 0;
 	}
@@ -999,13 +1211,7 @@ void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread)
 
 struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 {
-	struct k_thread *thread = NULL;
-	struct rbnode *n = rb_get_min(&pq->tree);
-
-	if (n != NULL) {
-		thread = CONTAINER_OF(n, struct k_thread, base.qnode_rb);
-	}
-	return thread;
+	return pq->cached_best;
 }
 
 #ifdef CONFIG_SCHED_MULTIQ
@@ -1068,24 +1274,31 @@ int z_unpend_all(_wait_q_t *wait_q)
 	return need_sched;
 }
 
-void z_sched_init(void)
+static void init_ready_q(struct _ready_q *rq)
 {
-#ifdef CONFIG_SCHED_DUMB
-	sys_dlist_init(&_kernel.ready_q.runq);
-#endif
-
-#ifdef CONFIG_SCHED_SCALABLE
-	_kernel.ready_q.runq = (struct _priq_rb) {
+#if defined(CONFIG_SCHED_SCALABLE)
+	rq->runq = (struct _priq_rb) {
 		.tree = {
 			.lessthan_fn = z_priq_rb_lessthan,
 		}
 	};
+#elif defined(CONFIG_SCHED_MULTIQ)
+	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+		sys_dlist_init(&rq->runq.queues[i]);
+	}
+#else
+	sys_dlist_init(&rq->runq);
 #endif
+}
 
-#ifdef CONFIG_SCHED_MULTIQ
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
-		sys_dlist_init(&_kernel.ready_q.runq.queues[i]);
+void z_sched_init(void)
+{
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
+#else
+	init_ready_q(&_kernel.ready_q);
 #endif
 
 #ifdef CONFIG_TIMESLICING
@@ -1145,8 +1358,8 @@ void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 	LOCKED(&sched_spinlock) {
 		thread->base.prio_deadline = k_cycle_get_32() + deadline;
 		if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
-			_priq_run_add(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
+			runq_add(thread);
 		}
 	}
 }
@@ -1175,10 +1388,9 @@ void z_impl_k_yield(void)
 		LOCKED(&sched_spinlock) {
 			if (!IS_ENABLED(CONFIG_SMP) ||
 			    z_is_thread_queued(_current)) {
-				_priq_run_remove(&_kernel.ready_q.runq,
-						 _current);
+				runq_remove(_current);
 			}
-			_priq_run_add(&_kernel.ready_q.runq, _current);
+			runq_add(_current);
 			z_mark_thread_as_queued(_current);
 			update_cache(1);
 		}
@@ -1306,10 +1518,6 @@ void z_impl_k_wakeup(k_tid_t thread)
 	z_mark_thread_as_not_suspended(thread);
 	z_ready_thread(thread);
 
-#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	arch_sched_ipi();
-#endif
-
 	if (!arch_is_in_isr()) {
 		z_reschedule_unlocked();
 	}
@@ -1360,7 +1568,7 @@ void z_sched_abort(struct k_thread *thread)
 			thread->base.thread_state |= _THREAD_DEAD;
 			k_spin_unlock(&sched_spinlock, key);
 		} else if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			z_mark_thread_as_not_queued(thread);
 			thread->base.thread_state |= _THREAD_DEAD;
 			k_spin_unlock(&sched_spinlock, key);
@@ -1449,6 +1657,14 @@ static int cpu_mask_mod(k_tid_t thread, uint32_t enable_mask, uint32_t disable_m
 			ret = -EINVAL;
 		}
 	}
+
+#if defined(CONFIG_ASSERT) && defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY)
+	int m = thread->base.cpu_mask;
+
+	__ASSERT((m == 0) || ((m & (m - 1)) == 0),
+		 "Only one CPU allowed in mask when PIN_ONLY");
+#endif
+
 	return ret;
 }
 
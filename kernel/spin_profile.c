@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Spinlock profiling backend, see include/debug/spin_profile.h.
+ *
+ * Records are kept in an open-addressed hash table keyed by the code
+ * address of the k_spin_lock() expansion.  The hooks run with
+ * interrupts disabled on the calling CPU; slot claiming uses an
+ * atomic compare-and-set, but the counter updates themselves are not
+ * synchronized across CPUs, so concurrent updates of a hot site may
+ * occasionally drop a sample.  That is fine for a profiling tool and
+ * keeps the hooks off the lock fast path as much as possible.
+ *
+ * Reading the cycle counter may itself take a spinlock in the timer
+ * driver, so a per-CPU flag suppresses profiling of locks taken from
+ * inside the hooks; those acquisitions are simply not counted.
+ */
+
+#include <kernel.h>
+#include <kernel_structs.h>
+#include <spinlock.h>
+#include <debug/spin_profile.h>
+
+static struct spin_profile_entry sites[CONFIG_SPIN_PROFILE_MAX_SITES];
+
+/* suppresses recursive profiling via the timer driver's own locks */
+static bool in_hook[CONFIG_MP_NUM_CPUS];
+
+static struct spin_profile_entry *site_entry(void *site)
+{
+	uint32_t idx = ((uintptr_t)site >> 2) % CONFIG_SPIN_PROFILE_MAX_SITES;
+	uint32_t probes;
+
+	for (probes = 0U; probes < CONFIG_SPIN_PROFILE_MAX_SITES; probes++) {
+		struct spin_profile_entry *entry = &sites[idx];
+
+		if (entry->site == site) {
+			return entry;
+		}
+		if (entry->site == NULL &&
+		    atomic_ptr_cas((atomic_ptr_t *)&entry->site, NULL, site)) {
+			return entry;
+		}
+		idx = (idx + 1U) % CONFIG_SPIN_PROFILE_MAX_SITES;
+	}
+
+	/* table full, drop the sample */
+	return NULL;
+}
+
+bool z_spin_profile_enter(uint32_t *t0)
+{
+	int cpu = _current_cpu->id;
+
+	if (in_hook[cpu]) {
+		return false;
+	}
+	in_hook[cpu] = true;
+	*t0 = k_cycle_get_32();
+	return true;
+}
+
+void z_spin_profile_lock(struct k_spinlock *l, void *site, uint32_t t0)
+{
+	int cpu = _current_cpu->id;
+	uint32_t now = k_cycle_get_32();
+	struct spin_profile_entry *entry = site_entry(site);
+
+	if (entry != NULL) {
+		entry->count++;
+		entry->wait_cycles += now - t0;
+		l->profile_site = site;
+		l->profile_start = now;
+	}
+	in_hook[cpu] = false;
+}
+
+void z_spin_profile_unlock(struct k_spinlock *l)
+{
+	int cpu = _current_cpu->id;
+	struct spin_profile_entry *entry;
+	uint32_t hold;
+
+	if (in_hook[cpu] || l->profile_site == NULL) {
+		return;
+	}
+	in_hook[cpu] = true;
+
+	entry = site_entry(l->profile_site);
+	if (entry != NULL) {
+		hold = k_cycle_get_32() - l->profile_start;
+		entry->hold_cycles += hold;
+		if (hold > entry->max_hold_cycles) {
+			entry->max_hold_cycles = hold;
+		}
+	}
+	l->profile_site = NULL;
+
+	in_hook[cpu] = false;
+}
+
+size_t spin_profile_max_sites(void)
+{
+	return CONFIG_SPIN_PROFILE_MAX_SITES;
+}
+
+const struct spin_profile_entry *spin_profile_get(size_t index)
+{
+	if (index >= CONFIG_SPIN_PROFILE_MAX_SITES) {
+		return NULL;
+	}
+	return &sites[index];
+}
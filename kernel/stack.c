@@ -47,11 +47,94 @@ void k_stack_init(struct k_stack *stack, stack_data_t *buffer,
 	stack->lock = (struct k_spinlock) {};
 	stack->next = stack->base = buffer;
 	stack->top = stack->base + num_entries;
+	stack->flags = 0U;
 
 	SYS_TRACING_OBJ_INIT(k_stack, stack);
 	z_object_init(stack);
 }
 
+#ifdef CONFIG_STACK_LOCKFREE
+/* Reserved slot value; lock-free mode callers must never push it */
+#define STACK_EMPTY_SLOT ((stack_data_t)-1)
+
+void k_stack_lockfree_init(struct k_stack *stack, stack_data_t *buffer,
+			   uint32_t num_entries)
+{
+	k_stack_init(stack, buffer, num_entries);
+	stack->flags = K_STACK_FLAG_LOCKFREE;
+	(void)atomic_set(&stack->lf_count, 0);
+	(void)atomic_set(&stack->lf_waiters, 0);
+
+	for (uint32_t i = 0U; i < num_entries; i++) {
+		buffer[i] = STACK_EMPTY_SLOT;
+	}
+}
+
+/* Claiming a slot (the count CAS) and filling or emptying it are two
+ * separate steps, so a peer that claims the same slot right after us
+ * spins until our slot access completes. Local interrupts are locked
+ * across both steps so that window cannot contain a preemption, which
+ * bounds the peer's spin to a few instructions on another CPU.
+ */
+static int stack_push_lockfree(struct k_stack *stack, stack_data_t data)
+{
+	atomic_val_t cap = stack->top - stack->base;
+	atomic_val_t n;
+	unsigned int key;
+
+	__ASSERT(data != STACK_EMPTY_SLOT,
+		 "reserved value pushed to lock-free stack %p", stack);
+
+	key = arch_irq_lock();
+
+	do {
+		n = atomic_get(&stack->lf_count);
+		if (n >= cap) {
+			arch_irq_unlock(key);
+			return -ENOMEM;
+		}
+	} while (!atomic_cas(&stack->lf_count, n, n + 1));
+
+	/* Wait for a raced pop to finish emptying the claimed slot */
+	while (!atomic_cas((atomic_t *)&stack->base[n],
+			   (atomic_val_t)STACK_EMPTY_SLOT,
+			   (atomic_val_t)data)) {
+	}
+	arch_irq_unlock(key);
+
+	return 0;
+}
+
+static int stack_pop_lockfree(struct k_stack *stack, stack_data_t *data)
+{
+	atomic_val_t n;
+	stack_data_t val;
+	unsigned int key;
+
+	key = arch_irq_lock();
+
+	do {
+		n = atomic_get(&stack->lf_count);
+		if (n == 0) {
+			arch_irq_unlock(key);
+			return -EBUSY;
+		}
+	} while (!atomic_cas(&stack->lf_count, n, n - 1));
+
+	/* Only this pop may empty the claimed slot; retry until a raced
+	 * push has finished filling it.
+	 */
+	do {
+		val = (stack_data_t)atomic_set((atomic_t *)&stack->base[n - 1],
+					       (atomic_val_t)STACK_EMPTY_SLOT);
+	} while (val == STACK_EMPTY_SLOT);
+	arch_irq_unlock(key);
+
+	*data = val;
+	return 0;
+}
+#endif /* CONFIG_STACK_LOCKFREE */
+
 int32_t z_impl_k_stack_alloc_init(struct k_stack *stack, uint32_t num_entries)
 {
 	void *buffer;
@@ -99,6 +182,42 @@ int z_impl_k_stack_push(struct k_stack *stack, stack_data_t data)
 	struct k_thread *first_pending_thread;
 	k_spinlock_key_t key;
 
+#ifdef CONFIG_STACK_LOCKFREE
+	if ((stack->flags & K_STACK_FLAG_LOCKFREE) != 0U) {
+		int ret = stack_push_lockfree(stack, data);
+
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* Consumers raise lf_waiters before their final
+		 * emptiness check and we read it after the push, so
+		 * either that check sees our item or we see the count
+		 * and take the lock, which a blocking consumer releases
+		 * only once pended, to wake it.
+		 */
+		if (atomic_get(&stack->lf_waiters) != 0) {
+			key = k_spin_lock(&stack->lock);
+			first_pending_thread =
+				z_unpend_first_thread(&stack->wait_q);
+
+			if (first_pending_thread != NULL) {
+				/* Wake the consumer to retry the pop;
+				 * the item itself is already in the
+				 * stack.
+				 */
+				z_thread_return_value_set_with_data(
+					first_pending_thread, 0, NULL);
+				z_ready_thread(first_pending_thread);
+				z_reschedule(&stack->lock, key);
+				return 0;
+			}
+			k_spin_unlock(&stack->lock, key);
+		}
+		return 0;
+	}
+#endif
+
 	CHECKIF(stack->next == stack->top) {
 		return -ENOMEM;
 	}
@@ -138,6 +257,43 @@ int z_impl_k_stack_pop(struct k_stack *stack, stack_data_t *data,
 	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_STACK_LOCKFREE
+	if ((stack->flags & K_STACK_FLAG_LOCKFREE) != 0U) {
+		while (true) {
+			if (stack_pop_lockfree(stack, data) == 0) {
+				return 0;
+			}
+
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				return -EBUSY;
+			}
+
+			key = k_spin_lock(&stack->lock);
+			(void)atomic_inc(&stack->lf_waiters);
+
+			if (atomic_get(&stack->lf_count) != 0) {
+				/* A producer raced with the pop above */
+				(void)atomic_dec(&stack->lf_waiters);
+				k_spin_unlock(&stack->lock, key);
+				continue;
+			}
+
+			result = z_pend_curr(&stack->lock, key,
+					     &stack->wait_q, timeout);
+			(void)atomic_dec(&stack->lf_waiters);
+
+			if (result == -EAGAIN) {
+				return -EAGAIN;
+			}
+
+			/* Woken by a push: retry the pop. If another
+			 * consumer got there first we pend again with a
+			 * restarted timeout.
+			 */
+		}
+	}
+#endif
+
 	key = k_spin_lock(&stack->lock);
 
 	if (likely(stack->next > stack->base)) {
@@ -18,6 +18,15 @@ K_KERNEL_STACK_DEFINE(sys_work_q_stack, CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
 
 struct k_work_q k_sys_work_q;
 
+#if defined(CONFIG_WORKQUEUE_POOL) && (CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE > 1)
+#define SYS_WORK_Q_EXTRA_THREADS (CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE - 1)
+
+K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_pool_stack, SYS_WORK_Q_EXTRA_THREADS,
+			    CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+
+static struct k_thread sys_work_q_pool_thread[SYS_WORK_Q_EXTRA_THREADS];
+#endif
+
 static int k_sys_work_q_init(const struct device *dev)
 {
 	ARG_UNUSED(dev);
@@ -28,6 +37,18 @@ static int k_sys_work_q_init(const struct device *dev)
 		       CONFIG_SYSTEM_WORKQUEUE_PRIORITY);
 	k_thread_name_set(&k_sys_work_q.thread, "sysworkq");
 
+#if defined(CONFIG_WORKQUEUE_POOL) && (CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE > 1)
+	for (int i = 0; i < SYS_WORK_Q_EXTRA_THREADS; i++) {
+		k_work_q_worker_start(&k_sys_work_q,
+				      &sys_work_q_pool_thread[i],
+				      sys_work_q_pool_stack[i],
+				      K_KERNEL_STACK_SIZEOF(
+						sys_work_q_pool_stack[i]),
+				      CONFIG_SYSTEM_WORKQUEUE_PRIORITY);
+		k_thread_name_set(&sys_work_q_pool_thread[i], "sysworkq");
+	}
+#endif
+
 	return 0;
 }
 
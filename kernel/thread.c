@@ -477,7 +477,27 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 		stack_buf_size, stack_ptr);
 
 #ifdef CONFIG_INIT_STACKS
+#ifdef CONFIG_INIT_STACKS_SKIP_PAINTED
+	{
+		/* A recycled stack buffer still holds the fill pattern
+		 * below the deepest point its previous thread reached, so
+		 * repainting can start at the first dirty byte. Bytes the
+		 * scan skips either were never written or accidentally
+		 * hold the pattern value, which repainting would not
+		 * change. Fresh (zeroed) buffers are dirty from the start
+		 * and get a full paint.
+		 */
+		uint8_t *dirty = (uint8_t *)stack_buf_start;
+		uint8_t *buf_end = (uint8_t *)stack_buf_start + stack_buf_size;
+
+		while ((dirty < buf_end) && (*dirty == 0xaa)) {
+			dirty++;
+		}
+		memset(dirty, 0xaa, buf_end - dirty);
+	}
+#else
 	memset(stack_buf_start, 0xaa, stack_buf_size);
+#endif /* CONFIG_INIT_STACKS_SKIP_PAINTED */
 #endif
 #ifdef CONFIG_STACK_SENTINEL
 	/* Put the stack sentinel at the lowest 4 bytes of the stack area.
@@ -539,6 +559,11 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	new_thread->stack_obj = stack;
 	new_thread->syscall_frame = NULL;
 
+#ifdef CONFIG_KOBJECT_VALIDATION_CACHE
+	(void)memset(&new_thread->perm_cache, 0,
+		     sizeof(new_thread->perm_cache));
+#endif
+
 	/* Any given thread has access to itself */
 	k_object_access_grant(new_thread, new_thread);
 #endif
@@ -791,6 +816,14 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 	thread_base->is_idle = 0;
 #endif
 
+#ifdef CONFIG_SCHED_SOFT_AFFINITY
+	/* Also ensures base.cpu holds a real CPU index before the
+	 * thread has ever been switched in.
+	 */
+	thread_base->cpu = 0U;
+	thread_base->run_end_cycle = 0U;
+#endif
+
 	/* swap_data does not need to be initialized */
 
 	z_init_thread_timeout(thread_base);
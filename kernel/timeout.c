@@ -11,6 +11,7 @@
 #include <syscall_handler.h>
 #include <drivers/timer/system_timer.h>
 #include <sys_clock.h>
+#include <sys/math_extras.h>
 
 #define LOCKED(lck) for (k_spinlock_key_t __i = {},			\
 					  __key = k_spin_lock(lck);	\
@@ -19,7 +20,9 @@
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif
 
 static struct k_spinlock timeout_lock;
 
@@ -29,6 +32,13 @@ static struct k_spinlock timeout_lock;
 /* Cycles left to process in the currently-executing z_clock_announce() */
 static int announce_remaining;
 
+/* How many same-tick expiries z_clock_announce() pops per
+ * timeout_lock acquisition.  Sized to keep the on-ISR-stack batch
+ * array small while still amortizing the lock cost when many timers
+ * fire in one tick after a tickless sleep.
+ */
+#define ANNOUNCE_BATCH_SIZE 8
+
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -41,6 +51,143 @@ static inline int z_vrfy_z_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+static int32_t elapsed(void)
+{
+	return announce_remaining == 0 ? z_clock_elapsed() : 0;
+}
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+/* Hierarchical timing wheel: WHEEL_LEVELS levels of WHEEL_SLOTS
+ * unsorted buckets each.  A level N bucket spans 64^N ticks, so four
+ * 64-slot levels cover 2^24 ticks before clamping into the furthest
+ * top-level bucket.  In this mode a timeout's dticks field holds its
+ * absolute expiry tick, insertion and cancellation are O(1), and
+ * buckets in the upper levels are re-bucketed ("cascaded") into lower
+ * ones as the clock crosses their boundary.
+ */
+#define WHEEL_SLOT_BITS	6
+#define WHEEL_SLOTS	BIT(WHEEL_SLOT_BITS)
+#define WHEEL_MASK	(WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS	4
+#define WHEEL_SHIFT(l)	((l) * WHEEL_SLOT_BITS)
+#define WHEEL_SPAN(l)	((uint64_t)1 << WHEEL_SHIFT(l))
+
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+
+/* One "maybe nonempty" hint bit per bucket, maintained lazily:
+ * removal leaves bits stale, scans clear them when they find an empty
+ * bucket.
+ */
+static uint64_t wheel_bits[WHEEL_LEVELS];
+
+static bool wheel_ready;
+
+static void wheel_init(void)
+{
+	for (int l = 0; l < WHEEL_LEVELS; l++) {
+		for (int s = 0; s < WHEEL_SLOTS; s++) {
+			sys_dlist_init(&wheel[l][s]);
+		}
+	}
+	wheel_ready = true;
+}
+
+static void wheel_insert(struct _timeout *t)
+{
+	uint64_t delta = (uint64_t)t->dticks - curr_tick;
+	uint64_t max_delta = WHEEL_SPAN(WHEEL_LEVELS) - WHEEL_SPAN(WHEEL_LEVELS - 1);
+	int level = 0, slot;
+
+	while (level < WHEEL_LEVELS - 1 && delta >= WHEEL_SPAN(level + 1)) {
+		level++;
+	}
+
+	/* Expiries beyond the top level's range park in the furthest
+	 * top-level bucket and cascade back in as time advances.
+	 */
+	delta = MIN(delta, max_delta);
+
+	slot = (int)(((curr_tick + delta) >> WHEEL_SHIFT(level)) & WHEEL_MASK);
+	sys_dlist_append(&wheel[level][slot], &t->node);
+	wheel_bits[level] |= 1ULL << slot;
+}
+
+/* Returns a lower bound on the next tick at which the wheel needs
+ * servicing: exact for level 0, the bucket's start tick (i.e. the
+ * point where its contents must cascade) for upper levels.  UINT64_MAX
+ * if nothing is pending.
+ */
+static uint64_t wheel_next_event(void)
+{
+	uint64_t best = UINT64_MAX;
+
+	for (int l = 0; l < WHEEL_LEVELS; l++) {
+		uint64_t pos = curr_tick >> WHEEL_SHIFT(l);
+		uint64_t bits = wheel_bits[l];
+
+		while (bits != 0) {
+			int slot = u64_count_trailing_zeros(bits);
+			uint64_t d;
+
+			bits &= bits - 1;
+			if (sys_dlist_is_empty(&wheel[l][slot])) {
+				wheel_bits[l] &= ~(1ULL << slot);
+				continue;
+			}
+			d = ((uint64_t)slot - pos) & WHEEL_MASK;
+			if (d == 0) {
+				d = WHEEL_SLOTS;
+			}
+			best = MIN(best, (pos + d) << WHEEL_SHIFT(l));
+		}
+	}
+	return best;
+}
+
+/* Called with curr_tick just advanced to a bucket boundary: move the
+ * contents of any upper-level bucket whose window starts now down
+ * into the lower levels (or to expiry in level 0).
+ */
+static void wheel_cascade(void)
+{
+	for (int l = 1; l < WHEEL_LEVELS; l++) {
+		sys_dnode_t *n;
+		int slot;
+
+		if ((curr_tick & (WHEEL_SPAN(l) - 1)) != 0) {
+			break;
+		}
+		slot = (int)((curr_tick >> WHEEL_SHIFT(l)) & WHEEL_MASK);
+		while ((n = sys_dlist_get(&wheel[l][slot])) != NULL) {
+			wheel_insert(CONTAINER_OF(n, struct _timeout, node));
+		}
+	}
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	sys_dlist_remove(&t->node);
+}
+
+static int32_t next_timeout(void)
+{
+	uint64_t nxt = wheel_next_event();
+	int32_t ticks_elapsed = elapsed();
+	int32_t ret = nxt == UINT64_MAX ? MAX_WAIT
+		: (int32_t)MIN(MAX_WAIT,
+			       MAX(0, (int64_t)(nxt - curr_tick) - ticks_elapsed));
+
+#ifdef CONFIG_TIMESLICING
+	if (_current_cpu->slice_ticks && _current_cpu->slice_ticks < ret) {
+		ret = _current_cpu->slice_ticks;
+	}
+#endif
+	return ret;
+}
+
+#else /* !CONFIG_TIMEOUT_WHEEL */
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -64,11 +211,6 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
-static int32_t elapsed(void)
-{
-	return announce_remaining == 0 ? z_clock_elapsed() : 0;
-}
-
 static int32_t next_timeout(void)
 {
 	struct _timeout *to = first();
@@ -84,6 +226,8 @@ static int32_t next_timeout(void)
 	return ret;
 }
 
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout)
 {
@@ -105,6 +249,23 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 	ticks = MAX(1, ticks);
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	LOCKED(&timeout_lock) {
+		uint64_t before;
+
+		if (!wheel_ready) {
+			wheel_init();
+		}
+
+		to->dticks = curr_tick + ticks + elapsed();
+		before = wheel_next_event();
+		wheel_insert(to);
+
+		if (wheel_next_event() < before) {
+			z_clock_set_timeout(next_timeout(), false);
+		}
+	}
+#else
 	LOCKED(&timeout_lock) {
 		struct _timeout *t;
 
@@ -126,6 +287,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			z_clock_set_timeout(next_timeout(), false);
 		}
 	}
+#endif /* CONFIG_TIMEOUT_WHEEL */
 }
 
 int z_abort_timeout(struct _timeout *to)
@@ -145,12 +307,15 @@ int z_abort_timeout(struct _timeout *to)
 /* must be locked */
 static k_ticks_t timeout_rem(struct _timeout *timeout)
 {
-	k_ticks_t ticks = 0;
-
 	if (z_is_inactive_timeout(timeout)) {
 		return 0;
 	}
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	return (k_ticks_t)(timeout->dticks - curr_tick) - elapsed();
+#else
+	k_ticks_t ticks = 0;
+
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
 		ticks += t->dticks;
 		if (timeout == t) {
@@ -159,6 +324,7 @@ static k_ticks_t timeout_rem(struct _timeout *timeout)
 	}
 
 	return ticks - elapsed();
+#endif
 }
 
 k_ticks_t z_timeout_remaining(struct _timeout *timeout)
@@ -227,17 +393,72 @@ void z_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	while (announce_remaining > 0) {
+		uint64_t nxt = wheel_ready ? wheel_next_event() : UINT64_MAX;
+		sys_dlist_t *slot;
+		sys_dnode_t *n;
+
+		if (nxt > curr_tick + (uint64_t)announce_remaining) {
+			curr_tick += announce_remaining;
+			announce_remaining = 0;
+			break;
+		}
+
+		announce_remaining -= (int32_t)(nxt - curr_tick);
+		curr_tick = nxt;
+		wheel_cascade();
+
+		/* Batch the tick's expiries out of the bucket so the
+		 * lock is dropped once per batch rather than once per
+		 * timeout.
+		 */
+		slot = &wheel[0][curr_tick & WHEEL_MASK];
+		while (!sys_dlist_is_empty(slot)) {
+			struct _timeout *batch[ANNOUNCE_BATCH_SIZE];
+			int cnt = 0;
+
+			while (cnt < ANNOUNCE_BATCH_SIZE &&
+			       (n = sys_dlist_get(slot)) != NULL) {
+				batch[cnt++] =
+					CONTAINER_OF(n, struct _timeout, node);
+			}
+
+			k_spin_unlock(&timeout_lock, key);
+			for (int i = 0; i < cnt; i++) {
+				batch[i]->fn(batch[i]);
+			}
+			key = k_spin_lock(&timeout_lock);
+		}
+	}
+#else
 	while (first() != NULL && first()->dticks <= announce_remaining) {
+		struct _timeout *batch[ANNOUNCE_BATCH_SIZE];
 		struct _timeout *t = first();
 		int dt = t->dticks;
+		int cnt = 0;
 
 		curr_tick += dt;
 		announce_remaining -= dt;
-		t->dticks = 0;
-		remove_timeout(t);
+
+		/* Everything expiring on this same tick is popped in
+		 * one go, so the lock is dropped once per batch
+		 * rather than once per timeout.  Handlers still see
+		 * curr_tick equal to their expiry tick, keeping
+		 * periodic re-adds drift-free.
+		 */
+		do {
+			t->dticks = 0;
+			remove_timeout(t);
+			batch[cnt++] = t;
+			t = first();
+		} while (t != NULL && t->dticks == 0 &&
+			 cnt < ANNOUNCE_BATCH_SIZE);
 
 		k_spin_unlock(&timeout_lock, key);
-		t->fn(t);
+		for (int i = 0; i < cnt; i++) {
+			batch[i]->fn(batch[i]);
+		}
 		key = k_spin_lock(&timeout_lock);
 	}
 
@@ -246,6 +467,8 @@ void z_clock_announce(int32_t ticks)
 	}
 
 	curr_tick += announce_remaining;
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 	announce_remaining = 0;
 
 	z_clock_set_timeout(next_timeout(), false);
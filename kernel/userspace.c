@@ -60,6 +60,24 @@ extern uint8_t _thread_idx_map[CONFIG_MAX_THREAD_BYTES];
 
 static void clear_perms_cb(struct z_object *ko, void *ctx_ptr);
 
+#ifdef CONFIG_KOBJECT_VALIDATION_CACHE
+/* Generation counter for the per-thread caches of validated objects.
+ * Bumping it invalidates every cache in the system.
+ */
+static atomic_t perm_cache_generation;
+
+/* Called whenever a permission is narrowed or an object destroyed
+ * anywhere in the system.  The caches only shortcut checks that would
+ * still pass, so widening permissions (grants) needs no bump.
+ */
+static void perm_cache_invalidate_all(void)
+{
+	(void)atomic_inc(&perm_cache_generation);
+}
+#else
+#define perm_cache_invalidate_all() /**/
+#endif
+
 const char *otype_to_str(enum k_objects otype)
 {
 	const char *ret;
@@ -253,6 +271,49 @@ static void thread_idx_free(uintptr_t tidx)
 	sys_bitfield_set_bit((mem_addr_t)_thread_idx_map, tidx);
 }
 
+#ifdef CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE
+/* LIFO cache of unreferenced dynamic thread objects. Cached objects
+ * stay registered in the object lookup tables with their thread index
+ * still assigned, so handing one out again skips the heap allocation,
+ * the rbtree insertion and the index assignment. All their permissions
+ * are clear, so they cannot be referenced in the meantime. Protected
+ * by obj_lock.
+ */
+static struct dyn_obj
+	*thread_obj_cache[CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE_SIZE];
+static uint8_t thread_obj_cache_num;
+
+static struct z_object *thread_obj_cache_pop(void)
+{
+	struct z_object *ko = NULL;
+	k_spinlock_key_t key = k_spin_lock(&obj_lock);
+
+	if (thread_obj_cache_num > 0U) {
+		ko = &thread_obj_cache[--thread_obj_cache_num]->kobj;
+	}
+	k_spin_unlock(&obj_lock, key);
+
+	return ko;
+}
+
+/* Drop a cached object that is about to be freed explicitly. Called
+ * with objfree_lock held.
+ */
+static void thread_obj_cache_remove(struct dyn_obj *dyn)
+{
+	k_spinlock_key_t key = k_spin_lock(&obj_lock);
+
+	for (int i = 0; i < thread_obj_cache_num; i++) {
+		if (thread_obj_cache[i] == dyn) {
+			thread_obj_cache[i] =
+				thread_obj_cache[--thread_obj_cache_num];
+			break;
+		}
+	}
+	k_spin_unlock(&obj_lock, key);
+}
+#endif /* CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE */
+
 struct z_object *z_dynamic_object_create(size_t size)
 {
 	struct dyn_obj *dyn;
@@ -289,6 +350,28 @@ void *z_impl_k_object_alloc(enum k_objects otype)
 
 	switch (otype) {
 	case K_OBJ_THREAD:
+#ifdef CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE
+		zo = thread_obj_cache_pop();
+		if (zo != NULL) {
+			/* Clearing the flags first keeps the permission
+			 * sweep below from disposing of the object itself.
+			 */
+			zo->flags = 0U;
+			(void)memset(zo->perms, 0, CONFIG_MAX_THREAD_BYTES);
+
+			/* The object keeps its thread index; wipe any
+			 * permissions accumulated under that index, as
+			 * thread_idx_alloc() would.
+			 */
+			z_object_wordlist_foreach(clear_perms_cb,
+					(void *)zo->data.thread_id);
+
+			z_thread_perms_set(zo, _current);
+			zo->flags |= K_OBJ_FLAG_ALLOC;
+
+			return zo->name;
+		}
+#endif
 		if (!thread_idx_alloc(&tidx)) {
 			LOG_ERR("out of free thread indexes");
 			return NULL;
@@ -347,12 +430,17 @@ void k_object_free(void *obj)
 		sys_dlist_remove(&dyn->obj_list);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
+#ifdef CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE
+			thread_obj_cache_remove(dyn);
+#endif
 			thread_idx_free(dyn->kobj.data.thread_id);
 		}
 	}
 	k_spin_unlock(&objfree_lock, key);
 
 	if (dyn != NULL) {
+		/* Cached struct z_object pointers would dangle */
+		perm_cache_invalidate_all();
 		k_free(dyn);
 	}
 }
@@ -427,6 +515,25 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 		}
 	}
 
+#ifdef CONFIG_DYNAMIC_OBJECTS_THREAD_CACHE
+	if ((ko->flags & K_OBJ_FLAG_CACHED) != 0U) {
+		/* Already parked in the cache; a permission sweep over
+		 * the object list must not dispose of it.
+		 */
+		goto out;
+	}
+
+	if ((ko->type == K_OBJ_THREAD) &&
+	    (thread_obj_cache_num < ARRAY_SIZE(thread_obj_cache))) {
+		/* Keep the object (and its thread index) for reuse by a
+		 * later k_object_alloc(K_OBJ_THREAD).
+		 */
+		ko->flags |= K_OBJ_FLAG_CACHED;
+		thread_obj_cache[thread_obj_cache_num++] = dyn;
+		goto out;
+	}
+#endif
+
 	/* This object has no more references. Some objects may have
 	 * dynamically allocated resources, require cleanup, or need to be
 	 * marked as uninitailized when all references are gone. What
@@ -494,6 +601,7 @@ void z_thread_perms_clear(struct z_object *ko, struct k_thread *thread)
 	if (index != -1) {
 		sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
 		unref_check(ko, index);
+		perm_cache_invalidate_all();
 	}
 }
 
@@ -510,6 +618,7 @@ void z_thread_perms_all_clear(struct k_thread *thread)
 
 	if (index != -1) {
 		z_object_wordlist_foreach(clear_perms_cb, (void *)index);
+		perm_cache_invalidate_all();
 	}
 }
 
@@ -630,6 +739,82 @@ int z_object_validate(struct z_object *ko, enum k_objects otype,
 	return 0;
 }
 
+#ifdef CONFIG_KOBJECT_VALIDATION_CACHE
+int z_obj_validation_check_cached(const void *obj, enum k_objects otype,
+				  enum _obj_init_check init)
+{
+	uintptr_t gen = (uintptr_t)atomic_get(&perm_cache_generation);
+	struct z_object *ko;
+	int ret;
+
+	if (_current->perm_cache.generation != gen) {
+		/* Some permission was revoked since these entries were
+		 * cached; drop them all.
+		 */
+		for (int i = 0; i < CONFIG_KOBJECT_VALIDATION_CACHE_SIZE; i++) {
+			_current->perm_cache.obj[i] = NULL;
+		}
+		_current->perm_cache.generation = gen;
+	}
+
+	for (int i = 0; obj != NULL &&
+	     i < CONFIG_KOBJECT_VALIDATION_CACHE_SIZE; i++) {
+		if (_current->perm_cache.obj[i] != obj) {
+			continue;
+		}
+
+		ko = _current->perm_cache.ko[i];
+
+		/* Keep the hot entries in front */
+		if (i != 0) {
+			_current->perm_cache.obj[i] =
+				_current->perm_cache.obj[0];
+			_current->perm_cache.ko[i] =
+				_current->perm_cache.ko[0];
+			_current->perm_cache.obj[0] = obj;
+			_current->perm_cache.ko[0] = ko;
+		}
+
+		/* The permission test already passed for this thread;
+		 * only the cheap type and initialization state checks
+		 * remain.  On any mismatch fall through to the full
+		 * path for the proper error handling.
+		 */
+		if (unlikely((otype != K_OBJ_ANY) && (ko->type != otype))) {
+			break;
+		}
+		if ((init == _OBJ_INIT_TRUE) &&
+		    unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+			break;
+		}
+		if ((init == _OBJ_INIT_FALSE) &&
+		    unlikely((ko->flags & K_OBJ_FLAG_INITIALIZED) != 0U)) {
+			break;
+		}
+
+		return 0;
+	}
+
+	ko = z_object_find(obj);
+	ret = z_obj_validation_check(ko, obj, otype, init);
+
+	if (ret == 0) {
+		/* Insert in front, evicting the oldest entry */
+		for (int i = CONFIG_KOBJECT_VALIDATION_CACHE_SIZE - 1; i > 0;
+		     i--) {
+			_current->perm_cache.obj[i] =
+				_current->perm_cache.obj[i - 1];
+			_current->perm_cache.ko[i] =
+				_current->perm_cache.ko[i - 1];
+		}
+		_current->perm_cache.obj[0] = obj;
+		_current->perm_cache.ko[0] = ko;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_KOBJECT_VALIDATION_CACHE */
+
 void z_object_init(const void *obj)
 {
 	struct z_object *ko;
@@ -663,6 +848,7 @@ void z_object_recycle(const void *obj)
 		(void)memset(ko->perms, 0, sizeof(ko->perms));
 		z_thread_perms_set(ko, k_current_get());
 		ko->flags |= K_OBJ_FLAG_INITIALIZED;
+		perm_cache_invalidate_all();
 	}
 }
 
@@ -65,3 +65,55 @@ static inline void *z_vrfy_k_object_alloc(enum k_objects otype)
 	return z_impl_k_object_alloc(otype);
 }
 #include <syscalls/k_object_alloc_mrsh.c>
+
+#ifdef CONFIG_SYSCALL_BATCH
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *batch, size_t count)
+{
+	/* From supervisor mode there is no trap overhead to amortize,
+	 * call the APIs directly instead.
+	 */
+	ARG_UNUSED(batch);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *batch,
+					 size_t count)
+{
+	struct k_syscall_batch_entry entry;
+	size_t i;
+
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(batch, count, sizeof(entry)));
+
+	for (i = 0; i < count; i++) {
+		/* Work on a kernel-side copy of the entry so the caller
+		 * cannot change it between validation and dispatch.
+		 */
+		Z_OOPS(z_user_from_copy(&entry, &batch[i], sizeof(entry)));
+
+		/* Refuse unknown IDs and recursive batches. Elided calls
+		 * share an ID above K_SYSCALL_LIMIT with the bad syscall
+		 * handler, so they fail cleanly below as well.
+		 */
+		if (entry.id >= K_SYSCALL_LIMIT ||
+		    entry.id == K_SYSCALL_K_SYSCALL_BATCH) {
+			return -EINVAL;
+		}
+
+		entry.ret = _k_syscall_table[entry.id](entry.arg[0],
+						       entry.arg[1],
+						       entry.arg[2],
+						       entry.arg[3],
+						       entry.arg[4],
+						       entry.arg[5],
+						       _current->syscall_frame);
+
+		Z_OOPS(z_user_to_copy(&batch[i].ret, &entry.ret,
+				      sizeof(entry.ret)));
+	}
+
+	return 0;
+}
+#include <syscalls/k_syscall_batch_mrsh.c>
+#endif /* CONFIG_SYSCALL_BATCH */
@@ -36,6 +36,18 @@ void k_work_q_start(struct k_work_q *work_q, k_thread_stack_t *stack,
 	k_thread_name_set(&work_q->thread, WORKQUEUE_THREAD_NAME);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+void k_work_q_worker_start(struct k_work_q *work_q, struct k_thread *worker,
+			   k_thread_stack_t *stack, size_t stack_size,
+			   int prio)
+{
+	(void)k_thread_create(worker, stack, stack_size, z_work_q_main,
+			      work_q, NULL, NULL, prio, 0, K_NO_WAIT);
+
+	k_thread_name_set(worker, WORKQUEUE_THREAD_NAME);
+}
+#endif
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 static void work_timeout(struct _timeout *t)
 {
@@ -4,8 +4,86 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr.h>
+
 #include "lvgl_display.h"
 
+#ifdef CONFIG_LVGL_FLUSH_THREAD
+
+struct lvgl_flush_request {
+	struct _disp_drv_t *disp_drv;
+	uint16_t x;
+	uint16_t y;
+	struct display_buffer_descriptor desc;
+	void *buf;
+	bool double_write;
+};
+
+/* Depth two so that a flush of the second rendering buffer can be
+ * queued while the first one is still being transferred.
+ */
+K_MSGQ_DEFINE(flush_msgq, sizeof(struct lvgl_flush_request), 2, 4);
+
+static void lvgl_flush_thread_entry(void *p1, void *p2, void *p3)
+{
+	struct lvgl_flush_request req;
+	const struct device *display_dev;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		k_msgq_get(&flush_msgq, &req, K_FOREVER);
+		display_dev = (const struct device *)req.disp_drv->user_data;
+		display_write(display_dev, req.x, req.y, &req.desc, req.buf);
+		if (req.double_write) {
+			display_write(display_dev, req.x, req.y, &req.desc,
+				      req.buf);
+		}
+
+		lv_disp_flush_ready(req.disp_drv);
+	}
+}
+
+K_THREAD_DEFINE(lvgl_flush_thread, CONFIG_LVGL_FLUSH_THREAD_STACK_SIZE,
+		lvgl_flush_thread_entry, NULL, NULL, NULL,
+		CONFIG_LVGL_FLUSH_THREAD_PRIORITY, 0, 0);
+
+void lvgl_flush_display(struct _disp_drv_t *disp_drv, uint16_t x, uint16_t y,
+			const struct display_buffer_descriptor *desc,
+			void *buf, bool double_write)
+{
+	struct lvgl_flush_request req = {
+		.disp_drv = disp_drv,
+		.x = x,
+		.y = y,
+		.desc = *desc,
+		.buf = buf,
+		.double_write = double_write,
+	};
+
+	k_msgq_put(&flush_msgq, &req, K_FOREVER);
+}
+
+#else /* CONFIG_LVGL_FLUSH_THREAD */
+
+void lvgl_flush_display(struct _disp_drv_t *disp_drv, uint16_t x, uint16_t y,
+			const struct display_buffer_descriptor *desc,
+			void *buf, bool double_write)
+{
+	const struct device *display_dev = (const struct device *)disp_drv->user_data;
+
+	display_write(display_dev, x, y, desc, buf);
+	if (double_write) {
+		display_write(display_dev, x, y, desc, buf);
+	}
+
+	lv_disp_flush_ready(disp_drv);
+}
+
+#endif /* CONFIG_LVGL_FLUSH_THREAD */
+
 int set_lvgl_rendering_cb(lv_disp_drv_t *disp_drv)
 {
 	int err = 0;
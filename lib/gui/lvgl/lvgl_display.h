@@ -38,6 +38,18 @@ void lvgl_set_px_cb_32bit(struct _disp_drv_t *disp_drv,
 
 void lvgl_rounder_cb_mono(struct _disp_drv_t *disp_drv, lv_area_t *area);
 
+/*
+ * Push a flushed rendering buffer to the display and signal LVGL when
+ * it may be reused.  With CONFIG_LVGL_FLUSH_THREAD the transfer is
+ * performed by a dedicated thread so the caller can continue
+ * rendering; otherwise it is done in place.  double_write requests a
+ * second identical write, for controllers exposing two hardware
+ * buffers (SCREEN_INFO_DOUBLE_BUFFER).
+ */
+void lvgl_flush_display(struct _disp_drv_t *disp_drv, uint16_t x, uint16_t y,
+		const struct display_buffer_descriptor *desc,
+		void *buf, bool double_write);
+
 int set_lvgl_rendering_cb(lv_disp_drv_t *disp_drv);
 
 #ifdef __cplusplus
@@ -106,14 +106,42 @@ char *strrchr(const char *s, int c)
 
 size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *p = s;
 
-	while (*s != '\0') {
-		s++;
-		n++;
+#ifndef CONFIG_SIZE_OPTIMIZATIONS
+	const uintptr_t mask = sizeof(mem_word_t) - 1;
+	const mem_word_t ones = (mem_word_t)-1 / 0xff;	/* 0x01..01 */
+	const mem_word_t highs = ones << 7;		/* 0x80..80 */
+	const mem_word_t *w;
+
+	/* scan bytes until word-aligned */
+
+	while (((uintptr_t)p & mask) != 0) {
+		if (*p == '\0') {
+			return p - s;
+		}
+		p++;
 	}
 
-	return n;
+	/* scan whole words until one contains a zero byte; reading the
+	 * bytes of the word past the terminator is safe since an aligned
+	 * word never crosses a page boundary
+	 */
+
+	w = (const mem_word_t *)p;
+
+	while ((((*w - ones) & ~*w) & highs) == 0) {
+		w++;
+	}
+
+	p = (const char *)w;
+#endif
+
+	while (*p != '\0') {
+		p++;
+	}
+
+	return p - s;
 }
 
 /**
@@ -238,19 +266,53 @@ char *strncat(char *_MLIBC_RESTRICT dest, const char *_MLIBC_RESTRICT src,
  */
 int memcmp(const void *m1, const void *m2, size_t n)
 {
-	const char *c1 = m1;
-	const char *c2 = m2;
+	const unsigned char *c1 = m1;
+	const unsigned char *c2 = m2;
 
-	if (!n) {
-		return 0;
+#ifndef CONFIG_SIZE_OPTIMIZATIONS
+	/* attempt word-sized comparing only if buffers have identical
+	 * alignment
+	 */
+
+	const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+	if ((((uintptr_t)c1 ^ (uintptr_t)c2) & mask) == 0) {
+
+		/* do byte-sized comparing until word-aligned or finished */
+
+		while ((n > 0) && (((uintptr_t)c1 & mask) != 0)) {
+			if (*c1 != *c2) {
+				return *c1 - *c2;
+			}
+			c1++;
+			c2++;
+			n--;
+		}
+
+		/* do word-sized comparing as long as the words are equal */
+
+		while (n >= sizeof(mem_word_t) &&
+		       (*(const mem_word_t *)c1 ==
+			*(const mem_word_t *)c2)) {
+			c1 += sizeof(mem_word_t);
+			c2 += sizeof(mem_word_t);
+			n -= sizeof(mem_word_t);
+		}
 	}
+#endif
+
+	/* do byte-sized comparing until finished */
 
-	while ((--n > 0) && (*c1 == *c2)) {
+	while (n > 0) {
+		if (*c1 != *c2) {
+			return *c1 - *c2;
+		}
 		c1++;
 		c2++;
+		n--;
 	}
 
-	return *c1 - *c2;
+	return 0;
 }
 
 /**
@@ -271,12 +333,66 @@ void *memmove(void *d, const void *s, size_t n)
 		 * Copy backwards to prevent the premature corruption of <src>.
 		 */
 
+#ifndef CONFIG_SIZE_OPTIMIZATIONS
+		const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+		if ((((uintptr_t)dest ^ (uintptr_t)src) & mask) == 0) {
+
+			/* do byte-sized copying until the buffer ends are
+			 * word-aligned or finished
+			 */
+
+			while ((n > 0) &&
+			       (((uintptr_t)(dest + n) & mask) != 0)) {
+				n--;
+				dest[n] = src[n];
+			}
+
+			/* do word-sized copying as long as possible */
+
+			while (n >= sizeof(mem_word_t)) {
+				n -= sizeof(mem_word_t);
+				*(mem_word_t *)(dest + n) =
+					*(const mem_word_t *)(src + n);
+			}
+		}
+#endif
+
 		while (n > 0) {
 			n--;
 			dest[n] = src[n];
 		}
 	} else {
 		/* It is safe to perform a forward-copy */
+
+#ifndef CONFIG_SIZE_OPTIMIZATIONS
+		const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+		if ((((uintptr_t)dest ^ (uintptr_t)src) & mask) == 0) {
+
+			/* do byte-sized copying until word-aligned or
+			 * finished
+			 */
+
+			while ((n > 0) && (((uintptr_t)dest & mask) != 0)) {
+				*dest = *src;
+				dest++;
+				src++;
+				n--;
+			}
+
+			/* do word-sized copying as long as possible */
+
+			while (n >= sizeof(mem_word_t)) {
+				*(mem_word_t *)dest =
+					*(const mem_word_t *)src;
+				dest += sizeof(mem_word_t);
+				src += sizeof(mem_word_t);
+				n -= sizeof(mem_word_t);
+			}
+		}
+#endif
+
 		while (n > 0) {
 			*dest = *src;
 			dest++;
@@ -301,6 +417,8 @@ void *memcpy(void *_MLIBC_RESTRICT d, const void *_MLIBC_RESTRICT s, size_t n)
 
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
+
+#ifndef CONFIG_SIZE_OPTIMIZATIONS
 	const uintptr_t mask = sizeof(mem_word_t) - 1;
 
 	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
@@ -328,6 +446,7 @@ void *memcpy(void *_MLIBC_RESTRICT d, const void *_MLIBC_RESTRICT s, size_t n)
 		d_byte = (unsigned char *)d_word;
 		s_byte = (unsigned char *)s_word;
 	}
+#endif
 
 	/* do byte-sized copying until finished */
 
@@ -348,11 +467,12 @@ void *memcpy(void *_MLIBC_RESTRICT d, const void *_MLIBC_RESTRICT s, size_t n)
 
 void *memset(void *buf, int c, size_t n)
 {
-	/* do byte-sized initialization until word-aligned or finished */
-
 	unsigned char *d_byte = (unsigned char *)buf;
 	unsigned char c_byte = (unsigned char)c;
 
+#ifndef CONFIG_SIZE_OPTIMIZATIONS
+	/* do byte-sized initialization until word-aligned or finished */
+
 	while (((uintptr_t)d_byte) & (sizeof(mem_word_t) - 1)) {
 		if (n == 0) {
 			return buf;
@@ -377,9 +497,10 @@ void *memset(void *buf, int c, size_t n)
 		n -= sizeof(mem_word_t);
 	}
 
-	/* do byte-sized initialization until finished */
-
 	d_byte = (unsigned char *)d_word;
+#endif
+
+	/* do byte-sized initialization until finished */
 
 	while (n > 0) {
 		*(d_byte++) = c_byte;
@@ -52,7 +52,8 @@ static struct fw_resource_table __resource resource_table = {
 #if (CONFIG_OPENAMP_RSC_TABLE_NUM_RPMSG_BUFF > 0)
 	/* Virtio device entry */
 	.vdev = {
-		RSC_VDEV, VIRTIO_ID_RPMSG, 0, RPMSG_IPU_C0_FEATURES, 0, 0, 0,
+		RSC_VDEV, VIRTIO_ID_RPMSG, 0, RPMSG_IPU_C0_FEATURES, 0,
+		sizeof(struct fw_rsc_vdev_config), 0,
 		VRING_COUNT, {0, 0},
 	},
 
@@ -63,6 +64,12 @@ static struct fw_resource_table __resource resource_table = {
 	.vring1 = {VRING_RX_ADDRESS, VRING_ALIGNMENT,
 		   CONFIG_OPENAMP_RSC_TABLE_NUM_RPMSG_BUFF,
 		   VRING1_ID, 0},
+
+	/* Virtio device config space - advertises the buffer geometry */
+	.vdev_cfg = {
+		CONFIG_OPENAMP_RSC_TABLE_RPMSG_BUFF_SIZE,
+		CONFIG_OPENAMP_RSC_TABLE_RPMSG_BUFF_SIZE,
+	},
 #endif
 
 #if defined(CONFIG_RAM_CONSOLE)
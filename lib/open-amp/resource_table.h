@@ -26,6 +26,21 @@
 
 #endif
 
+/*
+ * Virtio device configuration space, placed after the vring entries as
+ * mandated by the remoteproc resource table layout.  It advertises the
+ * size of the individual RPMsg buffers so that a master supporting
+ * non-default geometries can size the vring buffers accordingly;
+ * masters that only implement the fixed 512-byte layout simply ignore
+ * the config space.
+ */
+struct fw_rsc_vdev_config {
+	/* Host-to-remote buffer size, in bytes */
+	uint32_t h2r_buf_size;
+	/* Remote-to-host buffer size, in bytes */
+	uint32_t r2h_buf_size;
+} METAL_PACKED_END;
+
 enum rsc_table_entries {
 #if (CONFIG_OPENAMP_RSC_TABLE_NUM_RPMSG_BUFF > 0)
 	RSC_TABLE_VDEV_ENTRY,
@@ -45,6 +60,7 @@ struct fw_resource_table {
 	struct fw_rsc_vdev vdev;
 	struct fw_rsc_vdev_vring vring0;
 	struct fw_rsc_vdev_vring vring1;
+	struct fw_rsc_vdev_config vdev_cfg;
 
 #if defined(CONFIG_RAM_CONSOLE)
 	/* rpmsg trace entry */
@@ -69,4 +85,9 @@ inline struct fw_rsc_vdev_vring *rsc_table_get_vring1(void *rsc_table)
 	return &((struct fw_resource_table *)rsc_table)->vring1;
 }
 
+inline struct fw_rsc_vdev_config *rsc_table_get_vdev_config(void *rsc_table)
+{
+	return &((struct fw_resource_table *)rsc_table)->vdev_cfg;
+}
+
 #endif
@@ -61,6 +61,26 @@ static int z_fd_ref(int fd)
 	return atomic_inc(&fdtable[fd].refcount) + 1;
 }
 
+#ifdef CONFIG_POSIX_API
+/* Take an additional reference on an entry which is already in use, so that
+ * a concurrent close() cannot release and recycle the slot while one of its
+ * vmethods is running. Fails for an unused entry.
+ */
+static bool z_fd_ref_inuse(int fd)
+{
+	atomic_val_t old_rc;
+
+	do {
+		old_rc = atomic_get(&fdtable[fd].refcount);
+		if (!old_rc) {
+			return false;
+		}
+	} while (!atomic_cas(&fdtable[fd].refcount, old_rc, old_rc + 1));
+
+	return true;
+}
+#endif /* CONFIG_POSIX_API */
+
 static int z_fd_unref(int fd)
 {
 	atomic_val_t old_rc;
@@ -81,8 +101,12 @@ static int z_fd_unref(int fd)
 		return old_rc - 1;
 	}
 
+	/* Unpublish in reverse order of z_finalize_fd(): lock-free lookups
+	 * read the vtable first and treat NULL as EBADF, so they never see
+	 * the object pointer of a released entry.
+	 */
+	__atomic_store_n(&fdtable[fd].vtable, NULL, __ATOMIC_RELEASE);
 	fdtable[fd].obj = NULL;
-	fdtable[fd].vtable = NULL;
 
 	return 0;
 }
@@ -118,8 +142,55 @@ static int _check_fd(int fd)
 	return 0;
 }
 
+#ifdef CONFIG_POSIX_API
+/* Lock-free entry to a vmethod call: pins the entry with its reference
+ * counter and takes a consistent snapshot of the object and vtable, without
+ * touching fdtable_lock. Must be paired with _fd_op_end() once the vmethod
+ * returns. Returns NULL (and sets errno to EBADF) for an entry which is
+ * unused or still being set up by z_finalize_fd().
+ */
+static const struct fd_op_vtable *_fd_op_begin(int fd, void **obj)
+{
+	const struct fd_op_vtable *vtable;
+
+	if (fd < 0 || fd >= ARRAY_SIZE(fdtable)) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	fd = k_array_index_sanitize(fd, ARRAY_SIZE(fdtable));
+
+	if (!z_fd_ref_inuse(fd)) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	/* Pairs with the release store in z_finalize_fd(): observing the
+	 * vtable pointer guarantees that the object stored before it is
+	 * visible as well.
+	 */
+	vtable = __atomic_load_n(&fdtable[fd].vtable, __ATOMIC_ACQUIRE);
+	if (vtable == NULL) {
+		/* Reserved by z_reserve_fd() but not finalized yet. */
+		(void)z_fd_unref(fd);
+		errno = EBADF;
+		return NULL;
+	}
+
+	*obj = fdtable[fd].obj;
+
+	return vtable;
+}
+
+static void _fd_op_end(int fd)
+{
+	(void)z_fd_unref(fd);
+}
+#endif /* CONFIG_POSIX_API */
+
 void *z_get_fd_obj(int fd, const struct fd_op_vtable *vtable, int err)
 {
+	const struct fd_op_vtable *entry_vtable;
 	struct fd_entry *fd_entry;
 
 	if (_check_fd(fd) < 0) {
@@ -127,8 +198,9 @@ void *z_get_fd_obj(int fd, const struct fd_op_vtable *vtable, int err)
 	}
 
 	fd_entry = &fdtable[fd];
+	entry_vtable = __atomic_load_n(&fd_entry->vtable, __ATOMIC_ACQUIRE);
 
-	if (vtable != NULL && fd_entry->vtable != vtable) {
+	if (entry_vtable == NULL || (vtable != NULL && entry_vtable != vtable)) {
 		errno = err;
 		return NULL;
 	}
@@ -145,7 +217,12 @@ void *z_get_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable)
 	}
 
 	fd_entry = &fdtable[fd];
-	*vtable = fd_entry->vtable;
+	*vtable = __atomic_load_n(&fd_entry->vtable, __ATOMIC_ACQUIRE);
+
+	if (*vtable == NULL) {
+		errno = EBADF;
+		return NULL;
+	}
 
 	return fd_entry->obj;
 }
@@ -183,7 +260,12 @@ void z_finalize_fd(int fd, void *obj, const struct fd_op_vtable *vtable)
 	z_object_recycle(obj);
 #endif
 	fdtable[fd].obj = obj;
-	fdtable[fd].vtable = vtable;
+	/* The vtable pointer publishes the entry: lock-free lookups treat a
+	 * NULL vtable as a descriptor which is still being set up, and the
+	 * release store guarantees they never observe the vtable without
+	 * the object stored above it.
+	 */
+	__atomic_store_n(&fdtable[fd].vtable, vtable, __ATOMIC_RELEASE);
 }
 
 void z_free_fd(int fd)
@@ -208,34 +290,56 @@ int z_alloc_fd(void *obj, const struct fd_op_vtable *vtable)
 
 ssize_t read(int fd, void *buf, size_t sz)
 {
-	if (_check_fd(fd) < 0) {
+	const struct fd_op_vtable *vtable;
+	void *obj;
+	ssize_t res;
+
+	vtable = _fd_op_begin(fd, &obj);
+	if (vtable == NULL) {
 		return -1;
 	}
 
-	return fdtable[fd].vtable->read(fdtable[fd].obj, buf, sz);
+	res = vtable->read(obj, buf, sz);
+
+	_fd_op_end(fd);
+
+	return res;
 }
 FUNC_ALIAS(read, _read, ssize_t);
 
 ssize_t write(int fd, const void *buf, size_t sz)
 {
-	if (_check_fd(fd) < 0) {
+	const struct fd_op_vtable *vtable;
+	void *obj;
+	ssize_t res;
+
+	vtable = _fd_op_begin(fd, &obj);
+	if (vtable == NULL) {
 		return -1;
 	}
 
-	return fdtable[fd].vtable->write(fdtable[fd].obj, buf, sz);
+	res = vtable->write(obj, buf, sz);
+
+	_fd_op_end(fd);
+
+	return res;
 }
 FUNC_ALIAS(write, _write, ssize_t);
 
 int close(int fd)
 {
+	const struct fd_op_vtable *vtable;
+	void *obj;
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	vtable = _fd_op_begin(fd, &obj);
+	if (vtable == NULL) {
 		return -1;
 	}
 
-	res = fdtable[fd].vtable->close(fdtable[fd].obj);
+	res = vtable->close(obj);
 
+	_fd_op_end(fd);
 	z_free_fd(fd);
 
 	return res;
@@ -244,46 +348,72 @@ FUNC_ALIAS(close, _close, int);
 
 int fsync(int fd)
 {
-	if (_check_fd(fd) < 0) {
+	const struct fd_op_vtable *vtable;
+	void *obj;
+	int res;
+
+	vtable = _fd_op_begin(fd, &obj);
+	if (vtable == NULL) {
 		return -1;
 	}
 
-	return z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_FSYNC);
+	res = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_FSYNC);
+
+	_fd_op_end(fd);
+
+	return res;
 }
 
 off_t lseek(int fd, off_t offset, int whence)
 {
-	if (_check_fd(fd) < 0) {
+	const struct fd_op_vtable *vtable;
+	void *obj;
+	off_t res;
+
+	vtable = _fd_op_begin(fd, &obj);
+	if (vtable == NULL) {
 		return -1;
 	}
 
-	return z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_LSEEK,
-			  offset, whence);
+	res = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_LSEEK,
+				   offset, whence);
+
+	_fd_op_end(fd);
+
+	return res;
 }
 FUNC_ALIAS(lseek, _lseek, off_t);
 
 int ioctl(int fd, unsigned long request, ...)
 {
+	const struct fd_op_vtable *vtable;
+	void *obj;
 	va_list args;
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	vtable = _fd_op_begin(fd, &obj);
+	if (vtable == NULL) {
 		return -1;
 	}
 
 	va_start(args, request);
-	res = fdtable[fd].vtable->ioctl(fdtable[fd].obj, request, args);
+	res = vtable->ioctl(obj, request, args);
 	va_end(args);
 
+	_fd_op_end(fd);
+
 	return res;
 }
 
 int fcntl(int fd, int cmd, ...)
 {
+	const struct fd_op_vtable *vtable;
+	void *obj;
 	va_list args;
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	vtable = _fd_op_begin(fd, &obj);
+	if (vtable == NULL) {
 		return -1;
 	}
 
@@ -291,15 +421,18 @@ int fcntl(int fd, int cmd, ...)
 	switch (cmd) {
 	case F_DUPFD:
 		/* Not implemented so far. */
+		_fd_op_end(fd);
 		errno = EINVAL;
 		return -1;
 	}
 
 	/* The rest of commands are per-fd, handled by ioctl vmethod. */
 	va_start(args, cmd);
-	res = fdtable[fd].vtable->ioctl(fdtable[fd].obj, cmd, args);
+	res = vtable->ioctl(obj, cmd, args);
 	va_end(args);
 
+	_fd_op_end(fd);
+
 	return res;
 }
 
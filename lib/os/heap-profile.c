@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <sys/sys_heap.h>
+#include <kernel.h>
+#include <string.h>
+#include "heap.h"
+
+/* Sampling allocation profiler.  Each sampled sys_heap allocation is
+ * attributed to its call site (the return address of the sys_heap API
+ * call) in a small fixed-size hash table, recording allocation counts,
+ * a power-of-two size histogram, live bytes and their high-water mark.
+ * Live byte accounting additionally needs the pointer-to-site mapping
+ * of every sampled allocation, which is kept in a second fixed-size
+ * table; when that table is full further allocations are still counted
+ * but not tracked for liveness.
+ *
+ * In-place sys_heap_realloc() resizes are not tracked: the block keeps
+ * the size it was sampled with until it is freed.  The fallback
+ * realloc path goes through sys_heap_alloc()/sys_heap_free() and is
+ * accounted like any other allocation.
+ */
+
+struct profile_site {
+	void *site;
+	uint32_t alloc_count;
+	uint32_t live_bytes;
+	uint32_t peak_bytes;
+	uint32_t size_hist[SYS_HEAP_PROFILE_HIST_BUCKETS];
+};
+
+struct profile_track {
+	void *mem;
+	uint32_t bytes;
+	uint16_t site_idx;
+};
+
+static struct profile_site sites[CONFIG_SYS_HEAP_PROFILE_NUM_SITES];
+static struct profile_track tracked[CONFIG_SYS_HEAP_PROFILE_TRACKED];
+static uint32_t sample_countdown = 1;
+static struct k_spinlock profile_lock;
+
+static int size_bucket(size_t bytes)
+{
+	size_t limit = 16;
+	int i = 0;
+
+	while (bytes > limit && i < SYS_HEAP_PROFILE_HIST_BUCKETS - 1) {
+		limit <<= 1;
+		i++;
+	}
+
+	return i;
+}
+
+static struct profile_site *site_find(void *site)
+{
+	int idx = ((uintptr_t)site >> 2) % ARRAY_SIZE(sites);
+
+	for (int i = 0; i < ARRAY_SIZE(sites); i++) {
+		struct profile_site *s = &sites[idx];
+
+		if (s->site == site || s->site == NULL) {
+			return s;
+		}
+		idx = (idx + 1) % ARRAY_SIZE(sites);
+	}
+
+	return NULL;
+}
+
+void z_heap_profile_alloc(void *site, void *mem, size_t bytes)
+{
+	struct profile_site *s;
+	k_spinlock_key_t key;
+
+	if (mem == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&profile_lock);
+
+	if (--sample_countdown != 0U) {
+		k_spin_unlock(&profile_lock, key);
+		return;
+	}
+	sample_countdown = CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE;
+
+	s = site_find(site);
+	if (s == NULL) {
+		/* Table full, sample is dropped */
+		k_spin_unlock(&profile_lock, key);
+		return;
+	}
+
+	s->site = site;
+	s->alloc_count++;
+	s->size_hist[size_bucket(bytes)]++;
+
+	for (int i = 0; i < ARRAY_SIZE(tracked); i++) {
+		if (tracked[i].mem == NULL) {
+			tracked[i].mem = mem;
+			tracked[i].bytes = (uint32_t)bytes;
+			tracked[i].site_idx = (uint16_t)(s - sites);
+			s->live_bytes += (uint32_t)bytes;
+			if (s->live_bytes > s->peak_bytes) {
+				s->peak_bytes = s->live_bytes;
+			}
+			break;
+		}
+	}
+
+	k_spin_unlock(&profile_lock, key);
+}
+
+void z_heap_profile_free(void *mem)
+{
+	k_spinlock_key_t key = k_spin_lock(&profile_lock);
+
+	for (int i = 0; i < ARRAY_SIZE(tracked); i++) {
+		if (tracked[i].mem == mem) {
+			sites[tracked[i].site_idx].live_bytes -=
+				tracked[i].bytes;
+			tracked[i].mem = NULL;
+			break;
+		}
+	}
+
+	k_spin_unlock(&profile_lock, key);
+}
+
+bool sys_heap_profile_site_get(int idx, struct sys_heap_profile_site *site)
+{
+	k_spinlock_key_t key;
+	bool used;
+
+	if (idx < 0 || idx >= ARRAY_SIZE(sites)) {
+		return false;
+	}
+
+	key = k_spin_lock(&profile_lock);
+
+	used = sites[idx].site != NULL;
+	if (used) {
+		site->site = sites[idx].site;
+		site->alloc_count = sites[idx].alloc_count;
+		site->live_bytes = sites[idx].live_bytes;
+		site->peak_bytes = sites[idx].peak_bytes;
+		memcpy(site->size_hist, sites[idx].size_hist,
+		       sizeof(site->size_hist));
+	}
+
+	k_spin_unlock(&profile_lock, key);
+
+	return used;
+}
+
+void sys_heap_profile_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&profile_lock);
+
+	(void)memset(sites, 0, sizeof(sites));
+	(void)memset(tracked, 0, sizeof(tracked));
+	sample_countdown = 1;
+
+	k_spin_unlock(&profile_lock, key);
+}
+
+static void put_u32_le(uint8_t *buf, uint32_t val)
+{
+	buf[0] = (uint8_t)val;
+	buf[1] = (uint8_t)(val >> 8);
+	buf[2] = (uint8_t)(val >> 16);
+	buf[3] = (uint8_t)(val >> 24);
+}
+
+#define PROFILE_DUMP_MAGIC	0x46525048 /* "HPRF" */
+#define PROFILE_DUMP_VERSION	1
+#define PROFILE_DUMP_HDR_SIZE	16
+/* The site address is always serialized as 64 bits so that the record
+ * layout does not depend on the target pointer size.
+ */
+#define PROFILE_DUMP_REC_SIZE	(8 + 4 * (3 + SYS_HEAP_PROFILE_HIST_BUCKETS))
+
+size_t sys_heap_profile_dump(uint8_t *buf, size_t buf_size)
+{
+	k_spinlock_key_t key;
+	uint32_t count = 0;
+	size_t off = PROFILE_DUMP_HDR_SIZE;
+
+	if (buf_size < PROFILE_DUMP_HDR_SIZE) {
+		return 0;
+	}
+
+	key = k_spin_lock(&profile_lock);
+
+	for (int i = 0; i < ARRAY_SIZE(sites); i++) {
+		struct profile_site *s = &sites[i];
+
+		if (s->site == NULL ||
+		    (buf_size - off) < PROFILE_DUMP_REC_SIZE) {
+			continue;
+		}
+
+		uint64_t site_addr = (uint64_t)(uintptr_t)s->site;
+
+		put_u32_le(&buf[off], (uint32_t)site_addr);
+		put_u32_le(&buf[off + 4], (uint32_t)(site_addr >> 32));
+		put_u32_le(&buf[off + 8], s->alloc_count);
+		put_u32_le(&buf[off + 12], s->live_bytes);
+		put_u32_le(&buf[off + 16], s->peak_bytes);
+		for (int b = 0; b < SYS_HEAP_PROFILE_HIST_BUCKETS; b++) {
+			put_u32_le(&buf[off + 20 + 4 * b], s->size_hist[b]);
+		}
+		off += PROFILE_DUMP_REC_SIZE;
+		count++;
+	}
+
+	k_spin_unlock(&profile_lock, key);
+
+	put_u32_le(&buf[0], PROFILE_DUMP_MAGIC);
+	buf[4] = PROFILE_DUMP_VERSION;
+	buf[5] = sizeof(void *);
+	buf[6] = (uint8_t)count;
+	buf[7] = (uint8_t)(count >> 8);
+	put_u32_le(&buf[8], CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE);
+	put_u32_le(&buf[12], PROFILE_DUMP_REC_SIZE);
+
+	return off;
+}
@@ -5,6 +5,7 @@
  */
 #include <sys/sys_heap.h>
 #include <kernel.h>
+#include <string.h>
 #include "heap.h"
 
 static void *chunk_mem(struct z_heap *h, chunkid_t c)
@@ -143,6 +144,7 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 	if (mem == NULL) {
 		return; /* ISO C free() semantics */
 	}
+	z_heap_profile_free(mem);
 	struct z_heap *h = heap->heap;
 	chunkid_t c = mem_to_chunkid(h, mem);
 
@@ -166,6 +168,20 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 	free_chunk(h, c);
 }
 
+size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
+{
+	struct z_heap *h = heap->heap;
+	chunkid_t c = mem_to_chunkid(h, mem);
+
+	CHECK(chunk_used(h, c));
+
+	/* The aligned allocator may hand out a pointer past the chunk
+	 * header, so measure from the pointer to the chunk's end.
+	 */
+	return chunk_size(h, c) * CHUNK_UNIT -
+	       ((uint8_t *)mem - (uint8_t *)&chunk_buf(h)[c]);
+}
+
 static chunkid_t alloc_chunk(struct z_heap *h, size_t sz)
 {
 	int bi = bucket_idx(h, sz);
@@ -240,7 +256,11 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	set_chunk_used(h, c, true);
-	return chunk_mem(h, c);
+
+	void *mem = chunk_mem(h, c);
+
+	z_heap_profile_alloc(__builtin_return_address(0), mem, bytes);
+	return mem;
 }
 
 void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
@@ -290,9 +310,73 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	}
 
 	set_chunk_used(h, c, true);
+
+	z_heap_profile_alloc(__builtin_return_address(0), mem, bytes);
 	return mem;
 }
 
+void *sys_heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
+{
+	/* special realloc semantics */
+	if (ptr == NULL) {
+		return sys_heap_alloc(heap, bytes);
+	}
+	if (bytes == 0) {
+		sys_heap_free(heap, ptr);
+		return NULL;
+	}
+
+	struct z_heap *h = heap->heap;
+	chunkid_t c = mem_to_chunkid(h, ptr);
+	chunkid_t rc = right_chunk(h, c);
+
+	/* Memory from the aligned allocator may start past the chunk
+	 * header; that gap must stay part of the chunk.
+	 */
+	size_t align_gap = (uint8_t *)ptr - (uint8_t *)chunk_mem(h, c);
+	size_t chunks_need = bytes_to_chunksz(h, align_gap + bytes);
+
+	__ASSERT(chunk_used(h, c),
+		 "unexpected heap state (double-free?) for memory at %p", ptr);
+
+	if (chunk_size(h, c) == chunks_need) {
+		/* We're good already */
+		return ptr;
+	} else if (chunk_size(h, c) > chunks_need) {
+		/* Shrink in place, split off and free the unused suffix */
+		split_chunks(h, c, c + chunks_need);
+		set_chunk_used(h, c, true);
+		free_chunk(h, c + chunks_need);
+		return ptr;
+	} else if (!chunk_used(h, rc) &&
+		   (chunk_size(h, c) + chunk_size(h, rc) >= chunks_need)) {
+		/* Grow in place by eating into the free right chunk */
+		size_t split_size = chunks_need - chunk_size(h, c);
+
+		free_list_remove(h, rc);
+
+		if (split_size < chunk_size(h, rc)) {
+			split_chunks(h, rc, rc + split_size);
+			free_list_add(h, rc + split_size);
+		}
+
+		merge_chunks(h, c, rc);
+		set_chunk_used(h, c, true);
+		return ptr;
+	}
+
+	/* Fallback: allocate and copy */
+	void *ptr2 = sys_heap_alloc(heap, bytes);
+
+	if (ptr2 != NULL) {
+		size_t prev_size = sys_heap_usable_size(heap, ptr);
+
+		memcpy(ptr2, ptr, MIN(prev_size, bytes));
+		sys_heap_free(heap, ptr);
+	}
+	return ptr2;
+}
+
 void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 {
 	/* Must fit in a 32 bit count of HUNK_UNIT */
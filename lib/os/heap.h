@@ -20,6 +20,17 @@
 #define CHECK(x) /**/
 #endif
 
+/* Allocation profiling hooks, see heap-profile.c.  The site parameter
+ * is the return address of the sys_heap API call being recorded.
+ */
+#ifdef CONFIG_SYS_HEAP_PROFILE
+void z_heap_profile_alloc(void *site, void *mem, size_t bytes);
+void z_heap_profile_free(void *mem);
+#else
+#define z_heap_profile_alloc(site, mem, bytes) do {} while (false)
+#define z_heap_profile_free(mem) do {} while (false)
+#endif
+
 /* Chunks are identified by their offset in 8 byte units from the
  * first address in the buffer (a zero-valued chunkid_t is used as a
  * null; that chunk would always point into the metadata at the start
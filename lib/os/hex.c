@@ -39,17 +39,20 @@ int hex2char(uint8_t x, char *c)
 
 size_t bin2hex(const uint8_t *buf, size_t buflen, char *hex, size_t hexlen)
 {
+	static const char hex_chars[] = "0123456789abcdef";
+
 	if ((hexlen + 1) < buflen * 2) {
 		return 0;
 	}
 
+	/* A nibble can't be out of range, so unlike the chars in
+	 * hex2bin() there is nothing to validate per byte; straight
+	 * table lookups replace the hex2char() calls and their error
+	 * branches in the hot loop.
+	 */
 	for (size_t i = 0; i < buflen; i++) {
-		if (hex2char(buf[i] >> 4, &hex[2 * i]) < 0) {
-			return 0;
-		}
-		if (hex2char(buf[i] & 0xf, &hex[2 * i + 1]) < 0) {
-			return 0;
-		}
+		hex[2 * i] = hex_chars[buf[i] >> 4];
+		hex[2 * i + 1] = hex_chars[buf[i] & 0xf];
 	}
 
 	hex[2 * buflen] = '\0';
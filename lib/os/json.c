@@ -17,6 +17,10 @@
 
 #include <data/json.h>
 
+#ifdef CONFIG_RING_BUFFER
+#include <sys/ring_buffer.h>
+#endif
+
 struct token {
 	enum json_tokens type;
 	char *start;
@@ -936,3 +940,347 @@ ssize_t json_calc_encoded_len(const struct json_obj_descr *descr,
 
 	return total;
 }
+
+enum json_stream_state {
+	JSON_STREAM_EXPECT_OBJECT,
+	JSON_STREAM_KEY,
+	JSON_STREAM_KEY_STRING,
+	JSON_STREAM_COLON,
+	JSON_STREAM_VALUE,
+	JSON_STREAM_VALUE_STRING,
+	JSON_STREAM_VALUE_PRIMITIVE,
+	JSON_STREAM_VALUE_NESTED,
+	JSON_STREAM_AFTER_VALUE,
+	JSON_STREAM_DONE,
+};
+
+void json_stream_init(struct json_stream *js,
+		      const struct json_obj_descr *descr, size_t descr_len,
+		      char *scratch, size_t scratch_size,
+		      json_stream_field_cb_t on_field, void *user_data)
+{
+	*js = (struct json_stream) {
+		.descr = descr,
+		.descr_len = descr_len,
+		.on_field = on_field,
+		.user_data = user_data,
+		.scratch = scratch,
+		.scratch_size = scratch_size,
+		.state = JSON_STREAM_EXPECT_OBJECT,
+	};
+}
+
+static int stream_save(struct json_stream *js, const char *start,
+		       const char *end)
+{
+	size_t amount = end - start;
+
+	if (js->scratch_len + amount > js->scratch_size) {
+		return -ENOMEM;
+	}
+
+	memcpy(js->scratch + js->scratch_len, start, amount);
+	js->scratch_len += amount;
+
+	return 0;
+}
+
+/* Resolves the token that ends at pos: zero-copy out of the current
+ * chunk unless a prefix was carried over in the scratch buffer.
+ */
+static int stream_close_token(struct json_stream *js, const char *tok_start,
+			      const char *pos, const char **value,
+			      size_t *value_len)
+{
+	if (js->scratch_len > 0) {
+		int ret = stream_save(js, tok_start, pos);
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		*value = js->scratch;
+		*value_len = js->scratch_len;
+		js->scratch_len = 0;
+	} else {
+		*value = tok_start;
+		*value_len = pos - tok_start;
+	}
+
+	return 0;
+}
+
+static void stream_match_key(struct json_stream *js, const char *key,
+			     size_t key_len)
+{
+	size_t i;
+
+	js->field = NULL;
+	for (i = 0; i < js->descr_len; i++) {
+		if (js->descr[i].field_name_len == key_len &&
+		    memcmp(js->descr[i].field_name, key, key_len) == 0) {
+			js->field = &js->descr[i];
+			return;
+		}
+	}
+}
+
+static int stream_report(struct json_stream *js, enum json_tokens type,
+			 const char *value, size_t value_len)
+{
+	const struct json_obj_descr *field = js->field;
+
+	js->field = NULL;
+
+	if (field == NULL || js->on_field == NULL) {
+		return 0;
+	}
+
+	if (!equivalent_types(type, field->type)) {
+		return -EINVAL;
+	}
+
+	return js->on_field(field, value, value_len, type, js->user_data);
+}
+
+static int stream_primitive(struct json_stream *js, const char *value,
+			    size_t value_len)
+{
+	enum json_tokens type;
+	size_t i;
+
+	if (value_len == 4 && memcmp(value, "true", 4) == 0) {
+		type = JSON_TOK_TRUE;
+	} else if (value_len == 5 && memcmp(value, "false", 5) == 0) {
+		type = JSON_TOK_FALSE;
+	} else if (value_len == 4 && memcmp(value, "null", 4) == 0) {
+		type = JSON_TOK_NULL;
+	} else {
+		if (value_len == 0) {
+			return -EINVAL;
+		}
+
+		for (i = 0; i < value_len; i++) {
+			if (strchr("0123456789+-.eE", value[i]) == NULL) {
+				return -EINVAL;
+			}
+		}
+
+		type = JSON_TOK_NUMBER;
+	}
+
+	return stream_report(js, type, value, value_len);
+}
+
+static bool stream_isspace(char chr)
+{
+	return chr == ' ' || chr == '\t' || chr == '\r' || chr == '\n';
+}
+
+int json_stream_feed(struct json_stream *js, const char *data, size_t len)
+{
+	const char *pos = data;
+	const char *end = data + len;
+	const char *tok_start = NULL;
+	const char *value;
+	size_t value_len;
+	int ret;
+
+	/* A token left open by the previous chunk continues here; its
+	 * prefix is already staged in the scratch buffer.
+	 */
+	if (js->state == JSON_STREAM_KEY_STRING ||
+	    js->state == JSON_STREAM_VALUE_STRING ||
+	    js->state == JSON_STREAM_VALUE_PRIMITIVE) {
+		tok_start = data;
+	}
+
+	while (pos < end) {
+		char chr = *pos;
+
+		switch (js->state) {
+		case JSON_STREAM_EXPECT_OBJECT:
+			if (stream_isspace(chr)) {
+				pos++;
+			} else if (chr == '{') {
+				js->state = JSON_STREAM_KEY;
+				pos++;
+			} else {
+				return -EINVAL;
+			}
+			break;
+		case JSON_STREAM_KEY:
+			if (stream_isspace(chr)) {
+				pos++;
+			} else if (chr == '"') {
+				js->state = JSON_STREAM_KEY_STRING;
+				pos++;
+				tok_start = pos;
+			} else if (chr == '}') {
+				js->state = JSON_STREAM_DONE;
+				pos++;
+			} else {
+				return -EINVAL;
+			}
+			break;
+		case JSON_STREAM_KEY_STRING:
+		case JSON_STREAM_VALUE_STRING:
+			if (js->escape) {
+				js->escape = 0;
+				pos++;
+			} else if (chr == '\\') {
+				js->escape = 1;
+				pos++;
+			} else if (chr == '"') {
+				ret = stream_close_token(js, tok_start, pos,
+							 &value, &value_len);
+				if (ret < 0) {
+					return ret;
+				}
+
+				if (js->state == JSON_STREAM_KEY_STRING) {
+					stream_match_key(js, value, value_len);
+					js->state = JSON_STREAM_COLON;
+				} else {
+					ret = stream_report(js,
+							    JSON_TOK_STRING,
+							    value, value_len);
+					if (ret != 0) {
+						return ret;
+					}
+					js->state = JSON_STREAM_AFTER_VALUE;
+				}
+				tok_start = NULL;
+				pos++;
+			} else {
+				pos++;
+			}
+			break;
+		case JSON_STREAM_COLON:
+			if (stream_isspace(chr)) {
+				pos++;
+			} else if (chr == ':') {
+				js->state = JSON_STREAM_VALUE;
+				pos++;
+			} else {
+				return -EINVAL;
+			}
+			break;
+		case JSON_STREAM_VALUE:
+			if (stream_isspace(chr)) {
+				pos++;
+			} else if (chr == '"') {
+				js->state = JSON_STREAM_VALUE_STRING;
+				pos++;
+				tok_start = pos;
+			} else if (chr == '{' || chr == '[') {
+				js->depth = 1;
+				js->nested_in_string = 0;
+				js->state = JSON_STREAM_VALUE_NESTED;
+				pos++;
+			} else {
+				js->state = JSON_STREAM_VALUE_PRIMITIVE;
+				tok_start = pos;
+				pos++;
+			}
+			break;
+		case JSON_STREAM_VALUE_PRIMITIVE:
+			if (chr == ',' || chr == '}' || stream_isspace(chr)) {
+				ret = stream_close_token(js, tok_start, pos,
+							 &value, &value_len);
+				if (ret < 0) {
+					return ret;
+				}
+
+				ret = stream_primitive(js, value, value_len);
+				if (ret != 0) {
+					return ret;
+				}
+
+				js->state = JSON_STREAM_AFTER_VALUE;
+				tok_start = NULL;
+				/* Terminator is reprocessed above */
+			} else {
+				pos++;
+			}
+			break;
+		case JSON_STREAM_VALUE_NESTED:
+			/* Nested containers are skipped, not decoded;
+			 * only string/bracket structure is tracked.
+			 */
+			if (js->nested_in_string) {
+				if (js->escape) {
+					js->escape = 0;
+				} else if (chr == '\\') {
+					js->escape = 1;
+				} else if (chr == '"') {
+					js->nested_in_string = 0;
+				}
+			} else if (chr == '"') {
+				js->nested_in_string = 1;
+			} else if (chr == '{' || chr == '[') {
+				if (js->depth == UINT8_MAX) {
+					return -E2BIG;
+				}
+				js->depth++;
+			} else if (chr == '}' || chr == ']') {
+				js->depth--;
+				if (js->depth == 0) {
+					js->field = NULL;
+					js->state = JSON_STREAM_AFTER_VALUE;
+				}
+			}
+			pos++;
+			break;
+		case JSON_STREAM_AFTER_VALUE:
+			if (stream_isspace(chr)) {
+				pos++;
+			} else if (chr == ',') {
+				js->state = JSON_STREAM_KEY;
+				pos++;
+			} else if (chr == '}') {
+				js->state = JSON_STREAM_DONE;
+				pos++;
+			} else {
+				return -EINVAL;
+			}
+			break;
+		case JSON_STREAM_DONE:
+			if (!stream_isspace(chr)) {
+				return -EINVAL;
+			}
+			pos++;
+			break;
+		}
+	}
+
+	if (tok_start != NULL) {
+		ret = stream_save(js, tok_start, end);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return js->state == JSON_STREAM_DONE ? 1 : 0;
+}
+
+#ifdef CONFIG_RING_BUFFER
+static int append_bytes_to_ring_buf(const char *bytes, size_t len, void *data)
+{
+	struct ring_buf *ringbuf = data;
+
+	if (ring_buf_put(ringbuf, (const uint8_t *)bytes, len) != len) {
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+int json_obj_encode_ring_buf(const struct json_obj_descr *descr,
+			     size_t descr_len, const void *val,
+			     struct ring_buf *ringbuf)
+{
+	return json_obj_encode(descr, descr_len, val,
+			       append_bytes_to_ring_buf, ringbuf);
+}
+#endif /* CONFIG_RING_BUFFER */
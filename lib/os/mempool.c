@@ -92,7 +92,12 @@ void z_sys_mem_pool_base_init(struct sys_mem_pool_base *p)
 
 		sys_dlist_init(&p->levels[i].free_list);
 
-		if (nblocks <= sizeof(p->levels[i].bits)*8) {
+		if (p->flags & SYS_MEM_POOL_SEGREGATED) {
+			/* Segregated pools never recombine blocks and
+			 * keep no allocation bitmaps, so there is no
+			 * bitmap memory after the buffer to hand out.
+			 */
+		} else if (nblocks <= sizeof(p->levels[i].bits)*8) {
 			p->max_inline_level = i;
 		} else {
 			p->levels[i].bits_p = bits;
@@ -148,7 +153,7 @@ static void *block_alloc(struct sys_mem_pool_base *p, int l, size_t lsz)
 	sys_dnode_t *block;
 
 	block = sys_dlist_get(&p->levels[l].free_list);
-	if (block != NULL) {
+	if (block != NULL && !(p->flags & SYS_MEM_POOL_SEGREGATED)) {
 		set_alloc_bit(p, l, block_num(p, block, lsz));
 	}
 	return block;
@@ -198,7 +203,17 @@ static void block_free(struct sys_mem_pool_base *p, int level,
 {
 	unsigned int key = pool_irq_lock(p);
 
-	key = bfree_recombine(p, level, lsizes, bn, key);
+	if (p->flags & SYS_MEM_POOL_SEGREGATED) {
+		/* O(1): the block goes back to its size class, it is
+		 * never recombined with its partners.  Note that this
+		 * also means no allocation bits to detect double
+		 * frees with.
+		 */
+		sys_dlist_append(&p->levels[level].free_list,
+				 block_ptr(p, lsizes[level], bn));
+	} else {
+		key = bfree_recombine(p, level, lsizes, bn, key);
+	}
 	pool_irq_unlock(p, key);
 }
 
@@ -213,7 +228,9 @@ static void *block_break(struct sys_mem_pool_base *p, void *block, int l,
 	int i, bn;
 
 	bn = block_num(p, block, lsizes[l]);
-	set_alloc_bit(p, l + 1, 4*bn);
+	if (!(p->flags & SYS_MEM_POOL_SEGREGATED)) {
+		set_alloc_bit(p, l + 1, 4*bn);
+	}
 
 	for (i = 1; i < 4; i++) {
 		int lsz = lsizes[l + 1];
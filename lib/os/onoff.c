@@ -18,6 +18,8 @@ BUILD_ASSERT((ONOFF_FLAG_ERROR | ONOFF_FLAG_ONOFF | ONOFF_FLAG_TRANSITION)
 #define ONOFF_FLAG_PROCESSING BIT(3)
 #define ONOFF_FLAG_COMPLETE BIT(4)
 #define ONOFF_FLAG_RECHECK BIT(5)
+#define ONOFF_FLAG_LINGERING BIT(6)
+#define ONOFF_FLAG_LINGERED BIT(7)
 
 /* These symbols in the ONOFF_FLAGS namespace identify bits in
  * onoff_manager::flags that indicate the state of the machine.  The
@@ -52,6 +54,14 @@ BUILD_ASSERT((ONOFF_FLAG_ERROR | ONOFF_FLAG_ONOFF | ONOFF_FLAG_TRANSITION)
  *   a transition to on must be initiated if the request is still
  *   present.  Transition to ON with no remaining requests similarly
  *   triggers a recheck.
+ * * LINGERING indicates that the linger timer is armed: the service
+ *   is ON with no clients but the stop transition is being held off
+ *   until the configured linger period expires.  The flag is cleared
+ *   when a new request cancels the pending stop or when the timer
+ *   fires.
+ * * LINGERED indicates that the linger period elapsed without a new
+ *   request, so the next recheck from ON with no clients must
+ *   initiate the stop rather than re-arm the timer.
  */
 
 /* Identify the events that can trigger state changes, as well as an
@@ -137,6 +147,8 @@ static int validate_args(const struct onoff_manager *mgr,
 	return rv;
 }
 
+static void linger_expire(struct k_timer *timer);
+
 int onoff_manager_init(struct onoff_manager *mgr,
 		       const struct onoff_transitions *transitions)
 {
@@ -148,6 +160,8 @@ int onoff_manager_init(struct onoff_manager *mgr,
 	}
 
 	*mgr = (struct onoff_manager)ONOFF_MANAGER_INITIALIZER(transitions);
+	mgr->linger = K_NO_WAIT;
+	k_timer_init(&mgr->linger_timer, linger_expire, NULL);
 
 	return 0;
 }
@@ -207,6 +221,53 @@ static void transition_complete(struct onoff_manager *mgr,
 	process_event(mgr, EVT_COMPLETE, key);
 }
 
+/* The linger period has expired without a new request.  Mark the
+ * hold-off as consumed and recheck so the deferred stop transition
+ * can be initiated.  Timer expiry functions run with the timeout lock
+ * released, so taking the manager lock here cannot deadlock against
+ * timer operations performed under it.
+ */
+static void linger_expire(struct k_timer *timer)
+{
+	struct onoff_manager *mgr =
+		CONTAINER_OF(timer, struct onoff_manager, linger_timer);
+	k_spinlock_key_t key = k_spin_lock(&mgr->lock);
+	uint32_t state = mgr->flags & ONOFF_STATE_MASK;
+
+	mgr->flags &= ~ONOFF_FLAG_LINGERING;
+
+	if ((state == ONOFF_STATE_ON) && (mgr->refs == 0)) {
+		mgr->flags |= ONOFF_FLAG_LINGERED;
+		process_event(mgr, EVT_RECHECK, key);
+	} else {
+		k_spin_unlock(&mgr->lock, key);
+	}
+}
+
+int onoff_manager_set_linger(struct onoff_manager *mgr,
+			     k_timeout_t linger)
+{
+	if ((mgr == NULL) || K_TIMEOUT_EQ(linger, K_FOREVER)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&mgr->lock);
+
+	mgr->linger = linger;
+
+	if (K_TIMEOUT_EQ(linger, K_NO_WAIT)
+	    && ((mgr->flags & ONOFF_FLAG_LINGERING) != 0)) {
+		/* Let a held-off stop proceed immediately. */
+		mgr->flags &= ~ONOFF_FLAG_LINGERING;
+		k_timer_stop(&mgr->linger_timer);
+		process_event(mgr, EVT_RECHECK, key);
+	} else {
+		k_spin_unlock(&mgr->lock, key);
+	}
+
+	return 0;
+}
+
 /* Detect whether static state requires a transition. */
 static int process_recheck(struct onoff_manager *mgr)
 {
@@ -218,7 +279,19 @@ static int process_recheck(struct onoff_manager *mgr)
 		evt = EVT_START;
 	} else if ((state == ONOFF_STATE_ON)
 		   && (mgr->refs == 0)) {
-		evt = EVT_STOP;
+		if (((mgr->flags & ONOFF_FLAG_LINGERED) != 0)
+		    || K_TIMEOUT_EQ(mgr->linger, K_NO_WAIT)) {
+			mgr->flags &= ~ONOFF_FLAG_LINGERED;
+			evt = EVT_STOP;
+		} else if ((mgr->flags & ONOFF_FLAG_LINGERING) == 0) {
+			/* Hold the stop off until the linger period
+			 * expires; a request received before then
+			 * cancels it.
+			 */
+			mgr->flags |= ONOFF_FLAG_LINGERING;
+			k_timer_start(&mgr->linger_timer, mgr->linger,
+				      K_NO_WAIT);
+		}
 	} else if ((state == ONOFF_STATE_ERROR)
 		   && !sys_slist_is_empty(&mgr->clients)) {
 		evt = EVT_RESET;
@@ -441,6 +514,13 @@ int onoff_request(struct onoff_manager *mgr,
 		/* Increment reference count, notify in exit */
 		notify = true;
 		mgr->refs += 1U;
+
+		/* Cancel any pending lingered stop. */
+		if ((mgr->flags & ONOFF_FLAG_LINGERING) != 0) {
+			mgr->flags &= ~ONOFF_FLAG_LINGERING;
+			k_timer_stop(&mgr->linger_timer);
+		}
+		mgr->flags &= ~ONOFF_FLAG_LINGERED;
 	} else if ((state == ONOFF_STATE_OFF)
 		   || (state == ONOFF_STATE_TO_OFF)
 		   || (state == ONOFF_STATE_TO_ON)) {
@@ -69,6 +69,36 @@ static void set_color(struct rbnode *n, enum rb_color color)
 	*p = (*p & ~1UL) | (uint8_t)color;
 }
 
+#ifdef CONFIG_RBTREE_SUBTREE_SIZES
+static size_t subtree_size(struct rbnode *n)
+{
+	return n == NULL ? 0 : n->size;
+}
+
+/* Recomputes a node's subtree size from its (already correct) children */
+static void update_size(struct rbnode *n)
+{
+	n->size = subtree_size(get_child(n, 0))
+		  + subtree_size(get_child(n, 1)) + 1U;
+}
+
+/* Adds delta to the size of every stacked ancestor of the node on top
+ * of the stack (i.e. every entry but the last)
+ */
+static void adjust_path_sizes(struct rbnode **stack, int stacksz, int delta)
+{
+	for (int i = 0; i < stacksz - 1; i++) {
+		stack[i]->size += delta;
+	}
+}
+
+#define set_size(n, sz) ((n)->size = (sz))
+#else
+#define update_size(n) do { } while (false)
+#define adjust_path_sizes(stack, stacksz, delta) do { } while (false)
+#define set_size(n, sz) do { } while (false)
+#endif
+
 /* Searches the tree down to a node that is either identical with the
  * "node" argument or has an empty/leaf child pointer where "node"
  * should be, leaving all nodes found in the resulting stack.  Note
@@ -146,6 +176,10 @@ static void rotate(struct rbnode **stack, int stacksz)
 	set_child(parent, side, b);
 	stack[stacksz - 2] = child;
 	stack[stacksz - 1] = parent;
+
+	/* Parent is now the lower node, so recompute it first */
+	update_size(parent);
+	update_size(child);
 }
 
 /* The node at the top of the provided stack is red, and its parent is
@@ -222,6 +256,7 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 		tree->root = node;
 		tree->max_depth = 1;
 		set_color(node, BLACK);
+		set_size(node, 1);
 		return;
 	}
 
@@ -239,8 +274,10 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 
 	set_child(parent, side, node);
 	set_color(node, RED);
+	set_size(node, 1);
 
 	stack[stacksz++] = node;
+	adjust_path_sizes(stack, stacksz, 1);
 	fix_extra_red(stack, stacksz);
 
 	if (stacksz > tree->max_depth) {
@@ -439,10 +476,29 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 
 		set_color(node, get_color(node2));
 		set_color(node2, ctmp);
+
+#ifdef CONFIG_RBTREE_SUBTREE_SIZES
+		/* The nodes swapped positions in the tree, so their
+		 * subtree sizes swap along with the colors
+		 */
+		size_t stmp = node->size;
+
+		node->size = node2->size;
+		node2->size = stmp;
+#endif
 	}
 
 	CHECK(!get_child(node, 0) || !get_child(node, 1));
 
+	/* The position being vacated is the top of the stack, so every
+	 * stacked ancestor loses one node.  Zero the size of the node
+	 * being removed so that rotations which see it while it
+	 * transiently remains linked (c.f. the null_node handling in
+	 * fix_missing_black()) already count it as gone.
+	 */
+	adjust_path_sizes(stack, stacksz, -1);
+	set_size(node, 0);
+
 	struct rbnode *child = get_child(node, 0);
 
 	if (child == NULL) {
@@ -493,6 +549,51 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 	tree->root = stack[0];
 }
 
+#ifndef CONFIG_MISRA_SANE
+/* Recursively builds a perfectly balanced subtree from a sorted
+ * subarray.  The median entry becomes the subtree root, so the node
+ * counts of its two children differ by at most one and every level of
+ * the tree except the deepest is full.  Coloring that deepest level
+ * red and everything above it black then trivially satisfies the
+ * red/black rules: every path from the root to a NULL crosses the
+ * same all-black full levels.  Recursion depth is bounded by the
+ * height of the result, i.e. log2() of the node count.
+ */
+static struct rbnode *build_subtree(struct rbnode **nodes, size_t count,
+				    int level, int red_level)
+{
+	if (count == 0U) {
+		return NULL;
+	}
+
+	size_t mid = count / 2U;
+	struct rbnode *n = nodes[mid];
+
+	set_child(n, 0, build_subtree(nodes, mid, level + 1, red_level));
+	set_child(n, 1, build_subtree(&nodes[mid + 1U], count - mid - 1U,
+				      level + 1, red_level));
+	set_color(n, ((level == red_level) && (level > 0)) ? RED : BLACK);
+	set_size(n, count);
+
+	return n;
+}
+
+void rb_build(struct rbtree *tree, struct rbnode **nodes, size_t count)
+{
+	int levels = 0;
+
+	/* A perfectly balanced tree of N nodes has
+	 * floor(log2(N)) + 1 levels
+	 */
+	while ((count >> levels) != 0U) {
+		levels++;
+	}
+
+	tree->root = build_subtree(nodes, count, 0, levels - 1);
+	tree->max_depth = levels;
+}
+#endif
+
 #ifndef CONFIG_MISRA_SANE
 void z_rb_walk(struct rbnode *node, rb_visit_t visit_fn, void *cookie)
 {
@@ -525,6 +626,33 @@ bool rb_contains(struct rbtree *tree, struct rbnode *node)
 	return n == node;
 }
 
+#ifdef CONFIG_RBTREE_SUBTREE_SIZES
+size_t rb_size(struct rbtree *tree)
+{
+	return subtree_size(tree->root);
+}
+
+struct rbnode *rb_nth(struct rbtree *tree, size_t idx)
+{
+	struct rbnode *n = tree->root;
+
+	while (n != NULL) {
+		size_t lsz = subtree_size(get_child(n, 0));
+
+		if (idx == lsz) {
+			return n;
+		} else if (idx < lsz) {
+			n = get_child(n, 0);
+		} else {
+			idx -= lsz + 1U;
+			n = get_child(n, 1);
+		}
+	}
+
+	return NULL;
+}
+#endif
+
 /* Pushes the node and its chain of left-side children onto the stack
  * in the foreach struct, returning the last node, which is the next
  * node to iterate.  By construction node will always be a right child
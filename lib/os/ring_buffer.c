@@ -21,35 +21,68 @@ struct ring_element {
 	uint32_t  value  :8;  /**< Room for small integral values */
 };
 
+/* In SPSC mode exactly one producer and one consumer context operate
+ * on the buffer concurrently without locking.  Each side reads the
+ * other side's committed index with acquire semantics and publishes
+ * its own with release semantics, so data written before a tail (or
+ * freed before a head) update is visible before the index move is.
+ * Accesses to a side's own indices stay plain loads and stores.
+ */
+#ifdef CONFIG_RING_BUFFER_SPSC
+static inline uint32_t index_load_acquire(const uint32_t *idx)
+{
+	return __atomic_load_n(idx, __ATOMIC_ACQUIRE);
+}
+
+static inline void index_store_release(uint32_t *idx, uint32_t val)
+{
+	__atomic_store_n(idx, val, __ATOMIC_RELEASE);
+}
+#else
+static inline uint32_t index_load_acquire(const uint32_t *idx)
+{
+	return *idx;
+}
+
+static inline void index_store_release(uint32_t *idx, uint32_t val)
+{
+	*idx = val;
+}
+#endif /* CONFIG_RING_BUFFER_SPSC */
+
 int ring_buf_item_put(struct ring_buf *buf, uint16_t type, uint8_t value,
 		      uint32_t *data, uint8_t size32)
 {
 	uint32_t i, space, index, rc;
+	uint32_t tail = Z_RING_BUF_TAIL(buf);
 
-	space = ring_buf_space_get(buf);
+	space = z_ring_buf_custom_space_get(
+		buf->size, index_load_acquire(&Z_RING_BUF_HEAD(buf)), tail);
 	if (space >= (size32 + 1)) {
 		struct ring_element *header =
-			(struct ring_element *)&buf->buf.buf32[buf->tail];
+			(struct ring_element *)&buf->buf.buf32[tail];
 		header->type = type;
 		header->length = size32;
 		header->value = value;
 
 		if (likely(buf->mask)) {
 			for (i = 0U; i < size32; ++i) {
-				index = (i + buf->tail + 1) & buf->mask;
+				index = (i + tail + 1) & buf->mask;
 				buf->buf.buf32[index] = data[i];
 			}
-			buf->tail = (buf->tail + size32 + 1) & buf->mask;
+			index_store_release(&Z_RING_BUF_TAIL(buf),
+					    (tail + size32 + 1) & buf->mask);
 		} else {
 			for (i = 0U; i < size32; ++i) {
-				index = (i + buf->tail + 1) % buf->size;
+				index = (i + tail + 1) % buf->size;
 				buf->buf.buf32[index] = data[i];
 			}
-			buf->tail = (buf->tail + size32 + 1) % buf->size;
+			index_store_release(&Z_RING_BUF_TAIL(buf),
+					    (tail + size32 + 1) % buf->size);
 		}
 		rc = 0U;
 	} else {
-		buf->misc.item_mode.dropped_put_count++;
+		Z_RING_BUF_DROPPED(buf)++;
 		rc = -EMSGSIZE;
 	}
 
@@ -61,12 +94,13 @@ int ring_buf_item_get(struct ring_buf *buf, uint16_t *type, uint8_t *value,
 {
 	struct ring_element *header;
 	uint32_t i, index;
+	uint32_t head = Z_RING_BUF_HEAD(buf);
 
-	if (ring_buf_is_empty(buf)) {
+	if (head == index_load_acquire(&Z_RING_BUF_TAIL(buf))) {
 		return -EAGAIN;
 	}
 
-	header = (struct ring_element *) &buf->buf.buf32[buf->head];
+	header = (struct ring_element *) &buf->buf.buf32[head];
 
 	if (header->length > *size32) {
 		*size32 = header->length;
@@ -79,16 +113,18 @@ int ring_buf_item_get(struct ring_buf *buf, uint16_t *type, uint8_t *value,
 
 	if (likely(buf->mask)) {
 		for (i = 0U; i < header->length; ++i) {
-			index = (i + buf->head + 1) & buf->mask;
+			index = (i + head + 1) & buf->mask;
 			data[i] = buf->buf.buf32[index];
 		}
-		buf->head = (buf->head + header->length + 1) & buf->mask;
+		index_store_release(&Z_RING_BUF_HEAD(buf),
+				    (head + header->length + 1) & buf->mask);
 	} else {
 		for (i = 0U; i < header->length; ++i) {
-			index = (i + buf->head + 1) % buf->size;
+			index = (i + head + 1) % buf->size;
 			data[i] = buf->buf.buf32[index];
 		}
-		buf->head = (buf->head + header->length + 1) % buf->size;
+		index_store_release(&Z_RING_BUF_HEAD(buf),
+				    (head + header->length + 1) % buf->size);
 	}
 
 	return 0;
@@ -110,31 +146,37 @@ uint32_t ring_buf_put_claim(struct ring_buf *buf, uint8_t **data, uint32_t size)
 {
 	uint32_t space, trail_size, allocated;
 
-	space = z_ring_buf_custom_space_get(buf->size, buf->head,
-					    buf->misc.byte_mode.tmp_tail);
+	space = z_ring_buf_custom_space_get(
+		buf->size, index_load_acquire(&Z_RING_BUF_HEAD(buf)),
+		Z_RING_BUF_TMP_TAIL(buf));
 
 	/* Limit requested size to available size. */
 	size = MIN(size, space);
-	trail_size = buf->size - buf->misc.byte_mode.tmp_tail;
+	trail_size = buf->size - Z_RING_BUF_TMP_TAIL(buf);
 
 	/* Limit allocated size to trail size. */
 	allocated = MIN(trail_size, size);
 
-	*data = &buf->buf.buf8[buf->misc.byte_mode.tmp_tail];
-	buf->misc.byte_mode.tmp_tail =
-		wrap(buf->misc.byte_mode.tmp_tail + allocated, buf->size);
+	*data = &buf->buf.buf8[Z_RING_BUF_TMP_TAIL(buf)];
+	Z_RING_BUF_TMP_TAIL(buf) =
+		wrap(Z_RING_BUF_TMP_TAIL(buf) + allocated, buf->size);
 
 	return allocated;
 }
 
 int ring_buf_put_finish(struct ring_buf *buf, uint32_t size)
 {
-	if (size > ring_buf_space_get(buf)) {
+	uint32_t tail = Z_RING_BUF_TAIL(buf);
+	uint32_t space = z_ring_buf_custom_space_get(
+		buf->size, index_load_acquire(&Z_RING_BUF_HEAD(buf)), tail);
+
+	if (size > space) {
 		return -EINVAL;
 	}
 
-	buf->tail = wrap(buf->tail + size, buf->size);
-	buf->misc.byte_mode.tmp_tail = buf->tail;
+	index_store_release(&Z_RING_BUF_TAIL(buf),
+			    wrap(tail + size, buf->size));
+	Z_RING_BUF_TMP_TAIL(buf) = Z_RING_BUF_TAIL(buf);
 
 	return 0;
 }
@@ -165,10 +207,10 @@ uint32_t ring_buf_get_claim(struct ring_buf *buf, uint8_t **data, uint32_t size)
 	uint32_t space, granted_size, trail_size;
 
 	space = (buf->size - 1) -
-		z_ring_buf_custom_space_get(buf->size,
-					    buf->misc.byte_mode.tmp_head,
-					    buf->tail);
-	trail_size = buf->size - buf->misc.byte_mode.tmp_head;
+		z_ring_buf_custom_space_get(
+			buf->size, Z_RING_BUF_TMP_HEAD(buf),
+			index_load_acquire(&Z_RING_BUF_TAIL(buf)));
+	trail_size = buf->size - Z_RING_BUF_TMP_HEAD(buf);
 
 	/* Limit requested size to available size. */
 	granted_size = MIN(size, space);
@@ -176,23 +218,28 @@ uint32_t ring_buf_get_claim(struct ring_buf *buf, uint8_t **data, uint32_t size)
 	/* Limit allocated size to trail size. */
 	granted_size = MIN(trail_size, granted_size);
 
-	*data = &buf->buf.buf8[buf->misc.byte_mode.tmp_head];
-	buf->misc.byte_mode.tmp_head =
-		wrap(buf->misc.byte_mode.tmp_head + granted_size, buf->size);
+	*data = &buf->buf.buf8[Z_RING_BUF_TMP_HEAD(buf)];
+	Z_RING_BUF_TMP_HEAD(buf) =
+		wrap(Z_RING_BUF_TMP_HEAD(buf) + granted_size, buf->size);
 
 	return granted_size;
 }
 
 int ring_buf_get_finish(struct ring_buf *buf, uint32_t size)
 {
-	uint32_t allocated = (buf->size - 1) - ring_buf_space_get(buf);
+	uint32_t head = Z_RING_BUF_HEAD(buf);
+	uint32_t allocated = (buf->size - 1) -
+		z_ring_buf_custom_space_get(
+			buf->size, head,
+			index_load_acquire(&Z_RING_BUF_TAIL(buf)));
 
 	if (size > allocated) {
 		return -EINVAL;
 	}
 
-	buf->head = wrap(buf->head + size, buf->size);
-	buf->misc.byte_mode.tmp_head = buf->head;
+	index_store_release(&Z_RING_BUF_HEAD(buf),
+			    wrap(head + size, buf->size));
+	Z_RING_BUF_TMP_HEAD(buf) = Z_RING_BUF_HEAD(buf);
 
 	return 0;
 }
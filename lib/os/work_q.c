@@ -30,7 +30,26 @@ void z_work_q_main(void *work_q_ptr, void *p2, void *p3)
 		/* Reset pending state so it can be resubmitted by handler */
 		if (atomic_test_and_clear_bit(work->flags,
 					      K_WORK_STATE_PENDING)) {
+#ifdef CONFIG_WORKQUEUE_POOL
+			/* With multiple workers on one queue, serialize
+			 * per item: if this item's handler is still live
+			 * on another worker, push it back and let that
+			 * worker's completion unblock it.
+			 */
+			if (atomic_test_and_set_bit(work->flags,
+						    K_WORK_STATE_RUNNING)) {
+				if (!atomic_test_and_set_bit(work->flags,
+						K_WORK_STATE_PENDING)) {
+					k_queue_append(&work_q->queue, work);
+				}
+			} else {
+				handler(work);
+				atomic_clear_bit(work->flags,
+						 K_WORK_STATE_RUNNING);
+			}
+#else
 			handler(work);
+#endif
 		}
 
 		/* Make sure we don't hog up the CPU if the FIFO never (or
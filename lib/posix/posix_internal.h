@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LIB_POSIX_POSIX_INTERNAL_H_
+#define ZEPHYR_LIB_POSIX_POSIX_INTERNAL_H_
+
+#ifdef CONFIG_PTHREAD_FUTEX_SYNC
+/* Futex protocol values shared between the mutex and condition
+ * variable implementations.  The uncontended transitions
+ * (PTHREAD_MUTEX_FUTEX_UNLOCKED <-> PTHREAD_MUTEX_FUTEX_LOCKED) are a
+ * single atomic operation and never enter the kernel;
+ * PTHREAD_MUTEX_FUTEX_CONTENDED means at least one thread may be
+ * blocked in k_futex_wait() and the unlocker must issue a wake.
+ */
+#define PTHREAD_MUTEX_FUTEX_UNLOCKED	0
+#define PTHREAD_MUTEX_FUTEX_LOCKED	1
+#define PTHREAD_MUTEX_FUTEX_CONTENDED	2
+#endif /* CONFIG_PTHREAD_FUTEX_SYNC */
+
+#endif /* ZEPHYR_LIB_POSIX_POSIX_INTERNAL_H_ */
@@ -9,8 +9,72 @@
 #include <wait_q.h>
 #include <posix/pthread.h>
 
+#include "posix_internal.h"
+
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
 
+#ifdef CONFIG_PTHREAD_FUTEX_SYNC
+static int cond_wait(pthread_cond_t *cv, pthread_mutex_t *mut,
+		     k_timeout_t timeout)
+{
+	atomic_val_t seq = atomic_get(&cv->futex.val);
+	int ret;
+
+	__ASSERT(mut->lock_count == 1U, "");
+
+	/* Remember the mutex so a broadcaster can requeue the other
+	 * waiters onto it.  POSIX requires all concurrent waiters on
+	 * one condition variable to use the same mutex.
+	 */
+	cv->mut = mut;
+
+	pthread_mutex_unlock(mut);
+	ret = k_futex_wait(&cv->futex, seq, timeout);
+	pthread_mutex_lock(mut);
+
+	/* -EAGAIN means the sequence number moved on before we got to
+	 * sleep, i.e. a signal raced our unlock; that is a successful
+	 * wait, not an error.
+	 */
+	return ret == -ETIMEDOUT ? ETIMEDOUT : 0;
+}
+
+int pthread_cond_signal(pthread_cond_t *cv)
+{
+	atomic_inc(&cv->futex.val);
+	k_futex_wake(&cv->futex, false);
+
+	return 0;
+}
+
+int pthread_cond_broadcast(pthread_cond_t *cv)
+{
+	pthread_mutex_t *mut = cv->mut;
+
+	atomic_inc(&cv->futex.val);
+
+	/* Wake a single waiter and move the rest onto the mutex, so
+	 * they are released one at a time as the mutex is handed over
+	 * instead of all stampeding for it at once.  This only works
+	 * while the mutex is held (the usual case for a broadcaster);
+	 * otherwise there is nothing to serialize on and we simply
+	 * wake everyone.
+	 */
+	if (mut != NULL &&
+	    (atomic_get(&mut->futex.val) == PTHREAD_MUTEX_FUTEX_CONTENDED ||
+	     atomic_cas(&mut->futex.val, PTHREAD_MUTEX_FUTEX_LOCKED,
+			PTHREAD_MUTEX_FUTEX_CONTENDED))) {
+		if (k_futex_requeue(&cv->futex, atomic_get(&cv->futex.val),
+				    &mut->futex, 1) == 0) {
+			return 0;
+		}
+	}
+
+	k_futex_wake(&cv->futex, true);
+
+	return 0;
+}
+#else
 static int cond_wait(pthread_cond_t *cv, pthread_mutex_t *mut,
 		     k_timeout_t timeout)
 {
@@ -69,6 +133,7 @@ int pthread_cond_broadcast(pthread_cond_t *cv)
 
 	return 0;
 }
+#endif /* CONFIG_PTHREAD_FUTEX_SYNC */
 
 int pthread_cond_wait(pthread_cond_t *cv, pthread_mutex_t *mut)
 {
@@ -9,6 +9,8 @@
 #include <wait_q.h>
 #include <posix/pthread.h>
 
+#include "posix_internal.h"
+
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
 
 #define MUTEX_MAX_REC_LOCK 32767
@@ -20,6 +22,57 @@ static const pthread_mutexattr_t def_attr = {
 	.type = PTHREAD_MUTEX_DEFAULT,
 };
 
+#ifdef CONFIG_PTHREAD_FUTEX_SYNC
+static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
+{
+	int rc;
+
+	if (atomic_cas(&m->futex.val, PTHREAD_MUTEX_FUTEX_UNLOCKED,
+		       PTHREAD_MUTEX_FUTEX_LOCKED)) {
+		/* Uncontended fast path: a single atomic operation,
+		 * no kernel entry and no interrupt locking.
+		 */
+		m->owner = pthread_self();
+		m->lock_count = 1U;
+		return 0;
+	}
+
+	if (m->owner == pthread_self()) {
+		if (m->type == PTHREAD_MUTEX_RECURSIVE &&
+		    m->lock_count < MUTEX_MAX_REC_LOCK) {
+			m->lock_count++;
+			return 0;
+		} else if (m->type == PTHREAD_MUTEX_ERRORCHECK) {
+			return EDEADLK;
+		}
+
+		return EINVAL;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return EINVAL;
+	}
+
+	/* Contended: advertise a waiter, then sleep until the lock is
+	 * observed free.  atomic_set() both marks the lock contended
+	 * and tells us what it was; seeing it unlocked means we took
+	 * it, and we deliberately leave it marked contended so that
+	 * our own unlock wakes any thread that piled up behind us.
+	 */
+	while (atomic_set(&m->futex.val, PTHREAD_MUTEX_FUTEX_CONTENDED) !=
+	       PTHREAD_MUTEX_FUTEX_UNLOCKED) {
+		rc = k_futex_wait(&m->futex, PTHREAD_MUTEX_FUTEX_CONTENDED,
+				  timeout);
+		if (rc == -ETIMEDOUT) {
+			return ETIMEDOUT;
+		}
+	}
+
+	m->owner = pthread_self();
+	m->lock_count = 1U;
+	return 0;
+}
+#else
 static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
 {
 	int rc = 0, key = irq_lock();
@@ -57,6 +110,7 @@ static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
 
 	return rc;
 }
+#endif /* CONFIG_PTHREAD_FUTEX_SYNC */
 
 /**
  * @brief Lock POSIX mutex with non-blocking call.
@@ -98,7 +152,11 @@ int pthread_mutex_init(pthread_mutex_t *m,
 
 	m->type = mattr->type;
 
+#ifdef CONFIG_PTHREAD_FUTEX_SYNC
+	atomic_clear(&m->futex.val);
+#else
 	z_waitq_init(&m->wait_q);
+#endif
 
 	return 0;
 }
@@ -119,6 +177,31 @@ int pthread_mutex_lock(pthread_mutex_t *m)
  *
  * See IEEE 1003.1
  */
+#ifdef CONFIG_PTHREAD_FUTEX_SYNC
+int pthread_mutex_unlock(pthread_mutex_t *m)
+{
+	if (m->owner != pthread_self()) {
+		return EPERM;
+	}
+
+	if (m->lock_count == 0U) {
+		return EINVAL;
+	}
+
+	m->lock_count--;
+	if (m->lock_count > 0U) {
+		return 0;
+	}
+
+	m->owner = NULL;
+	if (atomic_set(&m->futex.val, PTHREAD_MUTEX_FUTEX_UNLOCKED) ==
+	    PTHREAD_MUTEX_FUTEX_CONTENDED) {
+		k_futex_wake(&m->futex, false);
+	}
+
+	return 0;
+}
+#else
 int pthread_mutex_unlock(pthread_mutex_t *m)
 {
 	unsigned int key = irq_lock();
@@ -153,6 +236,7 @@ int pthread_mutex_unlock(pthread_mutex_t *m)
 	irq_unlock(key);
 	return 0;
 }
+#endif /* CONFIG_PTHREAD_FUTEX_SYNC */
 
 /**
  * @brief Destroy POSIX mutex.
@@ -92,6 +92,8 @@ from collections import OrderedDict
 kobjects = OrderedDict([
     ("k_mem_slab", (None, False, True)),
     ("k_msgq", (None, False, True)),
+    ("k_condvar", (None, False, True)),
+    ("k_event", (None, False, True)),
     ("k_mutex", (None, False, True)),
     ("k_pipe", (None, False, True)),
     ("k_queue", (None, False, True)),
@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020 Intel Corporation
+#
+# SPDX-License-Identifier: Apache-2.0
+
+
+"""Decode a dictionary mode (CONFIG_LOG_DICTIONARY) log stream.
+
+The device emits binary records where each message carries the
+link-time address of its format string instead of formatted text.
+This script extracts the string catalog from the zephyr.elf file and
+formats the records, e.g.:
+
+    parse_dict_log.py --elf build/zephyr/zephyr.elf --input rtt.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+SYNC_BYTE = 0x99
+
+MSG_TYPE_STD = 0
+MSG_TYPE_HEXDUMP = 1
+MSG_TYPE_RAW = 2
+
+# sync, type, level, nargs, source_id, data_len, timestamp, str address
+HDR_FORMAT = "<BBBBHHII"
+HDR_SIZE = struct.calcsize(HDR_FORMAT)
+
+LEVELS = {1: "err", 2: "wrn", 3: "inf", 4: "dbg"}
+
+CONVERSION_RE = re.compile(r"%[-+ #0]*[0-9]*(?:\.[0-9]+)?(?:hh|h|l|ll|z)?"
+                           r"([diouxXcsp%])")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+
+    parser.add_argument("--elf", required=True,
+                        help="zephyr.elf the stream was produced with")
+    parser.add_argument("--input", required=True,
+                        help="captured binary log stream, - for stdin")
+
+    return parser.parse_args()
+
+
+class Catalog:
+    """Readable sections of the ELF file, indexed by load address."""
+
+    def __init__(self, elf_path):
+        self.sections = []
+
+        with open(elf_path, "rb") as fp:
+            elf = ELFFile(fp)
+
+            for section in elf.iter_sections():
+                # SHF_ALLOC: only sections present in the image can be
+                # referenced by a logged string address.
+                if section["sh_flags"] & 0x2:
+                    self.sections.append((section["sh_addr"],
+                                          section.data()))
+
+    def read(self, addr, length):
+        for base, data in self.sections:
+            if base <= addr and addr + length <= base + len(data):
+                offset = addr - base
+                return data[offset:offset + length]
+
+        return None
+
+    def string(self, addr):
+        for base, data in self.sections:
+            if base <= addr < base + len(data):
+                end = data.find(b"\x00", addr - base)
+                if end >= 0:
+                    return data[addr - base:end].decode("utf-8",
+                                                        errors="replace")
+
+        return None
+
+
+def format_message(catalog, fmt, args):
+    """Apply C style conversions to 32-bit arguments."""
+    out = []
+    arg_idx = 0
+    pos = 0
+
+    for match in CONVERSION_RE.finditer(fmt):
+        out.append(fmt[pos:match.start()])
+        pos = match.end()
+        conv = match.group(1)
+        spec = match.group(0)
+
+        if conv == "%":
+            out.append("%")
+            continue
+
+        if arg_idx >= len(args):
+            out.append(spec)
+            continue
+
+        arg = args[arg_idx]
+        arg_idx += 1
+
+        if conv == "s":
+            string = catalog.string(arg)
+            if string is None:
+                # Transient (log_strdup) string, not in the image.
+                string = "<0x%08x>" % arg
+            out.append(string)
+        elif conv == "p":
+            out.append("0x%08x" % arg)
+        elif conv in "di":
+            # Arguments travel as unsigned 32-bit values.
+            if arg >= 1 << 31:
+                arg -= 1 << 32
+            out.append(str(arg))
+        elif conv == "c":
+            out.append(chr(arg & 0xff))
+        else:
+            out.append(("%" + conv) % arg)
+
+    out.append(fmt[pos:])
+
+    return "".join(out)
+
+
+def hexdump_lines(data):
+    for offset in range(0, len(data), 16):
+        chunk = data[offset:offset + 16]
+        hex_part = " ".join("%02x" % byte for byte in chunk)
+        ascii_part = "".join(chr(byte) if 32 <= byte < 127 else "."
+                             for byte in chunk)
+        yield "%-48s|%s" % (hex_part, ascii_part)
+
+
+def process(catalog, stream):
+    pos = 0
+
+    while pos + HDR_SIZE <= len(stream):
+        if stream[pos] != SYNC_BYTE:
+            # Resynchronize after a corrupted or partial record.
+            pos += 1
+            continue
+
+        (_, msg_type, level, nargs, source_id, data_len, timestamp,
+         str_addr) = struct.unpack_from(HDR_FORMAT, stream, pos)
+        pos += HDR_SIZE
+
+        if msg_type == MSG_TYPE_STD:
+            args = list(struct.unpack_from("<%dI" % nargs, stream, pos))
+            pos += 4 * nargs
+            fmt = catalog.string(str_addr) or "<0x%08x>" % str_addr
+            text = format_message(catalog, fmt, args)
+            print("[%10u] <%s> %s" % (timestamp,
+                                      LEVELS.get(level, str(level)), text))
+        elif msg_type == MSG_TYPE_RAW:
+            data = stream[pos:pos + data_len]
+            pos += data_len
+            sys.stdout.write(data.decode("utf-8", errors="replace"))
+        elif msg_type == MSG_TYPE_HEXDUMP:
+            data = stream[pos:pos + data_len]
+            pos += data_len
+            metadata = catalog.string(str_addr) or ""
+            print("[%10u] <%s> %s" % (timestamp,
+                                      LEVELS.get(level, str(level)),
+                                      metadata))
+            for line in hexdump_lines(data):
+                print(line)
+        else:
+            # Unknown record, resynchronize on the next sync byte.
+            continue
+
+
+def main():
+    args = parse_args()
+
+    catalog = Catalog(args.elf)
+
+    if args.input == "-":
+        stream = sys.stdin.buffer.read()
+    else:
+        with open(args.input, "rb") as fp:
+            stream = fp.read()
+
+    process(catalog, stream)
+
+
+if __name__ == "__main__":
+    main()
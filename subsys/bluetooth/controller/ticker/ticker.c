@@ -81,6 +81,9 @@ struct ticker_node {
 	int8_t  priority;			 /* Ticker node priority. 0 is default.
 					  * Lower value is higher priority
 					  */
+#if defined(CONFIG_BT_TICKER_STATS)
+	struct ticker_stats stats;	 /* Expiry and collision counters */
+#endif /* CONFIG_BT_TICKER_STATS */
 #endif /* CONFIG_BT_TICKER_COMPATIBILITY_MODE */
 };
 
@@ -855,6 +858,13 @@ void ticker_worker(void *param)
 #endif /* CONFIG_BT_TICKER_EXT */
 			ticker->lazy_current++;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+			ticker->stats.skipped++;
+			if (ticker->lazy_current > ticker->stats.lazy_max) {
+				ticker->stats.lazy_max = ticker->lazy_current;
+			}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 			if ((ticker->must_expire == 0U) ||
 			    (ticker->lazy_periodic >= ticker->lazy_current) ||
 			    TICKER_RESCHEDULE_PENDING(ticker)) {
@@ -866,6 +876,10 @@ void ticker_worker(void *param)
 			}
 			/* Continue but perform shallow expiry */
 			must_expire_skip = 1U;
+
+#if defined(CONFIG_BT_TICKER_STATS)
+			ticker->stats.must_expire++;
+#endif /* CONFIG_BT_TICKER_STATS */
 		}
 
 #if defined(CONFIG_BT_TICKER_EXT)
@@ -889,6 +903,10 @@ void ticker_worker(void *param)
 					   ticker->ticks_to_expire_minus) &
 					   HAL_TICKER_CNTR_MASK;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+			ticker->stats.expired++;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 			DEBUG_TICKER_TASK(1);
 			/* Invoke the timeout callback */
 			ticker->timeout_func(ticks_at_expire,
@@ -2910,6 +2928,51 @@ uint32_t ticker_priority_set(uint8_t instance_index, uint8_t user_id, uint8_t ti
 
 	return user_op->status;
 }
+
+#if defined(CONFIG_BT_TICKER_STATS)
+/**
+ * @brief Get expiry and collision statistics for a ticker node
+ *
+ * @details Counters are updated from the ticker_worker context; they are
+ * read here without synchronization and may lag by one event.
+ *
+ * @param instance_index Index of ticker instance
+ * @param ticker_id	 Id of ticker node
+ * @param stats		 Statistics storage to fill in
+ *
+ * @return TICKER_STATUS_SUCCESS if the node exists, TICKER_STATUS_FAILURE
+ * otherwise
+ */
+uint32_t ticker_stats_get(uint8_t instance_index, uint8_t ticker_id,
+		       struct ticker_stats *stats)
+{
+	struct ticker_instance *instance = &_instance[instance_index];
+
+	if (ticker_id >= instance->count_node) {
+		return TICKER_STATUS_FAILURE;
+	}
+
+	*stats = instance->nodes[ticker_id].stats;
+
+	return TICKER_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Reset expiry and collision statistics for all ticker nodes
+ *
+ * @param instance_index Index of ticker instance
+ */
+void ticker_stats_reset(uint8_t instance_index)
+{
+	struct ticker_instance *instance = &_instance[instance_index];
+	struct ticker_stats zero = {0};
+	uint8_t id;
+
+	for (id = 0U; id < instance->count_node; id++) {
+		instance->nodes[id].stats = zero;
+	}
+}
+#endif /* CONFIG_BT_TICKER_STATS */
 #endif /* !CONFIG_BT_TICKER_COMPATIBILITY_MODE */
 
 /**
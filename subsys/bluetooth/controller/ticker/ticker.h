@@ -34,15 +34,23 @@
  * @}
  */
 
+/** \brief Timer node statistics type size.
+ */
+#if defined(CONFIG_BT_TICKER_STATS)
+#define TICKER_NODE_STATS_T_SIZE 16
+#else
+#define TICKER_NODE_STATS_T_SIZE 0
+#endif /* CONFIG_BT_TICKER_STATS */
+
 /** \brief Timer node type size.
  */
 #if defined(CONFIG_BT_TICKER_COMPATIBILITY_MODE)
 #define TICKER_NODE_T_SIZE      40
 #else
 #if defined(CONFIG_BT_TICKER_EXT)
-#define TICKER_NODE_T_SIZE      48
+#define TICKER_NODE_T_SIZE      (48 + TICKER_NODE_STATS_T_SIZE)
 #else
-#define TICKER_NODE_T_SIZE      44
+#define TICKER_NODE_T_SIZE      (44 + TICKER_NODE_STATS_T_SIZE)
 #endif /* CONFIG_BT_TICKER_EXT */
 #endif /* CONFIG_BT_TICKER_COMPATIBILITY_MODE*/
 
@@ -103,6 +111,19 @@ struct ticker_ext {
 };
 #endif /* CONFIG_BT_TICKER_EXT */
 
+#if defined(CONFIG_BT_TICKER_STATS)
+struct ticker_stats {
+	uint32_t expired;	 /* Number of invoked timeouts */
+	uint32_t skipped;	 /* Timeouts skipped due to slot collisions */
+	uint32_t must_expire;	 /* Shallow (must-expire) timeouts invoked
+				  * while the slot was lost to a collision
+				  */
+	uint16_t lazy_max;	 /* Highest number of consecutively skipped
+				  * timeouts observed
+				  */
+};
+#endif /* CONFIG_BT_TICKER_STATS */
+
 /** \brief Timer module initialization.
  *
  * \param[in]  instance_index  Timer mode instance 0 or 1 (uses RTC0 CMP0 or
@@ -159,4 +180,9 @@ uint32_t ticker_start_ext(uint8_t instance_index, uint8_t user_id, uint8_t ticke
 		       ticker_op_func fp_op_func, void *op_context,
 		       struct ticker_ext *ext_data);
 #endif /* CONFIG_BT_TICKER_EXT */
+#if defined(CONFIG_BT_TICKER_STATS)
+uint32_t ticker_stats_get(uint8_t instance_index, uint8_t ticker_id,
+		       struct ticker_stats *stats);
+void ticker_stats_reset(uint8_t instance_index);
+#endif /* CONFIG_BT_TICKER_STATS */
 #endif /* !CONFIG_BT_TICKER_COMPATIBILITY_MODE */
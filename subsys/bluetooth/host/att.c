@@ -74,6 +74,7 @@ enum {
 	ATT_DISCONNECTED,
 	ATT_ENHANCED,
 	ATT_PENDING_SENT,
+	ATT_EATT_AUTO_CONNECTED,
 
 	/* Total number of flags - must be at the end of the enum */
 	ATT_NUM_FLAGS,
@@ -2713,6 +2714,24 @@ static void bt_att_encrypt_change(struct bt_l2cap_chan *chan,
 		return;
 	}
 
+#if defined(CONFIG_BT_EATT_AUTO_CONNECT)
+	/* Establish the enhanced bearers once the link is encrypted so
+	 * requests can be spread over them. Only attempted from the fixed
+	 * channel, and only once per connection; a peer connecting the
+	 * bearers first simply leaves nothing to add here.
+	 */
+	if (!atomic_test_bit(att_chan->flags, ATT_ENHANCED) &&
+	    !atomic_test_and_set_bit(att_chan->flags,
+				     ATT_EATT_AUTO_CONNECTED)) {
+		int err = bt_eatt_connect(conn, CONFIG_BT_EATT_MAX);
+
+		if (err) {
+			BT_WARN("Automatic EATT connection failed (err %d)",
+				err);
+		}
+	}
+#endif /* CONFIG_BT_EATT_AUTO_CONNECT */
+
 	if (!att_chan->req || !att_chan->req->retrying) {
 		return;
 	}
@@ -882,6 +882,7 @@ void bt_conn_reset_rx_state(struct bt_conn *conn)
 
 	net_buf_unref(conn->rx);
 	conn->rx = NULL;
+	bt_rx_stage_reassembly(false);
 }
 
 void bt_conn_recv(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
@@ -913,6 +914,7 @@ void bt_conn_recv(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 		       0 : sys_get_le16(buf->data));
 
 		conn->rx = buf;
+		bt_rx_stage_reassembly(true);
 		break;
 	case BT_ACL_CONT:
 		if (!conn->rx) {
@@ -973,6 +975,7 @@ void bt_conn_recv(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 	/* L2CAP frame complete. */
 	buf = conn->rx;
 	conn->rx = NULL;
+	bt_rx_stage_reassembly(false);
 
 	BT_DBG("Successfully parsed %u byte L2CAP packet", buf->len);
 	bt_l2cap_recv(conn, buf);
@@ -1366,7 +1369,26 @@ void bt_conn_process_tx(struct bt_conn *conn)
 	BT_ASSERT(buf);
 	if (!send_buf(conn, buf)) {
 		net_buf_unref(buf);
+		return;
+	}
+
+#if defined(CONFIG_BT_CONN_TX_BATCH)
+	/* Keep the controller's buffers full: as long as credits are
+	 * immediately available, drain further queued packets in the same
+	 * pass instead of going back through the poll loop for each one.
+	 */
+	while (k_sem_count_get(bt_conn_get_pkts(conn)) > 0) {
+		buf = net_buf_get(&conn->tx_queue, K_NO_WAIT);
+		if (!buf) {
+			break;
+		}
+
+		if (!send_buf(conn, buf)) {
+			net_buf_unref(buf);
+			break;
+		}
 	}
+#endif /* CONFIG_BT_CONN_TX_BATCH */
 }
 
 bool bt_conn_exists_le(uint8_t id, const bt_addr_le_t *peer)
@@ -80,6 +80,83 @@ static sys_slist_t db;
 
 static atomic_t init;
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+/* Handle-sorted index over all registered attributes. While valid,
+ * attribute lookups binary search this array instead of walking the
+ * static service section and the dynamic service list.
+ */
+static struct {
+	const struct bt_gatt_attr *attr;
+	uint16_t handle;
+} attr_index[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+static uint16_t attr_index_count;
+static bool attr_index_valid;
+
+static uint8_t attr_index_install(const struct bt_gatt_attr *attr,
+				  uint16_t handle, void *user_data)
+{
+	bool *overflow = user_data;
+	uint16_t pos = attr_index_count;
+
+	if (attr_index_count == ARRAY_SIZE(attr_index)) {
+		*overflow = true;
+		return BT_GATT_ITER_STOP;
+	}
+
+	/* Dynamic services are not necessarily iterated in handle order;
+	 * insert at the sorted position.
+	 */
+	while (pos > 0U && attr_index[pos - 1].handle > handle) {
+		attr_index[pos] = attr_index[pos - 1];
+		pos--;
+	}
+
+	attr_index[pos].attr = attr;
+	attr_index[pos].handle = handle;
+	attr_index_count++;
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+static void attr_index_rebuild(void)
+{
+	bool overflow = false;
+
+	/* Invalidate first so the iteration below walks the database
+	 * directly.
+	 */
+	attr_index_valid = false;
+	attr_index_count = 0U;
+
+	bt_gatt_foreach_attr(0x0001, 0xffff, attr_index_install, &overflow);
+
+	if (overflow) {
+		BT_WARN("Attribute index full, falling back to iteration");
+		attr_index_count = 0U;
+		return;
+	}
+
+	attr_index_valid = true;
+}
+
+static uint16_t attr_index_first(uint16_t start_handle)
+{
+	uint16_t low = 0U, high = attr_index_count;
+
+	while (low < high) {
+		uint16_t mid = (low + high) / 2U;
+
+		if (attr_index[mid].handle < start_handle) {
+			low = mid + 1U;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 static ssize_t read_name(struct bt_conn *conn, const struct bt_gatt_attr *attr,
 			 void *buf, uint16_t len, uint16_t offset)
 {
@@ -1033,6 +1110,10 @@ void bt_gatt_init(void)
 		last_static_handle += svc->attr_count;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	attr_index_rebuild();
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 #if defined(CONFIG_BT_GATT_CACHING)
 	k_delayed_work_init(&db_hash_work, db_hash_process);
 
@@ -1188,6 +1269,10 @@ int bt_gatt_service_register(struct bt_gatt_service *svc)
 		return err;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	attr_index_rebuild();
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	sc_indicate(svc->attrs[0].handle,
 		    svc->attrs[svc->attr_count - 1].handle);
 
@@ -1207,6 +1292,10 @@ int bt_gatt_service_unregister(struct bt_gatt_service *svc)
 		return err;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	attr_index_rebuild();
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	sc_indicate(svc->attrs[0].handle,
 		    svc->attrs[svc->attr_count - 1].handle);
 
@@ -1481,6 +1570,24 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	if (attr_index_valid) {
+		for (i = attr_index_first(start_handle); i < attr_index_count;
+		     i++) {
+			if (gatt_foreach_iter(attr_index[i].attr,
+					      attr_index[i].handle,
+					      start_handle, end_handle,
+					      uuid, attr_data, &num_matches,
+					      func, user_data) ==
+			    BT_GATT_ITER_STOP) {
+				return;
+			}
+		}
+
+		return;
+	}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -6314,6 +6314,55 @@ void hci_event_prio(struct net_buf *buf)
 	}
 }
 
+#if defined(CONFIG_BT_RX_STAGE_STATS)
+static struct {
+	atomic_t alloc;
+	atomic_t alloc_failed;
+	atomic_t queued;
+	atomic_t queued_max;
+	atomic_t reassembly;
+	atomic_t reassembly_max;
+} rx_stage;
+
+static void rx_stage_count(atomic_t *cur, atomic_t *max, bool inc)
+{
+	if (inc) {
+		atomic_val_t val = atomic_inc(cur) + 1;
+
+		if (val > atomic_get(max)) {
+			atomic_set(max, val);
+		}
+	} else {
+		atomic_dec(cur);
+	}
+}
+
+void bt_rx_stage_queued(bool inc)
+{
+	rx_stage_count(&rx_stage.queued, &rx_stage.queued_max, inc);
+}
+
+void bt_rx_stage_reassembly(bool inc)
+{
+	rx_stage_count(&rx_stage.reassembly, &rx_stage.reassembly_max, inc);
+}
+
+void bt_rx_stage_alloc(bool ok)
+{
+	atomic_inc(ok ? &rx_stage.alloc : &rx_stage.alloc_failed);
+}
+
+void bt_rx_stage_stats_get(struct bt_rx_stage_stats *stats)
+{
+	stats->alloc = atomic_get(&rx_stage.alloc);
+	stats->alloc_failed = atomic_get(&rx_stage.alloc_failed);
+	stats->queued = atomic_get(&rx_stage.queued);
+	stats->queued_max = atomic_get(&rx_stage.queued_max);
+	stats->reassembly = atomic_get(&rx_stage.reassembly);
+	stats->reassembly_max = atomic_get(&rx_stage.reassembly_max);
+}
+#endif /* CONFIG_BT_RX_STAGE_STATS */
+
 int bt_recv(struct net_buf *buf)
 {
 	bt_monitor_send(bt_monitor_opcode(buf), buf->data, buf->len);
@@ -6326,6 +6375,7 @@ int bt_recv(struct net_buf *buf)
 #if defined(CONFIG_BT_RECV_IS_RX_THREAD)
 		hci_acl(buf);
 #else
+		bt_rx_stage_queued(true);
 		net_buf_put(&bt_dev.rx_queue, buf);
 #endif
 		return 0;
@@ -6343,6 +6393,7 @@ int bt_recv(struct net_buf *buf)
 		}
 
 		if (evt_flags & BT_HCI_EVT_FLAG_RECV) {
+			bt_rx_stage_queued(true);
 			net_buf_put(&bt_dev.rx_queue, buf);
 		}
 #endif
@@ -6354,6 +6405,7 @@ int bt_recv(struct net_buf *buf)
 #if defined(CONFIG_BT_RECV_IS_RX_THREAD)
 		hci_iso(buf);
 #else
+		bt_rx_stage_queued(true);
 		net_buf_put(&bt_dev.rx_queue, buf);
 #endif
 		return 0;
@@ -6462,6 +6514,7 @@ static void hci_rx_thread(void)
 	while (1) {
 		BT_DBG("calling fifo_get_wait");
 		buf = net_buf_get(&bt_dev.rx_queue, K_FOREVER);
+		bt_rx_stage_queued(false);
 
 		BT_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf),
 		       buf->len);
@@ -8735,6 +8788,8 @@ struct net_buf *bt_buf_get_rx(enum bt_buf_type type, k_timeout_t timeout)
 	buf = net_buf_alloc(&hci_rx_pool, timeout);
 #endif
 
+	bt_rx_stage_alloc(buf != NULL);
+
 	if (buf) {
 		net_buf_reserve(buf, BT_BUF_RESERVE);
 		bt_buf_set_type(buf, type);
@@ -322,6 +322,16 @@ const bt_addr_le_t *bt_lookup_id_addr(uint8_t id, const bt_addr_le_t *addr);
 
 int bt_send(struct net_buf *buf);
 
+#if defined(CONFIG_BT_RX_STAGE_STATS)
+void bt_rx_stage_queued(bool inc);
+void bt_rx_stage_reassembly(bool inc);
+void bt_rx_stage_alloc(bool ok);
+#else
+#define bt_rx_stage_queued(inc)
+#define bt_rx_stage_reassembly(inc)
+#define bt_rx_stage_alloc(ok)
+#endif /* CONFIG_BT_RX_STAGE_STATS */
+
 /* Don't require everyone to include keys.h */
 struct bt_keys;
 void bt_id_add(struct bt_keys *keys);
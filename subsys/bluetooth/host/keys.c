@@ -38,6 +38,14 @@ static uint32_t aging_counter_val;
 static struct bt_keys *last_keys_updated;
 #endif /* CONFIG_BT_KEYS_OVERWRITE_OLDEST */
 
+#if defined(CONFIG_BT_KEYS_LAZY_LOADING)
+static void bt_keys_load(struct bt_keys *keys);
+#else
+static inline void bt_keys_load(struct bt_keys *keys)
+{
+}
+#endif /* CONFIG_BT_KEYS_LAZY_LOADING */
+
 struct bt_keys *bt_keys_get_addr(uint8_t id, const bt_addr_le_t *addr)
 {
 	struct bt_keys *keys;
@@ -50,6 +58,7 @@ struct bt_keys *bt_keys_get_addr(uint8_t id, const bt_addr_le_t *addr)
 		keys = &key_pool[i];
 
 		if (keys->id == id && !bt_addr_le_cmp(&keys->addr, addr)) {
+			bt_keys_load(keys);
 			return keys;
 		}
 
@@ -107,7 +116,8 @@ void bt_foreach_bond(uint8_t id, void (*func)(const struct bt_bond_info *info,
 	for (i = 0; i < ARRAY_SIZE(key_pool); i++) {
 		struct bt_keys *keys = &key_pool[i];
 
-		if (keys->keys && keys->id == id) {
+		if ((keys->keys || (keys->state & BT_KEYS_UNLOADED)) &&
+		    keys->id == id) {
 			struct bt_bond_info info;
 
 			bt_addr_le_copy(&info.addr, &keys->addr);
@@ -135,6 +145,12 @@ struct bt_keys *bt_keys_find(int type, uint8_t id, const bt_addr_le_t *addr)
 	BT_DBG("type %d %s", type, bt_addr_le_str(addr));
 
 	for (i = 0; i < ARRAY_SIZE(key_pool); i++) {
+		if (IS_ENABLED(CONFIG_BT_KEYS_LAZY_LOADING) &&
+		    key_pool[i].id == id &&
+		    !bt_addr_le_cmp(&key_pool[i].addr, addr)) {
+			bt_keys_load(&key_pool[i]);
+		}
+
 		if ((key_pool[i].keys & type) && key_pool[i].id == id &&
 		    !bt_addr_le_cmp(&key_pool[i].addr, addr)) {
 			return &key_pool[i];
@@ -175,6 +191,15 @@ struct bt_keys *bt_keys_find_irk(uint8_t id, const bt_addr_le_t *addr)
 		return NULL;
 	}
 
+	if (IS_ENABLED(CONFIG_BT_KEYS_LAZY_LOADING)) {
+		/* Resolution has to consider every stored IRK, so the first
+		 * resolution attempt pulls in all deferred entries.
+		 */
+		for (i = 0; i < ARRAY_SIZE(key_pool); i++) {
+			bt_keys_load(&key_pool[i]);
+		}
+	}
+
 	for (i = 0; i < ARRAY_SIZE(key_pool); i++) {
 		if (!(key_pool[i].keys & BT_KEYS_IRK)) {
 			continue;
@@ -223,6 +248,7 @@ struct bt_keys *bt_keys_find_addr(uint8_t id, const bt_addr_le_t *addr)
 	for (i = 0; i < ARRAY_SIZE(key_pool); i++) {
 		if (key_pool[i].id == id &&
 		    !bt_addr_le_cmp(&key_pool[i].addr, addr)) {
+			bt_keys_load(&key_pool[i]);
 			return &key_pool[i];
 		}
 	}
@@ -294,6 +320,40 @@ int bt_keys_store(struct bt_keys *keys)
 	return 0;
 }
 
+static int keys_value_set(struct bt_keys *keys, const char *val, ssize_t len)
+{
+	if (len != BT_KEYS_STORAGE_LEN) {
+		do {
+			/* Load shorter structure for compatibility with old
+			 * records format with no counter.
+			 */
+			if (IS_ENABLED(CONFIG_BT_KEYS_OVERWRITE_OLDEST) &&
+			    len == BT_KEYS_STORAGE_LEN_COMPAT) {
+				BT_WARN("Keys for %s have no aging counter",
+					bt_addr_le_str(&keys->addr));
+				memcpy(keys->storage_start, val, len);
+				continue;
+			}
+
+			BT_ERR("Invalid key length %zd != %zu", len,
+			       BT_KEYS_STORAGE_LEN);
+			bt_keys_clear(keys);
+
+			return -EINVAL;
+		} while (0);
+	} else {
+		memcpy(keys->storage_start, val, len);
+	}
+
+	BT_DBG("Successfully restored keys for %s", bt_addr_le_str(&keys->addr));
+#if IS_ENABLED(CONFIG_BT_KEYS_OVERWRITE_OLDEST)
+	if (aging_counter_val < keys->aging_counter) {
+		aging_counter_val = keys->aging_counter;
+	}
+#endif  /* CONFIG_BT_KEYS_OVERWRITE_OLDEST */
+	return 0;
+}
+
 static int keys_set(const char *name, size_t len_rd, settings_read_cb read_cb,
 		    void *cb_arg)
 {
@@ -310,15 +370,6 @@ static int keys_set(const char *name, size_t len_rd, settings_read_cb read_cb,
 		return -EINVAL;
 	}
 
-	len = read_cb(cb_arg, val, sizeof(val));
-	if (len < 0) {
-		BT_ERR("Failed to read value (err %zd)", len);
-		return -EINVAL;
-	}
-
-	BT_DBG("name %s val %s", log_strdup(name),
-	       (len) ? bt_hex(val, sizeof(val)) : "(null)");
-
 	err = bt_settings_decode_key(name, &addr);
 	if (err) {
 		BT_ERR("Unable to decode address %s", name);
@@ -333,8 +384,26 @@ static int keys_set(const char *name, size_t len_rd, settings_read_cb read_cb,
 		id = strtol(next, NULL, 10);
 	}
 
-	if (!len) {
-		keys = bt_keys_find(BT_KEYS_ALL, id, &addr);
+	if (!len_rd) {
+		if (IS_ENABLED(CONFIG_BT_KEYS_LAZY_LOADING)) {
+			int i;
+
+			/* Scan the pool directly so that a deleted record
+			 * does not trigger loading its own stale value.
+			 */
+			keys = NULL;
+			for (i = 0; i < ARRAY_SIZE(key_pool); i++) {
+				if (key_pool[i].id == id &&
+				    !bt_addr_le_cmp(&key_pool[i].addr,
+						    &addr)) {
+					keys = &key_pool[i];
+					break;
+				}
+			}
+		} else {
+			keys = bt_keys_find(BT_KEYS_ALL, id, &addr);
+		}
+
 		if (keys) {
 			(void)memset(keys, 0, sizeof(*keys));
 			BT_DBG("Cleared keys for %s", bt_addr_le_str(&addr));
@@ -351,36 +420,26 @@ static int keys_set(const char *name, size_t len_rd, settings_read_cb read_cb,
 		BT_ERR("Failed to allocate keys for %s", bt_addr_le_str(&addr));
 		return -ENOMEM;
 	}
-	if (len != BT_KEYS_STORAGE_LEN) {
-		do {
-			/* Load shorter structure for compatibility with old
-			 * records format with no counter.
-			 */
-			if (IS_ENABLED(CONFIG_BT_KEYS_OVERWRITE_OLDEST) &&
-			    len == BT_KEYS_STORAGE_LEN_COMPAT) {
-				BT_WARN("Keys for %s have no aging counter",
-					bt_addr_le_str(&addr));
-				memcpy(keys->storage_start, val, len);
-				continue;
-			}
-
-			BT_ERR("Invalid key length %zd != %zu", len,
-			       BT_KEYS_STORAGE_LEN);
-			bt_keys_clear(keys);
 
-			return -EINVAL;
-		} while (0);
-	} else {
-		memcpy(keys->storage_start, val, len);
+	if (IS_ENABLED(CONFIG_BT_KEYS_LAZY_LOADING)) {
+		/* Only index the bond here; the value is read from storage
+		 * on the first lookup for this peer.
+		 */
+		keys->state |= BT_KEYS_UNLOADED;
+		BT_DBG("Deferred loading keys for %s", bt_addr_le_str(&addr));
+		return 0;
 	}
 
-	BT_DBG("Successfully restored keys for %s", bt_addr_le_str(&addr));
-#if IS_ENABLED(CONFIG_BT_KEYS_OVERWRITE_OLDEST)
-	if (aging_counter_val < keys->aging_counter) {
-		aging_counter_val = keys->aging_counter;
+	len = read_cb(cb_arg, val, sizeof(val));
+	if (len < 0) {
+		BT_ERR("Failed to read value (err %zd)", len);
+		return -EINVAL;
 	}
-#endif  /* CONFIG_BT_KEYS_OVERWRITE_OLDEST */
-	return 0;
+
+	BT_DBG("name %s val %s", log_strdup(name),
+	       (len) ? bt_hex(val, sizeof(val)) : "(null)");
+
+	return keys_value_set(keys, val, len);
 }
 
 static void id_add(struct bt_keys *keys, void *user_data)
@@ -388,10 +447,92 @@ static void id_add(struct bt_keys *keys, void *user_data)
 	bt_id_add(keys);
 }
 
+#if defined(CONFIG_BT_KEYS_LAZY_LOADING)
+static int keys_load_direct(const char *name, size_t len_rd,
+			    settings_read_cb read_cb, void *cb_arg,
+			    void *param)
+{
+	struct bt_keys *keys = param;
+	char val[BT_KEYS_STORAGE_LEN];
+	ssize_t len;
+
+	len = read_cb(cb_arg, val, sizeof(val));
+	if (len < 0) {
+		BT_ERR("Failed to read value (err %zd)", len);
+		return -EINVAL;
+	}
+
+	return keys_value_set(keys, val, len);
+}
+
+static void bt_keys_load(struct bt_keys *keys)
+{
+	char key[BT_SETTINGS_KEY_MAX];
+	int err;
+
+	if (!(keys->state & BT_KEYS_UNLOADED)) {
+		return;
+	}
+
+	keys->state &= ~BT_KEYS_UNLOADED;
+
+	if (keys->id) {
+		char id[4];
+
+		u8_to_dec(id, sizeof(id), keys->id);
+		bt_settings_encode_key(key, sizeof(key), "keys", &keys->addr,
+				       id);
+	} else {
+		bt_settings_encode_key(key, sizeof(key), "keys", &keys->addr,
+				       NULL);
+	}
+
+	BT_DBG("Loading deferred keys %s", log_strdup(key));
+
+	err = settings_load_subtree_direct(key, keys_load_direct, keys);
+	if (err) {
+		BT_ERR("Failed to load keys for %s (err %d)",
+		       bt_addr_le_str(&keys->addr), err);
+		return;
+	}
+
+	/* The resolving list update normally done at commit time was
+	 * skipped for this entry; do it now that the keys are known.
+	 */
+	if (keys->keys &&
+	    ((IS_ENABLED(CONFIG_BT_CENTRAL) &&
+	      IS_ENABLED(CONFIG_BT_PRIVACY)) ||
+	     (keys->keys & BT_KEYS_IRK))) {
+		bt_id_add(keys);
+	}
+}
+
+#if defined(CONFIG_BT_KEYS_LAZY_PREFETCH)
+static void keys_prefetch(struct k_work *work)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(key_pool); i++) {
+		bt_keys_load(&key_pool[i]);
+	}
+}
+
+static K_WORK_DEFINE(keys_prefetch_work, keys_prefetch);
+#endif /* CONFIG_BT_KEYS_LAZY_PREFETCH */
+#endif /* CONFIG_BT_KEYS_LAZY_LOADING */
+
 static int keys_commit(void)
 {
 	BT_DBG("");
 
+#if defined(CONFIG_BT_KEYS_LAZY_PREFETCH)
+	/* Key loading was deferred during the settings load; prefetch the
+	 * deferred entries from the system workqueue so that lookups after
+	 * boot rarely have to wait for storage.
+	 */
+	k_work_submit(&keys_prefetch_work);
+#endif /* CONFIG_BT_KEYS_LAZY_PREFETCH */
+
 	/* We do this in commit() rather than add() since add() may get
 	 * called multiple times for the same address, especially if
 	 * the keys were already removed.
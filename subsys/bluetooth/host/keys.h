@@ -23,6 +23,8 @@ enum {
 	BT_KEYS_ID_PENDING_ADD  = BIT(0),
 	BT_KEYS_ID_PENDING_DEL  = BIT(1),
 	BT_KEYS_ID_ADDED        = BIT(2),
+	/* Key material not yet read from storage */
+	BT_KEYS_UNLOADED        = BIT(3),
 };
 
 enum {
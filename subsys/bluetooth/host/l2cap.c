@@ -1627,6 +1627,38 @@ segment:
 	return seg;
 }
 
+#if defined(CONFIG_BT_L2CAP_SEG_ZERO_COPY)
+/* Detach a fragment that can be handed to the controller by reference:
+ * it must fit in a single segment and have headroom for the L2CAP, ACL
+ * and driver headers. Returns the rest of the chain, which the caller
+ * must reattach if the fragment could not be sent.
+ */
+static struct net_buf *l2cap_frag_detach(struct bt_l2cap_le_chan *ch,
+					 struct net_buf *frag,
+					 uint16_t sdu_hdr_len)
+{
+	struct net_buf *next;
+
+	if (!frag->frags || frag->len + sdu_hdr_len > ch->tx.mps ||
+	    net_buf_headroom(frag) <
+	    BT_L2CAP_CHAN_SEND_RESERVE + sdu_hdr_len) {
+		return NULL;
+	}
+
+	next = frag->frags;
+	frag->frags = NULL;
+
+	return next;
+}
+#else
+static struct net_buf *l2cap_frag_detach(struct bt_l2cap_le_chan *ch,
+					 struct net_buf *frag,
+					 uint16_t sdu_hdr_len)
+{
+	return NULL;
+}
+#endif /* CONFIG_BT_L2CAP_SEG_ZERO_COPY */
+
 static void l2cap_chan_tx_resume(struct bt_l2cap_le_chan *ch)
 {
 	if (!atomic_get(&ch->tx.credits) ||
@@ -1686,7 +1718,8 @@ static bool test_and_dec(atomic_t *target)
  * be sent later.
  */
 static int l2cap_chan_le_send(struct bt_l2cap_le_chan *ch,
-			      struct net_buf *buf, uint16_t sdu_hdr_len)
+			      struct net_buf *buf, uint16_t sdu_hdr_len,
+			      bool sdu_end)
 {
 	struct net_buf *seg;
 	struct net_buf_simple_state state;
@@ -1711,10 +1744,10 @@ static int l2cap_chan_le_send(struct bt_l2cap_le_chan *ch,
 
 	len = seg->len - sdu_hdr_len;
 
-	/* Set a callback if there is no data left in the buffer and sent
+	/* Set a callback if this segment completes the SDU and sent
 	 * callback has been set.
 	 */
-	if ((buf == seg || !buf->len) && ch->chan.ops->sent) {
+	if (sdu_end && (buf == seg || !buf->len) && ch->chan.ops->sent) {
 		err = bt_l2cap_send_cb(ch->chan.conn, ch->tx.cid, seg,
 				       l2cap_chan_sdu_sent, &ch->chan);
 	} else {
@@ -1753,6 +1786,7 @@ static int l2cap_chan_le_send_sdu(struct bt_l2cap_le_chan *ch,
 {
 	int ret, total_len;
 	struct net_buf *frag;
+	struct net_buf *next;
 
 	total_len = net_buf_frags_len(*buf) + sent;
 
@@ -1766,9 +1800,17 @@ static int l2cap_chan_le_send_sdu(struct bt_l2cap_le_chan *ch,
 	}
 
 	if (!sent) {
+		next = l2cap_frag_detach(ch, frag, BT_L2CAP_SDU_HDR_LEN);
+
 		/* Add SDU length for the first segment */
-		ret = l2cap_chan_le_send(ch, frag, BT_L2CAP_SDU_HDR_LEN);
+		ret = l2cap_chan_le_send(ch, frag, BT_L2CAP_SDU_HDR_LEN,
+					 !next && !frag->frags);
 		if (ret < 0) {
+			if (next) {
+				/* Reattach the rest of the chain */
+				frag->frags = next;
+			}
+
 			if (ret == -EAGAIN) {
 				/* Store sent data into user_data */
 				data_sent(frag)->len = sent;
@@ -1776,6 +1818,13 @@ static int l2cap_chan_le_send_sdu(struct bt_l2cap_le_chan *ch,
 			*buf = frag;
 			return ret;
 		}
+
+		if (next) {
+			/* Fragment was handed off by reference */
+			net_buf_unref(frag);
+			frag = next;
+		}
+
 		sent = ret;
 	}
 
@@ -1786,8 +1835,16 @@ static int l2cap_chan_le_send_sdu(struct bt_l2cap_le_chan *ch,
 			frag = net_buf_frag_del(NULL, frag);
 		}
 
-		ret = l2cap_chan_le_send(ch, frag, 0);
+		next = l2cap_frag_detach(ch, frag, 0);
+
+		ret = l2cap_chan_le_send(ch, frag, 0,
+					 !next && !frag->frags);
 		if (ret < 0) {
+			if (next) {
+				/* Reattach the rest of the chain */
+				frag->frags = next;
+			}
+
 			if (ret == -EAGAIN) {
 				/* Store sent data into user_data */
 				data_sent(frag)->len = sent;
@@ -1795,6 +1852,12 @@ static int l2cap_chan_le_send_sdu(struct bt_l2cap_le_chan *ch,
 			*buf = frag;
 			return ret;
 		}
+
+		if (next) {
+			/* Fragment was handed off by reference */
+			net_buf_unref(frag);
+			frag = next;
+		}
 	}
 
 	BT_DBG("ch %p cid 0x%04x sent %u total_len %u", ch, ch->tx.cid, sent,
@@ -54,11 +54,25 @@ NET_BUF_POOL_DEFINE(adv_buf_pool, CONFIG_BT_MESH_ADV_BUF_COUNT,
 
 static struct bt_mesh_adv adv_pool[CONFIG_BT_MESH_ADV_BUF_COUNT];
 
+#if defined(CONFIG_BT_MESH_RELAY)
+NET_BUF_POOL_DEFINE(relay_buf_pool, CONFIG_BT_MESH_RELAY_BUF_COUNT,
+		    BT_MESH_ADV_DATA_SIZE, BT_MESH_ADV_USER_DATA_SIZE, NULL);
+
+static struct bt_mesh_adv relay_adv_pool[CONFIG_BT_MESH_RELAY_BUF_COUNT];
+#endif
+
 static struct bt_mesh_adv *adv_alloc(int id)
 {
 	return &adv_pool[id];
 }
 
+#if defined(CONFIG_BT_MESH_RELAY)
+static struct bt_mesh_adv *relay_adv_alloc(int id)
+{
+	return &relay_adv_pool[id];
+}
+#endif
+
 static inline void adv_send_start(uint16_t duration, int err,
 				  const struct bt_mesh_send_cb *cb,
 				  void *cb_data)
@@ -95,9 +109,16 @@ static inline void adv_send(struct net_buf *buf)
 
 	adv_int = MAX(adv_int_min,
 		      BT_MESH_TRANSMIT_INT(BT_MESH_ADV(buf)->xmit));
-	duration = (MESH_SCAN_WINDOW_MS +
-		    ((BT_MESH_TRANSMIT_COUNT(BT_MESH_ADV(buf)->xmit) + 1) *
-		     (adv_int + 10)));
+	duration = ((BT_MESH_TRANSMIT_COUNT(BT_MESH_ADV(buf)->xmit) + 1) *
+		    (adv_int + 10));
+
+	/* When batching, only leave a scan window after the last queued
+	 * buffer so that the advertising events go out back-to-back.
+	 */
+	if (!IS_ENABLED(CONFIG_BT_MESH_ADV_BATCH) ||
+	    k_fifo_is_empty(&adv_queue)) {
+		duration += MESH_SCAN_WINDOW_MS;
+	}
 
 	BT_DBG("type %u len %u: %s", BT_MESH_ADV(buf)->type,
 	       buf->len, bt_hex(buf->data, buf->len));
@@ -223,6 +244,14 @@ struct net_buf *bt_mesh_adv_create(enum bt_mesh_adv_type type, uint8_t xmit,
 					    xmit, timeout);
 }
 
+#if defined(CONFIG_BT_MESH_RELAY)
+struct net_buf *bt_mesh_adv_create_relay(uint8_t xmit, k_timeout_t timeout)
+{
+	return bt_mesh_adv_create_from_pool(&relay_buf_pool, relay_adv_alloc,
+					    BT_MESH_ADV_DATA, xmit, timeout);
+}
+#endif
+
 void bt_mesh_adv_send(struct net_buf *buf, const struct bt_mesh_send_cb *cb,
 		      void *cb_data)
 {
@@ -44,6 +44,8 @@ struct net_buf *bt_mesh_adv_create_from_pool(struct net_buf_pool *pool,
 					     enum bt_mesh_adv_type type,
 					     uint8_t xmit, k_timeout_t timeout);
 
+struct net_buf *bt_mesh_adv_create_relay(uint8_t xmit, k_timeout_t timeout);
+
 void bt_mesh_adv_send(struct net_buf *buf, const struct bt_mesh_send_cb *cb,
 		      void *cb_data);
 
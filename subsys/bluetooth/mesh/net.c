@@ -75,7 +75,9 @@ static struct {
 	uint32_t src : 15, /* MSb of source is always 0 */
 	      seq : 17;
 } msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+#if !defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
 static uint16_t msg_cache_next;
+#endif
 
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
@@ -96,8 +98,51 @@ NET_BUF_POOL_DEFINE(loopback_buf_pool, CONFIG_BT_MESH_LOOPBACK_BUFS,
 		    LOOPBACK_MAX_PDU_LEN, LOOPBACK_USER_DATA_SIZE, NULL);
 
 static uint32_t dup_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+#if !defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
 static int   dup_cache_next;
+#endif
+
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+static bool check_dup(struct net_buf_simple *data)
+{
+	const uint8_t *tail = net_buf_simple_tail(data);
+	uint32_t val;
+	int i;
+
+	val = sys_get_be32(tail - 4) ^ sys_get_be32(tail - 8);
+
+	i = val % ARRAY_SIZE(dup_cache);
+	if (dup_cache[i] == val) {
+		return true;
+	}
+
+	dup_cache[i] = val;
+
+	return false;
+}
+
+static uint16_t msg_cache_slot(uint16_t src, uint32_t seq)
+{
+	uint32_t hash = ((uint32_t)src * 33U) ^ (seq & BIT_MASK(17));
 
+	return hash % ARRAY_SIZE(msg_cache);
+}
+
+static bool msg_cache_match(struct net_buf_simple *pdu)
+{
+	uint16_t i = msg_cache_slot(SRC(pdu->data), SEQ(pdu->data));
+
+	return (msg_cache[i].src == SRC(pdu->data) &&
+		msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17)));
+}
+
+static void msg_cache_add(struct bt_mesh_net_rx *rx)
+{
+	rx->msg_cache_idx = msg_cache_slot(rx->ctx.addr, rx->seq);
+	msg_cache[rx->msg_cache_idx].src = rx->ctx.addr;
+	msg_cache[rx->msg_cache_idx].seq = rx->seq;
+}
+#else /* !CONFIG_BT_MESH_MSG_CACHE_HASH */
 static bool check_dup(struct net_buf_simple *data)
 {
 	const uint8_t *tail = net_buf_simple_tail(data);
@@ -139,6 +184,7 @@ static void msg_cache_add(struct bt_mesh_net_rx *rx)
 	msg_cache[rx->msg_cache_idx].seq = rx->seq;
 	msg_cache_next %= ARRAY_SIZE(msg_cache);
 }
+#endif /* CONFIG_BT_MESH_MSG_CACHE_HASH */
 
 struct bt_mesh_subnet *bt_mesh_subnet_get(uint16_t net_idx)
 {
@@ -437,7 +483,9 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const uint8_t key[16],
 	BT_DBG("NetKey %s", bt_hex(key, 16));
 
 	(void)memset(msg_cache, 0, sizeof(msg_cache));
+#if !defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
 	msg_cache_next = 0U;
+#endif
 
 	sub = &bt_mesh.sub[0];
 
@@ -1208,7 +1256,17 @@ static void bt_mesh_net_relay(struct net_buf_simple *sbuf,
 		transmit = bt_mesh_net_transmit_get();
 	}
 
-	buf = bt_mesh_adv_create(BT_MESH_ADV_DATA, transmit, K_NO_WAIT);
+	/* Adv-adv relaying uses the dedicated relay pool so that heavy
+	 * relay traffic cannot exhaust the buffers needed for locally
+	 * originated messages.
+	 */
+	if (IS_ENABLED(CONFIG_BT_MESH_RELAY) &&
+	    rx->net_if == BT_MESH_NET_IF_ADV) {
+		buf = bt_mesh_adv_create_relay(transmit, K_NO_WAIT);
+	} else {
+		buf = bt_mesh_adv_create(BT_MESH_ADV_DATA, transmit, K_NO_WAIT);
+	}
+
 	if (!buf) {
 		BT_ERR("Out of relay buffers");
 		return;
@@ -1375,8 +1433,10 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 	if (bt_mesh_trans_recv(&buf, &rx) == -EAGAIN) {
 		BT_WARN("Removing rejected message from Network Message Cache");
 		msg_cache[rx.msg_cache_idx].src = BT_MESH_ADDR_UNASSIGNED;
+#if !defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
 		/* Rewind the next index now that we're not using this entry */
 		msg_cache_next = rx.msg_cache_idx;
+#endif
 	}
 
 	/* Relay if this was a group/virtual address, or if the destination
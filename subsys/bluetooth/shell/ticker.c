@@ -9,6 +9,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr.h>
 
 #include <bluetooth/bluetooth.h>
@@ -122,10 +123,46 @@ int cmd_ticker_info(const struct shell *shell, size_t argc, char *argv[])
 	return 0;
 }
 
+#if defined(CONFIG_BT_TICKER_STATS)
+int cmd_ticker_stats(const struct shell *shell, size_t argc, char *argv[])
+{
+	struct ticker_stats stats;
+	uint8_t ticker_id;
+
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		ticker_stats_reset(0);
+		shell_print(shell, "Ticker statistics reset.");
+
+		return 0;
+	}
+
+	shell_print(shell, "---------------------------------------------");
+	shell_print(shell, " id  expired  skipped  must-exp lazy-max");
+	shell_print(shell, "---------------------------------------------");
+	for (ticker_id = 0U;
+	     ticker_stats_get(0, ticker_id, &stats) == TICKER_STATUS_SUCCESS;
+	     ticker_id++) {
+		if (!stats.expired && !stats.skipped) {
+			continue;
+		}
+
+		shell_print(shell, "%03u %08u %08u %08u %08u", ticker_id,
+			    stats.expired, stats.skipped, stats.must_expire,
+			    stats.lazy_max);
+	}
+	shell_print(shell, "---------------------------------------------");
+
+	return 0;
+}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #define HELP_NONE "[none]"
 
 SHELL_STATIC_SUBCMD_SET_CREATE(ticker_cmds,
 	SHELL_CMD_ARG(info, NULL, HELP_NONE, cmd_ticker_info, 1, 0),
+#if defined(CONFIG_BT_TICKER_STATS)
+	SHELL_CMD_ARG(stats, NULL, "[reset]", cmd_ticker_stats, 1, 1),
+#endif /* CONFIG_BT_TICKER_STATS */
 	SHELL_SUBCMD_SET_END
 );
 
@@ -5,6 +5,7 @@
  */
 
 #include "isotp_internal.h"
+#include <string.h>
 #include <net/buf.h>
 #include <kernel.h>
 #include <init.h>
@@ -265,6 +266,25 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 	switch (ctx->state) {
 	case ISOTP_RX_STATE_PROCESS_SF:
 		ctx->buf->len = receive_get_sf_length(ctx->buf);
+		if (ctx->recv_buf) {
+			LOG_DBG("SM process SF of length %d into receive buf",
+				ctx->buf->len);
+			if (ctx->buf->len > ctx->recv_buf_size) {
+				receive_report_error(ctx,
+						     ISOTP_NO_BUF_DATA_LEFT);
+				receive_state_machine(ctx);
+				break;
+			}
+
+			memcpy(ctx->recv_buf, ctx->buf->data, ctx->buf->len);
+			ctx->recv_buf_len = ctx->buf->len;
+			ctx->recv_buf = NULL;
+			net_buf_reset(ctx->buf);
+			ctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
+			k_sem_give(&ctx->recv_sem);
+			break;
+		}
+
 		ud_rem_len = net_buf_user_data(ctx->buf);
 		*ud_rem_len = 0;
 		LOG_DBG("SM process SF of length %d", ctx->buf->len);
@@ -277,6 +297,29 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 		ctx->length = receive_get_ff_length(ctx->buf);
 		LOG_DBG("SM process FF. Length: %d", ctx->length);
 		ctx->length -= ctx->buf->len;
+		if (ctx->recv_buf) {
+			if (ctx->length + ctx->buf->len > ctx->recv_buf_size) {
+				LOG_ERR("Pkt length is %d but receive buffer "
+					"has only %zu bytes",
+					ctx->length + ctx->buf->len,
+					ctx->recv_buf_size);
+				receive_report_error(ctx,
+						     ISOTP_N_BUFFER_OVERFLW);
+				receive_state_machine(ctx);
+				break;
+			}
+
+			/* CFs land in the receive buffer from the RX ISR */
+			memcpy(ctx->recv_buf, ctx->buf->data, ctx->buf->len);
+			ctx->recv_buf_len = ctx->buf->len;
+			net_buf_reset(ctx->buf);
+			ctx->bs = ctx->opts.bs;
+			ctx->wft = ISOTP_WFT_FIRST;
+			ctx->state = ISOTP_RX_STATE_SEND_FC;
+			receive_state_machine(ctx);
+			break;
+		}
+
 		if (ctx->opts.bs == 0 &&
 		    ctx->length > CONFIG_ISOTP_RX_BUF_COUNT *
 		    CONFIG_ISOTP_RX_BUF_SIZE) {
@@ -342,6 +385,11 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 			receive_send_fc(ctx, ISOTP_PCI_FS_OVFLW);
 		}
 
+		if (ctx->recv_buf) {
+			ctx->recv_buf = NULL;
+			k_sem_give(&ctx->recv_sem);
+		}
+
 		k_fifo_cancel_wait(&ctx->fifo);
 		net_buf_unref(ctx->buf);
 		ctx->buf = NULL;
@@ -476,11 +524,28 @@ static void process_cf(struct isotp_recv_ctx *ctx, struct zcan_frame *frame)
 	}
 
 	LOG_DBG("Got CF irq. Appending data");
-	receive_add_mem(ctx, &frame->data[index], frame->dlc - index);
+	if (ctx->recv_buf) {
+		size_t cf_len = MIN((size_t)frame->dlc - index,
+				    ctx->recv_buf_size - ctx->recv_buf_len);
+
+		memcpy(ctx->recv_buf + ctx->recv_buf_len, &frame->data[index],
+		       cf_len);
+		ctx->recv_buf_len += cf_len;
+	} else {
+		receive_add_mem(ctx, &frame->data[index], frame->dlc - index);
+	}
+
 	ctx->length -= frame->dlc - index;
 	LOG_DBG("%d bytes remaining", ctx->length);
 
 	if (ctx->length == 0) {
+		if (ctx->recv_buf) {
+			ctx->recv_buf = NULL;
+			ctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
+			k_sem_give(&ctx->recv_sem);
+			return;
+		}
+
 		ctx->state = ISOTP_RX_STATE_RECYCLE;
 		*ud_rem_len = 0;
 		net_buf_put(&ctx->fifo, ctx->buf);
@@ -488,6 +553,13 @@ static void process_cf(struct isotp_recv_ctx *ctx, struct zcan_frame *frame)
 	}
 
 	if (ctx->opts.bs && !--ctx->bs) {
+		if (ctx->recv_buf) {
+			LOG_DBG("Block is complete. Continue in receive buf");
+			ctx->bs = ctx->opts.bs;
+			ctx->state = ISOTP_RX_STATE_SEND_FC;
+			return;
+		}
+
 		LOG_DBG("Block is complete. Allocate new buffer");
 		ctx->bs = ctx->opts.bs;
 		*ud_rem_len = ctx->length;
@@ -564,6 +636,8 @@ int isotp_bind(struct isotp_recv_ctx *ctx, const struct device *can_dev,
 	ctx->rx_addr = *rx_addr;
 	ctx->tx_addr = *tx_addr;
 	k_fifo_init(&ctx->fifo);
+	k_sem_init(&ctx->recv_sem, 0, 1);
+	ctx->recv_buf = NULL;
 
 	__ASSERT(opts->stmin < ISOTP_STMIN_MAX, "STmin limit");
 	__ASSERT(opts->stmin <= ISOTP_STMIN_MS_MAX ||
@@ -618,6 +692,9 @@ void isotp_unbind(struct isotp_recv_ctx *ctx)
 
 	k_fifo_cancel_wait(&ctx->fifo);
 
+	ctx->recv_buf = NULL;
+	k_sem_give(&ctx->recv_sem);
+
 	if (ctx->buf) {
 		net_buf_unref(ctx->buf);
 	}
@@ -702,6 +779,51 @@ int isotp_recv(struct isotp_recv_ctx *ctx, uint8_t *data, size_t len,
 	return num_copied;
 }
 
+int isotp_recv_into(struct isotp_recv_ctx *ctx, uint8_t *data, size_t len,
+		    k_timeout_t timeout)
+{
+	unsigned int key;
+	int ret;
+
+	__ASSERT(ctx, "ctx is NULL");
+	__ASSERT(data, "data is NULL");
+
+	key = irq_lock();
+	ctx->recv_buf_len = 0;
+	ctx->recv_buf_size = len;
+	ctx->recv_buf = data;
+	irq_unlock(key);
+
+	ret = k_sem_take(&ctx->recv_sem, timeout);
+	if (ret) {
+		key = irq_lock();
+		ctx->recv_buf = NULL;
+		if (ctx->state == ISOTP_RX_STATE_SEND_FC ||
+		    ctx->state == ISOTP_RX_STATE_WAIT_CF) {
+			/* Abort an ongoing reception. The ERR state frees the
+			 * FF buffer and recycles the context.
+			 */
+			receive_report_error(ctx, ISOTP_N_TIMEOUT_CR);
+			k_work_submit(&ctx->work);
+		}
+
+		irq_unlock(key);
+		return ISOTP_RECV_TIMEOUT;
+	}
+
+	if (ctx->error_nr) {
+		ret = ctx->error_nr;
+		ctx->error_nr = 0;
+		return ret;
+	}
+
+	if (ctx->state == ISOTP_RX_STATE_UNBOUND) {
+		return ISOTP_N_ERROR;
+	}
+
+	return ctx->recv_buf_len;
+}
+
 static inline void send_report_error(struct isotp_send_ctx *ctx, uint32_t err)
 {
 	ctx->state = ISOTP_TX_ERR;
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <device.h>
+#include <storage/flash_map.h>
+#include <storage/stream_flash.h>
+#include <sys/byteorder.h>
+#include <sys/util.h>
+
+#include <debug/coredump.h>
+#include "coredump_internal.h"
+
+#include <logging/log.h>
+LOG_MODULE_DECLARE(coredump, CONFIG_KERNEL_LOG_LEVEL);
+
+/*
+ * Layout of the "coredump_partition" flash partition:
+ *
+ * 4 byte magic ('Z' 'C' 'D' '1') followed by a stream of records,
+ * each starting with a 1 byte tag and a 2 byte little endian length.
+ * A literal record carries that many raw coredump bytes, a fill
+ * record stands for that many zero bytes and carries none, and the
+ * end/error records have zero length and terminate the stream. The
+ * decoded stream is the same byte sequence the logging backend would
+ * have printed in hex.
+ */
+#define RECORD_TAG_LITERAL	0x00
+#define RECORD_TAG_FILL		0x01
+#define RECORD_TAG_END		0x02
+#define RECORD_TAG_ERROR	0x03
+
+#define RECORD_LEN_MAX		UINT16_MAX
+
+/* Zero runs shorter than this take less space as literal data
+ * than as a separate record.
+ */
+#define ZERO_RUN_MIN		8
+
+#define WRITE_BUF_SIZE	CONFIG_DEBUG_COREDUMP_BACKEND_FLASH_PARTITION_BUF_SIZE
+
+static const uint8_t dump_magic[4] = { 'Z', 'C', 'D', '1' };
+
+static struct stream_flash_ctx stream_ctx;
+static uint8_t stream_buf[WRITE_BUF_SIZE];
+static int backend_error;
+
+static void data_write(const uint8_t *buf, size_t len)
+{
+	if (backend_error == 0) {
+		backend_error = stream_flash_buffered_write(&stream_ctx, buf,
+							    len, false);
+	}
+}
+
+static void record_write(uint8_t tag, const uint8_t *data, size_t len)
+{
+	uint8_t hdr[3];
+
+	hdr[0] = tag;
+	sys_put_le16((uint16_t)len, &hdr[1]);
+
+	data_write(hdr, sizeof(hdr));
+
+	if (data != NULL) {
+		data_write(data, len);
+	}
+}
+
+static void coredump_flash_backend_start(void)
+{
+	const struct flash_area *fa;
+	const struct device *fdev;
+	int ret;
+
+	backend_error = 0;
+
+	ret = flash_area_open(FLASH_AREA_ID(coredump_partition), &fa);
+	if (ret == 0) {
+		fdev = device_get_binding(fa->fa_dev_name);
+
+		if (fdev == NULL) {
+			ret = -ENODEV;
+		} else {
+			ret = stream_flash_init(&stream_ctx, fdev, stream_buf,
+						sizeof(stream_buf), fa->fa_off,
+						fa->fa_size, NULL);
+		}
+
+		flash_area_close(fa);
+	}
+
+	if (ret != 0) {
+		LOG_ERR("Cannot open coredump partition: %d", ret);
+		backend_error = ret;
+		return;
+	}
+
+	data_write(dump_magic, sizeof(dump_magic));
+}
+
+static void coredump_flash_backend_end(void)
+{
+	if (backend_error == 0) {
+		record_write(RECORD_TAG_END, NULL, 0);
+	}
+
+	if (backend_error == 0) {
+		backend_error = stream_flash_buffered_write(&stream_ctx, NULL,
+							    0, true);
+	}
+
+	if (backend_error != 0) {
+		LOG_ERR("Flash coredump failed: %d", backend_error);
+	} else {
+		LOG_ERR("Coredump: %u bytes written to flash",
+			(uint32_t)stream_flash_bytes_written(&stream_ctx));
+	}
+}
+
+static void coredump_flash_backend_error(void)
+{
+	record_write(RECORD_TAG_ERROR, NULL, 0);
+}
+
+static int coredump_flash_backend_buffer_output(uint8_t *buf, size_t buflen)
+{
+	size_t i = 0;
+
+	if ((buf == NULL) || (buflen == 0)) {
+		return -EINVAL;
+	}
+
+	while ((i < buflen) && (backend_error == 0)) {
+		size_t span;
+
+		if (IS_ENABLED(
+			CONFIG_DEBUG_COREDUMP_BACKEND_FLASH_PARTITION_COMPRESS)
+		    && (buf[i] == 0U)) {
+			span = 1;
+
+			while ((i + span < buflen) &&
+			       (span < RECORD_LEN_MAX) &&
+			       (buf[i + span] == 0U)) {
+				span++;
+			}
+
+			if (span >= ZERO_RUN_MIN) {
+				record_write(RECORD_TAG_FILL, NULL, span);
+				i += span;
+				continue;
+			}
+		}
+
+		/* Literal span up to the next compressible zero run. */
+		span = 0;
+
+		if (IS_ENABLED(
+			CONFIG_DEBUG_COREDUMP_BACKEND_FLASH_PARTITION_COMPRESS)
+		    ) {
+			size_t zeros = 0;
+
+			while ((i + span < buflen) && (span < RECORD_LEN_MAX)) {
+				if (buf[i + span] == 0U) {
+					zeros++;
+					if (zeros == ZERO_RUN_MIN) {
+						span -= ZERO_RUN_MIN - 1;
+						break;
+					}
+				} else {
+					zeros = 0;
+				}
+				span++;
+			}
+		} else {
+			span = MIN(buflen - i, RECORD_LEN_MAX);
+		}
+
+		record_write(RECORD_TAG_LITERAL, &buf[i], span);
+		i += span;
+	}
+
+	return backend_error;
+}
+
+struct z_coredump_backend_api z_coredump_backend_flash_partition = {
+	.start = coredump_flash_backend_start,
+	.end = coredump_flash_backend_end,
+	.error = coredump_flash_backend_error,
+	.buffer_output = coredump_flash_backend_buffer_output,
+};
@@ -17,6 +17,10 @@
 extern struct z_coredump_backend_api z_coredump_backend_logging;
 static struct z_coredump_backend_api
 	*backend_api = &z_coredump_backend_logging;
+#elif defined(CONFIG_DEBUG_COREDUMP_BACKEND_FLASH_PARTITION)
+extern struct z_coredump_backend_api z_coredump_backend_flash_partition;
+static struct z_coredump_backend_api
+	*backend_api = &z_coredump_backend_flash_partition;
 #elif defined(DEBUG_COREDUMP_BACKEND_NULL)
 extern struct z_coredump_backend_api z_coredump_backend_null;
 static struct z_coredump_backend_api
@@ -50,13 +54,18 @@ static int dump_header(unsigned int reason)
 
 static void dump_thread(struct k_thread *thread)
 {
-#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN
+#if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN) || \
+	defined(CONFIG_DEBUG_COREDUMP_PRIORITIZE_CURRENT_THREAD)
 	uintptr_t end_addr;
 
 	/*
 	 * When dumping minimum information,
 	 * the current thread struct and stack need to
 	 * to be dumped so debugger can examine them.
+	 *
+	 * When prioritizing the current thread, they are dumped
+	 * ahead of the full memory regions so a truncated dump
+	 * still contains them.
 	 */
 
 	if (thread == NULL) {
@@ -45,6 +45,14 @@ static void thread_print_cb(struct thread_analyzer_info *info)
 		THREAD_ANALYZER_VSTR(info->name),
 		info->stack_size - info->stack_used, info->stack_used,
 		info->stack_size, pcnt);
+
+#ifdef CONFIG_TRACING_THREAD_STATS
+	THREAD_ANALYZER_PRINT(
+		THREAD_ANALYZER_FMT(
+			" %-20s: cycles %llu, switched in %u times"),
+		THREAD_ANALYZER_VSTR(info->name),
+		info->run_cycles, info->run_switches);
+#endif
 }
 
 static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
@@ -77,6 +85,10 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 	info.name = name;
 	info.stack_size = size;
 	info.stack_used = size - unused;
+#ifdef CONFIG_TRACING_THREAD_STATS
+	info.run_cycles = thread->run_cycles;
+	info.run_switches = thread->run_switches;
+#endif
 	cb(&info);
 }
 
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ *  @brief Sampling thread profiler implementation
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <debug/thread_profiler.h>
+#include <sys/byteorder.h>
+#include <logging/log.h>
+#include <stdio.h>
+
+LOG_MODULE_REGISTER(thread_profiler, CONFIG_THREAD_PROFILER_LOG_LEVEL);
+
+#if IS_ENABLED(CONFIG_THREAD_PROFILER_USE_PRINTK)
+#define THREAD_PROFILER_PRINT(...) printk(__VA_ARGS__)
+#define THREAD_PROFILER_FMT(str)   str "\n"
+#define THREAD_PROFILER_VSTR(str)  (str)
+#else
+#define THREAD_PROFILER_PRINT(...) LOG_INF(__VA_ARGS__)
+#define THREAD_PROFILER_FMT(str)   str
+#define THREAD_PROFILER_VSTR(str)  log_strdup(str)
+#endif
+
+/* @brief Maximum length of the pointer when converted to string
+ *
+ * Pointer is converted to string in hexadecimal form.
+ * It would use 2 hex digits for every single byte of the pointer
+ * but some implementations adds 0x prefix when used with %p format option.
+ */
+#define PTR_STR_MAXLEN (sizeof(void *) * 2 + 2)
+
+struct thread_profiler_rec {
+	struct k_thread *thread;
+	uint32_t samples;
+};
+
+static struct thread_profiler_rec recs[CONFIG_THREAD_PROFILER_MAX_THREADS];
+static uint32_t total_samples;
+static uint32_t unattributed_samples;
+static struct k_timer sample_timer;
+
+/* Runs in the system timer interrupt: one table walk per sample, no
+ * locking needed as the readers snapshot the counters with interrupts
+ * locked.
+ */
+static void profiler_sample(struct k_timer *timer)
+{
+	struct k_thread *cur = k_current_get();
+	int free_idx = -1;
+
+	ARG_UNUSED(timer);
+
+	total_samples++;
+
+	for (int i = 0; i < ARRAY_SIZE(recs); i++) {
+		if (recs[i].thread == cur) {
+			recs[i].samples++;
+			return;
+		}
+
+		if (recs[i].thread == NULL && free_idx < 0) {
+			free_idx = i;
+		}
+	}
+
+	if (free_idx >= 0) {
+		recs[free_idx].thread = cur;
+		recs[free_idx].samples = 1;
+	} else {
+		/* More live threads than table entries. */
+		unattributed_samples++;
+	}
+}
+
+void thread_profiler_run(thread_profiler_cb cb)
+{
+	for (int i = 0; i < ARRAY_SIZE(recs); i++) {
+		struct thread_profiler_info info;
+		char hexname[PTR_STR_MAXLEN + 1];
+		const char *name;
+
+		if (recs[i].thread == NULL) {
+			continue;
+		}
+
+		name = k_thread_name_get((k_tid_t)recs[i].thread);
+		if (!name || name[0] == '\0') {
+			name = hexname;
+			snprintk(hexname, sizeof(hexname), "%p",
+				 (void *)recs[i].thread);
+		}
+
+		info.name = name;
+		info.samples = recs[i].samples;
+		info.total_samples = total_samples;
+
+		cb(&info);
+	}
+}
+
+static void thread_sample_print_cb(struct thread_profiler_info *info)
+{
+	uint32_t pcnt = (uint32_t)(((uint64_t)info->samples * 100U) /
+				   info->total_samples);
+
+	THREAD_PROFILER_PRINT(
+		THREAD_PROFILER_FMT(" %-20s: samples %u (%u %%)"),
+		THREAD_PROFILER_VSTR(info->name), info->samples, pcnt);
+}
+
+void thread_profiler_print(void)
+{
+	THREAD_PROFILER_PRINT(
+		THREAD_PROFILER_FMT("Thread profile (%u samples):"),
+		total_samples);
+
+	if (total_samples == 0U) {
+		return;
+	}
+
+	thread_profiler_run(thread_sample_print_cb);
+
+	if (unattributed_samples > 0U) {
+		THREAD_PROFILER_PRINT(
+			THREAD_PROFILER_FMT(" %-20s: samples %u"),
+			THREAD_PROFILER_VSTR("(unattributed)"),
+			unattributed_samples);
+	}
+}
+
+void thread_profiler_start(void)
+{
+	k_timer_start(&sample_timer,
+		      K_USEC(CONFIG_THREAD_PROFILER_SAMPLE_INTERVAL_US),
+		      K_USEC(CONFIG_THREAD_PROFILER_SAMPLE_INTERVAL_US));
+}
+
+void thread_profiler_stop(void)
+{
+	k_timer_stop(&sample_timer);
+}
+
+void thread_profiler_reset(void)
+{
+	unsigned int key = irq_lock();
+
+	(void)memset(recs, 0, sizeof(recs));
+	total_samples = 0U;
+	unattributed_samples = 0U;
+
+	irq_unlock(key);
+}
+
+int thread_profiler_export(uint8_t *buf, size_t len)
+{
+	unsigned int key;
+	size_t off = 0;
+	int ret = 0;
+
+	key = irq_lock();
+
+	if (len < 2 * sizeof(uint32_t)) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	sys_put_le32(total_samples, &buf[off]);
+	off += sizeof(uint32_t);
+	sys_put_le32(unattributed_samples, &buf[off]);
+	off += sizeof(uint32_t);
+
+	for (int i = 0; i < ARRAY_SIZE(recs); i++) {
+		if (recs[i].thread == NULL) {
+			continue;
+		}
+
+		if (len - off < 2 * sizeof(uint32_t)) {
+			ret = -ENOMEM;
+			goto out;
+		}
+
+		sys_put_le32((uint32_t)(uintptr_t)recs[i].thread, &buf[off]);
+		off += sizeof(uint32_t);
+		sys_put_le32(recs[i].samples, &buf[off]);
+		off += sizeof(uint32_t);
+	}
+
+	ret = off;
+out:
+	irq_unlock(key);
+
+	return ret;
+}
+
+static int thread_profiler_init(const struct device *arg)
+{
+	ARG_UNUSED(arg);
+
+	k_timer_init(&sample_timer, profiler_sample, NULL);
+
+	if (IS_ENABLED(CONFIG_THREAD_PROFILER_AUTO_START)) {
+		thread_profiler_start();
+	}
+
+	return 0;
+}
+
+SYS_INIT(thread_profiler_init, APPLICATION, 0);
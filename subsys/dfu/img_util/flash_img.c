@@ -13,10 +13,14 @@
 #include <storage/flash_map.h>
 #include <storage/stream_flash.h>
 
-#ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
+#if defined(CONFIG_IMG_ERASE_PROGRESSIVELY) || defined(CONFIG_IMG_ERASE_AHEAD)
 #include <dfu/mcuboot.h>
 #endif
 
+#ifdef CONFIG_IMG_ERASE_AHEAD
+#include <drivers/flash.h>
+#endif
+
 #include <devicetree.h>
 /* FLASH_AREA_ID() values used below are auto-generated by DT */
 #ifdef CONFIG_TRUSTED_EXECUTION_NONSECURE
@@ -32,16 +36,177 @@ BUILD_ASSERT((CONFIG_IMG_BLOCK_BUF_SIZE % FLASH_WRITE_BLOCK_SIZE == 0),
 	     "CONFIG_IMG_BLOCK_BUF_SIZE is not a multiple of "
 	     "FLASH_WRITE_BLOCK_SIZE");
 
+#ifdef CONFIG_IMG_ERASE_AHEAD
+
+/* Erase the page an offset belongs to; when the offset is the erase
+ * cursor, advance the cursor past the erased page.
+ */
+static int flash_img_erase_page(struct flash_img_context *ctx, off_t off)
+{
+	struct flash_pages_info page;
+	int rc;
+
+	rc = flash_get_page_info_by_offs(ctx->stream.fdev, off, &page);
+	if (rc != 0) {
+		return rc;
+	}
+
+	flash_write_protection_set(ctx->stream.fdev, false);
+	rc = flash_erase(ctx->stream.fdev, page.start_offset, page.size);
+	flash_write_protection_set(ctx->stream.fdev, true);
+
+	if (rc == 0 && off == ctx->ea_next) {
+		ctx->ea_next = page.start_offset + page.size;
+	}
+
+	return rc;
+}
+
+/* Make sure everything up to the end of the incoming data is erased,
+ * erasing in-line whatever the background work has not covered yet.
+ */
+static int flash_img_erase_cover(struct flash_img_context *ctx, size_t len)
+{
+	off_t end = ctx->flash_area->fa_off +
+		    stream_flash_bytes_written(&ctx->stream) +
+		    ctx->stream.buf_bytes + len;
+	int rc = 0;
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	uint32_t start = k_uptime_get_32();
+#endif
+
+	end = MIN(end, ctx->ea_limit);
+	while (ctx->ea_next < end) {
+		rc = flash_img_erase_page(ctx, ctx->ea_next);
+		if (rc != 0) {
+			break;
+		}
+	}
+
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	ctx->progress.erase_ms += k_uptime_get_32() - start;
+#endif
+	return rc;
+}
+
+/* Keep pages pre-erased ahead of the write position, from the system
+ * workqueue, while the caller waits for more download data.
+ */
+static void flash_img_ea_handler(struct k_work *work)
+{
+	struct flash_img_context *ctx =
+		CONTAINER_OF(work, struct flash_img_context, ea_work);
+	struct flash_pages_info page;
+	off_t frontier;
+	off_t target;
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	uint32_t start = k_uptime_get_32();
+#endif
+
+	frontier = ctx->flash_area->fa_off +
+		   stream_flash_bytes_written(&ctx->stream) +
+		   ctx->stream.buf_bytes;
+
+	if (flash_get_page_info_by_offs(ctx->stream.fdev, frontier,
+					&page) == 0) {
+		target = frontier +
+			 (off_t)CONFIG_IMG_ERASE_AHEAD_PAGES * page.size;
+		target = MIN(target, ctx->ea_limit);
+
+		while (ctx->ea_next < target) {
+			if (flash_img_erase_page(ctx, ctx->ea_next) != 0) {
+				break;
+			}
+		}
+	}
+
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	ctx->progress.erase_ms += k_uptime_get_32() - start;
+#endif
+	k_sem_give(&ctx->ea_idle);
+}
+
+#endif /* CONFIG_IMG_ERASE_AHEAD */
+
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+void flash_img_set_progress_cb(struct flash_img_context *ctx,
+			       flash_img_progress_cb cb)
+{
+	ctx->progress_cb = cb;
+}
+#endif
+
 int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 			     size_t len, bool flush)
 {
 	int rc;
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	uint32_t start;
+#endif
 
+#ifdef CONFIG_IMG_ERASE_AHEAD
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	start = k_uptime_get_32();
+#endif
+	/* wait out a still running background erase, then cover the
+	 * remainder in-line
+	 */
+	k_sem_take(&ctx->ea_idle, K_FOREVER);
+	rc = flash_img_erase_cover(ctx, len);
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	ctx->progress.stall_ms += k_uptime_get_32() - start;
+#endif
+	if (rc != 0) {
+		k_sem_give(&ctx->ea_idle);
+		return rc;
+	}
+#endif /* CONFIG_IMG_ERASE_AHEAD */
+
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	start = k_uptime_get_32();
+#endif
 	rc = stream_flash_buffered_write(&ctx->stream, data, len, flush);
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (rc == 0 && ctx->hash_valid) {
+		if (tc_sha256_update(&ctx->hash_ctx, data,
+				     len) == TC_CRYPTO_SUCCESS) {
+			ctx->hash_bytes += len;
+		} else {
+			ctx->hash_valid = false;
+		}
+	}
+#endif
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	ctx->progress.write_ms += k_uptime_get_32() - start;
+	ctx->progress.bytes_written = stream_flash_bytes_written(&ctx->stream);
+	if (ctx->progress_cb) {
+		ctx->progress_cb(&ctx->progress);
+	}
+#endif
+
 	if (!flush) {
+#ifdef CONFIG_IMG_ERASE_AHEAD
+		if (rc == 0) {
+			k_work_submit(&ctx->ea_work);
+		} else {
+			k_sem_give(&ctx->ea_idle);
+		}
+#endif
 		return rc;
 	}
 
+#ifdef CONFIG_IMG_ERASE_AHEAD
+	k_sem_give(&ctx->ea_idle);
+	if (ctx->flash_area->fa_off +
+	    BOOT_TRAILER_IMG_STATUS_OFFS(ctx->flash_area) >= ctx->ea_next) {
+		rc = flash_img_erase_page(ctx,
+				ctx->flash_area->fa_off +
+				BOOT_TRAILER_IMG_STATUS_OFFS(ctx->flash_area));
+		if (rc) {
+			return rc;
+		}
+	}
+#endif
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
 	rc = stream_flash_erase_page(&ctx->stream,
 				ctx->flash_area->fa_off +
@@ -62,6 +227,56 @@ size_t flash_img_bytes_written(struct flash_img_context *ctx)
 	return stream_flash_bytes_written(&ctx->stream);
 }
 
+int flash_img_resume(struct flash_img_context *ctx, size_t offset)
+{
+	if (!ctx || ctx->flash_area == NULL) {
+		return -EFAULT;
+	}
+
+	if ((offset % CONFIG_IMG_BLOCK_BUF_SIZE) ||
+	    (offset > ctx->flash_area->fa_size)) {
+		return -EINVAL;
+	}
+
+	ctx->stream.bytes_written = offset;
+
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (offset != 0) {
+		/* The already flashed prefix did not pass through this
+		 * context, so the running digest cannot cover the image.
+		 */
+		ctx->hash_valid = false;
+	}
+#endif
+
+#if defined(CONFIG_IMG_ERASE_PROGRESSIVELY) || defined(CONFIG_IMG_ERASE_AHEAD)
+	if (offset != 0) {
+		struct flash_pages_info page;
+		int rc;
+
+		/* The page the write position points into was erased and
+		 * partially written before the interruption; make sure it
+		 * is not erased again.
+		 */
+		rc = flash_get_page_info_by_offs(ctx->stream.fdev,
+						 ctx->flash_area->fa_off +
+						 offset - 1, &page);
+		if (rc != 0) {
+			return rc;
+		}
+
+#ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
+		ctx->stream.last_erased_page_start_offset = page.start_offset;
+#endif
+#ifdef CONFIG_IMG_ERASE_AHEAD
+		ctx->ea_next = page.start_offset + page.size;
+#endif
+	}
+#endif
+
+	return 0;
+}
+
 int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 {
 	int rc;
@@ -75,9 +290,31 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 
 	flash_dev = flash_area_get_device(ctx->flash_area);
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
+
+#ifdef CONFIG_IMG_ERASE_AHEAD
+	if (rc == 0) {
+		ctx->ea_next = ctx->flash_area->fa_off;
+		ctx->ea_limit = ctx->flash_area->fa_off +
+				ctx->flash_area->fa_size;
+		k_work_init(&ctx->ea_work, flash_img_ea_handler);
+		k_sem_init(&ctx->ea_idle, 1, 1);
+	}
+#endif
+#ifdef CONFIG_IMG_WRITE_PROGRESS
+	ctx->progress_cb = NULL;
+	memset(&ctx->progress, 0, sizeof(ctx->progress));
+#endif
+#ifdef CONFIG_IMG_STREAM_HASH
+	ctx->hash_bytes = 0;
+	ctx->hash_area_id = area_id;
+	ctx->hash_valid =
+		(rc == 0 && tc_sha256_init(&ctx->hash_ctx) == TC_CRYPTO_SUCCESS);
+#endif
+
+	return rc;
 }
 
 int flash_img_init(struct flash_img_context *ctx)
@@ -97,6 +334,25 @@ int flash_img_check(struct flash_img_context *ctx,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (ctx->hash_valid && ctx->hash_bytes == fic->clen &&
+	    ctx->hash_area_id == area_id) {
+		uint8_t hash[TC_SHA256_DIGEST_SIZE];
+
+		/* The digest can only be finalized once. */
+		ctx->hash_valid = false;
+
+		if (tc_sha256_final(hash, &ctx->hash_ctx) ==
+		    TC_CRYPTO_SUCCESS) {
+			if (memcmp(hash, fic->match, sizeof(hash)) != 0) {
+				return -EILSEQ;
+			}
+
+			return 0;
+		}
+	}
+#endif
+
 	rc = flash_area_open(area_id,
 			     (const struct flash_area **)&(ctx->flash_area));
 	if (rc) {
@@ -60,6 +60,10 @@ int disk_access_init(const char *pdrv)
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->init != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		/* the media may have been exchanged */
+		disk_cache_invalidate(disk);
+#endif
 		rc = disk->ops->init(disk);
 	}
 
@@ -79,6 +83,122 @@ int disk_access_status(const char *pdrv)
 	return rc;
 }
 
+#ifdef CONFIG_DISK_ACCESS_CACHE
+
+/* Small LRU cache of single sectors, shared by all registered disks.
+ * Only single sector transfers are cached; those are what file system
+ * metadata accesses (e.g. the FAT table) look like, while multi sector
+ * data streams pass through and do not flush the cache. Writes go
+ * through to the disk and update any cached copy, so there is never
+ * dirty state to sync.
+ */
+struct disk_cache_line {
+	struct disk_info *disk;	/* owning disk, NULL when free */
+	uint32_t sector;
+	uint32_t last_use;
+	uint8_t buf[CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE];
+};
+
+static struct disk_cache_line disk_cache[CONFIG_DISK_ACCESS_CACHE_COUNT];
+static uint32_t disk_cache_use_cnt;
+static struct k_mutex cache_mutex;
+
+/* the cache only works for disks with the configured sector size */
+static bool disk_cache_usable(struct disk_info *disk)
+{
+	uint32_t sector_size = 0U;
+
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE,
+			      &sector_size) != 0)) {
+		return false;
+	}
+
+	return sector_size == CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE;
+}
+
+static struct disk_cache_line *disk_cache_find(struct disk_info *disk,
+					       uint32_t sector)
+{
+	for (int i = 0; i < CONFIG_DISK_ACCESS_CACHE_COUNT; i++) {
+		if ((disk_cache[i].disk == disk) &&
+		    (disk_cache[i].sector == sector)) {
+			return &disk_cache[i];
+		}
+	}
+	return NULL;
+}
+
+static struct disk_cache_line *disk_cache_evict(void)
+{
+	struct disk_cache_line *victim = &disk_cache[0];
+
+	for (int i = 0; i < CONFIG_DISK_ACCESS_CACHE_COUNT; i++) {
+		if (disk_cache[i].disk == NULL) {
+			return &disk_cache[i];
+		}
+		if (disk_cache[i].last_use < victim->last_use) {
+			victim = &disk_cache[i];
+		}
+	}
+	return victim;
+}
+
+static void disk_cache_invalidate(struct disk_info *disk)
+{
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	for (int i = 0; i < CONFIG_DISK_ACCESS_CACHE_COUNT; i++) {
+		if (disk_cache[i].disk == disk) {
+			disk_cache[i].disk = NULL;
+		}
+	}
+	k_mutex_unlock(&cache_mutex);
+}
+
+static int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+			   uint32_t sector)
+{
+	struct disk_cache_line *line;
+	int rc = 0;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	line = disk_cache_find(disk, sector);
+	if (line == NULL) {
+		line = disk_cache_evict();
+		line->disk = NULL;
+		rc = disk->ops->read(disk, line->buf, sector, 1);
+		if (rc == 0) {
+			line->disk = disk;
+			line->sector = sector;
+		}
+	}
+	if (rc == 0) {
+		line->last_use = ++disk_cache_use_cnt;
+		memcpy(data_buf, line->buf, sizeof(line->buf));
+	}
+	k_mutex_unlock(&cache_mutex);
+	return rc;
+}
+
+static void disk_cache_update(struct disk_info *disk, const uint8_t *data_buf,
+			      uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_line *line;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	for (uint32_t i = 0; i < num_sector; i++) {
+		line = disk_cache_find(disk, start_sector + i);
+		if (line != NULL) {
+			memcpy(line->buf,
+			       &data_buf[i * sizeof(line->buf)],
+			       sizeof(line->buf));
+		}
+	}
+	k_mutex_unlock(&cache_mutex);
+}
+
+#endif /* CONFIG_DISK_ACCESS_CACHE */
+
 int disk_access_read(const char *pdrv, uint8_t *data_buf,
 		     uint32_t start_sector, uint32_t num_sector)
 {
@@ -87,6 +207,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		if ((num_sector == 1U) && disk_cache_usable(disk)) {
+			return disk_cache_read(disk, data_buf, start_sector);
+		}
+#endif
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -102,6 +227,12 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		if ((rc == 0) && disk_cache_usable(disk)) {
+			disk_cache_update(disk, data_buf, start_sector,
+					  num_sector);
+		}
+#endif
 	}
 
 	return rc;
@@ -163,6 +294,9 @@ int disk_access_unregister(struct disk_info *disk)
 	}
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	disk_cache_invalidate(disk);
+#endif
 	LOG_DBG("disk interface(%s) unregistred", disk->name);
 unreg_err:
 	k_mutex_unlock(&mutex);
@@ -174,6 +308,9 @@ static int disk_init(const struct device *dev)
 	ARG_UNUSED(dev);
 
 	k_mutex_init(&mutex);
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	k_mutex_init(&cache_mutex);
+#endif
 	sys_dlist_init(&disk_access_list);
 	return 0;
 }
@@ -59,10 +59,40 @@ struct char_framebuffer {
 
 	/** Invertedj*/
 	bool inverted;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	/** First dirty tile row since the last finalize */
+	uint16_t dirty_row_first;
+
+	/** Last dirty tile row since the last finalize */
+	uint16_t dirty_row_last;
+
+	/** Framebuffer modified since the last finalize */
+	bool dirty;
+#endif
 };
 
 static struct char_framebuffer char_fb;
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+static void cfb_mark_dirty(uint16_t first_row, uint16_t last_row)
+{
+	struct char_framebuffer *fb = &char_fb;
+
+	if (!fb->dirty) {
+		fb->dirty = true;
+		fb->dirty_row_first = first_row;
+		fb->dirty_row_last = last_row;
+		return;
+	}
+
+	fb->dirty_row_first = MIN(fb->dirty_row_first, first_row);
+	fb->dirty_row_last = MAX(fb->dirty_row_last, last_row);
+}
+#else
+#define cfb_mark_dirty(first_row, last_row)
+#endif
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, char c)
 {
 	if (fptr->caps & CFB_FONT_MONO_VPACKED) {
@@ -116,6 +146,9 @@ static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
 
 	}
 
+	cfb_mark_dirty(y / 8U, MIN((y + fptr->height - 1U) / 8U,
+				   (fb->y_res / 8U) - 1U));
+
 	return fptr->width;
 }
 
@@ -174,6 +207,8 @@ int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 	desc.pitch = fb->x_res;
 	memset(fb->buf, 0, fb->size);
 
+	cfb_mark_dirty(0, (fb->y_res / 8U) - 1U);
+
 	return 0;
 }
 
@@ -188,14 +223,18 @@ int cfb_framebuffer_invert(const struct device *dev)
 
 	fb->inverted = !fb->inverted;
 
+	cfb_mark_dirty(0, (fb->y_res / 8U) - 1U);
+
 	return 0;
 }
 
 int cfb_framebuffer_finalize(const struct device *dev)
 {
 	const struct display_driver_api *api = dev->api;
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	struct display_buffer_descriptor desc;
+	uint8_t *buf = fb->buf;
+	uint16_t y = 0U;
 
 	if (!fb || !fb->buf) {
 		return -1;
@@ -210,7 +249,24 @@ int cfb_framebuffer_finalize(const struct device *dev)
 		cfb_invert(fb);
 	}
 
-	return api->write(dev, 0, 0, &desc, fb->buf);
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	if (!fb->dirty) {
+		return 0;
+	}
+
+	/*
+	 * Only push the band of tile rows touched since the last call,
+	 * the rest of the display already holds identical content.
+	 */
+	desc.height = (fb->dirty_row_last - fb->dirty_row_first + 1U) *
+		      fb->ppt;
+	desc.buf_size = (desc.height / 8U) * fb->x_res;
+	buf += fb->dirty_row_first * fb->x_res;
+	y = fb->dirty_row_first * fb->ppt;
+	fb->dirty = false;
+#endif
+
+	return api->write(dev, 0, y, &desc, buf);
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -69,6 +69,33 @@ int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc)
 	uint8_t crc8;
 	uint8_t fl_crc8;
 	off_t off;
+#ifdef CONFIG_FCB_WALK_CACHE
+	uint32_t *valid_off = fcb_walk_cache_slot(fcb, loc->fe_sector);
+
+	if (valid_off && (loc->fe_elem_off < *valid_off)) {
+		uint8_t tmp_str[2];
+		uint16_t len;
+		int cnt;
+
+		/*
+		 * The element was already crc checked during an earlier walk,
+		 * only its header needs to be re-read.
+		 */
+		rc = fcb_flash_read(fcb, loc->fe_sector, loc->fe_elem_off,
+				    tmp_str, 2);
+		if (rc) {
+			return -EIO;
+		}
+		cnt = fcb_get_len(tmp_str, &len);
+		if (cnt < 0) {
+			return cnt;
+		}
+		loc->fe_data_off = loc->fe_elem_off +
+				   fcb_len_in_flash(fcb, cnt);
+		loc->fe_data_len = len;
+		return 0;
+	}
+#endif
 
 	rc = fcb_elem_crc8(fcb, loc, &crc8);
 	if (rc) {
@@ -84,5 +111,15 @@ int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc)
 	if (fl_crc8 != crc8) {
 		return -EBADMSG;
 	}
+
+#ifdef CONFIG_FCB_WALK_CACHE
+	if (valid_off) {
+		uint32_t end = off + fcb_len_in_flash(fcb, FCB_CRC_SZ);
+
+		if (end > *valid_off) {
+			*valid_off = end;
+		}
+	}
+#endif
 	return 0;
 }
@@ -35,6 +35,20 @@ static inline int fcb_len_in_flash(struct fcb *fcb, uint16_t len)
 	return (len + (fcb->f_align - 1U)) & ~(fcb->f_align - 1U);
 }
 
+#ifdef CONFIG_FCB_WALK_CACHE
+/* walk cache slot for a sector, NULL when the sector is not covered */
+static inline uint32_t *fcb_walk_cache_slot(struct fcb *fcb,
+					    const struct flash_sector *sector)
+{
+	ptrdiff_t idx = sector - fcb->f_sectors;
+
+	if (idx >= CONFIG_FCB_WALK_CACHE_SECTORS) {
+		return NULL;
+	}
+	return &fcb->f_valid_off[idx];
+}
+#endif
+
 const struct flash_area *fcb_open_flash(const struct fcb *fcb);
 uint8_t fcb_get_align(const struct fcb *fcb);
 int fcb_erase_sector(const struct fcb *fcb, const struct flash_sector *sector);
@@ -24,6 +24,15 @@ fcb_rotate(struct fcb *fcb)
 		rc = -EIO;
 		goto out;
 	}
+#ifdef CONFIG_FCB_WALK_CACHE
+	{
+		uint32_t *valid_off = fcb_walk_cache_slot(fcb, fcb->f_oldest);
+
+		if (valid_off) {
+			*valid_off = 0U;
+		}
+	}
+#endif
 	if (fcb->f_oldest == fcb->f_active.fe_sector) {
 		/*
 		 * Need to create a new active area, as we're wiping
@@ -125,6 +125,131 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 	return 0;
 }
 
+#ifdef CONFIG_FS_PATH_CACHE
+
+/* Small LRU cache of resolved paths. Each entry maps a path to its
+ * mount point, skipping the mount list walk, and can hold the last
+ * stat result so repeated existence checks do not reach the file
+ * system driver. There is no negative caching: a path is only entered
+ * after a successful resolution.
+ */
+struct fs_path_cache_entry {
+	char path[CONFIG_FS_PATH_CACHE_PATH_LEN]; /* empty when free */
+	struct fs_mount_t *mp;
+	struct fs_dirent stat;
+	bool stat_valid;
+	uint32_t last_use;
+};
+
+static struct fs_path_cache_entry fs_path_cache[CONFIG_FS_PATH_CACHE_COUNT];
+static uint32_t fs_path_cache_use_cnt;
+static struct k_mutex path_cache_mutex;
+
+/* path_cache_mutex must be held */
+static struct fs_path_cache_entry *fs_path_cache_find(const char *path)
+{
+	for (int i = 0; i < CONFIG_FS_PATH_CACHE_COUNT; i++) {
+		if (strcmp(fs_path_cache[i].path, path) == 0) {
+			return &fs_path_cache[i];
+		}
+	}
+	return NULL;
+}
+
+/* find or reuse the least recently used entry, path_cache_mutex held */
+static struct fs_path_cache_entry *fs_path_cache_claim(const char *path)
+{
+	struct fs_path_cache_entry *entry;
+
+	if (strlen(path) >= CONFIG_FS_PATH_CACHE_PATH_LEN) {
+		return NULL;
+	}
+
+	entry = fs_path_cache_find(path);
+	if (entry == NULL) {
+		struct fs_path_cache_entry *victim = &fs_path_cache[0];
+
+		for (int i = 0; i < CONFIG_FS_PATH_CACHE_COUNT; i++) {
+			if (fs_path_cache[i].path[0] == '\0') {
+				victim = &fs_path_cache[i];
+				break;
+			}
+			if (fs_path_cache[i].last_use < victim->last_use) {
+				victim = &fs_path_cache[i];
+			}
+		}
+		strcpy(victim->path, path);
+		victim->stat_valid = false;
+		entry = victim;
+	}
+	entry->last_use = ++fs_path_cache_use_cnt;
+	return entry;
+}
+
+static struct fs_mount_t *fs_path_cache_mnt(const char *path)
+{
+	struct fs_path_cache_entry *entry;
+	struct fs_mount_t *mp = NULL;
+
+	k_mutex_lock(&path_cache_mutex, K_FOREVER);
+	entry = fs_path_cache_find(path);
+	if (entry != NULL) {
+		entry->last_use = ++fs_path_cache_use_cnt;
+		mp = entry->mp;
+	}
+	k_mutex_unlock(&path_cache_mutex);
+	return mp;
+}
+
+static void fs_path_cache_add(const char *path, struct fs_mount_t *mp)
+{
+	struct fs_path_cache_entry *entry;
+
+	k_mutex_lock(&path_cache_mutex, K_FOREVER);
+	entry = fs_path_cache_claim(path);
+	if (entry != NULL) {
+		entry->mp = mp;
+	}
+	k_mutex_unlock(&path_cache_mutex);
+}
+
+static void fs_path_cache_drop(const char *path)
+{
+	struct fs_path_cache_entry *entry;
+
+	k_mutex_lock(&path_cache_mutex, K_FOREVER);
+	entry = fs_path_cache_find(path);
+	if (entry != NULL) {
+		entry->path[0] = '\0';
+	}
+	k_mutex_unlock(&path_cache_mutex);
+}
+
+static void fs_path_cache_drop_stat(const char *path)
+{
+	struct fs_path_cache_entry *entry;
+
+	k_mutex_lock(&path_cache_mutex, K_FOREVER);
+	entry = fs_path_cache_find(path);
+	if (entry != NULL) {
+		entry->stat_valid = false;
+	}
+	k_mutex_unlock(&path_cache_mutex);
+}
+
+static void fs_path_cache_drop_mnt(const struct fs_mount_t *mp)
+{
+	k_mutex_lock(&path_cache_mutex, K_FOREVER);
+	for (int i = 0; i < CONFIG_FS_PATH_CACHE_COUNT; i++) {
+		if (fs_path_cache[i].mp == mp) {
+			fs_path_cache[i].path[0] = '\0';
+		}
+	}
+	k_mutex_unlock(&path_cache_mutex);
+}
+
+#endif /* CONFIG_FS_PATH_CACHE */
+
 /* File operations */
 int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 {
@@ -140,11 +265,27 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FS_PATH_CACHE
+	mp = fs_path_cache_mnt(file_name);
+	if (mp == NULL) {
+		rc = fs_get_mnt_point(&mp, file_name, NULL);
+		if (rc < 0) {
+			LOG_ERR("%s:mount point not found!!", __func__);
+			return rc;
+		}
+		fs_path_cache_add(file_name, mp);
+	}
+	if ((flags & (FS_O_WRITE | FS_O_CREATE)) != 0) {
+		/* the cached stat result is about to go stale */
+		fs_path_cache_drop_stat(file_name);
+	}
+#else
 	rc = fs_get_mnt_point(&mp, file_name, NULL);
 	if (rc < 0) {
 		LOG_ERR("%s:mount point not found!!", __func__);
 		return rc;
 	}
+#endif
 
 	zfp->mp = mp;
 
@@ -481,6 +622,9 @@ int fs_unlink(const char *abs_path)
 		if (rc < 0) {
 			LOG_ERR("failed to unlink path (%d)", rc);
 		}
+#ifdef CONFIG_FS_PATH_CACHE
+		fs_path_cache_drop(abs_path);
+#endif
 	}
 
 	return rc;
@@ -515,6 +659,10 @@ int fs_rename(const char *from, const char *to)
 		if (rc < 0) {
 			LOG_ERR("failed to rename file or dir (%d)", rc);
 		}
+#ifdef CONFIG_FS_PATH_CACHE
+		fs_path_cache_drop(from);
+		fs_path_cache_drop(to);
+#endif
 	}
 
 	return rc;
@@ -531,6 +679,22 @@ int fs_stat(const char *abs_path, struct fs_dirent *entry)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FS_PATH_CACHE
+	{
+		struct fs_path_cache_entry *ce;
+
+		k_mutex_lock(&path_cache_mutex, K_FOREVER);
+		ce = fs_path_cache_find(abs_path);
+		if ((ce != NULL) && ce->stat_valid) {
+			ce->last_use = ++fs_path_cache_use_cnt;
+			*entry = ce->stat;
+			k_mutex_unlock(&path_cache_mutex);
+			return 0;
+		}
+		k_mutex_unlock(&path_cache_mutex);
+	}
+#endif
+
 	rc = fs_get_mnt_point(&mp, abs_path, NULL);
 	if (rc < 0) {
 		LOG_ERR("%s:mount point not found!!", __func__);
@@ -542,6 +706,20 @@ int fs_stat(const char *abs_path, struct fs_dirent *entry)
 		if (rc < 0) {
 			LOG_ERR("failed get file or dir stat (%d)", rc);
 		}
+#ifdef CONFIG_FS_PATH_CACHE
+		if (rc == 0) {
+			struct fs_path_cache_entry *ce;
+
+			k_mutex_lock(&path_cache_mutex, K_FOREVER);
+			ce = fs_path_cache_claim(abs_path);
+			if (ce != NULL) {
+				ce->mp = mp;
+				ce->stat = *entry;
+				ce->stat_valid = true;
+			}
+			k_mutex_unlock(&path_cache_mutex);
+		}
+#endif
 	}
 	return rc;
 }
@@ -672,6 +850,10 @@ int fs_unmount(struct fs_mount_t *mp)
 	/* clear file system interface */
 	mp->fs = NULL;
 
+#ifdef CONFIG_FS_PATH_CACHE
+	fs_path_cache_drop_mnt(mp);
+#endif
+
 	/* remove mount node from the list */
 	sys_dlist_remove(&mp->node);
 	LOG_DBG("fs unmounted from %s", log_strdup(mp->mnt_point));
@@ -757,6 +939,9 @@ int fs_unregister(int type, const struct fs_file_system_t *fs)
 static int fs_init(const struct device *dev)
 {
 	k_mutex_init(&mutex);
+#ifdef CONFIG_FS_PATH_CACHE
+	k_mutex_init(&path_cache_mutex);
+#endif
 	sys_dlist_init(&fs_mnt_list);
 	return 0;
 }
@@ -132,13 +132,197 @@ static int errno_to_lfs(int error)
 }
 
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+
+#define BLOCK_CACHE_LINES CONFIG_FS_LITTLEFS_BLOCK_CACHE_COUNT
+#define BLOCK_CACHE_LINE_SIZE CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCK_SIZE
+
+/* One cached erase block. Writes are collected in buf and recorded in
+ * the dirty range; they reach the flash when the line is flushed on
+ * sync or eviction. Blocks larger than the line bypass the cache.
+ */
+struct block_cache_line {
+	const struct lfs_config *c; /* owning mount, NULL when free */
+	lfs_block_t block;
+	uint32_t last_use;
+	uint32_t dirty_start;	/* dirty range is [dirty_start, dirty_end) */
+	uint32_t dirty_end;
+	uint8_t buf[BLOCK_CACHE_LINE_SIZE];
+};
+
+static struct block_cache_line block_cache[BLOCK_CACHE_LINES];
+static uint32_t block_cache_use_cnt;
+static struct fs_littlefs_cache_stats block_cache_stats;
+
+/* Last block read per mount is not worth tracking separately; a single
+ * record is enough to spot sequential access on the active mount.
+ */
+static const struct lfs_config *block_cache_prev_c;
+static lfs_block_t block_cache_prev_block;
+
+static K_MUTEX_DEFINE(block_cache_mtx);
+
+static struct block_cache_line *block_cache_find(const struct lfs_config *c,
+						 lfs_block_t block)
+{
+	for (int i = 0; i < BLOCK_CACHE_LINES; i++) {
+		if ((block_cache[i].c == c) && (block_cache[i].block == block)) {
+			return &block_cache[i];
+		}
+	}
+	return NULL;
+}
+
+static int block_cache_flush_line(struct block_cache_line *line)
+{
+	int rc = 0;
+
+	if (line->dirty_end > line->dirty_start) {
+		const struct flash_area *fa = line->c->context;
+		size_t offset = line->block * line->c->block_size +
+				line->dirty_start;
+
+		rc = flash_area_write(fa, offset,
+				      &line->buf[line->dirty_start],
+				      line->dirty_end - line->dirty_start);
+		block_cache_stats.flushes++;
+	}
+	line->dirty_start = BLOCK_CACHE_LINE_SIZE;
+	line->dirty_end = 0U;
+	return rc;
+}
+
+/* Claim a line for the given block, flushing and evicting the least
+ * recently used line when all are in use. With from_flash set the
+ * current block content is read in, otherwise the buffer is set to
+ * erased state.
+ */
+static int block_cache_load(const struct lfs_config *c, lfs_block_t block,
+			    bool from_flash, struct block_cache_line **linep)
+{
+	struct block_cache_line *victim = &block_cache[0];
+	int rc;
+
+	for (int i = 0; i < BLOCK_CACHE_LINES; i++) {
+		if (block_cache[i].c == NULL) {
+			victim = &block_cache[i];
+			break;
+		}
+		if (block_cache[i].last_use < victim->last_use) {
+			victim = &block_cache[i];
+		}
+	}
+
+	if (victim->c != NULL) {
+		rc = block_cache_flush_line(victim);
+		if (rc < 0) {
+			return rc;
+		}
+		block_cache_stats.evictions++;
+	}
+
+	victim->c = c;
+	victim->block = block;
+	victim->dirty_start = BLOCK_CACHE_LINE_SIZE;
+	victim->dirty_end = 0U;
+	victim->last_use = ++block_cache_use_cnt;
+
+	if (from_flash) {
+		const struct flash_area *fa = c->context;
+
+		rc = flash_area_read(fa, block * c->block_size, victim->buf,
+				     c->block_size);
+		if (rc < 0) {
+			victim->c = NULL;
+			return rc;
+		}
+	} else {
+		memset(victim->buf, 0xff, c->block_size);
+	}
+
+	*linep = victim;
+	return 0;
+}
+
+/* Flush all dirty lines of a mount; with invalidate also drop them. */
+static int block_cache_flush(const struct lfs_config *c, bool invalidate)
+{
+	int rc = 0;
+
+	k_mutex_lock(&block_cache_mtx, K_FOREVER);
+	for (int i = 0; i < BLOCK_CACHE_LINES; i++) {
+		if (block_cache[i].c != c) {
+			continue;
+		}
+		int line_rc = block_cache_flush_line(&block_cache[i]);
+
+		if ((line_rc < 0) && (rc == 0)) {
+			rc = line_rc;
+		}
+		if (invalidate) {
+			block_cache[i].c = NULL;
+		}
+	}
+	k_mutex_unlock(&block_cache_mtx);
+	return rc;
+}
+
+void fs_littlefs_cache_stats_get(struct fs_littlefs_cache_stats *stats,
+				 bool clear)
+{
+	k_mutex_lock(&block_cache_mtx, K_FOREVER);
+	*stats = block_cache_stats;
+	if (clear) {
+		memset(&block_cache_stats, 0, sizeof(block_cache_stats));
+	}
+	k_mutex_unlock(&block_cache_mtx);
+}
+
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
+	int rc;
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if (c->block_size <= BLOCK_CACHE_LINE_SIZE) {
+		struct block_cache_line *line;
+
+		k_mutex_lock(&block_cache_mtx, K_FOREVER);
+		line = block_cache_find(c, block);
+		if (line != NULL) {
+			block_cache_stats.hits++;
+		} else {
+			block_cache_stats.misses++;
+			rc = block_cache_load(c, block, true, &line);
+			if (rc < 0) {
+				k_mutex_unlock(&block_cache_mtx);
+				return errno_to_lfs(rc);
+			}
+		}
+		line->last_use = ++block_cache_use_cnt;
+		memcpy(buffer, &line->buf[off], size);
+
+		/* sequential pattern: read ahead the next block */
+		if ((c == block_cache_prev_c) &&
+		    (block == block_cache_prev_block + 1) &&
+		    (block + 1 < c->block_count) &&
+		    (block_cache_find(c, block + 1) == NULL)) {
+			if (block_cache_load(c, block + 1, true, &line) == 0) {
+				block_cache_stats.readaheads++;
+			}
+		}
+		block_cache_prev_c = c;
+		block_cache_prev_block = block;
+		k_mutex_unlock(&block_cache_mtx);
+		return LFS_ERR_OK;
+	}
+#endif
 
-	int rc = flash_area_read(fa, offset, buffer, size);
+	rc = flash_area_read(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
 }
@@ -148,8 +332,39 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
+	int rc;
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if (c->block_size <= BLOCK_CACHE_LINE_SIZE) {
+		struct block_cache_line *line;
+
+		k_mutex_lock(&block_cache_mtx, K_FOREVER);
+		line = block_cache_find(c, block);
+		if (line == NULL) {
+			/* Unprogrammed regions are in erased state, so
+			 * reading the block back keeps non-dirty bytes
+			 * valid for later cache hits.
+			 */
+			rc = block_cache_load(c, block, true, &line);
+			if (rc < 0) {
+				k_mutex_unlock(&block_cache_mtx);
+				return errno_to_lfs(rc);
+			}
+		}
+		memcpy(&line->buf[off], buffer, size);
+		if (off < line->dirty_start) {
+			line->dirty_start = off;
+		}
+		if (off + size > line->dirty_end) {
+			line->dirty_end = off + size;
+		}
+		line->last_use = ++block_cache_use_cnt;
+		k_mutex_unlock(&block_cache_mtx);
+		return LFS_ERR_OK;
+	}
+#endif
 
-	int rc = flash_area_write(fa, offset, buffer, size);
+	rc = flash_area_write(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
 }
@@ -158,14 +373,38 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size;
+	int rc;
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if (c->block_size <= BLOCK_CACHE_LINE_SIZE) {
+		struct block_cache_line *line;
+
+		/* Erase goes straight to the flash; pending writes to
+		 * the block are obsolete, so just drop the line.
+		 */
+		k_mutex_lock(&block_cache_mtx, K_FOREVER);
+		line = block_cache_find(c, block);
+		if (line != NULL) {
+			line->c = NULL;
+		}
+		k_mutex_unlock(&block_cache_mtx);
+	}
+#endif
 
-	int rc = flash_area_erase(fa, offset, c->block_size);
+	rc = flash_area_erase(fa, offset, c->block_size);
 
 	return errno_to_lfs(rc);
 }
 
 static int lfs_api_sync(const struct lfs_config *c)
 {
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	int rc = block_cache_flush(c, false);
+
+	if (rc < 0) {
+		return errno_to_lfs(rc);
+	}
+#endif
 	return LFS_ERR_OK;
 }
 
@@ -711,6 +950,9 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	fs_lock(fs);
 
 	lfs_unmount(&fs->lfs);
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	(void)block_cache_flush(&fs->cfg, true);
+#endif
 	flash_area_close(fs->area);
 	fs->area = NULL;
 
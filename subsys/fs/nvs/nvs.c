@@ -16,6 +16,87 @@
 #include <logging/log.h>
 LOG_MODULE_REGISTER(fs_nvs, CONFIG_NVS_LOG_LEVEL);
 
+static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr,
+			struct nvs_ate *ate);
+static int nvs_ate_crc8_check(const struct nvs_ate *entry);
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+
+BUILD_ASSERT((CONFIG_NVS_LOOKUP_CACHE_SIZE &
+	      (CONFIG_NVS_LOOKUP_CACHE_SIZE - 1)) == 0,
+	     "Lookup cache size must be a power of 2");
+
+static size_t nvs_lookup_cache_pos(uint16_t id)
+{
+	uint16_t hash;
+
+	/* 16-bit integer hash spreads consecutive ids, which are common
+	 * with the settings subsystem, across the cache.
+	 */
+	hash = id;
+	hash ^= hash >> 8;
+	hash *= 0x2057U;
+	hash ^= hash >> 8;
+
+	return hash & (CONFIG_NVS_LOOKUP_CACHE_SIZE - 1);
+}
+
+/* built once at startup: walk all ates, newest to oldest, and remember
+ * the address of the most recent ate for every cached id.
+ */
+static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
+{
+	int rc;
+	uint32_t addr, ate_addr;
+	uint32_t *cache_entry;
+	struct nvs_ate ate;
+
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	addr = fs->ate_wra;
+
+	while (true) {
+		/* nvs_prev_ate() changes the address, keep a copy */
+		ate_addr = addr;
+		rc = nvs_prev_ate(fs, &addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
+
+		if ((ate.id != 0xFFFF) &&
+		    (*cache_entry == NVS_LOOKUP_CACHE_NO_ADDR) &&
+		    !nvs_ate_crc8_check(&ate)) {
+			*cache_entry = ate_addr;
+		}
+
+		if (addr == fs->ate_wra) {
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/* drop all cache entries pointing into an erased sector; any live id in
+ * that sector was rewritten elsewhere by gc, so a dropped entry means
+ * the id no longer exists.
+ */
+static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
+{
+	uint32_t *cache_entry = fs->lookup_cache;
+	uint32_t *const cache_end =
+		&fs->lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+
+	for (; cache_entry < cache_end; ++cache_entry) {
+		if ((*cache_entry >> ADDR_SECT_SHIFT) == sector) {
+			*cache_entry = NVS_LOOKUP_CACHE_NO_ADDR;
+		}
+	}
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE */
+
 /* basic routines */
 /* nvs_al_size returns size aligned to fs->write_block_size */
 static inline size_t nvs_al_size(struct nvs_fs *fs, size_t len)
@@ -106,6 +187,13 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 
 	rc = nvs_flash_al_wrt(fs, fs->ate_wra, entry,
 			       sizeof(struct nvs_ate));
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
+	if (entry->id != 0xFFFF) {
+		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] =
+			fs->ate_wra;
+	}
+#endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
 
 	return rc;
@@ -296,6 +384,95 @@ static int nvs_ate_cmp_const(const struct nvs_ate *entry, uint8_t value)
 	return 0;
 }
 
+#ifdef CONFIG_NVS_TRANSACTION
+/* write the allocation entries of a transaction, packing as many ate's
+ * as fit into NVS_BLOCK_SIZE per flash program. The entry staged first
+ * gets the highest (oldest) ate address.
+ */
+static int nvs_flash_ate_group_wrt(struct nvs_fs *fs, uint16_t base_off)
+{
+	int rc;
+	struct nvs_ate *ate;
+	uint8_t buf[NVS_BLOCK_SIZE];
+	size_t ate_size;
+	uint32_t off = base_off;
+	uint16_t per_block, done = 0, n, i;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	per_block = NVS_BLOCK_SIZE / ate_size;
+
+	while (done < fs->tx_cnt) {
+		n = MIN(per_block, fs->tx_cnt - done);
+
+		(void)memset(buf, fs->flash_parameters->erase_value,
+			     sizeof(buf));
+		for (i = 0; i < n; i++) {
+			/* ascending buffer addresses hold descending ages */
+			ate = (struct nvs_ate *)&buf[(n - 1 - i) * ate_size];
+			ate->id = fs->tx_id[done + i];
+			ate->offset = (uint16_t)(off & ADDR_OFFS_MASK);
+			ate->len = fs->tx_len[done + i];
+			ate->part = 0xff;
+			nvs_ate_crc8_update(ate);
+
+			off += nvs_al_size(fs, ate->len);
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+			fs->lookup_cache[nvs_lookup_cache_pos(ate->id)] =
+				fs->ate_wra - (done + i) * ate_size;
+#endif
+		}
+
+		rc = nvs_flash_al_wrt(fs,
+				      fs->ate_wra - (done + n - 1) * ate_size,
+				      buf, n * ate_size);
+		if (rc) {
+			return rc;
+		}
+		done += n;
+	}
+
+	fs->ate_wra -= (uint32_t)fs->tx_cnt * ate_size;
+
+	return 0;
+}
+
+/* stage an entry in the transaction buffers; data is padded to the
+ * write block size so the staged region can be programmed in one go.
+ */
+static ssize_t nvs_tx_stage(struct nvs_fs *fs, uint16_t id, const void *data,
+			    size_t len)
+{
+	size_t ate_size, data_size;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	data_size = nvs_al_size(fs, len);
+
+	if ((len > (fs->sector_size - 3 * ate_size)) ||
+	    ((len > 0) && (data == NULL))) {
+		return -EINVAL;
+	}
+
+	if ((fs->tx_cnt >= CONFIG_NVS_TRANSACTION_MAX_ENTRIES) ||
+	    (data_size > sizeof(fs->tx_data) - fs->tx_data_len)) {
+		return -ENOSPC;
+	}
+
+	memcpy(&fs->tx_data[fs->tx_data_len], data, len);
+	if (data_size > len) {
+		(void)memset(&fs->tx_data[fs->tx_data_len + len],
+			     fs->flash_parameters->erase_value,
+			     data_size - len);
+	}
+
+	fs->tx_id[fs->tx_cnt] = id;
+	fs->tx_len[fs->tx_cnt] = (uint16_t)len;
+	fs->tx_cnt++;
+	fs->tx_data_len += data_size;
+
+	return len;
+}
+#endif /* CONFIG_NVS_TRANSACTION */
+
 /* store an entry in flash */
 static int nvs_flash_wrt_entry(struct nvs_fs *fs, uint16_t id, const void *data,
 				size_t len)
@@ -497,6 +674,9 @@ static int nvs_gc(struct nvs_fs *fs)
 		if (rc) {
 			return rc;
 		}
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+		nvs_lookup_cache_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
+#endif
 		return 0;
 	}
 
@@ -570,6 +750,9 @@ static int nvs_gc(struct nvs_fs *fs)
 	if (rc) {
 		return rc;
 	}
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+	nvs_lookup_cache_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
+#endif
 	return 0;
 }
 
@@ -708,6 +891,10 @@ static int nvs_startup(struct nvs_fs *fs)
 		}
 	}
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+	rc = nvs_lookup_cache_rebuild(fs);
+#endif
+
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
@@ -812,6 +999,12 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_TRANSACTION
+	if (fs->tx_active && (fs->tx_owner == k_current_get())) {
+		return nvs_tx_stage(fs, id, data, len);
+	}
+#endif
+
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 	data_size = nvs_al_size(fs, len);
 
@@ -825,7 +1018,15 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	}
 
 	/* find latest entry with same id */
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+
+	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		goto no_cached_entry;
+	}
+#else
 	wlk_addr = fs->ate_wra;
+#endif
 	rd_addr = wlk_addr;
 
 	while (1) {
@@ -843,6 +1044,10 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		}
 	}
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+no_cached_entry:
+#endif
+
 	if (prev_found) {
 		/* previous entry found */
 		rd_addr &= ADDR_SECT_MASK;
@@ -916,6 +1121,100 @@ end:
 	return rc;
 }
 
+#ifdef CONFIG_NVS_TRANSACTION
+int nvs_write_begin(struct nvs_fs *fs)
+{
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	if (fs->tx_active) {
+		k_mutex_unlock(&fs->nvs_lock);
+		return -EALREADY;
+	}
+
+	fs->tx_active = true;
+	fs->tx_owner = k_current_get();
+	fs->tx_cnt = 0U;
+	fs->tx_data_len = 0U;
+
+	return 0;
+}
+
+int nvs_write_commit(struct nvs_fs *fs)
+{
+	int rc, gc_count;
+	size_t ate_size, required_space;
+	uint16_t base_off;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	if ((!fs->tx_active) || (fs->tx_owner != k_current_get())) {
+		return -EINVAL;
+	}
+
+	rc = 0;
+	if (fs->tx_cnt == 0U) {
+		goto end;
+	}
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	/* Leave space for delete ate */
+	required_space = fs->tx_data_len +
+			 (size_t)fs->tx_cnt * ate_size + ate_size;
+
+	gc_count = 0;
+	while (1) {
+		if (gc_count == fs->sector_count) {
+			/* gc'ed all sectors, no extra space will be created
+			 * by extra gc.
+			 */
+			rc = -ENOSPC;
+			goto end;
+		}
+
+		if (fs->ate_wra >= fs->data_wra + required_space) {
+			break;
+		}
+
+		rc = nvs_sector_close(fs);
+		if (rc) {
+			goto end;
+		}
+
+		rc = nvs_gc(fs);
+		if (rc) {
+			goto end;
+		}
+		gc_count++;
+	}
+
+	/* program all staged data first: on a power failure before the
+	 * allocation table is written the transaction leaves no trace.
+	 */
+	base_off = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+	rc = nvs_flash_data_wrt(fs, fs->tx_data, fs->tx_data_len);
+	if (rc) {
+		goto end;
+	}
+
+	rc = nvs_flash_ate_group_wrt(fs, base_off);
+
+end:
+	fs->tx_active = false;
+	fs->tx_cnt = 0U;
+	fs->tx_data_len = 0U;
+	k_mutex_unlock(&fs->nvs_lock);
+	return rc;
+}
+#endif /* CONFIG_NVS_TRANSACTION */
+
 int nvs_delete(struct nvs_fs *fs, uint16_t id)
 {
 	return nvs_write(fs, id, NULL, 0);
@@ -943,7 +1242,15 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 
 	cnt_his = 0U;
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+
+	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		return -ENOENT;
+	}
+#else
 	wlk_addr = fs->ate_wra;
+#endif
 	rd_addr = wlk_addr;
 
 	while (cnt_his <= cnt) {
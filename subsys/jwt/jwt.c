@@ -8,6 +8,10 @@
 #include <zephyr/types.h>
 #include <errno.h>
 
+#ifdef CONFIG_JWT_ASYNC
+#include <kernel.h>
+#endif
+
 #include <data/jwt.h>
 #include <data/json.h>
 
@@ -119,9 +123,31 @@ static int base64_append_bytes(const char *bytes, size_t len,
 			 void *data)
 {
 	struct jwt_builder *st = data;
+	const uint8_t *in = (const uint8_t *)bytes;
+
+	/* Complete a pending group first, then encode whole three-byte
+	 * groups directly instead of shuffling every byte through the
+	 * staging area.
+	 */
+	while (len > 0 && st->pending != 0) {
+		base64_addbyte(st, *in++);
+		len--;
+	}
+
+	while (len >= 3) {
+		base64_outch(st, base64_char(in[0] >> 2));
+		base64_outch(st, base64_char(((in[0] & 0x03) << 4) |
+					     (in[1] >> 4)));
+		base64_outch(st, base64_char(((in[1] & 0x0f) << 2) |
+					     (in[2] >> 6)));
+		base64_outch(st, base64_char(in[2] & 0x3f));
+
+		in += 3;
+		len -= 3;
+	}
 
 	while (len-- > 0) {
-		base64_addbyte(st, *bytes++);
+		base64_addbyte(st, *in++);
 	}
 
 	return 0;
@@ -304,6 +330,64 @@ int jwt_sign(struct jwt_builder *builder,
 }
 #endif
 
+#ifdef CONFIG_JWT_ASYNC
+/* Only one asynchronous signing request can be in flight at a time.
+ * The signature computation itself is the dominant cost, so there is
+ * little to gain from queueing several requests.
+ */
+static struct jwt_async_req {
+	struct k_work work;
+	struct jwt_builder *builder;
+	const char *der_key;
+	size_t der_key_len;
+	jwt_sign_cb_t cb;
+	void *user_data;
+	atomic_t busy;
+} async_req;
+
+static void jwt_sign_work_handler(struct k_work *work)
+{
+	struct jwt_async_req *req = CONTAINER_OF(work, struct jwt_async_req,
+						 work);
+	int res;
+
+	res = jwt_sign(req->builder, req->der_key, req->der_key_len);
+
+	/* Release the request before the callback so that a new request
+	 * can be issued from the callback.
+	 */
+	(void)atomic_set(&req->busy, 0);
+
+	req->cb(req->builder, res, req->user_data);
+}
+
+int jwt_sign_async(struct jwt_builder *builder,
+		   const char *der_key,
+		   size_t der_key_len,
+		   jwt_sign_cb_t cb,
+		   void *user_data)
+{
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(&async_req.busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	async_req.builder = builder;
+	async_req.der_key = der_key;
+	async_req.der_key_len = der_key_len;
+	async_req.cb = cb;
+	async_req.user_data = user_data;
+
+	k_work_init(&async_req.work, jwt_sign_work_handler);
+	k_work_submit(&async_req.work);
+
+	return 0;
+}
+#endif /* CONFIG_JWT_ASYNC */
+
 int jwt_init_builder(struct jwt_builder *builder,
 		     char *buffer,
 		     size_t buffer_size)
@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 #include <logging/log_msg.h>
 #include <net/net_pkt.h>
 #include <net/net_context.h>
+#include <sys/printk.h>
 
 /* Set this to 1 if you want to see what is being sent to server */
 #define DEBUG_PRINTING 0
@@ -54,15 +55,116 @@ struct net_buf_pool *get_data_pool(void)
 	return &syslog_tx_bufs;
 }
 
+#if defined(CONFIG_LOG_BACKEND_NET_AGGREGATION)
+static uint8_t agg_buf[CONFIG_LOG_BACKEND_NET_AGG_BUF_SIZE];
+static size_t agg_len;
+static uint32_t agg_dropped;
+static struct net_context *agg_ctx;
+static struct k_delayed_work agg_flush_work;
+static K_MUTEX_DEFINE(agg_lock);
+
+/* Called with agg_lock held. */
+static void agg_flush(void)
+{
+	int ret;
+
+	if (agg_len == 0U || agg_ctx == NULL) {
+		return;
+	}
+
+	ret = net_context_send(agg_ctx, agg_buf, agg_len, NULL, K_NO_WAIT,
+			       NULL);
+	if (ret < 0) {
+		/* TX path backpressure: the batch is dropped as a whole
+		 * and accounted for in a later one.
+		 */
+		agg_dropped++;
+	}
+
+	agg_len = 0;
+}
+
+static void agg_flush_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&agg_lock, K_FOREVER);
+	agg_flush();
+	k_mutex_unlock(&agg_lock);
+}
+
+/* Append one RFC 6587 octet-counted record to the batch buffer,
+ * flushing first if the record would not fit. Called with agg_lock
+ * held.
+ */
+static void agg_put(uint8_t *data, size_t length)
+{
+	char framing[sizeof("65535 ")];
+	int framing_len;
+
+	framing_len = snprintk(framing, sizeof(framing), "%zu ", length);
+
+	if (agg_len + framing_len + length > sizeof(agg_buf)) {
+		agg_flush();
+	}
+
+	if (framing_len + length > sizeof(agg_buf)) {
+		/* Record alone exceeds the batch buffer: send unbatched. */
+		(void)net_context_send(agg_ctx, data, length, NULL, K_NO_WAIT,
+				       NULL);
+		return;
+	}
+
+	memcpy(&agg_buf[agg_len], framing, framing_len);
+	agg_len += framing_len;
+	memcpy(&agg_buf[agg_len], data, length);
+	agg_len += length;
+}
+#endif /* CONFIG_LOG_BACKEND_NET_AGGREGATION */
+
 static int line_out(uint8_t *data, size_t length, void *output_ctx)
 {
 	struct net_context *ctx = (struct net_context *)output_ctx;
-	int ret = -ENOMEM;
 
 	if (ctx == NULL) {
 		return length;
 	}
 
+#if defined(CONFIG_LOG_BACKEND_NET_AGGREGATION)
+	k_mutex_lock(&agg_lock, K_FOREVER);
+
+	agg_ctx = ctx;
+
+	if (agg_dropped > 0U) {
+		char drop_msg[sizeof("<134>1 - - - - - - 4294967295 "
+				     "log batches dropped")];
+		int len;
+
+		len = snprintk(drop_msg, sizeof(drop_msg),
+			       "<134>1 - - - - - - %u log batches dropped",
+			       agg_dropped);
+		agg_dropped = 0U;
+		agg_put((uint8_t *)drop_msg, len);
+	}
+
+	agg_put(data, length);
+
+	/* Bound the latency of a partially filled batch. Do not push
+	 * the deadline forward while messages keep arriving, otherwise
+	 * steady traffic could starve the flush.
+	 */
+	if (k_delayed_work_remaining_get(&agg_flush_work) == 0) {
+		k_delayed_work_submit(&agg_flush_work,
+			K_MSEC(CONFIG_LOG_BACKEND_NET_AGG_FLUSH_TIMEOUT_MS));
+	}
+
+	k_mutex_unlock(&agg_lock);
+
+	DBG(data);
+	return length;
+#else
+	int ret;
+
 	ret = net_context_send(ctx, data, length, NULL, K_NO_WAIT, NULL);
 	if (ret < 0) {
 		goto fail;
@@ -71,6 +173,7 @@ static int line_out(uint8_t *data, size_t length, void *output_ctx)
 	DBG(data);
 fail:
 	return length;
+#endif /* CONFIG_LOG_BACKEND_NET_AGGREGATION */
 }
 
 LOG_OUTPUT_DEFINE(log_output_net, line_out, output_buf, sizeof(output_buf));
@@ -166,6 +269,10 @@ static int do_net_init(void)
 
 	net_context_setup_pools(ctx, get_tx_slab, get_data_pool);
 
+#if defined(CONFIG_LOG_BACKEND_NET_AGGREGATION)
+	k_delayed_work_init(&agg_flush_work, agg_flush_work_handler);
+#endif
+
 	log_output_ctx_set(&log_output_net, ctx);
 	log_output_hostname_set(&log_output_net, dev_hostname);
 
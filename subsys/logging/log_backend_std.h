@@ -36,6 +36,10 @@ log_backend_std_put(const struct log_output *const log_output, uint32_t flags,
 		flags |= LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP;
 	}
 
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY)) {
+		flags |= LOG_OUTPUT_FLAG_FORMAT_DICT;
+	}
+
 	log_output_msg_process(log_output, msg, flags);
 
 	log_msg_put(msg);
@@ -58,7 +58,6 @@ struct k_mem_slab log_strdup_pool;
 static uint8_t __noinit __aligned(sizeof(void *))
 		log_strdup_pool_buf[LOG_STRDUP_POOL_BUFFER_SIZE];
 
-static struct log_list_t list;
 static atomic_t initialized;
 static bool panic_mode;
 static bool backend_attached;
@@ -73,6 +72,139 @@ static struct k_timer log_process_thread_timer;
 static uint32_t dummy_timestamp(void);
 static timestamp_get_t timestamp_func = dummy_timestamp;
 
+#if defined(CONFIG_LOG_PERCPU_RING)
+
+#define LOG_RING_SIZE CONFIG_LOG_PERCPU_RING_SIZE
+#define LOG_RING_MASK (LOG_RING_SIZE - 1)
+
+BUILD_ASSERT((LOG_RING_SIZE & LOG_RING_MASK) == 0,
+	     "CONFIG_LOG_PERCPU_RING_SIZE must be a power of two");
+
+/* Bounded multi-producer message ring, one per CPU. A producer claims a
+ * slot by advancing the claim counter and commits it by storing the
+ * matching sequence number, so enqueueing a message never locks
+ * interrupts and never touches the rings of the other CPUs. Each slot
+ * sequence number encodes the slot state: equal to a claim position
+ * when the slot is free for that position, position + 1 once the
+ * message is committed. Only the single draining context advances
+ * read_idx.
+ */
+struct log_msg_ring {
+	struct log_msg *msg[LOG_RING_SIZE];
+	atomic_t seq[LOG_RING_SIZE];
+	atomic_t claim;
+	uint32_t read_idx;
+};
+
+static struct log_msg_ring msg_rings[CONFIG_MP_NUM_CPUS];
+
+static void msg_ring_init(void)
+{
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		for (int j = 0; j < LOG_RING_SIZE; j++) {
+			atomic_set(&msg_rings[i].seq[j], j);
+		}
+
+		atomic_set(&msg_rings[i].claim, 0);
+		msg_rings[i].read_idx = 0;
+	}
+}
+
+static bool msg_ring_put(struct log_msg_ring *ring, struct log_msg *msg)
+{
+	atomic_val_t pos = atomic_get(&ring->claim);
+
+	for (;;) {
+		atomic_val_t seq = atomic_get(&ring->seq[pos & LOG_RING_MASK]);
+		atomic_val_t dif = seq - pos;
+
+		if (dif == 0) {
+			if (atomic_cas(&ring->claim, pos, pos + 1)) {
+				break;
+			}
+		} else if (dif < 0) {
+			/* The consumer has not freed this slot yet, so a
+			 * whole lap of messages is still pending: full.
+			 */
+			return false;
+		}
+
+		pos = atomic_get(&ring->claim);
+	}
+
+	ring->msg[pos & LOG_RING_MASK] = msg;
+	atomic_set(&ring->seq[pos & LOG_RING_MASK], pos + 1);
+
+	return true;
+}
+
+static struct log_msg *msg_ring_peek(struct log_msg_ring *ring)
+{
+	atomic_val_t pos = (atomic_val_t)ring->read_idx;
+
+	/* Not committed yet. A claimed but not yet committed slot also
+	 * ends up here, which keeps the ring ordered: later messages are
+	 * held back until the commit in progress finishes.
+	 */
+	if (atomic_get(&ring->seq[pos & LOG_RING_MASK]) != pos + 1) {
+		return NULL;
+	}
+
+	return ring->msg[pos & LOG_RING_MASK];
+}
+
+static void msg_ring_get(struct log_msg_ring *ring)
+{
+	atomic_val_t pos = (atomic_val_t)ring->read_idx;
+
+	/* Free the slot for the producer one lap ahead. */
+	atomic_set(&ring->seq[pos & LOG_RING_MASK], pos + LOG_RING_SIZE);
+	ring->read_idx++;
+}
+
+/* Pop the oldest committed message across all the per-CPU rings so that
+ * the merged stream handed to the backends stays timestamp ordered.
+ */
+static struct log_msg *msg_rings_oldest_get(void)
+{
+	struct log_msg_ring *best_ring = NULL;
+	struct log_msg *best = NULL;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct log_msg *msg = msg_ring_peek(&msg_rings[i]);
+
+		if (msg == NULL) {
+			continue;
+		}
+
+		if (best == NULL ||
+		    (int32_t)(log_msg_timestamp_get(msg) -
+			      log_msg_timestamp_get(best)) < 0) {
+			best_ring = &msg_rings[i];
+			best = msg;
+		}
+	}
+
+	if (best != NULL) {
+		msg_ring_get(best_ring);
+	}
+
+	return best;
+}
+
+static bool msg_rings_empty(void)
+{
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (msg_ring_peek(&msg_rings[i]) != NULL) {
+			return false;
+		}
+	}
+
+	return true;
+}
+#else
+static struct log_list_t list;
+#endif /* CONFIG_LOG_PERCPU_RING */
 
 bool log_is_strdup(const void *buf);
 
@@ -157,6 +289,15 @@ static void detect_missed_strdup(struct log_msg *msg)
 		return;
 	}
 
+	/* Call sites built with CONFIG_LOG_COMPILE_TIME_SMASK record which
+	 * arguments are string typed. A message without any such argument
+	 * cannot have a transient string to detect, so the format string
+	 * scan below is skipped entirely for it.
+	 */
+	if (log_msg_smask_get(msg, &mask) && (mask == 0U)) {
+		return;
+	}
+
 	msg_str = log_msg_str_get(msg);
 	mask = z_log_get_s_mask(msg_str, log_msg_nargs_get(msg));
 
@@ -189,6 +330,27 @@ static inline void msg_finalize(struct log_msg *msg,
 	msg->hdr.ids = src_level;
 	msg->hdr.timestamp = timestamp_func();
 
+#if defined(CONFIG_LOG_PERCPU_RING)
+	struct log_msg_ring *ring;
+
+	/* Pin the CPU id read; the rings are multi-producer so being
+	 * migrated after the choice only affects distribution.
+	 */
+	key = irq_lock();
+	ring = &msg_rings[_current_cpu->id];
+	irq_unlock(key);
+
+	if (!msg_ring_put(ring, msg)) {
+		/* Ring full. Drop here and account for it so that
+		 * dropped_notify() reports the loss to the backends.
+		 */
+		log_msg_put(msg);
+		log_dropped();
+		return;
+	}
+
+	atomic_inc(&buffered_cnt);
+#else
 	atomic_inc(&buffered_cnt);
 
 	key = irq_lock();
@@ -196,6 +358,7 @@ static inline void msg_finalize(struct log_msg *msg,
 	log_list_add_tail(&list, msg);
 
 	irq_unlock(key);
+#endif
 
 	if (panic_mode) {
 		key = irq_lock();
@@ -280,6 +443,65 @@ void log_3(const char *str,
 	}
 }
 
+#ifdef CONFIG_LOG_COMPILE_TIME_SMASK
+void log_sm_1(const char *str,
+	      log_arg_t arg0,
+	      uint32_t smask,
+	      struct log_msg_ids src_level)
+{
+	if (IS_ENABLED(CONFIG_LOG_FRONTEND)) {
+		log_frontend_1(str, arg0, src_level);
+	} else {
+		struct log_msg *msg = log_msg_create_1(str, arg0);
+
+		if (msg == NULL) {
+			return;
+		}
+		log_msg_smask_set(msg, smask);
+		msg_finalize(msg, src_level);
+	}
+}
+
+void log_sm_2(const char *str,
+	      log_arg_t arg0,
+	      log_arg_t arg1,
+	      uint32_t smask,
+	      struct log_msg_ids src_level)
+{
+	if (IS_ENABLED(CONFIG_LOG_FRONTEND)) {
+		log_frontend_2(str, arg0, arg1, src_level);
+	} else {
+		struct log_msg *msg = log_msg_create_2(str, arg0, arg1);
+
+		if (msg == NULL) {
+			return;
+		}
+		log_msg_smask_set(msg, smask);
+		msg_finalize(msg, src_level);
+	}
+}
+
+void log_sm_3(const char *str,
+	      log_arg_t arg0,
+	      log_arg_t arg1,
+	      log_arg_t arg2,
+	      uint32_t smask,
+	      struct log_msg_ids src_level)
+{
+	if (IS_ENABLED(CONFIG_LOG_FRONTEND)) {
+		log_frontend_3(str, arg0, arg1, arg2, src_level);
+	} else {
+		struct log_msg *msg = log_msg_create_3(str, arg0, arg1, arg2);
+
+		if (msg == NULL) {
+			return;
+		}
+		log_msg_smask_set(msg, smask);
+		msg_finalize(msg, src_level);
+	}
+}
+#endif /* CONFIG_LOG_COMPILE_TIME_SMASK */
+
 void log_n(const char *str,
 	   log_arg_t *args,
 	   uint32_t narg,
@@ -479,7 +701,11 @@ void log_core_init(void)
 
 	if (!IS_ENABLED(CONFIG_LOG_IMMEDIATE)) {
 		log_msg_pool_init();
+#if defined(CONFIG_LOG_PERCPU_RING)
+		msg_ring_init();
+#else
 		log_list_init(&list);
+#endif
 
 		k_mem_slab_init(&log_strdup_pool, log_strdup_pool_buf,
 					sizeof(struct log_strdup_buf),
@@ -681,10 +907,15 @@ bool z_impl_log_process(bool bypass)
 	if (!backend_attached && !bypass) {
 		return false;
 	}
+
+#if defined(CONFIG_LOG_PERCPU_RING)
+	msg = msg_rings_oldest_get();
+#else
 	unsigned int key = irq_lock();
 
 	msg = log_list_head_get(&list);
 	irq_unlock(key);
+#endif
 
 	if (msg != NULL) {
 		atomic_dec(&buffered_cnt);
@@ -695,7 +926,11 @@ bool z_impl_log_process(bool bypass)
 		dropped_notify();
 	}
 
+#if defined(CONFIG_LOG_PERCPU_RING)
+	return !msg_rings_empty();
+#else
 	return (log_list_head_peek(&list) != NULL);
+#endif
 }
 
 #ifdef CONFIG_USERSPACE
@@ -7,6 +7,7 @@
 #include <logging/log_output.h>
 #include <logging/log_ctrl.h>
 #include <logging/log.h>
+#include <sys/byteorder.h>
 #include <assert.h>
 #include <ctype.h>
 #include <time.h>
@@ -465,6 +466,76 @@ static void raw_string_print(struct log_msg *msg,
 	}
 }
 
+#if defined(CONFIG_LOG_DICTIONARY)
+
+/* Record framing for the dictionary (catalog) output mode. Strings are
+ * identified by their link-time address, which the offline decoder
+ * (scripts/logging/parse_dict_log.py) resolves against the catalog
+ * extracted from the ELF file.
+ */
+#define DICT_SYNC_BYTE 0x99
+
+#define DICT_MSG_TYPE_STD     0
+#define DICT_MSG_TYPE_HEXDUMP 1
+#define DICT_MSG_TYPE_RAW     2
+
+static void dict_write(const struct log_output *log_output,
+		       const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		out_func(data[i], (void *)log_output);
+	}
+}
+
+static void dict_msg_process(const struct log_output *log_output,
+			     struct log_msg *msg)
+{
+	bool std_msg = log_msg_is_std(msg);
+	bool raw_string =
+		(log_msg_level_get(msg) == LOG_LEVEL_INTERNAL_RAW_STRING);
+	uint8_t nargs = std_msg ? (uint8_t)log_msg_nargs_get(msg) : 0U;
+	uint16_t data_len = std_msg ? 0U : msg->hdr.params.hexdump.length;
+	uint8_t hdr[16];
+
+	hdr[0] = DICT_SYNC_BYTE;
+	hdr[1] = std_msg ? DICT_MSG_TYPE_STD :
+		 (raw_string ? DICT_MSG_TYPE_RAW : DICT_MSG_TYPE_HEXDUMP);
+	hdr[2] = (uint8_t)log_msg_level_get(msg);
+	hdr[3] = nargs;
+	sys_put_le16((uint16_t)log_msg_source_id_get(msg), &hdr[4]);
+	sys_put_le16(data_len, &hdr[6]);
+	sys_put_le32(log_msg_timestamp_get(msg), &hdr[8]);
+	sys_put_le32((uint32_t)(uintptr_t)log_msg_str_get(msg), &hdr[12]);
+
+	dict_write(log_output, hdr, sizeof(hdr));
+
+	if (std_msg) {
+		for (uint32_t i = 0; i < nargs; i++) {
+			uint8_t arg[sizeof(uint32_t)];
+
+			sys_put_le32((uint32_t)log_msg_arg_get(msg, i), arg);
+			dict_write(log_output, arg, sizeof(arg));
+		}
+	} else {
+		uint32_t offset = 0U;
+		uint8_t buf[HEXDUMP_BYTES_IN_LINE];
+		size_t length;
+
+		do {
+			length = sizeof(buf);
+			log_msg_hexdump_data_get(msg, buf, &length, offset);
+
+			if (length == 0U) {
+				break;
+			}
+
+			dict_write(log_output, buf, length);
+			offset += length;
+		} while (true);
+	}
+}
+#endif /* CONFIG_LOG_DICTIONARY */
+
 static uint32_t prefix_print(const struct log_output *log_output,
 			 uint32_t flags, bool func_on, uint32_t timestamp, uint8_t level,
 			 uint8_t domain_id, uint16_t source_id)
@@ -538,6 +609,14 @@ void log_output_msg_process(const struct log_output *log_output,
 		return;
 	}
 
+#if defined(CONFIG_LOG_DICTIONARY)
+	if (flags & LOG_OUTPUT_FLAG_FORMAT_DICT) {
+		dict_msg_process(log_output, msg);
+		log_output_flush(log_output);
+		return;
+	}
+#endif
+
 	prefix_offset = raw_string ?
 			0 : prefix_print(log_output, flags, std_msg, timestamp,
 					 level, domain_id, source_id);
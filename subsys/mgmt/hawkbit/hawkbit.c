@@ -38,6 +38,9 @@ LOG_MODULE_REGISTER(hawkbit);
 #endif
 
 #define ADDRESS_ID 1
+#define DOWNLOAD_STATE_ID 2
+
+#define RANGE_HEADER_SIZE 32
 
 #define CANCEL_BASE_SIZE 50
 #define RECV_BUFFER_SIZE 640
@@ -66,6 +69,17 @@ struct hawkbit_download {
 	int download_progress;
 	size_t downloaded_size;
 	size_t http_content_size;
+	size_t resume_offset;
+};
+
+/*
+ * Download offset persisted across reboots and connection losses, so an
+ * interrupted transfer of the same action is resumed with an HTTP range
+ * request instead of being downloaded from scratch.
+ */
+struct hawkbit_dl_state {
+	int32_t action_id;
+	uint32_t offset;
 };
 
 static struct hawkbit_context {
@@ -82,6 +96,8 @@ static struct hawkbit_context {
 	uint8_t url_buffer[URL_BUFFER_SIZE];
 	uint8_t status_buffer[STATUS_BUFFER_SIZE];
 	uint8_t recv_buf_tcp[RECV_BUFFER_SIZE];
+	char range_header[RANGE_HEADER_SIZE];
+	const char *range_headers[2];
 	enum hawkbit_response code_status;
 } hb_context;
 
@@ -367,6 +383,18 @@ static int hawkbit_device_acid_update(int32_t new_value)
 	return 0;
 }
 
+static void hawkbit_dl_state_save(uint32_t offset)
+{
+	struct hawkbit_dl_state state = {
+		.action_id = hb_context.json_action_id,
+		.offset = offset,
+	};
+
+	if (nvs_write(&fs, DOWNLOAD_STATE_ID, &state, sizeof(state)) < 0) {
+		LOG_WRN("Failed to save download state");
+	}
+}
+
 /*
  * Update sleep interval, based on results from hawkbit base polling
  * resource
@@ -792,11 +820,29 @@ static void response_cb(struct http_response *rsp,
 		break;
 
 	case HAWKBIT_DOWNLOAD:
+		if (hb_context.code_status == HAWKBIT_DOWNLOAD_ERROR) {
+			break;
+		}
+
 		if (hb_context.dl.http_content_size == 0) {
+			if ((hb_context.dl.resume_offset > 0) &&
+			    (strcmp(rsp->http_status, "Partial Content") != 0)) {
+				/* Server ignored the range request; the body
+				 * is the whole artifact and must not be
+				 * appended at the resume offset.
+				 */
+				LOG_ERR("Server does not support resume");
+				hawkbit_dl_state_save(0);
+				hb_context.code_status =
+					HAWKBIT_DOWNLOAD_ERROR;
+				break;
+			}
+
 			body_data = rsp->body_start;
 			body_len = rsp->data_len;
 			body_len -= (rsp->body_start - rsp->recv_buf);
-			hb_context.dl.http_content_size = rsp->content_length;
+			hb_context.dl.http_content_size = rsp->content_length +
+							  hb_context.dl.resume_offset;
 		}
 
 		if ((rsp->body_found == 1) && (body_data == NULL)) {
@@ -824,9 +870,11 @@ static void response_cb(struct http_response *rsp,
 			hb_context.dl.download_progress = downloaded;
 			LOG_DBG("Download percentage: %d%% ",
 				hb_context.dl.download_progress);
+			hawkbit_dl_state_save(hb_context.dl.downloaded_size);
 		}
 
 		if (final_data == HTTP_DATA_FINAL) {
+			hawkbit_dl_state_save(0);
 			k_sem_give(&hb_context.semaphore);
 		}
 
@@ -995,6 +1043,11 @@ static bool send_request(enum http_method method,
 		break;
 
 	case HAWKBIT_DOWNLOAD:
+		if (hb_context.dl.resume_offset > 0) {
+			hb_context.http_req.optional_headers =
+				hb_context.range_headers;
+		}
+
 		ret = http_client_req(hb_context.sock, &hb_context.http_req,
 				      HAWKBIT_RECV_TIMEOUT, "HAWKBIT_DOWNLOAD");
 		if (ret < 0) {
@@ -1013,6 +1066,7 @@ enum hawkbit_response hawkbit_probe(void)
 	int ret;
 	int32_t action_id;
 	int32_t file_size = 0;
+	struct hawkbit_dl_state dl_state;
 	char device_id[DEVICE_ID_HEX_MAX_SIZE] = { 0 },
 	     cancel_base[CANCEL_BASE_SIZE] = { 0 },
 	     download_http[DOWNLOAD_HTTP_SIZE] = { 0 },
@@ -1196,6 +1250,25 @@ enum hawkbit_response hawkbit_probe(void)
 
 	flash_img_init(&hb_context.flash_ctx);
 
+	/*
+	 * Resume an interrupted download of this action where it left
+	 * off. The image data already in the slot is kept; the range
+	 * request only fetches the remainder.
+	 */
+	ret = nvs_read(&fs, DOWNLOAD_STATE_ID, &dl_state, sizeof(dl_state));
+	if ((ret == sizeof(dl_state)) &&
+	    (dl_state.action_id == hb_context.json_action_id) &&
+	    (dl_state.offset > 0) && (dl_state.offset < (uint32_t)file_size) &&
+	    (flash_img_resume(&hb_context.flash_ctx, dl_state.offset) == 0)) {
+		hb_context.dl.resume_offset = dl_state.offset;
+		snprintk(hb_context.range_header,
+			 sizeof(hb_context.range_header),
+			 "Range: bytes=%u-\r\n", dl_state.offset);
+		hb_context.range_headers[0] = hb_context.range_header;
+		hb_context.range_headers[1] = NULL;
+		LOG_INF("Resuming download at offset %u", dl_state.offset);
+	}
+
 	if (!send_request(HTTP_GET, HAWKBIT_DOWNLOAD,
 			  HAWKBIT_STATUS_FINISHED_NONE,
 			  HAWKBIT_STATUS_EXEC_NONE)) {
@@ -177,9 +177,32 @@ zephyr_smp_tx_rsp(struct smp_streamer *ns, void *rsp, void *arg)
 	mtu = zst->zst_get_mtu(rsp);
 	if (mtu == 0U) {
 		/* The transport cannot support a transmission right now. */
+		zephyr_smp_free_buf(nb, zst);
 		return MGMT_ERR_EUNKNOWN;
 	}
 
+	if (zst->zst_output_frag != NULL) {
+		/* The transport can transmit straight out of the response
+		 * buffer; send MTU-sized slices of it in place instead of
+		 * copying every fragment into a freshly allocated buffer.
+		 */
+		do {
+			uint16_t frag_len = MIN(nb->len, mtu);
+
+			rc = zst->zst_output_frag(zst, nb, frag_len);
+			if (rc != 0) {
+				zephyr_smp_free_buf(nb, zst);
+				return MGMT_ERR_EUNKNOWN;
+			}
+
+			net_buf_pull(nb, frag_len);
+		} while (nb->len > 0);
+
+		zephyr_smp_free_buf(nb, zst);
+
+		return 0;
+	}
+
 	i = 0;
 	while (nb != NULL) {
 		frag = zephyr_smp_split_frag(&nb, zst, mtu);
@@ -296,6 +319,14 @@ zephyr_smp_transport_init(struct zephyr_smp_transport *zst,
 	k_fifo_init(&zst->zst_fifo);
 }
 
+void
+zephyr_smp_transport_set_output_frag(
+	struct zephyr_smp_transport *zst,
+	zephyr_smp_transport_out_frag_fn *output_frag_func)
+{
+	zst->zst_output_frag = output_frag_func;
+}
+
 void
 zephyr_smp_rx_req(struct zephyr_smp_transport *zst, struct net_buf *nb)
 {
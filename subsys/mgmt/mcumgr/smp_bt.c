@@ -180,6 +180,26 @@ static int smp_bt_tx_pkt(struct zephyr_smp_transport *zst, struct net_buf *nb)
 	return rc;
 }
 
+/**
+ * Transmits a slice of an SMP response directly from the response buffer.
+ */
+static int smp_bt_tx_frag(struct zephyr_smp_transport *zst,
+			  struct net_buf *nb, uint16_t len)
+{
+	struct bt_conn *conn;
+	int rc;
+
+	conn = smp_bt_conn_from_pkt(nb);
+	if (conn == NULL) {
+		return -1;
+	}
+
+	rc = smp_bt_tx_rsp(conn, nb->data, len);
+	bt_conn_unref(conn);
+
+	return rc;
+}
+
 int smp_bt_register(void)
 {
 	return bt_gatt_service_register(&smp_bt_svc);
@@ -197,6 +217,8 @@ static int smp_bt_init(const struct device *dev)
 	zephyr_smp_transport_init(&smp_bt_transport, smp_bt_tx_pkt,
 				  smp_bt_get_mtu, smp_bt_ud_copy,
 				  smp_bt_ud_free);
+	zephyr_smp_transport_set_output_frag(&smp_bt_transport,
+					     smp_bt_tx_frag);
 	return 0;
 }
 
@@ -174,10 +174,18 @@ static int smp_shell_tx_pkt(struct zephyr_smp_transport *zst,
 	return rc;
 }
 
+static int smp_shell_tx_frag(struct zephyr_smp_transport *zst,
+			     struct net_buf *nb, uint16_t len)
+{
+	return mcumgr_serial_tx_pkt(nb->data, len, smp_shell_tx_raw, NULL);
+}
+
 int smp_shell_init(void)
 {
 	zephyr_smp_transport_init(&smp_shell_transport, smp_shell_tx_pkt,
 				  smp_shell_get_mtu, NULL, NULL);
+	zephyr_smp_transport_set_output_frag(&smp_shell_transport,
+					     smp_shell_tx_frag);
 
 	return 0;
 }
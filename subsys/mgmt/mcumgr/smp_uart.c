@@ -87,12 +87,20 @@ static int smp_uart_tx_pkt(struct zephyr_smp_transport *zst,
 	return rc;
 }
 
+static int smp_uart_tx_frag(struct zephyr_smp_transport *zst,
+			    struct net_buf *nb, uint16_t len)
+{
+	return uart_mcumgr_send(nb->data, len);
+}
+
 static int smp_uart_init(const struct device *dev)
 {
 	ARG_UNUSED(dev);
 
 	zephyr_smp_transport_init(&smp_uart_transport, smp_uart_tx_pkt,
 				  smp_uart_get_mtu, NULL, NULL);
+	zephyr_smp_transport_set_output_frag(&smp_uart_transport,
+					     smp_uart_tx_frag);
 	uart_mcumgr_register(smp_uart_rx_frag);
 
 	return 0;
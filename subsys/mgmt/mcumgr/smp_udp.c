@@ -65,6 +65,18 @@ static int smp_udp4_tx(struct zephyr_smp_transport *zst, struct net_buf *nb)
 
 	return ret < 0 ? MGMT_ERR_EINVAL : MGMT_ERR_EOK;
 }
+
+static int smp_udp4_tx_frag(struct zephyr_smp_transport *zst,
+			    struct net_buf *nb, uint16_t len)
+{
+	ARG_UNUSED(zst);
+
+	struct sockaddr *addr = net_buf_user_data(nb);
+	int ret = sendto(configs.ipv4.sock, nb->data, len,
+			 0, addr, sizeof(*addr));
+
+	return ret < 0 ? MGMT_ERR_EINVAL : MGMT_ERR_EOK;
+}
 #endif
 
 #if CONFIG_MCUMGR_SMP_UDP_IPV6
@@ -79,6 +91,18 @@ static int smp_udp6_tx(struct zephyr_smp_transport *zst, struct net_buf *nb)
 
 	return ret < 0 ? MGMT_ERR_EINVAL : MGMT_ERR_EOK;
 }
+
+static int smp_udp6_tx_frag(struct zephyr_smp_transport *zst,
+			    struct net_buf *nb, uint16_t len)
+{
+	ARG_UNUSED(zst);
+
+	struct sockaddr *addr = net_buf_user_data(nb);
+	int ret = sendto(configs.ipv6.sock, nb->data, len,
+			 0, addr, sizeof(*addr));
+
+	return ret < 0 ? MGMT_ERR_EINVAL : MGMT_ERR_EOK;
+}
 #endif
 
 static uint16_t smp_udp_get_mtu(const struct net_buf *nb)
@@ -140,12 +164,16 @@ static int smp_udp_init(const struct device *dev)
 	zephyr_smp_transport_init(&configs.ipv4.smp_transport,
 				  smp_udp4_tx, smp_udp_get_mtu,
 				  smp_udp_ud_copy, NULL);
+	zephyr_smp_transport_set_output_frag(&configs.ipv4.smp_transport,
+					     smp_udp4_tx_frag);
 #endif
 
 #if CONFIG_MCUMGR_SMP_UDP_IPV6
 	zephyr_smp_transport_init(&configs.ipv6.smp_transport,
 				  smp_udp6_tx, smp_udp_get_mtu,
 				  smp_udp_ud_copy, NULL);
+	zephyr_smp_transport_set_output_frag(&configs.ipv6.smp_transport,
+					     smp_udp6_tx_frag);
 #endif
 
 	return MGMT_ERR_EOK;
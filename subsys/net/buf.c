@@ -348,6 +348,9 @@ success:
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 	pool->avail_count--;
 	__ASSERT_NO_MSG(pool->avail_count >= 0);
+	if (pool->buf_count - pool->avail_count > pool->max_used) {
+		pool->max_used = pool->buf_count - pool->avail_count;
+	}
 #endif
 	return buf;
 }
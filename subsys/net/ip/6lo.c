@@ -22,6 +22,12 @@ LOG_MODULE_REGISTER(net_6lo, CONFIG_NET_6LO_LOG_LEVEL);
 #include "6lo.h"
 #include "6lo_private.h"
 
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+static void compression_cache_flush(void);
+#else
+#define compression_cache_flush()
+#endif
+
 #if defined(CONFIG_NET_6LO_CONTEXT)
 struct net_6lo_context {
 	struct in6_addr prefix;
@@ -49,6 +55,11 @@ static struct net_6lo_context ctx_6co[CONFIG_NET_MAX_6LO_CONTEXTS];
 static const uint8_t udp_nhc_inline_size_table[] = {4, 3, 3, 1};
 
 static const uint8_t tf_inline_size_table[] = {4, 3, 1, 0};
+
+/* Hop limit values carried by the HLIM 01/10/11 encodings, index 0
+ * means the hop limit is inlined.
+ */
+static const uint8_t hlim_value_table[] = {0, 1, 64, 255};
 /* The first bit of the index is SAC        |  SAC=0   |  SAC=1   |*/
 static const uint8_t sa_inline_size_table[] = {16, 8, 2, 0, 0, 8, 2, 0};
 
@@ -178,6 +189,11 @@ void net_6lo_set_context(struct net_if *iface,
 	int unused = -1;
 	uint8_t i;
 
+	/* Any context change can alter the compression decision for an
+	 * address pair, so cached dispositions are stale now.
+	 */
+	compression_cache_flush();
+
 	/* If the context information already exists, update or remove
 	 * as per data.
 	 */
@@ -251,6 +267,122 @@ get_6lo_context_by_addr(struct net_if *iface, struct in6_addr *addr)
 
 #endif
 
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+/* Most consecutive packets to a given neighbor compress identically:
+ * the CID, SAC, SAM, M, DAC and DAM bits, the context identifier byte
+ * and the inlined address bytes only depend on the address pair and
+ * the link layer addresses. They are computed once and replayed from
+ * this cache afterwards, skipping the address compression chains and
+ * the context table lookups. The per packet fields (traffic class,
+ * flow label, hop limit, UDP header) are cheap and still compressed
+ * in place.
+ */
+struct net_6lo_compression_cache {
+	struct in6_addr src;
+	struct in6_addr dst;
+	struct net_if *iface;
+	uint8_t ll_src[8];
+	uint8_t ll_dst[8];
+	uint8_t ll_src_len;
+	uint8_t ll_dst_len;
+	uint8_t iphc_addr; /* CID, SAC, SAM, M, DAC and DAM bits */
+	uint8_t cid;
+	uint8_t inline_len;
+	uint8_t inline_data[32];
+	bool in_use;
+};
+
+static struct net_6lo_compression_cache
+	compression_cache[CONFIG_NET_6LO_COMPRESSION_CACHE_COUNT];
+static uint8_t compression_cache_next;
+
+static void compression_cache_flush(void)
+{
+	(void)memset(compression_cache, 0, sizeof(compression_cache));
+}
+
+static bool compression_cache_key_ok(struct net_pkt *pkt)
+{
+	return net_pkt_lladdr_src(pkt)->addr &&
+	       net_pkt_lladdr_src(pkt)->len <= 8U &&
+	       net_pkt_lladdr_dst(pkt)->addr &&
+	       net_pkt_lladdr_dst(pkt)->len <= 8U;
+}
+
+static struct net_6lo_compression_cache *
+compression_cache_lookup(struct net_pkt *pkt, struct net_ipv6_hdr *ipv6)
+{
+	struct net_6lo_compression_cache *cache;
+	int i;
+
+	if (!compression_cache_key_ok(pkt)) {
+		return NULL;
+	}
+
+	for (i = 0; i < CONFIG_NET_6LO_COMPRESSION_CACHE_COUNT; i++) {
+		cache = &compression_cache[i];
+
+		if (!cache->in_use || cache->iface != net_pkt_iface(pkt)) {
+			continue;
+		}
+
+		if (!net_ipv6_addr_cmp(&cache->src, &ipv6->src) ||
+		    !net_ipv6_addr_cmp(&cache->dst, &ipv6->dst)) {
+			continue;
+		}
+
+		if (cache->ll_src_len != net_pkt_lladdr_src(pkt)->len ||
+		    memcmp(cache->ll_src, net_pkt_lladdr_src(pkt)->addr,
+			   cache->ll_src_len) ||
+		    cache->ll_dst_len != net_pkt_lladdr_dst(pkt)->len ||
+		    memcmp(cache->ll_dst, net_pkt_lladdr_dst(pkt)->addr,
+			   cache->ll_dst_len)) {
+			continue;
+		}
+
+		return cache;
+	}
+
+	return NULL;
+}
+
+static void compression_cache_record(struct net_pkt *pkt,
+				     struct net_ipv6_hdr *ipv6,
+				     uint16_t iphc, uint8_t cid,
+				     uint8_t *inline_pos, uint8_t *addr_start)
+{
+	struct net_6lo_compression_cache *cache;
+	size_t inline_len = addr_start - inline_pos;
+
+	if (!compression_cache_key_ok(pkt) ||
+	    inline_len > sizeof(cache->inline_data)) {
+		return;
+	}
+
+	cache = &compression_cache[compression_cache_next];
+	compression_cache_next = (compression_cache_next + 1) %
+		CONFIG_NET_6LO_COMPRESSION_CACHE_COUNT;
+
+	cache->iface = net_pkt_iface(pkt);
+	net_ipaddr_copy(&cache->src, &ipv6->src);
+	net_ipaddr_copy(&cache->dst, &ipv6->dst);
+
+	cache->ll_src_len = net_pkt_lladdr_src(pkt)->len;
+	memcpy(cache->ll_src, net_pkt_lladdr_src(pkt)->addr,
+	       cache->ll_src_len);
+	cache->ll_dst_len = net_pkt_lladdr_dst(pkt)->len;
+	memcpy(cache->ll_dst, net_pkt_lladdr_dst(pkt)->addr,
+	       cache->ll_dst_len);
+
+	cache->iphc_addr = iphc & 0xFF;
+	cache->cid = cid;
+	cache->inline_len = inline_len;
+	memcpy(cache->inline_data, inline_pos, inline_len);
+
+	cache->in_use = true;
+}
+#endif /* CONFIG_NET_6LO_COMPRESSION_CACHE */
+
 /* Helper routine to compress Traffic class and Flow label */
 /* +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  * |Version| Traffic Class |           Flow Label                  |
@@ -723,12 +855,17 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 #if defined(CONFIG_NET_6LO_CONTEXT)
 	struct net_6lo_context *src_ctx = NULL;
 	struct net_6lo_context *dst_ctx = NULL;
+#endif
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+	struct net_6lo_compression_cache *cache;
+	uint8_t *addr_start;
 #endif
 	uint8_t compressed = 0;
 	uint16_t iphc = (NET_6LO_DISPATCH_IPHC << 8);
 	struct net_ipv6_hdr *ipv6 = NET_IPV6_HDR(pkt);
 	struct net_udp_hdr *udp;
 	uint8_t *inline_pos;
+	uint8_t cid = 0U;
 
 	if (pkt->frags->len < NET_IPV6H_LEN) {
 		NET_ERR("Invalid length %d, min %d",
@@ -752,6 +889,24 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 		inline_pos = compress_nh_udp(udp, inline_pos, false);
 	}
 
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+	cache = compression_cache_lookup(pkt, ipv6);
+	if (cache) {
+		NET_DBG("Replaying cached disposition 0x%02x",
+			cache->iphc_addr);
+
+		inline_pos -= cache->inline_len;
+		memmove(inline_pos, cache->inline_data, cache->inline_len);
+
+		iphc |= cache->iphc_addr;
+		cid = cache->cid;
+
+		goto addr_end;
+	}
+
+	addr_start = inline_pos;
+#endif
+
 	if (net_6lo_ll_prefix_padded_with_zeros(&ipv6->dst)) {
 		inline_pos = compress_da(ipv6, pkt, inline_pos, &iphc);
 		goto da_end;
@@ -800,24 +955,30 @@ da_end:
 	inline_pos = set_sa_inline(ipv6, inline_pos, &iphc);
 sa_end:
 
+#if defined(CONFIG_NET_6LO_CONTEXT)
+	if (src_ctx) {
+		cid = src_ctx->cid << 4;
+	}
+
+	if (dst_ctx) {
+		cid |= dst_ctx->cid & 0x0F;
+	}
+#endif
+
+#if defined(CONFIG_NET_6LO_COMPRESSION_CACHE)
+	compression_cache_record(pkt, ipv6, iphc, cid, inline_pos,
+				 addr_start);
+addr_end:
+#endif
+
 	inline_pos = compress_hoplimit(ipv6, inline_pos, &iphc);
 	inline_pos = compress_nh(ipv6, inline_pos, &iphc);
 	inline_pos = compress_tfl(ipv6, inline_pos, &iphc);
 
-#if defined(CONFIG_NET_6LO_CONTEXT)
 	if (iphc & NET_6LO_IPHC_CID_1) {
 		inline_pos -= sizeof(uint8_t);
-		*inline_pos = 0;
-
-		if (src_ctx) {
-			*inline_pos = src_ctx->cid << 4;
-		}
-
-		if (dst_ctx) {
-			*inline_pos |= dst_ctx->cid & 0x0F;
-		}
+		*inline_pos = cid;
 	}
-#endif
 
 	inline_pos -= sizeof(iphc);
 	iphc = htons(iphc);
@@ -891,24 +1052,14 @@ static inline uint8_t *uncompress_tfl(uint16_t iphc, uint8_t *cursor,
 static inline uint8_t *uncompress_hoplimit(uint16_t iphc, uint8_t *cursor,
 				       struct net_ipv6_hdr *ipv6)
 {
-	switch (iphc & NET_6LO_IPHC_HLIM_MASK) {
-	case NET_6LO_IPHC_HLIM:
+	uint8_t hlim = (iphc & NET_6LO_IPHC_HLIM_MASK) >>
+		       NET_6LO_IPHC_HLIM_POS;
+
+	if (hlim == 0U) {
 		ipv6->hop_limit = *cursor;
 		cursor++;
-
-		break;
-	case NET_6LO_IPHC_HLIM1:
-		ipv6->hop_limit = 1U;
-
-		break;
-	case NET_6LO_IPHC_HLIM64:
-		ipv6->hop_limit = 64U;
-
-		break;
-	case NET_6LO_IPHC_HLIM255:
-		ipv6->hop_limit = 255U;
-
-		break;
+	} else {
+		ipv6->hop_limit = hlim_value_table[hlim];
 	}
 
 	return cursor;
@@ -52,6 +52,9 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 /** Remote address specified */
 #define NET_CONN_LOCAL_ADDR_SPEC	BIT(6)
 
+/** The owning socket has set the SO_REUSEPORT option */
+#define NET_CONN_REUSEPORT		BIT(7)
+
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
@@ -59,6 +62,21 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_DEMUX_HASH)
+/* Connections with a fully specified remote end are additionally kept
+ * in a hash table so that the exact-match common case is demultiplexed
+ * without scanning and ranking the whole conn_used list. Wildcard
+ * connections are only found by the list scan.
+ */
+static sys_slist_t conn_hash[CONFIG_NET_CONN_DEMUX_HASH_BUCKETS];
+
+static void conn_hash_insert(struct net_conn *conn);
+static void conn_hash_remove(struct net_conn *conn);
+#else
+#define conn_hash_insert(conn)
+#define conn_hash_remove(conn)
+#endif
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -132,6 +150,8 @@ static void conn_set_used(struct net_conn *conn)
 	conn->flags |= NET_CONN_IN_USE;
 
 	sys_slist_prepend(&conn_used, &conn->node);
+
+	conn_hash_insert(conn);
 }
 
 static void conn_set_unused(struct net_conn *conn)
@@ -379,11 +399,60 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	sys_slist_find_and_remove(&conn_used, &conn->node);
 
+	conn_hash_remove(conn);
+
 	conn_set_unused(conn);
 
 	return 0;
 }
 
+#if defined(CONFIG_NET_RAW_FILTER)
+int net_conn_set_raw_filter(struct net_conn_handle *handle,
+			    const struct net_raw_filter *filter)
+{
+	struct net_conn *conn = (struct net_conn *)handle;
+
+	if (conn < &conns[0] || conn > &conns[CONFIG_NET_MAX_CONN]) {
+		return -EINVAL;
+	}
+
+	if (!(conn->flags & NET_CONN_IN_USE)) {
+		return -ENOENT;
+	}
+
+	NET_DBG("[%zu] connection handler %p filter %p",
+		conn - conns, conn, filter);
+
+	conn->raw_filter = filter;
+
+	return 0;
+}
+#endif /* CONFIG_NET_RAW_FILTER */
+
+int net_conn_set_reuseport(struct net_conn_handle *handle, bool reuseport)
+{
+	struct net_conn *conn = (struct net_conn *)handle;
+
+	if (conn < &conns[0] || conn > &conns[CONFIG_NET_MAX_CONN]) {
+		return -EINVAL;
+	}
+
+	if (!(conn->flags & NET_CONN_IN_USE)) {
+		return -ENOENT;
+	}
+
+	NET_DBG("[%zu] connection handler %p reuseport %d",
+		conn - conns, conn, reuseport);
+
+	if (reuseport) {
+		conn->flags |= NET_CONN_REUSEPORT;
+	} else {
+		conn->flags &= ~NET_CONN_REUSEPORT;
+	}
+
+	return 0;
+}
+
 int net_conn_change_callback(struct net_conn_handle *handle,
 			     net_conn_cb_t cb, void *user_data)
 {
@@ -457,6 +526,171 @@ static bool conn_addr_cmp(struct net_pkt *pkt,
 	return true;
 }
 
+static uint32_t conn_hash_mix(uint32_t hash, uint32_t value)
+{
+	return (hash ^ value) * 0x9e3779b1U;
+}
+
+/* Hash the source end point of the packet so that all packets of one flow
+ * map to the same value. Used to balance flows between sockets that are
+ * bound to the same port with SO_REUSEPORT.
+ */
+static uint32_t conn_flow_hash(struct net_pkt *pkt,
+			       union net_ip_header *ip_hdr,
+			       uint16_t src_port,
+			       uint16_t dst_port)
+{
+	uint32_t hash;
+
+	hash = conn_hash_mix((uint32_t)net_pkt_family(pkt) << 16,
+			     ((uint32_t)src_port << 16) | dst_port);
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		int i;
+
+		for (i = 0; i < 4; i++) {
+			hash = conn_hash_mix(hash,
+					     ip_hdr->ipv6->src.s6_addr32[i]);
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_pkt_family(pkt) == AF_INET) {
+		hash = conn_hash_mix(hash, ip_hdr->ipv4->src.s_addr);
+	}
+
+	return hash;
+}
+
+#if defined(CONFIG_NET_CONN_DEMUX_HASH)
+static bool conn_is_hashable(struct net_conn *conn)
+{
+	if (!(IS_ENABLED(CONFIG_NET_UDP) && conn->proto == IPPROTO_UDP) &&
+	    !(IS_ENABLED(CONFIG_NET_TCP) && conn->proto == IPPROTO_TCP)) {
+		return false;
+	}
+
+	if (conn->family != AF_INET && conn->family != AF_INET6) {
+		return false;
+	}
+
+	return (conn->flags & (NET_CONN_REMOTE_ADDR_SPEC |
+			       NET_CONN_REMOTE_PORT_SPEC |
+			       NET_CONN_LOCAL_PORT_SPEC)) ==
+	       (NET_CONN_REMOTE_ADDR_SPEC |
+		NET_CONN_REMOTE_PORT_SPEC |
+		NET_CONN_LOCAL_PORT_SPEC);
+}
+
+/* The ports are hashed in network byte order, as that is how both the
+ * received packet headers and the registered connections store them.
+ */
+static sys_slist_t *conn_hash_bucket(uint16_t proto, uint8_t family,
+				     const void *remote_addr,
+				     uint16_t remote_port,
+				     uint16_t local_port)
+{
+	uint32_t hash;
+
+	hash = conn_hash_mix(((uint32_t)family << 16) | proto,
+			     ((uint32_t)remote_port << 16) | local_port);
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+		const struct in6_addr *addr = remote_addr;
+		int i;
+
+		for (i = 0; i < 4; i++) {
+			hash = conn_hash_mix(hash, addr->s6_addr32[i]);
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+		const struct in_addr *addr = remote_addr;
+
+		hash = conn_hash_mix(hash, addr->s_addr);
+	}
+
+	return &conn_hash[hash % CONFIG_NET_CONN_DEMUX_HASH_BUCKETS];
+}
+
+static sys_slist_t *conn_hash_bucket_of(struct net_conn *conn)
+{
+	const void *remote_addr;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6) {
+		remote_addr = &net_sin6(&conn->remote_addr)->sin6_addr;
+	} else {
+		remote_addr = &net_sin(&conn->remote_addr)->sin_addr;
+	}
+
+	return conn_hash_bucket(conn->proto, conn->family, remote_addr,
+				net_sin(&conn->remote_addr)->sin_port,
+				net_sin(&conn->local_addr)->sin_port);
+}
+
+static void conn_hash_insert(struct net_conn *conn)
+{
+	if (!conn_is_hashable(conn)) {
+		return;
+	}
+
+	sys_slist_prepend(conn_hash_bucket_of(conn), &conn->hash_node);
+}
+
+static void conn_hash_remove(struct net_conn *conn)
+{
+	if (!conn_is_hashable(conn)) {
+		return;
+	}
+
+	sys_slist_find_and_remove(conn_hash_bucket_of(conn), &conn->hash_node);
+}
+
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port,
+					 uint16_t dst_port)
+{
+	const void *src_addr;
+	struct net_conn *conn;
+	sys_slist_t *bucket;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		src_addr = &ip_hdr->ipv6->src;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_pkt_family(pkt) == AF_INET) {
+		src_addr = &ip_hdr->ipv4->src;
+	} else {
+		return NULL;
+	}
+
+	bucket = conn_hash_bucket(proto, net_pkt_family(pkt), src_addr,
+				  src_port, dst_port);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, conn, hash_node) {
+		if (conn->proto != proto ||
+		    conn->family != net_pkt_family(pkt)) {
+			continue;
+		}
+
+		if (net_sin(&conn->remote_addr)->sin_port != src_port ||
+		    net_sin(&conn->local_addr)->sin_port != dst_port) {
+			continue;
+		}
+
+		if (!conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+			continue;
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+			continue;
+		}
+
+		return conn;
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_DEMUX_HASH */
+
 static inline void conn_send_icmp_error(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
@@ -505,6 +739,46 @@ static bool conn_are_end_points_valid(struct net_pkt *pkt,
 	return !(my_src_addr && (src_port == dst_port));
 }
 
+#if defined(CONFIG_NET_CONN_DEMUX_HASH) && defined(CONFIG_NET_UDP)
+enum net_verdict net_conn_udp_early_input(struct net_pkt *pkt,
+					  union net_ip_header *ip_hdr,
+					  union net_proto_header *proto_hdr)
+{
+	struct net_conn *conn;
+
+	/* conn_are_end_points_valid() can only fail when the ports are
+	 * equal, so the address lookups it does are skipped otherwise.
+	 */
+	if (proto_hdr->udp->src_port == proto_hdr->udp->dst_port &&
+	    !conn_are_end_points_valid(pkt, ip_hdr,
+				       proto_hdr->udp->src_port,
+				       proto_hdr->udp->dst_port)) {
+		return NET_CONTINUE;
+	}
+
+	conn = conn_hash_lookup(pkt, ip_hdr, IPPROTO_UDP,
+				proto_hdr->udp->src_port,
+				proto_hdr->udp->dst_port);
+	if (!conn) {
+		return NET_CONTINUE;
+	}
+
+	NET_DBG("[%p] early match found cb %p ud %p",
+		conn, conn->cb, conn->user_data);
+
+	if (conn->cb(conn, pkt, ip_hdr, proto_hdr,
+		     conn->user_data) == NET_DROP) {
+		net_stats_update_per_proto_drop(net_pkt_iface(pkt),
+						IPPROTO_UDP);
+		return NET_DROP;
+	}
+
+	net_stats_update_per_proto_recv(net_pkt_iface(pkt), IPPROTO_UDP);
+
+	return NET_OK;
+}
+#endif /* CONFIG_NET_CONN_DEMUX_HASH && CONFIG_NET_UDP */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -514,6 +788,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 	struct net_conn *best_match = NULL;
 	bool is_mcast_pkt = false, mcast_pkt_delivered = false;
 	bool raw_pkt_delivered = false;
+	bool flow_hashed = false;
+	uint32_t flow_hash = 0U;
 	int16_t best_rank = -1;
 	struct net_conn *conn;
 	uint16_t src_port;
@@ -572,6 +848,33 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
+#if defined(CONFIG_NET_CONN_DEMUX_HASH)
+	/* Exact-match fast path; a fully specified connection always wins
+	 * the ranking below, so the scan can be skipped entirely for it.
+	 * Multicast packets may need delivery to several handlers, so
+	 * they always take the scan.
+	 */
+	if (!is_mcast_pkt &&
+	    ((IS_ENABLED(CONFIG_NET_UDP) && proto == IPPROTO_UDP) ||
+	     (IS_ENABLED(CONFIG_NET_TCP) && proto == IPPROTO_TCP))) {
+		conn = conn_hash_lookup(pkt, ip_hdr, proto,
+					src_port, dst_port);
+		if (conn) {
+			NET_DBG("[%p] hash match found cb %p ud %p",
+				conn, conn->cb, conn->user_data);
+
+			if (conn->cb(conn, pkt, ip_hdr, proto_hdr,
+				     conn->user_data) == NET_DROP) {
+				goto drop;
+			}
+
+			net_stats_update_per_proto_recv(pkt_iface, proto);
+
+			return NET_OK;
+		}
+	}
+#endif /* CONFIG_NET_CONN_DEMUX_HASH */
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* For packet socket data, the proto is set to ETH_P_ALL but
 		 * the listener might have a specific protocol set. This is ok
@@ -634,6 +937,31 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 				continue;
 			}
 
+			/* Sockets bound to the same port with SO_REUSEPORT
+			 * tie in the ranking; pick the member that scores
+			 * highest for the flow hash so that every flow
+			 * consistently lands on the same socket.
+			 */
+			if (!is_mcast_pkt && best_match != NULL &&
+			    best_rank == NET_CONN_RANK(conn->flags) &&
+			    (conn->flags & best_match->flags &
+			     NET_CONN_REUSEPORT)) {
+				if (!flow_hashed) {
+					flow_hash = conn_flow_hash(pkt, ip_hdr,
+								   src_port,
+								   dst_port);
+					flow_hashed = true;
+				}
+
+				if (conn_hash_mix(flow_hash, conn - conns) >
+				    conn_hash_mix(flow_hash,
+						  best_match - conns)) {
+					best_match = conn;
+				}
+
+				continue;
+			}
+
 			if (best_rank < NET_CONN_RANK(conn->flags)) {
 				struct net_pkt *mcast_pkt;
 
@@ -684,6 +1012,16 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 					continue;
 				}
 
+#if defined(CONFIG_NET_RAW_FILTER)
+				/* Drop uninteresting frames before they
+				 * are cloned and queued to the socket.
+				 */
+				if (!net_raw_filter_ok(conn->raw_filter,
+						       pkt)) {
+					continue;
+				}
+#endif
+
 				NET_DBG("[%p] raw match found cb %p ud %p",
 					conn, conn->cb,	conn->user_data);
 
@@ -781,6 +1119,12 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_DEMUX_HASH)
+	for (i = 0; i < CONFIG_NET_CONN_DEMUX_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
@@ -50,6 +50,11 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_DEMUX_HASH)
+	/** Node in the demultiplexing hash bucket list */
+	sys_snode_t hash_node;
+#endif
+
 	/** Remote IP address */
 	struct sockaddr remote_addr;
 
@@ -62,6 +67,13 @@ struct net_conn {
 	/** Possible user to pass to the callback */
 	void *user_data;
 
+#if defined(CONFIG_NET_RAW_FILTER)
+	/** Receive filter for AF_PACKET connections. The filter is
+	 * owned by the net_context, NULL if no filter is attached.
+	 */
+	const struct net_raw_filter *raw_filter;
+#endif
+
 	/** Connection protocol */
 	uint16_t proto;
 
@@ -121,6 +133,34 @@ static inline int net_conn_register(uint16_t proto, uint8_t family,
 }
 #endif
 
+#if defined(CONFIG_NET_RAW_FILTER)
+/**
+ * @brief Attach a receive filter to a registered AF_PACKET connection.
+ *
+ * @param handle Connection handle returned by net_conn_register().
+ * @param filter Filter to evaluate for each received frame, NULL to
+ * remove the filter. The filter memory must stay valid as long as it
+ * is attached.
+ *
+ * @return Return 0 if ok, <0 otherwise.
+ */
+int net_conn_set_raw_filter(struct net_conn_handle *handle,
+			    const struct net_raw_filter *filter);
+#endif
+
+/**
+ * @brief Mark a registered connection as a SO_REUSEPORT member.
+ *
+ * @details Incoming flows are balanced between the connections that are
+ * bound to the same local port and marked this way.
+ *
+ * @param handle Connection handle returned by net_conn_register().
+ * @param reuseport True to include the connection in the balancing.
+ *
+ * @return Return 0 if ok, <0 otherwise.
+ */
+int net_conn_set_reuseport(struct net_conn_handle *handle, bool reuseport);
+
 /**
  * @brief Unregister connection handler.
  *
@@ -179,6 +219,33 @@ static inline enum net_verdict net_conn_input(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_UDP || CONFIG_NET_TCP  || CONFIG_NET_SOCKETS_PACKET */
 
+/**
+ * @brief Deliver an early-demuxed unicast UDP packet directly to the
+ * matching connection handler. The caller has already validated the
+ * IP and UDP headers and ruled out multicast and broadcast packets.
+ *
+ * @param pkt Network packet holding received data
+ * @param ip_hdr IP header of the packet
+ * @param proto_hdr UDP header of the packet
+ *
+ * @return NET_OK if the packet was delivered, NET_DROP if the handler
+ * dropped it, NET_CONTINUE if no exact-match connection was found and
+ * the caller should take the generic input path.
+ */
+#if defined(CONFIG_NET_CONN_DEMUX_HASH) && defined(CONFIG_NET_UDP)
+enum net_verdict net_conn_udp_early_input(struct net_pkt *pkt,
+					  union net_ip_header *ip_hdr,
+					  union net_proto_header *proto_hdr);
+#else
+static inline
+enum net_verdict net_conn_udp_early_input(struct net_pkt *pkt,
+					  union net_ip_header *ip_hdr,
+					  union net_proto_header *proto_hdr)
+{
+	return NET_CONTINUE;
+}
+#endif
+
 /**
  * @typedef net_conn_foreach_cb_t
  * @brief Callback used while iterating over network connection
@@ -30,6 +30,11 @@ LOG_MODULE_REGISTER(net_dhcpv4, CONFIG_NET_DHCPV4_LOG_LEVEL);
 #include "dhcpv4.h"
 #include "ipv4.h"
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+#include <stdlib.h>
+#include <settings/settings.h>
+#endif
+
 #define PKT_WAIT_TIME K_SECONDS(1)
 
 static sys_slist_t dhcpv4_ifaces;
@@ -60,6 +65,156 @@ static const char *dhcpv4_msg_type_name(enum dhcpv4_msg_type msg_type)
 	return name[msg_type - 1];
 }
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+struct dhcpv4_lease {
+	struct in_addr address;
+	struct in_addr server_id;
+};
+
+/* Cached leases, one per network interface. The cache is filled from
+ * the settings storage when the application calls settings_load() and
+ * updated whenever a lease is acquired or NAKed.
+ */
+static struct dhcpv4_lease_slot {
+	struct dhcpv4_lease lease;
+	uint8_t ifindex;
+	bool valid;
+} dhcpv4_leases[CONFIG_NET_DHCPV4_LEASE_CACHE_MAX];
+
+static struct dhcpv4_lease_slot *dhcpv4_lease_slot_get(int ifindex,
+						       bool allocate)
+{
+	struct dhcpv4_lease_slot *unused = NULL;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(dhcpv4_leases); i++) {
+		if (dhcpv4_leases[i].valid &&
+		    dhcpv4_leases[i].ifindex == ifindex) {
+			return &dhcpv4_leases[i];
+		}
+
+		if (!dhcpv4_leases[i].valid && !unused) {
+			unused = &dhcpv4_leases[i];
+		}
+	}
+
+	return allocate ? unused : NULL;
+}
+
+static bool dhcpv4_lease_load(struct net_if *iface)
+{
+	struct dhcpv4_lease_slot *slot;
+
+	slot = dhcpv4_lease_slot_get(net_if_get_by_iface(iface), false);
+	if (!slot) {
+		return false;
+	}
+
+	net_ipaddr_copy(&iface->config.dhcpv4.requested_ip,
+			&slot->lease.address);
+	net_ipaddr_copy(&iface->config.dhcpv4.server_id,
+			&slot->lease.server_id);
+
+	return true;
+}
+
+static void dhcpv4_lease_store(struct net_if *iface)
+{
+	int ifindex = net_if_get_by_iface(iface);
+	struct dhcpv4_lease_slot *slot;
+	char key[32];
+
+	slot = dhcpv4_lease_slot_get(ifindex, true);
+	if (!slot) {
+		NET_DBG("No lease cache slot for iface %d", ifindex);
+		return;
+	}
+
+	if (slot->valid &&
+	    net_ipv4_addr_cmp(&slot->lease.address,
+			      &iface->config.dhcpv4.requested_ip) &&
+	    net_ipv4_addr_cmp(&slot->lease.server_id,
+			      &iface->config.dhcpv4.server_id)) {
+		/* The lease did not change, avoid rewriting the
+		 * storage on every renewal.
+		 */
+		return;
+	}
+
+	net_ipaddr_copy(&slot->lease.address,
+			&iface->config.dhcpv4.requested_ip);
+	net_ipaddr_copy(&slot->lease.server_id,
+			&iface->config.dhcpv4.server_id);
+	slot->ifindex = ifindex;
+	slot->valid = true;
+
+	snprintk(key, sizeof(key), "net/dhcpv4/lease/%d", ifindex);
+
+	if (settings_save_one(key, &slot->lease, sizeof(slot->lease)) < 0) {
+		NET_DBG("Cannot store lease for iface %d", ifindex);
+	}
+}
+
+static void dhcpv4_lease_delete(struct net_if *iface)
+{
+	int ifindex = net_if_get_by_iface(iface);
+	struct dhcpv4_lease_slot *slot;
+	char key[32];
+
+	slot = dhcpv4_lease_slot_get(ifindex, false);
+	if (slot) {
+		slot->valid = false;
+	}
+
+	snprintk(key, sizeof(key), "net/dhcpv4/lease/%d", ifindex);
+
+	(void)settings_delete(key);
+}
+
+static int dhcpv4_settings_set(const char *name, size_t len,
+			       settings_read_cb read_cb, void *cb_arg)
+{
+	struct dhcpv4_lease_slot *slot;
+	const char *next;
+	int ifindex;
+
+	if (!settings_name_steq(name, "lease", &next) || !next) {
+		return -ENOENT;
+	}
+
+	if (len != sizeof(struct dhcpv4_lease)) {
+		return -EINVAL;
+	}
+
+	ifindex = atoi(next);
+	if (ifindex <= 0) {
+		return -EINVAL;
+	}
+
+	slot = dhcpv4_lease_slot_get(ifindex, true);
+	if (!slot) {
+		return -ENOMEM;
+	}
+
+	if (read_cb(cb_arg, &slot->lease, sizeof(slot->lease)) !=
+	    sizeof(slot->lease)) {
+		return -EIO;
+	}
+
+	slot->ifindex = ifindex;
+	slot->valid = true;
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(net_dhcpv4, "net/dhcpv4", NULL,
+			       dhcpv4_settings_set, NULL, NULL);
+#else
+#define dhcpv4_lease_load(iface) false
+#define dhcpv4_lease_store(iface)
+#define dhcpv4_lease_delete(iface)
+#endif /* CONFIG_NET_DHCPV4_LEASE_CACHE */
+
 /* Add magic cookie to DCHPv4 messages */
 static inline bool dhcpv4_add_cookie(struct net_pkt *pkt)
 {
@@ -298,6 +453,13 @@ static uint32_t dhcpv4_send_request(struct net_if *iface)
 		NET_ASSERT(0, "Invalid state %s",
 			   net_dhcpv4_state_name(iface->config.dhcpv4.state));
 		break;
+	case NET_DHCPV4_INIT_REBOOT:
+		/* RFC2131 4.3.2 INIT-REBOOT: the client MUST NOT include
+		 * the server identifier, only the previously assigned
+		 * address in the requested IP option.
+		 */
+		with_requested_ip = true;
+		break;
 	case NET_DHCPV4_REQUESTING:
 		with_server_id = true;
 		with_requested_ip = true;
@@ -508,6 +670,8 @@ static void dhcpv4_enter_bound(struct net_if *iface)
 		iface->config.dhcpv4.rebinding_time = rebinding_time;
 	}
 
+	dhcpv4_lease_store(iface);
+
 	iface->config.dhcpv4.state = NET_DHCPV4_BOUND;
 	NET_DBG("enter state=%s renewal=%us rebinding=%us",
 		net_dhcpv4_state_name(iface->config.dhcpv4.state),
@@ -537,6 +701,7 @@ static uint32_t dhcph4_manage_timers(struct net_if *iface, int64_t timeout)
 	case NET_DHCPV4_SELECTING:
 		/* Failed to get OFFER message, send DISCOVER again */
 		return dhcpv4_send_discover(iface);
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_REQUESTING:
 		/* Maximum number of renewal attempts failed, so start
 		 * from the beginning.
@@ -835,6 +1000,7 @@ static inline void dhcpv4_handle_msg_offer(struct net_if *iface)
 	switch (iface->config.dhcpv4.state) {
 	case NET_DHCPV4_DISABLED:
 	case NET_DHCPV4_INIT:
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_REQUESTING:
 	case NET_DHCPV4_RENEWING:
 	case NET_DHCPV4_REBINDING:
@@ -854,6 +1020,7 @@ static void dhcpv4_handle_msg_ack(struct net_if *iface)
 	case NET_DHCPV4_SELECTING:
 	case NET_DHCPV4_BOUND:
 		break;
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_REQUESTING:
 		NET_INFO("Received: %s",
 			 log_strdup(net_sprint_ipv4_addr(
@@ -889,9 +1056,15 @@ static void dhcpv4_handle_msg_nak(struct net_if *iface)
 	case NET_DHCPV4_RENEWING:
 	case NET_DHCPV4_BOUND:
 		break;
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_REQUESTING:
 	case NET_DHCPV4_REBINDING:
-		/* Restart the configuration process. */
+		/* The server does not want us to use the old address,
+		 * forget the cached lease and restart the configuration
+		 * process from a full discovery.
+		 */
+		dhcpv4_lease_delete(iface);
+
 		dhcpv4_enter_selecting(iface);
 		break;
 	}
@@ -1058,6 +1231,7 @@ const char *net_dhcpv4_state_name(enum net_dhcpv4_state state)
 	static const char * const name[] = {
 		"disabled",
 		"init",
+		"init-reboot",
 		"selecting",
 		"requesting",
 		"renewing",
@@ -1087,6 +1261,19 @@ void net_dhcpv4_start(struct net_if *iface)
 		iface->config.dhcpv4.server_id.s_addr = 0U;
 		iface->config.dhcpv4.requested_ip.s_addr = 0U;
 
+		if (dhcpv4_lease_load(iface)) {
+			/* We have a lease from an earlier run, try to
+			 * take it back into use with an INIT-REBOOT
+			 * request instead of a full discovery.
+			 */
+			iface->config.dhcpv4.state = NET_DHCPV4_INIT_REBOOT;
+			NET_DBG("iface %p state=%s requested=%s", iface,
+				net_dhcpv4_state_name(
+					iface->config.dhcpv4.state),
+				log_strdup(net_sprint_ipv4_addr(
+					&iface->config.dhcpv4.requested_ip)));
+		}
+
 		/* We need entropy for both an XID and a random delay
 		 * before sending the initial discover message.
 		 */
@@ -1109,6 +1296,13 @@ void net_dhcpv4_start(struct net_if *iface)
 				  DHCPV4_INITIAL_DELAY_MIN) +
 				DHCPV4_INITIAL_DELAY_MIN;
 
+		if (iface->config.dhcpv4.state == NET_DHCPV4_INIT_REBOOT) {
+			/* RFC2131 4.4.2, no need to delay when we are
+			 * requesting our previous address back.
+			 */
+			timeout = 0U;
+		}
+
 		NET_DBG("wait timeout=%us", timeout);
 
 		if (sys_slist_is_empty(&dhcpv4_ifaces)) {
@@ -1125,6 +1319,7 @@ void net_dhcpv4_start(struct net_if *iface)
 
 		break;
 	case NET_DHCPV4_INIT:
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_SELECTING:
 	case NET_DHCPV4_REQUESTING:
 	case NET_DHCPV4_RENEWING:
@@ -1149,6 +1344,7 @@ void net_dhcpv4_stop(struct net_if *iface)
 
 		__fallthrough;
 	case NET_DHCPV4_INIT:
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_SELECTING:
 	case NET_DHCPV4_REQUESTING:
 	case NET_DHCPV4_REBINDING:
@@ -196,6 +196,116 @@ int net_ipv4_parse_hdr_options(struct net_pkt *pkt,
 }
 #endif
 
+#if defined(CONFIG_NET_CONN_DEMUX_HASH) && defined(CONFIG_NET_UDP)
+/* Early demux for the dominant case: an unfragmented unicast UDP
+ * datagram whose IPv4 and UDP headers sit in the contiguous first
+ * fragment. Both headers are validated in one pass and the packet is
+ * handed straight to the exact-match connection lookup. Anything
+ * unusual - options, fragments, multicast, broadcast, a non-contiguous
+ * first fragment - falls back to the generic path (NET_CONTINUE).
+ */
+static enum net_verdict net_ipv4_early_demux(struct net_pkt *pkt)
+{
+	int real_len = net_pkt_get_len(pkt);
+	union net_proto_header proto_hdr;
+	struct net_udp_hdr *udp_hdr;
+	struct net_ipv4_hdr *hdr;
+	enum net_verdict verdict;
+	union net_ip_header ip;
+	int pkt_len;
+
+	if (!pkt->buffer ||
+	    pkt->buffer->len < sizeof(struct net_ipv4_hdr) +
+			       sizeof(struct net_udp_hdr)) {
+		return NET_CONTINUE;
+	}
+
+	hdr = (struct net_ipv4_hdr *)pkt->buffer->data;
+
+	/* IPv4 without options carrying UDP, and not a fragment: the
+	 * reserved and MF flags and the fragment offset must all be
+	 * zero, only DF (0x40) is acceptable.
+	 */
+	if (hdr->vhl != 0x45 || hdr->proto != IPPROTO_UDP ||
+	    (hdr->offset[0] & 0xbf) != 0U || hdr->offset[1] != 0U) {
+		return NET_CONTINUE;
+	}
+
+	pkt_len = ntohs(hdr->len);
+	if (real_len < pkt_len ||
+	    pkt_len < (int)(sizeof(struct net_ipv4_hdr) +
+			    sizeof(struct net_udp_hdr))) {
+		return NET_CONTINUE;
+	}
+
+	/* Only the plain unicast-to-us case is handled here */
+	if (net_ipv4_is_addr_mcast(&hdr->dst) ||
+	    net_ipv4_is_addr_bcast(net_pkt_iface(pkt), &hdr->dst) ||
+	    !net_ipv4_is_my_addr(&hdr->dst)) {
+		return NET_CONTINUE;
+	}
+
+	if (net_ipv4_is_addr_mcast(&hdr->src) ||
+	    net_ipv4_is_addr_bcast(net_pkt_iface(pkt), &hdr->src) ||
+	    net_ipv4_is_addr_unspecified(&hdr->src)) {
+		return NET_CONTINUE;
+	}
+
+	udp_hdr = (struct net_udp_hdr *)(pkt->buffer->data +
+					 sizeof(struct net_ipv4_hdr));
+
+	if (ntohs(udp_hdr->len) !=
+	    pkt_len - (int)sizeof(struct net_ipv4_hdr)) {
+		return NET_CONTINUE;
+	}
+
+	if (real_len > pkt_len) {
+		net_pkt_update_length(pkt, pkt_len);
+	}
+
+	/* The checksum helpers rely only on the state set here, and the
+	 * generic path sets the very same values when we fall back.
+	 */
+	net_pkt_set_ip_hdr_len(pkt, sizeof(struct net_ipv4_hdr));
+	net_pkt_set_ipv4_opts_len(pkt, 0);
+	net_pkt_set_ipv4_ttl(pkt, hdr->ttl);
+	net_pkt_set_family(pkt, PF_INET);
+
+	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt))) {
+		if (net_calc_chksum_ipv4(pkt) != 0U) {
+			return NET_CONTINUE;
+		}
+
+		if (IS_ENABLED(CONFIG_NET_UDP_CHECKSUM)) {
+			if (!udp_hdr->chksum) {
+				if (!IS_ENABLED(
+					CONFIG_NET_UDP_MISSING_CHECKSUM)) {
+					return NET_CONTINUE;
+				}
+			} else if (net_calc_verify_chksum_udp(pkt) != 0U) {
+				return NET_CONTINUE;
+			}
+		}
+	}
+
+	if (net_pkt_skip(pkt, sizeof(struct net_ipv4_hdr) +
+			      sizeof(struct net_udp_hdr))) {
+		return NET_CONTINUE;
+	}
+
+	ip.ipv4 = hdr;
+	proto_hdr.udp = udp_hdr;
+
+	verdict = net_conn_udp_early_input(pkt, &ip, &proto_hdr);
+	if (verdict == NET_CONTINUE) {
+		/* Rewind for the generic path */
+		net_pkt_cursor_init(pkt);
+	}
+
+	return verdict;
+}
+#endif /* CONFIG_NET_CONN_DEMUX_HASH && CONFIG_NET_UDP */
+
 enum net_verdict net_ipv4_input(struct net_pkt *pkt)
 {
 	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
@@ -212,6 +322,18 @@ enum net_verdict net_ipv4_input(struct net_pkt *pkt)
 
 	net_stats_update_ipv4_recv(net_pkt_iface(pkt));
 
+#if defined(CONFIG_NET_CONN_DEMUX_HASH) && defined(CONFIG_NET_UDP)
+	verdict = net_ipv4_early_demux(pkt);
+	if (verdict == NET_DROP) {
+		goto drop;
+	} else if (verdict != NET_CONTINUE) {
+		return verdict;
+	}
+
+	verdict = NET_DROP;
+	real_len = net_pkt_get_len(pkt);
+#endif
+
 	hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
 	if (!hdr) {
 		NET_DBG("DROP: no buffer");
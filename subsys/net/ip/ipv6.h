@@ -95,6 +95,11 @@ struct net_ipv6_nbr_data {
 	/** Neighbor Solicitation reply timer */
 	int64_t send_ns;
 
+	/** Next neighbor in the same address hash bucket. This is an
+	 *  index into the neighbor pool, -1 terminates the chain.
+	 */
+	int16_t hash_next;
+
 	/** State of the neighbor discovery */
 	enum net_ipv6_nbr_state state;
 
@@ -382,11 +387,13 @@ static inline void net_ipv6_nbr_set_reachable_timer(struct net_if *iface,
 }
 #endif
 
-/* We do not have to accept larger than 1500 byte IPv6 packet (RFC 2460 ch 5).
- * This means that we should receive everything within first two fragments.
- * The first one being 1280 bytes and the second one 220 bytes.
+/* We do not have to accept larger than 1500 byte IPv6 packet (RFC 2460 ch 5),
+ * so two fragments are enough for plain IPv6. Larger datagrams, as seen with
+ * 6LoWPAN CoAP block transfers, can be allowed via the Kconfig option.
  */
-#if !defined(NET_IPV6_FRAGMENTS_MAX_PKT)
+#if defined(CONFIG_NET_IPV6_FRAGMENT_MAX_PKT)
+#define NET_IPV6_FRAGMENTS_MAX_PKT CONFIG_NET_IPV6_FRAGMENT_MAX_PKT
+#elif !defined(NET_IPV6_FRAGMENTS_MAX_PKT)
 #define NET_IPV6_FRAGMENTS_MAX_PKT 2
 #endif
 
@@ -399,16 +406,22 @@ struct net_ipv6_reassembly {
 	struct in6_addr dst;
 
 	/**
-	 * Timeout for cancelling the reassembly. The timer is used
-	 * also to detect if this reassembly slot is used or not.
+	 * Timeout (uptime in ms) for cancelling the reassembly. All the
+	 * active reassemblies share one timer. The value 0 tells that
+	 * this reassembly slot is not in use.
 	 */
-	struct k_delayed_work timer;
+	uint32_t deadline;
 
-	/** Pointers to pending fragments */
+	/** Pointers to pending fragments, sorted by fragment offset */
 	struct net_pkt *pkt[NET_IPV6_FRAGMENTS_MAX_PKT];
 
 	/** IPv6 fragment identification */
 	uint32_t id;
+
+	/** Total reassembled payload length, known once the fragment
+	 * with the more fragments flag cleared has arrived, 0 until then.
+	 */
+	uint16_t total_len;
 };
 
 /**
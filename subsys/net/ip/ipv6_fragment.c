@@ -33,9 +33,10 @@ LOG_MODULE_DECLARE(net_ipv6, CONFIG_NET_IPV6_LOG_LEVEL);
 #define NET_BUF_TIMEOUT K_MSEC(50)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT_TIMEOUT)
-#define IPV6_REASSEMBLY_TIMEOUT K_SECONDS(CONFIG_NET_IPV6_FRAGMENT_TIMEOUT)
+#define IPV6_REASSEMBLY_TIMEOUT_MS \
+	(CONFIG_NET_IPV6_FRAGMENT_TIMEOUT * MSEC_PER_SEC)
 #else
-#define IPV6_REASSEMBLY_TIMEOUT K_SECONDS(5)
+#define IPV6_REASSEMBLY_TIMEOUT_MS (5 * MSEC_PER_SEC)
 #endif /* CONFIG_NET_IPV6_FRAGMENT_TIMEOUT */
 
 #define FRAG_BUF_WAIT K_MSEC(10) /* how long to max wait for a buffer */
@@ -46,6 +47,42 @@ static bool reassembly_init_done;
 static struct net_ipv6_reassembly
 reassembly[CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT];
 
+/* All the active reassemblies share this timer. It is always scheduled
+ * for the nearest deadline of the active slots.
+ */
+static struct k_delayed_work reassembly_timer;
+
+static int32_t reassembly_remaining(struct net_ipv6_reassembly *reass)
+{
+	return (int32_t)(reass->deadline - k_uptime_get_32());
+}
+
+static void reassembly_timer_reschedule(void)
+{
+	int32_t next = -1;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
+		int32_t remaining;
+
+		if (!reassembly[i].deadline) {
+			continue;
+		}
+
+		remaining = MAX(reassembly_remaining(&reassembly[i]), 0);
+
+		if (next < 0 || remaining < next) {
+			next = remaining;
+		}
+	}
+
+	if (next < 0) {
+		k_delayed_work_cancel(&reassembly_timer);
+	} else {
+		k_delayed_work_submit(&reassembly_timer, K_MSEC(next));
+	}
+}
+
 int net_ipv6_find_last_ext_hdr(struct net_pkt *pkt, uint16_t *next_hdr_off,
 			       uint16_t *last_hdr_off)
 {
@@ -128,14 +165,14 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 
 	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
 
-		if (k_delayed_work_remaining_get(&reassembly[i].timer) &&
+		if (reassembly[i].deadline &&
 		    reassembly[i].id == id &&
 		    net_ipv6_addr_cmp(src, &reassembly[i].src) &&
 		    net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
 			return &reassembly[i];
 		}
 
-		if (k_delayed_work_remaining_get(&reassembly[i].timer)) {
+		if (reassembly[i].deadline) {
 			continue;
 		}
 
@@ -148,8 +185,16 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 		return NULL;
 	}
 
-	k_delayed_work_submit(&reassembly[avail].timer,
-			      IPV6_REASSEMBLY_TIMEOUT);
+	reassembly[avail].deadline = k_uptime_get_32() +
+		IPV6_REASSEMBLY_TIMEOUT_MS;
+	if (!reassembly[avail].deadline) {
+		/* The deadline value 0 marks a free slot, skew the rare
+		 * uptime wrap around hit by one millisecond.
+		 */
+		reassembly[avail].deadline = 1U;
+	}
+
+	reassembly_timer_reschedule();
 
 	net_ipaddr_copy(&reassembly[avail].src, src);
 	net_ipaddr_copy(&reassembly[avail].dst, dst);
@@ -168,24 +213,22 @@ static bool reassembly_cancel(uint32_t id,
 	NET_DBG("Cancel 0x%x", id);
 
 	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-		int32_t remaining;
-
 		if (reassembly[i].id != id ||
 		    !net_ipv6_addr_cmp(src, &reassembly[i].src) ||
 		    !net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
 			continue;
 		}
 
-		remaining = k_delayed_work_remaining_get(&reassembly[i].timer);
-		if (remaining) {
-			k_delayed_work_cancel(&reassembly[i].timer);
-		}
-
 		NET_DBG("IPv6 reassembly id 0x%x remaining %d ms",
-			reassembly[i].id, remaining);
+			reassembly[i].id,
+			reassembly_remaining(&reassembly[i]));
 
+		reassembly[i].deadline = 0U;
+		reassembly[i].total_len = 0U;
 		reassembly[i].id = 0U;
 
+		reassembly_timer_reschedule();
+
 		for (j = 0; j < NET_IPV6_FRAGMENTS_MAX_PKT; j++) {
 			if (!reassembly[i].pkt[j]) {
 				continue;
@@ -210,17 +253,28 @@ static void reassembly_info(char *str, struct net_ipv6_reassembly *reass)
 	NET_DBG("%s id 0x%x src %s dst %s remain %d ms", str, reass->id,
 		log_strdup(net_sprint_ipv6_addr(&reass->src)),
 		log_strdup(net_sprint_ipv6_addr(&reass->dst)),
-		k_delayed_work_remaining_get(&reass->timer));
+		reassembly_remaining(reass));
 }
 
 static void reassembly_timeout(struct k_work *work)
 {
-	struct net_ipv6_reassembly *reass =
-		CONTAINER_OF(work, struct net_ipv6_reassembly, timer);
+	int i;
+
+	ARG_UNUSED(work);
 
-	reassembly_info("Reassembly cancelled", reass);
+	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
+		if (!reassembly[i].deadline ||
+		    reassembly_remaining(&reassembly[i]) > 0) {
+			continue;
+		}
 
-	reassembly_cancel(reass->id, &reass->src, &reass->dst);
+		reassembly_info("Reassembly cancelled", &reassembly[i]);
+
+		reassembly_cancel(reassembly[i].id, &reassembly[i].src,
+				  &reassembly[i].dst);
+	}
+
+	reassembly_timer_reschedule();
 }
 
 static void reassemble_packet(struct net_ipv6_reassembly *reass)
@@ -237,7 +291,9 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 	uint8_t next_hdr;
 	int i, len;
 
-	k_delayed_work_cancel(&reass->timer);
+	reass->deadline = 0U;
+	reass->total_len = 0U;
+	reassembly_timer_reschedule();
 
 	NET_ASSERT(reass->pkt[0]);
 
@@ -246,7 +302,7 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 	/* We start from 2nd packet which is then appended to
 	 * the first one.
 	 */
-	for (i = 1; i < NET_IPV6_FRAGMENTS_MAX_PKT; i++) {
+	for (i = 1; i < NET_IPV6_FRAGMENTS_MAX_PKT && reass->pkt[i]; i++) {
 		int removed_len;
 
 		pkt = reass->pkt[i];
@@ -354,7 +410,7 @@ void net_ipv6_frag_foreach(net_ipv6_frag_cb_t cb, void *user_data)
 
 	for (i = 0; reassembly_init_done &&
 		     i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-		if (!k_delayed_work_remaining_get(&reassembly[i].timer)) {
+		if (!reassembly[i].deadline) {
 			continue;
 		}
 
@@ -362,37 +418,40 @@ void net_ipv6_frag_foreach(net_ipv6_frag_cb_t cb, void *user_data)
 	}
 }
 
-/* Verify that we have all the fragments received and in correct order.
- */
-static bool fragment_verify(struct net_ipv6_reassembly *reass)
+static uint16_t fragment_payload_len(struct net_pkt *pkt)
 {
-	uint16_t offset;
-	int i, prev_len;
-
-	prev_len = net_pkt_get_len(reass->pkt[0]);
-	offset = net_pkt_ipv6_fragment_offset(reass->pkt[0]);
+	return net_pkt_get_len(pkt) - net_pkt_ipv6_fragment_start(pkt) -
+		sizeof(struct net_ipv6_frag_hdr);
+}
 
-	NET_DBG("pkt %p offset %u", reass->pkt[0], offset);
+/* Check that the stored fragments form one contiguous packet, so that
+ * the reassembled packet can be delivered as soon as the last hole
+ * fills, whatever the arrival order of the fragments was.
+ */
+static bool fragment_holes_filled(struct net_ipv6_reassembly *reass)
+{
+	uint16_t expected = 0U;
+	int i;
 
-	if (offset != 0U) {
+	if (!reass->total_len) {
+		/* The final fragment has not arrived yet. */
 		return false;
 	}
 
-	for (i = 1; i < NET_IPV6_FRAGMENTS_MAX_PKT; i++) {
-		offset = net_pkt_ipv6_fragment_offset(reass->pkt[i]);
+	for (i = 0; i < NET_IPV6_FRAGMENTS_MAX_PKT && reass->pkt[i]; i++) {
+		struct net_pkt *pkt = reass->pkt[i];
 
-		NET_DBG("pkt %p offset %u prev_len %d", reass->pkt[i],
-			offset, prev_len);
+		NET_DBG("pkt %p offset %u expected %u", pkt,
+			net_pkt_ipv6_fragment_offset(pkt), expected);
 
-		if (prev_len < offset) {
-			/* Something wrong with the offset value */
+		if (net_pkt_ipv6_fragment_offset(pkt) != expected) {
 			return false;
 		}
 
-		prev_len = net_pkt_get_len(reass->pkt[i]);
+		expected += fragment_payload_len(pkt);
 	}
 
-	return true;
+	return expected == reass->total_len;
 }
 
 static int shift_packets(struct net_ipv6_reassembly *reass, int pos)
@@ -436,13 +495,7 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 	int i;
 
 	if (!reassembly_init_done) {
-		/* Static initializing does not work here because of the array
-		 * so we must do it at runtime.
-		 */
-		for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-			k_delayed_work_init(&reassembly[i].timer,
-					    reassembly_timeout);
-		}
+		k_delayed_work_init(&reassembly_timer, reassembly_timeout);
 
 		reassembly_init_done = true;
 	}
@@ -473,44 +526,45 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		reass->pkt[0] = pkt;
 
 		reassembly_info("Reassembly 1st pkt", reass);
+	} else {
+		/* The fragments might come in wrong order so place them
+		 * in reassembly chain in correct order.
+		 */
+		for (i = 0, found = false;
+		     i < NET_IPV6_FRAGMENTS_MAX_PKT; i++) {
+			if (reass->pkt[i]) {
+				if (net_pkt_ipv6_fragment_offset(
+					    reass->pkt[i]) <
+				    net_pkt_ipv6_fragment_offset(pkt)) {
+					continue;
+				}
+
+				/* Make room for this fragment. If there is
+				 * no room, then it will discard the whole
+				 * reassembly.
+				 */
+				if (shift_packets(reass, i)) {
+					break;
+				}
+			}
 
-		/* Wait for more fragments to receive. */
-		goto accept;
-	}
+			NET_DBG("Storing pkt %p to slot %d offset %d",
+				pkt, i, net_pkt_ipv6_fragment_offset(pkt));
+			reass->pkt[i] = pkt;
+			found = true;
 
-	/* The fragments might come in wrong order so place them
-	 * in reassembly chain in correct order.
-	 */
-	for (i = 0, found = false; i < NET_IPV6_FRAGMENTS_MAX_PKT; i++) {
-		if (reass->pkt[i]) {
-			if (net_pkt_ipv6_fragment_offset(reass->pkt[i]) <
-			    net_pkt_ipv6_fragment_offset(pkt)) {
-				continue;
-			}
+			break;
+		}
 
-			/* Make room for this fragment. If there is no room,
-			 * then it will discard the whole reassembly.
+		if (!found) {
+			/* We could not add this fragment into our saved
+			 * fragment list. We must discard the whole packet
+			 * at this point.
 			 */
-			if (shift_packets(reass, i)) {
-				break;
-			}
+			NET_DBG("No slots available for 0x%x", reass->id);
+			net_pkt_unref(pkt);
+			goto drop;
 		}
-
-		NET_DBG("Storing pkt %p to slot %d offset %d",
-			pkt, i, net_pkt_ipv6_fragment_offset(pkt));
-		reass->pkt[i] = pkt;
-		found = true;
-
-		break;
-	}
-
-	if (!found) {
-		/* We could not add this fragment into our saved fragment
-		 * list. We must discard the whole packet at this point.
-		 */
-		NET_DBG("No slots available for 0x%x", reass->id);
-		net_pkt_unref(pkt);
-		goto drop;
 	}
 
 	if (more) {
@@ -524,27 +578,22 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		}
 
 		reassembly_info("Reassembly nth pkt", reass);
+	} else {
+		/* The final fragment tells the total payload length. */
+		reass->total_len = net_pkt_ipv6_fragment_offset(pkt) +
+			fragment_payload_len(pkt);
 
-		NET_DBG("More fragments to be received");
-		goto accept;
+		reassembly_info("Reassembly last pkt", reass);
 	}
 
-	reassembly_info("Reassembly last pkt", reass);
-
-	if (!fragment_verify(reass)) {
-		NET_DBG("Reassembled IPv6 verify failed, dropping id %u",
-			reass->id);
-
-		/* Let the caller release the already inserted pkt */
-		if (i < NET_IPV6_FRAGMENTS_MAX_PKT) {
-			reass->pkt[i] = NULL;
-		}
-
-		net_pkt_unref(pkt);
-		goto drop;
+	if (!fragment_holes_filled(reass)) {
+		NET_DBG("More fragments to be received");
+		goto accept;
 	}
 
-	/* The last fragment received, reassemble the packet */
+	/* All the holes are filled, reassemble and deliver the packet
+	 * right away without waiting for any further fragments.
+	 */
 	reassemble_packet(reass);
 
 accept:
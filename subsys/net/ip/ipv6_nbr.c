@@ -255,13 +255,74 @@ void nbr_print(void)
 #define nbr_print(...)
 #endif
 
+/* Hash index over the neighbor IPv6 addresses so that nbr_lookup()
+ * does not need to scan the whole table for every packet. Neighbors
+ * whose address hashes to the same bucket are chained together via
+ * the hash_next field in net_ipv6_nbr_data. The interface is not part
+ * of the hash because lookups with a NULL interface must also work.
+ */
+#define NBR_HASH_SIZE CONFIG_NET_IPV6_MAX_NEIGHBORS
+
+static int16_t nbr_hash[NBR_HASH_SIZE] = {
+	[0 ... (NBR_HASH_SIZE - 1)] = -1
+};
+
+static uint32_t nbr_hash_mix(uint32_t hash, uint32_t value)
+{
+	return (hash ^ value) * 0x9e3779b1U;
+}
+
+static uint16_t nbr_hash_bucket(const struct in6_addr *addr)
+{
+	uint32_t hash = 0U;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		hash = nbr_hash_mix(hash,
+				    UNALIGNED_GET(&addr->s6_addr32[i]));
+	}
+
+	return hash % NBR_HASH_SIZE;
+}
+
+static int16_t nbr_get_index(struct net_nbr *nbr)
+{
+	return (int16_t)(((uint8_t *)nbr - (uint8_t *)net_neighbor_pool) /
+			 sizeof(net_neighbor_pool[0]));
+}
+
+static void nbr_hash_insert(struct net_nbr *nbr)
+{
+	uint16_t bucket = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+
+	net_ipv6_nbr_data(nbr)->hash_next = nbr_hash[bucket];
+	nbr_hash[bucket] = nbr_get_index(nbr);
+}
+
+static void nbr_hash_remove(struct net_nbr *nbr)
+{
+	uint16_t bucket = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+	int16_t idx = nbr_get_index(nbr);
+	int16_t *prev = &nbr_hash[bucket];
+
+	while (*prev >= 0) {
+		if (*prev == idx) {
+			*prev = net_ipv6_nbr_data(nbr)->hash_next;
+			return;
+		}
+
+		prev = &net_ipv6_nbr_data(get_nbr(*prev))->hash_next;
+	}
+}
+
 static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
-	int i;
+	int16_t i;
 
-	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
+	for (i = nbr_hash[nbr_hash_bucket(addr)]; i >= 0;
+	     i = net_ipv6_nbr_data(get_nbr(i))->hash_next) {
 		struct net_nbr *nbr = get_nbr(i);
 
 		if (!nbr->ref) {
@@ -408,6 +469,7 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+	nbr_hash_insert(nbr);
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
@@ -653,7 +715,7 @@ void net_neighbor_data_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
-	return;
+	nbr_hash_remove(nbr);
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
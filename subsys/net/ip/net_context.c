@@ -58,8 +58,18 @@ static struct net_context contexts[NET_MAX_CONTEXT];
  */
 static struct k_sem contexts_lock;
 
+static bool is_reuseport_set(struct net_context *context)
+{
+#if defined(CONFIG_NET_CONTEXT_REUSEPORT)
+	return context && context->options.reuseport;
+#else
+	return false;
+#endif
+}
+
 #if defined(CONFIG_NET_UDP) || defined(CONFIG_NET_TCP)
-static int check_used_port(enum net_ip_protocol ip_proto,
+static int check_used_port(struct net_context *context,
+			   enum net_ip_protocol ip_proto,
 			   uint16_t local_port,
 			   const struct sockaddr *local_addr)
 
@@ -67,7 +77,8 @@ static int check_used_port(enum net_ip_protocol ip_proto,
 	int i;
 
 	for (i = 0; i < NET_MAX_CONTEXT; i++) {
-		if (!net_context_is_used(&contexts[i])) {
+		if (!net_context_is_used(&contexts[i]) ||
+		    &contexts[i] == context) {
 			continue;
 		}
 
@@ -84,6 +95,11 @@ static int check_used_port(enum net_ip_protocol ip_proto,
 							     sin6_addr,
 				    &((struct sockaddr_in6 *)
 				      local_addr)->sin6_addr)) {
+				if (is_reuseport_set(context) &&
+				    is_reuseport_set(&contexts[i])) {
+					continue;
+				}
+
 				return -EEXIST;
 			}
 		} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
@@ -93,6 +109,11 @@ static int check_used_port(enum net_ip_protocol ip_proto,
 							      sin_addr,
 				    &((struct sockaddr_in *)
 				      local_addr)->sin_addr)) {
+				if (is_reuseport_set(context) &&
+				    is_reuseport_set(&contexts[i])) {
+					continue;
+				}
+
 				return -EEXIST;
 			}
 		}
@@ -112,7 +133,8 @@ static uint16_t find_available_port(struct net_context *context,
 			/* 0 - 1023 ports are reserved */
 			continue;
 		}
-	} while (check_used_port(net_context_get_ip_proto(context),
+	} while (check_used_port(context,
+				 net_context_get_ip_proto(context),
 				 htons(local_port), addr) == -EEXIST);
 
 	return htons(local_port);
@@ -563,8 +585,8 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 		net_sin6_ptr(&context->local)->sin6_family = AF_INET6;
 		net_sin6_ptr(&context->local)->sin6_addr = ptr;
 		if (addr6->sin6_port) {
-			ret = check_used_port(AF_INET6, addr6->sin6_port,
-					      addr);
+			ret = check_used_port(context, AF_INET6,
+					      addr6->sin6_port, addr);
 			if (!ret) {
 				net_sin6_ptr(&context->local)->sin6_port =
 					addr6->sin6_port;
@@ -652,8 +674,8 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 		net_sin_ptr(&context->local)->sin_family = AF_INET;
 		net_sin_ptr(&context->local)->sin_addr = ptr;
 		if (addr4->sin_port) {
-			ret = check_used_port(AF_INET, addr4->sin_port,
-					      addr);
+			ret = check_used_port(context, AF_INET,
+					      addr4->sin_port, addr);
 			if (!ret) {
 				net_sin_ptr(&context->local)->sin_port =
 					addr4->sin_port;
@@ -1192,14 +1214,144 @@ static int get_context_txtime(struct net_context *context,
 #endif
 }
 
+static int get_context_reuseport(struct net_context *context,
+				 void *value, size_t *len)
+{
+#if defined(CONFIG_NET_CONTEXT_REUSEPORT)
+	*((bool *)value) = context->options.reuseport;
+
+	if (len) {
+		*len = sizeof(bool);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int get_context_raw_filter(struct net_context *context,
+				  void *value, size_t *len)
+{
+#if defined(CONFIG_NET_RAW_FILTER)
+	if (!value || !len) {
+		return -EINVAL;
+	}
+
+	if (*len < sizeof(struct net_raw_filter)) {
+		return -EINVAL;
+	}
+
+	*len = sizeof(struct net_raw_filter);
+
+	memcpy(value, &context->options.raw_filter, *len);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 /* If buf is not NULL, then use it. Otherwise read the data to be written
  * to net_pkt from msghdr.
  */
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+static void zc_buf_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_FIXED_DEFINE(zc_tx_pool, CONFIG_NET_CONTEXT_ZEROCOPY_BUF_COUNT,
+			  0, zc_buf_destroy);
+
+/* Tracks which completion semaphore belongs to which pinned buffer.
+ * Sized like the pool so a free slot always exists when an allocation
+ * succeeded.
+ */
+static struct {
+	struct net_buf *buf;
+	struct k_sem *done;
+} zc_pending[CONFIG_NET_CONTEXT_ZEROCOPY_BUF_COUNT];
+static struct k_spinlock zc_lock;
+
+static void zc_buf_destroy(struct net_buf *buf)
+{
+	struct k_sem *done = NULL;
+	k_spinlock_key_t key;
+	int i;
+
+	key = k_spin_lock(&zc_lock);
+
+	for (i = 0; i < ARRAY_SIZE(zc_pending); i++) {
+		if (zc_pending[i].buf == buf) {
+			done = zc_pending[i].done;
+			zc_pending[i].buf = NULL;
+			break;
+		}
+	}
+
+	k_spin_unlock(&zc_lock, key);
+
+	net_buf_destroy(buf);
+
+	/* The stack does not reference the caller's buffer anymore. */
+	if (done) {
+		k_sem_give(done);
+	}
+}
+
+static int context_append_zc_data(struct net_pkt *pkt, const void *buf,
+				  size_t len, struct k_sem *zc_done,
+				  k_timeout_t timeout)
+{
+	struct net_buf *zc_buf;
+	k_spinlock_key_t key;
+	int i;
+
+	zc_buf = net_buf_alloc_with_data(&zc_tx_pool, (void *)buf, len,
+					 timeout);
+	if (!zc_buf) {
+		return -ENOBUFS;
+	}
+
+	key = k_spin_lock(&zc_lock);
+
+	for (i = 0; i < ARRAY_SIZE(zc_pending); i++) {
+		if (zc_pending[i].buf == NULL) {
+			zc_pending[i].buf = zc_buf;
+			zc_pending[i].done = zc_done;
+			break;
+		}
+	}
+
+	k_spin_unlock(&zc_lock, key);
+
+	net_pkt_append_buffer(pkt, zc_buf);
+
+	return 0;
+}
+#else
+static int context_append_zc_data(struct net_pkt *pkt, const void *buf,
+				  size_t len, struct k_sem *zc_done,
+				  k_timeout_t timeout)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(len);
+	ARG_UNUSED(zc_done);
+	ARG_UNUSED(timeout);
+
+	return -ENOTSUP;
+}
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 static int context_write_data(struct net_pkt *pkt, const void *buf,
-			      int buf_len, const struct msghdr *msghdr)
+			      int buf_len, const struct msghdr *msghdr,
+			      net_pkt_fill_cb_t fill_cb, void *fill_arg)
 {
 	int ret = 0;
 
+	if (fill_cb) {
+		return net_pkt_write_cb(pkt, fill_cb, fill_arg, buf_len);
+	}
+
 	if (msghdr) {
 		int i;
 
@@ -1223,7 +1375,10 @@ static int context_setup_udp_packet(struct net_context *context,
 				    size_t len,
 				    const struct msghdr *msg,
 				    const struct sockaddr *dst_addr,
-				    socklen_t addrlen)
+				    socklen_t addrlen,
+				    net_pkt_fill_cb_t fill_cb,
+				    void *fill_arg,
+				    struct k_sem *zc_done)
 {
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
@@ -1263,7 +1418,14 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
+	if (zc_done) {
+		ret = context_append_zc_data(pkt, buf, len, zc_done,
+					     PKT_WAIT_TIME);
+	} else {
+		ret = context_write_data(pkt, buf, len, msg,
+					 fill_cb, fill_arg);
+	}
+
 	if (ret) {
 		return ret;
 	}
@@ -1351,7 +1513,10 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  net_pkt_fill_cb_t fill_cb,
+			  void *fill_arg,
+			  struct k_sem *zc_done)
 {
 	const struct msghdr *msghdr = NULL;
 	struct net_pkt *pkt;
@@ -1528,15 +1693,21 @@ static int context_sendto(struct net_context *context,
 		}
 	}
 
-	pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	/* A pinned (zero-copy) payload does not live in the packet
+	 * buffer, so only allocate room for the protocol headers and
+	 * do not clamp the length to the allocated buffer space.
+	 */
+	pkt = context_alloc_pkt(context, zc_done ? 0 : len, PKT_WAIT_TIME);
 	if (!pkt) {
 		return -ENOBUFS;
 	}
 
-	tmp_len = net_pkt_available_payload_buffer(
-				pkt, net_context_get_ip_proto(context));
-	if (tmp_len < len) {
-		len = tmp_len;
+	if (!zc_done) {
+		tmp_len = net_pkt_available_payload_buffer(
+					pkt, net_context_get_ip_proto(context));
+		if (tmp_len < len) {
+			len = tmp_len;
+		}
 	}
 
 	context->send_cb = cb;
@@ -1595,7 +1766,13 @@ static int context_sendto(struct net_context *context,
 
 	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
 	    net_if_is_ip_offloaded(net_context_get_iface(context))) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		if (zc_done) {
+			ret = -ENOTSUP;
+			goto fail;
+		}
+
+		ret = context_write_data(pkt, buf, len, msghdr,
+					 fill_cb, fill_arg);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1613,7 +1790,8 @@ static int context_sendto(struct net_context *context,
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_ip_proto(context) == IPPROTO_UDP) {
 		ret = context_setup_udp_packet(context, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+					       dst_addr, addrlen,
+					       fill_cb, fill_arg, zc_done);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1623,8 +1801,17 @@ static int context_sendto(struct net_context *context,
 		ret = net_send_data(pkt);
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_ip_proto(context) == IPPROTO_TCP) {
+		/* TCP may reference the data long after this call for
+		 * retransmissions, so pinning the caller's buffer for
+		 * the duration of the call is not enough.
+		 */
+		if (zc_done) {
+			ret = -ENOTSUP;
+			goto fail;
+		}
 
-		ret = context_write_data(pkt, buf, len, msghdr);
+		ret = context_write_data(pkt, buf, len, msghdr,
+					 fill_cb, fill_arg);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1638,7 +1825,14 @@ static int context_sendto(struct net_context *context,
 		ret = net_tcp_send_data(context, cb, user_data);
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) &&
 		   net_context_get_family(context) == AF_PACKET) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		if (zc_done) {
+			ret = context_append_zc_data(pkt, buf, len, zc_done,
+						     PKT_WAIT_TIME);
+		} else {
+			ret = context_write_data(pkt, buf, len, msghdr,
+						 fill_cb, fill_arg);
+		}
+
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1649,7 +1843,14 @@ static int context_sendto(struct net_context *context,
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) &&
 		   net_context_get_family(context) == AF_CAN &&
 		   net_context_get_ip_proto(context) == CAN_RAW) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		if (zc_done) {
+			ret = context_append_zc_data(pkt, buf, len, zc_done,
+						     PKT_WAIT_TIME);
+		} else {
+			ret = context_write_data(pkt, buf, len, msghdr,
+						 fill_cb, fill_arg);
+		}
+
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1710,7 +1911,8 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false,
+			     NULL, NULL, NULL);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -1729,7 +1931,8 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true,
+			     NULL, NULL, NULL);
 
 	k_mutex_unlock(&context->lock);
 
@@ -1750,13 +1953,145 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true,
+			     NULL, NULL, NULL);
 
 	k_mutex_unlock(&context->lock);
 
 	return ret;
 }
 
+int net_context_sendfill(struct net_context *context,
+			 net_context_fill_cb_t fill_cb,
+			 void *fill_data,
+			 size_t len,
+			 net_context_send_cb_t cb,
+			 k_timeout_t timeout,
+			 void *user_data)
+{
+	socklen_t addrlen;
+	int ret = 0;
+
+	if (!fill_cb) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+	    !net_sin(&context->remote)->sin_port) {
+		ret = -EDESTADDRREQ;
+		goto unlock;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    net_context_get_family(context) == AF_INET6) {
+		addrlen = sizeof(struct sockaddr_in6);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_context_get_family(context) == AF_INET) {
+		addrlen = sizeof(struct sockaddr_in);
+	} else {
+		ret = -EOPNOTSUPP;
+		goto unlock;
+	}
+
+	ret = context_sendto(context, NULL, len, &context->remote,
+			     addrlen, cb, timeout, user_data, false,
+			     fill_cb, fill_data, NULL);
+unlock:
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+int net_context_send_zerocopy(struct net_context *context,
+			      const void *buf,
+			      size_t len,
+			      net_context_send_cb_t cb,
+			      k_timeout_t timeout,
+			      void *user_data)
+{
+	struct k_sem zc_done;
+	socklen_t addrlen;
+	int ret = 0;
+
+	k_sem_init(&zc_done, 0, 1);
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+	    !net_sin(&context->remote)->sin_port) {
+		ret = -EDESTADDRREQ;
+		goto unlock;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    net_context_get_family(context) == AF_INET6) {
+		addrlen = sizeof(struct sockaddr_in6);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_context_get_family(context) == AF_INET) {
+		addrlen = sizeof(struct sockaddr_in);
+	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) &&
+		   net_context_get_family(context) == AF_PACKET) {
+		ret = -EOPNOTSUPP;
+		goto unlock;
+	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) &&
+		   net_context_get_family(context) == AF_CAN) {
+		addrlen = sizeof(struct sockaddr_can);
+	} else {
+		addrlen = 0;
+	}
+
+	ret = context_sendto(context, buf, len, &context->remote,
+			     addrlen, cb, timeout, user_data, false,
+			     NULL, NULL, &zc_done);
+unlock:
+	k_mutex_unlock(&context->lock);
+
+	if (ret >= 0) {
+		k_sem_take(&zc_done, K_FOREVER);
+	}
+
+	return ret;
+}
+
+int net_context_sendto_zerocopy(struct net_context *context,
+				const void *buf,
+				size_t len,
+				const struct sockaddr *dst_addr,
+				socklen_t addrlen,
+				net_context_send_cb_t cb,
+				k_timeout_t timeout,
+				void *user_data)
+{
+	struct k_sem zc_done;
+	int ret;
+
+	k_sem_init(&zc_done, 0, 1);
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	ret = context_sendto(context, buf, len, dst_addr, addrlen,
+			     cb, timeout, user_data, true,
+			     NULL, NULL, &zc_done);
+
+	k_mutex_unlock(&context->lock);
+
+	/* The pinned buffer is released (and the semaphore given) when
+	 * the stack frees the packet; wait for it so the caller can
+	 * safely reuse the buffer on return. On error the packet was
+	 * already freed, either before or after pinning, and in the
+	 * latter case the semaphore was given as well.
+	 */
+	if (ret >= 0) {
+		k_sem_take(&zc_done, K_FOREVER);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 enum net_verdict net_context_packet_received(struct net_conn *conn,
 					     struct net_pkt *pkt,
 					     union net_ip_header *ip_hdr,
@@ -1862,6 +2197,12 @@ static int recv_udp(struct net_context *context,
 				user_data,
 				&context->conn_handler);
 
+#if defined(CONFIG_NET_CONTEXT_REUSEPORT)
+	if (ret == 0 && context->options.reuseport) {
+		(void)net_conn_set_reuseport(context->conn_handler, true);
+	}
+#endif
+
 	return ret;
 }
 #else
@@ -1929,6 +2270,16 @@ static int recv_raw(struct net_context *context,
 				user_data,
 				&context->conn_handler);
 
+#if defined(CONFIG_NET_RAW_FILTER)
+	if (ret == 0) {
+		/* Attach a filter that was set before the socket
+		 * started to receive.
+		 */
+		(void)net_conn_set_raw_filter(context->conn_handler,
+					      &context->options.raw_filter);
+	}
+#endif
+
 	return ret;
 }
 
@@ -2100,6 +2451,66 @@ static int set_context_txtime(struct net_context *context,
 #endif
 }
 
+static int set_context_reuseport(struct net_context *context,
+				 const void *value, size_t len)
+{
+#if defined(CONFIG_NET_CONTEXT_REUSEPORT)
+	if (len > sizeof(bool)) {
+		return -EINVAL;
+	}
+
+	context->options.reuseport = *((bool *)value);
+
+	if (context->conn_handler) {
+		(void)net_conn_set_reuseport(context->conn_handler,
+					     context->options.reuseport);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+static int set_context_raw_filter(struct net_context *context,
+				  const void *value, size_t len)
+{
+#if defined(CONFIG_NET_RAW_FILTER)
+	const struct net_raw_filter *filter = value;
+
+	if (net_context_get_family(context) != AF_PACKET) {
+		return -EAFNOSUPPORT;
+	}
+
+	if (len != sizeof(struct net_raw_filter) ||
+	    filter->count > NET_RAW_FILTER_MAX_RULES) {
+		return -EINVAL;
+	}
+
+	/* The connection handler evaluates the filter without taking
+	 * the context lock, so disable the filter while the rules are
+	 * being replaced.
+	 */
+	context->options.raw_filter.count = 0U;
+	compiler_barrier();
+
+	memcpy(context->options.raw_filter.rules, filter->rules,
+	       sizeof(filter->rules));
+	compiler_barrier();
+
+	context->options.raw_filter.count = filter->count;
+
+	if (context->conn_handler) {
+		(void)net_conn_set_raw_filter(context->conn_handler,
+					      &context->options.raw_filter);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 static int set_context_proxy(struct net_context *context,
 			     const void *value, size_t len)
 {
@@ -2150,6 +2561,12 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_SOCKS5:
 		ret = set_context_proxy(context, value, len);
 		break;
+	case NET_OPT_RAW_FILTER:
+		ret = set_context_raw_filter(context, value, len);
+		break;
+	case NET_OPT_REUSEPORT:
+		ret = set_context_reuseport(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -2184,6 +2601,12 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_SOCKS5:
 		ret = get_context_proxy(context, value, len);
 		break;
+	case NET_OPT_RAW_FILTER:
+		ret = get_context_raw_filter(context, value, len);
+		break;
+	case NET_OPT_REUSEPORT:
+		ret = get_context_reuseport(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
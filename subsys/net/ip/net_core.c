@@ -33,6 +33,10 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include <net/lldp.h>
 #endif
 
+#if defined(CONFIG_NET_L2_ETHERNET)
+#include <net/ethernet.h>
+#endif
+
 #include "net_private.h"
 #include "net_shell.h"
 
@@ -355,11 +359,109 @@ static void process_rx_packet(struct k_work *work)
 	net_rx(net_pkt_iface(pkt), pkt);
 }
 
+#if defined(CONFIG_NET_TC_RX_FLOW_STEERING)
+static uint32_t rx_flow_mix(uint32_t hash, uint32_t value)
+{
+	return (hash ^ value) * 0x9e3779b1U;
+}
+
+/* Hash the IP addresses, the protocol and, when present in the first
+ * fragment, the transport ports of a received packet so that all the
+ * packets of one flow map to the same Rx traffic class. Returns a
+ * negative value if the packet cannot be classified, in which case the
+ * caller falls back to the priority based mapping.
+ */
+static int rx_flow_classify(struct net_if *iface, struct net_pkt *pkt)
+{
+	uint8_t *data = pkt->frags->data;
+	size_t len = pkt->frags->len;
+	uint32_t hash = 0U;
+	bool first_frag;
+	size_t hdr_len;
+	uint8_t proto;
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		struct net_eth_hdr *eth = (struct net_eth_hdr *)data;
+		uint16_t ptype;
+
+		if (len < sizeof(struct net_eth_hdr)) {
+			return -EMSGSIZE;
+		}
+
+		ptype = ntohs(eth->type);
+		if (ptype != NET_ETH_PTYPE_IP && ptype != NET_ETH_PTYPE_IPV6) {
+			return -EPROTONOSUPPORT;
+		}
+
+		data += sizeof(struct net_eth_hdr);
+		len -= sizeof(struct net_eth_hdr);
+	}
+#else
+	ARG_UNUSED(iface);
+#endif
+
+	if (len < NET_IPV4H_LEN) {
+		return -EMSGSIZE;
+	}
+
+	switch (data[0] >> 4) {
+	case 4:
+		hdr_len = (data[0] & 0x0f) * 4U;
+		proto = data[9];
+
+		hash = rx_flow_mix(hash, UNALIGNED_GET((uint32_t *)&data[12]));
+		hash = rx_flow_mix(hash, UNALIGNED_GET((uint32_t *)&data[16]));
+
+		first_frag = (data[6] & 0x1f) == 0U && data[7] == 0U;
+		break;
+	case 6:
+		if (len < NET_IPV6H_LEN) {
+			return -EMSGSIZE;
+		}
+
+		hdr_len = NET_IPV6H_LEN;
+		proto = data[6];
+
+		for (int i = 0; i < 8; i++) {
+			hash = rx_flow_mix(hash,
+				UNALIGNED_GET((uint32_t *)&data[8 + i * 4]));
+		}
+
+		/* If extension headers are present, the next header is not
+		 * UDP or TCP and we hash on the addresses only.
+		 */
+		first_frag = true;
+		break;
+	default:
+		return -EPROTONOSUPPORT;
+	}
+
+	hash = rx_flow_mix(hash, proto);
+
+	if (first_frag && (proto == IPPROTO_UDP || proto == IPPROTO_TCP) &&
+	    len >= hdr_len + 2 * sizeof(uint16_t)) {
+		hash = rx_flow_mix(hash,
+				   UNALIGNED_GET((uint32_t *)&data[hdr_len]));
+	}
+
+	return hash % NET_TC_RX_COUNT;
+}
+#endif /* CONFIG_NET_TC_RX_FLOW_STEERING */
+
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 {
 	uint8_t prio = net_pkt_priority(pkt);
 	uint8_t tc = net_rx_priority2tc(prio);
 
+#if defined(CONFIG_NET_TC_RX_FLOW_STEERING)
+	int flow_tc = rx_flow_classify(iface, pkt);
+
+	if (flow_tc >= 0) {
+		tc = flow_tc;
+	}
+#endif
+
 	k_work_init(net_pkt_work(pkt), process_rx_packet);
 
 #if defined(CONFIG_NET_STATISTICS)
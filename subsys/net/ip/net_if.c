@@ -344,6 +344,59 @@ static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 	return true;
 }
 
+#if defined(CONFIG_NET_TX_BATCH)
+/* Per traffic class burst of prepared Tx packets waiting for one
+ * driver call. Each buffer is only ever touched by its own Tx work
+ * queue thread, so no locking is needed.
+ */
+struct net_tx_batch {
+	struct net_if *iface;
+	int count;
+	struct net_pkt *pkts[CONFIG_NET_TX_BATCH_PKT_COUNT];
+	struct net_context *contexts[CONFIG_NET_TX_BATCH_PKT_COUNT];
+};
+
+static struct net_tx_batch tx_batches[NET_TC_TX_COUNT];
+
+static bool net_if_tx_batch_ok(struct net_if *iface)
+{
+	const struct ethernet_api *api = net_if_get_device(iface)->api;
+
+	/* The burst path skips the per packet bookkeeping done in
+	 * net_if_tx(), so take it only for interfaces whose driver can
+	 * actually chain the packets and when no link callbacks need
+	 * the per packet destination address.
+	 */
+	return net_if_flag_is_set(iface, NET_IF_UP) &&
+		sys_slist_is_empty(&link_callbacks) &&
+		net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET) &&
+		api && api->send_batch;
+}
+
+static void net_if_tx_flush(struct net_tx_batch *batch)
+{
+	int status = net_eth_tx_batch(batch->iface, batch->pkts,
+				      batch->count);
+	int i;
+
+	for (i = 0; i < batch->count; i++) {
+		if (batch->contexts[i]) {
+			NET_DBG("Calling context send cb %p status %d",
+				batch->contexts[i], status);
+
+			net_context_send_cb(batch->contexts[i], status);
+		}
+	}
+
+	if (status > 0) {
+		net_stats_update_bytes_sent(batch->iface, status);
+	}
+
+	batch->count = 0;
+	batch->iface = NULL;
+}
+#endif /* CONFIG_NET_TX_BATCH */
+
 static void process_tx_packet(struct k_work *work)
 {
 	struct net_if *iface;
@@ -355,7 +408,42 @@ static void process_tx_packet(struct k_work *work)
 
 	iface = net_pkt_iface(pkt);
 
+#if defined(CONFIG_NET_TX_BATCH)
+	uint8_t tc = net_tx_priority2tc(net_pkt_priority(pkt));
+	struct net_tx_batch *batch = &tx_batches[tc];
+
+	if (net_if_tx_batch_ok(iface)) {
+		if (batch->count > 0 && batch->iface != iface) {
+			net_if_tx_flush(batch);
+		}
+
+		if (IS_ENABLED(CONFIG_NET_TCP) &&
+		    net_pkt_family(pkt) != AF_UNSPEC) {
+			net_pkt_set_queued(pkt, false);
+		}
+
+		batch->iface = iface;
+		batch->contexts[batch->count] = net_pkt_context(pkt);
+		batch->pkts[batch->count++] = pkt;
+
+		/* Flush once the burst is full or nothing more is
+		 * queued behind us; otherwise the next work item of
+		 * this thread grows the burst further.
+		 */
+		if (batch->count == CONFIG_NET_TX_BATCH_PKT_COUNT ||
+		    net_tc_tx_queue_is_empty(tc)) {
+			net_if_tx_flush(batch);
+		}
+	} else {
+		if (batch->count > 0) {
+			net_if_tx_flush(batch);
+		}
+
+		net_if_tx(iface, pkt);
+	}
+#else
 	net_if_tx(iface, pkt);
+#endif
 
 #if defined(CONFIG_NET_POWER_MANAGEMENT)
 	iface->tx_pending--;
@@ -3454,6 +3542,15 @@ enum net_verdict net_if_recv_data(struct net_if *iface, struct net_pkt *pkt)
 		enum net_verdict verdict;
 		struct net_pkt *new_pkt;
 
+#if defined(CONFIG_NET_RAW_FILTER)
+		/* If a filter is set and the frame does not match it,
+		 * skip the cloning and queuing below.
+		 */
+		if (!net_promisc_mode_accept(pkt)) {
+			return net_if_l2(iface)->recv(iface, pkt);
+		}
+#endif
+
 		/* This protects pkt so that it will not be freed by L2 recv()
 		 */
 		net_pkt_ref(pkt);
@@ -3789,6 +3886,14 @@ void net_if_call_timestamp_cb(struct net_pkt *pkt)
 
 void net_if_add_tx_timestamp(struct net_pkt *pkt)
 {
+	if (IS_ENABLED(CONFIG_NET_PKT_TIMESTAMP_DIRECT) && !k_is_in_isr()) {
+		/* The driver delivered the timestamp from thread context
+		 * so the callbacks can be run without the thread hop.
+		 */
+		net_if_call_timestamp_cb(pkt);
+		return;
+	}
+
 	k_fifo_put(&tx_ts_queue, pkt);
 }
 #endif /* CONFIG_NET_PKT_TIMESTAMP_THREAD */
@@ -19,6 +19,9 @@ LOG_MODULE_REGISTER(net_mgmt, CONFIG_NET_MGMT_EVENT_LOG_LEVEL);
 #include "net_private.h"
 
 struct mgmt_event_entry {
+	/* Sequence tag protecting the entry, see mgmt_push_event() */
+	atomic_t seq;
+
 	uint32_t event;
 	struct net_if *iface;
 
@@ -28,6 +31,15 @@ struct mgmt_event_entry {
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 };
 
+/* A slot is tagged with an odd value while a producer is writing it
+ * and with an even value derived from the event index once the data
+ * is complete. The tags never collide between the two states and are
+ * unique for the whole 31 bit index space, so the consumer can both
+ * wait for the slot it needs and detect that it has been lapped.
+ */
+#define MGMT_EVENT_SEQ_WRITING(idx) ((atomic_val_t)(((idx) << 1) | 1U))
+#define MGMT_EVENT_SEQ_DONE(idx)    ((atomic_val_t)(((idx) + 1U) << 1))
+
 struct mgmt_event_wait {
 	struct k_sem sync_call;
 	struct net_if *iface;
@@ -39,92 +51,108 @@ static K_SEM_DEFINE(net_mgmt_lock, 1, 1);
 K_KERNEL_STACK_DEFINE(mgmt_stack, CONFIG_NET_MGMT_EVENT_STACK_SIZE);
 static struct k_thread mgmt_thread_data;
 static struct mgmt_event_entry events[CONFIG_NET_MGMT_EVENT_QUEUE_SIZE];
+static struct mgmt_event_entry current_event;
 static uint32_t global_event_mask;
 static sys_slist_t event_callbacks;
-static int16_t in_event;
-static int16_t out_event;
 
-static inline void mgmt_push_event(uint32_t mgmt_event, struct net_if *iface,
-				   void *info, size_t length)
+/* Total number of produced events. The producers claim a slot with a
+ * single atomic increment, so notifying an event never blocks and is
+ * safe also from an ISR. The consumer cursor below is only touched by
+ * the mgmt thread.
+ */
+static atomic_t events_in;
+static uint32_t events_out;
+
+static void mgmt_push_event(uint32_t mgmt_event, struct net_if *iface,
+			    void *info, size_t length)
 {
-	int16_t i_idx;
+	struct mgmt_event_entry *entry;
+	uint32_t idx;
 
-#ifndef CONFIG_NET_MGMT_EVENT_INFO
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+	if (info && length > NET_EVENT_INFO_MAX_SIZE) {
+		NET_ERR("Event info length %zu > max size %zu",
+			length, NET_EVENT_INFO_MAX_SIZE);
+		return;
+	}
+#else
 	ARG_UNUSED(info);
 	ARG_UNUSED(length);
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 
-	k_sem_take(&net_mgmt_lock, K_FOREVER);
+	idx = (uint32_t)atomic_inc(&events_in);
+	entry = &events[idx % CONFIG_NET_MGMT_EVENT_QUEUE_SIZE];
 
-	i_idx = in_event + 1;
-	if (i_idx == CONFIG_NET_MGMT_EVENT_QUEUE_SIZE) {
-		i_idx = 0;
-	}
+	/* If the ring is full, the slot of the oldest not yet handled
+	 * event is reused and the consumer will notice the overwrite
+	 * from the sequence tag. A slow listener thus only loses the
+	 * oldest events instead of blocking the producers.
+	 */
+	atomic_set(&entry->seq, MGMT_EVENT_SEQ_WRITING(idx));
+
+	entry->event = mgmt_event;
+	entry->iface = iface;
 
 #ifdef CONFIG_NET_MGMT_EVENT_INFO
 	if (info && length) {
-		if (length <= NET_EVENT_INFO_MAX_SIZE) {
-			memcpy(events[i_idx].info, info, length);
-			events[i_idx].info_length = length;
-		} else {
-			NET_ERR("Event info length %zu > max size %zu",
-				length, NET_EVENT_INFO_MAX_SIZE);
-			k_sem_give(&net_mgmt_lock);
-
-			return;
-		}
+		memcpy(entry->info, info, length);
+		entry->info_length = length;
 	} else {
-		events[i_idx].info_length = 0;
+		entry->info_length = 0;
 	}
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 
-	events[i_idx].event = mgmt_event;
-	events[i_idx].iface = iface;
+	atomic_set(&entry->seq, MGMT_EVENT_SEQ_DONE(idx));
+}
 
-	if (i_idx == out_event) {
-		uint16_t o_idx = out_event + 1;
+static bool mgmt_pop_event(struct mgmt_event_entry *dst)
+{
+	struct mgmt_event_entry *entry;
+	uint32_t in;
 
-		if (o_idx == CONFIG_NET_MGMT_EVENT_QUEUE_SIZE) {
-			o_idx = 0U;
-		}
+	while (true) {
+		in = (uint32_t)atomic_get(&events_in);
 
-		if (events[o_idx].event) {
-			out_event = o_idx;
+		if (events_out == in) {
+			return false;
 		}
-	} else if (out_event < 0) {
-		out_event = i_idx;
-	}
 
-	in_event = i_idx;
+		if ((in - events_out) > CONFIG_NET_MGMT_EVENT_QUEUE_SIZE) {
+			uint32_t lost = in - events_out -
+					CONFIG_NET_MGMT_EVENT_QUEUE_SIZE;
 
-	k_sem_give(&net_mgmt_lock);
-}
+			NET_WARN("Event ring overrun, %u event(s) lost",
+				 lost);
 
-static inline struct mgmt_event_entry *mgmt_pop_event(void)
-{
-	int16_t o_idx;
+			events_out += lost;
+		}
 
-	if (out_event < 0 || !events[out_event].event) {
-		return NULL;
-	}
+		entry = &events[events_out %
+				CONFIG_NET_MGMT_EVENT_QUEUE_SIZE];
 
-	o_idx = out_event;
-	out_event++;
+		if (atomic_get(&entry->seq) !=
+		    MGMT_EVENT_SEQ_DONE(events_out)) {
+			/* The producer of this event has been preempted
+			 * in the middle of the write. It will give the
+			 * semaphore once it is done, try again then.
+			 */
+			return false;
+		}
 
-	if (o_idx == in_event) {
-		in_event = -1;
-		out_event = -1;
-	} else if (out_event == CONFIG_NET_MGMT_EVENT_QUEUE_SIZE) {
-		out_event = 0;
-	}
+		*dst = *entry;
 
-	return &events[o_idx];
-}
+		if (atomic_get(&entry->seq) ==
+		    MGMT_EVENT_SEQ_DONE(events_out)) {
+			events_out++;
+			return true;
+		}
 
-static inline void mgmt_clean_event(struct mgmt_event_entry *mgmt_event)
-{
-	mgmt_event->event = 0U;
-	mgmt_event->iface = NULL;
+		/* A producer lapped the whole ring while we were
+		 * copying, so the data cannot be trusted. Skip the
+		 * entry and retry with a fresh view of the ring.
+		 */
+		events_out++;
+	}
 }
 
 static inline void mgmt_add_event_mask(uint32_t event_mask)
@@ -222,36 +250,26 @@ static inline void mgmt_run_callbacks(struct mgmt_event_entry *mgmt_event)
 
 static void mgmt_thread(void)
 {
-	struct mgmt_event_entry *mgmt_event;
-
 	while (1) {
 		k_sem_take(&network_event, K_FOREVER);
-		k_sem_take(&net_mgmt_lock, K_FOREVER);
 
 		NET_DBG("Handling events, forwarding it relevantly");
 
-		mgmt_event = mgmt_pop_event();
-		if (!mgmt_event) {
-			/* System is over-loaded?
-			 * At this point we have most probably notified
-			 * more events than we could handle
-			 */
-			NET_DBG("Some event got probably lost (%u)",
-				k_sem_count_get(&network_event));
+		/* The semaphore is given once per pushed event so the
+		 * ring cannot starve, but as overwritten events are
+		 * skipped in mgmt_pop_event() there can be more tokens
+		 * than events. The extra wakeups then simply find the
+		 * ring empty.
+		 */
+		while (mgmt_pop_event(&current_event)) {
+			k_sem_take(&net_mgmt_lock, K_FOREVER);
+
+			mgmt_run_callbacks(&current_event);
 
-			k_sem_init(&network_event, 0, UINT_MAX);
 			k_sem_give(&net_mgmt_lock);
 
-			continue;
+			k_yield();
 		}
-
-		mgmt_run_callbacks(mgmt_event);
-
-		mgmt_clean_event(mgmt_event);
-
-		k_sem_give(&net_mgmt_lock);
-
-		k_yield();
 	}
 }
 
@@ -380,8 +398,8 @@ void net_mgmt_event_init(void)
 	sys_slist_init(&event_callbacks);
 	global_event_mask = 0U;
 
-	in_event = -1;
-	out_event = -1;
+	atomic_clear(&events_in);
+	events_out = 0U;
 
 	(void)memset(events, 0, CONFIG_NET_MGMT_EVENT_QUEUE_SIZE *
 			sizeof(struct mgmt_event_entry));
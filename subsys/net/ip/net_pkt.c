@@ -493,6 +493,38 @@ static inline struct net_buf_pool *get_data_pool(struct net_context *context)
 #define get_data_pool(...) NULL
 #endif /* CONFIG_NET_CONTEXT_NET_PKT_POOL */
 
+#if defined(CONFIG_NET_IFACE_NET_PKT_POOL)
+static inline struct net_buf_pool *get_iface_data_pool(struct net_if *iface,
+						       size_t alloc_len)
+{
+	if (!iface) {
+		return NULL;
+	}
+
+	/* Short allocations (TCP ACKs and the like) are served from the
+	 * small pool when they fit its buffers, so that they do not
+	 * consume the full size (MTU sized) buffers.
+	 */
+	if (iface->if_dev->data_pool_small) {
+		struct net_buf_pool *small = iface->if_dev->data_pool_small();
+		const struct net_buf_pool_fixed *fixed =
+			small->alloc->alloc_data;
+
+		if (alloc_len <= fixed->data_size) {
+			return small;
+		}
+	}
+
+	if (iface->if_dev->data_pool) {
+		return iface->if_dev->data_pool();
+	}
+
+	return NULL;
+}
+#else
+#define get_iface_data_pool(iface, alloc_len) NULL
+#endif /* CONFIG_NET_IFACE_NET_PKT_POOL */
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 void net_pkt_unref_debug(struct net_pkt *pkt, const char *caller, int line)
 {
@@ -1138,6 +1170,10 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 		pool = get_data_pool(pkt->context);
 	}
 
+	if (!pool) {
+		pool = get_iface_data_pool(net_pkt_iface(pkt), alloc_len);
+	}
+
 	if (!pool) {
 		pool = pkt->slab == &tx_pkts ? &tx_bufs : &rx_bufs;
 	}
@@ -1623,8 +1659,23 @@ int net_pkt_memset(struct net_pkt *pkt, int byte, size_t amount)
 
 int net_pkt_read(struct net_pkt *pkt, void *data, size_t length)
 {
+	struct net_pkt_cursor *cursor = &pkt->cursor;
+
 	NET_DBG("pkt %p data %p length %zu", pkt, data, length);
 
+	/* Fast path: the requested data lies strictly inside the
+	 * current fragment, so a plain copy is enough and the cursor
+	 * does not need to jump to another fragment.
+	 */
+	if (cursor->buf &&
+	    (size_t)(cursor->buf->len -
+		     (cursor->pos - cursor->buf->data)) > length) {
+		memcpy(data, cursor->pos, length);
+		cursor->pos += length;
+
+		return 0;
+	}
+
 	return net_pkt_cursor_operate(pkt, data, length, true, false);
 }
 
@@ -1666,15 +1717,97 @@ int net_pkt_read_be32(struct net_pkt *pkt, uint32_t *data)
 
 int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length)
 {
+	struct net_pkt_cursor *cursor = &pkt->cursor;
+	bool ow = net_pkt_is_being_overwritten(pkt);
+
 	NET_DBG("pkt %p data %p length %zu", pkt, data, length);
 
 	if (data == pkt->cursor.pos && net_pkt_is_contiguous(pkt, length)) {
 		return net_pkt_skip(pkt, length);
 	}
 
+	/* Fast path: the written data stays strictly inside the
+	 * current fragment. This mirrors one round of the generic
+	 * loop below for the common single fragment case.
+	 */
+	if (cursor->buf &&
+	    (size_t)((ow ? cursor->buf->len : cursor->buf->size) -
+		     (cursor->pos - cursor->buf->data)) > length) {
+		memcpy(cursor->pos, data, length);
+
+		if (!ow) {
+			net_buf_add(cursor->buf, length);
+		}
+
+		cursor->pos += length;
+
+		return 0;
+	}
+
 	return net_pkt_cursor_operate(pkt, (void *)data, length, true, true);
 }
 
+int net_pkt_write_cb(struct net_pkt *pkt, net_pkt_fill_cb_t cb,
+		     void *cb_arg, size_t length)
+{
+	/* Write counterpart of net_pkt_cursor_operate(): the data for
+	 * each contiguous chunk is produced by the callback directly
+	 * into the packet buffer.
+	 */
+	struct net_pkt_cursor *c_op = &pkt->cursor;
+	size_t offset = 0U;
+	int ret;
+
+	NET_DBG("pkt %p cb %p length %zu", pkt, cb, length);
+
+	while (c_op->buf && length) {
+		size_t d_len, len;
+
+		pkt_cursor_advance(pkt, net_pkt_is_being_overwritten(pkt) ?
+				   false : true);
+		if (c_op->buf == NULL) {
+			break;
+		}
+
+		if (!net_pkt_is_being_overwritten(pkt)) {
+			d_len = c_op->buf->size - (c_op->pos - c_op->buf->data);
+		} else {
+			d_len = c_op->buf->len - (c_op->pos - c_op->buf->data);
+		}
+
+		if (!d_len) {
+			break;
+		}
+
+		if (length < d_len) {
+			len = length;
+		} else {
+			len = d_len;
+		}
+
+		ret = cb(c_op->pos, len, offset, cb_arg);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (!net_pkt_is_being_overwritten(pkt)) {
+			net_buf_add(c_op->buf, len);
+		}
+
+		pkt_cursor_update(pkt, len, true);
+
+		offset += len;
+		length -= len;
+	}
+
+	if (length) {
+		NET_DBG("Still some length to go %zu", length);
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+
 int net_pkt_copy(struct net_pkt *pkt_dst,
 		 struct net_pkt *pkt_src,
 		 size_t length)
@@ -1972,6 +2105,15 @@ bool net_pkt_is_contiguous(struct net_pkt *pkt, size_t size)
 	return false;
 }
 
+void *net_pkt_get_contiguous(struct net_pkt *pkt, size_t size)
+{
+	if (net_pkt_is_contiguous(pkt, size)) {
+		return pkt->cursor.pos;
+	}
+
+	return NULL;
+}
+
 void *net_pkt_get_data(struct net_pkt *pkt,
 		       struct net_pkt_data_access *access)
 {
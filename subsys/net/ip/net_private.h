@@ -84,8 +84,16 @@ static inline enum net_verdict net_ipv6_input(struct net_pkt *pkt,
 #endif
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
 extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+extern bool net_tc_tx_queue_is_empty(uint8_t tc);
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
+#if defined(CONFIG_NET_RAW_FILTER)
+struct net_raw_filter;
+extern bool net_raw_filter_ok(const struct net_raw_filter *filter,
+			      struct net_pkt *pkt);
+extern bool net_promisc_mode_accept(struct net_pkt *pkt);
+#endif
+
 char *net_sprint_addr(sa_family_t af, const void *addr);
 
 #define net_sprint_ipv4_addr(_addr) net_sprint_addr(AF_INET, _addr)
@@ -1042,6 +1042,10 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	struct net_shell_user_data *data = user_data;
 	const struct shell *shell = data->shell;
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+	net_stats_aggregate();
+#endif
+
 	if (iface) {
 		const char *extra;
 
@@ -1409,7 +1413,7 @@ static void ipv6_frag_cb(struct net_ipv6_reassembly *reass,
 
 	PR("%p      0x%08x  %5d %16s\t%16s\n",
 	   reass, reass->id,
-	   k_delayed_work_remaining_get(&reass->timer),
+	   (int32_t)(reass->deadline - k_uptime_get_32()),
 	   src, net_sprint_ipv6_addr(&reass->dst));
 
 	for (i = 0; i < NET_IPV6_FRAGMENTS_MAX_PKT; i++) {
@@ -2851,21 +2855,23 @@ static int cmd_net_mem(const struct shell *shell, size_t argc, char *argv[])
 	PR("Network buffer pools:\n");
 
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
-	PR("Address\t\tTotal\tAvail\tName\n");
+	PR("Address\t\tTotal\tAvail\tMax\tName\n");
 
-	PR("%p\t%d\t%u\tRX\n",
-	       rx, rx->num_blocks, k_mem_slab_num_free_get(rx));
+	PR("%p\t%d\t%u\t%u\tRX\n",
+	       rx, rx->num_blocks, k_mem_slab_num_free_get(rx),
+	       k_mem_slab_max_used_get(rx));
 
-	PR("%p\t%d\t%u\tTX\n",
-	       tx, tx->num_blocks, k_mem_slab_num_free_get(tx));
+	PR("%p\t%d\t%u\t%u\tTX\n",
+	       tx, tx->num_blocks, k_mem_slab_num_free_get(tx),
+	       k_mem_slab_max_used_get(tx));
 
-	PR("%p\t%d\t%d\tRX DATA (%s)\n",
+	PR("%p\t%d\t%d\t%d\tRX DATA (%s)\n",
 	       rx_data, rx_data->buf_count,
-	       rx_data->avail_count, rx_data->name);
+	       rx_data->avail_count, rx_data->max_used, rx_data->name);
 
-	PR("%p\t%d\t%d\tTX DATA (%s)\n",
+	PR("%p\t%d\t%d\t%d\tTX DATA (%s)\n",
 	       tx_data, tx_data->buf_count,
-	       tx_data->avail_count, tx_data->name);
+	       tx_data->avail_count, tx_data->max_used, tx_data->name);
 #else
 	PR("Address\t\tTotal\tName\n");
 
@@ -3735,6 +3741,400 @@ static int cmd_net_stats(const struct shell *shell, size_t argc, char *argv[])
 	return 0;
 }
 
+#if defined(CONFIG_NET_STATISTICS) && defined(CONFIG_NET_NATIVE)
+/* Periodic performance snapshots for "net monitor".  A delayed work
+ * item samples the cumulative statistics into a small ring so that
+ * the shell can print rates (deltas between consecutive samples)
+ * instead of the raw counters that "net stats" shows, which would
+ * otherwise have to be diffed by hand.
+ */
+#define MONITOR_SAMPLES 8
+#define MONITOR_MAX_IFACES 8
+#define MONITOR_MIN_PERIOD 100 /* ms */
+
+struct monitor_iface_sample {
+	struct net_if *iface;
+	uint32_t bytes_recv;
+	uint32_t bytes_sent;
+	uint32_t pkts_recv;
+	uint32_t pkts_sent;
+};
+
+struct monitor_sample {
+	uint32_t uptime; /* ms */
+	int iface_count;
+	struct monitor_iface_sample ifaces[MONITOR_MAX_IFACES];
+#if defined(CONFIG_NET_STATISTICS_TCP)
+	uint32_t tcp_resent;
+#endif
+#if NET_TC_COUNT > 1
+	uint32_t tc_sent[NET_TC_TX_COUNT];
+#endif
+	uint32_t rx_pkt_used;
+	uint32_t tx_pkt_used;
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	int16_t rx_data_used;
+	int16_t tx_data_used;
+#endif
+};
+
+static struct monitor_sample monitor_ring[MONITOR_SAMPLES];
+static int monitor_next;
+static int monitor_ring_count;
+static struct k_delayed_work monitor_work;
+static uint32_t monitor_period; /* ms */
+static bool monitor_running;
+
+static uint32_t monitor_ip_pkts(struct net_if *iface, bool is_tx)
+{
+	uint32_t pkts = 0U;
+
+#if defined(CONFIG_NET_STATISTICS_IPV4)
+	pkts += is_tx ? GET_STAT(iface, ipv4.sent) : GET_STAT(iface, ipv4.recv);
+#endif
+#if defined(CONFIG_NET_STATISTICS_IPV6)
+	pkts += is_tx ? GET_STAT(iface, ipv6.sent) : GET_STAT(iface, ipv6.recv);
+#endif
+
+	return pkts;
+}
+
+static void monitor_iface_cb(struct net_if *iface, void *user_data)
+{
+	struct monitor_sample *sample = user_data;
+	struct monitor_iface_sample *ifs;
+
+	if (sample->iface_count >= MONITOR_MAX_IFACES) {
+		return;
+	}
+
+	ifs = &sample->ifaces[sample->iface_count++];
+
+	ifs->iface = iface;
+	ifs->bytes_recv = GET_STAT(iface, bytes.received);
+	ifs->bytes_sent = GET_STAT(iface, bytes.sent);
+	ifs->pkts_recv = monitor_ip_pkts(iface, false);
+	ifs->pkts_sent = monitor_ip_pkts(iface, true);
+}
+
+static void monitor_sample_take(void)
+{
+	struct monitor_sample *sample = &monitor_ring[monitor_next];
+	struct net_buf_pool *rx_data, *tx_data;
+	struct net_if *iface = NULL;
+	struct k_mem_slab *rx, *tx;
+
+	net_stats_aggregate();
+
+	(void)memset(sample, 0, sizeof(*sample));
+
+	sample->uptime = k_uptime_get_32();
+
+#if defined(CONFIG_NET_STATISTICS_PER_INTERFACE)
+	net_if_foreach(monitor_iface_cb, sample);
+#else
+	/* Without per-interface statistics there is only the global
+	 * set of counters, shown as a single row.
+	 */
+	monitor_iface_cb(iface, sample);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_TCP)
+	sample->tcp_resent = GET_STAT(iface, tcp.resent);
+#endif
+
+#if NET_TC_COUNT > 1
+	for (int i = 0; i < NET_TC_TX_COUNT; i++) {
+		sample->tc_sent[i] = GET_STAT(iface, tc.sent[i].pkts);
+	}
+#endif
+
+	net_pkt_get_info(&rx, &tx, &rx_data, &tx_data);
+
+	sample->rx_pkt_used = rx->num_blocks - k_mem_slab_num_free_get(rx);
+	sample->tx_pkt_used = tx->num_blocks - k_mem_slab_num_free_get(tx);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	sample->rx_data_used = rx_data->buf_count - rx_data->avail_count;
+	sample->tx_data_used = tx_data->buf_count - tx_data->avail_count;
+#endif
+
+	monitor_next = (monitor_next + 1) % MONITOR_SAMPLES;
+	if (monitor_ring_count < MONITOR_SAMPLES) {
+		monitor_ring_count++;
+	}
+}
+
+static void monitor_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	monitor_sample_take();
+
+	k_delayed_work_submit(&monitor_work, K_MSEC(monitor_period));
+}
+
+static struct monitor_sample *monitor_get_sample(int age)
+{
+	return &monitor_ring[(monitor_next + MONITOR_SAMPLES - 1 - age) %
+			     MONITOR_SAMPLES];
+}
+
+/* Sum of per-interface deltas between two samples; interfaces are
+ * matched by position so a changed interface set simply contributes
+ * nothing for the mismatching slots.
+ */
+static void monitor_sum_rates(struct monitor_sample *old,
+			      struct monitor_sample *cur,
+			      uint32_t *pkts_recv, uint32_t *pkts_sent,
+			      uint32_t *bytes_recv, uint32_t *bytes_sent)
+{
+	int i;
+
+	*pkts_recv = *pkts_sent = *bytes_recv = *bytes_sent = 0U;
+
+	for (i = 0; i < cur->iface_count && i < old->iface_count; i++) {
+		if (cur->ifaces[i].iface != old->ifaces[i].iface) {
+			continue;
+		}
+
+		*pkts_recv += cur->ifaces[i].pkts_recv -
+			old->ifaces[i].pkts_recv;
+		*pkts_sent += cur->ifaces[i].pkts_sent -
+			old->ifaces[i].pkts_sent;
+		*bytes_recv += cur->ifaces[i].bytes_recv -
+			old->ifaces[i].bytes_recv;
+		*bytes_sent += cur->ifaces[i].bytes_sent -
+			old->ifaces[i].bytes_sent;
+	}
+}
+
+static void monitor_print_rates(const struct shell *shell)
+{
+	struct monitor_sample *cur = monitor_get_sample(0);
+	struct monitor_sample *old = monitor_get_sample(1);
+	struct net_buf_pool *rx_data, *tx_data;
+	struct k_mem_slab *rx, *tx;
+	uint32_t dt;
+	int i;
+
+	dt = cur->uptime - old->uptime;
+	if (dt == 0U) {
+		return;
+	}
+
+	PR("Rates over the last %u ms:\n", dt);
+	PR("Iface\tRX pps\tTX pps\tRX kbit/s\tTX kbit/s\n");
+
+	for (i = 0; i < cur->iface_count; i++) {
+		struct monitor_iface_sample *c = &cur->ifaces[i];
+		struct monitor_iface_sample *o = &old->ifaces[i];
+
+		if (i >= old->iface_count || c->iface != o->iface) {
+			continue;
+		}
+
+		PR("%5d\t%6u\t%6u\t%9u\t%9u\n",
+		   c->iface ? net_if_get_by_iface(c->iface) : 0,
+		   (c->pkts_recv - o->pkts_recv) * 1000U / dt,
+		   (c->pkts_sent - o->pkts_sent) * 1000U / dt,
+		   (c->bytes_recv - o->bytes_recv) * 8U / dt,
+		   (c->bytes_sent - o->bytes_sent) * 8U / dt);
+	}
+
+#if NET_TC_COUNT > 1
+	PR("TX pkts/s per traffic class:");
+	for (i = 0; i < NET_TC_TX_COUNT; i++) {
+		PR(" [%d]=%u", i,
+		   (cur->tc_sent[i] - old->tc_sent[i]) * 1000U / dt);
+	}
+	PR("\n");
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_TCP)
+	PR("TCP segments retransmitted: %u (+%u)\n", cur->tcp_resent,
+	   cur->tcp_resent - old->tcp_resent);
+#endif
+
+	net_pkt_get_info(&rx, &tx, &rx_data, &tx_data);
+
+	PR("Pool\t\tUsed\tMax\n");
+	PR("RX\t\t%u/%u\t%u\n", cur->rx_pkt_used, rx->num_blocks,
+	   k_mem_slab_max_used_get(rx));
+	PR("TX\t\t%u/%u\t%u\n", cur->tx_pkt_used, tx->num_blocks,
+	   k_mem_slab_max_used_get(tx));
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	PR("RX DATA\t\t%d/%d\t%d\n", cur->rx_data_used, rx_data->buf_count,
+	   rx_data->max_used);
+	PR("TX DATA\t\t%d/%d\t%d\n", cur->tx_data_used, tx_data->buf_count,
+	   tx_data->max_used);
+#endif
+}
+
+static void monitor_print_history(const struct shell *shell)
+{
+	uint32_t now = k_uptime_get_32();
+	int i;
+
+	PR("\nHistory (newest first):\n");
+	PR("Age ms\tRX pps\tTX pps\tRX kbit/s\tTX kbit/s\tRX buf\tTX buf\n");
+
+	for (i = 0; i < monitor_ring_count - 1; i++) {
+		struct monitor_sample *cur = monitor_get_sample(i);
+		struct monitor_sample *old = monitor_get_sample(i + 1);
+		uint32_t pkts_recv, pkts_sent, bytes_recv, bytes_sent;
+		uint32_t dt = cur->uptime - old->uptime;
+
+		if (dt == 0U) {
+			continue;
+		}
+
+		monitor_sum_rates(old, cur, &pkts_recv, &pkts_sent,
+				  &bytes_recv, &bytes_sent);
+
+		PR("%6u\t%6u\t%6u\t%9u\t%9u\t%6u\t%6u\n",
+		   now - cur->uptime,
+		   pkts_recv * 1000U / dt, pkts_sent * 1000U / dt,
+		   bytes_recv * 8U / dt, bytes_sent * 8U / dt,
+		   cur->rx_pkt_used, cur->tx_pkt_used);
+	}
+}
+
+#if defined(CONFIG_NET_TCP1) && \
+	(defined(CONFIG_NET_OFFLOAD) || defined(CONFIG_NET_NATIVE))
+static void monitor_tcp_cb(struct net_tcp *tcp, void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *shell = data->shell;
+	int *count = data->user_data;
+
+	if (!*count) {
+		PR("\nTCP\t\tState\t\tIn-flight\tBackoff\n");
+	}
+
+	PR("%p\t%-11s\t%9u\t%7u\n", tcp,
+	   net_tcp_state_str(net_tcp_get_state(tcp)),
+	   tcp->send_seq - tcp->send_ack,
+	   tcp->retry_timeout_shift);
+
+	(*count)++;
+}
+#endif
+#endif /* CONFIG_NET_STATISTICS && CONFIG_NET_NATIVE */
+
+static int cmd_net_monitor_start(const struct shell *shell, size_t argc,
+				 char *argv[])
+{
+#if defined(CONFIG_NET_STATISTICS) && defined(CONFIG_NET_NATIVE)
+	int period = 1000;
+
+	if (argc > 1) {
+		char *endptr;
+
+		period = strtol(argv[1], &endptr, 10);
+		if (*endptr != '\0' || period < MONITOR_MIN_PERIOD) {
+			PR_WARNING("Invalid period %s, minimum is %d ms.\n",
+				   argv[1], MONITOR_MIN_PERIOD);
+			return -ENOEXEC;
+		}
+	}
+
+	if (monitor_running) {
+		PR_WARNING("Monitor is already running, use \"net monitor "
+			   "stop\" first.\n");
+		return -ENOEXEC;
+	}
+
+	monitor_period = period;
+	monitor_next = 0;
+	monitor_ring_count = 0;
+
+	k_delayed_work_init(&monitor_work, monitor_work_handler);
+
+	monitor_sample_take();
+	monitor_running = true;
+
+	k_delayed_work_submit(&monitor_work, K_MSEC(monitor_period));
+
+	PR("Sampling every %u ms, \"net monitor show\" prints the rates.\n",
+	   monitor_period);
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_NET_STATISTICS",
+		"statistics");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_monitor_stop(const struct shell *shell, size_t argc,
+				char *argv[])
+{
+#if defined(CONFIG_NET_STATISTICS) && defined(CONFIG_NET_NATIVE)
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (!monitor_running) {
+		PR_WARNING("Monitor is not running.\n");
+		return -ENOEXEC;
+	}
+
+	k_delayed_work_cancel(&monitor_work);
+	monitor_running = false;
+
+	PR("Monitor stopped, %d sample(s) retained.\n", monitor_ring_count);
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_NET_STATISTICS",
+		"statistics");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_monitor(const struct shell *shell, size_t argc,
+			   char *argv[])
+{
+#if defined(CONFIG_NET_STATISTICS) && defined(CONFIG_NET_NATIVE)
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (monitor_ring_count < 2) {
+		PR_INFO("Not enough samples, use \"net monitor start "
+			"[period ms]\" and wait for at least one period.\n");
+		return 0;
+	}
+
+	monitor_print_rates(shell);
+	monitor_print_history(shell);
+
+#if defined(CONFIG_NET_TCP1) && \
+	(defined(CONFIG_NET_OFFLOAD) || defined(CONFIG_NET_NATIVE))
+	{
+		struct net_shell_user_data user_data;
+		int count = 0;
+
+		user_data.shell = shell;
+		user_data.user_data = &count;
+
+		net_tcp_foreach(monitor_tcp_cb, &user_data);
+	}
+#endif
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_NET_STATISTICS",
+		"statistics");
+#endif
+
+	return 0;
+}
+
 #if defined(CONFIG_NET_TCP) && defined(CONFIG_NET_NATIVE_TCP)
 static struct net_context *tcp_ctx;
 static const struct shell *tcp_shell;
@@ -4735,6 +5135,21 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_vlan,
 	SHELL_SUBCMD_SET_END
 );
 
+SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_monitor,
+	SHELL_CMD(start, NULL,
+		  "'net monitor start [period ms]' starts periodic "
+		  "statistics sampling.",
+		  cmd_net_monitor_start),
+	SHELL_CMD(stop, NULL,
+		  "'net monitor stop' stops the sampling.",
+		  cmd_net_monitor_stop),
+	SHELL_CMD(show, NULL,
+		  "'net monitor show' prints rates computed from the "
+		  "collected samples.",
+		  cmd_net_monitor),
+	SHELL_SUBCMD_SET_END
+);
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_ping,
 	SHELL_CMD(--help, NULL,
 		  "'net ping [-c count] [-i interval ms] [-I <iface index>] <host>' "
@@ -4771,6 +5186,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_commands,
 		  cmd_net_ipv6),
 	SHELL_CMD(mem, NULL, "Print information about network memory usage.",
 		  cmd_net_mem),
+	SHELL_CMD(monitor, &net_cmd_monitor,
+		  "Periodically sample network statistics and show rates.",
+		  cmd_net_monitor),
 	SHELL_CMD(nbr, &net_cmd_nbr, "Print neighbor information.",
 		  cmd_net_nbr),
 	SHELL_CMD(ping, &net_cmd_ping, "Ping a network host.", cmd_net_ping),
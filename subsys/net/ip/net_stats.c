@@ -29,6 +29,35 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
  */
 struct net_stats net_stats = { 0 };
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+struct net_stats_shard net_stats_shards[CONFIG_MP_NUM_CPUS] = { 0 };
+
+/* Folds the per-CPU shards into the global counter set and zeroes
+ * them, so that readers see up-to-date totals while the hot path only
+ * ever touches CPU-local memory.  Only additive 32-bit counters are
+ * routed to the shards (see UPDATE_STAT_GLOBAL()), which is what makes
+ * the word-by-word summing below correct: 64-bit sums and assignment
+ * style fields are always zero in every shard.  An update racing with
+ * the fold can be delayed to the next read, which is acceptable for
+ * statistics.
+ */
+void net_stats_aggregate(void)
+{
+	BUILD_ASSERT((sizeof(struct net_stats) % sizeof(uint32_t)) == 0);
+
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		uint32_t *src = (uint32_t *)&net_stats_shards[cpu].stats;
+		uint32_t *dst = (uint32_t *)&net_stats;
+
+		for (size_t i = 0;
+		     i < sizeof(struct net_stats) / sizeof(uint32_t); i++) {
+			dst[i] += src[i];
+			src[i] = 0U;
+		}
+	}
+}
+#endif /* CONFIG_NET_STATISTICS_PER_CPU */
+
 #if defined(CONFIG_NET_STATISTICS_PERIODIC_OUTPUT)
 
 #define PRINT_STATISTICS_INTERVAL (30 * MSEC_PER_SEC)
@@ -72,6 +101,8 @@ static inline void stats(struct net_if *iface)
 	int i;
 
 	if (!next_print || (abs(cmp) > PRINT_STATISTICS_INTERVAL)) {
+		net_stats_aggregate();
+
 		if (iface) {
 			NET_INFO("Interface %p [%d]", iface,
 				 net_if_get_by_iface(iface));
@@ -240,6 +271,8 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 	size_t len_chk = 0;
 	void *src = NULL;
 
+	net_stats_aggregate();
+
 	switch (NET_MGMT_GET_COMMAND(mgmt_request)) {
 	case NET_REQUEST_STATS_CMD_GET_ALL:
 		len_chk = sizeof(struct net_stats);
@@ -371,5 +404,8 @@ void net_stats_reset(struct net_if *iface)
 	}
 
 	net_if_stats_reset_all();
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+	memset(net_stats_shards, 0, sizeof(net_stats_shards));
+#endif
 	memset(&net_stats, 0, sizeof(net_stats));
 }
@@ -27,10 +27,46 @@ extern struct net_stats net_stats;
 #define GET_STAT_ADDR(iface, s) (&GET_STAT(iface, s))
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+/* Per-CPU shard for the hot-path counters.  The wrapper struct exists
+ * so that the "stats.xxx" expressions used with UPDATE_STAT() resolve
+ * against a shard exactly as they do against the global variable; the
+ * alignment keeps the shards in separate cachelines.
+ */
+struct net_stats_shard {
+	struct net_stats stats;
+} __aligned(64);
+
+extern struct net_stats_shard net_stats_shards[CONFIG_MP_NUM_CPUS];
+
+/* Folds the shards into the global counters, called before reading */
+void net_stats_aggregate(void);
+
+static inline struct net_stats_shard *net_stats_shard_get(void)
+{
+	return &net_stats_shards[arch_curr_cpu()->id];
+}
+
+/* Additive 32-bit counters update only the local CPU's shard on the
+ * packet hot path and get summed into the global on read.  Assignment
+ * style and 64-bit statistics must use the _DIRECT variant targeting
+ * the global, as net_stats_aggregate() sums the shards word by word
+ * and relies on every shard field it folds being a 32-bit addend.
+ */
+#define UPDATE_STAT_GLOBAL(cmd) (net_stats_shard_get()->cmd)
+#define UPDATE_STAT_GLOBAL_DIRECT(cmd) (net_##cmd)
+#else
 #define UPDATE_STAT_GLOBAL(cmd) (net_##cmd)
+#define UPDATE_STAT_GLOBAL_DIRECT(cmd) (net_##cmd)
+#define net_stats_aggregate()
+#endif /* CONFIG_NET_STATISTICS_PER_CPU */
+
 #define UPDATE_STAT(_iface, _cmd) \
 	{ NET_ASSERT(_iface); (UPDATE_STAT_GLOBAL(_cmd)); \
 	  SET_STAT(_iface->_cmd); }
+#define UPDATE_STAT_DIRECT(_iface, _cmd) \
+	{ NET_ASSERT(_iface); (UPDATE_STAT_GLOBAL_DIRECT(_cmd)); \
+	  SET_STAT(_iface->_cmd); }
 /* Core stats */
 
 static inline void net_stats_update_processing_error(struct net_if *iface)
@@ -326,9 +362,9 @@ static inline void net_stats_update_tx_time(struct net_if *iface,
 {
 	uint32_t diff = end_time - start_time;
 
-	UPDATE_STAT(iface, stats.tx_time.sum +=
-		    k_cyc_to_ns_floor64(diff) / 1000);
-	UPDATE_STAT(iface, stats.tx_time.count += 1);
+	UPDATE_STAT_DIRECT(iface, stats.tx_time.sum +=
+			   k_cyc_to_ns_floor64(diff) / 1000);
+	UPDATE_STAT_DIRECT(iface, stats.tx_time.count += 1);
 }
 #else
 #define net_stats_update_tx_time(iface, start_time, end_time)
@@ -341,11 +377,11 @@ static inline void net_stats_update_tx_time_detail(struct net_if *iface,
 	int i;
 
 	for (i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
-		UPDATE_STAT(iface,
-			    stats.tx_time_detail[i].sum +=
-			    k_cyc_to_ns_floor64(detail_stat[i]) / 1000);
-		UPDATE_STAT(iface,
-			    stats.tx_time_detail[i].count += 1);
+		UPDATE_STAT_DIRECT(iface,
+				   stats.tx_time_detail[i].sum +=
+				   k_cyc_to_ns_floor64(detail_stat[i]) / 1000);
+		UPDATE_STAT_DIRECT(iface,
+				   stats.tx_time_detail[i].count += 1);
 	}
 }
 #else
@@ -359,9 +395,9 @@ static inline void net_stats_update_rx_time(struct net_if *iface,
 {
 	uint32_t diff = end_time - start_time;
 
-	UPDATE_STAT(iface, stats.rx_time.sum +=
-		    k_cyc_to_ns_floor64(diff) / 1000);
-	UPDATE_STAT(iface, stats.rx_time.count += 1);
+	UPDATE_STAT_DIRECT(iface, stats.rx_time.sum +=
+			   k_cyc_to_ns_floor64(diff) / 1000);
+	UPDATE_STAT_DIRECT(iface, stats.rx_time.count += 1);
 }
 #else
 #define net_stats_update_rx_time(iface, start_time, end_time)
@@ -374,11 +410,11 @@ static inline void net_stats_update_rx_time_detail(struct net_if *iface,
 	int i;
 
 	for (i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
-		UPDATE_STAT(iface,
-			    stats.rx_time_detail[i].sum +=
-			    k_cyc_to_ns_floor64(detail_stat[i]) / 1000);
-		UPDATE_STAT(iface,
-			    stats.rx_time_detail[i].count += 1);
+		UPDATE_STAT_DIRECT(iface,
+				   stats.rx_time_detail[i].sum +=
+				   k_cyc_to_ns_floor64(detail_stat[i]) / 1000);
+		UPDATE_STAT_DIRECT(iface,
+				   stats.rx_time_detail[i].count += 1);
 	}
 }
 #else
@@ -401,7 +437,7 @@ static inline void net_stats_update_tc_sent_bytes(struct net_if *iface,
 static inline void net_stats_update_tc_sent_priority(struct net_if *iface,
 						     uint8_t tc, uint8_t priority)
 {
-	UPDATE_STAT(iface, stats.tc.sent[tc].priority = priority);
+	UPDATE_STAT_DIRECT(iface, stats.tc.sent[tc].priority = priority);
 }
 
 #if (defined(CONFIG_NET_CONTEXT_TIMESTAMP) || \
@@ -415,9 +451,9 @@ static inline void net_stats_update_tc_tx_time(struct net_if *iface,
 	uint32_t diff = end_time - start_time;
 	int tc = net_tx_priority2tc(priority);
 
-	UPDATE_STAT(iface, stats.tc.sent[tc].tx_time.sum +=
-		    k_cyc_to_ns_floor64(diff) / 1000);
-	UPDATE_STAT(iface, stats.tc.sent[tc].tx_time.count += 1);
+	UPDATE_STAT_DIRECT(iface, stats.tc.sent[tc].tx_time.sum +=
+			   k_cyc_to_ns_floor64(diff) / 1000);
+	UPDATE_STAT_DIRECT(iface, stats.tc.sent[tc].tx_time.count += 1);
 
 	net_stats_update_tx_time(iface, start_time, end_time);
 }
@@ -434,11 +470,11 @@ static inline void net_stats_update_tc_tx_time_detail(struct net_if *iface,
 	int i;
 
 	for (i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
-		UPDATE_STAT(iface,
-			    stats.tc.sent[tc].tx_time_detail[i].sum +=
-			    k_cyc_to_ns_floor64(detail_stat[i]) / 1000);
-		UPDATE_STAT(iface,
-			    stats.tc.sent[tc].tx_time_detail[i].count += 1);
+		UPDATE_STAT_DIRECT(iface,
+				   stats.tc.sent[tc].tx_time_detail[i].sum +=
+				   k_cyc_to_ns_floor64(detail_stat[i]) / 1000);
+		UPDATE_STAT_DIRECT(iface,
+				   stats.tc.sent[tc].tx_time_detail[i].count += 1);
 	}
 
 	net_stats_update_tx_time_detail(iface, detail_stat);
@@ -457,9 +493,9 @@ static inline void net_stats_update_tc_rx_time(struct net_if *iface,
 	uint32_t diff = end_time - start_time;
 	int tc = net_rx_priority2tc(priority);
 
-	UPDATE_STAT(iface, stats.tc.recv[tc].rx_time.sum +=
-		    k_cyc_to_ns_floor64(diff) / 1000);
-	UPDATE_STAT(iface, stats.tc.recv[tc].rx_time.count += 1);
+	UPDATE_STAT_DIRECT(iface, stats.tc.recv[tc].rx_time.sum +=
+			   k_cyc_to_ns_floor64(diff) / 1000);
+	UPDATE_STAT_DIRECT(iface, stats.tc.recv[tc].rx_time.count += 1);
 
 	net_stats_update_rx_time(iface, start_time, end_time);
 }
@@ -476,11 +512,11 @@ static inline void net_stats_update_tc_rx_time_detail(struct net_if *iface,
 	int i;
 
 	for (i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
-		UPDATE_STAT(iface,
-			    stats.tc.recv[tc].rx_time_detail[i].sum +=
-			    k_cyc_to_ns_floor64(detail_stat[i]) / 1000);
-		UPDATE_STAT(iface,
-			    stats.tc.recv[tc].rx_time_detail[i].count += 1);
+		UPDATE_STAT_DIRECT(iface,
+				   stats.tc.recv[tc].rx_time_detail[i].sum +=
+				   k_cyc_to_ns_floor64(detail_stat[i]) / 1000);
+		UPDATE_STAT_DIRECT(iface,
+				   stats.tc.recv[tc].rx_time_detail[i].count += 1);
 	}
 
 	net_stats_update_rx_time_detail(iface, detail_stat);
@@ -503,7 +539,7 @@ static inline void net_stats_update_tc_recv_bytes(struct net_if *iface,
 static inline void net_stats_update_tc_recv_priority(struct net_if *iface,
 						     uint8_t tc, uint8_t priority)
 {
-	UPDATE_STAT(iface, stats.tc.recv[tc].priority = priority);
+	UPDATE_STAT_DIRECT(iface, stats.tc.recv[tc].priority = priority);
 }
 #else
 #define net_stats_update_tc_sent_pkt(iface, tc)
@@ -576,7 +612,7 @@ static inline void net_stats_update_tc_rx_time_detail(struct net_if *iface,
 static inline void net_stats_add_suspend_start_time(struct net_if *iface,
 						    uint32_t time)
 {
-	UPDATE_STAT(iface, stats.pm.start_time = time);
+	UPDATE_STAT_DIRECT(iface, stats.pm.start_time = time);
 }
 
 static inline void net_stats_add_suspend_end_time(struct net_if *iface,
@@ -585,10 +621,10 @@ static inline void net_stats_add_suspend_end_time(struct net_if *iface,
 	uint32_t diff_time =
 		k_cyc_to_ms_floor32(time - GET_STAT(iface, pm.start_time));
 
-	UPDATE_STAT(iface, stats.pm.start_time = 0);
-	UPDATE_STAT(iface, stats.pm.last_suspend_time = diff_time);
-	UPDATE_STAT(iface, stats.pm.suspend_count++);
-	UPDATE_STAT(iface, stats.pm.overall_suspend_time += diff_time);
+	UPDATE_STAT_DIRECT(iface, stats.pm.start_time = 0);
+	UPDATE_STAT_DIRECT(iface, stats.pm.last_suspend_time = diff_time);
+	UPDATE_STAT_DIRECT(iface, stats.pm.suspend_count++);
+	UPDATE_STAT_DIRECT(iface, stats.pm.overall_suspend_time += diff_time);
 }
 #else
 #define net_stats_add_suspend_start_time(iface, time)
@@ -42,6 +42,11 @@ bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 	return true;
 }
 
+bool net_tc_tx_queue_is_empty(uint8_t tc)
+{
+	return k_queue_is_empty(&tx_classes[tc].work_q.queue);
+}
+
 void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
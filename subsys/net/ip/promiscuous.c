@@ -21,10 +21,57 @@ LOG_MODULE_REGISTER(net_promisc, CONFIG_NET_PROMISC_LOG_LEVEL);
 #include <net/net_if.h>
 #include <net/net_core.h>
 #include <net/net_pkt.h>
+#include <net/net_context.h>
+
+#include "net_private.h"
 
 static K_FIFO_DEFINE(promiscuous_queue);
 static atomic_t enabled = ATOMIC_INIT(0);
 
+#if defined(CONFIG_NET_RAW_FILTER)
+static struct net_raw_filter promisc_filter;
+static struct k_spinlock promisc_filter_lock;
+
+int net_promisc_mode_set_filter(const struct net_raw_filter *filter)
+{
+	k_spinlock_key_t key;
+
+	if (filter && filter->count > NET_RAW_FILTER_MAX_RULES) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&promisc_filter_lock);
+
+	if (filter) {
+		memcpy(&promisc_filter, filter, sizeof(promisc_filter));
+	} else {
+		promisc_filter.count = 0U;
+	}
+
+	k_spin_unlock(&promisc_filter_lock, key);
+
+	return 0;
+}
+
+bool net_promisc_mode_accept(struct net_pkt *pkt)
+{
+	k_spinlock_key_t key;
+	bool ok;
+
+	if (!atomic_get(&enabled)) {
+		return false;
+	}
+
+	key = k_spin_lock(&promisc_filter_lock);
+
+	ok = net_raw_filter_ok(&promisc_filter, pkt);
+
+	k_spin_unlock(&promisc_filter_lock, key);
+
+	return ok;
+}
+#endif /* CONFIG_NET_RAW_FILTER */
+
 struct net_pkt *net_promisc_mode_wait_data(k_timeout_t timeout)
 {
 	return k_fifo_get(&promiscuous_queue, timeout);
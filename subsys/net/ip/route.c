@@ -86,9 +86,13 @@ static struct net_nbr *get_nexthop_route(void)
 	return NULL;
 }
 
+static void route_hash_remove(struct net_nbr *nbr);
+
 static void net_route_entry_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Route %p removed", nbr);
+
+	route_hash_remove(nbr);
 }
 
 static void net_route_entries_table_clear(struct net_nbr_table *table)
@@ -118,6 +122,84 @@ static inline struct net_route_entry *net_route_data(struct net_nbr *nbr)
 	return (struct net_route_entry *)nbr->data;
 }
 
+/* Longest prefix match index: routes are hashed on their prefix, and
+ * the number of routes per prefix length is counted so that the
+ * lookup only probes the prefix lengths that are actually in use,
+ * longest first. Routes hashing to the same bucket are chained via
+ * the hash_next field in net_route_entry.
+ */
+#define ROUTE_HASH_SIZE CONFIG_NET_MAX_ROUTES
+
+static int16_t route_hash[ROUTE_HASH_SIZE] = {
+	[0 ... (ROUTE_HASH_SIZE - 1)] = -1
+};
+
+static uint8_t route_prefix_len_count[129];
+
+static uint32_t route_hash_mix(uint32_t hash, uint32_t value)
+{
+	return (hash ^ value) * 0x9e3779b1U;
+}
+
+static uint16_t route_hash_bucket(const struct in6_addr *addr,
+				  uint8_t prefix_len)
+{
+	uint32_t hash = prefix_len;
+	uint8_t left = prefix_len;
+	int i;
+
+	for (i = 0; i < 4 && left > 0; i++) {
+		uint32_t word = ntohl(UNALIGNED_GET(&addr->s6_addr32[i]));
+
+		if (left < 32) {
+			word &= 0xffffffffU << (32 - left);
+			left = 0U;
+		} else {
+			left -= 32U;
+		}
+
+		hash = route_hash_mix(hash, word);
+	}
+
+	return hash % ROUTE_HASH_SIZE;
+}
+
+static int16_t route_get_index(struct net_nbr *nbr)
+{
+	return (int16_t)(((uint8_t *)nbr - (uint8_t *)net_route_entries_pool) /
+			 sizeof(net_route_entries_pool[0]));
+}
+
+static void route_hash_insert(struct net_nbr *nbr)
+{
+	struct net_route_entry *route = net_route_data(nbr);
+	uint16_t bucket = route_hash_bucket(&route->addr, route->prefix_len);
+
+	route->hash_next = route_hash[bucket];
+	route_hash[bucket] = route_get_index(nbr);
+
+	route_prefix_len_count[route->prefix_len]++;
+}
+
+static void route_hash_remove(struct net_nbr *nbr)
+{
+	struct net_route_entry *route = net_route_data(nbr);
+	uint16_t bucket = route_hash_bucket(&route->addr, route->prefix_len);
+	int16_t idx = route_get_index(nbr);
+	int16_t *prev = &route_hash[bucket];
+
+	while (*prev >= 0) {
+		if (*prev == idx) {
+			*prev = route->hash_next;
+
+			route_prefix_len_count[route->prefix_len]--;
+			return;
+		}
+
+		prev = &net_route_data(get_nbr(*prev))->hash_next;
+	}
+}
+
 struct net_nbr *net_route_get_nbr(struct net_route_entry *route)
 {
 	int i;
@@ -190,6 +272,8 @@ static struct net_nbr *nbr_new(struct net_if *iface,
 	net_ipaddr_copy(&net_route_data(nbr)->addr, addr);
 	net_route_data(nbr)->prefix_len = prefix_len;
 
+	route_hash_insert(nbr);
+
 	NET_DBG("[%d] nbr %p iface %p IPv6 %s/%d",
 		nbr->idx, nbr, iface,
 		log_strdup(net_sprint_ipv6_addr(&net_route_data(nbr)->addr)),
@@ -260,29 +344,35 @@ static inline void update_route_access(struct net_route_entry *route)
 struct net_route_entry *net_route_lookup(struct net_if *iface,
 					 struct in6_addr *dst)
 {
-	struct net_route_entry *route, *found = NULL;
-	uint8_t longest_match = 0U;
-	int i;
+	struct net_route_entry *found = NULL;
+	int len;
 
-	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
-		struct net_nbr *nbr = get_nbr(i);
+	for (len = 128; len >= 0 && !found; len--) {
+		int16_t i;
 
-		if (!nbr->ref) {
+		if (!route_prefix_len_count[len]) {
 			continue;
 		}
 
-		if (iface && nbr->iface != iface) {
-			continue;
-		}
+		for (i = route_hash[route_hash_bucket(dst, len)]; i >= 0;
+		     i = net_route_data(get_nbr(i))->hash_next) {
+			struct net_nbr *nbr = get_nbr(i);
+			struct net_route_entry *route = net_route_data(nbr);
 
-		route = net_route_data(nbr);
+			if (route->prefix_len != len) {
+				continue;
+			}
+
+			if (iface && nbr->iface != iface) {
+				continue;
+			}
 
-		if (route->prefix_len >= longest_match &&
-		    net_ipv6_is_prefix(dst->s6_addr,
-				       route->addr.s6_addr,
-				       route->prefix_len)) {
-			found = route;
-			longest_match = route->prefix_len;
+			if (net_ipv6_is_prefix(dst->s6_addr,
+					       route->addr.s6_addr,
+					       route->prefix_len)) {
+				found = route;
+				break;
+			}
 		}
 	}
 
@@ -59,6 +59,11 @@ struct net_route_entry {
 
 	/** IPv6 address/prefix length. */
 	uint8_t prefix_len;
+
+	/** Next route in the same prefix hash bucket. This is an index
+	 * into the route entry pool, -1 terminates the chain.
+	 */
+	int16_t hash_next;
 };
 
 /**
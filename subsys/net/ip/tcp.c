@@ -1586,6 +1586,45 @@ int net_tcp_update_recv_wnd(struct net_context *context, int32_t delta)
 	return 0;
 }
 
+int net_tcp_set_option(struct net_context *context,
+		       enum tcp_conn_option option,
+		       const void *value, size_t len)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	/* The legacy stack sends every queued chunk right away, so
+	 * TCP_NODELAY is effectively always set; accept it for
+	 * compatibility but there is nothing to cork.
+	 */
+	if (option == TCP_OPT_NODELAY) {
+		return 0;
+	}
+
+	return -EPROTONOSUPPORT;
+}
+
+int net_tcp_get_option(struct net_context *context,
+		       enum tcp_conn_option option,
+		       void *value, size_t *len)
+{
+	ARG_UNUSED(context);
+
+	if (option != TCP_OPT_NODELAY) {
+		return -EPROTONOSUPPORT;
+	}
+
+	if (*len < sizeof(int) || value == NULL) {
+		return -EINVAL;
+	}
+
+	*(int *)value = 1;
+	*len = sizeof(int);
+
+	return 0;
+}
+
 static int send_reset(struct net_context *context, struct sockaddr *local,
 		      struct sockaddr *remote);
 
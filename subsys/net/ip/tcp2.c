@@ -20,14 +20,45 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #include "connection.h"
 #include "net_stats.h"
 #include "net_private.h"
+#include "tcp_internal.h"
 #include "tcp2_priv.h"
 
 #define FIN_TIMEOUT_MS MSEC_PER_SEC
 #define FIN_TIMEOUT K_MSEC(FIN_TIMEOUT_MS)
 
+/* Bounds for the RFC 6298 retransmission timeout computed from the
+ * measured round-trip time.  The lower bound is deliberately below
+ * the RFC's one second so that fast local links retransmit quickly;
+ * CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT applies until the first
+ * measurement is taken.
+ */
+#define TCP_RTO_MIN_MS 100
+#define TCP_RTO_MAX_MS 60000
+/* Clock granularity "G" of RFC 6298, in milliseconds */
+#define TCP_RTO_GRANULARITY_MS 10
+
+/* Longest interval between zero-window probes */
+#define TCP_PERSIST_MAX_MS 60000
+
+/* Duplicate ACKs before fast retransmit kicks in (RFC 5681) */
+#define TCP_DUP_ACK_THRESHOLD 3
+
+/* Longest time a lone received segment may wait for its ACK
+ * (RFC 1122 4.2.3.2 allows up to 500 ms, common practice is 200)
+ */
+#define TCP_DELAYED_ACK_MS 200
+
 static int tcp_rto = CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT;
 static int tcp_retries = CONFIG_NET_TCP_RETRY_COUNT;
+#if defined(CONFIG_NET_TCP_WINDOW_SCALING) && CONFIG_NET_TCP_MAX_RECV_WINDOW_SIZE
+static int tcp_window = CONFIG_NET_TCP_MAX_RECV_WINDOW_SIZE;
+#elif defined(CONFIG_NET_TCP_WINDOW_SCALING)
+/* Adjust the window so that we do not run out of RX bufs */
+static int tcp_window = (CONFIG_NET_BUF_RX_COUNT *
+			 CONFIG_NET_BUF_DATA_SIZE) / 3;
+#else
 static int tcp_window = NET_IPV6_MTU;
+#endif
 
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
@@ -292,6 +323,37 @@ static void tcp_send_queue_flush(struct tcp *conn)
 	}
 }
 
+#if defined(CONFIG_NET_TCP_OOO_QUEUE)
+/* An out-of-order segment: a copy of the segment's data waiting in
+ * conn->recv_queue until the gap before it has been filled.
+ */
+struct tcp_recv_seg {
+	sys_snode_t next;
+	struct net_pkt *pkt; /* payload only, headers are stripped */
+	uint32_t seq;
+	size_t len;
+};
+
+static K_MEM_SLAB_DEFINE(tcp_recv_segs_slab, sizeof(struct tcp_recv_seg),
+			 CONFIG_NET_TCP_OOO_QUEUE_SEGS, 4);
+
+static void tcp_recv_queue_flush(struct tcp *conn)
+{
+	struct tcp_recv_seg *seg;
+
+	while ((seg = tcp_slist(&conn->recv_queue, get,
+				struct tcp_recv_seg, next))) {
+		tcp_pkt_unref(seg->pkt);
+		k_mem_slab_free(&tcp_recv_segs_slab, (void **)&seg);
+	}
+}
+#else
+static void tcp_recv_queue_flush(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+#endif /* CONFIG_NET_TCP_OOO_QUEUE */
+
 static int tcp_conn_unref(struct tcp *conn)
 {
 	int key, ref_count = atomic_get(&conn->ref_count);
@@ -331,6 +393,7 @@ static int tcp_conn_unref(struct tcp *conn)
 	net_context_unref(conn->context);
 
 	tcp_send_queue_flush(conn);
+	tcp_recv_queue_flush(conn);
 
 	if (k_delayed_work_remaining_get(&conn->send_data_timer)) {
 		k_delayed_work_cancel(&conn->send_data_timer);
@@ -339,6 +402,8 @@ static int tcp_conn_unref(struct tcp *conn)
 
 	k_delayed_work_cancel(&conn->timewait_timer);
 	k_delayed_work_cancel(&conn->fin_timer);
+	k_delayed_work_cancel(&conn->persist_timer);
+	k_delayed_work_cancel(&conn->ack_timer);
 
 	sys_slist_find_and_remove(&tcp_conns, &conn->next);
 
@@ -506,6 +571,7 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+	recv_options->sack_permitted = false;
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -549,9 +615,17 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			recv_options->window = options[2];
 			recv_options->wnd_found = true;
 			break;
+		case TCPOPT_SACK_PERM:
+			if (opt_len != 2) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_permitted = true;
+			break;
 		default:
 			continue;
 		}
@@ -612,8 +686,117 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#if defined(CONFIG_NET_TCP_OOO_QUEUE) || defined(CONFIG_NET_TCP_WINDOW_SCALING)
+#define TCP_OPTS 1
+
+#if defined(CONFIG_NET_TCP_OOO_QUEUE)
+/* Up to three SACK blocks fit together with the two padding NOPs */
+#define TCP_SACK_BLOCKS 3
+#endif
+
+/* The SYN options, or the largest SACK block set */
+#define TCP_OPTS_MAX 32
+
+#if defined(CONFIG_NET_TCP_OOO_QUEUE)
+/* Append the queued out-of-order runs as SACK blocks.  Returns the
+ * option length, a multiple of four.
+ */
+static uint8_t tcp_sack_blocks_fill(struct tcp *conn, uint8_t *buf)
+{
+	struct tcp_recv_seg *seg;
+	uint8_t *opt = buf + 4;
+	uint8_t nblocks = 0;
+	uint32_t left = 0, right = 0;
+	bool open = false;
+
+	if (!conn->sack_enabled || sys_slist_is_empty(&conn->recv_queue)) {
+		return 0;
+	}
+
+	/* Coalesce adjacent/overlapping queued segments into runs */
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn->recv_queue, seg, next) {
+		if (open && net_tcp_seq_cmp(seg->seq, right) <= 0) {
+			if (net_tcp_seq_cmp(seg->seq + seg->len, right) > 0) {
+				right = seg->seq + seg->len;
+			}
+			continue;
+		}
+
+		if (open) {
+			if (nblocks == TCP_SACK_BLOCKS) {
+				break;
+			}
+			UNALIGNED_PUT(htonl(left), (uint32_t *)opt);
+			UNALIGNED_PUT(htonl(right), (uint32_t *)(opt + 4));
+			opt += 8;
+			nblocks++;
+		}
+
+		left = seg->seq;
+		right = seg->seq + seg->len;
+		open = true;
+	}
+
+	if (open && nblocks < TCP_SACK_BLOCKS) {
+		UNALIGNED_PUT(htonl(left), (uint32_t *)opt);
+		UNALIGNED_PUT(htonl(right), (uint32_t *)(opt + 4));
+		nblocks++;
+	}
+
+	if (nblocks == 0) {
+		return 0;
+	}
+
+	buf[0] = TCPOPT_NOP;
+	buf[1] = TCPOPT_NOP;
+	buf[2] = TCPOPT_SACK;
+	buf[3] = 2 + nblocks * 8;
+
+	return 4 + nblocks * 8;
+}
+#endif /* CONFIG_NET_TCP_OOO_QUEUE */
+
+/* Fill in the options we want to append to an outgoing segment: SACK
+ * permitted and our window scale shift on SYNs, SACK blocks for the
+ * queued out-of-order runs on ACKs.  Returns the options length, a
+ * multiple of four.
+ */
+static uint8_t tcp_options_fill(struct tcp *conn, uint8_t flags, uint8_t *buf)
+{
+	uint8_t len = 0;
+
+	if (flags & RST) {
+		return 0;
+	}
+
+	if (flags & SYN) {
+#if defined(CONFIG_NET_TCP_OOO_QUEUE)
+		buf[len] = TCPOPT_NOP;
+		buf[len + 1] = TCPOPT_NOP;
+		buf[len + 2] = TCPOPT_SACK_PERM;
+		buf[len + 3] = 2;
+		len += 4;
+#endif
+#if defined(CONFIG_NET_TCP_WINDOW_SCALING)
+		buf[len] = TCPOPT_NOP;
+		buf[len + 1] = TCPOPT_WINDOW;
+		buf[len + 2] = 3;
+		buf[len + 3] = conn->recv_win_scale;
+		len += 4;
+#endif
+		return len;
+	}
+
+#if defined(CONFIG_NET_TCP_OOO_QUEUE)
+	len = tcp_sack_blocks_fill(conn, buf);
+#endif
+
+	return len;
+}
+#endif /* CONFIG_NET_TCP_OOO_QUEUE || CONFIG_NET_TCP_WINDOW_SCALING */
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, uint8_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -628,9 +811,17 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 	th->th_sport = conn->src.sin.sin_port;
 	th->th_dport = conn->dst.sin.sin_port;
 
-	th->th_off = 5;
+	th->th_off = 5 + opts_len / 4;
 	th->th_flags = flags;
-	th->th_win = htons(conn->recv_win);
+
+	/* The window field of a SYN is never scaled (RFC 1323) */
+	if (conn->win_scale_enabled && !(flags & SYN)) {
+		th->th_win = htons(MIN(conn->recv_win >> conn->recv_win_scale,
+				       UINT16_MAX));
+	} else {
+		th->th_win = htons(MIN(conn->recv_win, UINT16_MAX));
+	}
+
 	th->th_seq = htonl(seq);
 
 	if (ACK & flags) {
@@ -662,8 +853,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 {
 	struct net_pkt *pkt;
 	int ret = 0;
+#if defined(TCP_OPTS)
+	uint8_t opts[TCP_OPTS_MAX];
+	uint8_t opts_len = tcp_options_fill(conn, flags, opts);
+#else
+	uint8_t opts_len = 0;
+#endif
 
-	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr));
+	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr) + opts_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
 		goto out;
@@ -681,12 +878,22 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
 	}
 
+#if defined(TCP_OPTS)
+	if (opts_len) {
+		ret = net_pkt_write(pkt, opts, opts_len);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+#endif
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -695,6 +902,13 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 
 	NET_DBG("%s", log_strdup(tcp_th(pkt)));
 
+	/* Every ACK-bearing segment acknowledges up to conn->ack, so a
+	 * separately scheduled delayed ACK becomes redundant.
+	 */
+	if (flags & ACK) {
+		conn->unacked_segments = 0U;
+	}
+
 	if (tcp_send_cb) {
 		ret = tcp_send_cb(pkt);
 		goto out;
@@ -712,6 +926,46 @@ static void tcp_out(struct tcp *conn, uint8_t flags)
 	(void)tcp_out_ext(conn, flags, NULL /* no data */, conn->seq);
 }
 
+/* Send the pending delayed ACK, if any, right now */
+static void tcp_ack_flush(struct tcp *conn)
+{
+	if (conn->unacked_segments == 0U) {
+		return;
+	}
+
+	k_delayed_work_cancel(&conn->ack_timer);
+	conn->unacked_segments = 0U;
+
+	tcp_out(conn, ACK);
+}
+
+/* Acknowledge received data per the RFC 1122 delayed ACK rules: every
+ * second segment immediately, a lone segment after a short delay in
+ * case more data (or our own data to piggyback the ACK on) shows up.
+ * TCP_QUICKACK turns the delay off for latency-critical connections.
+ */
+static void tcp_ack_delayed(struct tcp *conn)
+{
+	conn->unacked_segments++;
+
+	if (conn->tcp_quickack || conn->unacked_segments >= 2U) {
+		tcp_ack_flush(conn);
+		return;
+	}
+
+	if (!k_delayed_work_remaining_get(&conn->ack_timer)) {
+		k_delayed_work_submit(&conn->ack_timer,
+				      K_MSEC(TCP_DELAYED_ACK_MS));
+	}
+}
+
+static void tcp_ack_timeout(struct k_work *work)
+{
+	struct tcp *conn = CONTAINER_OF(work, struct tcp, ack_timer);
+
+	tcp_ack_flush(conn);
+}
+
 static int tcp_pkt_pull(struct net_pkt *pkt, size_t len)
 {
 	int total = net_pkt_get_len(pkt);
@@ -744,6 +998,128 @@ static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
 	return net_pkt_copy(to, from, len);
 }
 
+#if defined(CONFIG_NET_TCP_OOO_QUEUE)
+/* Keep a copy of an out-of-order segment's data until the gap before it
+ * has been filled.  The queue is kept sorted by sequence number and
+ * segments already fully covered by a queued one are dropped.
+ */
+static void tcp_recv_queue_add(struct tcp *conn, struct net_pkt *pkt,
+			       uint32_t seq, size_t len)
+{
+	struct tcp_recv_seg *seg, *it, *prev = NULL;
+	struct net_pkt *data;
+	size_t hdrs_len = net_pkt_get_len(pkt) - len;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn->recv_queue, it, next) {
+		if (net_tcp_seq_cmp(it->seq, seq) <= 0 &&
+		    net_tcp_seq_cmp(it->seq + it->len, seq + len) >= 0) {
+			return; /* fully covered already */
+		}
+
+		if (net_tcp_seq_cmp(it->seq, seq) > 0) {
+			break;
+		}
+
+		prev = it;
+	}
+
+	if (k_mem_slab_alloc(&tcp_recv_segs_slab, (void **)&seg,
+			     K_NO_WAIT) != 0) {
+		NET_DBG("conn: %p out-of-order pool exhausted, seq=%u", conn,
+			seq);
+		return;
+	}
+
+	data = tcp_pkt_clone(pkt);
+	if (!data || tcp_pkt_pull(data, hdrs_len) < 0) {
+		if (data) {
+			tcp_pkt_unref(data);
+		}
+		k_mem_slab_free(&tcp_recv_segs_slab, (void **)&seg);
+		return;
+	}
+
+	seg->pkt = data;
+	seg->seq = seq;
+	seg->len = len;
+
+	if (prev) {
+		sys_slist_insert(&conn->recv_queue, &prev->next, &seg->next);
+	} else {
+		sys_slist_prepend(&conn->recv_queue, &seg->next);
+	}
+
+	NET_DBG("conn: %p queued out-of-order seq=%u len=%zu", conn, seq, len);
+}
+
+/* Deliver the queued segments that have become contiguous with
+ * conn->ack, advancing conn->ack over them.
+ */
+static void tcp_recv_queue_deliver(struct tcp *conn)
+{
+	struct tcp_recv_seg *seg;
+
+	while ((seg = tcp_slist(&conn->recv_queue, peek_head,
+				struct tcp_recv_seg, next))) {
+		int32_t overlap = net_tcp_seq_cmp(conn->ack, seg->seq);
+
+		if (overlap < 0) {
+			break; /* still a gap before this segment */
+		}
+
+		tcp_slist(&conn->recv_queue, get, struct tcp_recv_seg, next);
+
+		if ((size_t)overlap < seg->len) {
+			size_t len = seg->len - overlap;
+
+			if (overlap && tcp_pkt_pull(seg->pkt, overlap) < 0) {
+				tcp_pkt_unref(seg->pkt);
+				k_mem_slab_free(&tcp_recv_segs_slab,
+						(void **)&seg);
+				break;
+			}
+
+			NET_DBG("conn: %p deliver queued seq=%u len=%zu", conn,
+				conn->ack, len);
+
+			if (conn->context->recv_cb) {
+				net_pkt_cursor_init(seg->pkt);
+				net_pkt_set_overwrite(seg->pkt, true);
+
+				net_context_packet_received(
+					(struct net_conn *)
+						conn->context->conn_handler,
+					seg->pkt, NULL, NULL,
+					conn->recv_user_data);
+				seg->pkt = NULL;
+			}
+
+			conn_ack(conn, + len);
+		}
+
+		if (seg->pkt) {
+			tcp_pkt_unref(seg->pkt);
+		}
+
+		k_mem_slab_free(&tcp_recv_segs_slab, (void **)&seg);
+	}
+}
+#else
+static void tcp_recv_queue_add(struct tcp *conn, struct net_pkt *pkt,
+			       uint32_t seq, size_t len)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(seq);
+	ARG_UNUSED(len);
+}
+
+static void tcp_recv_queue_deliver(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+#endif /* CONFIG_NET_TCP_OOO_QUEUE */
+
 static bool tcp_window_full(struct tcp *conn)
 {
 	bool window_full = !(conn->unacked_len < conn->send_win);
@@ -799,6 +1175,17 @@ static int tcp_send_data(struct tcp *conn)
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
 		conn->unacked_len += len;
+
+		/* Time one segment per round-trip; per Karn's algorithm
+		 * retransmissions are never timed as their ACK would be
+		 * ambiguous.
+		 */
+		if (!conn->rtt_pending && len > 0 &&
+		    conn->data_mode == TCP_DATA_MODE_SEND) {
+			conn->rtt_pending = true;
+			conn->rtt_seq = conn->seq + conn->unacked_len;
+			conn->rtt_ts = k_uptime_get_32();
+		}
 	}
 
 	/* The data we want to send, has been moved to the send queue so we
@@ -813,6 +1200,108 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+/* RFC 6298 smoothed RTT and retransmission timeout update, all values
+ * in milliseconds.
+ */
+static void tcp_rtt_measure(struct tcp *conn, uint32_t rtt)
+{
+	uint32_t rto;
+
+	if (conn->srtt == 0U) {
+		conn->srtt = rtt;
+		conn->rttvar = rtt / 2U;
+	} else {
+		uint32_t delta = (conn->srtt > rtt) ? conn->srtt - rtt :
+			rtt - conn->srtt;
+
+		conn->rttvar = (3U * conn->rttvar + delta) / 4U;
+		conn->srtt = (7U * conn->srtt + rtt) / 8U;
+	}
+
+	rto = conn->srtt + MAX(4U * conn->rttvar, TCP_RTO_GRANULARITY_MS);
+
+	conn->rto = MAX(TCP_RTO_MIN_MS, MIN(rto, TCP_RTO_MAX_MS));
+
+	NET_DBG("conn: %p rtt=%u srtt=%u rttvar=%u rto=%u", conn, rtt,
+		conn->srtt, conn->rttvar, conn->rto);
+}
+
+/* Zero-window probe: send the next unsent byte beyond the advertised
+ * window (RFC 1122 4.2.2.17).  The byte stays in send_data and
+ * unacked_len is not advanced, so a lost probe is simply sent again
+ * by the persist timer and an accepted one shows up as an ACK ahead
+ * of our send window.
+ */
+static int tcp_send_probe(struct tcp *conn)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = tcp_pkt_alloc(conn, 1);
+	if (!pkt) {
+		return -ENOBUFS;
+	}
+
+	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, 1);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
+static void tcp_persist_timeout(struct k_work *work)
+{
+	struct tcp *conn = CONTAINER_OF(work, struct tcp, persist_timer);
+	uint32_t timeout;
+
+	if (conn->state != TCP_ESTABLISHED || conn->send_win > 0 ||
+	    tcp_unsent_len(conn) <= 0) {
+		return;
+	}
+
+	NET_DBG("conn: %p zero window probe %hu", conn,
+		conn->persist_retries);
+
+	(void)tcp_send_probe(conn);
+
+	/* Exponential probe intervals, capped: unlike the data
+	 * retransmission timer the persist timer never gives up, as
+	 * the peer is alive and just has nowhere to put our data.
+	 */
+	if (conn->persist_retries < 10U) {
+		conn->persist_retries++;
+	}
+
+	timeout = MIN(conn->rto << conn->persist_retries,
+		      TCP_PERSIST_MAX_MS);
+	k_delayed_work_submit(&conn->persist_timer, K_MSEC(timeout));
+}
+
+/* Three duplicate ACKs mean the segment right above the duplicated
+ * ACK number was lost while later data still got through: retransmit
+ * it right away instead of waiting out the retransmission timer
+ * (RFC 5681).
+ */
+static void tcp_fast_retransmit(struct tcp *conn)
+{
+	NET_DBG("conn: %p fast retransmit seq=%u", conn, conn->seq);
+
+	conn->data_mode = TCP_DATA_MODE_RESEND;
+	conn->unacked_len = 0;
+	conn->rtt_pending = false;
+
+	(void)tcp_send_data(conn);
+
+	conn->send_data_retries = 0;
+	k_delayed_work_submit(&conn->send_data_timer, K_MSEC(conn->rto));
+}
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -826,8 +1315,34 @@ static int tcp_send_queued_data(struct tcp *conn)
 
 	while (tcp_unsent_len(conn) > 0) {
 
+		/* Coalesce small writes into full sized segments: with
+		 * TCP_CORK hold sub-MSS data back until uncorked, with
+		 * Nagle (the default) only while earlier data is still
+		 * unacknowledged.  An in-progress close flushes anyway.
+		 */
+		if (tcp_unsent_len(conn) < conn_mss(conn) && !conn->in_close &&
+		    (conn->tcp_cork ||
+		     (!conn->tcp_nodelay && conn->unacked_len > 0))) {
+			break;
+		}
+
 		if (tcp_window_full(conn)) {
-			subscribe = true;
+			if (conn->unacked_len == 0) {
+				/* Zero window with nothing in flight: no
+				 * ACK is coming to reopen it, so probe the
+				 * peer instead of running the retransmission
+				 * timer against data that was never sent.
+				 */
+				if (!k_delayed_work_remaining_get(
+						&conn->persist_timer)) {
+					conn->persist_retries = 0;
+					k_delayed_work_submit(
+						&conn->persist_timer,
+						K_MSEC(conn->rto));
+				}
+			} else {
+				subscribe = true;
+			}
 			break;
 		}
 
@@ -855,7 +1370,8 @@ static int tcp_send_queued_data(struct tcp *conn)
 
 	if (subscribe) {
 		conn->send_data_retries = 0;
-		k_delayed_work_submit(&conn->send_data_timer, K_MSEC(tcp_rto));
+		k_delayed_work_submit(&conn->send_data_timer,
+				      K_MSEC(conn->rto));
 	}
  out:
 	return ret;
@@ -877,6 +1393,7 @@ static void tcp_resend_data(struct k_work *work)
 
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
+	conn->rtt_pending = false;
 
 	ret = tcp_send_data(conn);
 	if (ret == 0) {
@@ -900,7 +1417,11 @@ static void tcp_resend_data(struct k_work *work)
 		}
 	}
 
-	k_delayed_work_submit(&conn->send_data_timer, K_MSEC(tcp_rto));
+	/* Exponential backoff (RFC 6298 5.5); the ACK that eventually
+	 * arrives recomputes the timeout from the smoothed RTT.
+	 */
+	conn->rto = MIN(conn->rto * 2U, TCP_RTO_MAX_MS);
+	k_delayed_work_submit(&conn->send_data_timer, K_MSEC(conn->rto));
 
  out:
 	if (conn_unref) {
@@ -953,11 +1474,20 @@ static struct tcp *tcp_conn_alloc(void)
 	conn->state = TCP_LISTEN;
 
 	conn->recv_win = tcp_window;
+	conn->rto = tcp_rto;
+
+	/* The shift needed to fit the whole window into the 16-bit field;
+	 * used only when the peer negotiates window scaling too.
+	 */
+	while ((conn->recv_win >> conn->recv_win_scale) > UINT16_MAX) {
+		conn->recv_win_scale++;
+	}
 
 	conn->seq = (IS_ENABLED(CONFIG_NET_TEST_PROTOCOL) ||
 		     IS_ENABLED(CONFIG_NET_TEST)) ? 0 : sys_rand32_get();
 
 	sys_slist_init(&conn->send_queue);
+	sys_slist_init(&conn->recv_queue);
 
 	k_delayed_work_init(&conn->send_timer, tcp_send_process);
 
@@ -966,6 +1496,8 @@ static struct tcp *tcp_conn_alloc(void)
 
 	conn->send_data = tcp_pkt_alloc(conn, 0);
 	k_delayed_work_init(&conn->send_data_timer, tcp_resend_data);
+	k_delayed_work_init(&conn->persist_timer, tcp_persist_timeout);
+	k_delayed_work_init(&conn->ack_timer, tcp_ack_timeout);
 
 	k_sem_init(&conn->connect_sem, 0, UINT_MAX);
 	conn->in_connect = false;
@@ -1196,6 +1728,11 @@ static void tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 		conn->send_win = ntohs(th->th_win);
 
+		/* The window field of a SYN is never scaled (RFC 1323) */
+		if (!(fl & SYN)) {
+			conn->send_win <<= conn->send_win_scale;
+		}
+
 #if IS_ENABLED(CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE)
 		if (CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE) {
 			max_win = CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE;
@@ -1218,6 +1755,17 @@ static void tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		}
 	}
 
+	if (th && (fl & SYN) && conn->recv_options.sack_permitted) {
+		conn->sack_enabled = IS_ENABLED(CONFIG_NET_TCP_OOO_QUEUE);
+	}
+
+	if (th && (fl & SYN) && conn->recv_options.wnd_found &&
+	    IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALING)) {
+		/* Largest shift allowed by RFC 1323 */
+		conn->send_win_scale = MIN(conn->recv_options.window, 14);
+		conn->win_scale_enabled = true;
+	}
+
 	if (FL(&fl, &, RST)) {
 		conn_state(conn, TCP_CLOSED);
 	}
@@ -1319,17 +1867,32 @@ next_state:
 
 			conn->send_data_total -= len_acked;
 			conn->unacked_len -= len_acked;
+			if (conn->unacked_len < 0) {
+				/* A zero-window probe byte was accepted */
+				conn->unacked_len = 0;
+			}
 			conn_seq(conn, + len_acked);
+			conn->dup_acks = 0;
+
+			if (conn->rtt_pending &&
+			    net_tcp_seq_cmp(th_ack(th), conn->rtt_seq) >= 0) {
+				conn->rtt_pending = false;
+				tcp_rtt_measure(conn, k_uptime_get_32() -
+						conn->rtt_ts);
+			}
 
 			conn_send_data_dump(conn);
 
-			if (!k_delayed_work_remaining_get(&conn->send_data_timer)) {
+			if (!k_delayed_work_remaining_get(&conn->send_data_timer) &&
+			    !k_delayed_work_remaining_get(&conn->persist_timer)) {
 				NET_DBG("conn: %p, Missing a subscription "
 					"of the send_data queue timer", conn);
 				break;
 			}
 			conn->send_data_retries = 0;
 			k_delayed_work_cancel(&conn->send_data_timer);
+			k_delayed_work_cancel(&conn->persist_timer);
+			conn->persist_retries = 0;
 			if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 				conn->unacked_len = 0;
 			}
@@ -1353,15 +1916,51 @@ next_state:
 			}
 		}
 
+		/* A data-less ACK that advances nothing while data is in
+		 * flight duplicates a previous one: the segment right above
+		 * it was lost.  Retransmit on the third duplicate.
+		 */
+		if (th && (th->th_flags & ACK) && len == 0 &&
+		    conn->unacked_len > 0 && conn->send_win > 0 &&
+		    net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
+			if (conn->dup_acks < UINT8_MAX) {
+				conn->dup_acks++;
+			}
+
+			if (conn->dup_acks == TCP_DUP_ACK_THRESHOLD) {
+				tcp_fast_retransmit(conn);
+			}
+		}
+
+		/* The peer's window reopened while the persist timer was
+		 * probing it: resume normal transmission.
+		 */
+		if (th && conn->send_win > 0 &&
+		    k_delayed_work_remaining_get(&conn->persist_timer)) {
+			k_delayed_work_cancel(&conn->persist_timer);
+			conn->persist_retries = 0;
+
+			ret = tcp_send_queued_data(conn);
+			if (ret < 0 && ret != -ENOBUFS) {
+				tcp_out(conn, RST);
+				conn_state(conn, TCP_CLOSED);
+				break;
+			}
+		}
+
 		if (th && len) {
 			if (th_seq(th) == conn->ack) {
 				if (tcp_data_get(conn, pkt) < 0) {
 					break;
 				}
 				conn_ack(conn, + len);
-				tcp_out(conn, ACK);
+				tcp_recv_queue_deliver(conn);
+				tcp_ack_delayed(conn);
 			} else if (net_tcp_seq_greater(conn->ack, th_seq(th))) {
 				tcp_out(conn, ACK); /* peer has resent */
+			} else if (IS_ENABLED(CONFIG_NET_TCP_OOO_QUEUE)) {
+				tcp_recv_queue_add(conn, pkt, th_seq(th), len);
+				tcp_out(conn, ACK); /* dup ACK, with SACK */
 			}
 		}
 		break;
@@ -1503,6 +2102,85 @@ int net_tcp_update_recv_wnd(struct net_context *context, int32_t delta)
 	return -EPROTONOSUPPORT;
 }
 
+int net_tcp_set_option(struct net_context *context,
+		       enum tcp_conn_option option,
+		       const void *value, size_t len)
+{
+	struct tcp *conn = context->tcp;
+	int val;
+
+	if (!conn) {
+		return -EPROTOTYPE;
+	}
+
+	if (len != sizeof(int) || value == NULL) {
+		return -EINVAL;
+	}
+
+	val = *(int *)value;
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	switch (option) {
+	case TCP_OPT_NODELAY:
+		conn->tcp_nodelay = val ? true : false;
+		break;
+	case TCP_OPT_CORK:
+		conn->tcp_cork = val ? true : false;
+		break;
+	case TCP_OPT_QUICKACK:
+		conn->tcp_quickack = val ? true : false;
+
+		/* Stop holding back the ACK that is already pending */
+		if (conn->tcp_quickack) {
+			tcp_ack_flush(conn);
+		}
+		break;
+	}
+
+	/* Push any data held back by Nagle or a cork */
+	if (!conn->tcp_cork && conn->state == TCP_ESTABLISHED) {
+		(void)tcp_send_queued_data(conn);
+	}
+
+	k_mutex_unlock(&conn->lock);
+
+	return 0;
+}
+
+int net_tcp_get_option(struct net_context *context,
+		       enum tcp_conn_option option,
+		       void *value, size_t *len)
+{
+	struct tcp *conn = context->tcp;
+	int val = 0;
+
+	if (!conn) {
+		return -EPROTOTYPE;
+	}
+
+	if (*len < sizeof(int) || value == NULL) {
+		return -EINVAL;
+	}
+
+	switch (option) {
+	case TCP_OPT_NODELAY:
+		val = conn->tcp_nodelay;
+		break;
+	case TCP_OPT_CORK:
+		val = conn->tcp_cork;
+		break;
+	case TCP_OPT_QUICKACK:
+		val = conn->tcp_quickack;
+		break;
+	}
+
+	*(int *)value = val;
+	*len = sizeof(int);
+
+	return 0;
+}
+
 /* net_context queues the outgoing data for the TCP connection */
 int net_tcp_queue_data(struct net_context *context, struct net_pkt *pkt)
 {
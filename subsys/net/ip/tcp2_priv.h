@@ -96,7 +96,7 @@
 #define conn_send_data_dump(_conn)					\
 ({									\
 	NET_DBG("conn: %p total=%zd, unacked_len=%d, "			\
-		"send_win=%hu, mss=%hu",				\
+		"send_win=%u, mss=%hu",					\
 		(_conn), net_pkt_get_len((_conn)->send_data),		\
 		conn->unacked_len, conn->send_win,			\
 		conn_mss((_conn)));					\
@@ -110,6 +110,8 @@
 #define TCPOPT_NOP	1
 #define TCPOPT_MAXSEG	2
 #define TCPOPT_WINDOW	3
+#define TCPOPT_SACK_PERM	4
+#define TCPOPT_SACK	5
 
 enum pkt_addr {
 	TCP_EP_SRC = 1,
@@ -174,6 +176,7 @@ struct tcp_options {
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_permitted : 1;
 };
 
 struct tcp { /* TCP connection */
@@ -183,6 +186,7 @@ struct tcp { /* TCP connection */
 	struct net_if *iface;
 	void *recv_user_data;
 	sys_slist_t send_queue;
+	sys_slist_t recv_queue; /* out-of-order segments, sorted by seq */
 	net_tcp_accept_cb_t accept_cb;
 	struct k_mutex lock;
 	struct k_sem connect_sem; /* semaphore for blocking connect */
@@ -191,6 +195,8 @@ struct tcp { /* TCP connection */
 	struct k_delayed_work send_data_timer;
 	struct k_delayed_work timewait_timer;
 	struct k_delayed_work fin_timer;
+	struct k_delayed_work persist_timer;
+	struct k_delayed_work ack_timer;
 	union tcp_endpoint src;
 	union tcp_endpoint dst;
 	size_t send_data_total;
@@ -201,12 +207,28 @@ struct tcp { /* TCP connection */
 	enum tcp_data_mode data_mode;
 	uint32_t seq;
 	uint32_t ack;
-	uint16_t recv_win;
-	uint16_t send_win;
+	uint32_t recv_win;
+	uint32_t send_win;
+	uint32_t rto; /* ms, RFC 6298 timeout derived from the measured RTT */
+	uint32_t srtt; /* ms, smoothed round-trip time */
+	uint32_t rttvar; /* ms, round-trip time variation */
+	uint32_t rtt_ts; /* uptime when the timed segment was sent */
+	uint32_t rtt_seq; /* ACK number that acknowledges the timed segment */
+	uint8_t recv_win_scale; /* shift for the window we advertise */
+	uint8_t send_win_scale; /* shift for the window the peer advertises */
 	uint8_t send_data_retries;
+	uint8_t dup_acks;
+	uint8_t persist_retries;
+	uint8_t unacked_segments; /* received data segments not yet ACKed */
 	bool in_retransmission : 1;
 	bool in_connect : 1;
 	bool in_close : 1;
+	bool sack_enabled : 1; /* peer sent SACK permitted option */
+	bool win_scale_enabled : 1; /* window scale negotiated on SYNs */
+	bool tcp_nodelay : 1; /* TCP_NODELAY option, disables Nagle */
+	bool tcp_cork : 1; /* TCP_CORK option, only send full segments */
+	bool rtt_pending : 1; /* a segment is being timed for the RTT */
+	bool tcp_quickack : 1; /* TCP_QUICKACK option, no delayed ACKs */
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -786,6 +786,71 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 }
 #endif
 
+/* TCP connection level options, set from the socket layer */
+enum tcp_conn_option {
+	TCP_OPT_NODELAY = 1,
+	TCP_OPT_CORK = 2,
+	TCP_OPT_QUICKACK = 3,
+};
+
+/**
+ * @brief Set a TCP connection option
+ *
+ * @param context Network context
+ * @param option Option to set
+ * @param value Option value
+ * @param len Option value length
+ *
+ * @return 0 on success, -EINVAL on bad value or length, -EPROTONOSUPPORT
+ *         if the option is not supported by the TCP stack in use
+ */
+#if defined(CONFIG_NET_NATIVE_TCP)
+int net_tcp_set_option(struct net_context *context,
+		       enum tcp_conn_option option,
+		       const void *value, size_t len);
+#else
+static inline int net_tcp_set_option(struct net_context *context,
+				     enum tcp_conn_option option,
+				     const void *value, size_t len)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(option);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -EPROTONOSUPPORT;
+}
+#endif
+
+/**
+ * @brief Get a TCP connection option
+ *
+ * @param context Network context
+ * @param option Option to get
+ * @param value Where to store the option value
+ * @param len Option value length, updated on success
+ *
+ * @return 0 on success, -EINVAL on bad length, -EPROTONOSUPPORT
+ *         if the option is not supported by the TCP stack in use
+ */
+#if defined(CONFIG_NET_NATIVE_TCP)
+int net_tcp_get_option(struct net_context *context,
+		       enum tcp_conn_option option,
+		       void *value, size_t *len);
+#else
+static inline int net_tcp_get_option(struct net_context *context,
+				     enum tcp_conn_option option,
+				     void *value, size_t *len)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(option);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -EPROTONOSUPPORT;
+}
+#endif
+
 #if defined(CONFIG_NET_NATIVE_TCP)
 void net_tcp_init(void);
 #else
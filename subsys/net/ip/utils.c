@@ -22,6 +22,7 @@ LOG_MODULE_REGISTER(net_utils, CONFIG_NET_UTILS_LOG_LEVEL);
 
 #include <net/net_ip.h>
 #include <net/net_pkt.h>
+#include <net/net_context.h>
 #include <net/net_core.h>
 #include <net/socket_can.h>
 
@@ -491,30 +492,55 @@ int z_vrfy_net_addr_pton(sa_family_t family, const char *src,
 
 static uint16_t calc_chksum(uint16_t sum, const uint8_t *data, size_t len)
 {
-	const uint8_t *end;
-	uint16_t tmp;
-
-	end = data + len - 1;
+	const uint8_t *end = data + len;
+	uint64_t acc = 0U;
+
+	/* Accumulate the data as 16-bit words into a 64-bit register,
+	 * four words per iteration, and fold the carries only once at
+	 * the end; an IP length bounded buffer cannot overflow the
+	 * accumulator. UNALIGNED_GET() keeps the loads safe on cores
+	 * without unaligned access support.
+	 */
+	while (data + 8 <= end) {
+		acc += UNALIGNED_GET((const uint16_t *)data);
+		acc += UNALIGNED_GET((const uint16_t *)(data + 2));
+		acc += UNALIGNED_GET((const uint16_t *)(data + 4));
+		acc += UNALIGNED_GET((const uint16_t *)(data + 6));
+		data += 8;
+	}
+
+	while (data + 2 <= end) {
+		acc += UNALIGNED_GET((const uint16_t *)data);
+		data += 2;
+	}
 
-	while (data < end) {
-		tmp = (data[0] << 8) + data[1];
-		sum += tmp;
-		if (sum < tmp) {
-			sum++;
-		}
+	if (data != end) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		acc += *data;
+#else
+		acc += (uint16_t)(*data << 8);
+#endif
+	}
 
-		data += 2;
+	while (acc >> 16) {
+		acc = (acc & 0xffffU) + (acc >> 16);
 	}
 
-	if (data == end) {
-		tmp = data[0] << 8;
-		sum += tmp;
-		if (sum < tmp) {
-			sum++;
-		}
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	/* The words were accumulated in native order and the ones
+	 * complement sum commutes with byte swapping, so one swap at
+	 * the end moves the result into the network order domain the
+	 * callers expect.
+	 */
+	acc = ((acc & 0xffU) << 8) | (acc >> 8);
+#endif
+
+	acc += sum;
+	while (acc >> 16) {
+		acc = (acc & 0xffffU) + (acc >> 16);
 	}
 
-	return sum;
+	return (uint16_t)acc;
 }
 
 static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
@@ -617,6 +643,41 @@ uint16_t net_calc_chksum_ipv4(struct net_pkt *pkt)
 }
 #endif /* CONFIG_NET_IPV4 */
 
+#if defined(CONFIG_NET_RAW_FILTER)
+bool net_raw_filter_ok(const struct net_raw_filter *filter,
+		       struct net_pkt *pkt)
+{
+	struct net_pkt_cursor backup;
+	bool ok = true;
+	uint8_t byte;
+	int i;
+
+	if (!filter || filter->count == 0U) {
+		return true;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+
+	for (i = 0; i < filter->count; i++) {
+		const struct net_raw_filter_rule *rule = &filter->rules[i];
+
+		net_pkt_cursor_init(pkt);
+
+		/* A frame that is too short for the rule never matches */
+		if (net_pkt_skip(pkt, rule->offset) ||
+		    net_pkt_read_u8(pkt, &byte) ||
+		    (byte & rule->mask) != rule->value) {
+			ok = false;
+			break;
+		}
+	}
+
+	net_pkt_cursor_restore(pkt, &backup);
+
+	return ok;
+}
+#endif /* CONFIG_NET_RAW_FILTER */
+
 #if defined(CONFIG_NET_IPV6) || defined(CONFIG_NET_IPV4)
 static bool convert_port(const char *buf, uint16_t *port)
 {
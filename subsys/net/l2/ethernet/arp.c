@@ -23,15 +23,38 @@ LOG_MODULE_REGISTER(net_arp, CONFIG_NET_ARP_LOG_LEVEL);
 #define NET_BUF_TIMEOUT K_MSEC(100)
 #define ARP_REQUEST_TIMEOUT (2 * MSEC_PER_SEC)
 
+#define ARP_TABLE_BUCKETS CONFIG_NET_ARP_TABLE_BUCKETS
+#define ARP_ENTRY_TIMEOUT (CONFIG_NET_ARP_ENTRY_TIMEOUT * MSEC_PER_SEC)
+
 static bool arp_cache_initialized;
 static struct arp_entry arp_entries[CONFIG_NET_ARP_TABLE_SIZE];
 
 static sys_slist_t arp_free_entries;
 static sys_slist_t arp_pending_entries;
-static sys_slist_t arp_table;
+
+/* Resolved entries, hashed by destination IP address so that the
+ * lookup done for every transmitted IPv4 packet stays O(1) however
+ * large the table is.
+ */
+static sys_slist_t arp_table[ARP_TABLE_BUCKETS];
 
 struct k_delayed_work arp_request_timer;
 
+#if CONFIG_NET_ARP_ENTRY_TIMEOUT > 0
+static struct k_delayed_work arp_expiry_timer;
+#endif
+
+static sys_slist_t *arp_table_bucket(struct in_addr *dst)
+{
+	uint32_t hash = ntohl(UNALIGNED_GET(&dst->s_addr));
+
+	/* The low bits of an IPv4 address vary the most on a LAN */
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return &arp_table[hash % ARP_TABLE_BUCKETS];
+}
+
 static void arp_entry_cleanup(struct arp_entry *entry, bool pending)
 {
 	NET_DBG("%p", entry);
@@ -45,6 +68,7 @@ static void arp_entry_cleanup(struct arp_entry *entry, bool pending)
 	}
 
 	entry->iface = NULL;
+	entry->flags = 0U;
 
 	(void)memset(&entry->ip, 0, sizeof(struct in_addr));
 	(void)memset(&entry->eth, 0, sizeof(struct net_eth_addr));
@@ -77,21 +101,22 @@ static struct arp_entry *arp_entry_find(sys_slist_t *list,
 static inline struct arp_entry *arp_entry_find_move_first(struct net_if *iface,
 							  struct in_addr *dst)
 {
+	sys_slist_t *bucket = arp_table_bucket(dst);
 	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
 	NET_DBG("dst %s", log_strdup(net_sprint_ipv4_addr(dst)));
 
-	entry = arp_entry_find(&arp_table, iface, dst, &prev);
+	entry = arp_entry_find(bucket, iface, dst, &prev);
 	if (entry) {
 		/* Let's assume the target is going to be accessed
 		 * more than once here in a short time frame. So we
-		 * place the entry first in position into the table
+		 * place the entry first in position into the bucket
 		 * in order to reduce subsequent find.
 		 */
-		if (&entry->node != sys_slist_peek_head(&arp_table)) {
-			sys_slist_remove(&arp_table, prev, &entry->node);
-			sys_slist_prepend(&arp_table, &entry->node);
+		if (&entry->node != sys_slist_peek_head(bucket)) {
+			sys_slist_remove(bucket, prev, &entry->node);
+			sys_slist_prepend(bucket, &entry->node);
 		}
 	}
 
@@ -143,22 +168,36 @@ static struct arp_entry *arp_entry_get_free(void)
 	return CONTAINER_OF(node, struct arp_entry, node);
 }
 
-static struct arp_entry *arp_entry_get_last_from_table(void)
+static struct arp_entry *arp_entry_get_oldest_from_table(void)
 {
-	sys_snode_t *node;
+	struct arp_entry *victim = NULL;
+	sys_slist_t *victim_bucket = NULL;
+	struct arp_entry *entry;
+	int i;
 
-	/* We assume last entry is the oldest one,
-	 * so is the preferred one to be taken out.
+	/* The least recently confirmed entry is the preferred one to
+	 * be taken out; static entries are never evicted.  This walk
+	 * is O(table size) but only runs when the table is full.
 	 */
+	for (i = 0; i < ARP_TABLE_BUCKETS; i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&arp_table[i], entry, node) {
+			if (entry->flags & NET_ARP_ENTRY_STATIC) {
+				continue;
+			}
 
-	node = sys_slist_peek_tail(&arp_table);
-	if (!node) {
-		return NULL;
+			if (!victim || (int32_t)(entry->req_start -
+						 victim->req_start) < 0) {
+				victim = entry;
+				victim_bucket = &arp_table[i];
+			}
+		}
 	}
 
-	sys_slist_find_and_remove(&arp_table, node);
+	if (victim) {
+		sys_slist_find_and_remove(victim_bucket, &victim->node);
+	}
 
-	return CONTAINER_OF(node, struct arp_entry, node);
+	return victim;
 }
 
 
@@ -206,6 +245,46 @@ static void arp_request_timeout(struct k_work *work)
 	}
 }
 
+#if CONFIG_NET_ARP_ENTRY_TIMEOUT > 0
+static void arp_expiry_timeout(struct k_work *work)
+{
+	uint32_t current = k_uptime_get_32();
+	struct arp_entry *entry, *next;
+	sys_snode_t *prev;
+	int i;
+
+	ARG_UNUSED(work);
+
+	/* One periodic sweep over the whole table replaces per-entry
+	 * timers. An entry is refreshed every time the peer confirms
+	 * its address so only truly stale ones go away here.
+	 */
+	for (i = 0; i < ARP_TABLE_BUCKETS; i++) {
+		prev = NULL;
+
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_table[i], entry, next,
+						  node) {
+			if ((entry->flags & NET_ARP_ENTRY_STATIC) ||
+			    (int32_t)(entry->req_start +
+				      ARP_ENTRY_TIMEOUT - current) > 0) {
+				prev = &entry->node;
+				continue;
+			}
+
+			NET_DBG("Expired %s",
+				log_strdup(net_sprint_ipv4_addr(&entry->ip)));
+
+			arp_entry_cleanup(entry, false);
+
+			sys_slist_remove(&arp_table[i], prev, &entry->node);
+			sys_slist_prepend(&arp_free_entries, &entry->node);
+		}
+	}
+
+	k_delayed_work_submit(&arp_expiry_timer, K_MSEC(ARP_ENTRY_TIMEOUT));
+}
+#endif /* CONFIG_NET_ARP_ENTRY_TIMEOUT > 0 */
+
 static inline struct in_addr *if_get_addr(struct net_if *iface,
 					  struct in_addr *addr)
 {
@@ -359,7 +438,7 @@ struct net_pkt *net_arp_prepare(struct net_pkt *pkt,
 			entry = arp_entry_get_free();
 			if (!entry) {
 				/* Then let's take one from table? */
-				entry = arp_entry_get_last_from_table();
+				entry = arp_entry_get_oldest_from_table();
 			}
 		} else {
 			/* There is a pending already */
@@ -402,7 +481,7 @@ static void arp_gratuitous(struct net_if *iface,
 	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
-	entry = arp_entry_find(&arp_table, iface, src, &prev);
+	entry = arp_entry_find(arp_table_bucket(src), iface, src, &prev);
 	if (entry) {
 		NET_DBG("Gratuitous ARP hwaddr %s -> %s",
 			log_strdup(net_sprint_ll_addr(
@@ -413,6 +492,7 @@ static void arp_gratuitous(struct net_if *iface,
 					   sizeof(struct net_eth_addr))));
 
 		memcpy(&entry->eth, hwaddr, sizeof(struct net_eth_addr));
+		entry->req_start = k_uptime_get_32();
 	}
 }
 
@@ -437,10 +517,12 @@ static void arp_update(struct net_if *iface,
 			sys_snode_t *prev = NULL;
 			struct arp_entry *entry;
 
-			entry = arp_entry_find(&arp_table, iface, src, &prev);
+			entry = arp_entry_find(arp_table_bucket(src), iface,
+					       src, &prev);
 			if (entry) {
 				memcpy(&entry->eth, hwaddr,
 				       sizeof(struct net_eth_addr));
+				entry->req_start = k_uptime_get_32();
 			} else {
 				/* Add new entry as it was not found and force
 				 * was set.
@@ -448,7 +530,7 @@ static void arp_update(struct net_if *iface,
 				entry = arp_entry_get_free();
 				if (!entry) {
 					/* Then let's take one from table? */
-					entry = arp_entry_get_last_from_table();
+					entry = arp_entry_get_oldest_from_table();
 				}
 
 				if (entry) {
@@ -456,7 +538,8 @@ static void arp_update(struct net_if *iface,
 					entry->iface = iface;
 					net_ipaddr_copy(&entry->ip, src);
 					memcpy(&entry->eth, hwaddr, sizeof(entry->eth));
-					sys_slist_prepend(&arp_table, &entry->node);
+					sys_slist_prepend(arp_table_bucket(src),
+							  &entry->node);
 				}
 			}
 		}
@@ -477,9 +560,10 @@ static void arp_update(struct net_if *iface,
 	entry->pending = NULL;
 
 	memcpy(&entry->eth, hwaddr, sizeof(struct net_eth_addr));
+	entry->req_start = k_uptime_get_32();
 
 	/* Inserting entry into the table */
-	sys_slist_prepend(&arp_table, &entry->node);
+	sys_slist_prepend(arp_table_bucket(&entry->ip), &entry->node);
 
 	net_if_queue_tx(iface, pkt);
 }
@@ -671,19 +755,25 @@ void net_arp_clear_cache(struct net_if *iface)
 {
 	sys_snode_t *prev = NULL;
 	struct arp_entry *entry, *next;
+	int i;
 
 	NET_DBG("Flushing ARP table");
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_table, entry, next, node) {
-		if (iface && iface != entry->iface) {
-			prev = &entry->node;
-			continue;
-		}
+	for (i = 0; i < ARP_TABLE_BUCKETS; i++) {
+		prev = NULL;
 
-		arp_entry_cleanup(entry, false);
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_table[i], entry, next,
+						  node) {
+			if (iface && iface != entry->iface) {
+				prev = &entry->node;
+				continue;
+			}
 
-		sys_slist_remove(&arp_table, prev, &entry->node);
-		sys_slist_prepend(&arp_free_entries, &entry->node);
+			arp_entry_cleanup(entry, false);
+
+			sys_slist_remove(&arp_table[i], prev, &entry->node);
+			sys_slist_prepend(&arp_free_entries, &entry->node);
+		}
 	}
 
 	prev = NULL;
@@ -710,17 +800,116 @@ void net_arp_clear_cache(struct net_if *iface)
 
 int net_arp_foreach(net_arp_cb_t cb, void *user_data)
 {
-	int ret = 0;
 	struct arp_entry *entry;
+	int ret = 0;
+	int i;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&arp_table, entry, node) {
-		ret++;
-		cb(entry, user_data);
+	for (i = 0; i < ARP_TABLE_BUCKETS; i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&arp_table[i], entry, node) {
+			ret++;
+			cb(entry, user_data);
+		}
 	}
 
 	return ret;
 }
 
+int net_arp_static_add(struct net_if *iface, struct in_addr *ip,
+		       struct net_eth_addr *eth)
+{
+	sys_slist_t *bucket = arp_table_bucket(ip);
+	sys_snode_t *prev = NULL;
+	struct arp_entry *entry;
+
+	entry = arp_entry_find(bucket, iface, ip, &prev);
+	if (!entry) {
+		entry = arp_entry_get_free();
+		if (!entry) {
+			entry = arp_entry_get_oldest_from_table();
+		}
+
+		if (!entry) {
+			return -ENOMEM;
+		}
+
+		entry->iface = iface;
+		net_ipaddr_copy(&entry->ip, ip);
+		sys_slist_prepend(bucket, &entry->node);
+	}
+
+	memcpy(&entry->eth, eth, sizeof(struct net_eth_addr));
+	entry->req_start = k_uptime_get_32();
+	entry->flags |= NET_ARP_ENTRY_STATIC;
+
+	NET_DBG("Static entry %s [%s]",
+		log_strdup(net_sprint_ipv4_addr(ip)),
+		log_strdup(net_sprint_ll_addr((uint8_t *)eth,
+					      sizeof(struct net_eth_addr))));
+
+	return 0;
+}
+
+static void arp_static_table_load(void)
+{
+	const char *ptr = CONFIG_NET_ARP_STATIC_TABLE;
+
+	/* The table is a comma separated list of "IP MAC" pairs. The
+	 * helpers below expect NUL terminated strings so each token is
+	 * copied out before it is parsed.
+	 */
+	while (*ptr) {
+		char mac_str[sizeof("xx:xx:xx:xx:xx:xx")];
+		char ip_str[NET_IPV4_ADDR_LEN];
+		struct net_eth_addr eth;
+		const char *sep, *end;
+		struct in_addr ip;
+		size_t len;
+
+		sep = strchr(ptr, ' ');
+		if (!sep) {
+			NET_ERR("Invalid static ARP entry \"%s\"",
+				log_strdup(ptr));
+			break;
+		}
+
+		end = strchr(sep, ',');
+		if (!end) {
+			end = sep + strlen(sep);
+		}
+
+		len = sep - ptr;
+		if (len >= sizeof(ip_str) ||
+		    (size_t)(end - sep - 1) >= sizeof(mac_str)) {
+			NET_ERR("Invalid static ARP entry \"%s\"",
+				log_strdup(ptr));
+			break;
+		}
+
+		memcpy(ip_str, ptr, len);
+		ip_str[len] = '\0';
+
+		len = end - sep - 1;
+		memcpy(mac_str, sep + 1, len);
+		mac_str[len] = '\0';
+
+		if (net_addr_pton(AF_INET, ip_str, &ip) < 0 ||
+		    net_bytes_from_str(eth.addr, sizeof(eth.addr),
+				       mac_str) < 0) {
+			NET_ERR("Invalid static ARP entry \"%s %s\"",
+				log_strdup(ip_str), log_strdup(mac_str));
+			break;
+		}
+
+		if (net_arp_static_add(net_if_get_default(), &ip, &eth) < 0) {
+			NET_ERR("Cannot add static ARP entry for %s",
+				log_strdup(ip_str));
+			break;
+		}
+
+		ptr = *end ? end + 1 : end;
+	}
+}
+
 void net_arp_init(void)
 {
 	int i;
@@ -731,7 +920,10 @@ void net_arp_init(void)
 
 	sys_slist_init(&arp_free_entries);
 	sys_slist_init(&arp_pending_entries);
-	sys_slist_init(&arp_table);
+
+	for (i = 0; i < ARP_TABLE_BUCKETS; i++) {
+		sys_slist_init(&arp_table[i]);
+	}
 
 	for (i = 0; i < CONFIG_NET_ARP_TABLE_SIZE; i++) {
 		/* Inserting entry as free */
@@ -740,5 +932,14 @@ void net_arp_init(void)
 
 	k_delayed_work_init(&arp_request_timer, arp_request_timeout);
 
+#if CONFIG_NET_ARP_ENTRY_TIMEOUT > 0
+	k_delayed_work_init(&arp_expiry_timer, arp_expiry_timeout);
+	k_delayed_work_submit(&arp_expiry_timer, K_MSEC(ARP_ENTRY_TIMEOUT));
+#endif
+
 	arp_cache_initialized = true;
+
+	if (sizeof(CONFIG_NET_ARP_STATIC_TABLE) > 1) {
+		arp_static_table_load();
+	}
 }
@@ -49,17 +49,24 @@ struct net_pkt *net_arp_prepare(struct net_pkt *pkt,
 enum net_verdict net_arp_input(struct net_pkt *pkt,
 			       struct net_eth_hdr *eth_hdr);
 
+/* The entry is never aged out or evicted to make room */
+#define NET_ARP_ENTRY_STATIC BIT(0)
+
 struct arp_entry {
 	sys_snode_t node;
 	uint32_t req_start;
 	struct net_if *iface;
 	struct in_addr ip;
+	uint8_t flags;
 	union {
 		struct net_pkt *pending;
 		struct net_eth_addr eth;
 	};
 };
 
+int net_arp_static_add(struct net_if *iface, struct in_addr *ip,
+		       struct net_eth_addr *eth);
+
 typedef void (*net_arp_cb_t)(struct arp_entry *entry,
 			     void *user_data);
 int net_arp_foreach(net_arp_cb_t cb, void *user_data);
@@ -80,6 +87,7 @@ void net_arp_init(void);
 #define net_arp_input(...) NET_OK
 #define net_arp_clear_cache(...)
 #define net_arp_foreach(...) 0
+#define net_arp_static_add(...) -ENOTSUP
 #define net_arp_init(...)
 
 #endif /* CONFIG_NET_ARP */
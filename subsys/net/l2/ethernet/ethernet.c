@@ -555,16 +555,15 @@ static void ethernet_remove_l2_header(struct net_pkt *pkt)
 	net_pkt_frag_unref(buf);
 }
 
-static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
+static int ethernet_prepare(struct net_if *iface, struct net_pkt **pktp)
 {
 	const struct ethernet_api *api = net_if_get_device(iface)->api;
 	struct ethernet_context *ctx = net_if_l2_data(iface);
+	struct net_pkt *pkt = *pktp;
 	uint16_t ptype;
-	int ret;
 
 	if (!api) {
-		ret = -ENOENT;
-		goto error;
+		return -ENOENT;
 	}
 
 	if (IS_ENABLED(CONFIG_NET_IPV4) &&
@@ -576,13 +575,12 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		} else {
 			tmp = ethernet_ll_prepare_on_ipv4(iface, pkt);
 			if (!tmp) {
-				ret = -ENOMEM;
-				goto error;
+				return -ENOMEM;
 			} else if (IS_ENABLED(CONFIG_NET_ARP) && tmp != pkt) {
 				/* Original pkt got queued and is replaced
 				 * by an ARP request packet.
 				 */
-				pkt = tmp;
+				pkt = *pktp = tmp;
 				ptype = htons(NET_ETH_PTYPE_ARP);
 				net_pkt_set_family(pkt, AF_INET);
 			} else {
@@ -614,7 +612,8 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 						sizeof(struct net_eth_addr);
 			ptype = dst_addr->sll_protocol;
 		} else {
-			goto send;
+			/* Raw packet, the L2 header is already in place */
+			return 0;
 		}
 	} else if (IS_ENABLED(CONFIG_NET_GPTP) && net_pkt_is_gptp(pkt)) {
 		ptype = htons(NET_ETH_PTYPE_PTP);
@@ -626,8 +625,7 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		ptype = htons(NET_ETH_PTYPE_ARP);
 		net_pkt_set_family(pkt, AF_INET);
 	} else {
-		ret = -ENOTSUP;
-		goto error;
+		return -ENOTSUP;
 	}
 
 	/* If the ll dst addr has not been set before, let's assume
@@ -642,8 +640,7 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 	if (IS_ENABLED(CONFIG_NET_VLAN) &&
 	    net_eth_is_vlan_enabled(ctx, iface)) {
 		if (set_vlan_tag(ctx, iface, pkt) == NET_DROP) {
-			ret = -EINVAL;
-			goto error;
+			return -EINVAL;
 		}
 
 		set_vlan_priority(ctx, pkt);
@@ -652,30 +649,97 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 	/* Then set the ethernet header.
 	 */
 	if (!ethernet_fill_header(ctx, pkt, ptype)) {
-		ret = -ENOMEM;
-		goto error;
+		return -ENOMEM;
 	}
 
 	net_pkt_cursor_init(pkt);
 
-send:
-	ret = api->send(net_if_get_device(iface), pkt);
-	if (ret != 0) {
+	return 0;
+}
+
+static int ethernet_finish(struct net_if *iface, struct net_pkt *pkt,
+			   int status)
+{
+	if (status != 0) {
 		eth_stats_update_errors_tx(iface);
 		ethernet_remove_l2_header(pkt);
-		goto error;
+		return status;
 	}
 
 	ethernet_update_tx_stats(iface, pkt);
 
-	ret = net_pkt_get_len(pkt);
+	status = net_pkt_get_len(pkt);
 	ethernet_remove_l2_header(pkt);
 
 	net_pkt_unref(pkt);
-error:
-	return ret;
+
+	return status;
 }
 
+static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	const struct ethernet_api *api = net_if_get_device(iface)->api;
+	int ret;
+
+	ret = ethernet_prepare(iface, &pkt);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = api->send(net_if_get_device(iface), pkt);
+
+	return ethernet_finish(iface, pkt, ret);
+}
+
+#if defined(CONFIG_NET_TX_BATCH)
+int net_eth_tx_batch(struct net_if *iface, struct net_pkt **pkts, int count)
+{
+	const struct ethernet_api *api = net_if_get_device(iface)->api;
+	int i, ret, ready = 0, bytes = 0;
+
+	if (!api || !api->send_batch) {
+		for (i = 0; i < count; i++) {
+			ret = ethernet_send(iface, pkts[i]);
+			if (ret < 0) {
+				net_pkt_unref(pkts[i]);
+			} else {
+				bytes += ret;
+			}
+		}
+
+		return bytes;
+	}
+
+	for (i = 0; i < count; i++) {
+		struct net_pkt *pkt = pkts[i];
+
+		if (ethernet_prepare(iface, &pkt) < 0) {
+			net_pkt_unref(pkts[i]);
+			continue;
+		}
+
+		pkts[ready++] = pkt;
+	}
+
+	if (ready == 0) {
+		return -EIO;
+	}
+
+	ret = api->send_batch(net_if_get_device(iface), pkts, ready);
+
+	for (i = 0; i < ready; i++) {
+		if (ret != 0) {
+			ethernet_finish(iface, pkts[i], ret);
+			net_pkt_unref(pkts[i]);
+		} else {
+			bytes += ethernet_finish(iface, pkts[i], 0);
+		}
+	}
+
+	return ret != 0 ? ret : bytes;
+}
+#endif /* CONFIG_NET_TX_BATCH */
+
 static inline int ethernet_enable(struct net_if *iface, bool state)
 {
 	const struct ethernet_api *eth =
@@ -1127,6 +1191,30 @@ int net_eth_promisc_mode(struct net_if *iface, bool enable)
 			&params, sizeof(struct ethernet_req_params));
 }
 
+#if defined(CONFIG_NET_L2_ETHERNET_RX_ZEROCOPY)
+int net_eth_recv_buf(struct net_if *iface, struct net_buf *buf, size_t len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = net_pkt_rx_alloc_on_iface(iface, K_NO_WAIT);
+	if (!pkt) {
+		net_buf_unref(buf);
+		return -ENOMEM;
+	}
+
+	net_buf_add(buf, len);
+	net_pkt_append_buffer(pkt, buf);
+
+	ret = net_recv_data(iface, pkt);
+	if (ret < 0) {
+		net_pkt_unref(pkt);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_NET_L2_ETHERNET_RX_ZEROCOPY */
+
 void ethernet_init(struct net_if *iface)
 {
 	struct ethernet_context *ctx = net_if_l2_data(iface);
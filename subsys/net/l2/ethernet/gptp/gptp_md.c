@@ -38,21 +38,6 @@ static void gptp_md_follow_up_prepare(struct net_pkt *pkt,
 	hdr = GPTP_HDR(pkt);
 	fup = GPTP_FOLLOW_UP(pkt);
 
-	/*
-	 * Compute correction field according to IEEE802.1AS 11.2.14.2.3.
-	 *
-	 * The correction_field already contains the timestamp of the sync
-	 * message.
-	 *
-	 * TODO: if the value to be stored in correction_field is too big to
-	 * be represented, the field should be set to all 1's except the most
-	 * significant bit.
-	 */
-	hdr->correction_field -= sync_send->upstream_tx_time;
-	hdr->correction_field *= sync_send->rate_ratio;
-	hdr->correction_field += sync_send->follow_up_correction_field;
-	hdr->correction_field <<= 16;
-
 	memcpy(&hdr->port_id.clk_id, &sync_send->src_port_id.clk_id,
 	       GPTP_CLOCK_ID_LEN);
 
@@ -91,6 +76,29 @@ static void gptp_md_follow_up_prepare(struct net_pkt *pkt,
 		ntohl(fup->tlv.scaled_last_gm_freq_change);
 }
 
+static void gptp_md_follow_up_correct(struct net_pkt *pkt,
+				      struct gptp_md_sync_info *sync_send,
+				      struct net_pkt *sync)
+{
+	struct gptp_hdr *hdr;
+
+	hdr = GPTP_HDR(pkt);
+
+	/*
+	 * Compute correction field according to IEEE802.1AS 11.2.14.2.3,
+	 * starting from the transmit timestamp of the sync message.
+	 *
+	 * TODO: if the value to be stored in correction_field is too big to
+	 * be represented, the field should be set to all 1's except the most
+	 * significant bit.
+	 */
+	hdr->correction_field = gptp_timestamp_to_nsec(&sync->timestamp);
+	hdr->correction_field -= sync_send->upstream_tx_time;
+	hdr->correction_field *= sync_send->rate_ratio;
+	hdr->correction_field += sync_send->follow_up_correction_field;
+	hdr->correction_field <<= 16;
+}
+
 static int gptp_set_md_sync_receive(int port,
 				    struct gptp_md_sync_info *sync_rcv)
 {
@@ -846,18 +854,40 @@ static void gptp_md_sync_send_state_machine(int port)
 
 	case GPTP_SYNC_SEND_SEND_SYNC:
 		if (state->rcvd_md_sync) {
+			state->rcvd_md_sync = false;
+
 			pkt = gptp_prepare_sync(port);
-			if (pkt) {
-				/* Reference message to track timestamp info */
-				state->sync_ptr = net_pkt_ref(pkt);
-				gptp_md_sync_prepare(pkt,
-						     state->sync_send_ptr,
-						     port);
-				gptp_send_sync(port, pkt);
+			if (!pkt) {
+				break;
 			}
 
-			state->rcvd_md_sync = false;
+			/* Reference message to track timestamp info */
+			state->sync_ptr = net_pkt_ref(pkt);
+			gptp_md_sync_prepare(pkt,
+					     state->sync_send_ptr,
+					     port);
+
+			/* Generate the follow up in advance so that only
+			 * the correction field is left to fill in once the
+			 * transmit timestamp of the sync is delivered.
+			 */
+			state->sync_fup_ptr =
+				gptp_prepare_follow_up(port, state->sync_ptr);
+			if (state->sync_fup_ptr) {
+				gptp_md_follow_up_prepare(state->sync_fup_ptr,
+							  state->sync_send_ptr,
+							  port);
+			}
+
+			/* Change the state before sending: the driver may
+			 * deliver the timestamp from the transmit path, in
+			 * which case gptp_md_follow_up_send() runs before
+			 * gptp_send_sync() returns and moves the state
+			 * machine back to SEND_SYNC.
+			 */
 			state->state = GPTP_SYNC_SEND_SEND_FUP;
+
+			gptp_send_sync(port, pkt);
 		}
 
 		break;
@@ -871,12 +901,23 @@ static void gptp_md_sync_send_state_machine(int port)
 				break;
 			}
 
-			pkt = gptp_prepare_follow_up(port, state->sync_ptr);
+			pkt = state->sync_fup_ptr;
+			if (!pkt) {
+				pkt = gptp_prepare_follow_up(port,
+							     state->sync_ptr);
+				if (pkt) {
+					gptp_md_follow_up_prepare(pkt,
+							state->sync_send_ptr,
+							port);
+				}
+			}
+
 			if (pkt) {
-				gptp_md_follow_up_prepare(pkt,
-							 state->sync_send_ptr,
-							 port);
+				gptp_md_follow_up_correct(pkt,
+							  state->sync_send_ptr,
+							  state->sync_ptr);
 				gptp_send_follow_up(port, pkt);
+				state->sync_fup_ptr = NULL;
 			}
 
 			net_pkt_unref(state->sync_ptr);
@@ -889,6 +930,31 @@ static void gptp_md_sync_send_state_machine(int port)
 	}
 }
 
+void gptp_md_follow_up_send(int port)
+{
+	struct gptp_sync_send_state *state;
+
+	state = &GPTP_PORT_STATE(port)->sync_send;
+
+	if (!state->sync_fup_ptr || !state->sync_ptr) {
+		/* The follow up could not be generated in advance: let the
+		 * state machine build and send it on its next pass.
+		 */
+		state->md_sync_timestamp_avail = true;
+		return;
+	}
+
+	gptp_md_follow_up_correct(state->sync_fup_ptr, state->sync_send_ptr,
+				  state->sync_ptr);
+	gptp_send_follow_up(port, state->sync_fup_ptr);
+	state->sync_fup_ptr = NULL;
+
+	net_pkt_unref(state->sync_ptr);
+	state->sync_ptr = NULL;
+
+	state->state = GPTP_SYNC_SEND_SEND_SYNC;
+}
+
 void gptp_md_state_machines(int port)
 {
 	gptp_md_pdelay_req_state_machine(port);
@@ -66,6 +66,17 @@ void gptp_md_init_state_machine(void);
  */
 void gptp_md_state_machines(int port);
 
+/**
+ * @brief Send the follow up generated for the last sync message.
+ *
+ * This is called from the timestamp callback as soon as the transmit
+ * timestamp of the sync message is known, so that the follow up does not
+ * have to wait for the next state machine pass.
+ *
+ * @param port Number of the port the sync message was sent on.
+ */
+void gptp_md_follow_up_send(int port);
+
 #ifdef __cplusplus
 }
 #endif
@@ -81,7 +81,6 @@ struct gptp_hdr *gptp_get_hdr(struct net_pkt *pkt)
 static void gptp_sync_timestamp_callback(struct net_pkt *pkt)
 {
 	int port = 0;
-	struct gptp_sync_send_state *state;
 	struct gptp_hdr *hdr;
 
 	port = gptp_get_port_number(net_pkt_iface(pkt));
@@ -90,13 +89,11 @@ static void gptp_sync_timestamp_callback(struct net_pkt *pkt)
 		return;
 	}
 
-	state = &GPTP_PORT_STATE(port)->sync_send;
-
 	hdr = GPTP_HDR(pkt);
 
-	/* If this buffer is a sync, flag it to the state machine. */
+	/* If this buffer is a sync, send the pre-generated follow up. */
 	if (hdr->message_type == GPTP_SYNC_MESSAGE) {
-		state->md_sync_timestamp_avail = true;
+		gptp_md_follow_up_send(port);
 
 		net_if_unregister_timestamp_cb(&sync_timestamp_cb);
 		sync_cb_registered = false;
@@ -269,8 +266,10 @@ struct net_pkt *gptp_prepare_follow_up(int port, struct net_pkt *sync)
 	hdr->ptp_version = GPTP_VERSION;
 	hdr->sequence_id = sync_hdr->sequence_id;
 	hdr->domain_number = 0U;
-	/* Store timestamp value in correction field. */
-	hdr->correction_field = gptp_timestamp_to_nsec(&sync->timestamp);
+	/* Correction field is set once the sync transmit timestamp
+	 * is known, see gptp_md_follow_up_correct().
+	 */
+	hdr->correction_field = 0;
 	hdr->flags.octets[0] = 0U;
 	hdr->flags.octets[1] = GPTP_FLAG_PTP_TIMESCALE;
 	hdr->message_length = htons(sizeof(struct gptp_hdr) +
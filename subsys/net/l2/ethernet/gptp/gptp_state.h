@@ -261,6 +261,9 @@ struct gptp_sync_send_state {
 	/** Pointer to the sync message to be sent. */
 	struct net_pkt *sync_ptr;
 
+	/** Pointer to the follow up message generated in advance. */
+	struct net_pkt *sync_fup_ptr;
+
 	/** Current state of the state machine. */
 	enum gptp_sync_send_states state;
 
@@ -768,6 +768,18 @@ no_security_hdr:
 
 	dbg_print_fs(fs);
 
+#ifdef CONFIG_NET_L2_IEEE802154_SECURITY
+	/* When the radio secures outgoing frames itself, the CCM* run
+	 * is left to it. The frame counter still advances here as the
+	 * auxiliary security header above carries it.
+	 */
+	if (!broadcast && ctx->sec_ctx.radio_offload &&
+	    ctx->sec_ctx.level != IEEE802154_SECURITY_LEVEL_NONE) {
+		ctx->sec_ctx.frame_counter++;
+		return true;
+	}
+#endif
+
 	/* Let's encrypt/auth only in the end, is needed */
 	return ieee802154_encrypt_auth(broadcast ? NULL : &ctx->sec_ctx,
 				       buf_start, hdr_size, buf->len,
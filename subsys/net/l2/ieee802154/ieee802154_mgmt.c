@@ -526,6 +526,31 @@ static int ieee802154_set_security_settings(uint32_t mgmt_request,
 		return -EINVAL;
 	}
 
+	/* If the radio secures outgoing frames itself, hand it the key
+	 * material once here so that no per-frame cipher run is needed.
+	 */
+	ctx->sec_ctx.radio_offload = 0U;
+
+	if (ieee802154_get_hw_capabilities(iface) &
+	    IEEE802154_HW_TX_SECURITY) {
+		struct ieee802154_config config = {
+			.frame_security = {
+				.key = ctx->sec_ctx.key,
+				.key_len = ctx->sec_ctx.key_len,
+				.key_mode = ctx->sec_ctx.key_mode,
+				.level = ctx->sec_ctx.level,
+				.frame_counter = ctx->sec_ctx.frame_counter,
+			},
+		};
+
+		if (!ieee802154_configure(iface,
+					  IEEE802154_CONFIG_FRAME_SECURITY,
+					  &config)) {
+			NET_DBG("Frame security offloaded to the radio");
+			ctx->sec_ctx.radio_offload = 1U;
+		}
+	}
+
 	return 0;
 }
 
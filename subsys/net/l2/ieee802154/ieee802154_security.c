@@ -173,13 +173,30 @@ bool ieee802154_encrypt_auth(struct ieee802154_security_ctx *sec_ctx,
 
 int ieee802154_security_init(struct ieee802154_security_ctx *sec_ctx)
 {
-	const struct device *dev;
+	const struct device *dev = NULL;
 
 	(void)memset(&sec_ctx->enc, 0, sizeof(struct cipher_ctx));
 	(void)memset(&sec_ctx->dec, 0, sizeof(struct cipher_ctx));
 
-	dev = device_get_binding(
-		CONFIG_NET_L2_IEEE802154_SECURITY_CRYPTO_DEV_NAME);
+	/* Prefer the configured device so that hardware AES-CCM engines
+	 * are used when present, and fall back to the software shim.
+	 */
+	if (sizeof(CONFIG_NET_L2_IEEE802154_SECURITY_CRYPTO_DEV_NAME) > 1) {
+		dev = device_get_binding(
+			CONFIG_NET_L2_IEEE802154_SECURITY_CRYPTO_DEV_NAME);
+		if (!dev) {
+			NET_WARN("Crypto device %s not found, "
+				 "using software fallback",
+				 CONFIG_NET_L2_IEEE802154_SECURITY_CRYPTO_DEV_NAME);
+		}
+	}
+
+#if defined(CONFIG_CRYPTO_MBEDTLS_SHIM)
+	if (!dev) {
+		dev = device_get_binding(CONFIG_CRYPTO_MBEDTLS_SHIM_DRV_NAME);
+	}
+#endif
+
 	if (!dev) {
 		return -ENODEV;
 	}
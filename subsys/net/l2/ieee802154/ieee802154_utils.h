@@ -27,6 +27,20 @@ enum ieee802154_hw_caps ieee802154_get_hw_capabilities(struct net_if *iface)
 	return radio->get_capabilities(net_if_get_device(iface));
 }
 
+static inline int ieee802154_configure(struct net_if *iface,
+				       enum ieee802154_config_type type,
+				       const struct ieee802154_config *config)
+{
+	const struct ieee802154_radio_api *radio =
+		net_if_get_device(iface)->api;
+
+	if (!radio || !radio->configure) {
+		return -ENOENT;
+	}
+
+	return radio->configure(net_if_get_device(iface), type, config);
+}
+
 static inline int ieee802154_cca(struct net_if *iface)
 {
 	const struct ieee802154_radio_api *radio =
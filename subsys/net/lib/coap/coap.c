@@ -1070,6 +1070,20 @@ size_t coap_next_block(const struct coap_packet *cpkt,
 	return ctx->current;
 }
 
+size_t coap_block_advance(struct coap_block_context *ctx)
+{
+	uint16_t block_size = coap_block_size_to_bytes(ctx->block_size);
+
+	if (ctx->total_size &&
+	    ctx->current + block_size >= ctx->total_size) {
+		return 0;
+	}
+
+	ctx->current += block_size;
+
+	return ctx->current;
+}
+
 int coap_pending_init(struct coap_pending *pending,
 		      const struct coap_packet *request,
 		      const struct sockaddr *addr)
@@ -1083,6 +1097,7 @@ int coap_pending_init(struct coap_pending *pending,
 	pending->data = request->data;
 	pending->len = request->offset;
 	pending->t0 = k_uptime_get_32();
+	pending->retries = CONFIG_COAP_MAX_RETRANSMIT;
 
 	return 0;
 }
@@ -1194,37 +1209,41 @@ struct coap_pending *coap_pending_next_to_expire(
 	return found;
 }
 
-/* TODO: random generated initial ACK timeout
- * ACK_TIMEOUT < INIT_ACK_TIMEOUT < ACK_TIMEOUT * ACK_RANDOM_FACTOR
- * where ACK_TIMEOUT = 2 and ACK_RANDOM_FACTOR = 1.5 by default
- * Ref: https://tools.ietf.org/html/rfc7252#section-4.8
- */
 #define INIT_ACK_TIMEOUT	CONFIG_COAP_INIT_ACK_TIMEOUT_MS
 
-static int32_t next_timeout(int32_t previous)
+static uint32_t init_ack_timeout(void)
 {
-	switch (previous) {
-	case INIT_ACK_TIMEOUT:
-	case (INIT_ACK_TIMEOUT * 2):
-	case (INIT_ACK_TIMEOUT * 4):
-		return previous << 1;
-	case (INIT_ACK_TIMEOUT * 8):
-		/* equal value is returned to end retransmit */
-		return previous;
-	}
-
-	/* initial or unrecognized */
+#if defined(CONFIG_COAP_RANDOMIZE_ACK_TIMEOUT)
+	/* Randomly generated initial ACK timeout
+	 * ACK_TIMEOUT < INIT_ACK_TIMEOUT < ACK_TIMEOUT * ACK_RANDOM_FACTOR
+	 * where ACK_TIMEOUT = 2 and ACK_RANDOM_FACTOR = 1.5 by default
+	 * Ref: https://tools.ietf.org/html/rfc7252#section-4.8
+	 */
+	return INIT_ACK_TIMEOUT +
+	       (sys_rand32_get() % (INIT_ACK_TIMEOUT / 2));
+#else
 	return INIT_ACK_TIMEOUT;
+#endif /* defined(CONFIG_COAP_RANDOMIZE_ACK_TIMEOUT) */
 }
 
 bool coap_pending_cycle(struct coap_pending *pending)
 {
-	int32_t old = pending->timeout;
+	if (pending->timeout == 0) {
+		/* Initial transmission. */
+		pending->timeout = init_ack_timeout();
+
+		return true;
+	}
+
+	if (pending->retries == 0) {
+		return false;
+	}
 
 	pending->t0 += pending->timeout;
-	pending->timeout = next_timeout(pending->timeout);
+	pending->timeout = pending->timeout << 1;
+	pending->retries--;
 
-	return (old != pending->timeout);
+	return true;
 }
 
 void coap_pending_clear(struct coap_pending *pending)
@@ -98,11 +98,19 @@ static void ipv4_addr_add_handler(struct net_mgmt_event_callback *cb,
 
 static void setup_dhcpv4(struct net_if *iface)
 {
+	/* The same callback serves all the interfaces, register it
+	 * only once.
+	 */
+	static bool cb_registered;
+
 	NET_INFO("Running dhcpv4 client...");
 
-	net_mgmt_init_event_callback(&mgmt4_cb, ipv4_addr_add_handler,
-				     NET_EVENT_IPV4_ADDR_ADD);
-	net_mgmt_add_event_callback(&mgmt4_cb);
+	if (!cb_registered) {
+		net_mgmt_init_event_callback(&mgmt4_cb, ipv4_addr_add_handler,
+					     NET_EVENT_IPV4_ADDR_ADD);
+		net_mgmt_add_event_callback(&mgmt4_cb);
+		cb_registered = true;
+	}
 
 	net_dhcpv4_start(iface);
 }
@@ -246,6 +254,10 @@ static void ipv6_event_handler(struct net_mgmt_event_callback *cb,
 
 static void setup_ipv6(struct net_if *iface, uint32_t flags)
 {
+	/* The same callback serves all the interfaces, register it
+	 * only once.
+	 */
+	static bool cb_registered;
 	struct net_if_addr *ifaddr;
 	uint32_t mask = NET_EVENT_IPV6_DAD_SUCCEED;
 
@@ -264,8 +276,12 @@ static void setup_ipv6(struct net_if *iface, uint32_t flags)
 		mask |= NET_EVENT_IPV6_ROUTER_ADD;
 	}
 
-	net_mgmt_init_event_callback(&mgmt6_cb, ipv6_event_handler, mask);
-	net_mgmt_add_event_callback(&mgmt6_cb);
+	if (!cb_registered) {
+		net_mgmt_init_event_callback(&mgmt6_cb, ipv6_event_handler,
+					     mask);
+		net_mgmt_add_event_callback(&mgmt6_cb);
+		cb_registered = true;
+	}
 
 	/*
 	 * check for CMD_ADDR_ADD bit here, NET_EVENT_IPV6_ADDR_ADD is
@@ -296,6 +312,39 @@ exit:
 #define setup_ipv6(...)
 #endif /* CONFIG_NET_IPV6 */
 
+static void setup_iface(struct net_if *iface, uint32_t flags)
+{
+	setup_ipv4(iface);
+	setup_dhcpv4(iface);
+	setup_ipv6(iface, flags);
+}
+
+#if defined(CONFIG_NET_NATIVE)
+static struct net_mgmt_event_callback mgmt_all_ifaces_cb;
+static uint32_t all_ifaces_flags;
+
+static void iface_up_all_handler(struct net_mgmt_event_callback *cb,
+				 uint32_t mgmt_event, struct net_if *iface)
+{
+	if (mgmt_event != NET_EVENT_IF_UP) {
+		return;
+	}
+
+	NET_INFO("Interface %d (%p) coming up",
+		 net_if_get_by_iface(iface), iface);
+
+	setup_iface(iface, all_ifaces_flags);
+	k_sem_give(&waiter);
+}
+#endif
+
+static void setup_iface_if_up(struct net_if *iface, void *user_data)
+{
+	if (net_if_is_up(iface)) {
+		setup_iface(iface, *(uint32_t *)user_data);
+	}
+}
+
 #if defined(CONFIG_NET_NATIVE)
 static void iface_up_handler(struct net_mgmt_event_callback *cb,
 			     uint32_t mgmt_event, struct net_if *iface)
@@ -395,9 +444,7 @@ int net_config_init_by_iface(struct net_if *iface, const char *app_info,
 		return -ENETDOWN;
 	}
 
-	setup_ipv4(iface);
-	setup_dhcpv4(iface);
-	setup_ipv6(iface, flags);
+	setup_iface(iface, flags);
 
 	/* Loop here until we are ready to continue. As we might need
 	 * to wait multiple events, sleep smaller amounts of data.
@@ -414,6 +461,54 @@ int net_config_init_by_iface(struct net_if *iface, const char *app_info,
 	return 0;
 }
 
+int net_config_init_all(const char *app_info, uint32_t flags, int32_t timeout)
+{
+	int loop = timeout / LOOP_DIVIDER;
+	int count;
+
+	if (app_info) {
+		NET_INFO("%s", log_strdup(app_info));
+	}
+
+	if (timeout < 0) {
+		count = -1;
+	} else if (timeout == 0) {
+		count = 0;
+	} else {
+		count = timeout / 1000 + 1;
+	}
+
+#if defined(CONFIG_NET_NATIVE)
+	/* Instead of serially waiting for one interface at a time,
+	 * configure every interface as soon as it comes up and wait
+	 * for the required services on the aggregate below.
+	 */
+	all_ifaces_flags = flags;
+
+	net_mgmt_init_event_callback(&mgmt_all_ifaces_cb, iface_up_all_handler,
+				     NET_EVENT_IF_UP);
+	net_mgmt_add_event_callback(&mgmt_all_ifaces_cb);
+#endif
+
+	/* Interfaces that are already up can be configured right away */
+	net_if_foreach(setup_iface_if_up, &flags);
+
+	while (!services_are_ready(flags) && count-- > 0) {
+		k_sem_take(&waiter, K_MSEC(loop));
+	}
+
+#if defined(CONFIG_NET_NATIVE)
+	net_mgmt_del_event_callback(&mgmt_all_ifaces_cb);
+#endif
+
+	if (count == -1 && timeout > 0) {
+		NET_ERR("Timeout while waiting network %s", "setup");
+		return -ETIMEDOUT;
+	}
+
+	return 0;
+}
+
 int net_config_init(const char *app_info, uint32_t flags,
 		    int32_t timeout)
 {
@@ -460,8 +555,13 @@ int net_config_init_app(const struct device *dev, const char *app_info)
 	}
 
 	/* Initialize the application automatically if needed */
-	ret = net_config_init_by_iface(iface, app_info, flags,
+	if (IS_ENABLED(CONFIG_NET_CONFIG_INIT_ALL_IFACES)) {
+		ret = net_config_init_all(app_info, flags,
+				CONFIG_NET_CONFIG_INIT_TIMEOUT * MSEC_PER_SEC);
+	} else {
+		ret = net_config_init_by_iface(iface, app_info, flags,
 				CONFIG_NET_CONFIG_INIT_TIMEOUT * MSEC_PER_SEC);
+	}
 	if (ret < 0) {
 		NET_ERR("Network initialization failed (%d)", ret);
 	}
@@ -83,6 +83,151 @@ static int dns_write(struct dns_resolve_context *ctx,
 		     struct net_buf *dns_qname,
 		     int hop_limit);
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+/* Cached answer, keyed by the query name and type. The entry is valid
+ * until the TTL returned by the DNS server has passed, so the expiry is
+ * stored as an absolute uptime value. A negative entry remembers that
+ * the name had no address so that we do not ask the server again
+ * right away.
+ */
+struct dns_cache_entry {
+	struct dns_addrinfo info;
+	int64_t expires;
+	enum dns_query_type query_type;
+	char query[DNS_MAX_NAME_LEN + 1];
+	bool negative;
+	bool in_use;
+};
+
+static struct dns_cache_entry dns_cache[CONFIG_DNS_RESOLVER_CACHE_ENTRIES];
+static K_MUTEX_DEFINE(dns_cache_lock);
+
+static int dns_cache_lookup(const char *query,
+			    enum dns_query_type type,
+			    struct dns_addrinfo *info,
+			    bool *negative)
+{
+	int64_t now = k_uptime_get();
+	int ret = -ENOENT;
+	int i;
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_ENTRIES; i++) {
+		if (!dns_cache[i].in_use) {
+			continue;
+		}
+
+		if (now >= dns_cache[i].expires) {
+			dns_cache[i].in_use = false;
+			continue;
+		}
+
+		if (dns_cache[i].query_type != type ||
+		    strcmp(dns_cache[i].query, query) != 0) {
+			continue;
+		}
+
+		memcpy(info, &dns_cache[i].info, sizeof(*info));
+		*negative = dns_cache[i].negative;
+		ret = 0;
+		break;
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+
+	return ret;
+}
+
+static void dns_cache_add(const char *query,
+			  enum dns_query_type type,
+			  const struct dns_addrinfo *info,
+			  uint32_t ttl)
+{
+	struct dns_cache_entry *entry = NULL;
+	int64_t now = k_uptime_get();
+	int i;
+
+	if (!info) {
+		/* Negative caching, the lifetime is our own choice as
+		 * there is no RR to take the TTL from.
+		 */
+		ttl = CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL;
+	}
+
+	/* The unit test calls dns_validate_msg() directly without a
+	 * pending query, and a zero TTL means the answer must not be
+	 * reused.
+	 */
+	if (!query || ttl == 0U || strlen(query) > DNS_MAX_NAME_LEN) {
+		return;
+	}
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	/* Refresh an existing entry for the same name, or take a free
+	 * slot. If all slots are taken, evict the entry that is the
+	 * closest to its expiry.
+	 */
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_ENTRIES; i++) {
+		if (dns_cache[i].in_use && now < dns_cache[i].expires &&
+		    dns_cache[i].query_type == type &&
+		    strcmp(dns_cache[i].query, query) == 0) {
+			entry = &dns_cache[i];
+			break;
+		}
+
+		if (!entry || !dns_cache[i].in_use ||
+		    (entry->in_use && dns_cache[i].expires < entry->expires)) {
+			entry = &dns_cache[i];
+		}
+	}
+
+	if (info) {
+		memcpy(&entry->info, info, sizeof(entry->info));
+		entry->negative = false;
+	} else {
+		memset(&entry->info, 0, sizeof(entry->info));
+		entry->negative = true;
+	}
+
+	strcpy(entry->query, query);
+	entry->query_type = type;
+	entry->expires = now + MSEC_PER_SEC * (int64_t)ttl;
+	entry->in_use = true;
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_resolve_cache_flush(void)
+{
+	int i;
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (i = 0; i < CONFIG_DNS_RESOLVER_CACHE_ENTRIES; i++) {
+		dns_cache[i].in_use = false;
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+#else /* CONFIG_DNS_RESOLVER_CACHE */
+static inline int dns_cache_lookup(const char *query,
+				   enum dns_query_type type,
+				   struct dns_addrinfo *info,
+				   bool *negative)
+{
+	return -ENOENT;
+}
+
+static inline void dns_cache_add(const char *query,
+				 enum dns_query_type type,
+				 const struct dns_addrinfo *info,
+				 uint32_t ttl)
+{
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 static bool server_is_mdns(sa_family_t family, struct sockaddr *addr)
 {
 	if (family == AF_INET) {
@@ -369,7 +514,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		     uint16_t *query_hash)
 {
 	struct dns_addrinfo info = { 0 };
-	uint32_t ttl; /* RR ttl, so far it is not passed to caller */
+	uint32_t ttl; /* RR ttl, used to age the response cache */
 	uint8_t *src, *addr;
 	const char *query_name;
 	int address_size;
@@ -528,6 +673,10 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 			src = dns_msg->msg + dns_msg->response_position;
 			memcpy(addr, src, address_size);
 
+			dns_cache_add(ctx->queries[*query_idx].query,
+				      ctx->queries[*query_idx].query_type,
+				      &info, ttl);
+
 		query_known:
 			ctx->queries[*query_idx].cb(DNS_EAI_INPROGRESS, &info,
 					ctx->queries[*query_idx].user_data);
@@ -639,6 +788,15 @@ static int dns_read(struct dns_resolve_context *ctx,
 	}
 
 	if (ret < 0) {
+		if (ret == DNS_EAI_NODATA && query_idx >= 0) {
+			/* The name is known to have no address, remember
+			 * that for a while.
+			 */
+			dns_cache_add(ctx->queries[query_idx].query,
+				      ctx->queries[query_idx].query_type,
+				      NULL, 0U);
+		}
+
 		goto quit;
 	}
 
@@ -932,13 +1090,14 @@ static void query_timeout(struct k_work *work)
 					   pending_query->query);
 }
 
-int dns_resolve_name(struct dns_resolve_context *ctx,
-		     const char *query,
-		     enum dns_query_type type,
-		     uint16_t *dns_id,
-		     dns_resolve_cb_t cb,
-		     void *user_data,
-		     int32_t timeout)
+static int dns_resolve_name_internal(struct dns_resolve_context *ctx,
+				     const char *query,
+				     enum dns_query_type type,
+				     uint16_t *dns_id,
+				     dns_resolve_cb_t cb,
+				     void *user_data,
+				     int32_t timeout,
+				     bool use_cache)
 {
 	k_timeout_t tout;
 	struct net_buf *dns_data = NULL;
@@ -1012,6 +1171,26 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	}
 
 try_resolve:
+	if (use_cache) {
+		struct dns_addrinfo info;
+		bool negative = false;
+
+		if (dns_cache_lookup(query, type, &info, &negative) == 0) {
+			if (negative) {
+				cb(DNS_EAI_NODATA, NULL, user_data);
+			} else {
+				cb(DNS_EAI_INPROGRESS, &info, user_data);
+				cb(DNS_EAI_ALLDONE, NULL, user_data);
+			}
+
+			if (dns_id) {
+				*dns_id = 0U;
+			}
+
+			return 0;
+		}
+	}
+
 	i = get_cb_slot(ctx);
 	if (i < 0) {
 		return -EAGAIN;
@@ -1148,6 +1327,32 @@ quit:
 	return ret;
 }
 
+int dns_resolve_name(struct dns_resolve_context *ctx,
+		     const char *query,
+		     enum dns_query_type type,
+		     uint16_t *dns_id,
+		     dns_resolve_cb_t cb,
+		     void *user_data,
+		     int32_t timeout)
+{
+	return dns_resolve_name_internal(ctx, query, type, dns_id, cb,
+					 user_data, timeout, true);
+}
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+int dns_resolve_name_nocache(struct dns_resolve_context *ctx,
+			     const char *query,
+			     enum dns_query_type type,
+			     uint16_t *dns_id,
+			     dns_resolve_cb_t cb,
+			     void *user_data,
+			     int32_t timeout)
+{
+	return dns_resolve_name_internal(ctx, query, type, dns_id, cb,
+					 user_data, timeout, false);
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 int dns_resolve_close(struct dns_resolve_context *ctx)
 {
 	int i;
@@ -267,6 +267,13 @@ static int on_body(struct http_parser *parser, const char *at, size_t length)
 		req->internal.response.body_start = (uint8_t *)at;
 	}
 
+	/* Tell the response callback where exactly this body fragment
+	 * sits in recv_buf so that it can consume the data in place
+	 * without copying it out first.
+	 */
+	req->internal.response.body_frag_start = (uint8_t *)at;
+	req->internal.response.body_frag_len = length;
+
 	if (req->internal.response.cb) {
 		if (http_should_keep_alive(parser)) {
 			NET_DBG("Calling callback for partitioned %zd len data",
@@ -357,6 +364,14 @@ static int on_message_complete(struct http_parser *parser)
 		http_method_str(req->method));
 
 	req->internal.response.message_complete = 1;
+	req->internal.response.keep_alive =
+		http_should_keep_alive(parser) ? 1 : 0;
+
+	/* Stop the parser at the message boundary so that data received
+	 * after it, the start of the next pipelined response, is left
+	 * for the next parser run.
+	 */
+	http_parser_pause(parser, 1);
 
 	if (req->internal.response.cb) {
 		req->internal.response.cb(&req->internal.response,
@@ -412,12 +427,37 @@ static void http_client_init_parser(struct http_parser *parser,
 	settings->on_url = on_url;
 }
 
-static int http_wait_data(int sock, struct http_request *req)
+static int http_wait_data(int sock, struct http_request *req, size_t *leftover)
 {
 	int total_received = 0;
 	size_t offset = 0;
+	size_t parsed = 0;
 	int received, ret;
 
+	if (leftover && *leftover > 0) {
+		/* The tail of the recv() that completed the previous
+		 * pipelined response is already waiting at the start of
+		 * the buffer, parse it before reading more.
+		 */
+		received = *leftover;
+		*leftover = 0;
+
+		req->internal.response.data_len += received;
+
+		parsed = http_parser_execute(
+			&req->internal.parser,
+			&req->internal.parser_settings,
+			req->internal.response.recv_buf,
+			received);
+
+		total_received += received;
+		offset += received;
+
+		if (req->internal.response.message_complete) {
+			goto complete;
+		}
+	}
+
 	do {
 		received = recv(sock, req->internal.response.recv_buf + offset,
 				req->internal.response.recv_buf_len - offset,
@@ -435,7 +475,7 @@ static int http_wait_data(int sock, struct http_request *req)
 		} else {
 			req->internal.response.data_len += received;
 
-			(void)http_parser_execute(
+			parsed = http_parser_execute(
 				&req->internal.parser,
 				&req->internal.parser_settings,
 				req->internal.response.recv_buf + offset,
@@ -445,18 +485,35 @@ static int http_wait_data(int sock, struct http_request *req)
 		total_received += received;
 		offset += received;
 
-		if (offset >= req->internal.response.recv_buf_len) {
-			offset = 0;
+		if (req->internal.response.message_complete) {
+			goto complete;
 		}
 
-		if (req->internal.response.message_complete) {
-			ret = total_received;
-			break;
+		if (offset >= req->internal.response.recv_buf_len) {
+			offset = 0;
 		}
 
 	} while (true);
 
 	return ret;
+
+complete:
+	/* Whatever the parser did not consume belongs to the next
+	 * pipelined response. Move it to the start of the buffer for
+	 * the next parser run.
+	 */
+	if (leftover) {
+		*leftover = (size_t)received - parsed;
+
+		if (*leftover > 0) {
+			memmove(req->internal.response.recv_buf,
+				req->internal.response.recv_buf +
+				(offset - *leftover),
+				*leftover);
+		}
+	}
+
+	return total_received;
 }
 
 static void http_timeout(struct k_work *work)
@@ -467,32 +524,16 @@ static void http_timeout(struct k_work *work)
 	(void)close(data->sock);
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+static int http_send_req(int sock, struct http_request *req, void *user_data)
 {
 	/* Utilize the network usage by sending data in bigger blocks */
 	char send_buf[MAX_SEND_BUF_LEN];
 	const size_t send_buf_max_len = sizeof(send_buf);
 	size_t send_buf_pos = 0;
 	int total_sent = 0;
-	int ret, total_recv, i;
+	int ret, i;
 	const char *method;
 
-	if (sock < 0 || req == NULL || req->response == NULL ||
-	    req->recv_buf == NULL || req->recv_buf_len == 0) {
-		return -EINVAL;
-	}
-
-	memset(&req->internal.response, 0, sizeof(req->internal.response));
-
-	req->internal.response.http_cb = req->http_cb;
-	req->internal.response.cb = req->response;
-	req->internal.response.recv_buf = req->recv_buf;
-	req->internal.response.recv_buf_len = req->recv_buf_len;
-	req->internal.user_data = user_data;
-	req->internal.sock = sock;
-	req->internal.timeout = SYS_TIMEOUT_MS(timeout);
-
 	method = http_method_str(req->method);
 
 	ret = http_send_data(sock, send_buf, send_buf_max_len, &send_buf_pos,
@@ -653,6 +694,30 @@ int http_client_req(int sock, struct http_request *req,
 
 	NET_DBG("Sent %d bytes", total_sent);
 
+	return total_sent;
+
+out:
+	return ret;
+}
+
+static void http_req_setup(int sock, struct http_request *req,
+			   int32_t timeout, void *user_data)
+{
+	memset(&req->internal.response, 0, sizeof(req->internal.response));
+
+	req->internal.response.http_cb = req->http_cb;
+	req->internal.response.cb = req->response;
+	req->internal.response.recv_buf = req->recv_buf;
+	req->internal.response.recv_buf_len = req->recv_buf_len;
+	req->internal.user_data = user_data;
+	req->internal.sock = sock;
+	req->internal.timeout = SYS_TIMEOUT_MS(timeout);
+}
+
+static int http_recv_rsp(int sock, struct http_request *req, size_t *leftover)
+{
+	int total_recv;
+
 	http_client_init_parser(&req->internal.parser,
 				&req->internal.parser_settings);
 
@@ -664,7 +729,7 @@ int http_client_req(int sock, struct http_request *req,
 	}
 
 	/* Request is sent, now wait data to be received */
-	total_recv = http_wait_data(sock, req);
+	total_recv = http_wait_data(sock, req, leftover);
 	if (total_recv < 0) {
 		NET_DBG("Wait data failure (%d)", total_recv);
 	} else {
@@ -676,8 +741,91 @@ int http_client_req(int sock, struct http_request *req,
 		(void)k_delayed_work_cancel(&req->internal.work);
 	}
 
+	return total_recv;
+}
+
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	int total_sent;
+
+	if (sock < 0 || req == NULL || req->response == NULL ||
+	    req->recv_buf == NULL || req->recv_buf_len == 0) {
+		return -EINVAL;
+	}
+
+	http_req_setup(sock, req, timeout, user_data);
+
+	total_sent = http_send_req(sock, req, user_data);
+	if (total_sent < 0) {
+		return total_sent;
+	}
+
+	(void)http_recv_rsp(sock, req, NULL);
+
 	return total_sent;
+}
 
-out:
-	return ret;
+int http_client_pipeline(int sock, struct http_request **reqs, size_t num_reqs,
+			 int32_t timeout, void *user_data)
+{
+	size_t leftover = 0;
+	int total_sent = 0;
+	size_t i;
+	int ret;
+
+	if (sock < 0 || reqs == NULL || num_reqs == 0) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < num_reqs; i++) {
+		struct http_request *req = reqs[i];
+
+		if (req == NULL || req->response == NULL ||
+		    req->recv_buf == NULL || req->recv_buf_len == 0) {
+			return -EINVAL;
+		}
+
+		/* The recv() that completes one response can also read
+		 * the beginning of the next one, so all the pipelined
+		 * responses must be parsed from the same buffer.
+		 */
+		if (req->recv_buf != reqs[0]->recv_buf ||
+		    req->recv_buf_len != reqs[0]->recv_buf_len) {
+			return -EINVAL;
+		}
+	}
+
+	/* Send everything back to back before reading any of the
+	 * responses, this is where the pipelining gain comes from.
+	 */
+	for (i = 0; i < num_reqs; i++) {
+		http_req_setup(sock, reqs[i], timeout, user_data);
+
+		ret = http_send_req(sock, reqs[i], user_data);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total_sent += ret;
+	}
+
+	NET_DBG("Pipelined %zd requests, %d bytes", num_reqs, total_sent);
+
+	for (i = 0; i < num_reqs; i++) {
+		ret = http_recv_rsp(sock, reqs[i], &leftover);
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* The server may close the connection after any
+		 * response, the requests after that one need to be
+		 * resent on a fresh connection.
+		 */
+		if (!reqs[i]->internal.response.message_complete) {
+			return -ECONNRESET;
+		}
+	}
+
+	return total_sent;
 }
@@ -120,6 +120,13 @@ static struct service_node service_node_data[MAX_PERIODIC_SERVICE];
 
 static sys_slist_t engine_obj_list;
 static sys_slist_t engine_obj_inst_list;
+
+/* Object instances are additionally indexed by a hash of the object and
+ * object instance ids, so that path operations do not need to walk the
+ * full instance list.
+ */
+static sys_slist_t
+engine_obj_inst_buckets[CONFIG_LWM2M_ENGINE_OBJ_INST_HASH_SIZE];
 static sys_slist_t engine_observer_list;
 static sys_slist_t engine_service_list;
 
@@ -604,6 +611,20 @@ static void engine_remove_observer_by_id(uint16_t obj_id, int32_t obj_inst_id)
 
 void lwm2m_register_obj(struct lwm2m_engine_obj *obj)
 {
+	int i;
+
+	/* If the field definitions are sorted by resource id, which
+	 * they are for the in-tree objects, then resource lookups can
+	 * use a binary search.
+	 */
+	obj->fields_sorted = true;
+	for (i = 1; i < obj->field_count; i++) {
+		if (obj->fields[i - 1].res_id >= obj->fields[i].res_id) {
+			obj->fields_sorted = false;
+			break;
+		}
+	}
+
 	sys_slist_append(&engine_obj_list, &obj->node);
 }
 
@@ -632,6 +653,27 @@ lwm2m_get_engine_obj_field(struct lwm2m_engine_obj *obj, int res_id)
 	int i;
 
 	if (obj && obj->fields && obj->field_count > 0) {
+		if (obj->fields_sorted) {
+			int low = 0;
+			int high = obj->field_count - 1;
+
+			while (low <= high) {
+				int mid = (low + high) / 2;
+
+				if (obj->fields[mid].res_id == res_id) {
+					return &obj->fields[mid];
+				}
+
+				if (obj->fields[mid].res_id < res_id) {
+					low = mid + 1;
+				} else {
+					high = mid - 1;
+				}
+			}
+
+			return NULL;
+		}
+
 		for (i = 0; i < obj->field_count; i++) {
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
@@ -644,9 +686,20 @@ lwm2m_get_engine_obj_field(struct lwm2m_engine_obj *obj, int res_id)
 
 /* engine object instance */
 
+static sys_slist_t *get_engine_obj_inst_bucket(int obj_id, int obj_inst_id)
+{
+	uint32_t hash = ((uint32_t)obj_id * 31U) ^ (uint32_t)obj_inst_id;
+
+	return &engine_obj_inst_buckets[
+			hash % CONFIG_LWM2M_ENGINE_OBJ_INST_HASH_SIZE];
+}
+
 static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 {
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_append(get_engine_obj_inst_bucket(obj_inst->obj->obj_id,
+						    obj_inst->obj_inst_id),
+			 &obj_inst->hash_node);
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -654,6 +707,10 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 	engine_remove_observer_by_id(
 			obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_find_and_remove(
+			get_engine_obj_inst_bucket(obj_inst->obj->obj_id,
+						   obj_inst->obj_inst_id),
+			&obj_inst->hash_node);
 }
 
 static struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id,
@@ -661,8 +718,9 @@ static struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id,
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst,
-				     node) {
+	SYS_SLIST_FOR_EACH_CONTAINER(get_engine_obj_inst_bucket(obj_id,
+								obj_inst_id),
+				     obj_inst, hash_node) {
 		if (obj_inst->obj->obj_id == obj_id &&
 		    obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
@@ -4083,10 +4141,16 @@ static int lwm2m_engine_service(void)
 		 * manual notify requirements:
 		 * - event_timestamp > last_timestamp
 		 * - current timestamp > last_timestamp + min_period_sec
+		 * - the batching window has passed since the last event,
+		 *   so that changes arriving close together are reported
+		 *   in one notify message (the pmax based notify below
+		 *   bounds the total delay)
 		 */
 		if (obs->event_timestamp > obs->last_timestamp &&
 		    timestamp > obs->last_timestamp +
-				MSEC_PER_SEC * obs->min_period_sec) {
+				MSEC_PER_SEC * obs->min_period_sec &&
+		    timestamp >= obs->event_timestamp +
+				CONFIG_LWM2M_NOTIFY_BATCH_WINDOW_MS) {
 			obs->last_timestamp = k_uptime_get();
 			generate_notify_message(obs, true);
 
@@ -191,6 +191,11 @@ struct lwm2m_engine_obj {
 	uint16_t field_count;
 	uint16_t instance_count;
 	uint16_t max_instance_count;
+
+	/* set on registration if fields[] is sorted by increasing
+	 * res_id, which allows binary searching the fields
+	 */
+	bool fields_sorted;
 };
 
 /* Resource instances with this value are considered "not created" yet */
@@ -343,6 +348,9 @@ struct lwm2m_engine_obj_inst {
 	/* instance list */
 	sys_snode_t node;
 
+	/* instance lookup hash table */
+	sys_snode_t hash_node;
+
 	struct lwm2m_engine_obj *obj;
 	struct lwm2m_engine_res *resources;
 
@@ -24,6 +24,7 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #endif
 
 #include "../../ip/net_stats.h"
+#include "../../ip/tcp_internal.h"
 
 #include "sockets_internal.h"
 
@@ -95,6 +96,22 @@ void *z_vrfy_zsock_get_context_object(int sock)
 #include <syscalls/zsock_get_context_object_mrsh.c>
 #endif
 
+struct net_context *zsock_get_native_ctx(int sock)
+{
+	const struct socket_op_vtable *vtable;
+	void *ctx = get_sock_vtable(sock, &vtable);
+
+	/* Only plain net_context based sockets have the recv_q/accept_q
+	 * machinery that the epoll readiness hooks and the batched
+	 * receive rely on; reject TLS and offloaded sockets.
+	 */
+	if (ctx == NULL || vtable != &sock_fd_op_vtable) {
+		return NULL;
+	}
+
+	return ctx;
+}
+
 static void zsock_received_cb(struct net_context *ctx,
 			      struct net_pkt *pkt,
 			      union net_ip_header *ip_hdr,
@@ -225,6 +242,8 @@ static inline int z_vrfy_zsock_socket(int family, int type, int proto)
 
 int zsock_close_ctx(struct net_context *ctx)
 {
+	net_socket_epoll_forget(ctx);
+
 	/* Reset callbacks to avoid any race conditions while
 	 * flushing queues. No need to check return values here,
 	 * as these are fail-free operations and we're closing
@@ -307,6 +326,8 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 		k_fifo_init(&new_ctx->recv_q);
 
 		k_fifo_put(&parent->accept_q, new_ctx);
+
+		net_socket_epoll_notify(parent);
 	}
 }
 
@@ -336,6 +357,8 @@ static void zsock_received_cb(struct net_context *ctx,
 			net_pkt_set_eof(last_pkt, true);
 			NET_DBG("Set EOF flag on pkt %p", last_pkt);
 		}
+
+		net_socket_epoll_notify(ctx);
 		return;
 	}
 
@@ -349,6 +372,8 @@ static void zsock_received_cb(struct net_context *ctx,
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
 	k_fifo_put(&ctx->recv_q, pkt);
+
+	net_socket_epoll_notify(ctx);
 }
 
 int zsock_bind_ctx(struct net_context *ctx, const struct sockaddr *addr,
@@ -603,7 +628,25 @@ ssize_t zsock_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	}
 
 	while (1) {
-		if (dest_addr) {
+		if (flags & ZSOCK_MSG_ZEROCOPY) {
+			if (!IS_ENABLED(CONFIG_NET_CONTEXT_ZEROCOPY)) {
+				errno = ENOTSUP;
+				return -1;
+			}
+
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+			if (dest_addr) {
+				status = net_context_sendto_zerocopy(
+						ctx, buf, len, dest_addr,
+						addrlen, NULL, timeout,
+						ctx->user_data);
+			} else {
+				status = net_context_send_zerocopy(
+						ctx, buf, len, NULL, timeout,
+						ctx->user_data);
+			}
+#endif
+		} else if (dest_addr) {
 			status = net_context_sendto(ctx, buf, len, dest_addr,
 						    addrlen, NULL, timeout,
 						    ctx->user_data);
@@ -1162,6 +1205,135 @@ ssize_t z_vrfy_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 #include <syscalls/zsock_recvfrom_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static ssize_t zsock_recv_dgram_scatter(struct net_context *ctx,
+					struct msghdr *msg,
+					int flags)
+{
+	k_timeout_t timeout = K_FOREVER;
+	size_t recv_len = 0;
+	size_t remaining;
+	struct net_pkt *pkt;
+	int i;
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, timeout);
+	if (!pkt) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (msg->msg_name && msg->msg_namelen > 0) {
+		struct sockaddr *src_addr = msg->msg_name;
+		int rv;
+
+		rv = sock_get_pkt_src_addr(pkt, net_context_get_ip_proto(ctx),
+					   src_addr, msg->msg_namelen);
+		if (rv < 0) {
+			errno = -rv;
+			goto fail;
+		}
+
+		/* msg_namelen is a value-result field, set to actual
+		 * size of source address
+		 */
+		if (src_addr->sa_family == AF_INET) {
+			msg->msg_namelen = sizeof(struct sockaddr_in);
+		} else if (src_addr->sa_family == AF_INET6) {
+			msg->msg_namelen = sizeof(struct sockaddr_in6);
+		} else {
+			errno = ENOTSUP;
+			goto fail;
+		}
+	}
+
+	remaining = net_pkt_remaining_data(pkt);
+
+	for (i = 0; i < msg->msg_iovlen && remaining > 0; i++) {
+		size_t len = msg->msg_iov[i].iov_len;
+
+		if (len > remaining) {
+			len = remaining;
+		}
+
+		if (net_pkt_read(pkt, msg->msg_iov[i].iov_base, len)) {
+			errno = ENOBUFS;
+			goto fail;
+		}
+
+		recv_len += len;
+		remaining -= len;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	net_pkt_unref(pkt);
+
+	return recv_len;
+
+fail:
+	net_pkt_unref(pkt);
+
+	return -1;
+}
+
+int zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgvec, unsigned int vlen,
+		   int flags)
+{
+	struct net_context *ctx;
+	unsigned int i;
+
+	if (msgvec == NULL || vlen == 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	/* Only plain datagram sockets keep their packets queued on
+	 * recv_q, which is what allows draining several of them per
+	 * wakeup; TLS and offloaded sockets are not supported.
+	 */
+	ctx = zsock_get_native_ctx(sock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (net_context_get_type(ctx) != SOCK_DGRAM) {
+		errno = ENOTSUP;
+		return -1;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t ret;
+		int msg_flags = flags;
+
+		/* Only the first datagram may block, the rest are
+		 * whatever has already been queued.
+		 */
+		if (i > 0) {
+			msg_flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		ret = zsock_recv_dgram_scatter(ctx, &msgvec[i].msg_hdr,
+					       msg_flags);
+		if (ret < 0) {
+			if (i > 0 && errno == EAGAIN) {
+				break;
+			}
+
+			return -1;
+		}
+
+		msgvec[i].msg_len = ret;
+	}
+
+	return i;
+}
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -1498,9 +1670,59 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 				return 0;
 			}
+
+			break;
+
+		case SO_RAW_FILTER:
+			if (IS_ENABLED(CONFIG_NET_RAW_FILTER)) {
+				size_t len = *optlen;
+
+				ret = net_context_get_option(ctx,
+							NET_OPT_RAW_FILTER,
+							optval, &len);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				*optlen = len;
+
+				return 0;
+			}
+
+			break;
 		}
 
 		break;
+
+	case IPPROTO_TCP:
+		switch (optname) {
+		case TCP_NODELAY:
+		case TCP_CORK:
+		case TCP_QUICKACK: {
+			size_t len = *optlen;
+			enum tcp_conn_option opt;
+
+			if (optname == TCP_NODELAY) {
+				opt = TCP_OPT_NODELAY;
+			} else if (optname == TCP_CORK) {
+				opt = TCP_OPT_CORK;
+			} else {
+				opt = TCP_OPT_QUICKACK;
+			}
+
+			ret = net_tcp_get_option(ctx, opt, optval, &len);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			*optlen = len;
+
+			return 0;
+		}
+		}
+		break;
 	}
 
 	errno = ENOPROTOOPT;
@@ -1558,6 +1780,21 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 			 */
 			return 0;
 
+		case SO_REUSEPORT:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_REUSEPORT)) {
+				ret = net_context_set_option(ctx,
+							     NET_OPT_REUSEPORT,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case SO_PRIORITY:
 			if (IS_ENABLED(CONFIG_NET_CONTEXT_PRIORITY)) {
 				ret = net_context_set_option(ctx,
@@ -1604,6 +1841,21 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 			break;
 
+		case SO_RAW_FILTER:
+			if (IS_ENABLED(CONFIG_NET_RAW_FILTER)) {
+				ret = net_context_set_option(ctx,
+							NET_OPT_RAW_FILTER,
+							optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case SO_SOCKS5:
 			if (IS_ENABLED(CONFIG_SOCKS)) {
 				ret = net_context_set_option(ctx,
@@ -1627,9 +1879,33 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 	case IPPROTO_TCP:
 		switch (optname) {
 		case TCP_NODELAY:
-			/* Ignore for now. Provided to let port
-			 * existing apps.
-			 */
+			ret = net_tcp_set_option(ctx, TCP_OPT_NODELAY,
+						 optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
+
+		case TCP_CORK:
+			ret = net_tcp_set_option(ctx, TCP_OPT_CORK,
+						 optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
+
+		case TCP_QUICKACK:
+			ret = net_tcp_set_option(ctx, TCP_OPT_QUICKACK,
+						 optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
 			return 0;
 		}
 		break;
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_sock_epoll, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <kernel.h>
+#include <net/net_context.h>
+#include <net/socket.h>
+
+#include "sockets_internal.h"
+
+/* One registered socket. Ready sockets queue themselves on the owning
+ * instance's ready fifo from the net_context receive callbacks, so
+ * zsock_epoll_wait() never has to scan the registrations.
+ */
+struct epoll_item {
+	/* 1st word reserved for use by fifo */
+	intptr_t fifo_reserved;
+	struct zsock_epoll *ep;
+	struct net_context *ctx;
+	int fd;
+	uint32_t events;
+	void *data;
+	/* Set while the item sits on (or was just popped from) the ready
+	 * fifo, so a socket receiving a burst of packets is queued once.
+	 */
+	atomic_t queued;
+	bool used;
+};
+
+struct zsock_epoll {
+	bool in_use;
+	struct k_fifo ready;
+	struct k_mutex lock;
+	struct epoll_item items[CONFIG_NET_SOCKETS_EPOLL_MAX_ITEMS];
+};
+
+static struct zsock_epoll epolls[CONFIG_NET_SOCKETS_EPOLL_MAX];
+static K_MUTEX_DEFINE(epolls_lock);
+
+static struct zsock_epoll *epoll_get(int ep)
+{
+	if (ep < 0 || ep >= ARRAY_SIZE(epolls) || !epolls[ep].in_use) {
+		return NULL;
+	}
+
+	return &epolls[ep];
+}
+
+static void epoll_item_enqueue(struct epoll_item *item)
+{
+	if (atomic_cas(&item->queued, 0, 1)) {
+		k_fifo_put(&item->ep->ready, item);
+	}
+}
+
+/* Can be invoked from the RX thread via the socket receive callbacks. */
+void net_socket_epoll_notify(struct net_context *ctx)
+{
+	struct epoll_item *item = ctx->epoll_item;
+
+	if (item != NULL) {
+		epoll_item_enqueue(item);
+	}
+}
+
+void net_socket_epoll_forget(struct net_context *ctx)
+{
+	struct epoll_item *item = ctx->epoll_item;
+
+	if (item == NULL) {
+		return;
+	}
+
+	k_mutex_lock(&item->ep->lock, K_FOREVER);
+
+	ctx->epoll_item = NULL;
+	item->ctx = NULL;
+	item->used = false;
+
+	/* A stale fifo entry may remain; zsock_epoll_wait() revalidates
+	 * items when popping them so it is simply discarded there.
+	 */
+	k_mutex_unlock(&item->ep->lock);
+}
+
+static bool epoll_item_ready(struct epoll_item *item)
+{
+	struct net_context *ctx = item->ctx;
+
+	if (ctx == NULL || !(item->events & ZSOCK_POLLIN)) {
+		return false;
+	}
+
+	/* accept_q is a union with recv_q so the same check covers
+	 * listening sockets.
+	 */
+	return !k_fifo_is_empty(&ctx->recv_q) || sock_is_eof(ctx);
+}
+
+int zsock_epoll_create(void)
+{
+	int i;
+
+	k_mutex_lock(&epolls_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(epolls); i++) {
+		if (!epolls[i].in_use) {
+			epolls[i].in_use = true;
+			k_fifo_init(&epolls[i].ready);
+			k_mutex_init(&epolls[i].lock);
+			memset(epolls[i].items, 0, sizeof(epolls[i].items));
+
+			k_mutex_unlock(&epolls_lock);
+			return i;
+		}
+	}
+
+	k_mutex_unlock(&epolls_lock);
+
+	return -ENOMEM;
+}
+
+int zsock_epoll_ctl(int ep, int op, int sock, struct zsock_epoll_event *event)
+{
+	struct zsock_epoll *epoll = epoll_get(ep);
+	struct epoll_item *item = NULL;
+	struct net_context *ctx;
+	int i, ret = 0;
+
+	if (epoll == NULL) {
+		return -EBADF;
+	}
+
+	ctx = zsock_get_native_ctx(sock);
+	if (ctx == NULL) {
+		return -EBADF;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL) {
+		if (event == NULL) {
+			return -EINVAL;
+		}
+
+		/* Sockets are always reported writable by zsock_poll(),
+		 * so there is no write readiness to wait for.
+		 */
+		if (event->events & ~(uint32_t)ZSOCK_POLLIN) {
+			return -ENOTSUP;
+		}
+	}
+
+	k_mutex_lock(&epoll->lock, K_FOREVER);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		if (ctx->epoll_item != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		for (i = 0; i < ARRAY_SIZE(epoll->items); i++) {
+			if (!epoll->items[i].used) {
+				item = &epoll->items[i];
+				break;
+			}
+		}
+
+		if (item == NULL) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		item->used = true;
+		item->ep = epoll;
+		item->ctx = ctx;
+		item->fd = sock;
+		item->events = event->events;
+		item->data = event->data;
+		atomic_clear(&item->queued);
+
+		ctx->epoll_item = item;
+
+		/* Catch data queued before the registration existed. */
+		if (epoll_item_ready(item)) {
+			epoll_item_enqueue(item);
+		}
+
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		item = ctx->epoll_item;
+		if (item == NULL || item->ep != epoll) {
+			ret = -ENOENT;
+			break;
+		}
+
+		item->events = event->events;
+		item->data = event->data;
+
+		if (epoll_item_ready(item)) {
+			epoll_item_enqueue(item);
+		}
+
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		item = ctx->epoll_item;
+		if (item == NULL || item->ep != epoll) {
+			ret = -ENOENT;
+			break;
+		}
+
+		ctx->epoll_item = NULL;
+		item->ctx = NULL;
+		item->used = false;
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&epoll->lock);
+
+	return ret;
+}
+
+int zsock_epoll_wait(int ep, struct zsock_epoll_event *events, int maxevents,
+		     int timeout)
+{
+	struct epoll_item *delivered[CONFIG_NET_SOCKETS_EPOLL_MAX_ITEMS];
+	struct zsock_epoll *epoll = epoll_get(ep);
+	k_timeout_t first_timeout;
+	struct epoll_item *item;
+	int count = 0;
+	int i;
+
+	if (epoll == NULL) {
+		return -EBADF;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		return -EINVAL;
+	}
+
+	maxevents = MIN(maxevents, (int)ARRAY_SIZE(delivered));
+
+	if (timeout < 0) {
+		first_timeout = K_FOREVER;
+	} else {
+		first_timeout = K_MSEC(timeout);
+	}
+
+	/* Only the first pop can block; after that just drain whatever
+	 * else is already ready, up to maxevents.
+	 */
+	while (count < maxevents) {
+		item = k_fifo_get(&epoll->ready,
+				  count == 0 ? first_timeout : K_NO_WAIT);
+		if (item == NULL) {
+			break;
+		}
+
+		atomic_clear(&item->queued);
+
+		/* The socket may have been drained or unregistered while
+		 * the item sat on the fifo.
+		 */
+		if (!epoll_item_ready(item)) {
+			continue;
+		}
+
+		events[count].events = ZSOCK_POLLIN;
+		events[count].data = item->data;
+		delivered[count] = item;
+		count++;
+	}
+
+	/* Level triggered: a socket that still has data pending goes
+	 * straight back on the ready fifo for the next call.
+	 */
+	for (i = 0; i < count; i++) {
+		if (epoll_item_ready(delivered[i])) {
+			epoll_item_enqueue(delivered[i]);
+		}
+	}
+
+	return count;
+}
+
+int zsock_epoll_close(int ep)
+{
+	struct zsock_epoll *epoll = epoll_get(ep);
+	struct epoll_item *item;
+	int i;
+
+	if (epoll == NULL) {
+		return -EBADF;
+	}
+
+	k_mutex_lock(&epoll->lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(epoll->items); i++) {
+		item = &epoll->items[i];
+
+		if (item->used && item->ctx != NULL) {
+			item->ctx->epoll_item = NULL;
+		}
+
+		item->ctx = NULL;
+		item->used = false;
+	}
+
+	/* Drain stale ready entries before releasing the instance. */
+	while (k_fifo_get(&epoll->ready, K_NO_WAIT) != NULL) {
+	}
+
+	k_mutex_unlock(&epoll->lock);
+
+	k_mutex_lock(&epolls_lock, K_FOREVER);
+	epoll->in_use = false;
+	k_mutex_unlock(&epolls_lock);
+
+	return 0;
+}
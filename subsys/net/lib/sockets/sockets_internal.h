@@ -40,6 +40,23 @@ static inline bool net_socket_is_tls(void *obj)
 }
 #endif
 
+struct net_context *zsock_get_native_ctx(int sock);
+
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+void net_socket_epoll_notify(struct net_context *ctx);
+void net_socket_epoll_forget(struct net_context *ctx);
+#else
+static inline void net_socket_epoll_notify(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static inline void net_socket_epoll_forget(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif
+
 #define sock_is_eof(ctx) sock_get_flag(ctx, SOCK_EOF)
 #define sock_set_eof(ctx) sock_set_flag(ctx, SOCK_EOF, SOCK_EOF)
 #define sock_is_nonblock(ctx) sock_get_flag(ctx, SOCK_NONBLOCK)
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_sock_sendfile, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <kernel.h>
+#include <net/net_context.h>
+#include <net/socket.h>
+#include <storage/flash_map.h>
+
+#include "sockets_internal.h"
+
+#define WAIT_BUFS K_MSEC(100)
+#define MAX_WAIT_BUFS K_SECONDS(10)
+
+struct sendfile_source {
+	const struct flash_area *fa;
+	off_t offset;
+};
+
+/* Called by the stack for every contiguous chunk of the TX packet
+ * buffer, so the flash contents go straight into the net_bufs.
+ */
+static int sendfile_fill(void *dst, size_t length, size_t offset,
+			 void *cb_arg)
+{
+	struct sendfile_source *src = cb_arg;
+
+	return flash_area_read(src->fa, src->offset + offset, dst, length);
+}
+
+ssize_t zsock_sendfile(int sock, uint8_t area_id, off_t offset, size_t count)
+{
+	struct sendfile_source src;
+	struct net_context *ctx;
+	k_timeout_t timeout = K_FOREVER;
+	uint64_t buf_timeout = 0;
+	size_t total = 0;
+	int status;
+
+	ctx = zsock_get_native_ctx(sock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		buf_timeout = z_timeout_end_calc(MAX_WAIT_BUFS);
+	}
+
+	status = flash_area_open(area_id, &src.fa);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	while (total < count) {
+		src.offset = offset + total;
+
+		status = net_context_sendfill(ctx, sendfile_fill, &src,
+					      count - total, NULL, timeout,
+					      ctx->user_data);
+		if (status < 0) {
+			if (((status == -ENOBUFS) || (status == -EAGAIN)) &&
+			    K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+				/* As in zsock_sendto_ctx(), do not wait
+				 * forever for buffers as that may hide a
+				 * bigger problem.
+				 */
+				int64_t remaining = buf_timeout - z_tick_get();
+
+				if (remaining <= 0) {
+					errno = status == -ENOBUFS ?
+						ENOMEM : ENOBUFS;
+					goto out;
+				}
+
+				k_sleep(WAIT_BUFS);
+				continue;
+			}
+
+			if ((status == -EAGAIN) && total > 0) {
+				/* Partial send on a non-blocking socket. */
+				break;
+			}
+
+			errno = -status;
+			goto out;
+		}
+
+		total += status;
+	}
+
+	flash_area_close(src.fa);
+
+	return total;
+out:
+	flash_area_close(src.fa);
+
+	return -1;
+}
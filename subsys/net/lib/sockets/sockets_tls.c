@@ -265,6 +265,32 @@ static int dtls_timing_get_delay(void *data)
 }
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_CACHE)
+/** An entry of the client session resumption cache. */
+struct tls_session_cache {
+	/** Information whether the entry is in use. */
+	bool is_used;
+
+	/** Uptime snapshot used to evict the least recently used entry. */
+	int64_t last_used;
+
+	/** Peer address the session was established with. */
+	struct sockaddr peer_addr;
+
+	/** Length of the peer address. */
+	socklen_t peer_addrlen;
+
+	/** Saved mbedTLS session (session ID or ticket based). */
+	mbedtls_ssl_session session;
+};
+
+static struct tls_session_cache
+	client_session_cache[CONFIG_NET_SOCKETS_TLS_SESSION_CACHE_MAX];
+
+/* A mutex for protecting the session cache. */
+static struct k_mutex session_cache_lock;
+#endif /* CONFIG_NET_SOCKETS_TLS_SESSION_CACHE */
+
 /* Initialize TLS internals. */
 static int tls_init(const struct device *unused)
 {
@@ -288,6 +314,10 @@ static int tls_init(const struct device *unused)
 
 	k_mutex_init(&context_lock);
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_CACHE)
+	k_mutex_init(&session_cache_lock);
+#endif
+
 	mbedtls_ctr_drbg_init(&tls_ctr_drbg);
 
 	ret = mbedtls_ctr_drbg_seed(&tls_ctr_drbg, tls_entropy_func, NULL,
@@ -312,6 +342,181 @@ static inline bool is_handshake_complete(struct tls_context *ctx)
 	return k_sem_count_get(&ctx->tls_established) != 0;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_CACHE)
+static bool session_peer_cmp(const struct tls_session_cache *entry,
+			     const struct sockaddr *peer_addr,
+			     socklen_t addrlen)
+{
+	if (entry->peer_addrlen != addrlen ||
+	    entry->peer_addr.sa_family != peer_addr->sa_family) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && peer_addr->sa_family == AF_INET6) {
+		struct sockaddr_in6 *addr1 = net_sin6(peer_addr);
+		struct sockaddr_in6 *addr2 = net_sin6(&entry->peer_addr);
+
+		return (addr1->sin6_port == addr2->sin6_port) &&
+			net_ipv6_addr_cmp(&addr1->sin6_addr, &addr2->sin6_addr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   peer_addr->sa_family == AF_INET) {
+		struct sockaddr_in *addr1 = net_sin(peer_addr);
+		struct sockaddr_in *addr2 = net_sin(&entry->peer_addr);
+
+		return (addr1->sin_port == addr2->sin_port) &&
+			net_ipv4_addr_cmp(&addr1->sin_addr, &addr2->sin_addr);
+	}
+
+	return false;
+}
+
+/* Must be called with session_cache_lock held. */
+static struct tls_session_cache *tls_session_find(
+					const struct sockaddr *peer_addr,
+					socklen_t addrlen)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(client_session_cache); i++) {
+		if (client_session_cache[i].is_used &&
+		    session_peer_cmp(&client_session_cache[i],
+				     peer_addr, addrlen)) {
+			return &client_session_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Offer a cached session for the peer, if any, so that the upcoming
+ * handshake can resume it instead of doing a full key exchange.
+ */
+static void tls_session_restore(struct tls_context *context,
+				const struct sockaddr *peer_addr,
+				socklen_t addrlen)
+{
+	struct tls_session_cache *entry;
+	int ret;
+
+	k_mutex_lock(&session_cache_lock, K_FOREVER);
+
+	entry = tls_session_find(peer_addr, addrlen);
+	if (entry) {
+		ret = mbedtls_ssl_set_session(&context->ssl, &entry->session);
+		if (ret != 0) {
+			NET_DBG("Session restore failed: -%x", -ret);
+		} else {
+			entry->last_used = k_uptime_get();
+		}
+	}
+
+	k_mutex_unlock(&session_cache_lock);
+}
+
+/* Save the negotiated session after a successful client handshake. */
+static void tls_session_store(struct tls_context *context,
+			      const struct sockaddr *peer_addr,
+			      socklen_t addrlen)
+{
+	struct tls_session_cache *oldest = NULL;
+	struct tls_session_cache *entry;
+	int i, ret;
+
+	if (addrlen > sizeof(struct sockaddr)) {
+		return;
+	}
+
+	k_mutex_lock(&session_cache_lock, K_FOREVER);
+
+	entry = tls_session_find(peer_addr, addrlen);
+	if (entry) {
+		mbedtls_ssl_session_free(&entry->session);
+	} else {
+		for (i = 0; i < ARRAY_SIZE(client_session_cache); i++) {
+			entry = &client_session_cache[i];
+
+			if (!entry->is_used) {
+				break;
+			}
+
+			if (!oldest || entry->last_used < oldest->last_used) {
+				oldest = entry;
+			}
+
+			entry = NULL;
+		}
+
+		if (!entry) {
+			/* Evict the least recently used session. */
+			entry = oldest;
+			mbedtls_ssl_session_free(&entry->session);
+			entry->is_used = false;
+		}
+
+		memcpy(&entry->peer_addr, peer_addr, addrlen);
+		entry->peer_addrlen = addrlen;
+	}
+
+	mbedtls_ssl_session_init(&entry->session);
+
+	ret = mbedtls_ssl_get_session(&context->ssl, &entry->session);
+	if (ret != 0) {
+		NET_DBG("Session store failed: -%x", -ret);
+		mbedtls_ssl_session_free(&entry->session);
+		entry->is_used = false;
+	} else {
+		entry->is_used = true;
+		entry->last_used = k_uptime_get();
+	}
+
+	k_mutex_unlock(&session_cache_lock);
+}
+
+/* Drop a cached session, so that a stale or rejected session is not
+ * offered again and again.
+ */
+static void tls_session_purge(const struct sockaddr *peer_addr,
+			      socklen_t addrlen)
+{
+	struct tls_session_cache *entry;
+
+	k_mutex_lock(&session_cache_lock, K_FOREVER);
+
+	entry = tls_session_find(peer_addr, addrlen);
+	if (entry) {
+		mbedtls_ssl_session_free(&entry->session);
+		entry->is_used = false;
+	}
+
+	k_mutex_unlock(&session_cache_lock);
+}
+#else /* CONFIG_NET_SOCKETS_TLS_SESSION_CACHE */
+static inline void tls_session_restore(struct tls_context *context,
+				       const struct sockaddr *peer_addr,
+				       socklen_t addrlen)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(peer_addr);
+	ARG_UNUSED(addrlen);
+}
+
+static inline void tls_session_store(struct tls_context *context,
+				     const struct sockaddr *peer_addr,
+				     socklen_t addrlen)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(peer_addr);
+	ARG_UNUSED(addrlen);
+}
+
+static inline void tls_session_purge(const struct sockaddr *peer_addr,
+				     socklen_t addrlen)
+{
+	ARG_UNUSED(peer_addr);
+	ARG_UNUSED(addrlen);
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_SESSION_CACHE */
+
 /* Allocate TLS context. */
 static struct tls_context *tls_alloc(void)
 {
@@ -864,6 +1069,19 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 				       MBEDTLS_SSL_RENEGOTIATION_ENABLED);
 #endif
 
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_TLS_SESSION_CACHE) &&
+	    role == MBEDTLS_SSL_IS_CLIENT) {
+		/* Ask the server for a session ticket so that the next
+		 * connection can resume the session even if the server
+		 * does not keep a session ID cache.
+		 */
+		mbedtls_ssl_conf_session_tickets(
+				&context->config,
+				MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+	}
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	if (type == MBEDTLS_SSL_TRANSPORT_DATAGRAM) {
 		/* DTLS requires timer callbacks to operate */
@@ -1239,13 +1457,21 @@ int ztls_connect_ctx(struct tls_context *ctx, const struct sockaddr *addr,
 		/* Do not use any socket flags during the handshake. */
 		ctx->flags = 0;
 
+		/* Resume the previous session with this peer, if any, to
+		 * avoid a full key exchange.
+		 */
+		tls_session_restore(ctx, addr, addrlen);
+
 		/* TODO For simplicity, TLS handshake blocks the socket
 		 * even for non-blocking socket.
 		 */
 		ret = tls_mbedtls_handshake(ctx, true);
 		if (ret < 0) {
+			tls_session_purge(addr, addrlen);
 			goto error;
 		}
+
+		tls_session_store(ctx, addr, addrlen);
 	} else {
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 		/* Just store the address. */
@@ -1379,13 +1605,21 @@ static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 	}
 
 	if (!is_handshake_complete(ctx)) {
+		tls_session_restore(ctx, &ctx->dtls_peer_addr,
+				    ctx->dtls_peer_addrlen);
+
 		/* TODO For simplicity, TLS handshake blocks the socket even for
 		 * non-blocking socket.
 		 */
 		ret = tls_mbedtls_handshake(ctx, true);
 		if (ret < 0) {
+			tls_session_purge(&ctx->dtls_peer_addr,
+					  ctx->dtls_peer_addrlen);
 			goto error;
 		}
+
+		tls_session_store(ctx, &ctx->dtls_peer_addr,
+				  ctx->dtls_peer_addrlen);
 	}
 
 	return send_tls(ctx, buf, len, flags);
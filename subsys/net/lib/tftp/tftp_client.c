@@ -19,6 +19,13 @@ static uint32_t  tftpc_buffer_size;
 static uint32_t  tftpc_block_no;
 static uint32_t  tftpc_index;
 
+/* Negotiated transfer options (RFC2348 / RFC7440). These fall back to
+ * the RFC1350 defaults unless the server acknowledges our options.
+ */
+static uint16_t  tftpc_block_size;
+static uint16_t  tftpc_window_size;
+static uint16_t  tftpc_window_cnt;
+
 /* Global mutex to protect critical resources. */
 K_MUTEX_DEFINE(tftpc_lock);
 
@@ -64,6 +71,27 @@ static uint32_t make_request(const char *remote_file, const char *mode,
 	tftpc_buffer[req_size] = 0x0;
 	req_size++;
 
+	/* Ask the server for a larger block size (RFC2348) and for a
+	 * transfer window (RFC7440). A server that does not understand
+	 * the options simply answers with data and the transfer runs
+	 * with the RFC1350 defaults.
+	 */
+	if (CONFIG_TFTPC_BLOCK_SIZE != TFTP_BLOCK_SIZE) {
+		strcpy(tftpc_buffer + req_size, "blksize");
+		req_size += sizeof("blksize");
+		req_size += snprintf(tftpc_buffer + req_size,
+				     sizeof("65464"), "%d",
+				     CONFIG_TFTPC_BLOCK_SIZE) + 1;
+	}
+
+	if (CONFIG_TFTPC_WINDOW_SIZE > 1) {
+		strcpy(tftpc_buffer + req_size, "windowsize");
+		req_size += sizeof("windowsize");
+		req_size += snprintf(tftpc_buffer + req_size,
+				     sizeof("65535"), "%d",
+				     CONFIG_TFTPC_WINDOW_SIZE) + 1;
+	}
+
 	return req_size;
 }
 
@@ -117,6 +145,59 @@ static int tftpc_recv_data(int sock)
 	return stat;
 }
 
+/* Name: tftpc_process_oack
+ * Description: This function parses the option acknowledgment sent by
+ * the TFTP Server in response to our negotiated request. The options are
+ * echoed back as "name" / "value" string pairs; options the server left
+ * out stay at their RFC1350 defaults.
+ */
+static int tftpc_process_oack(void)
+{
+	uint32_t idx = 2;
+
+	while (idx < tftpc_buffer_size) {
+		char *name = (char *)tftpc_buffer + idx;
+		char *value;
+		int val;
+
+		idx += strlen(name) + 1;
+		if (idx >= tftpc_buffer_size) {
+			return -EINVAL;
+		}
+
+		value = (char *)tftpc_buffer + idx;
+		idx += strlen(value) + 1;
+		if (idx > tftpc_buffer_size) {
+			return -EINVAL;
+		}
+
+		val = atoi(value);
+
+		if (strcmp(name, "blksize") == 0) {
+			/* The server may lower the block size but must
+			 * never raise it beyond what we asked for, as
+			 * the receive buffer is sized for our request.
+			 */
+			if (val < 8 || val > CONFIG_TFTPC_BLOCK_SIZE) {
+				return -EINVAL;
+			}
+
+			tftpc_block_size = val;
+		} else if (strcmp(name, "windowsize") == 0) {
+			if (val < 1 || val > CONFIG_TFTPC_WINDOW_SIZE) {
+				return -EINVAL;
+			}
+
+			tftpc_window_size = val;
+		}
+	}
+
+	LOG_DBG("Options ack'd by server: blksize %d windowsize %d",
+		tftpc_block_size, tftpc_window_size);
+
+	return 0;
+}
+
 /* Name: tftpc_process_resp
  * Description: This function will process the data received from the
  * TFTP Server (a file or part of the file) and place it in the user buffer.
@@ -132,13 +213,17 @@ static int tftpc_process_resp(int sock, struct tftpc *client)
 
 	/* Get the block number as received in the packet. */
 	block_no = sys_get_be16(tftpc_buffer + 2);
-	if (tftpc_block_no > block_no) {
-		LOG_DBG("Duplicate block received: %d", block_no);
+	if (tftpc_block_no != block_no) {
+		LOG_DBG("Unexpected block received: %d", block_no);
 		LOG_DBG("Client waiting for Block Number: %d", tftpc_block_no);
 
-		send_ack(sock, block_no);
+		/* Re-ack the last block received in order so that the
+		 * server restarts the window from there (RFC7440).
+		 */
+		send_ack(sock, tftpc_block_no - 1);
+		tftpc_window_cnt = 0;
 
-		/* Duplicate block received. */
+		/* Duplicate (or out of order) block received. */
 		return TFTPC_DUPLICATE_DATA;
 	}
 
@@ -157,15 +242,26 @@ static int tftpc_process_resp(int sock, struct tftpc *client)
 	tftpc_index += RECV_DATA_SIZE();
 
 	/* "block" of data received. */
-	send_ack(sock, block_no);
 	tftpc_block_no++;
+	tftpc_window_cnt++;
 
-	/* For RFC1350, the block size will always be 512.
-	 * -> If block_size == 512, the transfer is still in progress.
-	 * -> If block_size < 512, we will conclude the transfer.
+	/* A data block shorter than the negotiated block size
+	 * concludes the transfer.
 	 */
-	return (RECV_DATA_SIZE() == TFTP_BLOCK_SIZE) ? TFTP_BLOCK_SIZE :
-		TFTPC_SUCCESS;
+	if (RECV_DATA_SIZE() < tftpc_block_size) {
+		send_ack(sock, block_no);
+		return TFTPC_SUCCESS;
+	}
+
+	/* Only the last block of every window is ack'd; the blocks in
+	 * between stream in without a round trip (RFC7440).
+	 */
+	if (tftpc_window_cnt >= tftpc_window_size) {
+		send_ack(sock, block_no);
+		tftpc_window_cnt = 0;
+	}
+
+	return tftpc_block_size;
 }
 
 /* Name: tftp_send_request
@@ -231,6 +327,11 @@ int tftp_get(struct sockaddr *server, struct tftpc *client,
 	tftpc_block_no = 1;
 	tftpc_index    = 0;
 
+	/* Until the server acks our options the RFC1350 defaults apply. */
+	tftpc_block_size  = TFTP_BLOCK_SIZE;
+	tftpc_window_size = 1U;
+	tftpc_window_cnt  = 0U;
+
 	/* Create Socket for TFTP (IPv4 / UDP) */
 	sock = socket(server->sa_family, SOCK_DGRAM, IPPROTO_UDP);
 	if (sock < 0) {
@@ -255,6 +356,21 @@ int tftp_get(struct sockaddr *server, struct tftpc *client,
 		return TFTPC_REMOTE_ERROR;
 	}
 
+	/* The server ack'd (some of) our transfer options. The first
+	 * data block follows once we ack the option acknowledgment.
+	 */
+	if (stat == OACK_OPCODE) {
+		if (tftpc_process_oack() < 0) {
+			LOG_ERR("Server responded with bad options.");
+			send_err(sock, 0x8, "Bad option value");
+			stat = TFTPC_REMOTE_ERROR;
+			goto req_done;
+		}
+
+		send_ack(sock, 0);
+		goto tftpc_recv;
+	}
+
 process_resp:
 
 	/* Process server response. */
@@ -278,9 +394,12 @@ tftpc_recv:
 			return TFTPC_RETRIES_EXHAUSTED;
 		}
 
-		/* Start Retransmission. */
+		/* Start Retransmission. Re-ack the last block received
+		 * in order so the server resumes the window from there.
+		 */
 		LOG_DBG("Starting Re-transmission.");
-		send_ack(sock, tftpc_block_no);
+		send_ack(sock, tftpc_block_no - 1);
+		tftpc_window_cnt = 0;
 		goto tftpc_recv;
 	}
 
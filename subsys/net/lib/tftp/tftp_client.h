@@ -7,26 +7,36 @@
 /* Generic header files required by the TFTPC Module. */
 #include <zephyr.h>
 #include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <net/socket.h>
 
 /* Defines for creating static arrays for TFTP communication. */
 #define TFTP_HEADER_SIZE         4
 #define TFTP_BLOCK_SIZE          512
+#define TFTP_MAX_BLOCK_SIZE      CONFIG_TFTPC_BLOCK_SIZE
 #define TFTP_MAX_MODE_SIZE       8
 #define TFTP_REQ_RETX            CONFIG_TFTPC_REQUEST_RETRANSMITS
 
 /* Maximum amount of data that can be received in a single go ! */
-#define TFTPC_MAX_BUF_SIZE       (TFTP_BLOCK_SIZE + TFTP_HEADER_SIZE)
+#define TFTPC_MAX_BUF_SIZE       (TFTP_MAX_BLOCK_SIZE + TFTP_HEADER_SIZE)
+
+/* Maximum room the negotiated transfer options (RFC2348 / RFC7440) can
+ * take up in a request.
+ */
+#define TFTP_MAX_OPTION_SIZE     (sizeof("blksize") + sizeof("65464") + \
+				  sizeof("windowsize") + sizeof("65535"))
 
 /* Maximum filename size allowed by the TFTP Client. This is used as
  * an upper bound in the "make_request" function to ensure that there
  * are no buffer overflows. The complete "tftpc_buffer" has the size of
  * "TFTPC_MAX_BUF_SIZE" which is used when creating a request. From this
- * total size, we need 2 bytes for request info, 2 dummy NULL bytes and
- * "TFTP_MAX_MODE_SIZE" for mode info. Everything else can be used for
- * filename.
+ * total size, we need 2 bytes for request info, 2 dummy NULL bytes,
+ * "TFTP_MAX_MODE_SIZE" for mode info and "TFTP_MAX_OPTION_SIZE" for the
+ * transfer options. Everything else can be used for filename.
  */
-#define TFTP_MAX_FILENAME_SIZE   (TFTPC_MAX_BUF_SIZE - TFTP_MAX_MODE_SIZE - 4)
+#define TFTP_MAX_FILENAME_SIZE   (TFTPC_MAX_BUF_SIZE - TFTP_MAX_MODE_SIZE - \
+				  TFTP_MAX_OPTION_SIZE - 4)
 
 /* TFTP Opcodes. */
 #define READ_REQUEST             0x1
@@ -34,6 +44,7 @@
 #define DATA_OPCODE              0x3
 #define ACK_OPCODE               0x4
 #define ERROR_OPCODE             0x5
+#define OACK_OPCODE              0x6
 
 #define RECV_DATA_SIZE()         (tftpc_buffer_size - TFTP_HEADER_SIZE)
 
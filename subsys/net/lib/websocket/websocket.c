@@ -479,6 +479,52 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* XOR the payload with the 32-bit masking value, a word at a time when
+ * possible. The mask octet that applies to a given payload byte depends
+ * on the byte's offset within the message, so the key is rotated to
+ * line up with the first payload byte and any unaligned head and tail
+ * bytes are handled one by one.
+ */
+static void websocket_mask_payload(uint8_t *payload, size_t payload_len,
+				   uint32_t masking_value, size_t offset)
+{
+	size_t i = 0;
+
+	if (payload_len >= 2 * sizeof(uint32_t)) {
+		uint32_t rot;
+		uint32_t key;
+
+		while ((uintptr_t)&payload[i] % sizeof(uint32_t) != 0) {
+			payload[i] ^= masking_value >>
+					(8 * (3 - (offset + i) % 4));
+			i++;
+		}
+
+		rot = (offset + i) % 4;
+		key = masking_value;
+
+		if (rot > 0) {
+			key = (masking_value << (8 * rot)) |
+			      (masking_value >> (32 - 8 * rot));
+		}
+
+		/* The first octet of the rotated key masks the next
+		 * payload byte, so store the key in big endian order to
+		 * apply it a word at a time.
+		 */
+		key = sys_cpu_to_be32(key);
+
+		for (; i + sizeof(uint32_t) <= payload_len;
+		     i += sizeof(uint32_t)) {
+			*(uint32_t *)&payload[i] ^= key;
+		}
+	}
+
+	for (; i < payload_len; i++) {
+		payload[i] ^= masking_value >> (8 * (3 - (offset + i) % 4));
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -549,8 +595,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -565,10 +609,8 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 		memcpy(data_to_send, payload, payload_len);
 
-		for (i = 0; i < payload_len; i++) {
-			data_to_send[i] ^=
-				ctx->masking_value >> (8 * (3 - i % 4));
-		}
+		websocket_mask_payload(data_to_send, payload_len,
+				       ctx->masking_value, 0);
 	}
 
 	ret = websocket_prepare_and_send(ctx, header, hdr_len,
@@ -777,16 +819,23 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 	/* Now read the whole payload or parts of it */
 
 	if (ctx->tmp_buf_pos == 0) {
-		/* Read more data into temp buffer */
+		/* Read the payload directly into the caller's buffer so
+		 * that it does not need to be copied via the temp buffer.
+		 * Do not read past the end of the message, the bytes after
+		 * it belong to the next frame's header.
+		 */
+		size_t max_read = MIN(ctx->message_len - ctx->total_read,
+				      buf_len);
+
 #if defined(CONFIG_NET_TEST)
-		size_t input_len = MIN(ctx->tmp_buf_len, test_data->input_len);
+		size_t input_len = MIN(max_read, test_data->input_len);
 
-		memcpy(ctx->tmp_buf, test_data->input_buf, input_len);
+		memcpy(buf, test_data->input_buf, input_len);
 		test_data->input_buf += input_len;
 
 		ret = input_len;
 #else
-		ret = recv(ctx->real_sock, ctx->tmp_buf, ctx->tmp_buf_len,
+		ret = recv(ctx->real_sock, buf, max_read,
 			   K_TIMEOUT_EQ(tout, K_NO_WAIT) ? MSG_DONTWAIT : 0);
 #endif /* CONFIG_NET_TEST */
 
@@ -798,49 +847,45 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 			return 0;
 		}
 
-		ctx->tmp_buf_pos = ret;
-	}
-
-	if (ctx->tmp_buf_pos <= buf_len) {
-		/* Is there already any data in the temp buffer? If yes,
-		 * just return it to the caller.
-		 */
-		can_copy = MIN(ctx->message_len - ctx->total_read,
-			       ctx->tmp_buf_pos);
+		recv_len = ret;
+		ctx->total_read += recv_len;
 	} else {
-		/* We have more data in tmp buffer that will fit into
-		 * user buffer.
+		/* There is data left over from reading the header, return
+		 * it to the caller first.
 		 */
-		can_copy = MIN(ctx->message_len - ctx->total_read, buf_len);
-	}
+		if (ctx->tmp_buf_pos <= buf_len) {
+			can_copy = MIN(ctx->message_len - ctx->total_read,
+				       ctx->tmp_buf_pos);
+		} else {
+			/* We have more data in tmp buffer that will fit into
+			 * user buffer.
+			 */
+			can_copy = MIN(ctx->message_len - ctx->total_read,
+				       buf_len);
+		}
 
-	left = ctx->tmp_buf_pos - can_copy;
+		left = ctx->tmp_buf_pos - can_copy;
 
-	NET_ASSERT(ctx->tmp_buf_pos >= can_copy);
+		NET_ASSERT(ctx->tmp_buf_pos >= can_copy);
 
-	memmove(buf, ctx->tmp_buf, can_copy);
-	recv_len = can_copy;
+		memmove(buf, ctx->tmp_buf, can_copy);
+		recv_len = can_copy;
 
-	if (left > 0) {
-		memmove(ctx->tmp_buf, &ctx->tmp_buf[can_copy], left);
-	}
+		if (left > 0) {
+			memmove(ctx->tmp_buf, &ctx->tmp_buf[can_copy], left);
+		}
 
-	ctx->tmp_buf_pos = left;
-	ctx->total_read += recv_len;
+		ctx->tmp_buf_pos = left;
+		ctx->total_read += recv_len;
+	}
 
-	/* Unmask the data */
+	/* Unmask the data in place in the caller's buffer. The offset
+	 * within the message selects the right masking value octet for
+	 * the first byte.
+	 */
 	if (ctx->masked) {
-		/* As we might have less than 4 received bytes, we must select
-		 * which byte from masking value to take. The mask_shift will
-		 * tell that.
-		 */
-		int mask_shift = (ctx->total_read - recv_len) % sizeof(uint32_t);
-		int i;
-
-		for (i = 0; i < recv_len; i++) {
-			buf[i] ^= ctx->masking_value >>
-				(8 * (3 - (i + mask_shift) % 4));
-		}
+		websocket_mask_payload(buf, recv_len, ctx->masking_value,
+				       ctx->total_read - recv_len);
 	}
 
 #if HEXDUMP_RECV_PACKETS
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/atomic.h>
+#include "policy/pm_policy.h"
+
+#define LOG_LEVEL CONFIG_SYS_PM_LOG_LEVEL /* From power module Kconfig */
+#include <logging/log.h>
+LOG_MODULE_DECLARE(power);
+
+static atomic_t max_latency = ATOMIC_INIT(SYS_PM_NO_LATENCY_CONSTRAINT);
+static atomic_t resume_latency;
+
+void sys_pm_ctrl_set_max_latency(uint32_t latency_us)
+{
+	atomic_set(&max_latency, (atomic_val_t)latency_us);
+}
+
+uint32_t sys_pm_ctrl_get_max_latency(void)
+{
+	return (uint32_t)atomic_get(&max_latency);
+}
+
+void sys_pm_ctrl_add_resume_latency(uint32_t latency_us)
+{
+	atomic_val_t v;
+
+	v = atomic_add(&resume_latency, (atomic_val_t)latency_us);
+	__ASSERT(v >= 0, "Resume latency budget overflowed!");
+
+	/* Make compiler happy when assertions are disabled. */
+	(void)(v);
+}
+
+void sys_pm_ctrl_remove_resume_latency(uint32_t latency_us)
+{
+	atomic_val_t v;
+
+	v = atomic_sub(&resume_latency, (atomic_val_t)latency_us);
+	__ASSERT(v >= (atomic_val_t)latency_us,
+		 "Resume latency budget underflowed!");
+
+	/* Make compiler happy when assertions are disabled. */
+	(void)(v);
+}
+
+uint32_t sys_pm_ctrl_get_resume_latency(void)
+{
+	return (uint32_t)atomic_get(&resume_latency);
+}
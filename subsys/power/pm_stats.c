@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <power/power_stats.h>
+#include "policy/pm_policy.h"
+
+#define LOG_LEVEL CONFIG_SYS_PM_LOG_LEVEL /* From power module Kconfig */
+#include <logging/log.h>
+LOG_MODULE_DECLARE(power);
+
+static struct k_spinlock stats_lock;
+static struct sys_pm_state_stats state_stats[SYS_POWER_STATE_MAX];
+static struct sys_pm_wakeup_source
+		wakeup_sources[CONFIG_SYS_PM_STATS_WAKEUP_SOURCES];
+
+static uint32_t entry_cycles;
+static uint32_t latency_cycles;
+
+static inline int residency_bucket(uint32_t residency_us)
+{
+	if (residency_us == 0U) {
+		return 0;
+	}
+
+	return MIN(find_msb_set(residency_us) - 1,
+		   SYS_PM_STATS_HIST_BUCKETS - 1);
+}
+
+void sys_pm_stats_enter(enum power_states state)
+{
+	ARG_UNUSED(state);
+
+	entry_cycles = k_cycle_get_32();
+}
+
+void sys_pm_stats_exit(enum power_states state)
+{
+	uint32_t cycles = k_cycle_get_32() - entry_cycles;
+	uint32_t residency_us = (uint32_t)k_cyc_to_us_floor64(cycles);
+	struct sys_pm_state_stats *stats = &state_stats[state];
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&stats_lock);
+	stats->count++;
+	stats->last_residency_us = residency_us;
+	stats->total_residency_us += residency_us;
+	stats->residency_hist[residency_bucket(residency_us)]++;
+	k_spin_unlock(&stats_lock, key);
+}
+
+void sys_pm_stats_exit_latency_start(void)
+{
+	latency_cycles = k_cycle_get_32();
+}
+
+void sys_pm_stats_exit_latency_end(enum power_states state)
+{
+	uint32_t cycles = k_cycle_get_32() - latency_cycles;
+	uint32_t latency_us = (uint32_t)k_cyc_to_us_floor64(cycles);
+	struct sys_pm_state_stats *stats = &state_stats[state];
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&stats_lock);
+	stats->last_exit_latency_us = latency_us;
+	stats->max_exit_latency_us = MAX(stats->max_exit_latency_us,
+					 latency_us);
+	k_spin_unlock(&stats_lock, key);
+}
+
+void sys_pm_stats_wakeup_source(uint32_t id)
+{
+	k_spinlock_key_t key;
+	int i;
+
+	key = k_spin_lock(&stats_lock);
+
+	for (i = 0; i < ARRAY_SIZE(wakeup_sources); i++) {
+		if (wakeup_sources[i].count == 0U) {
+			/* Free slot, claim it for this source */
+			wakeup_sources[i].id = id;
+		}
+
+		if (wakeup_sources[i].id == id) {
+			wakeup_sources[i].count++;
+			break;
+		}
+	}
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void sys_pm_stats_get(struct sys_pm_stats_snapshot *snapshot)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&stats_lock);
+	memcpy(snapshot->state, state_stats, sizeof(state_stats));
+	memcpy(snapshot->wakeup, wakeup_sources, sizeof(wakeup_sources));
+	k_spin_unlock(&stats_lock, key);
+}
+
+void sys_pm_stats_reset(void)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&stats_lock);
+	memset(state_stats, 0, sizeof(state_stats));
+	memset(wakeup_sources, 0, sizeof(wakeup_sources));
+	k_spin_unlock(&stats_lock, key);
+}
@@ -45,6 +45,39 @@ static const unsigned int pm_min_residency[] = {
 #endif /* CONFIG_SYS_POWER_DEEP_SLEEP_STATES */
 };
 
+#ifdef CONFIG_SYS_PM_POLICY_LATENCY
+/* Worst case time to return to the active state, per power state */
+static const uint32_t pm_exit_latency_us[] = {
+#ifdef CONFIG_SYS_POWER_SLEEP_STATES
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_1
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_1,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_2
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_2,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_3
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_3,
+#endif
+#endif /* CONFIG_SYS_POWER_SLEEP_STATES */
+
+#ifdef CONFIG_SYS_POWER_DEEP_SLEEP_STATES
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_1
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_1,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_2
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_2,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_3
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_3,
+#endif
+#endif /* CONFIG_SYS_POWER_DEEP_SLEEP_STATES */
+};
+#endif /* CONFIG_SYS_PM_POLICY_LATENCY */
+
 enum power_states sys_pm_policy_next_state(int32_t ticks)
 {
 	int i;
@@ -59,6 +92,22 @@ enum power_states sys_pm_policy_next_state(int32_t ticks)
 		if (!sys_pm_ctrl_is_state_enabled((enum power_states)(i))) {
 			continue;
 		}
+#endif
+#ifdef CONFIG_SYS_PM_POLICY_LATENCY
+		uint64_t wakeup_us = (uint64_t)pm_exit_latency_us[i] +
+				     sys_pm_ctrl_get_resume_latency();
+
+		if (wakeup_us > sys_pm_ctrl_get_max_latency()) {
+			/* Would violate the latency constraint */
+			continue;
+		}
+
+		if ((ticks != K_TICKS_FOREVER) &&
+		    ((uint64_t)ticks < pm_min_residency[i] +
+				       k_us_to_ticks_ceil64(wakeup_us))) {
+			/* Can not wake up before the next expected event */
+			continue;
+		}
 #endif
 		if ((ticks == K_TICKS_FOREVER) ||
 		    (ticks >= pm_min_residency[i])) {
@@ -9,6 +9,7 @@
 #include <init.h>
 #include <string.h>
 #include <power/power.h>
+#include <power/power_stats.h>
 #include "policy/pm_policy.h"
 
 #define LOG_LEVEL CONFIG_SYS_PM_LOG_LEVEL
@@ -145,7 +146,9 @@ enum power_states _sys_suspend(int32_t ticks)
 
 	/* Enter power state */
 	sys_pm_debug_start_timer();
+	sys_pm_stats_enter(pm_state);
 	sys_set_power_state(pm_state);
+	sys_pm_stats_exit(pm_state);
 	sys_pm_debug_stop_timer();
 
 #if CONFIG_DEVICE_POWER_MANAGEMENT
@@ -161,7 +164,9 @@ enum power_states _sys_suspend(int32_t ticks)
 		/* clear forced_pm_state */
 		forced_pm_state = SYS_POWER_STATE_AUTO;
 		sys_pm_notify_power_state_exit(pm_state);
+		sys_pm_stats_exit_latency_start();
 		_sys_pm_power_state_exit_post_ops(pm_state);
+		sys_pm_stats_exit_latency_end(pm_state);
 	}
 
 	return pm_state;
@@ -187,7 +192,9 @@ void _sys_resume(void)
 	if (!post_ops_done) {
 		post_ops_done = 1;
 		sys_pm_notify_power_state_exit(pm_state);
+		sys_pm_stats_exit_latency_start();
 		_sys_pm_power_state_exit_post_ops(pm_state);
+		sys_pm_stats_exit_latency_end(pm_state);
 	}
 }
 
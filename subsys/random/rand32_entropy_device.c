@@ -6,17 +6,15 @@
 
 #include <sys/atomic.h>
 #include <kernel.h>
+#include <init.h>
 #include <drivers/entropy.h>
 #include <string.h>
 
 static const struct device *entropy_driver;
 
-#if defined(CONFIG_ENTROPY_DEVICE_RANDOM_GENERATOR)
-uint32_t z_impl_sys_rand32_get(void)
+static const struct device *entropy_get_device(void)
 {
 	const struct device *dev = entropy_driver;
-	uint32_t random_num;
-	int ret;
 
 	if (unlikely(!dev)) {
 		/* Only one entropy device exists, so this is safe even
@@ -30,6 +28,110 @@ uint32_t z_impl_sys_rand32_get(void)
 		entropy_driver = dev;
 	}
 
+	return dev;
+}
+
+#if defined(CONFIG_ENTROPY_DEVICE_RANDOM_POOL)
+/*
+ * Kernel-maintained entropy pool: consumers take buffered bytes in
+ * constant time, and whenever the fill level drops below the low-water
+ * threshold a background work item tops the pool up again from the
+ * entropy driver, so the driver's conversion latency is normally not
+ * paid on the consumer's path.
+ *
+ * Since the bytes are random their order does not matter, so the pool
+ * is consumed from the end like a stack rather than as a ring.
+ */
+static struct k_spinlock entropy_pool_lock;
+static struct k_work entropy_pool_work;
+static uint8_t entropy_pool[CONFIG_ENTROPY_DEVICE_RANDOM_POOL_SIZE];
+static uint16_t entropy_pool_avail;
+static bool entropy_pool_started;
+
+static void entropy_pool_refill(struct k_work *work)
+{
+	const struct device *dev = entropy_get_device();
+	uint8_t chunk[32];
+	k_spinlock_key_t key;
+	uint16_t space;
+	uint16_t len;
+
+	ARG_UNUSED(work);
+
+	for (;;) {
+		key = k_spin_lock(&entropy_pool_lock);
+		space = sizeof(entropy_pool) - entropy_pool_avail;
+		k_spin_unlock(&entropy_pool_lock, key);
+
+		if (space == 0U) {
+			return;
+		}
+
+		len = MIN(space, sizeof(chunk));
+		if (entropy_get_entropy(dev, chunk, len) < 0) {
+			/* Better luck on the next low-water submission. */
+			return;
+		}
+
+		key = k_spin_lock(&entropy_pool_lock);
+		/* Consumers may have raced with the driver call. */
+		len = MIN(len, sizeof(entropy_pool) - entropy_pool_avail);
+		memcpy(&entropy_pool[entropy_pool_avail], chunk, len);
+		entropy_pool_avail += len;
+		k_spin_unlock(&entropy_pool_lock, key);
+	}
+}
+
+static uint16_t entropy_pool_take(uint8_t *dst, uint16_t len)
+{
+	k_spinlock_key_t key;
+	uint16_t count;
+	bool low;
+
+	key = k_spin_lock(&entropy_pool_lock);
+	count = MIN(len, entropy_pool_avail);
+	entropy_pool_avail -= count;
+	memcpy(dst, &entropy_pool[entropy_pool_avail], count);
+	low = entropy_pool_avail < CONFIG_ENTROPY_DEVICE_RANDOM_POOL_THRESHOLD;
+	k_spin_unlock(&entropy_pool_lock, key);
+
+	if (low && entropy_pool_started) {
+		k_work_submit(&entropy_pool_work);
+	}
+
+	return count;
+}
+
+static int entropy_pool_init(const struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_work_init(&entropy_pool_work, entropy_pool_refill);
+	entropy_pool_started = true;
+	k_work_submit(&entropy_pool_work);
+
+	return 0;
+}
+
+SYS_INIT(entropy_pool_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_ENTROPY_DEVICE_RANDOM_POOL */
+
+#if defined(CONFIG_ENTROPY_DEVICE_RANDOM_GENERATOR)
+uint32_t z_impl_sys_rand32_get(void)
+{
+	const struct device *dev;
+	uint32_t random_num;
+	int ret;
+
+#if defined(CONFIG_ENTROPY_DEVICE_RANDOM_POOL)
+	if (entropy_pool_take((uint8_t *)&random_num,
+			      sizeof(random_num)) == sizeof(random_num)) {
+		return random_num;
+	}
+#endif
+
+	dev = entropy_get_device();
+
 	ret = entropy_get_entropy(dev, (uint8_t *)&random_num,
 				  sizeof(random_num));
 	if (unlikely(ret < 0)) {
@@ -48,21 +150,31 @@ uint32_t z_impl_sys_rand32_get(void)
 
 static int rand_get(uint8_t *dst, size_t outlen, bool csrand)
 {
-	const struct device *dev = entropy_driver;
+	const struct device *dev;
 	uint32_t random_num;
 	int ret;
 
-	if (unlikely(!dev)) {
-		/* Only one entropy device exists, so this is safe even
-		 * if the whole operation isn't atomic.
-		 */
-		dev = device_get_binding(DT_CHOSEN_ZEPHYR_ENTROPY_LABEL);
-		__ASSERT((dev != NULL),
-			"Device driver for %s (DT_CHOSEN_ZEPHYR_ENTROPY_LABEL) not found. "
-			"Check your build configuration!",
-			DT_CHOSEN_ZEPHYR_ENTROPY_LABEL);
-		entropy_driver = dev;
+#if defined(CONFIG_ENTROPY_DEVICE_RANDOM_POOL)
+	/*
+	 * Cryptographically secure consumers keep reading straight from
+	 * the driver; everyone else is served from the pool first and
+	 * falls through to the driver only for what the pool couldn't
+	 * deliver.
+	 */
+	if (!csrand) {
+		uint16_t taken = entropy_pool_take(dst,
+				MIN(outlen, sizeof(entropy_pool)));
+
+		if (taken == outlen) {
+			return 0;
+		}
+
+		dst += taken;
+		outlen -= taken;
 	}
+#endif
+
+	dev = entropy_get_device();
 
 	ret = entropy_get_entropy(dev, dst, outlen);
 
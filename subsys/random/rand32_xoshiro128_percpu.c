@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ *
+ * Based on code written in 2019 by David Blackman and Sebastiano Vigna
+ * (vigna@acm.org)
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * See <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+/* This is xoshiro128++ 1.0, one of the 32-bit all-purpose, rock-solid
+ * generators. It has excellent speed, a state size (128 bits) that is
+ * large enough for mild parallelism, and it passes all tests we are
+ * aware of.
+ *
+ * Unlike the plain xoroshiro128+ generator, one generator state is kept
+ * per CPU and only the current CPU's state is touched when a number is
+ * generated, so frequent callers running on different cores do not
+ * share (and corrupt) common state. All states are seeded once from the
+ * entropy driver at boot.
+ *
+ * The state must be seeded so that it is not everywhere zero.
+ */
+
+#include <init.h>
+#include <device.h>
+#include <drivers/entropy.h>
+#include <kernel.h>
+#include <string.h>
+
+static uint32_t state[CONFIG_MP_NUM_CPUS][4];
+
+static inline uint32_t rotl(const uint32_t x, int k)
+{
+	return (x << k) | (x >> (32 - k));
+}
+
+static int xoshiro128_initialize(const struct device *dev)
+{
+	dev = device_get_binding(DT_CHOSEN_ZEPHYR_ENTROPY_LABEL);
+	if (!dev) {
+		return -EINVAL;
+	}
+
+	int32_t rc = entropy_get_entropy_isr(dev, (uint8_t *)&state,
+					     sizeof(state), ENTROPY_BUSYWAIT);
+
+	if (rc == -ENOTSUP) {
+		/* Driver does not provide an ISR-specific API, assume it can
+		 * be called from ISR context
+		 */
+		rc = entropy_get_entropy(dev, (uint8_t *)&state,
+					 sizeof(state));
+	}
+
+	if (rc < 0) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static uint32_t xoshiro128_next(void)
+{
+#ifdef CONFIG_SMP
+	/* Lock out interrupts so that we cannot migrate to another CPU
+	 * (or be preempted by another user of this CPU's state) between
+	 * picking the state and updating it.
+	 */
+	unsigned int key = arch_irq_lock();
+	uint32_t *s = state[arch_curr_cpu()->id];
+#else
+	uint32_t *s = state[0];
+#endif
+	const uint32_t result = rotl(s[0] + s[3], 7) + s[0];
+	const uint32_t t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rotl(s[3], 11);
+
+#ifdef CONFIG_SMP
+	arch_irq_unlock(key);
+#endif
+
+	return result;
+}
+
+uint32_t z_impl_sys_rand32_get(void)
+{
+	return xoshiro128_next();
+}
+
+void z_impl_sys_rand_get(void *dst, size_t outlen)
+{
+	uint32_t ret;
+	uint32_t blocksize = 4;
+	uint32_t len = 0;
+	uint32_t *udst = (uint32_t *)dst;
+
+	while (len < outlen) {
+		ret = xoshiro128_next();
+		if ((outlen - len) < sizeof(ret)) {
+			blocksize = outlen - len;
+			(void)memcpy(udst, &ret, blocksize);
+		} else {
+			(*udst++) = ret;
+		}
+		len += blocksize;
+	}
+}
+
+/* In-tree entropy drivers will initialize in PRE_KERNEL_1; ensure that they're
+ * initialized properly before initializing ourselves.
+ */
+SYS_INIT(xoshiro128_initialize, PRE_KERNEL_2,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -27,11 +27,118 @@ K_MUTEX_DEFINE(settings_lock);
 
 void settings_store_init(void);
 
+#ifdef CONFIG_SETTINGS_DISPATCH_INDEX
+
+BUILD_ASSERT((CONFIG_SETTINGS_DISPATCH_INDEX_SIZE &
+	      (CONFIG_SETTINGS_DISPATCH_INDEX_SIZE - 1)) == 0,
+	     "Settings dispatch index size must be a power of 2");
+
+/* Hash table over the registered handler names. A stored record name
+ * is dispatched by probing its '/'-separated prefixes longest first,
+ * which yields the same best-match handler as scanning all handlers
+ * with string comparisons, at a few hash probes per record.
+ */
+struct settings_index_entry {
+	struct settings_handler_static *ch; /* NULL when the slot is free */
+	uint16_t hash;
+	uint16_t len; /* length of ch->name */
+};
+
+static struct settings_index_entry
+	settings_index[CONFIG_SETTINGS_DISPATCH_INDEX_SIZE];
+static bool settings_index_overflow;
+
+static uint16_t settings_index_hash(const char *name, size_t len)
+{
+	uint16_t hash = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash << 5) - hash + (uint8_t)name[i];
+	}
+	return hash;
+}
+
+static void settings_index_insert(struct settings_handler_static *ch)
+{
+	size_t len = strlen(ch->name);
+	uint16_t hash = settings_index_hash(ch->name, len);
+	uint32_t pos = hash & (CONFIG_SETTINGS_DISPATCH_INDEX_SIZE - 1);
+
+	for (int i = 0; i < CONFIG_SETTINGS_DISPATCH_INDEX_SIZE; i++) {
+		if (settings_index[pos].ch == NULL) {
+			settings_index[pos].ch = ch;
+			settings_index[pos].hash = hash;
+			settings_index[pos].len = (uint16_t)len;
+			return;
+		}
+		pos = (pos + 1) & (CONFIG_SETTINGS_DISPATCH_INDEX_SIZE - 1);
+	}
+
+	/* more handlers than slots: fall back to scanning */
+	settings_index_overflow = true;
+}
+
+static struct settings_handler_static *settings_index_lookup(const char *name,
+							const char **next)
+{
+	size_t bounds[SETTINGS_MAX_DIR_DEPTH];
+	size_t i = 0;
+	int cnt = 0;
+
+	while ((name[i] != '\0') && (name[i] != SETTINGS_NAME_END)) {
+		if (name[i] == SETTINGS_NAME_SEPARATOR) {
+			if (cnt == ARRAY_SIZE(bounds) - 1) {
+				/* deeper than any handler name can be */
+				return NULL;
+			}
+			bounds[cnt++] = i;
+		}
+		i++;
+	}
+	bounds[cnt++] = i;
+
+	for (int seg = cnt - 1; seg >= 0; seg--) {
+		size_t plen = bounds[seg];
+		uint16_t hash = settings_index_hash(name, plen);
+		uint32_t pos = hash &
+			       (CONFIG_SETTINGS_DISPATCH_INDEX_SIZE - 1);
+
+		for (int probe = 0;
+		     probe < CONFIG_SETTINGS_DISPATCH_INDEX_SIZE; probe++) {
+			struct settings_index_entry *entry =
+				&settings_index[pos];
+
+			if (entry->ch == NULL) {
+				break;
+			}
+			if ((entry->hash == hash) && (entry->len == plen) &&
+			    (memcmp(entry->ch->name, name, plen) == 0)) {
+				if (next &&
+				    (name[plen] == SETTINGS_NAME_SEPARATOR)) {
+					*next = &name[plen + 1];
+				}
+				return entry->ch;
+			}
+			pos = (pos + 1) &
+			      (CONFIG_SETTINGS_DISPATCH_INDEX_SIZE - 1);
+		}
+	}
+
+	return NULL;
+}
+
+#endif /* CONFIG_SETTINGS_DISPATCH_INDEX */
+
 void settings_init(void)
 {
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#ifdef CONFIG_SETTINGS_DISPATCH_INDEX
+	Z_STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		settings_index_insert(ch);
+	}
+#endif /* CONFIG_SETTINGS_DISPATCH_INDEX */
 	settings_store_init();
 }
 
@@ -56,6 +163,9 @@ int settings_register(struct settings_handler *handler)
 		}
 	}
 	sys_slist_append(&settings_handlers, &handler->node);
+#ifdef CONFIG_SETTINGS_DISPATCH_INDEX
+	settings_index_insert((struct settings_handler_static *)handler);
+#endif
 
 end:
 	k_mutex_unlock(&settings_lock);
@@ -145,6 +255,12 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
+#ifdef CONFIG_SETTINGS_DISPATCH_INDEX
+	if (!settings_index_overflow) {
+		return settings_index_lookup(name, next);
+	}
+#endif /* CONFIG_SETTINGS_DISPATCH_INDEX */
+
 	Z_STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
 			continue;
@@ -121,6 +121,11 @@ void settings_line_io_init(int (*read_cb)(void *ctx, off_t off, char *buf,
 			  uint8_t io_rwbs);
 
 
+#ifdef CONFIG_SETTINGS_VALUE_CACHE
+void settings_cache_update(const char *name, const void *value,
+			   size_t val_len);
+#endif
+
 extern sys_slist_t settings_load_srcs;
 extern sys_slist_t settings_handlers;
 extern struct settings_store *settings_save_dst;
@@ -15,6 +15,85 @@ struct read_cb_arg {
 	size_t len;
 };
 
+#ifdef CONFIG_SETTINGS_VALUE_CACHE
+
+struct settings_cache_entry {
+	char name[CONFIG_SETTINGS_VALUE_CACHE_NAME_LEN];
+	uint16_t val_len;
+	bool pinned;
+	bool valid;
+	uint8_t value[CONFIG_SETTINGS_VALUE_CACHE_VALUE_LEN];
+};
+
+static struct settings_cache_entry
+	settings_cache[CONFIG_SETTINGS_VALUE_CACHE_COUNT];
+
+static struct settings_cache_entry *settings_cache_find(const char *name)
+{
+	for (int i = 0; i < CONFIG_SETTINGS_VALUE_CACHE_COUNT; i++) {
+		if (settings_cache[i].pinned &&
+		    (strcmp(settings_cache[i].name, name) == 0)) {
+			return &settings_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+int settings_cache_pin(const char *name)
+{
+	if (strlen(name) >= sizeof(settings_cache[0].name)) {
+		return -EINVAL;
+	}
+
+	if (settings_cache_find(name)) {
+		return 0;
+	}
+
+	for (int i = 0; i < CONFIG_SETTINGS_VALUE_CACHE_COUNT; i++) {
+		if (!settings_cache[i].pinned) {
+			strcpy(settings_cache[i].name, name);
+			settings_cache[i].valid = false;
+			settings_cache[i].pinned = true;
+			return 0;
+		}
+	}
+
+	return -ENOMEM;
+}
+
+int settings_cache_unpin(const char *name)
+{
+	struct settings_cache_entry *entry = settings_cache_find(name);
+
+	if (!entry) {
+		return -ENOENT;
+	}
+
+	entry->pinned = false;
+	return 0;
+}
+
+void settings_cache_update(const char *name, const void *value, size_t val_len)
+{
+	struct settings_cache_entry *entry = settings_cache_find(name);
+
+	if (!entry) {
+		return;
+	}
+
+	if ((value == NULL) || (val_len > sizeof(entry->value))) {
+		entry->valid = false;
+		return;
+	}
+
+	memcpy(entry->value, value, val_len);
+	entry->val_len = (uint16_t)val_len;
+	entry->valid = true;
+}
+
+#endif /* CONFIG_SETTINGS_VALUE_CACHE */
+
 static ssize_t settings_runtime_read_cb(void *cb_arg, void *data, size_t len)
 {
 	struct read_cb_arg *arg = (struct read_cb_arg *)cb_arg;
@@ -28,6 +107,7 @@ int settings_runtime_set(const char *name, const void *data, size_t len)
 	struct settings_handler_static *ch;
 	const char *name_key;
 	struct read_cb_arg arg;
+	int rc;
 
 	ch = settings_parse_and_lookup(name, &name_key);
 	if (!ch) {
@@ -36,13 +116,31 @@ int settings_runtime_set(const char *name, const void *data, size_t len)
 
 	arg.data = data;
 	arg.len = len;
-	return ch->h_set(name_key, len, settings_runtime_read_cb, (void *)&arg);
+	rc = ch->h_set(name_key, len, settings_runtime_read_cb, (void *)&arg);
+
+#ifdef CONFIG_SETTINGS_VALUE_CACHE
+	if (rc == 0) {
+		settings_cache_update(name, data, len);
+	}
+#endif
+
+	return rc;
 }
 
 int settings_runtime_get(const char *name, void *data, size_t len)
 {
 	struct settings_handler_static *ch;
 	const char *name_key;
+#ifdef CONFIG_SETTINGS_VALUE_CACHE
+	struct settings_cache_entry *entry = settings_cache_find(name);
+	int rc;
+
+	if (entry && entry->valid) {
+		len = MIN(len, entry->val_len);
+		memcpy(data, entry->value, len);
+		return len;
+	}
+#endif
 
 	ch = settings_parse_and_lookup(name, &name_key);
 	if (!ch) {
@@ -53,7 +151,21 @@ int settings_runtime_get(const char *name, void *data, size_t len)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_SETTINGS_VALUE_CACHE
+	rc = ch->h_get(name_key, data, len);
+
+	/* populate a pinned entry, unless the value got truncated */
+	if (entry && (rc >= 0) && ((size_t)rc < len) &&
+	    ((size_t)rc <= sizeof(entry->value))) {
+		memcpy(entry->value, data, rc);
+		entry->val_len = (uint16_t)rc;
+		entry->valid = true;
+	}
+
+	return rc;
+#else
 	return ch->h_get(name_key, data, len);
+#endif
 }
 
 int settings_runtime_commit(const char *name)
@@ -105,6 +105,12 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 
 	rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
 
+#ifdef CONFIG_SETTINGS_VALUE_CACHE
+	if (rc == 0) {
+		settings_cache_update(name, value, val_len);
+	}
+#endif
+
 	k_mutex_unlock(&settings_lock);
 
 	return rc;
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <shell/shell.h>
+#include <init.h>
+#include <debug/boot_timing.h>
+
+static int cmd_boot_timing(const struct shell *shell,
+			   size_t argc, char **argv)
+{
+	uint32_t cyc_per_sec = sys_clock_hw_cycles_per_sec();
+	size_t count = boot_timing_count();
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "%-5s %-32s %12s %12s",
+		    "level", "name", "start [us]", "spent [us]");
+
+	for (size_t i = 0; i < count; i++) {
+		const struct boot_timing_entry *rec = boot_timing_get(i);
+
+		shell_print(shell, "%5u %-32s %12u %12u",
+			    rec->level, rec->name,
+			    (uint32_t)(((uint64_t)rec->start_cycles *
+					USEC_PER_SEC) / cyc_per_sec),
+			    (uint32_t)(((uint64_t)rec->duration_cycles *
+					USEC_PER_SEC) / cyc_per_sec));
+	}
+
+	shell_print(shell, "%u/%u init entries recorded", count,
+		    CONFIG_BOOT_TIMING_MAX_ENTRIES);
+
+	return 0;
+}
+
+static int cmd_boot_timing_dump(const struct shell *shell,
+				size_t argc, char **argv)
+{
+	/* Header plus one record per init entry, see boot_timing_dump()
+	 * for the format. Names are bounded by the buffer, not counted
+	 * exactly; oversized tables are truncated.
+	 */
+	static uint8_t buf[12 + CONFIG_BOOT_TIMING_MAX_ENTRIES * 32];
+	size_t len;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	len = boot_timing_dump(buf, sizeof(buf));
+	shell_hexdump(shell, buf, len);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_boot,
+	SHELL_CMD(timing, NULL, "Print per-init-entry boot timing.",
+		  cmd_boot_timing),
+	SHELL_CMD(dump, NULL, "Hexdump the binary boot timing record.",
+		  cmd_boot_timing_dump),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+
+SHELL_CMD_REGISTER(boot, &sub_boot, "Boot phase timing", NULL);
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <shell/shell.h>
+#include <sys/sys_heap.h>
+#include <sys/printk.h>
+
+static int cmd_heap_profile_stats(const struct shell *shell,
+				  size_t argc, char **argv)
+{
+	struct sys_heap_profile_site site;
+	int used = 0;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "sample rate: 1/%d",
+		    CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE);
+	shell_print(shell, "%-10s %8s %10s %10s  %s",
+		    "site", "allocs", "live", "peak", "size histogram");
+
+	for (int i = 0; i < CONFIG_SYS_HEAP_PROFILE_NUM_SITES; i++) {
+		char hist[SYS_HEAP_PROFILE_HIST_BUCKETS * 11 + 1];
+		int off = 0;
+
+		if (!sys_heap_profile_site_get(i, &site)) {
+			continue;
+		}
+		used++;
+
+		for (int b = 0; b < SYS_HEAP_PROFILE_HIST_BUCKETS; b++) {
+			off += snprintk(&hist[off], sizeof(hist) - off,
+					b == 0 ? "%u" : " %u",
+					site.size_hist[b]);
+		}
+
+		shell_print(shell, "%-10p %8u %10u %10u  [%s]",
+			    site.site, site.alloc_count, site.live_bytes,
+			    site.peak_bytes, hist);
+	}
+
+	shell_print(shell, "%d/%d call sites used", used,
+		    CONFIG_SYS_HEAP_PROFILE_NUM_SITES);
+
+	return 0;
+}
+
+static int cmd_heap_profile_dump(const struct shell *shell,
+				 size_t argc, char **argv)
+{
+	/* Header plus one record per call site, see
+	 * sys_heap_profile_dump() for the format.
+	 */
+	static uint8_t buf[16 +
+		CONFIG_SYS_HEAP_PROFILE_NUM_SITES *
+		(8 + 4 * (3 + SYS_HEAP_PROFILE_HIST_BUCKETS))];
+	size_t len;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	len = sys_heap_profile_dump(buf, sizeof(buf));
+	shell_hexdump(shell, buf, len);
+
+	return 0;
+}
+
+static int cmd_heap_profile_reset(const struct shell *shell,
+				  size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_heap_profile_reset();
+	shell_print(shell, "heap profile reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_heap_profile,
+	SHELL_CMD(stats, NULL, "Print per-call-site allocation statistics.",
+		  cmd_heap_profile_stats),
+	SHELL_CMD(dump, NULL, "Hexdump the binary profile for host analysis.",
+		  cmd_heap_profile_dump),
+	SHELL_CMD(reset, NULL, "Reset all recorded statistics.",
+		  cmd_heap_profile_reset),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+
+SHELL_CMD_REGISTER(heap_profile, &sub_heap_profile,
+		   "sys_heap allocation profile", NULL);
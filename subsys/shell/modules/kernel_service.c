@@ -74,6 +74,12 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 		      thread->base.timeout.dticks);
 	shell_print(shell, "\tstate: %s", k_thread_state_str(thread));
 
+#ifdef CONFIG_TRACING_THREAD_STATS
+	shell_print(shell, "\tcycles: %llu, switched in: %u times",
+		      thread->run_cycles,
+		      thread->run_switches);
+#endif
+
 	ret = k_thread_stack_space_get(thread, &unused);
 	if (ret) {
 		shell_print(shell,
@@ -171,6 +177,51 @@ static int cmd_kernel_stacks(const struct shell *shell,
 }
 #endif
 
+#if defined(CONFIG_MEM_SLAB_STATS)
+static int cmd_kernel_slabs(const struct shell *shell,
+			    size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "%-10s %6s %6s %6s %6s %8s %8s %6s",
+		    "slab", "bsize", "blocks", "used", "max",
+		    "allocs", "frees", "fails");
+
+	Z_STRUCT_SECTION_FOREACH(k_mem_slab, slab) {
+		shell_print(shell, "%-10p %6zu %6u %6u %6u %8u %8u %6u",
+			    slab, slab->block_size, slab->num_blocks,
+			    slab->num_used, slab->max_used,
+			    slab->alloc_count, slab->free_count,
+			    slab->fail_count);
+
+		if (slab->fail_count != 0U) {
+			shell_print(shell, "  last failed alloc from %p",
+				    slab->last_fail_caller);
+		}
+
+		if (slab->owners == NULL) {
+			continue;
+		}
+
+		for (uint32_t i = 0U; i < slab->num_blocks; i++) {
+			struct k_thread *owner = slab->owners[i];
+			const char *tname;
+
+			if (owner == NULL) {
+				continue;
+			}
+
+			tname = k_thread_name_get(owner);
+			shell_print(shell, "  block %3u held by %p %s",
+				    i, owner, tname ? tname : "NA");
+		}
+	}
+
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_REBOOT)
 static int cmd_kernel_reboot_warm(const struct shell *shell,
 				  size_t argc, char **argv)
@@ -202,6 +253,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
 #endif
+#if defined(CONFIG_MEM_SLAB_STATS)
+	SHELL_CMD(slabs, NULL, "List memory slab statistics.", cmd_kernel_slabs),
+#endif
 #if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
 		defined(CONFIG_THREAD_MONITOR)
 	SHELL_CMD(stacks, NULL, "List threads stack usage.", cmd_kernel_stacks),
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <shell/shell.h>
+#include <power/power_stats.h>
+#include <sys/printk.h>
+
+static struct sys_pm_stats_snapshot snapshot;
+
+static int cmd_pm_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_pm_stats_get(&snapshot);
+
+	shell_print(shell, "%-6s %8s %12s %14s %10s %10s",
+		    "state", "count", "last res", "total res",
+		    "last exit", "max exit");
+
+	for (int i = 0; i < SYS_POWER_STATE_MAX; i++) {
+		const struct sys_pm_state_stats *stats = &snapshot.state[i];
+		char hist[SYS_PM_STATS_HIST_BUCKETS * 11 + 1];
+		int off = 0;
+
+		if (stats->count == 0U) {
+			continue;
+		}
+
+		shell_print(shell, "%-6d %8u %10u us %12llu us %8u us %8u us",
+			    i, stats->count, stats->last_residency_us,
+			    stats->total_residency_us,
+			    stats->last_exit_latency_us,
+			    stats->max_exit_latency_us);
+
+		for (int b = 0; b < SYS_PM_STATS_HIST_BUCKETS; b++) {
+			off += snprintk(&hist[off], sizeof(hist) - off,
+					b == 0 ? "%u" : " %u",
+					stats->residency_hist[b]);
+		}
+
+		shell_print(shell, "       residency hist (log2 us): [%s]",
+			    hist);
+	}
+
+	return 0;
+}
+
+static int cmd_pm_wakeup(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_pm_stats_get(&snapshot);
+
+	shell_print(shell, "%-10s %8s", "source", "wakeups");
+
+	for (int i = 0; i < ARRAY_SIZE(snapshot.wakeup); i++) {
+		if (snapshot.wakeup[i].count == 0U) {
+			continue;
+		}
+
+		shell_print(shell, "%-10u %8u", snapshot.wakeup[i].id,
+			    snapshot.wakeup[i].count);
+	}
+
+	return 0;
+}
+
+static int cmd_pm_dump(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_pm_stats_get(&snapshot);
+
+	shell_hexdump(shell, (const uint8_t *)&snapshot, sizeof(snapshot));
+
+	return 0;
+}
+
+static int cmd_pm_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_pm_stats_reset();
+
+	shell_print(shell, "PM statistics reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_pm,
+	SHELL_CMD(stats, NULL, "Show power state statistics.", cmd_pm_stats),
+	SHELL_CMD(wakeup, NULL, "Show wakeup source counters.", cmd_pm_wakeup),
+	SHELL_CMD(dump, NULL, "Hexdump the binary statistics snapshot.",
+		  cmd_pm_dump),
+	SHELL_CMD(reset, NULL, "Reset the statistics.", cmd_pm_reset),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+
+SHELL_CMD_REGISTER(pm, &sub_pm, "Power management commands", NULL);
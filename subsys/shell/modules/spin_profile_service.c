@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <shell/shell.h>
+#include <debug/spin_profile.h>
+
+static int cmd_spinlocks(const struct shell *shell, size_t argc, char **argv)
+{
+	const struct spin_profile_entry *order[CONFIG_SPIN_PROFILE_MAX_SITES];
+	size_t used = 0;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	/* Collect used slots, insertion-sorted by total wait cycles */
+	for (size_t i = 0; i < spin_profile_max_sites(); i++) {
+		const struct spin_profile_entry *entry = spin_profile_get(i);
+		size_t pos;
+
+		if (entry->site == NULL) {
+			continue;
+		}
+		for (pos = used; pos > 0; pos--) {
+			if (order[pos - 1]->wait_cycles >= entry->wait_cycles) {
+				break;
+			}
+			order[pos] = order[pos - 1];
+		}
+		order[pos] = entry;
+		used++;
+	}
+
+	shell_print(shell, "%-10s %10s %12s %12s %10s",
+		    "site", "count", "wait cyc", "hold cyc", "max hold");
+
+	for (size_t i = 0; i < used; i++) {
+		const struct spin_profile_entry *entry = order[i];
+
+		shell_print(shell, "%-10p %10u %12llu %12llu %10u",
+			    entry->site, entry->count,
+			    (unsigned long long)entry->wait_cycles,
+			    (unsigned long long)entry->hold_cycles,
+			    entry->max_hold_cycles);
+	}
+
+	shell_print(shell, "%u/%u lock sites used", (uint32_t)used,
+		    (uint32_t)spin_profile_max_sites());
+
+	return 0;
+}
+
+SHELL_CMD_REGISTER(spinlocks, NULL,
+		   "Per-site spinlock contention and hold-time profile",
+		   cmd_spinlocks);
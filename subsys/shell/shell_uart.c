@@ -133,6 +133,110 @@ static void uart_callback(const struct device *dev, void *user_data)
 }
 #endif /* CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN */
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+#define RX_DMA_BUF_SIZE CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE
+#define RX_DMA_TIMEOUT CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_TIMEOUT_MS
+
+static uint8_t *async_rx_buf_get(const struct shell_uart *sh_uart, uint8_t idx)
+{
+	return &sh_uart->rx_dma_buf[(size_t)idx * RX_DMA_BUF_SIZE];
+}
+
+static void async_rx_rdy_handle(const struct shell_uart *sh_uart,
+				struct uart_event_rx *rx)
+{
+	uint8_t *data = &rx->buf[rx->offset];
+	size_t len = rx->len;
+	uint32_t wr_len;
+#ifdef CONFIG_MCUMGR_SMP_SHELL
+	/* Divert bytes from shell handling if they are part of an mcumgr
+	 * frame.
+	 */
+	size_t i = smp_shell_rx_bytes(&sh_uart->ctrl_blk->smp, data, len);
+
+	data += i;
+	len -= i;
+#endif /* CONFIG_MCUMGR_SMP_SHELL */
+
+	wr_len = ring_buf_put(sh_uart->rx_ringbuf, data, len);
+	if (wr_len < len) {
+		LOG_WRN("RX ring buffer full.");
+	}
+
+	sh_uart->ctrl_blk->handler(SHELL_TRANSPORT_EVT_RX_RDY,
+				   sh_uart->ctrl_blk->context);
+}
+
+static void async_tx_start(const struct shell_uart *sh_uart)
+{
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+	uint8_t *data;
+	uint32_t len;
+
+	len = ring_buf_get_claim(sh_uart->tx_ringbuf, &data,
+				 sh_uart->tx_ringbuf->size);
+	if (len == 0U) {
+		ctrl_blk->tx_busy = 0;
+		ctrl_blk->handler(SHELL_TRANSPORT_EVT_TX_RDY,
+				  ctrl_blk->context);
+		return;
+	}
+
+	/* The whole claimed chunk is handed to the driver and completes
+	 * with a single UART_TX_DONE, no matter how many bytes it holds.
+	 */
+	if (uart_tx(ctrl_blk->dev, data, len, SYS_FOREVER_MS) < 0) {
+		(void)ring_buf_get_finish(sh_uart->tx_ringbuf, 0);
+		ctrl_blk->tx_busy = 0;
+	}
+}
+
+static void async_callback(const struct device *dev, struct uart_event *evt,
+			   void *user_data)
+{
+	const struct shell_uart *sh_uart = (struct shell_uart *)user_data;
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		(void)ring_buf_get_finish(sh_uart->tx_ringbuf,
+					  evt->data.tx.len);
+		async_tx_start(sh_uart);
+		break;
+	case UART_RX_RDY:
+		async_rx_rdy_handle(sh_uart, &evt->data.rx);
+		break;
+	case UART_RX_BUF_REQUEST:
+		(void)uart_rx_buf_rsp(dev,
+				      async_rx_buf_get(sh_uart,
+						       ctrl_blk->rx_dma_idx),
+				      RX_DMA_BUF_SIZE);
+		ctrl_blk->rx_dma_idx = 1U - ctrl_blk->rx_dma_idx;
+		break;
+	case UART_RX_DISABLED:
+		/* Restart reception, e.g. after an error stopped it. */
+		ctrl_blk->rx_dma_idx = 1U;
+		(void)uart_rx_enable(dev, async_rx_buf_get(sh_uart, 0),
+				     RX_DMA_BUF_SIZE, RX_DMA_TIMEOUT);
+		break;
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_SHELL_BACKEND_SERIAL_ASYNC */
+
+static void uart_async_init(const struct shell_uart *sh_uart)
+{
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+	const struct device *dev = sh_uart->ctrl_blk->dev;
+
+	uart_callback_set(dev, async_callback, (void *)sh_uart);
+	sh_uart->ctrl_blk->rx_dma_idx = 1U;
+	uart_rx_enable(dev, async_rx_buf_get(sh_uart, 0),
+		       RX_DMA_BUF_SIZE, RX_DMA_TIMEOUT);
+#endif
+}
+
 static void uart_irq_init(const struct shell_uart *sh_uart)
 {
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
@@ -169,7 +273,9 @@ static int init(const struct shell_transport *transport,
 	sh_uart->ctrl_blk->handler = evt_handler;
 	sh_uart->ctrl_blk->context = context;
 
-	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
+	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_ASYNC)) {
+		uart_async_init(sh_uart);
+	} else if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		uart_irq_init(sh_uart);
 	} else {
 		k_timer_init(sh_uart->timer, timer_handler, NULL);
@@ -184,7 +290,9 @@ static int uninit(const struct shell_transport *transport)
 {
 	const struct shell_uart *sh_uart = (struct shell_uart *)transport->ctx;
 
-	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
+	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_ASYNC)) {
+		(void)uart_rx_disable(sh_uart->ctrl_blk->dev);
+	} else if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		const struct device *dev = sh_uart->ctrl_blk->dev;
 
 		uart_irq_rx_disable(dev);
@@ -202,7 +310,9 @@ static int enable(const struct shell_transport *transport, bool blocking_tx)
 	sh_uart->ctrl_blk->blocking_tx = blocking_tx;
 
 	if (blocking_tx) {
-#ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
+#if defined(CONFIG_SHELL_BACKEND_SERIAL_ASYNC)
+		(void)uart_tx_abort(sh_uart->ctrl_blk->dev);
+#elif defined(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)
 		uart_irq_tx_disable(sh_uart->ctrl_blk->dev);
 #endif
 	}
@@ -216,7 +326,9 @@ static void irq_write(const struct shell_uart *sh_uart, const void *data,
 	*cnt = ring_buf_put(sh_uart->tx_ringbuf, data, length);
 
 	if (atomic_set(&sh_uart->ctrl_blk->tx_busy, 1) == 0) {
-#ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
+#if defined(CONFIG_SHELL_BACKEND_SERIAL_ASYNC)
+		async_tx_start(sh_uart);
+#elif defined(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)
 		uart_irq_tx_enable(sh_uart->ctrl_blk->dev);
 #endif
 	}
@@ -228,7 +340,8 @@ static int write(const struct shell_transport *transport,
 	const struct shell_uart *sh_uart = (struct shell_uart *)transport->ctx;
 	const uint8_t *data8 = (const uint8_t *)data;
 
-	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) &&
+	if ((IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) ||
+	     IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_ASYNC)) &&
 		!sh_uart->ctrl_blk->blocking_tx) {
 		irq_write(sh_uart, data, length, cnt);
 	} else {
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include <zephyr/types.h>
+#include <kernel.h>
 #include <stats/stats.h>
 
 #define STATS_GEN_NAME_MAX_LEN  (sizeof("s255"))
@@ -16,6 +17,25 @@
 /* The global list of registered statistic groups. */
 static struct stats_hdr *stats_list;
 
+#ifdef CONFIG_STATS_PERCPU
+/* Updates go to the executing CPU's shadow block so concurrent
+ * increments from different CPUs never touch the same cache line.
+ * Readers fold the shadows back together in stats_snapshot().
+ */
+static uint8_t stats_percpu_pool[CONFIG_MP_NUM_CPUS]
+			       [CONFIG_STATS_PERCPU_POOL_SIZE];
+static uint16_t stats_percpu_used;
+
+void *
+stats_percpu_addr(struct stats_hdr *hdr, void *addr)
+{
+	size_t off = (uint8_t *)addr - ((uint8_t *)hdr + sizeof(*hdr));
+
+	return &stats_percpu_pool[arch_curr_cpu()->id]
+				 [hdr->s_percpu_off + off];
+}
+#endif
+
 static const char *
 stats_get_name(const struct stats_hdr *hdr, int idx)
 {
@@ -232,6 +252,17 @@ stats_register(const char *name, struct stats_hdr *hdr)
 		prev = cur;
 	}
 
+#ifdef CONFIG_STATS_PERCPU
+	uint16_t size = hdr->s_size * hdr->s_cnt;
+
+	if (stats_percpu_used + size > CONFIG_STATS_PERCPU_POOL_SIZE) {
+		return -ENOMEM;
+	}
+
+	hdr->s_percpu_off = stats_percpu_used;
+	stats_percpu_used += size;
+#endif
+
 	if (prev == NULL) {
 		stats_list = hdr;
 	} else {
@@ -282,4 +313,68 @@ void
 stats_reset(struct stats_hdr *hdr)
 {
 	(void)memset((uint8_t *)hdr + sizeof(*hdr), 0, hdr->s_size * hdr->s_cnt);
+
+#ifdef CONFIG_STATS_PERCPU
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		(void)memset(&stats_percpu_pool[cpu][hdr->s_percpu_off], 0,
+			     hdr->s_size * hdr->s_cnt);
+	}
+#endif
+}
+
+/**
+ * Copies a consistent snapshot of the entry area of a statistics group
+ * into buf, folding in the per-CPU shadow counters when enabled.
+ *
+ * @param hdr The statistics group to snapshot
+ * @param buf The buffer receiving the entries
+ * @param len The size of the buffer, in bytes
+ *
+ * @return number of bytes copied on success, -EINVAL if buf is too small.
+ */
+int
+stats_snapshot(struct stats_hdr *hdr, void *buf, size_t len)
+{
+	size_t size = hdr->s_size * hdr->s_cnt;
+	unsigned int key;
+
+	if (len < size) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	memcpy(buf, (uint8_t *)hdr + sizeof(*hdr), size);
+
+#ifdef CONFIG_STATS_PERCPU
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		const uint8_t *shadow =
+			&stats_percpu_pool[cpu][hdr->s_percpu_off];
+
+		for (int i = 0; i < hdr->s_cnt; i++) {
+			size_t off = i * hdr->s_size;
+
+			switch (hdr->s_size) {
+			case sizeof(uint16_t):
+				*(uint16_t *)((uint8_t *)buf + off) +=
+					*(const uint16_t *)&shadow[off];
+				break;
+			case sizeof(uint32_t):
+				*(uint32_t *)((uint8_t *)buf + off) +=
+					*(const uint32_t *)&shadow[off];
+				break;
+			case sizeof(uint64_t):
+				*(uint64_t *)((uint8_t *)buf + off) +=
+					*(const uint64_t *)&shadow[off];
+				break;
+			default:
+				break;
+			}
+		}
+	}
+#endif
+
+	irq_unlock(key);
+
+	return size;
 }
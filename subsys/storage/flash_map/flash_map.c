@@ -198,6 +198,23 @@ int flash_area_read(const struct flash_area *fa, off_t off, void *dst,
 	return flash_read(dev, fa->fa_off + off, dst, len);
 }
 
+const void *flash_area_get_pointer(const struct flash_area *fa, off_t off,
+				   size_t len)
+{
+	const struct device *dev;
+
+	if (!is_in_flash_area_bounds(fa, off, len)) {
+		return NULL;
+	}
+
+	dev = device_get_binding(fa->fa_dev_name);
+	if (dev == NULL) {
+		return NULL;
+	}
+
+	return flash_get_mapped_address(dev, fa->fa_off + off);
+}
+
 int flash_area_write(const struct flash_area *fa, off_t off, const void *src,
 		     size_t len)
 {
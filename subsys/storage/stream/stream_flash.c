@@ -49,19 +49,17 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+static int flash_program(struct stream_flash_ctx *ctx, size_t write_addr,
+			 uint8_t *buf, size_t len)
 {
 	int rc = 0;
-	size_t write_addr = ctx->offset + ctx->bytes_written;
-
 
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
-		if (ctx->buf_bytes == 0) {
+		if (len == 0) {
 			return 0;
 		}
 
-		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
+		rc = stream_flash_erase_page(ctx, write_addr + len - 1);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
 				rc, write_addr);
@@ -70,7 +68,7 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	flash_write_protection_set(ctx->fdev, false);
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, ctx->buf_bytes);
+	rc = flash_write(ctx->fdev, write_addr, buf, len);
 	flash_write_protection_set(ctx->fdev, true);
 
 	if (rc != 0) {
@@ -83,29 +81,116 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < len; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, len);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, len, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 		}
 	}
 
+	return rc;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	rc = flash_program(ctx, ctx->offset + ctx->bytes_written, ctx->buf,
+			   ctx->buf_bytes);
+	if (rc != 0) {
+		return rc;
+	}
+
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
-	return rc;
+	return 0;
 }
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+
+static void stream_flash_wb_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, wb_work);
+
+	ctx->wb_rc = flash_program(ctx, ctx->wb_addr, ctx->wb_buf,
+				   ctx->wb_bytes);
+	k_sem_give(&ctx->wb_done);
+}
+
+/* wait until no background write is running, keeping the idle state */
+static int stream_flash_wb_wait(struct stream_flash_ctx *ctx)
+{
+	k_sem_take(&ctx->wb_done, K_FOREVER);
+	k_sem_give(&ctx->wb_done);
+	return ctx->wb_rc;
+}
+
+/* hand the full write buffer over to the background write and continue
+ * filling the buffer the previous background write has finished with.
+ */
+static int flash_sync_background(struct stream_flash_ctx *ctx)
+{
+	uint8_t *spare;
+	int rc;
+
+	rc = stream_flash_wb_wait(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+	k_sem_take(&ctx->wb_done, K_FOREVER);
+
+	spare = ctx->wb_buf;
+	ctx->wb_buf = ctx->buf;
+	ctx->wb_bytes = ctx->buf_bytes;
+	ctx->wb_addr = ctx->offset + ctx->bytes_written;
+
+	/* Submitted bytes count as written; the caller-side accounting
+	 * keeps the available-space check exact while the background
+	 * write is still running.
+	 */
+	ctx->bytes_written += ctx->buf_bytes;
+	ctx->buf = spare;
+	ctx->buf_bytes = 0U;
+
+	k_work_submit(&ctx->wb_work);
+
+	return 0;
+}
+
+int stream_flash_double_buffer_init(struct stream_flash_ctx *ctx, uint8_t *buf,
+				    size_t buf_len)
+{
+	if (!ctx || !buf) {
+		return -EFAULT;
+	}
+
+	if (buf_len < ctx->buf_len) {
+		LOG_ERR("Second buffer smaller than the write buffer");
+		return -EFAULT;
+	}
+
+	ctx->wb_buf = buf;
+	ctx->wb_bytes = 0U;
+	ctx->wb_rc = 0;
+	k_work_init(&ctx->wb_work, stream_flash_wb_handler);
+	k_sem_init(&ctx->wb_done, 1, 1);
+
+	return 0;
+}
+
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
@@ -129,7 +214,14 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		       buf_empty_bytes);
 
 		ctx->buf_bytes = ctx->buf_len;
-		rc = flash_sync(ctx);
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+		if (ctx->wb_buf != NULL) {
+			rc = flash_sync_background(ctx);
+		} else
+#endif
+		{
+			rc = flash_sync(ctx);
+		}
 
 		if (rc != 0) {
 			return rc;
@@ -145,6 +237,16 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		ctx->buf_bytes += len - processed;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	/* a flush must also cover a still running background write */
+	if (flush && (ctx->wb_buf != NULL)) {
+		rc = stream_flash_wb_wait(ctx);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+#endif
+
 	if (flush && ctx->buf_bytes > 0) {
 		fill_length = flash_get_write_block_size(ctx->fdev);
 		if (ctx->buf_bytes % fill_length) {
@@ -232,6 +334,9 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->last_erased_page_start_offset = -1;
 #endif
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	ctx->wb_buf = NULL;
+#endif
 
 	return 0;
 }
@@ -23,6 +23,11 @@ static struct cpu_stats stats_hw_tick;
 static int nested_interrupts;
 static struct k_thread *current_thread;
 
+#ifdef CONFIG_TRACING_THREAD_STATS
+/* Cycle counter value when the current thread was switched in. */
+static uint32_t thread_in_time;
+#endif
+
 void update_counter(volatile uint64_t *cnt)
 {
 	uint32_t time = k_cycle_get_32();
@@ -98,6 +103,11 @@ void sys_trace_thread_switched_in(void)
 
 	cpu_stats_update_counters();
 	current_thread = k_current_get();
+#ifdef CONFIG_TRACING_THREAD_STATS
+	/* cpu_stats_update_counters() just refreshed last_time. */
+	thread_in_time = last_time;
+	current_thread->run_switches++;
+#endif
 	if (z_is_idle_thread_object(current_thread)) {
 		last_cpu_state = CPU_STATE_IDLE;
 	} else {
@@ -114,6 +124,17 @@ void sys_trace_thread_switched_out(void)
 	__ASSERT_NO_MSG(!current_thread || (current_thread == k_current_get()));
 
 	cpu_stats_update_counters();
+#ifdef CONFIG_TRACING_THREAD_STATS
+	if (current_thread != NULL) {
+		if (last_time >= thread_in_time) {
+			current_thread->run_cycles +=
+				last_time - thread_in_time;
+		} else {
+			current_thread->run_cycles +=
+				UINT32_MAX - thread_in_time + 1 + last_time;
+		}
+	}
+#endif
 	last_cpu_state = CPU_STATE_SCHEDULER;
 	irq_unlock(key);
 }
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020 Intel corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <sys/__assert.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_backend.h>
+#include <SEGGER_RTT.h>
+
+static uint8_t rtt_up_buf[CONFIG_TRACING_BACKEND_RTT_BUFFER_SIZE];
+
+static void tracing_backend_rtt_init(void)
+{
+	SEGGER_RTT_ConfigUpBuffer(CONFIG_TRACING_BACKEND_RTT_BUFFER,
+				  "Tracing", rtt_up_buf, sizeof(rtt_up_buf),
+				  SEGGER_RTT_MODE_NO_BLOCK_TRIM);
+}
+
+static void tracing_backend_rtt_output(
+		const struct tracing_backend *backend,
+		uint8_t *data, uint32_t length)
+{
+	int retry = CONFIG_TRACING_BACKEND_RTT_RETRY_CNT;
+
+	/* The up buffer is drained by the debug probe in the background,
+	 * so on backpressure the remainder is retried instead of dropped
+	 * to keep the stream lossless. Output runs in the tracing thread,
+	 * so sleeping here does not block the traced system. If the host
+	 * stops reading, the packet is dropped after the retries and
+	 * counted like any other dropped packet.
+	 */
+	while (length) {
+		uint32_t written;
+
+		written = SEGGER_RTT_WriteNoLock(
+				CONFIG_TRACING_BACKEND_RTT_BUFFER,
+				data, length);
+		data += written;
+		length -= written;
+
+		if (written == 0U) {
+			if (retry-- <= 0) {
+				tracing_packet_drop_handle();
+				return;
+			}
+
+			k_msleep(CONFIG_TRACING_BACKEND_RTT_RETRY_DELAY_MS);
+		}
+	}
+}
+
+const struct tracing_backend_api tracing_backend_rtt_api = {
+	.init = tracing_backend_rtt_init,
+	.output = tracing_backend_rtt_output
+};
+
+TRACING_BACKEND_DEFINE(tracing_backend_rtt, tracing_backend_rtt_api);
@@ -4,10 +4,65 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <kernel.h>
 #include <sys/ring_buffer.h>
 
+#if defined(CONFIG_TRACING_PERCPU_BUFFER)
+/* One ring per CPU: a trace event is only ever written to the ring of
+ * the CPU emitting it, so heavy tracing on one CPU does not contend
+ * with producers on the others. The draining stage round-robins over
+ * the rings one claimed chunk at a time; packets never span rings and
+ * carry their own timestamps, which the host side uses to order the
+ * merged stream.
+ */
+static struct ring_buf tracing_ring_bufs[CONFIG_MP_NUM_CPUS];
+static uint8_t tracing_buffers[CONFIG_MP_NUM_CPUS]
+			      [CONFIG_TRACING_BUFFER_SIZE + 1];
+
+/* Ring the outstanding get claim was taken from. Only accessed by the
+ * single draining context.
+ */
+static uint8_t drain_ring;
+
+static struct ring_buf *put_ring_get(void)
+{
+	return &tracing_ring_bufs[arch_curr_cpu()->id];
+}
+
+/* Pick the next non-empty ring, continuing from the last drained one
+ * so that a busy CPU cannot starve the others out of the stream.
+ */
+static struct ring_buf *get_ring_get(void)
+{
+	uint8_t ring = drain_ring;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		ring = (ring + 1) % CONFIG_MP_NUM_CPUS;
+
+		if (!ring_buf_is_empty(&tracing_ring_bufs[ring])) {
+			break;
+		}
+	}
+
+	drain_ring = ring;
+
+	return &tracing_ring_bufs[ring];
+}
+#else
 static struct ring_buf tracing_ring_buf;
 static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+
+static struct ring_buf *put_ring_get(void)
+{
+	return &tracing_ring_buf;
+}
+
+static struct ring_buf *get_ring_get(void)
+{
+	return &tracing_ring_buf;
+}
+#endif /* CONFIG_TRACING_PERCPU_BUFFER */
+
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
@@ -19,51 +74,77 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(put_ring_get(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	return ring_buf_put_finish(put_ring_get(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	return ring_buf_put(put_ring_get(), data, size);
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+	return ring_buf_get_claim(get_ring_get(), data, size);
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
+#if defined(CONFIG_TRACING_PERCPU_BUFFER)
+	return ring_buf_get_finish(&tracing_ring_bufs[drain_ring], size);
+#else
 	return ring_buf_get_finish(&tracing_ring_buf, size);
+#endif
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	return ring_buf_get(get_ring_get(), data, size);
 }
 
 void tracing_buffer_init(void)
 {
+#if defined(CONFIG_TRACING_PERCPU_BUFFER)
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		ring_buf_init(&tracing_ring_bufs[i],
+			      sizeof(tracing_buffers[i]),
+			      tracing_buffers[i]);
+	}
+#else
 	ring_buf_init(&tracing_ring_buf,
 		      sizeof(tracing_buffer), tracing_buffer);
+#endif
 }
 
 bool tracing_buffer_is_empty(void)
 {
+#if defined(CONFIG_TRACING_PERCPU_BUFFER)
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_bufs[i])) {
+			return false;
+		}
+	}
+
+	return true;
+#else
 	return ring_buf_is_empty(&tracing_ring_buf);
+#endif
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
+#if defined(CONFIG_TRACING_PERCPU_BUFFER)
+	return ring_buf_capacity_get(&tracing_ring_bufs[0]);
+#else
 	return ring_buf_capacity_get(&tracing_ring_buf);
+#endif
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(put_ring_get());
 }
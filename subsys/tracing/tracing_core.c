@@ -20,6 +20,8 @@
 #define TRACING_BACKEND_NAME "tracing_backend_uart"
 #elif defined CONFIG_TRACING_BACKEND_USB
 #define TRACING_BACKEND_NAME "tracing_backend_usb"
+#elif defined CONFIG_TRACING_BACKEND_RTT
+#define TRACING_BACKEND_NAME "tracing_backend_rtt"
 #elif defined CONFIG_TRACING_BACKEND_POSIX
 #define TRACING_BACKEND_NAME "tracing_backend_posix"
 #else
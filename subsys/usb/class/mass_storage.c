@@ -52,7 +52,14 @@ LOG_MODULE_REGISTER(usb_msc);
 #define MAX_PACKET	CONFIG_MASS_STORAGE_BULK_EP_MPS
 
 #define BLOCK_SIZE	512
+#define BUF_SIZE	CONFIG_MASS_STORAGE_BUF_SIZE
+#define BUF_BLOCKS	(BUF_SIZE / BLOCK_SIZE)
 #define DISK_KERNEL_STACK_SZ	512
+
+BUILD_ASSERT(BUF_SIZE % BLOCK_SIZE == 0,
+	     "Buffer size must be a multiple of the block size");
+BUILD_ASSERT(BUF_SIZE % CONFIG_MASS_STORAGE_BULK_EP_MPS == 0,
+	     "Buffer size must be a multiple of the bulk endpoint size");
 #define DISK_THREAD_PRIO	-5
 
 #define THREAD_OP_READ_QUEUED		1
@@ -110,14 +117,16 @@ static struct k_sem disk_wait_sem;
 static volatile uint32_t defered_wr_sz;
 
 /*
- * Keep block buffer larger than BLOCK_SIZE for the case
- * the dCBWDataTransferLength is multiple of the BLOCK_SIZE and
- * the length of the transferred data is not aligned to the BLOCK_SIZE.
+ * The page buffer holds several blocks so that the disk is accessed
+ * once per buffer instead of once per block. Keep it larger than
+ * BUF_SIZE for the case the dCBWDataTransferLength is multiple of the
+ * BLOCK_SIZE and the length of the transferred data is not aligned to
+ * the BLOCK_SIZE.
  *
  * Align for cases where the underlying disk access requires word-aligned
  * addresses.
  */
-static uint8_t __aligned(4) page[BLOCK_SIZE + CONFIG_MASS_STORAGE_BULK_EP_MPS];
+static uint8_t __aligned(4) page[BUF_SIZE + CONFIG_MASS_STORAGE_BULK_EP_MPS];
 
 /* Initialized during mass_storage_init() */
 static uint32_t memory_size;
@@ -175,6 +184,12 @@ static uint32_t addr;
 /*length of a reading or writing*/
 static uint32_t length;
 
+/*byte address of the first byte cached in the page buffer*/
+static uint32_t page_addr;
+
+/*number of valid bytes in the page buffer*/
+static uint32_t page_len;
+
 static uint8_t max_lun_count;
 
 /*memory OK (after a memoryVerify)*/
@@ -192,6 +207,8 @@ static void msd_init(void)
 	(void)memset(page, 0, sizeof(page));
 	addr = 0U;
 	length = 0U;
+	page_addr = 0U;
+	page_len = 0U;
 }
 
 static void sendCSW(void)
@@ -377,7 +394,7 @@ static void thread_memory_read_done(void)
 	}
 
 	if (usb_write(mass_ep_data[MSD_IN_EP_IDX].ep_addr,
-		&page[addr % BLOCK_SIZE], n, NULL) != 0) {
+		&page[addr - page_addr], n, NULL) != 0) {
 		LOG_ERR("Failed to write EP 0x%x",
 			mass_ep_data[MSD_IN_EP_IDX].ep_addr);
 	}
@@ -404,15 +421,15 @@ static void memoryRead(void)
 		stage = MSC_ERROR;
 	}
 
-	/* we read an entire block */
-	if (!(addr % BLOCK_SIZE)) {
+	/* all buffered blocks consumed -> read a new set of blocks */
+	if (addr < page_addr || (addr + n) > (page_addr + page_len)) {
 		thread_op = THREAD_OP_READ_QUEUED;
 		LOG_DBG("Signal thread for %d", (addr/BLOCK_SIZE));
 		k_sem_give(&disk_wait_sem);
 		return;
 	}
 	usb_write(mass_ep_data[MSD_IN_EP_IDX].ep_addr,
-		  &page[addr % BLOCK_SIZE], n, NULL);
+		  &page[addr - page_addr], n, NULL);
 	addr += n;
 	length -= n;
 
@@ -458,6 +475,12 @@ static bool infoTransfer(void)
 
 	addr = n * BLOCK_SIZE;
 
+	/* the page buffer content, if any, belongs to the previous
+	 * command
+	 */
+	page_addr = 0U;
+	page_len = 0U;
+
 	/* Number of Blocks to transfer */
 	switch (cbw.CB[0]) {
 	case READ10:
@@ -634,17 +657,24 @@ static void memoryVerify(uint8_t *buf, uint16_t size)
 		LOG_WRN("Stall OUT endpoint");
 	}
 
-	/* beginning of a new block -> load a whole block in RAM */
-	if (!(addr % BLOCK_SIZE)) {
+	/* not in the page buffer -> load a whole buffer of blocks in RAM */
+	if (addr < page_addr || (addr + size) > (page_addr + page_len)) {
+		uint32_t n_blk = MIN(BUF_BLOCKS,
+				     (length + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
 		LOG_DBG("Disk READ sector %d", addr/BLOCK_SIZE);
-		if (disk_access_read(disk_pdrv, page, addr/BLOCK_SIZE, 1)) {
+		if (disk_access_read(disk_pdrv, page, addr/BLOCK_SIZE,
+				     n_blk)) {
 			LOG_ERR("---- Disk Read Error %d", addr/BLOCK_SIZE);
 		}
+
+		page_addr = addr;
+		page_len = n_blk * BLOCK_SIZE;
 	}
 
 	/* info are in RAM -> no need to re-read memory */
 	for (n = 0U; n < size; n++) {
-		if (page[addr%BLOCK_SIZE + n] != buf[n]) {
+		if (page[addr - page_addr + n] != buf[n]) {
 			LOG_DBG("Mismatch sector %d offset %d",
 				addr/BLOCK_SIZE, n);
 			memOK = false;
@@ -672,21 +702,33 @@ static void memoryWrite(uint8_t *buf, uint16_t size)
 		LOG_WRN("Stall OUT endpoint");
 	}
 
-	/* we fill an array in RAM of 1 block before writing it in memory */
-	for (int i = 0; i < size; i++) {
-		page[addr % BLOCK_SIZE + i] = buf[i];
+	/* we fill an array in RAM of several blocks before writing it
+	 * in memory
+	 */
+	if (page_len == 0U) {
+		page_addr = addr;
 	}
+	memcpy(&page[addr - page_addr], buf, size);
+	page_len = addr - page_addr + size;
 
-	/* if the array is filled, write it in memory */
-	if ((addr % BLOCK_SIZE) + size >= BLOCK_SIZE) {
-		if (!(disk_access_status(disk_pdrv) &
+	/* if the array is filled, or this is the last chunk of the
+	 * transfer, write the buffered blocks in memory
+	 */
+	if (page_len >= BUF_SIZE || size >= length) {
+		if (page_len >= BLOCK_SIZE &&
+		    !(disk_access_status(disk_pdrv) &
 					DISK_STATUS_WR_PROTECT)) {
-			LOG_DBG("Disk WRITE Qd %d", (addr/BLOCK_SIZE));
+			LOG_DBG("Disk WRITE Qd %d", (page_addr/BLOCK_SIZE));
 			thread_op = THREAD_OP_WRITE_QUEUED;  /* write_queued */
 			defered_wr_sz = size;
 			k_sem_give(&disk_wait_sem);
 			return;
 		}
+
+		/* nothing to write (e.g. write protected disk), drop
+		 * the buffered data
+		 */
+		page_len = 0U;
 	}
 
 	addr += size;
@@ -756,12 +798,17 @@ static void mass_storage_bulk_out(uint8_t ep,
 static void thread_memory_write_done(void)
 {
 	uint32_t size = defered_wr_sz;
-	size_t overflowed_len = (addr + size) % CONFIG_MASS_STORAGE_BULK_EP_MPS;
+	size_t overflowed_len = page_len % BLOCK_SIZE;
 
+	/* a tail not making up a whole block stays buffered */
 	if (overflowed_len) {
-		memmove(page, &page[BLOCK_SIZE], overflowed_len);
+		memmove(page, &page[page_len - overflowed_len],
+			overflowed_len);
 	}
 
+	page_addr += page_len - overflowed_len;
+	page_len = overflowed_len;
+
 	addr += size;
 	length -= size;
 	csw.DataResidue -= size;
@@ -912,20 +959,28 @@ static void mass_thread_main(int arg1, int unused)
 		LOG_DBG("sem %d", thread_op);
 
 		switch (thread_op) {
-		case THREAD_OP_READ_QUEUED:
+		case THREAD_OP_READ_QUEUED: {
+			uint32_t n_blk = MIN(BUF_BLOCKS,
+					(length + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
 			if (disk_access_read(disk_pdrv,
-						page, (addr/BLOCK_SIZE), 1)) {
+						page, (addr/BLOCK_SIZE),
+						n_blk)) {
 				LOG_ERR("!! Disk Read Error %d !",
 					addr/BLOCK_SIZE);
 			}
 
+			page_addr = addr;
+			page_len = n_blk * BLOCK_SIZE;
 			thread_memory_read_done();
 			break;
+		}
 		case THREAD_OP_WRITE_QUEUED:
 			if (disk_access_write(disk_pdrv,
-						page, (addr/BLOCK_SIZE), 1)) {
+						page, (page_addr/BLOCK_SIZE),
+						(page_len/BLOCK_SIZE))) {
 				LOG_ERR("!!!!! Disk Write Error %d !!!!!",
-					addr/BLOCK_SIZE);
+					page_addr/BLOCK_SIZE);
 			}
 			thread_memory_write_done();
 			break;
@@ -251,6 +251,7 @@ static size_t ecm_eth_size(void *ecm_pkt, size_t len)
 static int ecm_send(struct net_pkt *pkt)
 {
 	size_t len = net_pkt_get_len(pkt);
+	uint8_t *data = tx_buf;
 	int ret;
 
 	if (VERBOSE_DEBUG) {
@@ -262,13 +263,20 @@ static int ecm_send(struct net_pkt *pkt)
 		return -ENOMEM;
 	}
 
-	if (net_pkt_read(pkt, tx_buf, len)) {
+	if (pkt->buffer && !pkt->buffer->frags && pkt->buffer->len == len) {
+		/* Whole frame is contiguous in a single fragment, transfer
+		 * it directly and skip the intermediate copy. The fragment
+		 * stays valid as the packet is not released before the
+		 * synchronous transfer finished.
+		 */
+		data = pkt->buffer->data;
+	} else if (net_pkt_read(pkt, tx_buf, len)) {
 		return -ENOBUFS;
 	}
 
 	/* transfer data to host */
 	ret = usb_transfer_sync(ecm_ep_data[ECM_IN_EP_IDX].ep_addr,
-				tx_buf, len, USB_TRANS_WRITE);
+				data, len, USB_TRANS_WRITE);
 	if (ret != len) {
 		LOG_ERR("Transfer failure");
 		return -EINVAL;
@@ -277,9 +285,37 @@ static int ecm_send(struct net_pkt *pkt)
 	return 0;
 }
 
+/* Pre-allocated packet the next endpoint read lands in directly, avoiding
+ * the copy from rx_buf. Only usable when a whole frame fits into a single
+ * data fragment, otherwise rx_buf is used as before.
+ */
+static struct net_pkt *rx_pkt;
+
+static uint8_t *ecm_rx_prepare(void)
+{
+	if (!rx_pkt) {
+		struct net_pkt *pkt;
+
+		pkt = net_pkt_alloc_with_buffer(netusb_net_iface(),
+						sizeof(rx_buf),
+						AF_UNSPEC, 0, K_NO_WAIT);
+		if (pkt) {
+			if (!pkt->buffer->frags &&
+			    net_buf_tailroom(pkt->buffer) >= sizeof(rx_buf)) {
+				rx_pkt = pkt;
+			} else {
+				net_pkt_unref(pkt);
+			}
+		}
+	}
+
+	return rx_pkt ? rx_pkt->buffer->data : rx_buf;
+}
+
 static void ecm_read_cb(uint8_t ep, int size, void *priv)
 {
-	struct net_pkt *pkt;
+	struct net_pkt *pkt = rx_pkt;
+	uint8_t *buf = pkt ? pkt->buffer->data : rx_buf;
 
 	if (size <= 0) {
 		goto done;
@@ -290,24 +326,30 @@ static void ecm_read_cb(uint8_t ep, int size, void *priv)
 	 * a short packet containing a null byte. Handle by checking the IP
 	 * header length and dropping the extra byte.
 	 */
-	if (rx_buf[size - 1] == 0U) { /* last byte is null */
-		if (ecm_eth_size(rx_buf, size) == (size - 1)) {
+	if (buf[size - 1] == 0U) { /* last byte is null */
+		if (ecm_eth_size(buf, size) == (size - 1)) {
 			/* last byte has been appended as delimiter, drop it */
 			size--;
 		}
 	}
 
-	pkt = net_pkt_alloc_with_buffer(netusb_net_iface(), size,
-					AF_UNSPEC, 0, K_FOREVER);
-	if (!pkt) {
-		LOG_ERR("no memory for network packet\n");
-		goto done;
-	}
+	if (pkt) {
+		/* Data is already in place, just account for it */
+		rx_pkt = NULL;
+		net_buf_add(pkt->buffer, size);
+	} else {
+		pkt = net_pkt_alloc_with_buffer(netusb_net_iface(), size,
+						AF_UNSPEC, 0, K_FOREVER);
+		if (!pkt) {
+			LOG_ERR("no memory for network packet\n");
+			goto done;
+		}
 
-	if (net_pkt_write(pkt, rx_buf, size)) {
-		LOG_ERR("Unable to write into pkt\n");
-		net_pkt_unref(pkt);
-		goto done;
+		if (net_pkt_write(pkt, buf, size)) {
+			LOG_ERR("Unable to write into pkt\n");
+			net_pkt_unref(pkt);
+			goto done;
+		}
 	}
 
 	if (VERBOSE_DEBUG) {
@@ -317,7 +359,7 @@ static void ecm_read_cb(uint8_t ep, int size, void *priv)
 	netusb_recv(pkt);
 
 done:
-	usb_transfer(ecm_ep_data[ECM_OUT_EP_IDX].ep_addr, rx_buf,
+	usb_transfer(ecm_ep_data[ECM_OUT_EP_IDX].ep_addr, ecm_rx_prepare(),
 		     sizeof(rx_buf), USB_TRANS_READ, ecm_read_cb, NULL);
 }
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _CACHE_PERF_PERF_CNT_H
+#define _CACHE_PERF_PERF_CNT_H
+
+/*
+ * @brief Per-operation cycle and hardware event accounting.
+ *
+ * Cycle counts come from the timing API.  On Cortex-M cores with a DWT
+ * the 8-bit profiling counters additionally give LSU (memory) stall and
+ * CPI stall cycles per operation; the deltas are sampled around every
+ * single operation so the 8-bit counters cannot wrap more than once.
+ * Targets without such counters report cycle counts only.
+ */
+
+#include <zephyr.h>
+#include <timing/timing.h>
+
+struct perf_cnt {
+	uint64_t cycles;
+	uint64_t lsu_stalls;
+	uint64_t cpi_stalls;
+	uint32_t ops;
+};
+
+#if defined(CONFIG_CORTEX_M_DWT)
+
+#include <arch/arm/aarch32/cortex_m/cmsis.h>
+
+struct perf_mark {
+	timing_t t;
+	uint8_t lsu;
+	uint8_t cpi;
+};
+
+static inline void perf_cnt_setup(void)
+{
+	DWT->CTRL |= DWT_CTRL_LSUEVTENA_Msk | DWT_CTRL_CPIEVTENA_Msk;
+}
+
+static inline void perf_mark_get(struct perf_mark *mark)
+{
+	mark->t = timing_counter_get();
+	mark->lsu = (uint8_t)DWT->LSUCNT;
+	mark->cpi = (uint8_t)DWT->CPICNT;
+}
+
+static inline void perf_cnt_accum(struct perf_cnt *cnt,
+				  struct perf_mark *mark)
+{
+	struct perf_mark now;
+
+	perf_mark_get(&now);
+	cnt->cycles += timing_cycles_get(&mark->t, &now.t);
+	/* 8-bit wrapping subtraction */
+	cnt->lsu_stalls += (uint8_t)(now.lsu - mark->lsu);
+	cnt->cpi_stalls += (uint8_t)(now.cpi - mark->cpi);
+	cnt->ops++;
+}
+
+static inline void perf_cnt_report(struct perf_cnt *cnt, const char *name)
+{
+	printk("%-52s: %8u ops, %6u cyc/op, %4u lsu-stall/op, %4u cpi-stall/op\n",
+	       name, cnt->ops,
+	       (uint32_t)(cnt->cycles / MAX(cnt->ops, 1U)),
+	       (uint32_t)(cnt->lsu_stalls / MAX(cnt->ops, 1U)),
+	       (uint32_t)(cnt->cpi_stalls / MAX(cnt->ops, 1U)));
+}
+
+#else /* no hardware event counters, cycles only */
+
+struct perf_mark {
+	timing_t t;
+};
+
+static inline void perf_cnt_setup(void)
+{
+}
+
+static inline void perf_mark_get(struct perf_mark *mark)
+{
+	mark->t = timing_counter_get();
+}
+
+static inline void perf_cnt_accum(struct perf_cnt *cnt,
+				  struct perf_mark *mark)
+{
+	struct perf_mark now;
+
+	perf_mark_get(&now);
+	cnt->cycles += timing_cycles_get(&mark->t, &now.t);
+	cnt->ops++;
+}
+
+static inline void perf_cnt_report(struct perf_cnt *cnt, const char *name)
+{
+	printk("%-52s: %8u ops, %6u cyc/op\n",
+	       name, cnt->ops,
+	       (uint32_t)(cnt->cycles / MAX(cnt->ops, 1U)));
+}
+
+#endif
+
+static inline void perf_cnt_reset(struct perf_cnt *cnt)
+{
+	cnt->cycles = 0U;
+	cnt->lsu_stalls = 0U;
+	cnt->cpi_stalls = 0U;
+	cnt->ops = 0U;
+}
+
+#endif
@@ -14,11 +14,12 @@
  * after starting, releases a semaphore which enable the first thread to run.
  * Each thread increases a common global counter and context switch back and
  * forth by yielding the cpu. When counter reaches the maximal value, threads
- * stop and the average time of context switch is displayed.
+ * stop and the distribution of the per-yield round trip times is displayed.
  */
 #include <kernel.h>
 #include <timing/timing.h>
 #include "utils.h"
+#include "stats.h"
 
 /* number of context switches */
 #define NCTXSWITCH 10000
@@ -32,8 +33,8 @@ static K_THREAD_STACK_DEFINE(thread_two_stack, STACKSIZE);
 static struct k_thread thread_one_data;
 static struct k_thread thread_two_data;
 
-static timing_t timestamp_start;
-static timing_t timestamp_end;
+/* sample set filled by thread_one, one entry per yield round trip */
+static struct sample_stats ctx_stats;
 
 /* context switches counter */
 static volatile uint32_t ctx_switch_counter;
@@ -54,17 +55,21 @@ K_SEM_DEFINE(sync_sema, 0, 1);
  */
 static void thread_one(void)
 {
-	k_sem_take(&sync_sema, K_FOREVER);
+	timing_t timestamp_start;
+	timing_t timestamp_end;
 
-	timestamp_start = timing_counter_get();
+	k_sem_take(&sync_sema, K_FOREVER);
 
 	while (ctx_switch_counter < NCTXSWITCH) {
+		timestamp_start = timing_counter_get();
 		k_yield();
+		timestamp_end = timing_counter_get();
+		sample_stats_add(&ctx_stats,
+				 timing_cycles_get(&timestamp_start,
+						   &timestamp_end));
 		ctx_switch_counter++;
 		ctx_switch_balancer--;
 	}
-
-	timestamp_end = timing_counter_get();
 }
 
 /**
@@ -100,6 +105,8 @@ int coop_ctx_switch(void)
 	timing_start();
 	bench_test_start();
 
+	sample_stats_init(&ctx_stats, sample_pool, NUM_SAMPLES);
+
 	k_thread_create(&thread_one_data, thread_one_stack, STACKSIZE,
 			(k_thread_entry_t)thread_one, NULL, NULL, NULL,
 			K_PRIO_COOP(6), 0, K_NO_WAIT);
@@ -113,10 +120,8 @@ int coop_ctx_switch(void)
 		error_count++;
 		PRINT_OVERFLOW_ERROR();
 	} else {
-		uint32_t diff;
-
-		diff = timing_cycles_get(&timestamp_start, &timestamp_end);
-		PRINT_STATS_AVG("Average context switch time between threads (coop)", diff, ctx_switch_counter);
+		sample_stats_report(&ctx_stats,
+			"Context switch between threads (coop, round trip)");
 	}
 
 	timing_stop();
@@ -16,9 +16,13 @@
 
 #include <kernel.h>
 #include "utils.h"
+#include "stats.h"
 
 #include <irq_offload.h>
 
+/* the number of interrupt latency samples to collect */
+#define N_INT_SAMPLES 256
+
 static volatile int flag_var;
 
 static timing_t timestamp_start;
@@ -68,14 +72,27 @@ static void make_int(void)
  */
 int int_to_thread(void)
 {
-	uint32_t diff;
+	int i;
+	struct sample_stats stats;
 
 	timing_start();
 	TICK_SYNCH();
-	make_int();
+
+	sample_stats_init(&stats, sample_pool, NUM_SAMPLES);
+
+	for (i = 0; i < N_INT_SAMPLES; i++) {
+		make_int();
+		if (flag_var != 1) {
+			error_count++;
+			break;
+		}
+		sample_stats_add(&stats, timing_cycles_get(&timestamp_start,
+							   &timestamp_end));
+	}
+
 	if (flag_var == 1) {
-		diff = timing_cycles_get(&timestamp_start, &timestamp_end);
-		PRINT_STATS("Switch from ISR back to interrupted thread", diff);
+		sample_stats_report(&stats,
+			"Switch from ISR back to interrupted thread");
 	}
 	timing_stop();
 	return 0;
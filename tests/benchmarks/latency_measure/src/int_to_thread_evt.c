@@ -19,6 +19,10 @@
 #include <irq_offload.h>
 
 #include "utils.h"
+#include "stats.h"
+
+/* the number of rescheduling latency samples to collect */
+#define N_EVT_SAMPLES 256
 
 static timing_t timestamp_start;
 static timing_t timestamp_end;
@@ -63,9 +67,10 @@ static void worker(struct k_work *item)
  */
 void int_thread(void)
 {
-	k_sem_take(&INTSEMA, K_FOREVER);
-	irq_offload(latency_test_isr, NULL);
-	k_thread_suspend(k_current_get());
+	while (true) {
+		k_sem_take(&INTSEMA, K_FOREVER);
+		irq_offload(latency_test_isr, NULL);
+	}
 }
 
 K_THREAD_DEFINE(int_thread_id, 512, (k_thread_entry_t)int_thread, NULL, NULL,
@@ -79,19 +84,27 @@ K_THREAD_DEFINE(int_thread_id, 512, (k_thread_entry_t)int_thread, NULL, NULL,
  */
 int int_to_thread_evt(void)
 {
-	uint32_t diff;
+	int i;
+	struct sample_stats stats;
 
 	k_work_init(&work, worker);
 
 	timing_start();
 	TICK_SYNCH();
-	k_sem_give(&INTSEMA);
-	k_sem_take(&WORKSEMA, K_FOREVER);
-	timing_stop();
 
-	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+	sample_stats_init(&stats, sample_pool, NUM_SAMPLES);
+
+	for (i = 0; i < N_EVT_SAMPLES; i++) {
+		k_sem_give(&INTSEMA);
+		k_sem_take(&WORKSEMA, K_FOREVER);
+		sample_stats_add(&stats, timing_cycles_get(&timestamp_start,
+							   &timestamp_end));
+	}
+
+	timing_stop();
 
-	PRINT_STATS("Time from ISR to executing a different thread", diff)
+	sample_stats_report(&stats,
+		"Time from ISR to executing a different thread");
 
 	return 0;
 }
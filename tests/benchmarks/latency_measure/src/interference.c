@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Background load generators for the latency benchmarks.
+ *
+ * The default scenario runs with interrupts quiesced so the numbers
+ * reflect the best case. The generators below are enabled by the
+ * interference scenarios in testcase.yaml to show how the same
+ * operations behave with a periodic interrupt firing or with the
+ * logging subsystem active.
+ */
+
+#include <zephyr.h>
+
+#include "utils.h"
+
+#ifdef CONFIG_BENCHMARK_LOGGING_INTERFERENCE
+#include <logging/log.h>
+LOG_MODULE_REGISTER(latency_bench);
+#endif
+
+#ifdef CONFIG_BENCHMARK_TIMER_INTERFERENCE
+
+static void load_timer_handler(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	/* model an interrupt handler that does a bit of real work */
+	k_busy_wait(CONFIG_BENCHMARK_TIMER_INTERFERENCE_BUSY_US);
+}
+
+K_TIMER_DEFINE(load_timer, load_timer_handler, NULL);
+
+#endif /* CONFIG_BENCHMARK_TIMER_INTERFERENCE */
+
+#ifdef CONFIG_BENCHMARK_LOGGING_INTERFERENCE
+
+#define LOG_LOAD_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+static K_THREAD_STACK_DEFINE(log_load_stack, LOG_LOAD_STACK_SIZE);
+static struct k_thread log_load_thread;
+
+static void log_load_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t seq = 0U;
+
+	while (true) {
+		LOG_INF("background log message %u", seq);
+		seq++;
+		k_sleep(K_MSEC(CONFIG_BENCHMARK_LOGGING_INTERFERENCE_PERIOD_MS));
+	}
+}
+
+#endif /* CONFIG_BENCHMARK_LOGGING_INTERFERENCE */
+
+void interference_start(void)
+{
+#ifdef CONFIG_BENCHMARK_TIMER_INTERFERENCE
+	k_timer_start(&load_timer,
+		      K_USEC(CONFIG_BENCHMARK_TIMER_INTERFERENCE_PERIOD_US),
+		      K_USEC(CONFIG_BENCHMARK_TIMER_INTERFERENCE_PERIOD_US));
+#endif
+#ifdef CONFIG_BENCHMARK_LOGGING_INTERFERENCE
+	k_thread_create(&log_load_thread, log_load_stack, LOG_LOAD_STACK_SIZE,
+			log_load_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(9), 0, K_NO_WAIT);
+	k_thread_name_set(&log_load_thread, "log_load");
+#endif
+}
@@ -19,10 +19,10 @@ uint32_t tm_off; /* time necessary to read the time */
 int error_count; /* track number of errors */
 
 extern void thread_switch_yield(void);
-extern void int_to_thread(void);
-extern void int_to_thread_evt(void);
-extern void sema_test_signal(void);
-extern void mutex_lock_unlock(void);
+extern int int_to_thread(void);
+extern int int_to_thread_evt(void);
+extern int sema_test_signal(void);
+extern int mutex_lock_unlock(void);
 extern int coop_ctx_switch(void);
 extern int sema_test(void);
 extern int sema_context_switch(void);
@@ -41,6 +41,8 @@ void test_thread(void *arg1, void *arg2, void *arg3)
 	TC_START("Time Measurement");
 	TC_PRINT("Timing results: Clock frequency: %u MHz\n", freq);
 
+	interference_start();
+
 	thread_switch_yield();
 
 	coop_ctx_switch();
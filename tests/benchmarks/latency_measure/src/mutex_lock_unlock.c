@@ -8,6 +8,7 @@
 #include <zephyr.h>
 #include <timing/timing.h>
 #include "utils.h"
+#include "stats.h"
 
 /* the number of mutex lock/unlock cycles */
 #define N_TEST_MUTEX 1000
@@ -20,40 +21,43 @@ K_MUTEX_DEFINE(test_mutex);
  * @brief Test for the multiple mutex lock/unlock time
  *
  * The routine performs multiple mutex locks and then multiple mutex
- * unlocks to measure the necessary time.
+ * unlocks, recording the time of each individual operation so the
+ * latency distribution can be reported.
  *
  * @return 0 on success
  */
 int mutex_lock_unlock(void)
 {
 	int i;
-	uint32_t diff;
+	struct sample_stats stats;
 	timing_t timestamp_start;
 	timing_t timestamp_end;
 
 	timing_start();
 
-	timestamp_start = timing_counter_get();
+	sample_stats_init(&stats, sample_pool, NUM_SAMPLES);
 
 	for (i = 0; i < N_TEST_MUTEX; i++) {
+		timestamp_start = timing_counter_get();
 		k_mutex_lock(&test_mutex, K_FOREVER);
+		timestamp_end = timing_counter_get();
+		sample_stats_add(&stats, timing_cycles_get(&timestamp_start,
+							   &timestamp_end));
 	}
 
-	timestamp_end = timing_counter_get();
+	sample_stats_report(&stats, "Time to lock a mutex");
 
-	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
-	PRINT_STATS_AVG("Average time to lock a mutex", diff, N_TEST_MUTEX);
-
-	timestamp_start = timing_counter_get();
+	sample_stats_init(&stats, sample_pool, NUM_SAMPLES);
 
 	for (i = 0; i < N_TEST_MUTEX; i++) {
+		timestamp_start = timing_counter_get();
 		k_mutex_unlock(&test_mutex);
+		timestamp_end = timing_counter_get();
+		sample_stats_add(&stats, timing_cycles_get(&timestamp_start,
+							   &timestamp_end));
 	}
 
-	timestamp_end = timing_counter_get();
-	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
-
-	PRINT_STATS_AVG("Average time to unlock a mutex", diff, N_TEST_MUTEX);
+	sample_stats_report(&stats, "Time to unlock a mutex");
 	timing_stop();
 	return 0;
 }
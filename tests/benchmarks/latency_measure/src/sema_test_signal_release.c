@@ -15,6 +15,7 @@
 #include <zephyr.h>
 #include <timing/timing.h>
 #include "utils.h"
+#include "stats.h"
 
 /* the number of semaphore give/take cycles */
 #define N_TEST_SEMA 1000
@@ -70,33 +71,36 @@ int sema_context_switch(void)
  *
  * @brief The function tests semaphore test/signal time
  *
- * The routine performs unlock the quite amount of semaphores and then
- * acquires them in order to measure the necessary time.
+ * The routine performs the given number of semaphore gives followed by
+ * the same number of takes, recording each individual operation so the
+ * latency distribution can be reported.
  *
  * @return 0 on success
  */
 int sema_test_signal(void)
 {
 	int i;
-	uint32_t diff;
+	struct sample_stats stats;
 	timing_t timestamp_start;
 	timing_t timestamp_end;
 
 	bench_test_start();
 	timing_start();
 
-	timestamp_start = timing_counter_get();
+	sample_stats_init(&stats, sample_pool, NUM_SAMPLES);
 
 	for (i = 0; i < N_TEST_SEMA; i++) {
+		timestamp_start = timing_counter_get();
 		k_sem_give(&lock_unlock_sema);
+		timestamp_end = timing_counter_get();
+		sample_stats_add(&stats, timing_cycles_get(&timestamp_start,
+							   &timestamp_end));
 	}
 
-	timestamp_end = timing_counter_get();
 	timing_stop();
 
 	if (bench_test_end() == 0) {
-		diff = timing_cycles_get(&timestamp_start, &timestamp_end);
-		PRINT_STATS_AVG("Average semaphore signal time", diff, N_TEST_SEMA);
+		sample_stats_report(&stats, "Semaphore signal time");
 	} else {
 		error_count++;
 		PRINT_OVERFLOW_ERROR();
@@ -105,22 +109,23 @@ int sema_test_signal(void)
 	bench_test_start();
 	timing_start();
 
-	timestamp_start = timing_counter_get();
+	sample_stats_init(&stats, sample_pool, NUM_SAMPLES);
 
 	for (i = 0; i < N_TEST_SEMA; i++) {
+		timestamp_start = timing_counter_get();
 		k_sem_take(&lock_unlock_sema, K_FOREVER);
+		timestamp_end = timing_counter_get();
+		sample_stats_add(&stats, timing_cycles_get(&timestamp_start,
+							   &timestamp_end));
 	}
 
-	timestamp_end = timing_counter_get();
 	timing_stop();
 
 	if (bench_test_end() == 0) {
-		diff = timing_cycles_get(&timestamp_start, &timestamp_end);
-		PRINT_STATS_AVG("Average semaphore test time", diff, N_TEST_SEMA);
+		sample_stats_report(&stats, "Semaphore test time");
 	} else {
 		error_count++;
 		PRINT_OVERFLOW_ERROR();
 	}
-	timing_stop();
 	return 0;
 }
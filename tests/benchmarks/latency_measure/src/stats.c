@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Sample collection and percentile reporting for the latency benchmarks.
+ *
+ * Samples are recorded as raw cycle deltas while a benchmark runs and
+ * only sorted when the report is printed, so the bookkeeping adds a
+ * single array store to each measured iteration.
+ */
+
+#include <zephyr.h>
+#include <timing/timing.h>
+
+#include "utils.h"
+#include "stats.h"
+
+uint32_t sample_pool[NUM_SAMPLES];
+
+void sample_stats_init(struct sample_stats *stats, uint32_t *buf,
+		       uint32_t cap)
+{
+	stats->samples = buf;
+	stats->cap = cap;
+	stats->count = 0U;
+}
+
+void sample_stats_add(struct sample_stats *stats, uint32_t cycles)
+{
+	/* silently drop samples beyond the buffer capacity; the
+	 * percentiles are computed over what was recorded
+	 */
+	if (stats->count < stats->cap) {
+		stats->samples[stats->count] = cycles;
+	}
+	stats->count++;
+}
+
+/* sort the recorded samples in place, ascending */
+static void sample_sort(uint32_t *samples, uint32_t count)
+{
+	uint32_t i, j;
+	uint32_t val;
+
+	for (i = 1U; i < count; i++) {
+		val = samples[i];
+		for (j = i; j > 0U && samples[j - 1] > val; j--) {
+			samples[j] = samples[j - 1];
+		}
+		samples[j] = val;
+	}
+}
+
+/* return the given percentile from an already sorted sample array */
+static uint32_t sample_percentile(const uint32_t *samples, uint32_t count,
+				  uint32_t percent)
+{
+	uint32_t idx = (count * percent) / 100U;
+
+	if (idx >= count) {
+		idx = count - 1U;
+	}
+
+	return samples[idx];
+}
+
+void sample_stats_report(struct sample_stats *stats, const char *name)
+{
+	uint32_t count = MIN(stats->count, stats->cap);
+	uint64_t sum = 0U;
+	uint32_t avg, p50, p95, p99;
+	uint32_t i;
+
+	if (count == 0U) {
+		printk(" Error: no samples recorded for %s\n", name);
+		error_count++;
+		return;
+	}
+
+	for (i = 0U; i < count; i++) {
+		sum += stats->samples[i];
+	}
+	avg = (uint32_t)(sum / count);
+
+	sample_sort(stats->samples, count);
+
+	p50 = sample_percentile(stats->samples, count, 50);
+	p95 = sample_percentile(stats->samples, count, 95);
+	p99 = sample_percentile(stats->samples, count, 99);
+
+	PRINT_DIST(name, count, stats->samples[0], avg, p50, p95, p99,
+		   stats->samples[count - 1],
+		   (uint32_t)timing_cycles_to_ns(avg));
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _LATENCY_MEASURE_STATS_H
+#define _LATENCY_MEASURE_STATS_H
+
+/*
+ * @brief Per-operation sample collection and distribution reporting.
+ *
+ * Each benchmark records one timestamp delta per iteration instead of a
+ * single averaged number, so that tail latencies (p95/p99/max) show up
+ * in the report and can be diffed against stored baselines.
+ */
+
+#include <zephyr.h>
+
+/* size of the shared sample pool, in samples */
+#define NUM_SAMPLES 1000
+
+/*
+ * Sample pool shared by the benchmarks that run their operations
+ * sequentially. Benchmarks that collect several sample sets at the same
+ * time (e.g. thread lifecycle operations) must provide their own buffers.
+ */
+extern uint32_t sample_pool[NUM_SAMPLES];
+
+struct sample_stats {
+	/* sample buffer, one cycle delta per recorded iteration */
+	uint32_t *samples;
+	/* capacity of the sample buffer, in samples */
+	uint32_t cap;
+	/* number of samples recorded so far */
+	uint32_t count;
+};
+
+void sample_stats_init(struct sample_stats *stats, uint32_t *buf,
+		       uint32_t cap);
+void sample_stats_add(struct sample_stats *stats, uint32_t cycles);
+void sample_stats_report(struct sample_stats *stats, const char *name);
+
+#endif
@@ -6,6 +6,7 @@
 #include <zephyr.h>
 #include <timing/timing.h>
 #include "utils.h"
+#include "stats.h"
 
 #define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
 /* stack used by the threads */
@@ -13,10 +14,27 @@ static K_THREAD_STACK_DEFINE(t1_stack, STACK_SIZE);
 
 static struct k_thread t1;
 
+/* the number of thread lifecycle iterations to sample */
+#define N_THREAD_SAMPLES 100
+
+/* the five lifecycle operations are sampled within the same iteration,
+ * so each needs its own buffer instead of the shared pool
+ */
+static uint32_t create_samples[N_THREAD_SAMPLES];
+static uint32_t start_samples[N_THREAD_SAMPLES];
+static uint32_t suspend_samples[N_THREAD_SAMPLES];
+static uint32_t resume_samples[N_THREAD_SAMPLES];
+static uint32_t abort_samples[N_THREAD_SAMPLES];
+
+static struct sample_stats create_stats;
+static struct sample_stats start_stats;
+static struct sample_stats suspend_stats;
+static struct sample_stats resume_stats;
+static struct sample_stats abort_stats;
+
 timing_t timestamp_start_create_c;
 timing_t timestamp_end_create_c;
 timing_t timestamp_start_start_c;
-timing_t timestamp_end_start_c;
 timing_t timestamp_start_suspend_c;
 timing_t timestamp_end_suspend_c;
 timing_t timestamp_start_resume_c;
@@ -37,50 +55,64 @@ void thread_suspend_resume(void *p1, void *p2, void *p3)
 
 int suspend_resume(void)
 {
-	uint32_t diff;
+	int i;
 
 	timing_start();
 
-	timestamp_start_create_c = timing_counter_get();
-
-	k_tid_t t1_tid = k_thread_create(&t1, t1_stack, STACK_SIZE,
-					 thread_suspend_resume, NULL, NULL,
-					 NULL, K_PRIO_PREEMPT(6), 0, K_FOREVER);
-
-	timestamp_end_create_c = timing_counter_get();
-	k_thread_name_set(t1_tid, "t1");
-
-	timestamp_start_start_c = timing_counter_get();
-	k_thread_start(t1_tid);
-
-	timestamp_end_suspend_c = timing_counter_get();
-	k_thread_resume(t1_tid);
-	timestamp_end_resume_c = timing_counter_get();
-
-
-	diff = timing_cycles_get(&timestamp_start_create_c,
-				 &timestamp_end_create_c);
-	PRINT_STATS("Time to create a thread (without start)", diff);
-
-	diff = timing_cycles_get(&timestamp_start_start_c,
-				 &timestamp_start_suspend_c);
-	PRINT_STATS("Time to start a thread", diff);
-
-	diff = timing_cycles_get(&timestamp_start_suspend_c,
-				 &timestamp_end_suspend_c);
-	PRINT_STATS("Time to suspend a thread", diff);
-
-	diff = timing_cycles_get(&timestamp_start_resume_c,
-				 &timestamp_end_resume_c);
-	PRINT_STATS("Time to resume a thread", diff);
-
-	timestamp_start_abort_1 = timing_counter_get();
-	k_thread_abort(t1_tid);
-	timestamp_end_abort_1 = timing_counter_get();
-
-	diff = timing_cycles_get(&timestamp_start_abort_1,
-				 &timestamp_end_abort_1);
-	PRINT_STATS("Time to abort a thread (not running)", diff);
+	sample_stats_init(&create_stats, create_samples, N_THREAD_SAMPLES);
+	sample_stats_init(&start_stats, start_samples, N_THREAD_SAMPLES);
+	sample_stats_init(&suspend_stats, suspend_samples, N_THREAD_SAMPLES);
+	sample_stats_init(&resume_stats, resume_samples, N_THREAD_SAMPLES);
+	sample_stats_init(&abort_stats, abort_samples, N_THREAD_SAMPLES);
+
+	for (i = 0; i < N_THREAD_SAMPLES; i++) {
+		timestamp_start_create_c = timing_counter_get();
+
+		k_tid_t t1_tid = k_thread_create(&t1, t1_stack, STACK_SIZE,
+						 thread_suspend_resume, NULL,
+						 NULL, NULL,
+						 K_PRIO_PREEMPT(6), 0,
+						 K_FOREVER);
+
+		timestamp_end_create_c = timing_counter_get();
+		k_thread_name_set(t1_tid, "t1");
+
+		timestamp_start_start_c = timing_counter_get();
+		k_thread_start(t1_tid);
+
+		timestamp_end_suspend_c = timing_counter_get();
+		k_thread_resume(t1_tid);
+		timestamp_end_resume_c = timing_counter_get();
+
+		sample_stats_add(&create_stats,
+				 timing_cycles_get(&timestamp_start_create_c,
+						   &timestamp_end_create_c));
+		sample_stats_add(&start_stats,
+				 timing_cycles_get(&timestamp_start_start_c,
+						   &timestamp_start_suspend_c));
+		sample_stats_add(&suspend_stats,
+				 timing_cycles_get(&timestamp_start_suspend_c,
+						   &timestamp_end_suspend_c));
+		sample_stats_add(&resume_stats,
+				 timing_cycles_get(&timestamp_start_resume_c,
+						   &timestamp_end_resume_c));
+
+		timestamp_start_abort_1 = timing_counter_get();
+		k_thread_abort(t1_tid);
+		timestamp_end_abort_1 = timing_counter_get();
+
+		sample_stats_add(&abort_stats,
+				 timing_cycles_get(&timestamp_start_abort_1,
+						   &timestamp_end_abort_1));
+	}
+
+	sample_stats_report(&create_stats,
+			    "Time to create a thread (without start)");
+	sample_stats_report(&start_stats, "Time to start a thread");
+	sample_stats_report(&suspend_stats, "Time to suspend a thread");
+	sample_stats_report(&resume_stats, "Time to resume a thread");
+	sample_stats_report(&abort_stats,
+			    "Time to abort a thread (not running)");
 
 	timing_stop();
 	return 0;
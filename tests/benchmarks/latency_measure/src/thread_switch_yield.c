@@ -6,7 +6,7 @@
 
 /**
  * @file
- * This file contains the benchmark that measure the average time it takes to
+ * This file contains the benchmark that measure the time it takes to
  * do context switches between threads using k_yield () to force
  * context switch.
  */
@@ -16,6 +16,7 @@
 #include <stdlib.h>
 #include "timestamp.h"
 #include "utils.h" /* PRINT () and other macros */
+#include "stats.h"
 
 /* context switch enough time so our measurement is precise */
 #define NB_OF_YIELD 1000
@@ -44,38 +45,42 @@ void yielding_thread(void *arg1, void *arg2, void *arg3)
 /**
  * @brief Entry point for thread context switch using yield test
  *
+ * Each sample covers one k_yield() round trip, i.e. the switch to the
+ * helper thread and the switch back, so a single sample holds two
+ * context switches.
+ *
  * @return N/A
  */
 void thread_switch_yield(void)
 {
 	uint32_t iterations = 0U;
 	int32_t delta;
+	struct sample_stats stats;
 	timing_t timestamp_start;
 	timing_t timestamp_end;
-	uint32_t ts_diff;
 
 	timing_start();
 	bench_test_start();
 
+	sample_stats_init(&stats, sample_pool, NUM_SAMPLES);
+
 	/* launch helper thread of the same priority as the thread
 	 * of routine
 	 */
 	k_thread_create(&y_thread, y_stack_area, Y_STACK_SIZE, yielding_thread,
 			NULL, NULL, NULL, Y_PRIORITY, 0, K_NO_WAIT);
 
-	/* get initial timestamp */
-	timestamp_start = timing_counter_get();
-
 	/* loop until either helper or this routine reaches number of yields */
 	while (iterations < NB_OF_YIELD &&
 	       helper_thread_iterations < NB_OF_YIELD) {
+		timestamp_start = timing_counter_get();
 		k_yield();
+		timestamp_end = timing_counter_get();
+		sample_stats_add(&stats, timing_cycles_get(&timestamp_start,
+							   &timestamp_end));
 		iterations++;
 	}
 
-	/* get the number of cycles it took to do the test */
-	timestamp_end = timing_counter_get();
-
 	/* Ensure both helper and this routine were context switching back &
 	 * forth.
 	 * For execution to reach the line below, either this routine or helper
@@ -95,11 +100,8 @@ void thread_switch_yield(void)
 		printk(" Error, iteration:%u, helper iteration:%u",
 			     iterations, helper_thread_iterations);
 	} else {
-		/* thread_yield is called (iterations + helper_thread_iterations)
-		 * times in total.
-		 */
-		ts_diff = timing_cycles_get(&timestamp_start, &timestamp_end);
-		PRINT_STATS_AVG("Average thread context switch using yield", ts_diff, (iterations + helper_thread_iterations));
+		sample_stats_report(&stats,
+			"Thread context switch using yield (round trip)");
 	}
 
 	timing_stop();
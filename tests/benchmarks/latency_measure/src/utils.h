@@ -24,10 +24,13 @@ extern int error_count;
 #define PRINT_OVERFLOW_ERROR()			\
 	printk(" Error: tick occurred\n")
 
-#ifdef CSV_FORMAT_OUTPUT
+#if defined(CSV_FORMAT_OUTPUT) || defined(CONFIG_BENCHMARK_CSV_OUTPUT)
 #define FORMAT "%-60s,%8u,%8u\n"
+#define DIST_FORMAT "%-60s,%8u,%8u,%8u,%8u,%8u,%8u,%8u,%8u\n"
 #else
 #define FORMAT "%-60s:%8u cycles , %8u ns\n"
+#define DIST_FORMAT \
+	"%-60s:%8u samples , min %6u , avg %6u , p50 %6u , p95 %6u , p99 %6u , max %6u cycles , avg %8u ns\n"
 #endif
 
 #define PRINT_F(...)						\
@@ -43,5 +46,15 @@ extern int error_count;
 #define PRINT_STATS_AVG(x, y, counter)	\
 	PRINT_F(x, y / counter, (uint32_t)timing_cycles_to_ns_avg(y, counter));
 
+/* distribution line: name, count, min, avg, p50, p95, p99, max, avg ns */
+#define PRINT_DIST(...)						\
+	{							\
+		char sline[256];				\
+		snprintk(sline, 254, DIST_FORMAT, ##__VA_ARGS__); \
+		printk("%s", sline);				\
+	}
+
+/* background load generators, see interference.c */
+void interference_start(void);
 
 #endif
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+
+/* This is the SMP companion to the uniprocessor scheduler
+ * microbenchmark in main.c.  Instead of measuring minimum latencies of
+ * individual primitives it measures the cross-CPU behavior we care
+ * about when tuning the scheduler: wakeup fan-out to many threads,
+ * producer/consumer queue throughput across cores, convoying on a
+ * contended mutex, and the cost difference between a thread handoff
+ * that stays on one CPU and one that has to cross CPUs via IPI.
+ *
+ * All scenarios are parameterized over CONFIG_MP_NUM_CPUS.  Timestamps
+ * are taken with k_cycle_get_32() on whichever CPU the measuring
+ * thread happens to run, so the platform cycle counters are assumed to
+ * be synchronized across cores (true for the qemu SMP targets).
+ */
+
+#define NUM_CPUS CONFIG_MP_NUM_CPUS
+
+/* number of threads woken by the fan-out scenario */
+#define N_WAITERS (2 * NUM_CPUS)
+
+/* iterations for the averaged scenarios */
+#define N_FANOUT_RUNS 100
+#define N_QUEUE_ITEMS 10000
+#define N_PINGPONG 1000
+
+/* runtime of the mutex convoy scenario */
+#define CONVOY_RUN_MS 100
+
+#define WORKER_PRIO K_PRIO_PREEMPT(1)
+#define WORKER_STACKSZ 1024
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, N_WAITERS, WORKER_STACKSZ);
+static struct k_thread worker_threads[N_WAITERS];
+
+/*
+ * Scenario 1: wakeup fan-out.  N_WAITERS threads pend on individual
+ * semaphores; the main thread signals all of them back to back and the
+ * spread between the first and the last thread actually running shows
+ * how quickly wakeups propagate across the CPUs.
+ */
+
+static struct k_sem waiter_sems[N_WAITERS];
+static struct k_sem fanout_done;
+static volatile uint32_t wake_stamps[N_WAITERS];
+
+static void waiter_fn(void *arg1, void *arg2, void *arg3)
+{
+	int idx = (int)(uintptr_t)arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		k_sem_take(&waiter_sems[idx], K_FOREVER);
+		wake_stamps[idx] = k_cycle_get_32();
+		k_sem_give(&fanout_done);
+	}
+}
+
+static void bench_wakeup_fanout(void)
+{
+	uint64_t tot_first = 0U, tot_last = 0U;
+	int i, run;
+
+	k_sem_init(&fanout_done, 0, N_WAITERS);
+
+	for (i = 0; i < N_WAITERS; i++) {
+		k_sem_init(&waiter_sems[i], 0, 1);
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				WORKER_STACKSZ, waiter_fn,
+				(void *)(uintptr_t)i, NULL, NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	/* let all waiters reach their semaphores */
+	k_sleep(K_MSEC(10));
+
+	for (run = 0; run < N_FANOUT_RUNS; run++) {
+		uint32_t t0, first, last;
+
+		t0 = k_cycle_get_32();
+		for (i = 0; i < N_WAITERS; i++) {
+			k_sem_give(&waiter_sems[i]);
+		}
+		for (i = 0; i < N_WAITERS; i++) {
+			k_sem_take(&fanout_done, K_FOREVER);
+		}
+
+		first = UINT32_MAX;
+		last = 0U;
+		for (i = 0; i < N_WAITERS; i++) {
+			uint32_t dt = wake_stamps[i] - t0;
+
+			first = MIN(first, dt);
+			last = MAX(last, dt);
+		}
+		tot_first += first;
+		tot_last += last;
+	}
+
+	for (i = 0; i < N_WAITERS; i++) {
+		k_thread_abort(&worker_threads[i]);
+	}
+
+	printk("fanout %d threads: first wake %u last wake %u cyc (avg)\n",
+	       N_WAITERS,
+	       (uint32_t)(tot_first / N_FANOUT_RUNS),
+	       (uint32_t)(tot_last / N_FANOUT_RUNS));
+}
+
+/*
+ * Scenario 2: producer/consumer queue throughput.  A producer thread
+ * appends nodes to a k_queue that the main thread consumes, with a
+ * second queue recycling the nodes.  With more than one CPU the two
+ * ends run concurrently and every node crosses the sched_spinlock and
+ * (typically) a CPU boundary.
+ */
+
+#define N_QUEUE_NODES 64
+
+struct queue_node {
+	void *reserved; /* first word is used by k_queue */
+	uint32_t seq;
+};
+
+static struct queue_node queue_nodes[N_QUEUE_NODES];
+static struct k_queue work_q, free_q;
+
+static void producer_fn(void *arg1, void *arg2, void *arg3)
+{
+	int i;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (i = 0; i < N_QUEUE_ITEMS; i++) {
+		struct queue_node *node = k_queue_get(&free_q, K_FOREVER);
+
+		node->seq = i;
+		k_queue_append(&work_q, node);
+	}
+}
+
+static void bench_queue_throughput(void)
+{
+	uint32_t t0, t1;
+	int i;
+
+	k_queue_init(&work_q);
+	k_queue_init(&free_q);
+
+	for (i = 0; i < N_QUEUE_NODES; i++) {
+		k_queue_append(&free_q, &queue_nodes[i]);
+	}
+
+	t0 = k_cycle_get_32();
+
+	k_thread_create(&worker_threads[0], worker_stacks[0], WORKER_STACKSZ,
+			producer_fn, NULL, NULL, NULL,
+			WORKER_PRIO, 0, K_NO_WAIT);
+
+	for (i = 0; i < N_QUEUE_ITEMS; i++) {
+		struct queue_node *node = k_queue_get(&work_q, K_FOREVER);
+
+		k_queue_append(&free_q, node);
+	}
+
+	t1 = k_cycle_get_32();
+
+	/* let the producer finish exiting before its thread object is
+	 * reused by the next scenario
+	 */
+	k_sleep(K_MSEC(10));
+
+	printk("queue xcore: %d items, %u cyc/item\n",
+	       N_QUEUE_ITEMS, (t1 - t0) / N_QUEUE_ITEMS);
+}
+
+/*
+ * Scenario 3: mutex convoy.  One contender per CPU loops over
+ * lock/work/unlock on a shared mutex for a fixed wall-clock interval;
+ * the aggregate operation count shows how badly the lock handoff
+ * serializes the CPUs.
+ */
+
+static struct k_mutex convoy_mutex;
+static volatile bool convoy_stop;
+static volatile uint32_t convoy_ops[NUM_CPUS];
+static struct k_sem convoy_done;
+
+static void contender_fn(void *arg1, void *arg2, void *arg3)
+{
+	int idx = (int)(uintptr_t)arg1;
+	uint32_t ops = 0U;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (!convoy_stop) {
+		k_mutex_lock(&convoy_mutex, K_FOREVER);
+		k_busy_wait(5);
+		k_mutex_unlock(&convoy_mutex);
+		ops++;
+	}
+	convoy_ops[idx] = ops;
+	k_sem_give(&convoy_done);
+}
+
+static void bench_mutex_convoy(void)
+{
+	uint32_t t0, t1;
+	uint64_t total_ops = 0U;
+	int i;
+
+	k_mutex_init(&convoy_mutex);
+	k_sem_init(&convoy_done, 0, NUM_CPUS);
+	convoy_stop = false;
+
+	t0 = k_cycle_get_32();
+
+	for (i = 0; i < NUM_CPUS; i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				WORKER_STACKSZ, contender_fn,
+				(void *)(uintptr_t)i, NULL, NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	k_sleep(K_MSEC(CONVOY_RUN_MS));
+	convoy_stop = true;
+
+	for (i = 0; i < NUM_CPUS; i++) {
+		k_sem_take(&convoy_done, K_FOREVER);
+	}
+
+	t1 = k_cycle_get_32();
+
+	/* let the contenders finish exiting before their thread
+	 * objects are reused
+	 */
+	k_sleep(K_MSEC(10));
+
+	for (i = 0; i < NUM_CPUS; i++) {
+		total_ops += convoy_ops[i];
+	}
+
+	printk("convoy %d contenders: %u ops, %u cyc/op\n",
+	       NUM_CPUS, (uint32_t)total_ops,
+	       (uint32_t)((uint64_t)(t1 - t0) / MAX(total_ops, 1U)));
+}
+
+/*
+ * Scenario 4: pinned vs cross-CPU handoff.  Two threads ping-pong on a
+ * pair of semaphores.  When both are pinned to the same CPU every
+ * handoff is an ordinary context switch; pinned to different CPUs the
+ * wakeups have to cross cores (on most platforms via IPI).  Requires
+ * CONFIG_SCHED_CPU_MASK for the pinning.
+ */
+
+#ifdef CONFIG_SCHED_CPU_MASK
+
+static struct k_sem ping_sem, pong_sem, pingpong_done;
+static uint32_t pingpong_cycles;
+
+static void ping_fn(void *arg1, void *arg2, void *arg3)
+{
+	uint32_t t0, t1;
+	int i;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	t0 = k_cycle_get_32();
+	for (i = 0; i < N_PINGPONG; i++) {
+		k_sem_give(&ping_sem);
+		k_sem_take(&pong_sem, K_FOREVER);
+	}
+	t1 = k_cycle_get_32();
+
+	pingpong_cycles = t1 - t0;
+	k_sem_give(&pingpong_done);
+}
+
+static void pong_fn(void *arg1, void *arg2, void *arg3)
+{
+	int i;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (i = 0; i < N_PINGPONG; i++) {
+		k_sem_take(&ping_sem, K_FOREVER);
+		k_sem_give(&pong_sem);
+	}
+}
+
+static uint32_t pingpong_run(int ping_cpu, int pong_cpu)
+{
+	k_sem_init(&ping_sem, 0, 1);
+	k_sem_init(&pong_sem, 0, 1);
+	k_sem_init(&pingpong_done, 0, 1);
+
+	k_thread_create(&worker_threads[0], worker_stacks[0], WORKER_STACKSZ,
+			ping_fn, NULL, NULL, NULL,
+			WORKER_PRIO, 0, K_FOREVER);
+	k_thread_create(&worker_threads[1], worker_stacks[1], WORKER_STACKSZ,
+			pong_fn, NULL, NULL, NULL,
+			WORKER_PRIO, 0, K_FOREVER);
+
+	k_thread_cpu_mask_clear(&worker_threads[0]);
+	k_thread_cpu_mask_enable(&worker_threads[0], ping_cpu);
+	k_thread_cpu_mask_clear(&worker_threads[1]);
+	k_thread_cpu_mask_enable(&worker_threads[1], pong_cpu);
+
+	k_thread_start(&worker_threads[1]);
+	k_thread_start(&worker_threads[0]);
+
+	k_sem_take(&pingpong_done, K_FOREVER);
+
+	/* let both threads finish exiting before their thread objects
+	 * are reused
+	 */
+	k_sleep(K_MSEC(10));
+
+	/* round trip is one handoff in each direction */
+	return pingpong_cycles / (2 * N_PINGPONG);
+}
+
+static void bench_pinned_vs_crosscpu(void)
+{
+	uint32_t same, cross;
+
+	same = pingpong_run(0, 0);
+	cross = pingpong_run(0, NUM_CPUS - 1);
+
+	printk("handoff same-cpu %u cyc, cross-cpu %u cyc\n", same, cross);
+}
+
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+void main(void)
+{
+	printk("SMP scheduler benchmark, %d CPUs\n", NUM_CPUS);
+
+	bench_wakeup_fanout();
+	bench_queue_throughput();
+	bench_mutex_convoy();
+#ifdef CONFIG_SCHED_CPU_MASK
+	bench_pinned_vs_crosscpu();
+#endif
+
+	printk("fin\n");
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define NUM_WAITERS 3
+#define TIMEOUT 100
+
+/**TESTPOINT: init via K_CONDVAR_DEFINE*/
+K_CONDVAR_DEFINE(kcondvar);
+static struct k_condvar condvar;
+static struct k_mutex mutex;
+
+static K_THREAD_STACK_ARRAY_DEFINE(tstacks, NUM_WAITERS, STACK_SIZE);
+static struct k_thread tdata[NUM_WAITERS];
+
+static int woken;
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_mutex_lock(&mutex, K_FOREVER), 0, NULL);
+	zassert_equal(k_condvar_wait(&condvar, &mutex, K_FOREVER), 0, NULL);
+	woken++;
+	zassert_equal(k_mutex_unlock(&mutex), 0, NULL);
+}
+
+static void spawn_waiters(int count)
+{
+	woken = 0;
+	for (int i = 0; i < count; i++) {
+		k_thread_create(&tdata[i], tstacks[i], STACK_SIZE,
+				waiter_entry, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	}
+
+	/* let the waiters run up to their k_condvar_wait() */
+	k_msleep(TIMEOUT);
+	zassert_equal(woken, 0, "a waiter did not block");
+}
+
+/**
+ * @brief Test waking a single waiter with k_condvar_signal()
+ */
+static void test_condvar_wait_signal(void)
+{
+	zassert_equal(k_condvar_init(&condvar), 0, NULL);
+	zassert_equal(k_mutex_init(&mutex), 0, NULL);
+
+	spawn_waiters(1);
+
+	zassert_equal(k_condvar_signal(&condvar), 0, NULL);
+	k_msleep(TIMEOUT);
+	zassert_equal(woken, 1, "waiter was not woken by signal");
+}
+
+/**
+ * @brief Test signalling a condition variable nobody waits on
+ */
+static void test_condvar_signal_no_waiter(void)
+{
+	zassert_equal(k_condvar_signal(&kcondvar), 0, NULL);
+	zassert_equal(k_condvar_broadcast(&kcondvar), 0,
+		      "broadcast with no waiters woke somebody");
+}
+
+/**
+ * @brief Test k_condvar_wait() timeout and mutex ownership checking
+ */
+static void test_condvar_timeout(void)
+{
+	zassert_equal(k_condvar_init(&condvar), 0, NULL);
+	zassert_equal(k_mutex_init(&mutex), 0, NULL);
+
+	/* waiting without holding the mutex is rejected */
+	zassert_equal(k_condvar_wait(&condvar, &mutex, K_NO_WAIT), -EPERM,
+		      NULL);
+
+	zassert_equal(k_mutex_lock(&mutex, K_FOREVER), 0, NULL);
+	zassert_equal(k_condvar_wait(&condvar, &mutex, K_MSEC(TIMEOUT)),
+		      -EAGAIN, "wait did not time out");
+
+	/* the mutex is held again after the timeout */
+	zassert_equal(mutex.owner, k_current_get(), NULL);
+	zassert_equal(mutex.lock_count, 1U, NULL);
+	zassert_equal(k_mutex_unlock(&mutex), 0, NULL);
+}
+
+/**
+ * @brief Test that a broadcast with the mutex held morphs the waiters
+ *
+ * While the broadcaster holds the mutex, a broadcast must not make the
+ * waiters runnable; they are moved onto the mutex wait queue and each
+ * wakes only when the mutex is handed to it.
+ */
+static void test_condvar_broadcast_morph(void)
+{
+	zassert_equal(k_condvar_init(&condvar), 0, NULL);
+	zassert_equal(k_mutex_init(&mutex), 0, NULL);
+
+	spawn_waiters(NUM_WAITERS);
+
+	zassert_equal(k_mutex_lock(&mutex, K_FOREVER), 0, NULL);
+	zassert_equal(k_condvar_broadcast(&condvar), NUM_WAITERS,
+		      "broadcast did not report all waiters");
+
+	/* the waiters now sit on the mutex wait queue */
+	k_msleep(TIMEOUT);
+	zassert_equal(woken, 0, "a waiter woke before the mutex was free");
+
+	zassert_equal(k_mutex_unlock(&mutex), 0, NULL);
+	k_msleep(TIMEOUT);
+	zassert_equal(woken, NUM_WAITERS, "not all waiters were woken");
+}
+
+/**
+ * @brief Test that a broadcast without the mutex held wakes everyone
+ */
+static void test_condvar_broadcast_unlocked(void)
+{
+	zassert_equal(k_condvar_init(&condvar), 0, NULL);
+	zassert_equal(k_mutex_init(&mutex), 0, NULL);
+
+	spawn_waiters(NUM_WAITERS);
+
+	zassert_equal(k_condvar_broadcast(&condvar), NUM_WAITERS,
+		      "broadcast did not report all waiters");
+	k_msleep(TIMEOUT);
+	zassert_equal(woken, NUM_WAITERS, "not all waiters were woken");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(condvar_api,
+			 ztest_unit_test(test_condvar_wait_signal),
+			 ztest_unit_test(test_condvar_signal_no_waiter),
+			 ztest_unit_test(test_condvar_timeout),
+			 ztest_unit_test(test_condvar_broadcast_morph),
+			 ztest_unit_test(test_condvar_broadcast_unlocked));
+	ztest_run_test_suite(condvar_api);
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <irq_offload.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define TIMEOUT 100
+
+#define EVT_A BIT(0)
+#define EVT_B BIT(1)
+#define EVT_C BIT(2)
+
+/**TESTPOINT: init via K_EVENT_DEFINE*/
+K_EVENT_DEFINE(kevent);
+static struct k_event event;
+
+static K_THREAD_STACK_DEFINE(tstack, STACK_SIZE);
+static struct k_thread tdata;
+
+static uint32_t thread_matched;
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t mask = POINTER_TO_UINT(p1);
+	uint32_t options = POINTER_TO_UINT(p2);
+
+	thread_matched = k_event_wait(&event, mask, options, K_FOREVER);
+}
+
+static void spawn_waiter(uint32_t mask, uint32_t options)
+{
+	thread_matched = 0U;
+	k_thread_create(&tdata, tstack, STACK_SIZE, waiter_entry,
+			UINT_TO_POINTER(mask), UINT_TO_POINTER(options), NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	/* let the waiter run up to its k_event_wait() */
+	k_msleep(TIMEOUT);
+	zassert_equal(thread_matched, 0U, "waiter did not block");
+}
+
+/**
+ * @brief Test waiting for any event of a mask
+ */
+static void test_event_wait_any(void)
+{
+	k_event_init(&event);
+
+	spawn_waiter(EVT_A | EVT_B, K_EVENT_WAIT_ANY);
+
+	/* an event outside the mask must not wake the waiter */
+	k_event_post(&event, EVT_C);
+	k_msleep(TIMEOUT);
+	zassert_equal(thread_matched, 0U, "woken by unrelated event");
+
+	k_event_post(&event, EVT_B);
+	k_msleep(TIMEOUT);
+	zassert_equal(thread_matched, EVT_B, "wrong matched events");
+
+	/* events stay posted without K_EVENT_WAIT_CONSUME */
+	zassert_equal(k_event_wait(&event, EVT_B | EVT_C, K_EVENT_WAIT_ANY,
+				   K_NO_WAIT), EVT_B | EVT_C, NULL);
+}
+
+/**
+ * @brief Test waiting for all events of a mask
+ */
+static void test_event_wait_all(void)
+{
+	k_event_init(&event);
+
+	spawn_waiter(EVT_A | EVT_B, K_EVENT_WAIT_ALL);
+
+	k_event_post(&event, EVT_A);
+	k_msleep(TIMEOUT);
+	zassert_equal(thread_matched, 0U, "woken with an incomplete mask");
+
+	k_event_post(&event, EVT_B);
+	k_msleep(TIMEOUT);
+	zassert_equal(thread_matched, EVT_A | EVT_B, "wrong matched events");
+}
+
+/**
+ * @brief Test consuming the matching events on wakeup
+ */
+static void test_event_consume(void)
+{
+	k_event_init(&event);
+
+	k_event_post(&event, EVT_A | EVT_C);
+
+	zassert_equal(k_event_wait(&event, EVT_A,
+				   K_EVENT_WAIT_ANY | K_EVENT_WAIT_CONSUME,
+				   K_NO_WAIT), EVT_A, NULL);
+
+	/* EVT_A is gone, EVT_C is untouched */
+	zassert_equal(k_event_wait(&event, EVT_A, K_EVENT_WAIT_ANY, K_NO_WAIT),
+		      0U, "consumed event still posted");
+	zassert_equal(k_event_wait(&event, EVT_C, K_EVENT_WAIT_ANY, K_NO_WAIT),
+		      EVT_C, "unrelated event was consumed");
+}
+
+/**
+ * @brief Test wait timeout and K_NO_WAIT
+ */
+static void test_event_timeout(void)
+{
+	k_event_init(&event);
+
+	zassert_equal(k_event_wait(&event, EVT_A, K_EVENT_WAIT_ANY, K_NO_WAIT),
+		      0U, NULL);
+	zassert_equal(k_event_wait(&event, EVT_A, K_EVENT_WAIT_ANY,
+				   K_MSEC(TIMEOUT)), 0U,
+		      "wait did not time out");
+}
+
+/**
+ * @brief Test k_event_set() replacing the event word
+ */
+static void test_event_set(void)
+{
+	k_event_init(&event);
+
+	k_event_post(&event, EVT_A);
+	k_event_set(&event, EVT_B);
+
+	zassert_equal(k_event_wait(&event, EVT_A, K_EVENT_WAIT_ANY, K_NO_WAIT),
+		      0U, "set did not discard old events");
+	zassert_equal(k_event_wait(&event, EVT_B, K_EVENT_WAIT_ANY, K_NO_WAIT),
+		      EVT_B, NULL);
+}
+
+static void isr_post(const void *arg)
+{
+	k_event_post(&kevent, EVT_A);
+}
+
+/**
+ * @brief Test posting events from interrupt context
+ */
+static void test_event_isr_post(void)
+{
+	k_event_init(&event);
+
+	spawn_waiter(EVT_A, K_EVENT_WAIT_ANY | K_EVENT_WAIT_CONSUME);
+
+	/* use the statically defined object from the ISR */
+	irq_offload(isr_post, NULL);
+	zassert_equal(k_event_wait(&kevent, EVT_A, K_EVENT_WAIT_ANY,
+				   K_NO_WAIT), EVT_A, NULL);
+
+	/* release the waiter pended on the other object */
+	k_event_post(&event, EVT_A);
+	k_msleep(TIMEOUT);
+	zassert_equal(thread_matched, EVT_A, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(event_api,
+			 ztest_unit_test(test_event_wait_any),
+			 ztest_unit_test(test_event_wait_all),
+			 ztest_unit_test(test_event_consume),
+			 ztest_unit_test(test_event_timeout),
+			 ztest_unit_test(test_event_set),
+			 ztest_unit_test(test_event_isr_post));
+	ztest_run_test_suite(event_api);
+}
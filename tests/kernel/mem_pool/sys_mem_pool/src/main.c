@@ -21,6 +21,8 @@
 
 SYS_MEM_POOL_DEFINE(pool, NULL, BLK_SIZE_MIN, BLK_SIZE_MAX,
 		    BLK_NUM_MAX, BLK_ALIGN, ZTEST_SECTION);
+SYS_MEM_POOL_SEGREGATED_DEFINE(seg_pool, NULL, BLK_SIZE_MIN, BLK_SIZE_MAX,
+			       BLK_NUM_MAX, BLK_ALIGN, ZTEST_SECTION);
 
 /**
  * @brief Verify sys_mem_pool allocation and free
@@ -121,15 +123,60 @@ void test_sys_mem_pool_min_block_size(void)
 	}
 }
 
+/**
+ * @brief Verify the segregated free list backend
+ *
+ * @ingroup kernel_memory_pool_tests
+ *
+ * @see SYS_MEM_POOL_SEGREGATED_DEFINE()
+ */
+void test_sys_mem_pool_segregated(void)
+{
+	void *block[TOTAL_MIN_BLKS], *blk;
+
+	/* Split the entire pool into minimum sized blocks */
+	for (int i = 0; i < TOTAL_MIN_BLKS; i++) {
+		block[i] = sys_mem_pool_alloc(&seg_pool,
+					      BLK_SIZE_EXCLUDE_DESC);
+		zassert_not_null(block[i], NULL);
+	}
+	zassert_is_null(sys_mem_pool_alloc(&seg_pool, BLK_SIZE_EXCLUDE_DESC),
+			NULL);
+
+	for (int i = 0; i < TOTAL_MIN_BLKS; i++) {
+		sys_mem_pool_free(block[i]);
+	}
+
+	/* The size classes stay split: minimum sized blocks come
+	 * straight off the class free list again...
+	 */
+	for (int i = 0; i < TOTAL_MIN_BLKS; i++) {
+		block[i] = sys_mem_pool_alloc(&seg_pool,
+					      BLK_SIZE_EXCLUDE_DESC);
+		zassert_not_null(block[i], NULL);
+	}
+	for (int i = 0; i < TOTAL_MIN_BLKS; i++) {
+		sys_mem_pool_free(block[i]);
+	}
+
+	/* ...but, by design, blocks are never recombined, so a
+	 * maximum sized request can no longer be satisfied.
+	 */
+	blk = sys_mem_pool_alloc(&seg_pool, BLK_SIZE_MAX - DESC_SIZE);
+	zassert_is_null(blk, NULL);
+}
+
 /*test case main entry*/
 void test_main(void)
 {
 	sys_mem_pool_init(&pool);
+	sys_mem_pool_init(&seg_pool);
 
 	ztest_test_suite(test_sys_mem_pool_api,
 			 ztest_user_unit_test(test_sys_mem_pool_alloc_free),
 			 ztest_user_unit_test(test_sys_mem_pool_alloc_align4),
-			 ztest_user_unit_test(test_sys_mem_pool_min_block_size)
+			 ztest_user_unit_test(test_sys_mem_pool_min_block_size),
+			 ztest_user_unit_test(test_sys_mem_pool_segregated)
 			 );
 	ztest_run_test_suite(test_sys_mem_pool_api);
 }
@@ -37,6 +37,7 @@ ZTEST_BMEM int woken;
 ZTEST_BMEM int timeout;
 ZTEST_BMEM int index[TOTAL_THREADS_WAITING];
 ZTEST_BMEM struct k_futex simple_futex;
+ZTEST_BMEM struct k_futex requeue_futex;
 ZTEST_BMEM struct k_futex multiple_futex[TOTAL_THREADS_WAITING];
 struct k_futex no_access_futex;
 ZTEST_BMEM atomic_t not_a_futex;
@@ -420,6 +421,70 @@ void test_multiple_futex_wait_wake(void)
 	}
 }
 
+/**
+ * @brief Test k_futex_requeue() wakes some waiters and moves the rest
+ */
+void test_futex_wake_requeue(void)
+{
+	int ret;
+
+	timeout = K_TICKS_FOREVER;
+
+	atomic_clear(&simple_futex.val);
+	atomic_clear(&requeue_futex.val);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		atomic_inc(&simple_futex.val);
+		k_thread_create(&multiple_tid[i], multiple_stack[i],
+				STACK_SIZE, futex_wait_wake_task,
+				&timeout, NULL, NULL, PRIO_WAIT,
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	/* giving time for the other threads to execute */
+	k_yield();
+
+	ret = k_futex_requeue(&simple_futex,
+			atomic_get(&simple_futex.val), &simple_futex, 0);
+	zassert_equal(ret, -EINVAL,
+			"requeue onto the same futex should fail");
+
+	ret = k_futex_requeue(&simple_futex,
+			atomic_get(&simple_futex.val) + 1, &requeue_futex, 0);
+	zassert_equal(ret, -EAGAIN,
+			"requeue with wrong expected value should fail");
+
+	/* wake the highest priority waiter, requeue the other ones */
+	ret = k_futex_requeue(&simple_futex,
+			atomic_get(&simple_futex.val), &requeue_futex, 1);
+	zassert_equal(ret, TOTAL_THREADS_WAITING,
+			"requeue didn't account for all waiting threads");
+
+	/* giving time for the woken thread to execute */
+	k_yield();
+
+	zassert_true(atomic_get(&simple_futex.val) ==
+			TOTAL_THREADS_WAITING - 1,
+			"requeue woke more than wake_count threads");
+
+	/* drain the requeued waiters one by one */
+	for (int i = 1; i < TOTAL_THREADS_WAITING; i++) {
+		ret = k_futex_wake(&requeue_futex, false);
+		zassert_equal(ret, 1,
+				"requeued thread not pending on target futex");
+	}
+
+	/* giving time for the other threads to execute */
+	k_yield();
+
+	zassert_true(atomic_get(&simple_futex.val) == 0,
+			"not all requeued threads were woken");
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_abort(&multiple_tid[i]);
+	}
+}
+
 void test_user_futex_bad(void)
 {
 	int ret;
@@ -542,6 +607,7 @@ void test_main(void)
 			 ztest_unit_test(test_futex_wait_forever_wake_from_isr),
 			 ztest_unit_test(test_futex_multiple_threads_wait_wake),
 			 ztest_unit_test(test_multiple_futex_wait_wake),
+			 ztest_unit_test(test_futex_wake_requeue),
 			 ztest_unit_test(test_futex_wait_forever),
 			 ztest_unit_test(test_futex_wait_timeout),
 			 ztest_unit_test(test_futex_wait_nowait),
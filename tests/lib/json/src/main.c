@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <string.h>
+#include <stdlib.h>
 #include <zephyr/types.h>
 #include <stdbool.h>
 #include <ztest.h>
@@ -539,6 +540,103 @@ static void test_json_encode_bounds_check(void)
 	zassert_equal(ret, -ENOMEM, "Bounds check rejected");
 }
 
+struct stream_result {
+	char some_string[32];
+	int32_t some_int;
+	bool some_bool;
+	int fields;
+};
+
+static const struct json_obj_descr stream_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_struct, some_string, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct test_struct, some_int, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_struct, some_bool, JSON_TOK_TRUE),
+};
+
+static int stream_field_cb(const struct json_obj_descr *descr,
+			   const char *value, size_t value_len,
+			   enum json_tokens type, void *user_data)
+{
+	struct stream_result *res = user_data;
+
+	res->fields++;
+	if (descr == &stream_descr[0]) {
+		zassert_equal(type, JSON_TOK_STRING, "string field type");
+		zassert_true(value_len < sizeof(res->some_string),
+			     "string fits");
+		memcpy(res->some_string, value, value_len);
+		res->some_string[value_len] = '\0';
+	} else if (descr == &stream_descr[1]) {
+		char num[16];
+
+		zassert_equal(type, JSON_TOK_NUMBER, "number field type");
+		zassert_true(value_len < sizeof(num), "number fits");
+		memcpy(num, value, value_len);
+		num[value_len] = '\0';
+		res->some_int = strtol(num, NULL, 10);
+	} else if (descr == &stream_descr[2]) {
+		res->some_bool = (type == JSON_TOK_TRUE);
+	}
+
+	return 0;
+}
+
+static void test_json_stream_decoding(void)
+{
+	const char encoded[] = "{\"some_string\":\"zephyr 123\\uABCD\","
+		"\"unknown\":{\"skipped\": [1, \"]}\"]},"
+		"\"some_int\":42,\"some_bool\":true}";
+	size_t encoded_len = sizeof(encoded) - 1;
+	size_t chunk_sizes[] = { 1, 7, encoded_len };
+
+	for (size_t c = 0; c < ARRAY_SIZE(chunk_sizes); c++) {
+		struct json_stream js;
+		struct stream_result res = { 0 };
+		char scratch[24];
+		size_t chunk = chunk_sizes[c];
+		int ret = 0;
+
+		json_stream_init(&js, stream_descr,
+				 ARRAY_SIZE(stream_descr), scratch,
+				 sizeof(scratch), stream_field_cb, &res);
+
+		for (size_t off = 0; off < encoded_len && ret == 0;
+		     off += chunk) {
+			ret = json_stream_feed(&js, encoded + off,
+					       MIN(chunk, encoded_len - off));
+		}
+
+		zassert_equal(ret, 1, "document complete");
+		zassert_equal(res.fields, 3, "all matched fields reported");
+		zassert_true(!strcmp(res.some_string, "zephyr 123\\uABCD"),
+			     "string is zero-copy raw span");
+		zassert_equal(res.some_int, 42, "number decoded");
+		zassert_true(res.some_bool, "boolean decoded");
+	}
+}
+
+static void test_json_stream_errors(void)
+{
+	struct json_stream js;
+	struct stream_result res = { 0 };
+	char scratch[4];
+
+	json_stream_init(&js, stream_descr, ARRAY_SIZE(stream_descr),
+			 scratch, sizeof(scratch), stream_field_cb, &res);
+	zassert_equal(json_stream_feed(&js, "[1]", 3), -EINVAL,
+		      "top-level array rejected");
+
+	json_stream_init(&js, stream_descr, ARRAY_SIZE(stream_descr),
+			 scratch, sizeof(scratch), stream_field_cb, &res);
+	zassert_equal(json_stream_feed(&js, "{\"some_int\":\"nan\"}", 18),
+		      -EINVAL, "type mismatch rejected");
+
+	json_stream_init(&js, stream_descr, ARRAY_SIZE(stream_descr),
+			 scratch, sizeof(scratch), stream_field_cb, &res);
+	zassert_equal(json_stream_feed(&js, "{\"some_string", 13), -ENOMEM,
+		      "split token over scratch size rejected");
+}
+
 void test_main(void)
 {
 	ztest_test_suite(lib_json_test,
@@ -560,7 +658,9 @@ void test_main(void)
 			 ztest_unit_test(test_json_escape_empty),
 			 ztest_unit_test(test_json_escape_no_op),
 			 ztest_unit_test(test_json_escape_bounds_check),
-			 ztest_unit_test(test_json_encode_bounds_check)
+			 ztest_unit_test(test_json_encode_bounds_check),
+			 ztest_unit_test(test_json_stream_decoding),
+			 ztest_unit_test(test_json_stream_errors)
 			 );
 
 	ztest_run_test_suite(lib_json_test);
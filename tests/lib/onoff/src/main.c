@@ -772,6 +772,67 @@ static void test_recheck_stop(void)
 		      "completed");
 }
 
+static void test_linger(void)
+{
+	int rc;
+
+	/* Verify that a linger period holds off the stop transition
+	 * after the last release, and that a request received while
+	 * lingering cancels the pending stop.
+	 */
+
+	setup_test();
+
+	rc = onoff_manager_set_linger(NULL, K_MSEC(10));
+	zassert_equal(rc, -EINVAL,
+		      "linger 0");
+	rc = onoff_manager_set_linger(&srv, K_FOREVER);
+	zassert_equal(rc, -EINVAL,
+		      "linger forever");
+	rc = onoff_manager_set_linger(&srv, K_MSEC(10));
+	zassert_equal(rc, 0,
+		      "linger set");
+
+	rc = onoff_request(&srv, &cli);
+	zassert_equal(rc, ONOFF_STATE_OFF,
+		      "req");
+	check_result(0, "req");
+	zassert_equal(ntrans, 2U,
+		      "req trans");
+
+	rc = onoff_release(&srv);
+	zassert_equal(rc, ONOFF_STATE_ON,
+		      "rel");
+	zassert_equal(srv.flags & ONOFF_STATE_MASK, ONOFF_STATE_ON,
+		      "lingering");
+	zassert_equal(ntrans, 2U,
+		      "rel trans");
+
+	/* A request during the linger period is served from ON
+	 * without a stop/start cycle.
+	 */
+	reset_cli();
+	rc = onoff_request(&srv, &cli);
+	zassert_equal(rc, ONOFF_STATE_ON,
+		      "linger req");
+	check_callback(ONOFF_STATE_ON, 0,
+		       "linger req");
+	zassert_equal(ntrans, 2U,
+		      "linger req trans");
+
+	rc = onoff_release(&srv);
+	zassert_equal(rc, ONOFF_STATE_ON,
+		      "rel 2");
+
+	k_sleep(K_MSEC(30));
+	zassert_equal(srv.flags & ONOFF_STATE_MASK, ONOFF_STATE_OFF,
+		      "lingered off");
+	check_trans(2, ONOFF_STATE_TO_OFF, 0,
+		    "linger stop");
+	check_trans(3, ONOFF_STATE_OFF, 0,
+		    "linger off");
+}
+
 static void rel_in_req_cb(struct onoff_manager *srv,
 			  struct onoff_client *cli,
 			  uint32_t state,
@@ -1203,6 +1264,7 @@ void test_main(void)
 			 ztest_unit_test(test_delayed_req),
 			 ztest_unit_test(test_recheck_start),
 			 ztest_unit_test(test_recheck_stop),
+			 ztest_unit_test(test_linger),
 			 ztest_unit_test(test_rel_in_req_cb),
 			 ztest_unit_test(test_multi_reset),
 			 ztest_unit_test(test_error),
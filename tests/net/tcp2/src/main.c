@@ -94,6 +94,7 @@ static void handle_server_test(sa_family_t af, struct tcphdr *th);
 static void handle_syn_resend(void);
 static void handle_client_fin_wait_2_test(sa_family_t af, struct tcphdr *th);
 static void handle_client_closing_test(sa_family_t af, struct tcphdr *th);
+static void handle_server_recv_out_of_order(sa_family_t af, struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -375,6 +376,9 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case 8:
 		handle_client_closing_test(net_pkt_family(pkt), &th);
 		break;
+	case 9:
+		handle_server_recv_out_of_order(net_pkt_family(pkt), &th);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -653,6 +657,8 @@ static void test_server_timeout(struct k_work *work)
 		handle_server_test(AF_INET, NULL);
 	} else if (test_case_no == 5) {
 		handle_server_test(AF_INET6, NULL);
+	} else if (test_case_no == 9) {
+		handle_server_recv_out_of_order(AF_INET, NULL);
 	} else {
 		zassert_true(false, "Invalid test case");
 	}
@@ -1165,6 +1171,129 @@ static void test_client_closing_ipv6(void)
 	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
 }
 
+static void handle_server_recv_out_of_order(sa_family_t af, struct tcphdr *th)
+{
+	struct net_pkt *reply;
+	int ret;
+
+	switch (t_state) {
+	case T_SYN:
+		seq = 0U;
+		ack = 0U;
+		reply = prepare_syn_packet(af, htons(MY_PORT),
+					   htons(PEER_PORT));
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, SYN | ACK);
+		seq++;
+		ack = ntohs(th->th_seq) + 1U;
+		reply = prepare_ack_packet(af, htons(MY_PORT),
+					   htons(PEER_PORT));
+		t_state = T_DATA;
+		break;
+	case T_DATA:
+		/* The out-of-order segment may only be acknowledged
+		 * with a duplicate ACK, not consumed.
+		 */
+		test_verify_flags(th, ACK);
+		zassert_true(th_ack(th) == 1U,
+			     "queued out-of-order segment was acked");
+		seq = 1U;
+		reply = prepare_data_packet(af, htons(MY_PORT),
+					    htons(PEER_PORT), "A", 1U);
+		t_state = T_DATA_ACK;
+		break;
+	case T_DATA_ACK:
+		/* Filling the gap must deliver the queued segment too */
+		test_verify_flags(th, ACK);
+		zassert_true(th_ack(th) == 3U,
+			     "queued out-of-order segment not delivered");
+		test_sem_give();
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	ret = net_recv_data(iface, reply);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	if (t_state == T_DATA) {
+		/* Send the second data byte before the first one */
+		seq = 2U;
+		reply = prepare_data_packet(af, htons(MY_PORT),
+					    htons(PEER_PORT), "B", 1U);
+
+		ret = net_recv_data(iface, reply);
+		if (ret < 0) {
+			goto fail;
+		}
+	}
+
+	return;
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+/* Test case scenario IPv4
+ *   Expect SYN
+ *   send SYN ACK,
+ *   expect ACK,
+ *   send second data segment,
+ *   expect a duplicate ACK not covering it,
+ *   send first data segment,
+ *   expect ACK covering both segments.
+ *   any failures cause test case to fail.
+ */
+static void test_server_recv_out_of_order_ipv4(void)
+{
+	struct net_context *ctx;
+	int ret;
+
+	t_state = T_SYN;
+	test_case_no = 9;
+	seq = ack = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	if (ret < 0) {
+		zassert_true(false, "Failed to get net_context");
+	}
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&my_addr_s,
+			       sizeof(struct sockaddr_in));
+	if (ret < 0) {
+		zassert_true(false, "Failed to bind net_context");
+	}
+
+	ret = net_context_listen(ctx, 1);
+	if (ret < 0) {
+		zassert_true(false, "Failed to listen on net_context");
+	}
+
+	/* Trigger the peer to send SYN */
+	k_delayed_work_submit(&test_server, K_NO_WAIT);
+
+	ret = net_context_accept(ctx, test_tcp_accept_cb, K_FOREVER, NULL);
+	if (ret < 0) {
+		zassert_true(false, "Failed to set accept on net_context");
+	}
+
+	/* test_tcp_accept_cb will release the semaphone after succesfull
+	 * connection.
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* The peer handler will release the semaphone once both data
+	 * segments have been acked.
+	 */
+	test_sem_take(K_MSEC(300), __LINE__);
+
+	net_context_put(ctx);
+}
+
 /** Test case main entry */
 void test_main(void)
 {
@@ -1177,7 +1306,8 @@ void test_main(void)
 			 ztest_unit_test(test_server_ipv6),
 			 ztest_unit_test(test_client_syn_resend),
 			 ztest_unit_test(test_client_fin_wait_2_ipv4),
-			 ztest_unit_test(test_client_closing_ipv6)
+			 ztest_unit_test(test_client_closing_ipv6),
+			 ztest_unit_test(test_server_recv_out_of_order_ipv4)
 			 );
 
 	ztest_run_test_suite(test_tcp_fn);
@@ -3,6 +3,11 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+/* Enable the optional subtree size accounting so this suite also
+ * covers the order-statistic maintenance in every tree operation
+ */
+#define CONFIG_RBTREE_SUBTREE_SIZES 1
+
 #include <ztest.h>
 #include <sys/rb.h>
 
@@ -93,6 +98,12 @@ void check_rbnode(struct rbnode *node, int blacks_above)
 {
 	int side, bheight = blacks_above + z_rb_is_black(node);
 
+	/* The subtree size bookkeeping must match the real node count
+	 * (the children get validated by their own recursive checks)
+	 */
+	_CHECK(node->size == (1U + subtree_size(z_rb_child(node, 0))
+			      + subtree_size(z_rb_child(node, 1))));
+
 	for (side = 0; side < 2; side++) {
 		struct rbnode *ch = z_rb_child(node, side);
 
@@ -245,9 +256,69 @@ void test_rbtree_spam(void)
 	} while (size < MAX_NODES);
 }
 
+void test_rb_build(void)
+{
+	static struct rbnode *sorted[MAX_NODES];
+	static const int sizes[] = { 1, 2, 3, 4, 5, 6, 7, 8, 31, 32, 33,
+				     127, 199, MAX_NODES };
+
+	for (unsigned int si = 0U; si < ARRAY_SIZE(sizes); si++) {
+		int size = sizes[si], levels = 0, i;
+
+		(void)memset(&tree, 0, sizeof(tree));
+		tree.lessthan_fn = node_lessthan;
+		(void)memset(nodes, 0, sizeof(nodes));
+		(void)memset(node_mask, 0, sizeof(node_mask));
+
+		/* Our sort criterion is node address, so the nodes
+		 * array is already the sorted order rb_build() wants
+		 */
+		for (i = 0; i < size; i++) {
+			sorted[i] = &nodes[i];
+			set_node_mask(i, 1);
+		}
+
+		rb_build(&tree, sorted, size);
+		check_tree(size);
+
+		/* A perfectly balanced tree of N nodes has exactly
+		 * floor(log2(N)) + 1 levels
+		 */
+		while ((size >> levels) != 0) {
+			levels++;
+		}
+		_CHECK(tree.max_depth == levels);
+
+		/* Order statistics: rb_nth(i) must be the i'th-lowest
+		 * node for every valid rank, and NULL past the end
+		 */
+		_CHECK(rb_size(&tree) == (size_t)size);
+		for (i = 0; i < size; i++) {
+			_CHECK(rb_nth(&tree, i) == &nodes[i]);
+		}
+		_CHECK(rb_nth(&tree, size) == NULL);
+
+		/* The built tree must stay valid through subsequent
+		 * incremental updates
+		 */
+		for (i = 0; i < size; i += 3) {
+			rb_remove(&tree, &nodes[i]);
+			set_node_mask(i, 0);
+		}
+		check_tree(size);
+
+		for (i = 0; i < size; i += 3) {
+			checked_insert(&tree, &nodes[i]);
+			set_node_mask(i, 1);
+		}
+		check_tree(size);
+	}
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_rbtree,
-			 ztest_unit_test(test_rbtree_spam));
+			 ztest_unit_test(test_rbtree_spam),
+			 ztest_unit_test(test_rb_build));
 	ztest_run_test_suite(test_rbtree);
 }